@@ -8,12 +8,16 @@
 //! \file athena.hpp
 //  \brief contains Athena++ general purpose types, structures, enums, etc.
 
+#include <cstdint>
 #include <string>
+#include <type_traits>
 
 #include <Kokkos_Core.hpp>
 #include <Kokkos_DualView.hpp>
 #include <Kokkos_Macros.hpp>
 #include "config.hpp"
+#include "utils/autotune.hpp"
+#include "utils/profiler.hpp"
 
 //----------------------------------------------------------------------------------------
 // type alias that allows code to run with either floats or doubles
@@ -59,7 +63,7 @@ enum MetricIndex {I00=0, I01=1, I02=2, I03=3, I11=4, I12=5, I13=6, I22=7, I23=8,
 enum ParticlesIndex {PGID=0, PTAG=1, IPX=0, IPVX=1, IPY=2, IPVY=3, IPZ=4, IPVZ=5};
 
 // integer constants to specify spatial reconstruction methods
-enum ReconstructionMethod {dc, plm, ppm4, ppmx, wenoz};
+enum ReconstructionMethod {dc, plm, ppm4, ppmx, wenoz, wenoza};
 
 // constants that enumerate time evolution options
 enum TimeEvolution {tstatic, kinematic, dynamic};
@@ -93,6 +97,15 @@ using ScratchMemSpace = DevExeSpace::scratch_memory_space;
 using LayoutWrapper = Kokkos::LayoutRight;                // increments last index fastest
 using TeamMember_t = Kokkos::TeamPolicy<>::member_type;   // for Kokkos thread teams
 
+// Tile width (in x1-pencils) used by the x3 flux sweeps.  On host execution spaces each
+// team advances a tile of adjacent pencils through k together, so every plane of the
+// strided x3 stencil is read as one long contiguous run instead of isolated pencils
+// separated by nx1*nx2 elements (hardware prefetchers give a fraction of streaming
+// bandwidth on such short runs).  On device a tile is a single pencil, preserving the
+// original sweeps and keeping scratch usage within shared memory limits.
+constexpr int flux_tile_x3 =
+    std::is_same<DevExeSpace, Kokkos::DefaultHostExecutionSpace>::value ? 8 : 1;
+
 //----------------------------------------------------------------------------------------
 // alias template declarations for various array types (formerly AthenaArrays)
 // mostly used to store cell-centered variables (volume averaged)
@@ -123,6 +136,24 @@ using HostArray4D = Kokkos::View<T ****, LayoutWrapper, HostMemSpace>;
 template <typename T>
 using HostArray5D = Kokkos::View<T *****, LayoutWrapper, HostMemSpace>;
 
+// host-pinned (page-locked) memory space used to stage device<->host transfers at full
+// DMA bandwidth; identical to HostSpace when the device backend is host-resident
+#if defined(KOKKOS_ENABLE_CUDA)
+using HpinMemSpace = Kokkos::CudaHostPinnedSpace;
+#elif defined(KOKKOS_ENABLE_HIP)
+using HpinMemSpace = Kokkos::HIPHostPinnedSpace;
+#else
+using HpinMemSpace = Kokkos::HostSpace;
+#endif
+
+// template declarations for construction of Kokkos::View in pinned host memory
+template <typename T>
+using HpinArray1D = Kokkos::View<T *, LayoutWrapper, HpinMemSpace>;
+template <typename T>
+using HpinArray4D = Kokkos::View<T ****, LayoutWrapper, HpinMemSpace>;
+template <typename T>
+using HpinArray5D = Kokkos::View<T *****, LayoutWrapper, HpinMemSpace>;
+
 // template declarations for construction of Kokkos::DualViews
 template <typename T>
 using DualArray1D = Kokkos::DualView<T *, LayoutWrapper, DevMemSpace>;
@@ -181,6 +212,16 @@ struct HostFaceFld4D {
   ~HostFaceFld4D() = default;
 };
 
+template <typename T>
+struct HpinFaceFld4D {
+  HpinArray4D<T> x1f, x2f, x3f;  // name indicates both direction and location
+  HpinFaceFld4D(const std::string &label, int nmb, int n3, int n2, int n1) :
+    x1f(label + ".x1f", nmb, n3, n2, n1+1),
+    x2f(label + ".x2f", nmb, n3, n2+1, n1),
+    x3f(label + ".x3f", nmb, n3+1, n2, n1) {}
+  ~HpinFaceFld4D() = default;
+};
+
 //----------------------------------------------------------------------------------------
 // struct for storing edge-centered (line-averaged) variables, e.g. EMF
 //             _____________
@@ -204,12 +245,76 @@ struct DvceEdgeFld4D {
   ~DvceEdgeFld4D() = default;
 };
 
+//----------------------------------------------------------------------------------------
+// struct for a 4D array of single-bit flags packed 64 cells per word.  Compared to a
+// DvceArray4D<bool> this cuts the memory footprint 8x, clears with a single bulk fill,
+// and supports a cheap "is any flag set in this pack" test that lets callers
+// short-circuit work when nothing is flagged (e.g. FOFC in smooth flows)
+
+struct DvceBitFlag4D {
+  DvceArray1D<uint64_t> words;   // packed flag bits
+  int n3, n2, n1;                // extents of the three trailing (cell) dimensions
+  explicit DvceBitFlag4D(const std::string &label) :
+    words(label, 1), n3(0), n2(0), n1(0) {}
+  ~DvceBitFlag4D() = default;
+
+  // resize to cover (nmb,n3,n2,n1) cells and clear all flags
+  void Realloc(int nmb, int n3_in, int n2_in, int n1_in) {
+    n3 = n3_in; n2 = n2_in; n1 = n1_in;
+    Kokkos::realloc(words, (nmb*n3*n2*n1 + 63)/64);
+    ZeroClear();
+  }
+
+  // clear all flags at once
+  void ZeroClear() {
+    Kokkos::deep_copy(words, static_cast<uint64_t>(0));
+  }
+
+  // return true if any flag is set anywhere (blocks on a small device reduction over
+  // ncells/64 words; far cheaper than touching every cell)
+  bool AnySet() const {
+    int nset = 0;
+    auto &words_ = words;
+    Kokkos::parallel_reduce("bitflag_any",
+      Kokkos::RangePolicy<>(DevExeSpace(), 0, static_cast<int>(words.extent(0))),
+      KOKKOS_LAMBDA(const int w, int &sum) {
+        if (words_(w) != 0) { sum += 1; }
+      }, Kokkos::Sum<int>(nset));
+    return (nset > 0);
+  }
+
+  KOKKOS_INLINE_FUNCTION int BitIndex(int m, int k, int j, int i) const {
+    return i + n1*(j + n2*(k + n3*m));
+  }
+  // set flag at (m,k,j,i); safe for concurrent calls from different threads
+  KOKKOS_INLINE_FUNCTION void Set(int m, int k, int j, int i) const {
+    int b = BitIndex(m, k, j, i);
+    Kokkos::atomic_or(&words(b >> 6), static_cast<uint64_t>(1) << (b & 63));
+  }
+  // clear flag at (m,k,j,i); safe for concurrent calls from different threads
+  KOKKOS_INLINE_FUNCTION void Clear(int m, int k, int j, int i) const {
+    int b = BitIndex(m, k, j, i);
+    Kokkos::atomic_and(&words(b >> 6), ~(static_cast<uint64_t>(1) << (b & 63)));
+  }
+  // test flag at (m,k,j,i)
+  KOKKOS_INLINE_FUNCTION bool Test(int m, int k, int j, int i) const {
+    int b = BitIndex(m, k, j, i);
+    return ((words(b >> 6) >> (b & 63)) & 1) != 0;
+  }
+};
+
 //----------------------------------------------------------------------------------------
 // wrappers for Kokkos::parallel_for
 // These wrappers implement a variety of parallel execution strategies, including
 // 1D-range, and thread teams for use with inner vector threads. Experiments in K-Athena
 // and Parthenon indicate that 1D-range policy is generally faster than multidimensional
 // MD-range policy, so the latter is not used.
+// When runtime profiling is enabled ('<time> profiler = true'), every wrapper times its
+// kernel through the scoped guard defined in utils/profiler.hpp, keyed by the name
+// string passed to Kokkos, so per-kernel statistics are built in without external tools.
+// The par_for_outer wrappers additionally consult the autotuner in utils/autotune.hpp
+// ('<time> autotune = true'), which explores and pins per-kernel team sizes in place of
+// the default Kokkos::AUTO.
 //------------------------------
 // 1D loop using Kokkos 1D Range
 template <typename Function>
@@ -217,6 +322,7 @@ inline void par_for(const std::string &name, DevExeSpace exec_space,
                     const int &il, const int &iu, const Function &function) {
   // compute total number of elements and call Kokkos::parallel_for()
   const int ni = iu - il + 1;
+  profiler::KernelTimer<DevExeSpace> tguard(name, exec_space, ni);
   Kokkos::parallel_for(name, Kokkos::RangePolicy<>(exec_space, 0, ni),
   KOKKOS_LAMBDA(const int &idx) {
     // compute i indices of thread and call function
@@ -235,6 +341,7 @@ inline void par_for(const std::string &name, DevExeSpace exec_space,
   const int nj = ju - jl + 1;
   const int ni = iu - il + 1;
   const int nji  = nj * ni;
+  profiler::KernelTimer<DevExeSpace> tguard(name, exec_space, nji);
   Kokkos::parallel_for(name, Kokkos::RangePolicy<>(exec_space, 0, nji),
   KOKKOS_LAMBDA(const int &idx) {
     // compute j,i indices of thread and call function
@@ -257,6 +364,7 @@ inline void par_for(const std::string &name, DevExeSpace exec_space,
   const int ni = iu - il + 1;
   const int nkji = nk * nj * ni;
   const int nji  = nj * ni;
+  profiler::KernelTimer<DevExeSpace> tguard(name, exec_space, nkji);
   Kokkos::parallel_for(name, Kokkos::RangePolicy<>(exec_space, 0, nkji),
   KOKKOS_LAMBDA(const int &idx) {
     // compute k,j,i indices of thread and call function
@@ -284,6 +392,7 @@ inline void par_for(const std::string &name, DevExeSpace exec_space,
   const int nnkji = nn * nk * nj * ni;
   const int nkji  = nk * nj * ni;
   const int nji   = nj * ni;
+  profiler::KernelTimer<DevExeSpace> tguard(name, exec_space, nnkji);
   Kokkos::parallel_for(name, Kokkos::RangePolicy<>(exec_space, 0, nnkji),
   KOKKOS_LAMBDA(const int &idx) {
     // compute n,k,j,i indices of thread and call function
@@ -316,6 +425,7 @@ inline void par_for(const std::string &name, DevExeSpace exec_space,
   const int nnkji  = nn * nk * nj * ni;
   const int nkji   = nk * nj * ni;
   const int nji    = nj * ni;
+  profiler::KernelTimer<DevExeSpace> tguard(name, exec_space, nmnkji);
   Kokkos::parallel_for(name, Kokkos::RangePolicy<>(exec_space, 0, nmnkji),
   KOKKOS_LAMBDA(const int &idx) {
     // compute m,n,k,j,i indices of thread and call function
@@ -332,6 +442,27 @@ inline void par_for(const std::string &name, DevExeSpace exec_space,
   });
 }
 
+//------------------------------
+// (re)allocation with parallel first-touch initialization.  Allocates the View without
+// Kokkos' own initialization (a memset issued from the calling thread, which places
+// every page of the allocation on that thread's NUMA node) and instead zero-fills it
+// with a flat 1D-range loop over the contiguous span.  Since the par_for wrappers above
+// also use flat 1D ranges with static scheduling, the thread that later iterates over
+// each element is the one that first-touches its page, so on dual-socket CPU builds
+// pages land on the socket that computes on them.  On device execution spaces this is
+// equivalent to an ordinary Kokkos::realloc.
+template <typename ViewType, typename... Dims>
+inline void realloc_first_touch(ViewType &v, Dims... dims) {
+  Kokkos::realloc(Kokkos::WithoutInitializing, v, dims...);
+  using val_t = typename ViewType::value_type;
+  val_t *pdata = v.data();
+  const int span = static_cast<int>(v.span());
+  Kokkos::parallel_for("first_touch", Kokkos::RangePolicy<>(DevExeSpace(), 0, span),
+  KOKKOS_LAMBDA(const int &idx) {
+    pdata[idx] = static_cast<val_t>(0);
+  });
+}
+
 //------------------------------------------
 // 1D outer parallel loop using Kokkos Teams
 template <typename Function>
@@ -339,12 +470,13 @@ inline void par_for_outer(const std::string &name, DevExeSpace exec_space,
                           size_t scr_size, const int scr_level,
                           const int kl, const int ku, const Function &function) {
   const int nk = ku - kl + 1;
-  Kokkos::TeamPolicy<> policy(exec_space, nk, Kokkos::AUTO);
-  Kokkos::parallel_for(name, policy.set_scratch_size(scr_level,Kokkos::PerTeam(scr_size)),
-  KOKKOS_LAMBDA(TeamMember_t tmember) {
+  profiler::KernelTimer<DevExeSpace> tguard(name, exec_space, nk, scr_size);
+  autotune::TeamTuner<DevExeSpace> tuner(name, exec_space);
+  auto lam = KOKKOS_LAMBDA(TeamMember_t tmember) {
     const int k = tmember.league_rank() + kl;
     function(tmember, k);
-  });
+  };
+  Kokkos::parallel_for(name, tuner.policy(nk, scr_size, scr_level, lam), lam);
 }
 
 //------------------------------------------
@@ -357,13 +489,14 @@ inline void par_for_outer(const std::string &name, DevExeSpace exec_space,
   const int nk = ku - kl + 1;
   const int nj = ju - jl + 1;
   const int nkj = nk*nj;
-  Kokkos::TeamPolicy<> policy(exec_space, nkj, Kokkos::AUTO);
-  Kokkos::parallel_for(name, policy.set_scratch_size(scr_level,Kokkos::PerTeam(scr_size)),
-  KOKKOS_LAMBDA(TeamMember_t tmember) {
+  profiler::KernelTimer<DevExeSpace> tguard(name, exec_space, nkj, scr_size);
+  autotune::TeamTuner<DevExeSpace> tuner(name, exec_space);
+  auto lam = KOKKOS_LAMBDA(TeamMember_t tmember) {
     const int k = tmember.league_rank()/nj + kl;
     const int j = tmember.league_rank()%nj + jl;
     function(tmember, k, j);
-  });
+  };
+  Kokkos::parallel_for(name, tuner.policy(nkj, scr_size, scr_level, lam), lam);
 }
 
 //------------------------------------------
@@ -378,16 +511,17 @@ inline void par_for_outer(const std::string &name, DevExeSpace exec_space,
   const int nj = ju - jl + 1;
   const int nkj  = nk*nj;
   const int nnkj = nn*nk*nj;
-  Kokkos::TeamPolicy<> policy(exec_space, nnkj, Kokkos::AUTO);
-  Kokkos::parallel_for(name, policy.set_scratch_size(scr_level,Kokkos::PerTeam(scr_size)),
-  KOKKOS_LAMBDA(TeamMember_t tmember) {
+  profiler::KernelTimer<DevExeSpace> tguard(name, exec_space, nnkj, scr_size);
+  autotune::TeamTuner<DevExeSpace> tuner(name, exec_space);
+  auto lam = KOKKOS_LAMBDA(TeamMember_t tmember) {
     int n = (tmember.league_rank())/nkj;
     int k = (tmember.league_rank() - n*nkj)/nj;
     int j = (tmember.league_rank() - n*nkj - k*nj) + jl;
     n += nl;
     k += kl;
     function(tmember, n, k, j);
-  });
+  };
+  Kokkos::parallel_for(name, tuner.policy(nnkj, scr_size, scr_level, lam), lam);
 }
 
 //------------------------------------------
@@ -405,9 +539,9 @@ inline void par_for_outer(const std::string &name, DevExeSpace exec_space,
   const int nkj   = nk*nj;
   const int nnkj  = nn*nk*nj;
   const int nmnkj = nm*nn*nk*nj;
-  Kokkos::TeamPolicy<> policy(exec_space, nmnkj, Kokkos::AUTO);
-  Kokkos::parallel_for(name, policy.set_scratch_size(scr_level,Kokkos::PerTeam(scr_size)),
-  KOKKOS_LAMBDA(TeamMember_t tmember) {
+  profiler::KernelTimer<DevExeSpace> tguard(name, exec_space, nmnkj, scr_size);
+  autotune::TeamTuner<DevExeSpace> tuner(name, exec_space);
+  auto lam = KOKKOS_LAMBDA(TeamMember_t tmember) {
     int m = (tmember.league_rank())/nnkj;
     int n = (tmember.league_rank() - m*nnkj)/nkj;
     int k = (tmember.league_rank() - m*nnkj - n*nkj)/nj;
@@ -416,7 +550,8 @@ inline void par_for_outer(const std::string &name, DevExeSpace exec_space,
     n += nl;
     k += kl;
     function(tmember, m, n, k, j);
-  });
+  };
+  Kokkos::parallel_for(name, tuner.policy(nmnkj, scr_size, scr_level, lam), lam);
 }
 
 //---------------------------------------------
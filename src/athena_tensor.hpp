@@ -22,6 +22,22 @@ enum class TensorSymm {
   SYM22,    // symmetric in the last 2 pairs of indices
 };
 
+//----------------------------------------------------------------------------------------
+//! \fn int TensorSym2Idx
+//! \brief maps a symmetric index pair onto the compressed (upper triangular, row-major)
+//! component ordering at compile time.  Together with the idxmap() functions below this
+//! replaces the per-object idxmap_ lookup tables, which occupied thread-local storage
+//! (up to 81 ints for a rank-4 scratch tensor) in every kernel capturing a tensor and
+//! cost a memory indirection per component access.  The component placement itself
+//! follows the layout of the underlying 5D arrays (cell-innermost with LayoutRight),
+//! which the field tensors alias through shallow slices; scratch tensors hold their
+//! components in per-thread arrays, i.e. component-innermost.
+
+KOKKOS_INLINE_FUNCTION
+constexpr int TensorSym2Idx(int const a, int const b, int const ndim) {
+  return (a <= b)? (a*ndim - (a*(a-1))/2 + (b - a)) : (b*ndim - (b*(b-1))/2 + (a - b));
+}
+
 
 using sub_DvceArray5D_2D = decltype(Kokkos::subview(
                            std::declval<DvceArray5D<Real>>(),
@@ -109,21 +125,23 @@ class AthenaHostTensor<T, sym, ndim, 1> {
 template<typename T, TensorSymm sym, int ndim>
 class AthenaHostTensor<T, sym, ndim, 2> {
  public:
-  AthenaHostTensor();
-  // the default destructor/copy operators are sufficient
+  // the default constructor/destructor/copy operators are sufficient
+  AthenaHostTensor() = default;
   ~AthenaHostTensor() = default;
   AthenaHostTensor(AthenaHostTensor<T, sym, ndim, 2> const &) = default;
   AthenaHostTensor<T, sym, ndim, 2> & operator=
   (AthenaHostTensor<T, sym, ndim, 2> const &) = default;
 
+  // component index computed at compile time from the symmetry (template parameter)
+  KOKKOS_INLINE_FUNCTION
   int idxmap(int const a, int const b) const {
-    return idxmap_[a][b];
+    return (sym == TensorSymm::NONE)? (a*ndim + b) : TensorSym2Idx(a, b, ndim);
   }
   // operators to access the data
   KOKKOS_INLINE_FUNCTION
   decltype(auto) operator() (int const m, int const a, int const b,
                              int const k, int const j, int const i) const {
-    return data_(m,idxmap_[a][b],k,j,i);
+    return data_(m,idxmap(a,b),k,j,i);
   }
   //KOKKOS_INLINE_FUNCTION
   void InitWithShallowSlice(HostArray5D<Real> src, const int indx1, const int indx2) {
@@ -133,35 +151,8 @@ class AthenaHostTensor<T, sym, ndim, 2> {
 
  private:
   sub_HostArray5D_2D data_;
-  int idxmap_[3][3];
-  int ndof_;
 };
 
-//----------------------------------------------------------------------------------------
-// Implementation details
-// They are all duplicated to account for dim 0
-template<typename T, TensorSymm sym, int ndim>
-AthenaHostTensor<T, sym, ndim, 2>::AthenaHostTensor() {
-  switch(sym) {
-    case TensorSymm::NONE:
-      ndof_ = 0;
-      for(int a = 0; a < ndim; ++a)
-      for(int b = 0; b < ndim; ++b) {
-        idxmap_[a][b] = ndof_++;
-      }
-      break;
-    case TensorSymm::SYM2:
-    case TensorSymm::ISYM2:
-      ndof_ = 0;
-      for(int a = 0; a < ndim; ++a)
-      for(int b = a; b < ndim; ++b) {
-        idxmap_[a][b] = ndof_++;
-        idxmap_[b][a] = idxmap_[a][b];
-      }
-      break;
-  }
-}
-
 
 // this is the abstract base class
 // This now works only for spatially 3D data
@@ -225,21 +216,23 @@ class AthenaTensor<T, sym, ndim, 1> {
 template<typename T, TensorSymm sym, int ndim>
 class AthenaTensor<T, sym, ndim, 2> {
  public:
-  AthenaTensor();
-  // the default destructor/copy operators are sufficient
+  // the default constructor/destructor/copy operators are sufficient
+  AthenaTensor() = default;
   ~AthenaTensor() = default;
   AthenaTensor(AthenaTensor<T, sym, ndim, 2> const &) = default;
   AthenaTensor<T, sym, ndim, 2> & operator=
   (AthenaTensor<T, sym, ndim, 2> const &) = default;
 
+  // component index computed at compile time from the symmetry (template parameter)
+  KOKKOS_INLINE_FUNCTION
   int idxmap(int const a, int const b) const {
-    return idxmap_[a][b];
+    return (sym == TensorSymm::NONE)? (a*ndim + b) : TensorSym2Idx(a, b, ndim);
   }
   // operators to access the data
   KOKKOS_INLINE_FUNCTION
   decltype(auto) operator() (int const m, int const a, int const b,
                              int const k, int const j, int const i) const {
-    return data_(m,idxmap_[a][b],k,j,i);
+    return data_(m,idxmap(a,b),k,j,i);
   }
   //KOKKOS_INLINE_FUNCTION
   void InitWithShallowSlice(DvceArray5D<Real> src, const int indx1, const int indx2) {
@@ -249,35 +242,8 @@ class AthenaTensor<T, sym, ndim, 2> {
 
  private:
   sub_DvceArray5D_2D data_;
-  int idxmap_[3][3];
-  int ndof_;
 };
 
-//----------------------------------------------------------------------------------------
-// Implementation details
-// They are all duplicated to account for dim 0
-template<typename T, TensorSymm sym, int ndim>
-AthenaTensor<T, sym, ndim, 2>::AthenaTensor() {
-  switch(sym) {
-    case TensorSymm::NONE:
-      ndof_ = 0;
-      for(int a = 0; a < ndim; ++a)
-      for(int b = 0; b < ndim; ++b) {
-        idxmap_[a][b] = ndof_++;
-      }
-      break;
-    case TensorSymm::SYM2:
-    case TensorSymm::ISYM2:
-      ndof_ = 0;
-      for(int a = 0; a < ndim; ++a)
-      for(int b = a; b < ndim; ++b) {
-        idxmap_[a][b] = ndof_++;
-        idxmap_[b][a] = idxmap_[a][b];
-      }
-      break;
-  }
-}
-
 
 // Here tensors are defined as static 1D arrays, with compile-time dimension calculated as
 // dim**rank
@@ -323,24 +289,24 @@ class AthenaScratchTensor<T, sym, ndim, 1> {
 template<typename T, TensorSymm sym, int ndim>
 class AthenaScratchTensor<T, sym, ndim, 2> {
  public:
-  KOKKOS_INLINE_FUNCTION
-  AthenaScratchTensor();
-  // the default destructor/copy operators are sufficient
+  // the default constructor/destructor/copy operators are sufficient
+  AthenaScratchTensor() = default;
   ~AthenaScratchTensor() = default;
   AthenaScratchTensor(AthenaScratchTensor<T, sym, ndim, 2> const &) = default;
   AthenaScratchTensor<T, sym, ndim, 2> & operator=
   (AthenaScratchTensor<T, sym, ndim, 2> const &) = default;
+  // component index computed at compile time from the symmetry (template parameter)
   KOKKOS_INLINE_FUNCTION
   int idxmap(int const a, int const b) const {
-    return idxmap_[a][b];
+    return (sym == TensorSymm::NONE)? (a*ndim + b) : TensorSym2Idx(a, b, ndim);
   }
   KOKKOS_INLINE_FUNCTION
   Real operator()(int const a, int const b) const {
-    return data_[idxmap_[a][b]];
+    return data_[idxmap(a,b)];
   }
   KOKKOS_INLINE_FUNCTION
   Real & operator()(int const a, int const b) {
-    return data_[idxmap_[a][b]];
+    return data_[idxmap(a,b)];
   }
   KOKKOS_INLINE_FUNCTION
   void ZeroClear() {
@@ -351,59 +317,36 @@ class AthenaScratchTensor<T, sym, ndim, 2> {
 
  private:
   Real data_[9];
-  int idxmap_[3][3];
-  int ndof_;
 };
 
-//----------------------------------------------------------------------------------------
-// Implementation details
-template<typename T, TensorSymm sym, int ndim>
-KOKKOS_INLINE_FUNCTION
-AthenaScratchTensor<T, sym, ndim, 2>::AthenaScratchTensor() {
-switch(sym) {
-    case TensorSymm::NONE:
-      ndof_ = 0;
-      for(int a = 0; a < ndim; ++a)
-      for(int b = 0; b < ndim; ++b) {
-        idxmap_[a][b] = ndof_++;
-      }
-      break;
-    case TensorSymm::SYM2:
-    case TensorSymm::ISYM2:
-      ndof_ = 0;
-      for(int a = 0; a < ndim; ++a)
-      for(int b = a; b < ndim; ++b) {
-        idxmap_[a][b] = ndof_++;
-        idxmap_[b][a] = idxmap_[a][b];
-      }
-      break;
-  }
-}
-
 //----------------------------------------------------------------------------------------
 // rank 3 AthenaScratchTensor
 // This is a 0D AthenaScratchTensor
 template<typename T, TensorSymm sym, int ndim>
 class AthenaScratchTensor<T, sym, ndim, 3> {
  public:
-  KOKKOS_INLINE_FUNCTION
-  AthenaScratchTensor();
-  // the default destructor/copy operators are sufficient
+  // the default constructor/destructor/copy operators are sufficient
+  AthenaScratchTensor() = default;
   ~AthenaScratchTensor() = default;
   AthenaScratchTensor(AthenaScratchTensor<T, sym, ndim, 3> const &) = default;
   AthenaScratchTensor<T, sym, ndim, 3> & operator=
   (AthenaScratchTensor<T, sym, ndim, 3> const &) = default;
+  // component index computed at compile time from the symmetry (template parameter)
   KOKKOS_INLINE_FUNCTION
   int idxmap(int const a, int const b, int const c) const {
-    return idxmap_[a][b][c];
+    return (sym == TensorSymm::SYM2)?
+             (a*((ndim*(ndim+1))/2) + TensorSym2Idx(b, c, ndim)) :
+           (sym == TensorSymm::ISYM2)?
+             (TensorSym2Idx(a, b, ndim)*ndim + c) :
+             ((a*ndim + b)*ndim + c);
   }
   KOKKOS_INLINE_FUNCTION
   Real operator()(int const a, int const b, int const c) const {
-    return data_[idxmap_[a][b][c]];
+    return data_[idxmap(a,b,c)];
   }
   KOKKOS_INLINE_FUNCTION
   Real & operator()(int const a, int const b, int const c) {
-    return data_[idxmap_[a][b][c]];
+    return data_[idxmap(a,b,c)];
   }
   KOKKOS_INLINE_FUNCTION
   void ZeroClear() {
@@ -414,71 +357,40 @@ class AthenaScratchTensor<T, sym, ndim, 3> {
 
  private:
   Real data_[27];
-  int idxmap_[3][3][3];
-  int ndof_;
 };
 
-//----------------------------------------------------------------------------------------
-// Implementation details
-template<typename T, TensorSymm sym, int ndim>
-KOKKOS_INLINE_FUNCTION
-AthenaScratchTensor<T, sym, ndim, 3>::AthenaScratchTensor() {
-  switch(sym) {
-    case TensorSymm::NONE:
-      ndof_ = 0;
-      for(int a = 0; a < ndim; ++a)
-      for(int b = 0; b < ndim; ++b)
-      for(int c = 0; c < ndim; ++c) {
-        idxmap_[a][b][c] = ndof_++;
-      }
-      break;
-    case TensorSymm::SYM2:
-      ndof_ = 0;
-      for(int a = 0; a < ndim; ++a)
-      for(int b = 0; b < ndim; ++b)
-      for(int c = b; c < ndim; ++c) {
-        idxmap_[a][b][c] = ndof_++;
-        idxmap_[a][c][b] = idxmap_[a][b][c];
-      }
-      break;
-    case TensorSymm::ISYM2:
-      ndof_ = 0;
-      for(int a = 0; a < ndim; ++a)
-      for(int b = a; b < ndim; ++b)
-      for(int c = 0; c < ndim; ++c) {
-        idxmap_[a][b][c] = ndof_++;
-        idxmap_[b][a][c] = idxmap_[a][b][c];
-      }
-      break;
-  }
-}
-
 //----------------------------------------------------------------------------------------
 // rank 4 AthenaScratchTensor
 // This is a 0D AthenaScratchTensor
 template<typename T, TensorSymm sym, int ndim>
 class AthenaScratchTensor<T, sym, ndim, 4> {
  public:
-  KOKKOS_INLINE_FUNCTION
-  AthenaScratchTensor();
-  // the default destructor/copy operators are sufficient
+  // the default constructor/destructor/copy operators are sufficient
+  AthenaScratchTensor() = default;
   ~AthenaScratchTensor() = default;
   AthenaScratchTensor(AthenaScratchTensor<T, sym, ndim, 4> const &) = default;
   AthenaScratchTensor<T, sym, ndim, 4> & operator=
   (AthenaScratchTensor<T, sym, ndim, 4> const &) = default;
+  // component index computed at compile time from the symmetry (template parameter)
   KOKKOS_INLINE_FUNCTION
   int idxmap(int const a, int const b, int const c, int const d) const {
-    return idxmap_[a][b][c][d];
+    return (sym == TensorSymm::SYM2)?
+             ((a*ndim + b)*((ndim*(ndim+1))/2) + TensorSym2Idx(c, d, ndim)) :
+           (sym == TensorSymm::ISYM2)?
+             ((TensorSym2Idx(a, b, ndim)*ndim + c)*ndim + d) :
+           (sym == TensorSymm::SYM22)?
+             (TensorSym2Idx(a, b, ndim)*((ndim*(ndim+1))/2) + TensorSym2Idx(c, d, ndim)) :
+             (((a*ndim + b)*ndim + c)*ndim + d);
   }
   KOKKOS_INLINE_FUNCTION
   Real operator()(int const a, int const b,
                   int const c, int const d) const {
-    return data_[idxmap_[a][b][c][d]];
+    return data_[idxmap(a,b,c,d)];
   }
   KOKKOS_INLINE_FUNCTION
   Real & operator()(int const a, int const b,
                     int const c, int const d) {
-    return data_[idxmap_[a][b][c][d]];
+    return data_[idxmap(a,b,c,d)];
   }
   KOKKOS_INLINE_FUNCTION
   void ZeroClear() {
@@ -489,58 +401,6 @@ class AthenaScratchTensor<T, sym, ndim, 4> {
 
  private:
   Real data_[81];
-  int idxmap_[3][3][3][3];
-  int ndof_;
 };
 
-//----------------------------------------------------------------------------------------
-// Implementation details
-template<typename T, TensorSymm sym, int ndim>
-KOKKOS_INLINE_FUNCTION
-AthenaScratchTensor<T, sym, ndim, 4>::AthenaScratchTensor() {
-  switch(sym) {
-    case TensorSymm::NONE:
-      ndof_ = 0;
-      for(int a = 0; a < ndim; ++a)
-      for(int b = 0; b < ndim; ++b)
-      for(int c = 0; c < ndim; ++c)
-      for(int d = 0; d < ndim; ++d) {
-        idxmap_[a][b][c][d] = ndof_++;
-      }
-      break;
-    case TensorSymm::SYM2:
-      ndof_ = 0;
-      for(int a = 0; a < ndim; ++a)
-      for(int b = 0; b < ndim; ++b)
-      for(int c = 0; c < ndim; ++c)
-      for(int d = c; d < ndim; ++d) {
-        idxmap_[a][b][c][d] = ndof_++;
-        idxmap_[a][b][d][c] = idxmap_[a][b][c][d];
-      }
-      break;
-    case TensorSymm::ISYM2:
-      ndof_ = 0;
-      for(int a = 0; a < ndim; ++a)
-      for(int b = a; b < ndim; ++b)
-      for(int c = 0; c < ndim; ++c)
-      for(int d = 0; d < ndim; ++d) {
-        idxmap_[a][b][c][d] = ndof_++;
-        idxmap_[b][a][c][d] = idxmap_[a][b][c][d];
-      }
-      break;
-    case TensorSymm::SYM22:
-      ndof_ = 0;
-      for(int a = 0; a < ndim; ++a)
-      for(int b = a; b < ndim; ++b)
-      for(int c = 0; c < ndim; ++c)
-      for(int d = c; d < ndim; ++d) {
-        idxmap_[a][b][c][d] = ndof_++;
-        idxmap_[b][a][c][d] = idxmap_[a][b][c][d];
-        idxmap_[a][b][d][c] = idxmap_[a][b][c][d];
-        idxmap_[b][a][d][c] = idxmap_[a][b][c][d];
-      }
-      break;
-  }
-}
-
 #endif // ATHENA_TENSOR_HPP_
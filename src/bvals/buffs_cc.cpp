@@ -6,6 +6,7 @@
 //! \file buffs_cc.cpp
 //  \brief functions to allocate and initialize buffers for cell-centered variables
 
+#include <algorithm>
 #include <cstdlib>
 #include <iostream>
 
@@ -28,7 +29,9 @@
 void MeshBoundaryValuesCC::InitSendIndices(MeshBoundaryBuffer &buf,
                                           int ox1, int ox2, int ox3, int f1, int f2) {
   auto &mb_indcs  = pmy_pack->pmesh->mb_indcs;
-  int ng  = mb_indcs.ng;
+  // all index ranges use the exchange depth of the owning module (<= nghost), so
+  // modules with shallow stencils pack and send only the ghost layers they read
+  int ng  = ng_exch_;
   int ng1 = ng - 1;
 
   // set indices for sends to neighbors on SAME level
@@ -164,7 +167,9 @@ void MeshBoundaryValuesCC::InitSendIndices(MeshBoundaryBuffer &buf,
 void MeshBoundaryValuesCC::InitRecvIndices(MeshBoundaryBuffer &buf,
                                            int ox1, int ox2, int ox3, int f1, int f2) {
   auto &mb_indcs  = pmy_pack->pmesh->mb_indcs;
-  int ng = mb_indcs.ng;
+  // ghost zones are filled only to the exchange depth of the owning module (<= nghost);
+  // the extents below must mirror those in InitSendIndices on the sending side
+  int ng = ng_exch_;
 
   // set indices for receives from neighbors on SAME level
   // Formulae taken from SetBoundarySameLevel() in src/bvals/cc/bvals_cc.cpp
@@ -360,7 +365,7 @@ void MeshBoundaryValuesCC::InitRecvIndices(MeshBoundaryBuffer &buf,
   // Formulae taken from ProlongateBoundaries() in src/bvals/bvals_refine.cpp
   // Identical to receives from coarser level, except ng --> ng/2
   {auto &iprol = buf.iprol[0];   // indices for prolongation
-  int cn = mb_indcs.ng/2;      // nghost must be multiple of 2 with SMR/AMR
+  int cn = ng_exch_/2;         // exchange depth must be multiple of 2 with SMR/AMR
   if (ox1 == 0) {
     iprol.bis = mb_indcs.cis;          iprol.bie = mb_indcs.cie;
     if (f1 == 0) {
@@ -482,3 +487,143 @@ void MeshBoundaryValuesCC::InitRecvIndices(MeshBoundaryBuffer &buf,
                    (iflux.bke - iflux.bks + 1);
   }
 }
+
+//----------------------------------------------------------------------------------------
+//! \fn void MeshBoundaryValuesCC::InitTransferRegions
+//! \brief Builds compact tables describing every boundary-buffer transfer performed by
+//! the CC pack/unpack kernels: the cell range, the destination MeshBlock/buffer, the
+//! data offset within the buffer, and the transfer kind.  Every per-neighbor decision
+//! (existence, rank, relative level, the extra same-level coarse-data transfer for Z4c)
+//! is resolved here on the host, so the kernels launch over exactly the transfers
+//! present in the pack and perform table-driven block copies.  Called on first use and
+//! again whenever neighbor connectivity changes (flagged through xfer_stale).
+
+void MeshBoundaryValuesCC::InitTransferRegions() {
+  int nmb = pmy_pack->nmb_thispack;
+  int nnghbr = pmy_pack->pmb->nnghbr;
+  auto &nghbr = pmy_pack->pmb->nghbr;
+  auto &mbgid = pmy_pack->pmb->mb_gid;
+  auto &mblev = pmy_pack->pmb->mb_lev;
+  bool multilevel = pmy_pack->pmesh->multilevel;
+  int my_rank = global_variable::my_rank;
+
+  // count transfers where neighbor exists, then size tables.  Same-level neighbors of
+  // the Z4c module contribute a second (coarse-data) transfer in each direction.
+  nxfer_send = 0;
+  nxfer_recv = 0;
+  for (int m=0; m<nmb; ++m) {
+    for (int n=0; n<nnghbr; ++n) {
+      if (nghbr.h_view(m,n).gid < 0) {continue;}
+      bool same_rank = (nghbr.h_view(m,n).rank == my_rank);
+      bool same_lev = (nghbr.h_view(m,n).lev == mblev.h_view(m));
+      bool z4c_coar = (same_lev && is_z4c_ && multilevel);
+      nxfer_send += (z4c_coar)? 2 : 1;
+      // same-rank same-level data are written directly into the neighbor's arrays at
+      // pack time, so such neighbors contribute no unpack transfers
+      if (!(same_rank && same_lev)) {
+        nxfer_recv += (z4c_coar)? 2 : 1;
+      }
+    }
+  }
+  Kokkos::realloc(xfer_send, std::max(nxfer_send,1));
+  Kokkos::realloc(xfer_recv, std::max(nxfer_recv,1));
+
+  int ps = 0, pr = 0;
+  for (int m=0; m<nmb; ++m) {
+    for (int n=0; n<nnghbr; ++n) {
+      if (nghbr.h_view(m,n).gid < 0) {continue;}
+      bool same_rank = (nghbr.h_view(m,n).rank == my_rank);
+      bool same_lev = (nghbr.h_view(m,n).lev == mblev.h_view(m));
+      bool coar_lev = (nghbr.h_view(m,n).lev < mblev.h_view(m));
+      bool z4c_coar = (same_lev && is_z4c_ && multilevel);
+      // index of destination MeshBlock within this pack, and of its recv buffer
+      int dm = nghbr.h_view(m,n).gid - mbgid.h_view(0);
+      int dn = nghbr.h_view(m,n).dest;
+
+      // send-side transfer: select index range by relative level of neighbor
+      {TransferRegion &t = xfer_send.h_view(ps);
+      MeshBufferIndcs &ids = (coar_lev)? sendbuf[n].icoar[0] :
+                             ((same_lev)? sendbuf[n].isame[0] : sendbuf[n].ifine[0]);
+      t.m = m;     t.n = n;
+      t.il = ids.bis;  t.iu = ids.bie;
+      t.jl = ids.bjs;  t.ju = ids.bje;
+      t.kl = ids.bks;  t.ku = ids.bke;
+      t.dm = dm;   t.dn = dn;
+      t.dil = 0;   t.djl = 0;  t.dkl = 0;
+      t.offset = 0;
+      if (same_rank && same_lev) {
+        // write straight into neighbor's ghost zones; send and recv index ranges have
+        // identical extents, so offsets map one-to-one
+        t.mode = xfer_direct;
+        t.dil = recvbuf[dn].isame[0].bis;
+        t.djl = recvbuf[dn].isame[0].bjs;
+        t.dkl = recvbuf[dn].isame[0].bks;
+      } else if (same_rank) {
+        t.mode = (coar_lev)? xfer_stage_coar : xfer_stage;
+      } else {
+        t.mode = (coar_lev)? xfer_send_coar : xfer_send;
+      }
+      ps++;}
+
+      // extra send-side transfer of coarse data between same-level Z4c neighbors
+      if (z4c_coar) {
+        TransferRegion &t = xfer_send.h_view(ps);
+        MeshBufferIndcs &ids = sendbuf[n].isame_z4c;
+        t.m = m;     t.n = n;
+        t.il = ids.bis;  t.iu = ids.bie;
+        t.jl = ids.bjs;  t.ju = ids.bje;
+        t.kl = ids.bks;  t.ku = ids.bke;
+        t.dm = dm;   t.dn = dn;
+        t.dil = 0;   t.djl = 0;  t.dkl = 0;
+        // coarse data are appended after the same-level data already in the buffer
+        t.offset = nvar_*sendbuf[n].isame_ndat;
+        if (same_rank) {
+          t.mode = xfer_direct_coar;
+          t.dil = recvbuf[dn].isame_z4c.bis;
+          t.djl = recvbuf[dn].isame_z4c.bjs;
+          t.dkl = recvbuf[dn].isame_z4c.bks;
+        } else {
+          t.mode = xfer_send_coar;
+        }
+        ps++;
+      }
+
+      // recv-side transfers (skipped entirely for same-rank same-level neighbors)
+      if (!(same_rank && same_lev)) {
+        {TransferRegion &t = xfer_recv.h_view(pr);
+        MeshBufferIndcs &idr = (coar_lev)? recvbuf[n].icoar[0] :
+                               ((same_lev)? recvbuf[n].isame[0] : recvbuf[n].ifine[0]);
+        t.m = m;     t.n = n;
+        t.il = idr.bis;  t.iu = idr.bie;
+        t.jl = idr.bjs;  t.ju = idr.bje;
+        t.kl = idr.bks;  t.ku = idr.bke;
+        t.dm = 0;    t.dn = 0;
+        t.dil = 0;   t.djl = 0;  t.dkl = 0;
+        t.offset = 0;
+        t.mode = (coar_lev)? xfer_unpack_coar : xfer_unpack;
+        pr++;}
+
+        // extra recv-side transfer of coarse data between same-level Z4c neighbors
+        if (z4c_coar) {
+          TransferRegion &t = xfer_recv.h_view(pr);
+          MeshBufferIndcs &idr = recvbuf[n].isame_z4c;
+          t.m = m;     t.n = n;
+          t.il = idr.bis;  t.iu = idr.bie;
+          t.jl = idr.bjs;  t.ju = idr.bje;
+          t.kl = idr.bks;  t.ku = idr.bke;
+          t.dm = 0;    t.dn = 0;
+          t.dil = 0;   t.djl = 0;  t.dkl = 0;
+          t.offset = nvar_*recvbuf[n].isame_ndat;
+          t.mode = xfer_unpack_coar;
+          pr++;
+        }
+      }
+    }
+  }
+  xfer_send.template modify<HostMemSpace>();
+  xfer_send.template sync<DevExeSpace>();
+  xfer_recv.template modify<HostMemSpace>();
+  xfer_recv.template sync<DevExeSpace>();
+  xfer_stale = false;
+  return;
+}
@@ -936,3 +936,87 @@ void MeshBoundaryValuesFC::InitRecvIndices(MeshBoundaryBuffer &buf,
   }
   }
 }
+
+//----------------------------------------------------------------------------------------
+//! \fn void MeshBoundaryValuesFC::InitTransferRegions
+//! \brief Builds tables describing every boundary-buffer transfer performed by the FC
+//! pack/unpack kernels: the cell range for each of the three field components, the
+//! destination MeshBlock/buffer, the data offset within the buffer, and the transfer
+//! kind.  Unlike the compact CC tables, FC tables are indexed by (MeshBlock, buffer,
+//! component) with empty (xfer_none) entries where no neighbor exists, because the
+//! kernels must traverse buffers of each MeshBlock in a fixed serial order to avoid
+//! race conditions in overlapping face assignments.  Called on first use and again
+//! whenever neighbor connectivity changes (flagged through xfer_stale).
+
+void MeshBoundaryValuesFC::InitTransferRegions() {
+  int nmb = pmy_pack->nmb_thispack;
+  int nnghbr = pmy_pack->pmb->nnghbr;
+  auto &nghbr = pmy_pack->pmb->nghbr;
+  auto &mbgid = pmy_pack->pmb->mb_gid;
+  auto &mblev = pmy_pack->pmb->mb_lev;
+  int my_rank = global_variable::my_rank;
+
+  nxfer_send = nmb*nnghbr*3;
+  nxfer_recv = nmb*nnghbr*3;
+  Kokkos::realloc(xfer_send, std::max(nxfer_send,1));
+  Kokkos::realloc(xfer_recv, std::max(nxfer_recv,1));
+
+  for (int m=0; m<nmb; ++m) {
+    for (int n=0; n<nnghbr; ++n) {
+      for (int v=0; v<3; ++v) {
+        TransferRegion &ts = xfer_send.h_view((m*nnghbr + n)*3 + v);
+        TransferRegion &tr = xfer_recv.h_view((m*nnghbr + n)*3 + v);
+        ts.m = m;  ts.n = n;
+        tr.m = m;  tr.n = n;
+        if (nghbr.h_view(m,n).gid < 0) {
+          ts.mode = xfer_none;
+          tr.mode = xfer_none;
+          continue;
+        }
+        bool same_rank = (nghbr.h_view(m,n).rank == my_rank);
+        bool same_lev = (nghbr.h_view(m,n).lev == mblev.h_view(m));
+        bool coar_lev = (nghbr.h_view(m,n).lev < mblev.h_view(m));
+
+        // send-side transfer: select index range by relative level of neighbor.  Note
+        // ranges can be different for each component of face-centered fields, and the
+        // three components are stored at fixed per-component offsets within buffers.
+        MeshBufferIndcs &ids = (coar_lev)? sendbuf[n].icoar[v] :
+                               ((same_lev)? sendbuf[n].isame[v] : sendbuf[n].ifine[v]);
+        int sdat = (coar_lev)? sendbuf[n].icoar_ndat :
+                   ((same_lev)? sendbuf[n].isame_ndat : sendbuf[n].ifine_ndat);
+        ts.il = ids.bis;  ts.iu = ids.bie;
+        ts.jl = ids.bjs;  ts.ju = ids.bje;
+        ts.kl = ids.bks;  ts.ku = ids.bke;
+        // indices of destination MeshBlock within this pack, and of its recv buffer
+        ts.dm = nghbr.h_view(m,n).gid - mbgid.h_view(0);
+        ts.dn = nghbr.h_view(m,n).dest;
+        ts.dil = 0;  ts.djl = 0;  ts.dkl = 0;
+        ts.offset = sdat*v;
+        if (same_rank) {
+          ts.mode = (coar_lev)? xfer_stage_coar : xfer_stage;
+        } else {
+          ts.mode = (coar_lev)? xfer_send_coar : xfer_send;
+        }
+
+        // recv-side transfer
+        MeshBufferIndcs &idr = (coar_lev)? recvbuf[n].icoar[v] :
+                               ((same_lev)? recvbuf[n].isame[v] : recvbuf[n].ifine[v]);
+        int rdat = (coar_lev)? recvbuf[n].icoar_ndat :
+                   ((same_lev)? recvbuf[n].isame_ndat : recvbuf[n].ifine_ndat);
+        tr.il = idr.bis;  tr.iu = idr.bie;
+        tr.jl = idr.bjs;  tr.ju = idr.bje;
+        tr.kl = idr.bks;  tr.ku = idr.bke;
+        tr.dm = 0;  tr.dn = 0;
+        tr.dil = 0;  tr.djl = 0;  tr.dkl = 0;
+        tr.offset = rdat*v;
+        tr.mode = (coar_lev)? xfer_unpack_coar : xfer_unpack;
+      }
+    }
+  }
+  xfer_send.template modify<HostMemSpace>();
+  xfer_send.template sync<DevExeSpace>();
+  xfer_recv.template modify<HostMemSpace>();
+  xfer_recv.template sync<DevExeSpace>();
+  xfer_stale = false;
+  return;
+}
@@ -10,7 +10,8 @@
 #include <cstdlib>
 #include <iostream>
 #include <utility>
-#include <algorithm> // max
+#include <vector>
+#include <algorithm> // max, sort
 
 #include "athena.hpp"
 #include "globals.hpp"
@@ -28,7 +29,41 @@ MeshBoundaryValues::MeshBoundaryValues(MeshBlockPack *pp, ParameterInput *pin, b
   is_z4c_(z4c),
   u_in("uin",1,1),
   b_in("bin",1,1),
-  i_in("iin",1,1) {
+  i_in("iin",1,1),
+  prol_stale(true),
+  nprol(0),
+  prol_ifc("prol_ifc",1),
+  xfer_stale(true),
+  nxfer_send(0),
+  nxfer_recv(0),
+  xfer_send("xfer_send",1),
+  xfer_recv("xfer_recv",1),
+#if MPI_PARALLEL_ENABLED
+  coalesced_comm(false),
+  single_prec_vars(false),
+  transform_vars(false),
+  comm_stale(true),
+  ncoal_send(0),
+  ncoal_recv(0),
+  coal_send_buf("coal_sbuf",1),
+  coal_recv_buf("coal_rbuf",1),
+  coal_send_data("coal_sdata",1),
+  coal_recv_data("coal_rdata",1),
+#if !(MPI_GPU_AWARE_ENABLED)
+  coal_send_data_h("coal_sdata_h",1),
+  coal_recv_data_h("coal_rdata_h",1),
+#endif
+  nbrhd_flux_comm(false),
+  flux_comm_stale(true),
+  flux_nbrhd_started(false),
+  comm_flux_nbrhd(MPI_COMM_NULL),
+  flux_nbrhd_req(MPI_REQUEST_NULL),
+  flx_send_buf("flx_sbuf",1),
+  flx_recv_buf("flx_rbuf",1),
+  flx_send_data("flx_sdata",1),
+  flx_recv_data("flx_rdata",1),
+#endif
+  nvar_(0) {
   // allocate vector of status flags and MPI requests (if needed)
   int nnghbr = pmy_pack->pmb->nnghbr;
 
@@ -69,6 +104,48 @@ MeshBoundaryValues::MeshBoundaryValues(MeshBlockPack *pp, ParameterInput *pin, b
   // create unique communicators for variables and fluxes in this BoundaryValues object
   MPI_Comm_dup(MPI_COMM_WORLD, &comm_vars);
   MPI_Comm_dup(MPI_COMM_WORLD, &comm_flux);
+
+  // optionally concatenate all variable buffers exchanged with the same remote rank into
+  // a single message per rank, reducing the number of MPI messages per stage
+  coalesced_comm = pin->GetOrAddBoolean("mesh", "coalesced_bvals", false);
+
+  // optionally exchange all flux corrections at once with a neighborhood collective
+  // over a graph communicator built from the neighbor connectivity
+  nbrhd_flux_comm = pin->GetOrAddBoolean("mesh", "nbrhood_flux_bvals", false);
+
+  // optionally carry variable messages in single precision on the wire while evolved
+  // data and pack/unpack buffers remain at Real precision, halving message volume.
+  // Disabled for Z4c, whose higher-order prolongation is more sensitive to ghost data,
+  // and pointless when the code is already compiled in single precision.
+  single_prec_vars = pin->GetOrAddBoolean("mesh", "single_prec_bvals", false);
+  if (is_z4c_) {single_prec_vars = false;}
+#if SINGLE_PRECISION_ENABLED
+  single_prec_vars = false;
+#endif
+  if (single_prec_vars && coalesced_comm) {
+    std::cout << "### FATAL ERROR in " << __FILE__ << " at line " << __LINE__
+       << std::endl << "single_prec_bvals cannot be used with coalesced_bvals"
+       << std::endl;
+    std::exit(EXIT_FAILURE);
+  }
+
+  // optionally transform-code Z4c variable messages: each variable's slab is carried as
+  // its mean (split into a hi/lo float pair, preserving Real precision) plus float
+  // residuals about that mean.  Halves message volume like single_prec_bvals, but since
+  // Z4c fields are smooth with values of order unity (e.g. lapse ~ 1), the residuals
+  // are small and the roundoff incurred is far below both raw-float transport and the
+  // FD truncation error, so this mode is safe with the higher-order prolongation
+  transform_vars = pin->GetOrAddBoolean("mesh", "transform_bvals", false);
+  if (!is_z4c_) {transform_vars = false;}
+#if SINGLE_PRECISION_ENABLED
+  transform_vars = false;
+#endif
+  if (transform_vars && coalesced_comm) {
+    std::cout << "### FATAL ERROR in " << __FILE__ << " at line " << __LINE__
+       << std::endl << "transform_bvals cannot be used with coalesced_bvals"
+       << std::endl;
+    std::exit(EXIT_FAILURE);
+  }
 #endif
 }
 
@@ -78,13 +155,129 @@ MeshBoundaryValues::MeshBoundaryValues(MeshBlockPack *pp, ParameterInput *pin, b
 MeshBoundaryValues::~MeshBoundaryValues() {
 #if MPI_PARALLEL_ENABLED
   int nnghbr = pmy_pack->pmb->nnghbr;
+  int nmb = std::max((pmy_pack->nmb_thispack), (pmy_pack->pmesh->nmb_maxperrank));
   for (int n=0; n<nnghbr; ++n) {
+    // free any persistent requests for variable communications
+    for (int m=0; m<nmb; ++m) {
+      if (sendbuf[n].vars_req[m] != MPI_REQUEST_NULL) {
+        MPI_Request_free(&(sendbuf[n].vars_req[m]));
+      }
+      if (recvbuf[n].vars_req[m] != MPI_REQUEST_NULL) {
+        MPI_Request_free(&(recvbuf[n].vars_req[m]));
+      }
+    }
     delete [] sendbuf[n].vars_req;
     delete [] sendbuf[n].flux_req;
     delete [] recvbuf[n].vars_req;
     delete [] recvbuf[n].flux_req;
   }
+  for (auto &req : coal_send_req) {
+    if (req != MPI_REQUEST_NULL) {MPI_Request_free(&req);}
+  }
+  for (auto &req : coal_recv_req) {
+    if (req != MPI_REQUEST_NULL) {MPI_Request_free(&req);}
+  }
+  if (comm_flux_nbrhd != MPI_COMM_NULL) {MPI_Comm_free(&comm_flux_nbrhd);}
+#endif
+}
+
+#if MPI_PARALLEL_ENABLED
+// storage for the per-rank MPI progress engine, shared by all MeshBoundaryValues
+// objects (see declaration in bvals.hpp)
+std::vector<MPI_Request> MeshBoundaryValues::eng_req;
+std::vector<MeshBoundaryValues*> MeshBoundaryValues::eng_owner;
+std::vector<int> MeshBoundaryValues::eng_m;
+std::vector<int> MeshBoundaryValues::eng_n;
+std::vector<int> MeshBoundaryValues::eng_idx;
+
+//----------------------------------------------------------------------------------------
+//! \fn void MeshBoundaryValues::EnlistRecv()
+//! \brief Adds one started variable receive to the per-rank progress engine.  Called by
+//! InitRecv for every remote receive it starts; the entry is removed by DriveProgress
+//! when the message arrives.
+
+void MeshBoundaryValues::EnlistRecv(MeshBoundaryValues *pbv, int m, int n,
+                                    const MPI_Request &req) {
+  eng_req.push_back(req);
+  eng_owner.push_back(pbv);
+  eng_m.push_back(m);
+  eng_n.push_back(n);
+  return;
+}
+
+//----------------------------------------------------------------------------------------
+//! \fn void MeshBoundaryValues::DriveProgress()
+//! \brief Drives every outstanding variable receive on this rank with one MPI_Testsome
+//! sweep, regardless of which physics module posted it.  For each completed receive the
+//! owning object's arrival flag is flipped (read by TestAndStageRecvs) and the entry is
+//! removed from the engine.  MPI_Testsome only copies request handles, so the
+//! persistent requests held by each object remain valid for the next exchange.
+
+void MeshBoundaryValues::DriveProgress() {
+  int nreq = static_cast<int>(eng_req.size());
+  if (nreq == 0) {return;}
+  eng_idx.resize(nreq);
+  int outcount;
+  int ierr = MPI_Testsome(nreq, eng_req.data(), &outcount, eng_idx.data(),
+                          MPI_STATUSES_IGNORE);
+  if (ierr != MPI_SUCCESS) {
+    std::cout << "### FATAL ERROR in " << __FILE__ << " at line " << __LINE__
+              << std::endl << "MPI error in testing non-blocking receives"
+              << std::endl;
+    std::exit(EXIT_FAILURE);
+  }
+  if (outcount == MPI_UNDEFINED || outcount == 0) {return;}
+
+  // flip arrival flags of completed receives and mark their entries for removal
+  for (int c=0; c<outcount; ++c) {
+    int e = eng_idx[c];
+    eng_owner[e]->vars_recvd(eng_m[e], eng_n[e]) = 1;
+    eng_owner[e] = nullptr;
+  }
+
+  // compact the engine, dropping completed entries
+  int dst = 0;
+  for (int e=0; e<nreq; ++e) {
+    if (eng_owner[e] != nullptr) {
+      eng_req[dst] = eng_req[e];
+      eng_owner[dst] = eng_owner[e];
+      eng_m[dst] = eng_m[e];
+      eng_n[dst] = eng_n[e];
+      ++dst;
+    }
+  }
+  eng_req.resize(dst);
+  eng_owner.resize(dst);
+  eng_m.resize(dst);
+  eng_n.resize(dst);
+  return;
+}
 #endif
+
+//----------------------------------------------------------------------------------------
+//! \fn bool MeshBoundaryValues::AnyPhysicalBCs()
+//! \brief Returns true if any MeshBlock in the pack applies a built-in physical
+//! boundary condition (reflect/inflow/outflow/diode/vacuum) on either of the two given
+//! faces.  Faces interior to the domain (BoundaryFlag::block) and periodic boundaries
+//! are filled by the regular boundary communication, and user BCs are dispatched
+//! separately, so when this returns false the per-direction physical BC kernel for
+//! these faces would be an empty launch and can be skipped.
+
+bool MeshBoundaryValues::AnyPhysicalBCs(MeshBlockPack *pp, BoundaryFace f1,
+                                        BoundaryFace f2) {
+  auto &mb_bcs = pp->pmb->mb_bcs;
+  int nmb = pp->nmb_thispack;
+  for (int m=0; m<nmb; ++m) {
+    for (int f=0; f<2; ++f) {
+      BoundaryFlag bf = mb_bcs.h_view(m, (f==0)? f1 : f2);
+      if (bf == BoundaryFlag::reflect || bf == BoundaryFlag::inflow ||
+          bf == BoundaryFlag::outflow || bf == BoundaryFlag::diode ||
+          bf == BoundaryFlag::vacuum) {
+        return true;
+      }
+    }
+  }
+  return false;
 }
 
 //----------------------------------------------------------------------------------------
@@ -97,6 +290,8 @@ MeshBoundaryValues::~MeshBoundaryValues() {
 //! virtual functions that only get instantiated when the derived classes are constructed
 
 void MeshBoundaryValues::InitializeBuffers(const int nvar) {
+  // save number of variables so coalescing tables can be rebuilt after remeshing
+  nvar_ = nvar;
   // allocate memory for inflow BCs (but only if domain not strictly periodic)
   if (!(pmy_pack->pmesh->strictly_periodic)) {
     Kokkos::realloc(u_in, nvar, 6);
@@ -221,6 +416,477 @@ void MeshBoundaryValues::InitializeBuffers(const int nvar) {
   return;
 }
 
+//----------------------------------------------------------------------------------------
+//! \fn void MeshBoundaryValues::InitProlongationInterfaces
+//! \brief Builds cached list of (MeshBlock, buffer) pairs at fine/coarse boundaries
+//! requiring prolongation, with precomputed loop bounds over both the stencil-extended
+//! coarse buffer cells and the corresponding fine cells.  Called on first use and again
+//! whenever neighbor connectivity changes (e.g. after any AMR remeshing), which is
+//! flagged through prol_stale.
+
+void MeshBoundaryValues::InitProlongationInterfaces() {
+  int nmb = pmy_pack->nmb_thispack;
+  int nnghbr = pmy_pack->pmb->nnghbr;
+  auto &nghbr = pmy_pack->pmb->nghbr;
+  auto &mblev = pmy_pack->pmb->mb_lev;
+  auto &indcs = pmy_pack->pmesh->mb_indcs;
+  const bool multi_d = pmy_pack->pmesh->multi_d;
+  const bool three_d = pmy_pack->pmesh->three_d;
+
+  // count interfaces where neighbor exists and is at coarser level, then size table
+  nprol = 0;
+  for (int m=0; m<nmb; ++m) {
+    for (int n=0; n<nnghbr; ++n) {
+      if ((nghbr.h_view(m,n).gid >= 0) && (nghbr.h_view(m,n).lev < mblev.h_view(m))) {
+        nprol++;
+      }
+    }
+  }
+  Kokkos::realloc(prol_ifc, std::max(nprol,1));
+
+  int p = 0;
+  for (int m=0; m<nmb; ++m) {
+    for (int n=0; n<nnghbr; ++n) {
+      if ((nghbr.h_view(m,n).gid >= 0) && (nghbr.h_view(m,n).lev < mblev.h_view(m))) {
+        ProlongationInterface &ifc = prol_ifc.h_view(p);
+        ifc.m = m;
+        ifc.n = n;
+        // coarse-cell bounds, extended by one cell to match stencil of 2nd-order
+        // prolongation
+        MeshBufferIndcs &ip = recvbuf[n].iprol[0];
+        ifc.cil = ip.bis - 1;
+        ifc.ciu = ip.bie + 1;
+        ifc.cjl = ip.bjs;
+        ifc.cju = ip.bje;
+        if (multi_d) {
+          ifc.cjl -= 1;
+          ifc.cju += 1;
+        }
+        ifc.ckl = ip.bks;
+        ifc.cku = ip.bke;
+        if (three_d) {
+          ifc.ckl -= 1;
+          ifc.cku += 1;
+        }
+        // corresponding bounds converted from coarse to fine arrays
+        ifc.fil = (ip.bis - indcs.cis)*2 + indcs.is;
+        ifc.fiu = (ip.bie - indcs.cis)*2 + indcs.is + 1;
+        ifc.fjl = (ip.bjs - indcs.cjs)*2 + indcs.js;
+        ifc.fju = (ip.bje - indcs.cjs)*2 + indcs.js;
+        if (multi_d) {
+          ifc.fju += 1;
+        }
+        ifc.fkl = (ip.bks - indcs.cks)*2 + indcs.ks;
+        ifc.fku = (ip.bke - indcs.cks)*2 + indcs.ks;
+        if (three_d) {
+          ifc.fku += 1;
+        }
+        p++;
+      }
+    }
+  }
+  prol_ifc.template modify<HostMemSpace>();
+  prol_ifc.template sync<DevExeSpace>();
+  prol_stale = false;
+  return;
+}
+
+//----------------------------------------------------------------------------------------
+//! \fn void MeshBoundaryValues::InitCoalescedIndices
+//! \brief Builds tables describing location of every boundary buffer exchanged with
+//! another rank within the single aggregated message sent/received per rank.  Send-side
+//! buffers are ordered by (local ID, buffer index) of the *receiving* MeshBlock (same
+//! convention as MPI tags), which is exactly the order in which the receiving rank
+//! assembles its own recv table, so both ranks agree on offsets without any extra
+//! communication.  Must be called again whenever neighbor connectivity changes (e.g.
+//! after any AMR remeshing), which is flagged through comm_stale.
+
+#if MPI_PARALLEL_ENABLED
+void MeshBoundaryValues::InitCoalescedIndices() {
+  int nmb = pmy_pack->nmb_thispack;
+  int nnghbr = pmy_pack->pmb->nnghbr;
+  auto &nghbr = pmy_pack->pmb->nghbr;
+  auto &mblev = pmy_pack->pmb->mb_lev;
+
+  // make list of all buffers communicated with other ranks, with sort keys and sizes
+  struct BufferKey {int rank; int key; int m; int n; int cnt;};
+  std::vector<BufferKey> slist, rlist;
+  for (int m=0; m<nmb; ++m) {
+    for (int n=0; n<nnghbr; ++n) {
+      if (nghbr.h_view(m,n).gid >= 0) {
+        int drank = nghbr.h_view(m,n).rank;
+        if (drank == global_variable::my_rank) continue;
+        // size of send/recv messages for this buffer (same logic as per-buffer sends)
+        int scnt = nvar_, rcnt = nvar_;
+        if (nghbr.h_view(m,n).lev < mblev.h_view(m)) {
+          scnt *= sendbuf[n].icoar_ndat;
+          rcnt *= recvbuf[n].icoar_ndat;
+        } else if (nghbr.h_view(m,n).lev == mblev.h_view(m)) {
+          scnt *= (is_z4c_)? sendbuf[n].isame_z4c_ndat : sendbuf[n].isame_ndat;
+          rcnt *= (is_z4c_)? recvbuf[n].isame_z4c_ndat : recvbuf[n].isame_ndat;
+        } else {
+          scnt *= sendbuf[n].ifine_ndat;
+          rcnt *= recvbuf[n].ifine_ndat;
+        }
+        // sends keyed by (lid, bufid) of receiving MeshBlock on destination rank
+        int lid = nghbr.h_view(m,n).gid - pmy_pack->pmesh->gids_eachrank[drank];
+        int dn = nghbr.h_view(m,n).dest;
+        slist.push_back({drank, (lid*nnghbr + dn), m, n, scnt});
+        // recvs keyed by (lid, bufid) of receiving MeshBlock on this rank
+        rlist.push_back({drank, (m*nnghbr + n), m, n, rcnt});
+      }
+    }
+  }
+  auto SortByRankKey = [](const BufferKey &a, const BufferKey &b) {
+    return (a.rank == b.rank)? (a.key < b.key) : (a.rank < b.rank);
+  };
+  std::sort(slist.begin(), slist.end(), SortByRankKey);
+  std::sort(rlist.begin(), rlist.end(), SortByRankKey);
+
+  // assign offsets in message arenas, and record start/size of each rank's message
+  coal_send_rank.clear(); coal_send_offset.clear(); coal_send_size.clear();
+  coal_recv_rank.clear(); coal_recv_offset.clear(); coal_recv_size.clear();
+  int nsbuf = static_cast<int>(slist.size());
+  int nrbuf = static_cast<int>(rlist.size());
+  Kokkos::realloc(coal_send_buf, nsbuf);
+  Kokkos::realloc(coal_recv_buf, nrbuf);
+  int offset = 0;
+  for (int b=0; b<nsbuf; ++b) {
+    if ((b == 0) || (slist[b].rank != slist[b-1].rank)) {
+      coal_send_rank.push_back(slist[b].rank);
+      coal_send_offset.push_back(offset);
+      coal_send_size.push_back(0);
+    }
+    coal_send_buf.h_view(b).m = slist[b].m;
+    coal_send_buf.h_view(b).n = slist[b].n;
+    coal_send_buf.h_view(b).cnt = slist[b].cnt;
+    coal_send_buf.h_view(b).offset = offset;
+    coal_send_size.back() += slist[b].cnt;
+    offset += slist[b].cnt;
+  }
+  ncoal_send = static_cast<int>(coal_send_rank.size());
+  Kokkos::realloc(coal_send_data, offset);
+#if !(MPI_GPU_AWARE_ENABLED)
+  Kokkos::realloc(coal_send_data_h, offset);
+#endif
+
+  offset = 0;
+  for (int b=0; b<nrbuf; ++b) {
+    if ((b == 0) || (rlist[b].rank != rlist[b-1].rank)) {
+      coal_recv_rank.push_back(rlist[b].rank);
+      coal_recv_offset.push_back(offset);
+      coal_recv_size.push_back(0);
+    }
+    coal_recv_buf.h_view(b).m = rlist[b].m;
+    coal_recv_buf.h_view(b).n = rlist[b].n;
+    coal_recv_buf.h_view(b).cnt = rlist[b].cnt;
+    coal_recv_buf.h_view(b).offset = offset;
+    coal_recv_size.back() += rlist[b].cnt;
+    offset += rlist[b].cnt;
+  }
+  ncoal_recv = static_cast<int>(coal_recv_rank.size());
+  Kokkos::realloc(coal_recv_data, offset);
+#if !(MPI_GPU_AWARE_ENABLED)
+  Kokkos::realloc(coal_recv_data_h, offset);
+#endif
+
+  // create persistent requests for the aggregated message exchanged with each rank;
+  // these are simply (re)started each stage, and must be freed when remeshing changes
+  // the communication pattern
+  bool no_errors=true;
+  for (auto &req : coal_send_req) {
+    if (req != MPI_REQUEST_NULL) {MPI_Request_free(&req);}
+  }
+  for (auto &req : coal_recv_req) {
+    if (req != MPI_REQUEST_NULL) {MPI_Request_free(&req);}
+  }
+  coal_send_req.assign(ncoal_send, MPI_REQUEST_NULL);
+  coal_recv_req.assign(ncoal_recv, MPI_REQUEST_NULL);
+  // with GPU-aware MPI, messages are sent/received in the device arenas directly;
+  // otherwise they are staged through host mirrors of the arenas
+#if MPI_GPU_AWARE_ENABLED
+  Real* send_arena = coal_send_data.data();
+  Real* recv_arena = coal_recv_data.data();
+#else
+  Real* send_arena = coal_send_data_h.data();
+  Real* recv_arena = coal_recv_data_h.data();
+#endif
+  for (int r=0; r<ncoal_send; ++r) {
+    // only one aggregated exchange is in flight at a time on comm_vars (unique to this
+    // BoundaryValues object), so a fixed tag suffices
+    int ierr = MPI_Send_init((send_arena + coal_send_offset[r]),
+                             coal_send_size[r], MPI_ATHENA_REAL, coal_send_rank[r], 0,
+                             comm_vars, &(coal_send_req[r]));
+    if (ierr != MPI_SUCCESS) {no_errors=false;}
+  }
+  for (int r=0; r<ncoal_recv; ++r) {
+    int ierr = MPI_Recv_init((recv_arena + coal_recv_offset[r]),
+                             coal_recv_size[r], MPI_ATHENA_REAL, coal_recv_rank[r], 0,
+                             comm_vars, &(coal_recv_req[r]));
+    if (ierr != MPI_SUCCESS) {no_errors=false;}
+  }
+  // Quit if MPI error detected
+  if (!(no_errors)) {
+    std::cout << "### FATAL ERROR in " << __FILE__ << " at line " << __LINE__
+       << std::endl << "MPI error in creating persistent requests" << std::endl;
+    std::exit(EXIT_FAILURE);
+  }
+
+  // sync layout tables to device for use in gather/scatter kernels
+  coal_send_buf.template modify<HostMemSpace>();
+  coal_send_buf.template sync<DevExeSpace>();
+  coal_recv_buf.template modify<HostMemSpace>();
+  coal_recv_buf.template sync<DevExeSpace>();
+
+  comm_stale = false;
+  return;
+}
+
+//----------------------------------------------------------------------------------------
+//! \fn void MeshBoundaryValues::InitFluxGraphIndices
+//! \brief Builds the distributed graph communicator and message layout tables used to
+//! exchange all flux corrections in a single MPI_Ineighbor_alltoallv.  As with the
+//! coalesced tables above, send-side buffers are ordered by (local ID, buffer index) of
+//! the *receiving* MeshBlock, which is exactly the order in which the receiving rank
+//! assembles its own recv table, so both ranks agree on offsets without any extra
+//! communication.  Which buffers are exchanged (and their sizes) differs between CC and
+//! FC variables, so they are obtained through FluxSendCount()/FluxRecvCount().  Since
+//! creating the graph communicator is collective over comm_flux, every rank must call
+//! this function when connectivity changes (flagged through flux_comm_stale); this is
+//! guaranteed since the flux pack/send task runs on every rank each stage.
+
+void MeshBoundaryValues::InitFluxGraphIndices() {
+  int nmb = pmy_pack->nmb_thispack;
+  int nnghbr = pmy_pack->pmb->nnghbr;
+  auto &nghbr = pmy_pack->pmb->nghbr;
+
+  // make list of all flux buffers exchanged with other ranks, with sort keys and sizes
+  struct BufferKey {int rank; int key; int m; int n; int cnt;};
+  std::vector<BufferKey> slist, rlist;
+  for (int m=0; m<nmb; ++m) {
+    for (int n=0; n<nnghbr; ++n) {
+      if (nghbr.h_view(m,n).gid >= 0) {
+        int drank = nghbr.h_view(m,n).rank;
+        if (drank == global_variable::my_rank) continue;
+        int scnt = FluxSendCount(m,n);
+        if (scnt > 0) {
+          // sends keyed by (lid, bufid) of receiving MeshBlock on destination rank
+          int lid = nghbr.h_view(m,n).gid - pmy_pack->pmesh->gids_eachrank[drank];
+          int dn = nghbr.h_view(m,n).dest;
+          slist.push_back({drank, (lid*nnghbr + dn), m, n, scnt});
+        }
+        int rcnt = FluxRecvCount(m,n);
+        if (rcnt > 0) {
+          // recvs keyed by (lid, bufid) of receiving MeshBlock on this rank
+          rlist.push_back({drank, (m*nnghbr + n), m, n, rcnt});
+        }
+      }
+    }
+  }
+  auto SortByRankKey = [](const BufferKey &a, const BufferKey &b) {
+    return (a.rank == b.rank)? (a.key < b.key) : (a.rank < b.rank);
+  };
+  std::sort(slist.begin(), slist.end(), SortByRankKey);
+  std::sort(rlist.begin(), rlist.end(), SortByRankKey);
+
+  // assign offsets in message arenas, and record count/displacement of each rank's
+  // message in the order required by the graph communicator created below
+  flx_send_rank.clear(); flx_send_count.clear(); flx_send_disp.clear();
+  flx_recv_rank.clear(); flx_recv_count.clear(); flx_recv_disp.clear();
+  int nsbuf = static_cast<int>(slist.size());
+  int nrbuf = static_cast<int>(rlist.size());
+  Kokkos::realloc(flx_send_buf, nsbuf);
+  Kokkos::realloc(flx_recv_buf, nrbuf);
+  int offset = 0;
+  for (int b=0; b<nsbuf; ++b) {
+    if ((b == 0) || (slist[b].rank != slist[b-1].rank)) {
+      flx_send_rank.push_back(slist[b].rank);
+      flx_send_disp.push_back(offset);
+      flx_send_count.push_back(0);
+    }
+    flx_send_buf.h_view(b).m = slist[b].m;
+    flx_send_buf.h_view(b).n = slist[b].n;
+    flx_send_buf.h_view(b).cnt = slist[b].cnt;
+    flx_send_buf.h_view(b).offset = offset;
+    flx_send_count.back() += slist[b].cnt;
+    offset += slist[b].cnt;
+  }
+  Kokkos::realloc(flx_send_data, offset);
+
+  offset = 0;
+  for (int b=0; b<nrbuf; ++b) {
+    if ((b == 0) || (rlist[b].rank != rlist[b-1].rank)) {
+      flx_recv_rank.push_back(rlist[b].rank);
+      flx_recv_disp.push_back(offset);
+      flx_recv_count.push_back(0);
+    }
+    flx_recv_buf.h_view(b).m = rlist[b].m;
+    flx_recv_buf.h_view(b).n = rlist[b].n;
+    flx_recv_buf.h_view(b).cnt = rlist[b].cnt;
+    flx_recv_buf.h_view(b).offset = offset;
+    flx_recv_count.back() += rlist[b].cnt;
+    offset += rlist[b].cnt;
+  }
+  Kokkos::realloc(flx_recv_data, offset);
+
+  // (re)create distributed graph communicator with sources/destinations given by the
+  // ranks received from/sent to.  The edge sets specified by each rank are consistent
+  // by construction since neighbor connectivity is symmetric (a fine-to-coarse send on
+  // one rank is always matched by a coarse-from-fine recv on the other).  Reordering is
+  // disabled so rank numbering in the new communicator matches comm_flux.
+  if (comm_flux_nbrhd != MPI_COMM_NULL) {MPI_Comm_free(&comm_flux_nbrhd);}
+  int nsrc = static_cast<int>(flx_recv_rank.size());
+  int ndst = static_cast<int>(flx_send_rank.size());
+  int ierr = MPI_Dist_graph_create_adjacent(comm_flux, nsrc, flx_recv_rank.data(),
+                MPI_UNWEIGHTED, ndst, flx_send_rank.data(), MPI_UNWEIGHTED,
+                MPI_INFO_NULL, 0, &comm_flux_nbrhd);
+  // Quit if MPI error detected
+  if (ierr != MPI_SUCCESS) {
+    std::cout << "### FATAL ERROR in " << __FILE__ << " at line " << __LINE__
+       << std::endl << "MPI error in creating graph communicator" << std::endl;
+    std::exit(EXIT_FAILURE);
+  }
+
+  // sync layout tables to device for use in gather/scatter kernels
+  flx_send_buf.template modify<HostMemSpace>();
+  flx_send_buf.template sync<DevExeSpace>();
+  flx_recv_buf.template modify<HostMemSpace>();
+  flx_recv_buf.template sync<DevExeSpace>();
+
+  flux_comm_stale = false;
+  return;
+}
+
+//----------------------------------------------------------------------------------------
+//! \fn void MeshBoundaryValues::InitPersistentRequests
+//! \brief Creates persistent MPI requests for per-buffer communication of variables.
+//! The communication pattern (sources, destinations, tags, sizes) only changes when the
+//! mesh is remeshed, so requests are created once per tree topology and merely started
+//! each stage, instead of re-posting MPI_Irecv/MPI_Isend with freshly computed tags.
+//! Called again whenever neighbor connectivity changes (flagged through comm_stale).
+
+void MeshBoundaryValues::InitPersistentRequests() {
+  int nmb = pmy_pack->nmb_thispack;
+  int nnghbr = pmy_pack->pmb->nnghbr;
+  auto &nghbr = pmy_pack->pmb->nghbr;
+  auto &mblev = pmy_pack->pmb->mb_lev;
+  int my_rank = global_variable::my_rank;
+
+  // free any persistent requests created for a previous mesh configuration.  All
+  // requests are inactive here since sends/recvs complete before any remeshing.
+  int nmb_max = std::max((pmy_pack->nmb_thispack), (pmy_pack->pmesh->nmb_maxperrank));
+  for (int n=0; n<nnghbr; ++n) {
+    for (int m=0; m<nmb_max; ++m) {
+      if (sendbuf[n].vars_req[m] != MPI_REQUEST_NULL) {
+        MPI_Request_free(&(sendbuf[n].vars_req[m]));
+      }
+      if (recvbuf[n].vars_req[m] != MPI_REQUEST_NULL) {
+        MPI_Request_free(&(recvbuf[n].vars_req[m]));
+      }
+    }
+  }
+
+  // with single-precision or transform-coded transport, (re)allocate float shadows of
+  // the variable buffers that carry the messages on the wire (no-op if extents are
+  // unchanged).  Transform coding prepends a hi/lo float pair holding each variable's
+  // slab mean, so the shadows are two floats per variable longer than the buffers
+  MPI_Datatype vtype = MPI_ATHENA_REAL;
+  if (single_prec_vars || transform_vars) {
+    vtype = MPI_FLOAT;
+    int next = (transform_vars)? 2*nvar_ : 0;
+    for (int n=0; n<nnghbr; ++n) {
+      Kokkos::realloc(sendbuf[n].vars_sp,
+                      sendbuf[n].vars.extent_int(0), sendbuf[n].vars.extent_int(1)+next);
+      Kokkos::realloc(recvbuf[n].vars_sp,
+                      recvbuf[n].vars.extent_int(0), recvbuf[n].vars.extent_int(1)+next);
+#if !(MPI_GPU_AWARE_ENABLED)
+      Kokkos::realloc(sendbuf[n].vars_sp_h,
+                      sendbuf[n].vars.extent_int(0), sendbuf[n].vars.extent_int(1)+next);
+      Kokkos::realloc(recvbuf[n].vars_sp_h,
+                      recvbuf[n].vars.extent_int(0), recvbuf[n].vars.extent_int(1)+next);
+#endif
+    }
+  }
+
+  bool no_errors=true;
+  for (int m=0; m<nmb; ++m) {
+    for (int n=0; n<nnghbr; ++n) {
+      if (nghbr.h_view(m,n).gid >= 0) {
+        int drank = nghbr.h_view(m,n).rank;
+        if (drank == my_rank) continue;
+
+        // persistent receive: tag encodes (lid, bufid) of THIS MeshBlock
+        int tag = CreateBvals_MPI_Tag(m, n);
+        int data_size = nvar_;
+        if ( nghbr.h_view(m,n).lev < mblev.h_view(m) ) {
+          data_size *= recvbuf[n].icoar_ndat;
+        } else if ( nghbr.h_view(m,n).lev == mblev.h_view(m) ) {
+          data_size *= (is_z4c_)? recvbuf[n].isame_z4c_ndat : recvbuf[n].isame_ndat;
+        } else {
+          data_size *= recvbuf[n].ifine_ndat;
+        }
+        if (transform_vars) {data_size += 2*nvar_;}  // hi/lo mean pair per variable
+        // with GPU-aware MPI, messages are sent/received in the device buffers directly;
+        // otherwise they are staged through host mirrors of the buffers.  With
+        // single-precision or transform-coded transport, the float shadows are used in
+        // place of the buffers
+#if MPI_GPU_AWARE_ENABLED
+        void *recv_ptr = (single_prec_vars || transform_vars)?
+          static_cast<void*>(
+              Kokkos::subview(recvbuf[n].vars_sp, m, Kokkos::ALL).data()) :
+          static_cast<void*>(Kokkos::subview(recvbuf[n].vars, m, Kokkos::ALL).data());
+#else
+        void *recv_ptr = (single_prec_vars || transform_vars)?
+          static_cast<void*>(
+              Kokkos::subview(recvbuf[n].vars_sp_h, m, Kokkos::ALL).data()) :
+          static_cast<void*>(Kokkos::subview(recvbuf[n].vars_h, m, Kokkos::ALL).data());
+#endif
+        int ierr = MPI_Recv_init(recv_ptr, data_size, vtype, drank, tag,
+                                 comm_vars, &(recvbuf[n].vars_req[m]));
+        if (ierr != MPI_SUCCESS) {no_errors=false;}
+
+        // persistent send: tag encodes (lid, bufid) of *receiving* MeshBlock
+        int lid = nghbr.h_view(m,n).gid - pmy_pack->pmesh->gids_eachrank[drank];
+        int dn = nghbr.h_view(m,n).dest;
+        tag = CreateBvals_MPI_Tag(lid, dn);
+        data_size = nvar_;
+        if ( nghbr.h_view(m,n).lev < mblev.h_view(m) ) {
+          data_size *= sendbuf[n].icoar_ndat;
+        } else if ( nghbr.h_view(m,n).lev == mblev.h_view(m) ) {
+          data_size *= (is_z4c_)? sendbuf[n].isame_z4c_ndat : sendbuf[n].isame_ndat;
+        } else {
+          data_size *= sendbuf[n].ifine_ndat;
+        }
+        if (transform_vars) {data_size += 2*nvar_;}  // hi/lo mean pair per variable
+#if MPI_GPU_AWARE_ENABLED
+        void *send_ptr = (single_prec_vars || transform_vars)?
+          static_cast<void*>(
+              Kokkos::subview(sendbuf[n].vars_sp, m, Kokkos::ALL).data()) :
+          static_cast<void*>(Kokkos::subview(sendbuf[n].vars, m, Kokkos::ALL).data());
+#else
+        void *send_ptr = (single_prec_vars || transform_vars)?
+          static_cast<void*>(
+              Kokkos::subview(sendbuf[n].vars_sp_h, m, Kokkos::ALL).data()) :
+          static_cast<void*>(Kokkos::subview(sendbuf[n].vars_h, m, Kokkos::ALL).data());
+#endif
+        ierr = MPI_Send_init(send_ptr, data_size, vtype, drank, tag,
+                             comm_vars, &(sendbuf[n].vars_req[m]));
+        if (ierr != MPI_SUCCESS) {no_errors=false;}
+      }
+    }
+  }
+  // Quit if MPI error detected
+  if (!(no_errors)) {
+    std::cout << "### FATAL ERROR in " << __FILE__ << " at line " << __LINE__
+       << std::endl << "MPI error in creating persistent requests" << std::endl;
+    std::exit(EXIT_FAILURE);
+  }
+
+  comm_stale = false;
+  return;
+}
+#endif
+
 //----------------------------------------------------------------------------------------
 // ParticlesBoundaryValues constructor:
 
@@ -228,18 +894,13 @@ particles::ParticlesBoundaryValues::ParticlesBoundaryValues(
   particles::Particles *pp, ParameterInput *pin) :
     sendlist("sendlist",1),
 #if MPI_PARALLEL_ENABLED
-    prtcl_rsendbuf("rsend",1),
-    prtcl_rrecvbuf("rrecv",1),
-    prtcl_isendbuf("isend",1),
-    prtcl_irecvbuf("irecv",1),
+    prtcl_sendbuf("psend",1),
+    prtcl_recvbuf("precv",1),
 #endif
     pmy_part(pp) {
 #if MPI_PARALLEL_ENABLED
-  // Guess that no more than 10% of particles will be communicated to set size of buffer
-  int npart = pmy_part->nprtcl_thispack;
-
   //resize vectors over number of ranks
-  nsends_eachrank.resize(global_variable::nranks);
+  nsend_torank.resize(global_variable::nranks);
 
   // create unique communicator for particles
   MPI_Comm_dup(MPI_COMM_WORLD, &mpi_comm_part);
@@ -82,6 +82,15 @@ struct MeshBoundaryBuffer {
   // vectors of length (number of MBs) to hold MPI requests
   // Using STL vector causes problems with some GPU compilers, so just use plain C array
   MPI_Request *vars_req, *flux_req;
+  // single-precision shadow of vars used to carry messages as floats on the wire when
+  // single-precision or transform-coded boundary communication is enabled (only
+  // allocated in those cases)
+  DvceArray2D<float> vars_sp;
+#if !(MPI_GPU_AWARE_ENABLED)
+  // host mirror of vars used to stage messages when MPI cannot access device memory
+  HostArray2D<Real> vars_h;
+  HostArray2D<float> vars_sp_h;
+#endif
 #endif
 
   // function to allocate memory for buffers for variables and their fluxes
@@ -97,12 +106,81 @@ struct MeshBoundaryBuffer {
     }
     int nmax = std::max(iflxs_ndat, iflxc_ndat);
     Kokkos::realloc(flux, nmb, (nvars*nmax));
+#if MPI_PARALLEL_ENABLED && !(MPI_GPU_AWARE_ENABLED)
+    Kokkos::realloc(vars_h, vars.extent_int(0), vars.extent_int(1));
+#endif
   }
 };
 
 // Forward declarations
 class MeshBlockPack;
 
+//----------------------------------------------------------------------------------------
+//! \struct CoalescedBuffer
+//! \brief describes location of data for one boundary buffer within the single aggregated
+//! MPI message exchanged with a remote rank when per-rank message coalescing is enabled.
+//! Also used for the layout of flux-correction data within the per-rank messages
+//! exchanged by the neighborhood collective.
+
+#if MPI_PARALLEL_ENABLED
+struct CoalescedBuffer {
+  int m;        // index of MeshBlock in MeshBlockPack that owns buffer
+  int n;        // index of buffer in send/recv buffer arrays
+  int cnt;      // number of Reals stored in this buffer
+  int offset;   // starting index of this buffer's data in message arena
+};
+#endif
+
+//----------------------------------------------------------------------------------------
+//! \struct ProlongationInterface
+//! \brief cached description of one fine/coarse interface of a MeshBlock requiring
+//! prolongation: the owning (MeshBlock, buffer) pair and precomputed loop bounds over
+//! both the coarse buffer cells (extended by one cell to cover the stencil of 2nd-order
+//! prolongation) and the corresponding fine cells.  A list of these is rebuilt only when
+//! neighbor connectivity changes, so per-stage prolongation kernels launch over exactly
+//! the interfaces present in the pack instead of scanning all (MeshBlock, buffer) pairs.
+
+struct ProlongationInterface {
+  int m, n;                      // MeshBlock and buffer indices of interface
+  int cil,ciu,cjl,cju,ckl,cku;   // stencil-extended coarse-cell loop bounds
+  int fil,fiu,fjl,fju,fkl,fku;   // fine-cell loop bounds
+};
+
+//----------------------------------------------------------------------------------------
+//! \enum XferMode
+//! \brief kinds of boundary-buffer transfers described by a TransferRegion below.  The
+//! kind folds together every per-neighbor decision made at pack/unpack time (does the
+//! neighbor exist, is it on this rank, is it at a coarser/same/finer level) so kernels
+//! select a copy loop with a single comparison instead of re-deriving the answer from
+//! NeighborBlock data.
+
+enum XferMode {xfer_none=0,        // no neighbor, or nothing to transfer
+               xfer_direct,       // write into neighbor's fine array on same rank
+               xfer_direct_coar,  // write into neighbor's coarse array on same rank
+               xfer_stage,        // stage fine data into neighbor's recv buffer
+               xfer_stage_coar,   // stage coarse data into neighbor's recv buffer
+               xfer_send,         // pack fine data into send buffer for MPI
+               xfer_send_coar,    // pack coarse data into send buffer for MPI
+               xfer_unpack,       // unpack recv buffer into fine array
+               xfer_unpack_coar}; // unpack recv buffer into coarse array
+
+//----------------------------------------------------------------------------------------
+//! \struct TransferRegion
+//! \brief cached description of one boundary-buffer transfer: the cell range
+//! packed/unpacked, the destination MeshBlock/buffer, the starting offset of the data
+//! within the buffer, and the transfer kind.  Tables of these are rebuilt only when
+//! neighbor connectivity changes, turning the pack/unpack kernels into table-driven
+//! block copies with no index computation or branching on NeighborBlock properties.
+
+struct TransferRegion {
+  int m, n;                // MeshBlock and buffer indices of transfer
+  int il,iu,jl,ju,kl,ku;   // cell range packed/unpacked
+  int dm, dn;              // destination MeshBlock and buffer indices (sends only)
+  int dil,djl,dkl;         // destination start cells for direct ghost-zone writes
+  int offset;              // starting index of data within buffer
+  int mode;                // one of the XferMode transfer kinds
+};
+
 //----------------------------------------------------------------------------------------
 //! \class MeshBoundaryValues
 //  \brief Abstract base class for boundary values for different kinds of Mesh variables
@@ -120,15 +198,116 @@ class MeshBoundaryValues {
   // constant inflow states at each face, initialized in problem generator
   DualArray2D<Real> u_in, b_in, i_in;
 
+  // cached list of fine/coarse interfaces requiring prolongation, rebuilt only when
+  // neighbor connectivity changes (flagged through prol_stale)
+  bool prol_stale;                          // cache must be rebuilt before next use
+  int nprol;                                // number of interfaces in cache
+  DualArray1D<ProlongationInterface> prol_ifc;
+
+  // cached tables of boundary-buffer transfer regions read by the pack/unpack kernels,
+  // rebuilt only when neighbor connectivity changes (flagged through xfer_stale).
+  // Layout of the tables is defined by each derived class in InitTransferRegions().
+  bool xfer_stale;                          // tables must be rebuilt before next use
+  int nxfer_send, nxfer_recv;               // number of regions in each table
+  DualArray1D<TransferRegion> xfer_send, xfer_recv;
+
 #if MPI_PARALLEL_ENABLED
   // unique MPI communicators for each case (variables/fluxes)
   MPI_Comm comm_vars, comm_flux;
+
+  // data for per-rank message coalescing of variable sends/recvs: all buffers exchanged
+  // with the same remote rank are concatenated into one message per rank. Tables below
+  // describe layout of each buffer within the aggregated messages, and must be rebuilt
+  // whenever neighbor connectivity changes (flagged through comm_stale).
+  bool coalesced_comm;                   // post one message per remote rank when true
+  bool single_prec_vars;                 // carry variable messages as floats when true
+  bool transform_vars;                   // carry variable messages as per-slab means
+                                         // plus float residuals when true (Z4c only)
+  bool comm_stale;                       // requests/tables must be rebuilt before next
+                                         // exchange (neighbor connectivity changed)
+  bool init_recv_posted = false;         // receives pre-posted before problem generation
+                                         // so the next InitRecv must not double-post
+  int ncoal_send, ncoal_recv;            // number of remote ranks exchanged with
+  std::vector<int> coal_send_rank, coal_recv_rank;      // remote rank of each message
+  std::vector<int> coal_send_offset, coal_recv_offset;  // start of message in arena
+  std::vector<int> coal_send_size, coal_recv_size;      // message sizes (# of Reals)
+  std::vector<MPI_Request> coal_send_req, coal_recv_req;
+  DualArray1D<CoalescedBuffer> coal_send_buf, coal_recv_buf;  // per-buffer layout tables
+  DvceArray1D<Real> coal_send_data, coal_recv_data;     // message arenas on device
+#if !(MPI_GPU_AWARE_ENABLED)
+  // host mirrors of arenas used to stage messages when MPI cannot access device memory
+  HostArray1D<Real> coal_send_data_h, coal_recv_data_h;
+#endif
+
+  // data for exchanging flux corrections with a neighborhood collective: all flux
+  // buffers exchanged with each remote rank are concatenated into one message per rank,
+  // and all messages are exchanged at once with MPI_Ineighbor_alltoallv over a
+  // distributed graph communicator built from the NeighborBlock connectivity.  Tables
+  // describing the layout of each buffer within the per-rank messages must be rebuilt
+  // whenever neighbor connectivity changes (flagged through flux_comm_stale).
+  bool nbrhd_flux_comm;        // exchange flux corrections with collective when true
+  bool flux_comm_stale;        // graph comm/tables must be rebuilt before next exchange
+  bool flux_nbrhd_started;     // collective exchange posted and not yet completed
+  MPI_Comm comm_flux_nbrhd;    // distributed graph communicator over neighboring ranks
+  MPI_Request flux_nbrhd_req;  // request for non-blocking collective exchange
+  std::vector<int> flx_send_rank, flx_recv_rank;    // remote rank of each message
+  std::vector<int> flx_send_count, flx_recv_count;  // message sizes (# of Reals)
+  std::vector<int> flx_send_disp, flx_recv_disp;    // message starts in arenas
+  DualArray1D<CoalescedBuffer> flx_send_buf, flx_recv_buf;  // per-buffer layout tables
+  DvceArray1D<Real> flx_send_data, flx_recv_data;   // message arenas on device
+
+  // per-buffer arrival flags for progressive polling of variable receives, sized
+  // (nmb, nnghbr) and reset after every completed exchange.  Flags advance
+  // 0 (pending) -> 1 (arrived) -> 2 (staged to device), so staging of each buffer
+  // (when MPI cannot access device memory) is overlapped with receives still in flight.
+  HostArray2D<int> vars_recvd;
+
+  // arrival-driven unpacking state (see RecvAndUnpackCC): flags marking entries of the
+  // xfer_recv table already unpacked during the current exchange, and a staging list of
+  // entries ready for the next partial-unpack kernel launch.  Reset once every entry
+  // has been unpacked so the next exchange starts fresh.
+  std::vector<int> xfer_done;
+  DualArray1D<int> xfer_ready;
+
+  // per-rank MPI progress engine shared by ALL MeshBoundaryValues objects: every
+  // variable receive started by InitRecv (across physics modules and task lists) is
+  // enlisted here, and all outstanding requests are driven together with a single
+  // MPI_Testsome sweep instead of each Recv task polling its own request set, reducing
+  // contention inside the MPI library as the number of modules grows.  Completion
+  // flips the owning object's vars_recvd flag read by TestAndStageRecvs; completed
+  // entries are removed, and re-enlisted when the persistent receives are restarted
+  // on the next exchange.
+  static std::vector<MPI_Request> eng_req;
+  static std::vector<MeshBoundaryValues*> eng_owner;
+  static std::vector<int> eng_m, eng_n;
+  static std::vector<int> eng_idx;   // scratch for indices returned by MPI_Testsome
+  static void EnlistRecv(MeshBoundaryValues *pbv, int m, int n, const MPI_Request &req);
+  static void DriveProgress();
 #endif
 
   //functions
   virtual void InitSendIndices(MeshBoundaryBuffer &buf,int x,int y,int z,int a,int b)=0;
   virtual void InitRecvIndices(MeshBoundaryBuffer &buf,int x,int y,int z,int a,int b)=0;
+  virtual void InitTransferRegions()=0;
   void InitializeBuffers(const int nvar);
+  void InitProlongationInterfaces();
+#if MPI_PARALLEL_ENABLED
+  void InitPersistentRequests();
+  void StartPersistentSends();
+  void InitCoalescedIndices();
+  void PackAndSendCoalesced();
+  TaskStatus RecvCoalescedAndScatter();
+  void InitFluxGraphIndices();
+  void PackAndSendFluxNbrhd();
+  TaskStatus RecvFluxNbrhdAndScatter();
+  // number of Reals a boundary buffer contributes to the per-rank flux-correction
+  // messages, or zero if that buffer is not exchanged during flux correction.
+  // Implemented by derived classes since flux corrections flow in different directions
+  // for CC and FC variables.
+  virtual int FluxSendCount(int m, int n)=0;
+  virtual int FluxRecvCount(int m, int n)=0;
+  bool TestAndStageRecvs();
+#endif
 
   TaskStatus InitRecv(const int nvar);
   virtual TaskStatus InitFluxRecv(const int nvar)=0;
@@ -137,6 +316,11 @@ class MeshBoundaryValues {
   TaskStatus ClearFluxRecv();
   TaskStatus ClearFluxSend();
 
+  // returns true if any MeshBlock in pack applies a built-in physical BC on either of
+  // the two given faces; lets per-direction BC kernels be skipped for packs entirely
+  // interior to the domain (kernel launch latency matters with small MeshBlocks)
+  static bool AnyPhysicalBCs(MeshBlockPack *pp, BoundaryFace f1, BoundaryFace f2);
+
   // BCs associated with various physics modules
   static void HydroBCs(MeshBlockPack *pp, DualArray2D<Real> uin, DvceArray5D<Real> u0);
   static void BFieldBCs(MeshBlockPack *pp, DualArray2D<Real> bin, DvceFaceFld4D<Real> b0);
@@ -149,6 +333,7 @@ class MeshBoundaryValues {
   // many types (Hydro, MHD, Radiation, Z4c, etc.)
   MeshBlockPack* pmy_pack;
   bool is_z4c_;   // flag to denote if this BoundaryValues is for Z4c module
+  int nvar_;      // # of variables in buffers, saved for rebuilding coalescing tables
 };
 
 //----------------------------------------------------------------------------------------
@@ -157,23 +342,56 @@ class MeshBoundaryValues {
 
 class MeshBoundaryValuesCC : public MeshBoundaryValues {
  public:
-  MeshBoundaryValuesCC(MeshBlockPack *ppack, ParameterInput *pin, bool z4c);
+  MeshBoundaryValuesCC(MeshBlockPack *ppack, ParameterInput *pin, bool z4c,
+                       int ng_exch = -1);
+
+  // depth (number of ghost layers) of the exchange performed through this object.
+  // Modules whose stencils read fewer ghost layers than the global nghost (which mixed
+  // physics runs must set for the deepest stencil present, e.g. the z4c FD stencil)
+  // pass their own depth to the constructor, shrinking buffers and messages; the
+  // default exchanges all nghost layers.  Ghost cells beyond this depth are never
+  // filled by the exchange and must not be read by the owning module's kernels.
+  int ng_exch_;
 
   //functions
   void InitSendIndices(MeshBoundaryBuffer &b,int o1,int o2,int o3,int f1,int f2) override;
   void InitRecvIndices(MeshBoundaryBuffer &b,int o1,int o2,int o3,int f1,int f2) override;
+  void InitTransferRegions() override;
   TaskStatus InitFluxRecv(const int nvar) override;
+#if MPI_PARALLEL_ENABLED
+  int FluxSendCount(int m, int n) override;
+  int FluxRecvCount(int m, int n) override;
+#endif
 
   // functions to communicate CC data
   TaskStatus PackAndSendCC(DvceArray5D<Real> &a, DvceArray5D<Real> &ca);
   TaskStatus RecvAndUnpackCC(DvceArray5D<Real> &a, DvceArray5D<Real> &ca);
+  // fused variants that exchange TWO sets of CC variables (e.g. ion and neutral fluids)
+  // through the same buffers and message stream; buffers must have been initialized
+  // with the combined variable count
+  TaskStatus PackAndSendCC(DvceArray5D<Real> &a, DvceArray5D<Real> &ca,
+                           DvceArray5D<Real> &a2, DvceArray5D<Real> &ca2);
+  TaskStatus RecvAndUnpackCC(DvceArray5D<Real> &a, DvceArray5D<Real> &ca,
+                             DvceArray5D<Real> &a2, DvceArray5D<Real> &ca2);
   // functions to communicate fluxes of CC data
   TaskStatus PackAndSendFluxCC(DvceFaceFld5D<Real> &flx);
   TaskStatus RecvAndUnpackFluxCC(DvceFaceFld5D<Real> &flx);
 
+  // flux-correction participation, precomputed per topology change: number of
+  // (MeshBlock, face) pairs in this pack with a coarser/finer neighbor.  Lets the
+  // per-stage flux-correction tasks return immediately on packs with no level mismatch
+  // instead of cycling every buffer on every block looking for work.
+  bool flux_faces_stale=true;  // counts must be recomputed (set after any remesh)
+  int nflx_send_faces=0;       // faces sending restricted fluxes to coarser neighbors
+  int nflx_recv_faces=0;       // faces receiving corrected fluxes from finer neighbors
+  void CountFluxFaces();
+
   // functions to prolongate conserved and primitive CC variables
   void FillCoarseInBndryCC(DvceArray5D<Real> &a, DvceArray5D<Real> &ca,
        bool is_z4c=false);
+  // restriction limited to interface-adjacent cells consumed by sends/prolongation
+  void RestrictInterfaceCC(DvceArray5D<Real> &a, DvceArray5D<Real> &ca,
+       bool is_z4c=false);
   void ProlongateCC(DvceArray5D<Real> &a, DvceArray5D<Real> &ca, bool is_z4c=false);
   void ConsToPrimCoarseBndry(const DvceArray5D<Real> &cons, DvceArray5D<Real> &prim);
   void PrimToConsFineBndry(const DvceArray5D<Real> &prim, DvceArray5D<Real> &cons);
@@ -194,7 +412,12 @@ class MeshBoundaryValuesFC : public MeshBoundaryValues {
   //functions
   void InitSendIndices(MeshBoundaryBuffer &b,int o1,int o2,int o3,int f1,int f2) override;
   void InitRecvIndices(MeshBoundaryBuffer &b,int o1,int o2,int o3,int f1,int f2) override;
+  void InitTransferRegions() override;
   TaskStatus InitFluxRecv(const int nvar) override;
+#if MPI_PARALLEL_ENABLED
+  int FluxSendCount(int m, int n) override;
+  int FluxRecvCount(int m, int n) override;
+#endif
 
   TaskStatus PackAndSendFC(DvceFaceFld4D<Real> &b, DvceFaceFld4D<Real> &cb);
   TaskStatus RecvAndUnpackFC(DvceFaceFld4D<Real> &b, DvceFaceFld4D<Real> &cb);
@@ -219,16 +442,6 @@ struct ParticleLocationData {
   int dest_rank;    // rank of target MeshBlock
 };
 
-// Custom operators to sort ParticleLocationData array by dest_rank or prtcl_indx
-struct {
-  bool operator()(ParticleLocationData a, ParticleLocationData b)
-    const { return a.dest_rank < b.dest_rank; }
-} SortByRank;
-struct {
-  bool operator()(ParticleLocationData a, ParticleLocationData b)
-    const { return a.prtcl_indx < b.prtcl_indx; }
-} SortByIndex;
-
 //----------------------------------------------------------------------------------------
 //! \struct ParticleMessageData
 //! \brief Data describing MPI messages containing particles
@@ -257,16 +470,15 @@ class ParticlesBoundaryValues {
   // Data needed to count number of messages and particles to send between ranks
   int nsends; // number of MPI sends to neighboring ranks on this rank
   int nrecvs; // number of MPI recvs from neighboring ranks on this rank
-  std::vector<int> nsends_eachrank;                // length nranks
+  std::vector<int> nsend_torank;                   // length nranks
   std::vector<ParticleMessageData> sends_thisrank; // length nsends
   std::vector<ParticleMessageData> recvs_thisrank; // length nrecvs
-  std::vector<ParticleMessageData> sends_allranks; // length ncounts summed over ranks
 
 #if MPI_PARALLEL_ENABLED
-  DvceArray1D<Real> prtcl_rsendbuf, prtcl_rrecvbuf;
-  DvceArray1D<int>  prtcl_isendbuf, prtcl_irecvbuf;
-  std::vector<MPI_Request> rrecv_req, rsend_req;  // vectors of requests for Reals
-  std::vector<MPI_Request> irecv_req, isend_req;  // vectors of requests for ints
+  // packed particle records (nrdata Reals followed by nidata ints per particle), one
+  // contiguous message per communicating rank pair
+  DvceArray1D<char> prtcl_sendbuf, prtcl_recvbuf;
+  std::vector<MPI_Request> recv_req, send_req;
   MPI_Comm mpi_comm_part;                       // unique MPI communicators for particles
 #endif
 
@@ -22,8 +22,15 @@
 // BValCC constructor:
 
 MeshBoundaryValuesCC::MeshBoundaryValuesCC(MeshBlockPack *pp, ParameterInput *pin,
-                                           bool z4c) :
+                                           bool z4c, int ng_exch) :
   MeshBoundaryValues(pp, pin, z4c) {
+  // set depth of ghost-zone exchange (see declaration in bvals.hpp).  Negative depth
+  // (the default) exchanges all nghost layers
+  int ng = pp->pmesh->mb_indcs.ng;
+  ng_exch_ = ((ng_exch < 0) || (ng_exch > ng))? ng : ng_exch;
+  // exchanged fine ghost layers map to ng_exch_/2 coarse cells during prolongation, so
+  // round the depth up to even with SMR/AMR (same constraint as on nghost itself)
+  if (pp->pmesh->multilevel) {ng_exch_ += (ng_exch_ % 2);}
 }
 
 //----------------------------------------------------------------------------------------
@@ -40,375 +47,419 @@ MeshBoundaryValuesCC::MeshBoundaryValuesCC(MeshBlockPack *pp, ParameterInput *pi
 
 TaskStatus MeshBoundaryValuesCC::PackAndSendCC(DvceArray5D<Real> &a,
                                                DvceArray5D<Real> &ca) {
+  // rebuild cached transfer tables if neighbor connectivity has changed
+  if (xfer_stale) {InitTransferRegions();}
+
   // create local references for variables in kernel
-  int nmb = pmy_pack->nmb_thispack;
-  int nnghbr = pmy_pack->pmb->nnghbr;
   int nvar = a.extent_int(1);  // TODO(@user): 2nd index from L of in array must be NVAR
 
-  {int my_rank = global_variable::my_rank;
-  auto &nghbr = pmy_pack->pmb->nghbr;
-  auto &mbgid = pmy_pack->pmb->mb_gid;
-  auto &mblev = pmy_pack->pmb->mb_lev;
-  auto &sbuf = sendbuf;
+  {auto &sbuf = sendbuf;
   auto &rbuf = recvbuf;
-  auto &is_z4c = is_z4c_;
-  auto &multilevel = pmy_pack->pmesh->multilevel;
-  // Outer loop over (# of MeshBlocks)*(# of buffers)*(# of variables)
-  int nmnv = nmb*nnghbr*nvar;
-  Kokkos::TeamPolicy<> policy(DevExeSpace(), nmnv, Kokkos::AUTO);
+  auto &xfer = xfer_send;
+  // Outer loop over (# of cached transfer regions)*(# of variables).  All per-neighbor
+  // logic (existence, rank, relative level, Z4c coarse-data appends) was resolved when
+  // the table was built, so each team just executes one block copy.
+  int nenv = nxfer_send*nvar;
+  Kokkos::TeamPolicy<> policy(DevExeSpace(), nenv, Kokkos::AUTO);
   Kokkos::parallel_for("SendBuff", policy, KOKKOS_LAMBDA(TeamMember_t tmember) {
-    const int m = (tmember.league_rank())/(nnghbr*nvar);
-    const int n = (tmember.league_rank() - m*(nnghbr*nvar))/nvar;
-    const int v = (tmember.league_rank() - m*(nnghbr*nvar) - n*nvar);
-
-    // only load buffers when neighbor exists
-    if (nghbr.d_view(m,n).gid >= 0) {
-      // if neighbor is at coarser level, use coar indices to pack buffer
-      int il, iu, jl, ju, kl, ku;
-      if (nghbr.d_view(m,n).lev < mblev.d_view(m)) {
-        il = sbuf[n].icoar[0].bis;
-        iu = sbuf[n].icoar[0].bie;
-        jl = sbuf[n].icoar[0].bjs;
-        ju = sbuf[n].icoar[0].bje;
-        kl = sbuf[n].icoar[0].bks;
-        ku = sbuf[n].icoar[0].bke;
-      // if neighbor is at same level, use same indices to pack buffer
-      } else if (nghbr.d_view(m,n).lev == mblev.d_view(m)) {
-        il = sbuf[n].isame[0].bis;
-        iu = sbuf[n].isame[0].bie;
-        jl = sbuf[n].isame[0].bjs;
-        ju = sbuf[n].isame[0].bje;
-        kl = sbuf[n].isame[0].bks;
-        ku = sbuf[n].isame[0].bke;
-      // if neighbor is at finer level, use fine indices to pack buffer
+    const int e = (tmember.league_rank())/nvar;
+    const int v = (tmember.league_rank() - e*nvar);
+    TransferRegion t = xfer.d_view(e);
+
+    const int m = t.m, n = t.n;
+    const int il = t.il, iu = t.iu, jl = t.jl, kl = t.kl;
+    const int ni = t.iu - t.il + 1;
+    const int nj = t.ju - t.jl + 1;
+    const int nk = t.ku - t.kl + 1;
+    const int nkj = nk*nj;
+
+    // Middle loop over k,j
+    Kokkos::parallel_for(Kokkos::TeamThreadRange<>(tmember, nkj), [&](const int idx) {
+      int k = idx / nj;
+      int j = (idx - k * nj) + jl;
+      k += kl;
+
+      // Inner (vector) loop over i
+      // write straight into same-rank neighbor's ghost zones (or coarse array for Z4c)
+      if (t.mode == xfer_direct) {
+        Kokkos::parallel_for(Kokkos::ThreadVectorRange(tmember,il,iu+1),
+        [&](const int i) {
+          a(t.dm, v, t.dkl+(k-kl), t.djl+(j-jl), t.dil+(i-il)) = a(m,v,k,j,i);
+        });
+      } else if (t.mode == xfer_direct_coar) {
+        Kokkos::parallel_for(Kokkos::ThreadVectorRange(tmember,il,iu+1),
+        [&](const int i) {
+          ca(t.dm, v, t.dkl+(k-kl), t.djl+(j-jl), t.dil+(i-il)) = ca(m,v,k,j,i);
+        });
+      // stage into same-rank neighbor's recv buffer (consumed by prolong/restrict)
+      } else if (t.mode == xfer_stage) {
+        Kokkos::parallel_for(Kokkos::ThreadVectorRange(tmember,il,iu+1),
+        [&](const int i) {
+          rbuf[t.dn].vars(t.dm, (i-il + ni*(j-jl + nj*(k-kl + nk*v))) ) = a(m,v,k,j,i);
+        });
+      } else if (t.mode == xfer_stage_coar) {
+        Kokkos::parallel_for(Kokkos::ThreadVectorRange(tmember,il,iu+1),
+        [&](const int i) {
+          rbuf[t.dn].vars(t.dm, (i-il + ni*(j-jl + nj*(k-kl + nk*v))) ) = ca(m,v,k,j,i);
+        });
+      // pack into send buffer for MPI communication below
+      } else if (t.mode == xfer_send) {
+        Kokkos::parallel_for(Kokkos::ThreadVectorRange(tmember,il,iu+1),
+        [&](const int i) {
+          sbuf[n].vars(m, t.offset + (i-il + ni*(j-jl + nj*(k-kl + nk*v))) ) =
+            a(m,v,k,j,i);
+        });
       } else {
-        il = sbuf[n].ifine[0].bis;
-        iu = sbuf[n].ifine[0].bie;
-        jl = sbuf[n].ifine[0].bjs;
-        ju = sbuf[n].ifine[0].bje;
-        kl = sbuf[n].ifine[0].bks;
-        ku = sbuf[n].ifine[0].bke;
+        Kokkos::parallel_for(Kokkos::ThreadVectorRange(tmember,il,iu+1),
+        [&](const int i) {
+          sbuf[n].vars(m, t.offset + (i-il + ni*(j-jl + nj*(k-kl + nk*v))) ) =
+            ca(m,v,k,j,i);
+        });
       }
-      int ni = iu - il + 1;
-      int nj = ju - jl + 1;
-      int nk = ku - kl + 1;
-      int nkj  = nk*nj;
-
-      // indices of recv'ing (destination) MB and buffer: MB IDs are stored sequentially
-      // in MeshBlockPacks, so array index equals (target_id - first_id)
-      int dm = nghbr.d_view(m,n).gid - mbgid.d_view(0);
-      int dn = nghbr.d_view(m,n).dest;
-
-      // Middle loop over k,j
-      Kokkos::parallel_for(Kokkos::TeamThreadRange<>(tmember, nkj), [&](const int idx) {
-        int k = idx / nj;
-        int j = (idx - k * nj) + jl;
-        k += kl;
-
-        // Inner (vector) loop over i
-        // copy directly into recv buffer if MeshBlocks on same rank
-
-        if (nghbr.d_view(m,n).rank == my_rank) {
-          // if neighbor is at same or finer level, load data from u0
-          if (nghbr.d_view(m,n).lev >= mblev.d_view(m)) {
-            Kokkos::parallel_for(Kokkos::ThreadVectorRange(tmember,il,iu+1),
-            [&](const int i) {
-              rbuf[dn].vars(dm, (i-il + ni*(j-jl + nj*(k-kl + nk*v))) ) = a(m,v,k,j,i);
-            });
-            tmember.team_barrier();
-          // if neighbor is at coarser level, load data from coarse_u0
-          } else {
-            Kokkos::parallel_for(Kokkos::ThreadVectorRange(tmember,il,iu+1),
-            [&](const int i) {
-              rbuf[dn].vars(dm, (i-il + ni*(j-jl + nj*(k-kl + nk*v))) ) = ca(m,v,k,j,i);
-            });
-            tmember.team_barrier();
-          }
+      tmember.team_barrier();
+    });
+  }); // end par_for_outer
+  }
 
-        // else copy into send buffer for MPI communication below
+#if MPI_PARALLEL_ENABLED
+  // with coalesced comm, gather buffers into per-rank messages, one send per rank
+  if (coalesced_comm) {
+    PackAndSendCoalesced();
+    return TaskStatus::complete;
+  }
 
-        } else {
-          // if neighbor is at same or finer level, load data from u0
-          if (nghbr.d_view(m,n).lev >= mblev.d_view(m)) {
-            Kokkos::parallel_for(Kokkos::ThreadVectorRange(tmember,il,iu+1),
-            [&](const int i) {
-              sbuf[n].vars(m, (i-il + ni*(j-jl + nj*(k-kl + nk*v))) ) = a(m,v,k,j,i);
-            });
-            tmember.team_barrier();
-          // if neighbor is at coarser level, load data from coarse_u0
-          } else {
-            Kokkos::parallel_for(Kokkos::ThreadVectorRange(tmember,il,iu+1),
-            [&](const int i) {
-              sbuf[n].vars(m, (i-il + ni*(j-jl + nj*(k-kl + nk*v))) ) = ca(m,v,k,j,i);
-            });
-            tmember.team_barrier();
-          }
-        }
-      });
-    } // end if-neighbor-exists block
-  }); // end par_for_outer
+  // Start persistent sends of boundary buffers to neighboring MeshBlocks.  Tags, sizes,
+  // and buffer locations are fixed between remeshing events, so they are set once in
+  // InitPersistentRequests() rather than recomputed every stage.
+  Kokkos::fence();
+  StartPersistentSends();
+#endif
+  return TaskStatus::complete;
+}
 
-  Kokkos::parallel_for("SendBuff", policy, KOKKOS_LAMBDA(TeamMember_t tmember) {
-    const int m = (tmember.league_rank())/(nnghbr*nvar);
-    const int n = (tmember.league_rank() - m*(nnghbr*nvar))/nvar;
-    const int v = (tmember.league_rank() - m*(nnghbr*nvar) - n*nvar);
-
-    // only load buffers when neighbor exists
-    if (nghbr.d_view(m,n).gid >= 0) {
-      int il, iu, jl, ju, kl, ku;
-      // If neighbor is at same level and data is for Z4c module, append data from coarse
-      // array for higher-order prolongation
-      if ((nghbr.d_view(m,n).lev == mblev.d_view(m)) && (is_z4c) && (multilevel)) {
-        il = sbuf[n].isame_z4c.bis;
-        iu = sbuf[n].isame_z4c.bie;
-        jl = sbuf[n].isame_z4c.bjs;
-        ju = sbuf[n].isame_z4c.bje;
-        kl = sbuf[n].isame_z4c.bks;
-        ku = sbuf[n].isame_z4c.bke;
-        int ni = iu - il + 1;
-        int nj = ju - jl + 1;
-        int nk = ku - kl + 1;
-        int nkj  = nk*nj;
-        int ndat = nvar*sbuf[n].isame_ndat; // size of same level data already in buff
-
-        // indices of recv'ing (destination) MB and buffer: MB IDs are stored sequentially
-        // in MeshBlockPacks, so array index equals (target_id - first_id)
-        int dm = nghbr.d_view(m,n).gid - mbgid.d_view(0);
-        int dn = nghbr.d_view(m,n).dest;
-
-        // Middle loop over k,j
-        Kokkos::parallel_for(Kokkos::TeamThreadRange<>(tmember, nkj), [&](const int idx) {
-          int k = idx / nj;
-          int j = (idx - k * nj) + jl;
-          k += kl;
+//----------------------------------------------------------------------------------------
+//! \fn void MeshBoundaryValuesCC::PackAndSendCC()
+//! \brief Fused variant of PackAndSendCC() that packs TWO sets of cell-centered
+//! variables (e.g. the ion and neutral fluids in two-fluid MHD) into the same boundary
+//! buffers, so both fluids are exchanged with a single pack kernel and one message
+//! stream per rank pair.  Buffers must have been initialized with the combined variable
+//! count; variables of the first array occupy slots [0,nv1) of each buffer and those of
+//! the second occupy [nv1,nvar).  Never used by the Z4c module, so the same-level
+//! coarse-data append for higher-order prolongation is omitted.
 
-          // Inner (vector) loop over i
-          // copy directly into recv buffer if MeshBlocks on same rank
-          if (nghbr.d_view(m,n).rank == my_rank) {
-            // load data from coarse_u0
-            Kokkos::parallel_for(Kokkos::ThreadVectorRange(tmember,il,iu+1),
-            [&](const int i) {
-              rbuf[dn].vars(dm,ndat+ (i-il + ni*(j-jl + nj*(k-kl + nk*v))))=ca(m,v,k,j,i);
-            });
-            tmember.team_barrier();
+TaskStatus MeshBoundaryValuesCC::PackAndSendCC(DvceArray5D<Real> &a,
+                                               DvceArray5D<Real> &ca,
+                                               DvceArray5D<Real> &a2,
+                                               DvceArray5D<Real> &ca2) {
+  // rebuild cached transfer tables if neighbor connectivity has changed
+  if (xfer_stale) {InitTransferRegions();}
 
-          // else copy into send buffer for MPI communication below
-          } else {
-            // load data from coarse_u0
-            Kokkos::parallel_for(Kokkos::ThreadVectorRange(tmember,il,iu+1),
-            [&](const int i) {
-              sbuf[n].vars(m,ndat+ (i-il + ni*(j-jl + nj*(k-kl + nk*v))) )=ca(m,v,k,j,i);
-            });
-            tmember.team_barrier();
-          }
+  // create local references for variables in kernel
+  int nv1 = a.extent_int(1);
+  int nvar = nv1 + a2.extent_int(1);
+
+  {auto &sbuf = sendbuf;
+  auto &rbuf = recvbuf;
+  auto &xfer = xfer_send;
+  // Outer loop over (# of cached transfer regions)*(# of fused variables)
+  int nenv = nxfer_send*nvar;
+  Kokkos::TeamPolicy<> policy(DevExeSpace(), nenv, Kokkos::AUTO);
+  Kokkos::parallel_for("SendBuff", policy, KOKKOS_LAMBDA(TeamMember_t tmember) {
+    const int e = (tmember.league_rank())/nvar;
+    const int v = (tmember.league_rank() - e*nvar);
+    TransferRegion t = xfer.d_view(e);
+
+    const int m = t.m, n = t.n;
+    const int il = t.il, iu = t.iu, jl = t.jl, kl = t.kl;
+    const int ni = t.iu - t.il + 1;
+    const int nj = t.ju - t.jl + 1;
+    const int nk = t.ku - t.kl + 1;
+    const int nkj = nk*nj;
+
+    // select fluid by position in the fused variable list; buffer offsets below keep
+    // using the fused index v so both fluids land in disjoint slots
+    const DvceArray5D<Real> &av = (v < nv1)? a : a2;
+    const DvceArray5D<Real> &cav = (v < nv1)? ca : ca2;
+    const int vf = (v < nv1)? v : (v - nv1);
+
+    // Middle loop over k,j
+    Kokkos::parallel_for(Kokkos::TeamThreadRange<>(tmember, nkj), [&](const int idx) {
+      int k = idx / nj;
+      int j = (idx - k * nj) + jl;
+      k += kl;
+
+      // Inner (vector) loop over i
+      // write straight into same-rank neighbor's ghost zones
+      if (t.mode == xfer_direct) {
+        Kokkos::parallel_for(Kokkos::ThreadVectorRange(tmember,il,iu+1),
+        [&](const int i) {
+          av(t.dm, vf, t.dkl+(k-kl), t.djl+(j-jl), t.dil+(i-il)) = av(m,vf,k,j,i);
+        });
+      // stage into same-rank neighbor's recv buffer (consumed by prolong/restrict)
+      } else if (t.mode == xfer_stage) {
+        Kokkos::parallel_for(Kokkos::ThreadVectorRange(tmember,il,iu+1),
+        [&](const int i) {
+          rbuf[t.dn].vars(t.dm, (i-il + ni*(j-jl + nj*(k-kl + nk*v))) ) = av(m,vf,k,j,i);
+        });
+      } else if (t.mode == xfer_stage_coar) {
+        Kokkos::parallel_for(Kokkos::ThreadVectorRange(tmember,il,iu+1),
+        [&](const int i) {
+          rbuf[t.dn].vars(t.dm, (i-il + ni*(j-jl + nj*(k-kl + nk*v))) ) = cav(m,vf,k,j,i);
+        });
+      // pack into send buffer for MPI communication below
+      } else if (t.mode == xfer_send) {
+        Kokkos::parallel_for(Kokkos::ThreadVectorRange(tmember,il,iu+1),
+        [&](const int i) {
+          sbuf[n].vars(m, (i-il + ni*(j-jl + nj*(k-kl + nk*v))) ) = av(m,vf,k,j,i);
+        });
+      } else {
+        Kokkos::parallel_for(Kokkos::ThreadVectorRange(tmember,il,iu+1),
+        [&](const int i) {
+          sbuf[n].vars(m, (i-il + ni*(j-jl + nj*(k-kl + nk*v))) ) = cav(m,vf,k,j,i);
         });
       }
-    } // end if-neighbor-exists block
+      tmember.team_barrier();
+    });
   }); // end par_for_outer
   }
 
 #if MPI_PARALLEL_ENABLED
-  // Send boundary buffer to neighboring MeshBlocks using MPI
-  Kokkos::fence();
-  auto &is_z4c = is_z4c_;
-  int my_rank = global_variable::my_rank;
-  auto &nghbr = pmy_pack->pmb->nghbr;
-  bool no_errors=true;
-  for (int m=0; m<nmb; ++m) {
-    for (int n=0; n<nnghbr; ++n) {
-      if (nghbr.h_view(m,n).gid >= 0) {  // neighbor exists and not a physical boundary
-        // index and rank of destination Neighbor
-        int dn = nghbr.h_view(m,n).dest;
-        int drank = nghbr.h_view(m,n).rank;
-        if (drank != my_rank) {
-          // create tag using local ID and buffer index of *receiving* MeshBlock
-          int lid = nghbr.h_view(m,n).gid - pmy_pack->pmesh->gids_eachrank[drank];
-          int tag = CreateBvals_MPI_Tag(lid, dn);
-
-          // get ptr to send buffer when neighbor is at coarser/same/fine level
-          int data_size = nvar;
-          if ( nghbr.h_view(m,n).lev < pmy_pack->pmb->mb_lev.h_view(m) ) {
-            data_size *= sendbuf[n].icoar_ndat;
-          } else if ( nghbr.h_view(m,n).lev == pmy_pack->pmb->mb_lev.h_view(m) ) {
-            if (is_z4c) {
-              data_size *= sendbuf[n].isame_z4c_ndat;
-            } else {
-              data_size *= sendbuf[n].isame_ndat;
-            }
-          } else {
-            data_size *= sendbuf[n].ifine_ndat;
-          }
-          auto send_ptr = Kokkos::subview(sendbuf[n].vars, m, Kokkos::ALL);
-
-          int ierr = MPI_Isend(send_ptr.data(), data_size, MPI_ATHENA_REAL, drank, tag,
-                               comm_vars, &(sendbuf[n].vars_req[m]));
-          if (ierr != MPI_SUCCESS) {no_errors=false;}
-        }
-      }
-    }
-  }
-  // Quit if MPI error detected
-  if (!(no_errors)) {
-    std::cout << "### FATAL ERROR in " << __FILE__ << " at line " << __LINE__
-       << std::endl << "MPI error in posting sends" << std::endl;
-    std::exit(EXIT_FAILURE);
+  // with coalesced comm, gather buffers into per-rank messages, one send per rank
+  if (coalesced_comm) {
+    PackAndSendCoalesced();
+    return TaskStatus::complete;
   }
+
+  // Start persistent sends of boundary buffers to neighboring MeshBlocks
+  Kokkos::fence();
+  StartPersistentSends();
 #endif
   return TaskStatus::complete;
 }
 
 //----------------------------------------------------------------------------------------
 // \!fn void RecvBuffers()
-// \brief Unpack boundary buffers
+// \brief Unpack boundary buffers.  With plain (non-coalesced, Real) MPI transport the
+// unpack is arrival-driven: each poll launches an unpack over the transfer regions of
+// whichever buffers have landed since the last poll, instead of the entire unpack
+// waiting on the slowest message.
 
 TaskStatus MeshBoundaryValuesCC::RecvAndUnpackCC(DvceArray5D<Real> &a,
                                                  DvceArray5D<Real> &ca) {
+  // rebuild cached transfer tables if neighbor connectivity has changed
+  if (xfer_stale) {InitTransferRegions();}
+
   // create local references for variables in kernel
-  int nmb = pmy_pack->nmb_thispack;
-  int nnghbr = pmy_pack->pmb->nnghbr;
-  auto &nghbr = pmy_pack->pmb->nghbr;
   auto &rbuf = recvbuf;
-  auto &is_z4c = is_z4c_;
-  auto &multilevel = pmy_pack->pmesh->multilevel;
 #if MPI_PARALLEL_ENABLED
   //----- STEP 1: check that recv boundary buffer communications have all completed
 
-  bool bflag = false;
-  bool no_errors=true;
-  for (int m=0; m<nmb; ++m) {
-    for (int n=0; n<nnghbr; ++n) {
-      if (nghbr.h_view(m,n).gid >= 0) { // neighbor exists and not a physical boundary
-        if (nghbr.h_view(m,n).rank != global_variable::my_rank) {
-          int test;
-          int ierr = MPI_Test(&(rbuf[n].vars_req[m]), &test, MPI_STATUS_IGNORE);
-          if (ierr != MPI_SUCCESS) {no_errors=false;}
-          if (!(static_cast<bool>(test))) {
-            bflag = true;
-          }
+  // with coalesced comm, test per-rank messages and scatter back into recv buffers
+  if (coalesced_comm) {
+    TaskStatus tstat = RecvCoalescedAndScatter();
+    if (tstat == TaskStatus::incomplete) {return tstat;}
+  } else if (single_prec_vars || transform_vars) {
+    // transport needs a whole-buffer decode pass, so wait for all receives as before
+    if (!(TestAndStageRecvs())) {return TaskStatus::incomplete;}
+  } else {
+    // arrival-driven unpacking: rather than waiting for the last message before
+    // launching one unpack over every transfer region, on each poll unpack the regions
+    // of whichever buffers have already been staged (first-arrived-first-unpacked), so
+    // unpack work overlaps with receives still in flight instead of the whole stage
+    // serializing behind the slowest message
+    bool all_arrived = TestAndStageRecvs();
+    auto &nghbr = pmy_pack->pmb->nghbr;
+    int my_rank = global_variable::my_rank;
+    if (static_cast<int>(xfer_done.size()) != nxfer_recv) {
+      xfer_done.assign(nxfer_recv, 0);
+      Kokkos::realloc(xfer_ready, nxfer_recv);
+    }
+    int nready = 0;
+    for (int e=0; e<nxfer_recv; ++e) {
+      if (xfer_done[e] == 0) {
+        const int m = xfer_recv.h_view(e).m;
+        const int n = xfer_recv.h_view(e).n;
+        // same-rank buffers were staged at pack time; remote ones once flag reaches 2
+        if (all_arrived || (nghbr.h_view(m,n).rank == my_rank) ||
+            (vars_recvd(m,n) == 2)) {
+          xfer_ready.h_view(nready++) = e;
+          xfer_done[e] = 1;
         }
       }
     }
+    if (nready > 0) {
+      xfer_ready.template modify<HostMemSpace>();
+      xfer_ready.template sync<DevExeSpace>();
+      int nv = a.extent_int(1);
+      auto &xfer = xfer_recv;
+      auto &xready = xfer_ready;
+      Kokkos::TeamPolicy<> policy(DevExeSpace(), (nready*nv), Kokkos::AUTO);
+      Kokkos::parallel_for("RecvBuffArr", policy, KOKKOS_LAMBDA(TeamMember_t tmember) {
+        const int e = xready.d_view((tmember.league_rank())/nv);
+        const int v = (tmember.league_rank()) - ((tmember.league_rank())/nv)*nv;
+        TransferRegion t = xfer.d_view(e);
+
+        const int m = t.m, n = t.n;
+        const int il = t.il, iu = t.iu, jl = t.jl, kl = t.kl;
+        const int ni = t.iu - t.il + 1;
+        const int nj = t.ju - t.jl + 1;
+        const int nk = t.ku - t.kl + 1;
+        const int nkj = nk*nj;
+
+        Kokkos::parallel_for(Kokkos::TeamThreadRange<>(tmember, nkj), [&](const int idx) {
+          int k = idx / nj;
+          int j = (idx - k * nj) + jl;
+          k += kl;
+
+          if (t.mode == xfer_unpack) {
+            Kokkos::parallel_for(Kokkos::ThreadVectorRange(tmember,il,iu+1),
+            [&](const int i) {
+              a(m,v,k,j,i) =
+                rbuf[n].vars(m, t.offset + (i-il + ni*(j-jl + nj*(k-kl+nk*v))));
+            });
+          } else {
+            Kokkos::parallel_for(Kokkos::ThreadVectorRange(tmember,il,iu+1),
+            [&](const int i) {
+              ca(m,v,k,j,i) =
+                rbuf[n].vars(m, t.offset + (i-il + ni*(j-jl + nj*(k-kl+nk*v))));
+            });
+          }
+          tmember.team_barrier();
+        });
+      });
+    }
+    if (!(all_arrived)) {return TaskStatus::incomplete;}
+    // every region has been unpacked above; reset flags for the next exchange
+    xfer_done.assign(nxfer_recv, 0);
+    return TaskStatus::complete;
   }
-  // Quit if MPI error detected
-  if (!(no_errors)) {
-    std::cout << "### FATAL ERROR in " << __FILE__ << " at line " << __LINE__
-              << std::endl << "MPI error in testing non-blocking receives"
-              << std::endl;
-    std::exit(EXIT_FAILURE);
-  }
-  // exit if recv boundary buffer communications have not completed
-  if (bflag) {return TaskStatus::incomplete;}
 #endif
 
   //----- STEP 2: buffers have all completed, so unpack
 
   int nvar = a.extent_int(1);  // TODO(@user): 2nd index from L of in array must be NVAR
-  auto &mblev = pmy_pack->pmb->mb_lev;
+  auto &xfer = xfer_recv;
 
-  // Outer loop over (# of MeshBlocks)*(# of buffers)*(# of variables)
-  Kokkos::TeamPolicy<> policy(DevExeSpace(), (nmb*nnghbr*nvar), Kokkos::AUTO);
+  // Outer loop over (# of cached transfer regions)*(# of variables).  The table only
+  // holds transfers that need unpacking (same-rank same-level neighbors were copied
+  // directly into this MeshBlock's arrays at pack time, and Z4c coarse-data regions
+  // appear as their own entries), so each team just executes one block copy.
+  Kokkos::TeamPolicy<> policy(DevExeSpace(), (nxfer_recv*nvar), Kokkos::AUTO);
   Kokkos::parallel_for("RecvBuff", policy, KOKKOS_LAMBDA(TeamMember_t tmember) {
-    const int m = (tmember.league_rank())/(nnghbr*nvar);
-    const int n = (tmember.league_rank() - m*(nnghbr*nvar))/nvar;
-    const int v = (tmember.league_rank() - m*(nnghbr*nvar) - n*nvar);
-
-    // only unpack buffers when neighbor exists
-    if (nghbr.d_view(m,n).gid >= 0) {
-      int il, iu, jl, ju, kl, ku;
-      // if neighbor is at coarser level, use coar indices to unpack buffer
-      if (nghbr.d_view(m,n).lev < mblev.d_view(m)) {
-        il = rbuf[n].icoar[0].bis;
-        iu = rbuf[n].icoar[0].bie;
-        jl = rbuf[n].icoar[0].bjs;
-        ju = rbuf[n].icoar[0].bje;
-        kl = rbuf[n].icoar[0].bks;
-        ku = rbuf[n].icoar[0].bke;
-      // if neighbor is at same level, use same indices to unpack buffer
-      } else if (nghbr.d_view(m,n).lev == mblev.d_view(m)) {
-        il = rbuf[n].isame[0].bis;
-        iu = rbuf[n].isame[0].bie;
-        jl = rbuf[n].isame[0].bjs;
-        ju = rbuf[n].isame[0].bje;
-        kl = rbuf[n].isame[0].bks;
-        ku = rbuf[n].isame[0].bke;
-      // if neighbor is at finer level, use fine indices to unpack buffer
+    const int e = (tmember.league_rank())/nvar;
+    const int v = (tmember.league_rank() - e*nvar);
+    TransferRegion t = xfer.d_view(e);
+
+    const int m = t.m, n = t.n;
+    const int il = t.il, iu = t.iu, jl = t.jl, kl = t.kl;
+    const int ni = t.iu - t.il + 1;
+    const int nj = t.ju - t.jl + 1;
+    const int nk = t.ku - t.kl + 1;
+    const int nkj = nk*nj;
+
+    // Middle loop over k,j
+    Kokkos::parallel_for(Kokkos::TeamThreadRange<>(tmember, nkj), [&](const int idx) {
+      int k = idx / nj;
+      int j = (idx - k * nj) + jl;
+      k += kl;
+
+      // Inner (vector) loop over i: unpack into u0 or coarse_u0
+      if (t.mode == xfer_unpack) {
+        Kokkos::parallel_for(Kokkos::ThreadVectorRange(tmember,il,iu+1),
+        [&](const int i) {
+          a(m,v,k,j,i) = rbuf[n].vars(m, t.offset + (i-il + ni*(j-jl + nj*(k-kl+nk*v))));
+        });
       } else {
-        il = rbuf[n].ifine[0].bis;
-        iu = rbuf[n].ifine[0].bie;
-        jl = rbuf[n].ifine[0].bjs;
-        ju = rbuf[n].ifine[0].bje;
-        kl = rbuf[n].ifine[0].bks;
-        ku = rbuf[n].ifine[0].bke;
+        Kokkos::parallel_for(Kokkos::ThreadVectorRange(tmember,il,iu+1),
+        [&](const int i) {
+          ca(m,v,k,j,i) = rbuf[n].vars(m, t.offset + (i-il + ni*(j-jl + nj*(k-kl+nk*v))));
+        });
       }
-      int ni = iu - il + 1;
-      int nj = ju - jl + 1;
-      int nk = ku - kl + 1;
-      int nkj  = nk*nj;
-
-      // Middle loop over k,j
-      Kokkos::parallel_for(Kokkos::TeamThreadRange<>(tmember, nkj), [&](const int idx) {
-        int k = idx / nj;
-        int j = (idx - k * nj) + jl;
-        k += kl;
-
-        // if neighbor is at same or finer level, load data directly into u0
-        if (nghbr.d_view(m,n).lev >= mblev.d_view(m)) {
-          Kokkos::parallel_for(Kokkos::ThreadVectorRange(tmember,il,iu+1),
-          [&](const int i) {
-            a(m,v,k,j,i) = rbuf[n].vars(m, (i-il + ni*(j-jl + nj*(k-kl + nk*v))) );
-          });
-          tmember.team_barrier();
-
-        // if neighbor is at coarser level, load data into coarse_u0
-        } else {
-          Kokkos::parallel_for(Kokkos::ThreadVectorRange(tmember,il,iu+1),
-          [&](const int i) {
-            ca(m,v,k,j,i) = rbuf[n].vars(m, (i-il + ni*(j-jl + nj*(k-kl + nk*v))) );
-          });
-          tmember.team_barrier();
-        }
-      });
-    }  // end if-neighbor-exists block
+      tmember.team_barrier();
+    });
   });  // end par_for_outer
 
-  // Outer loop over (# of MeshBlocks)*(# of buffers)*(# of variables)
-  Kokkos::parallel_for("RecvBuff", policy, KOKKOS_LAMBDA(TeamMember_t tmember) {
-    const int m = (tmember.league_rank())/(nnghbr*nvar);
-    const int n = (tmember.league_rank() - m*(nnghbr*nvar))/nvar;
-    const int v = (tmember.league_rank() - m*(nnghbr*nvar) - n*nvar);
-    // only unpack buffers when neighbor exists
-    if (nghbr.d_view(m,n).gid >= 0) {
-      int il, iu, jl, ju, kl, ku;
-      // If neighbor is at same level and data is for Z4c module, unpack data from coarse
-      // array for higher-order prolongation
-      if ((nghbr.d_view(m,n).lev == mblev.d_view(m)) && (is_z4c) && (multilevel)) {
-        il = rbuf[n].isame_z4c.bis;
-        iu = rbuf[n].isame_z4c.bie;
-        jl = rbuf[n].isame_z4c.bjs;
-        ju = rbuf[n].isame_z4c.bje;
-        kl = rbuf[n].isame_z4c.bks;
-        ku = rbuf[n].isame_z4c.bke;
-        int ni = iu - il + 1;
-        int nj = ju - jl + 1;
-        int nk = ku - kl + 1;
-        int nkj  = nk*nj;
-        int ndat = nvar*rbuf[n].isame_ndat; // size of same level data packed in buff
-
-        // Middle loop over k,j
-        Kokkos::parallel_for(Kokkos::TeamThreadRange<>(tmember, nkj), [&](const int idx) {
-          int k = idx / nj;
-          int j = (idx - k * nj) + jl;
-          k += kl;
+  return TaskStatus::complete;
+}
 
-          // load data into coarse_u0
-          Kokkos::parallel_for(Kokkos::ThreadVectorRange(tmember,il,iu+1),
-          [&](const int i) {
-            ca(m,v,k,j,i) = rbuf[n].vars(m,ndat + (i-il + ni*(j-jl + nj*(k-kl + nk*v))) );
-          });
-          tmember.team_barrier();
+//----------------------------------------------------------------------------------------
+//! \fn void MeshBoundaryValuesCC::RecvAndUnpackCC()
+//! \brief Fused variant of RecvAndUnpackCC() that unpacks TWO sets of cell-centered
+//! variables (e.g. the ion and neutral fluids in two-fluid MHD) from the same boundary
+//! buffers, matching the fused PackAndSendCC() above.  Variables of the first array
+//! occupy slots [0,nv1) of each buffer and those of the second occupy [nv1,nvar).
+//! Never used by the Z4c module, so the same-level coarse-data unpack is omitted.
+
+TaskStatus MeshBoundaryValuesCC::RecvAndUnpackCC(DvceArray5D<Real> &a,
+                                                 DvceArray5D<Real> &ca,
+                                                 DvceArray5D<Real> &a2,
+                                                 DvceArray5D<Real> &ca2) {
+  // rebuild cached transfer tables if neighbor connectivity has changed
+  if (xfer_stale) {InitTransferRegions();}
+
+  // create local references for variables in kernel
+  auto &rbuf = recvbuf;
+#if MPI_PARALLEL_ENABLED
+  //----- STEP 1: check that recv boundary buffer communications have all completed
+
+  // with coalesced comm, test per-rank messages and scatter back into recv buffers
+  if (coalesced_comm) {
+    TaskStatus tstat = RecvCoalescedAndScatter();
+    if (tstat == TaskStatus::incomplete) {return tstat;}
+  } else {
+    // test receives progressively, staging each buffer to device as soon as it arrives
+    if (!(TestAndStageRecvs())) {return TaskStatus::incomplete;}
+  }
+#endif
+
+  //----- STEP 2: buffers have all completed, so unpack
+
+  int nv1 = a.extent_int(1);
+  int nvar = nv1 + a2.extent_int(1);
+  auto &xfer = xfer_recv;
+
+  // Outer loop over (# of cached transfer regions)*(# of fused variables).  The table
+  // only holds transfers that need unpacking (same-rank same-level neighbors were
+  // copied directly into this MeshBlock's arrays at pack time).
+  Kokkos::TeamPolicy<> policy(DevExeSpace(), (nxfer_recv*nvar), Kokkos::AUTO);
+  Kokkos::parallel_for("RecvBuff", policy, KOKKOS_LAMBDA(TeamMember_t tmember) {
+    const int e = (tmember.league_rank())/nvar;
+    const int v = (tmember.league_rank() - e*nvar);
+    TransferRegion t = xfer.d_view(e);
+
+    const int m = t.m, n = t.n;
+    const int il = t.il, iu = t.iu, jl = t.jl, kl = t.kl;
+    const int ni = t.iu - t.il + 1;
+    const int nj = t.ju - t.jl + 1;
+    const int nk = t.ku - t.kl + 1;
+    const int nkj = nk*nj;
+
+    // select fluid by position in the fused variable list; buffer offsets below keep
+    // using the fused index v since both fluids occupy disjoint slots
+    const DvceArray5D<Real> &av = (v < nv1)? a : a2;
+    const DvceArray5D<Real> &cav = (v < nv1)? ca : ca2;
+    const int vf = (v < nv1)? v : (v - nv1);
+
+    // Middle loop over k,j
+    Kokkos::parallel_for(Kokkos::TeamThreadRange<>(tmember, nkj), [&](const int idx) {
+      int k = idx / nj;
+      int j = (idx - k * nj) + jl;
+      k += kl;
+
+      // Inner (vector) loop over i: unpack into u0 or coarse_u0
+      if (t.mode == xfer_unpack) {
+        Kokkos::parallel_for(Kokkos::ThreadVectorRange(tmember,il,iu+1),
+        [&](const int i) {
+          av(m,vf,k,j,i) = rbuf[n].vars(m, (i-il + ni*(j-jl + nj*(k-kl + nk*v))) );
+        });
+      } else {
+        Kokkos::parallel_for(Kokkos::ThreadVectorRange(tmember,il,iu+1),
+        [&](const int i) {
+          cav(m,vf,k,j,i) = rbuf[n].vars(m, (i-il + ni*(j-jl + nj*(k-kl + nk*v))) );
         });
       }
-    }  // end if-neighbor-exists block
+      tmember.team_barrier();
+    });
   });  // end par_for_outer
 
   return TaskStatus::complete;
@@ -39,18 +39,20 @@ MeshBoundaryValuesFC::MeshBoundaryValuesFC(MeshBlockPack *pp, ParameterInput *pi
 
 TaskStatus MeshBoundaryValuesFC::PackAndSendFC(DvceFaceFld4D<Real> &b,
                                                DvceFaceFld4D<Real> &cb) {
+  // rebuild cached transfer tables if neighbor connectivity has changed
+  if (xfer_stale) {InitTransferRegions();}
+
   // create local references for variables in kernel
   int nmb = pmy_pack->nmb_thispack;
   int nnghbr = pmy_pack->pmb->nnghbr;
 
-  {int my_rank = global_variable::my_rank;
-  auto &nghbr = pmy_pack->pmb->nghbr;
-  auto &mbgid = pmy_pack->pmb->mb_gid;
-  auto &mblev = pmy_pack->pmb->mb_lev;
-  auto &sbuf = sendbuf;
+  {auto &sbuf = sendbuf;
   auto &rbuf = recvbuf;
+  auto &xfer = xfer_send;
 
-  // Outer loop over (# of MeshBlocks)*(# of buffers)*(three field components)
+  // Outer loop over (# of MeshBlocks)*(three field components).  All per-neighbor
+  // logic (existence, rank, relative level, per-component ranges and buffer offsets)
+  // was resolved when the table was built, so each transfer is just a block copy.
   int nmnv = 3*nmb;
   Kokkos::TeamPolicy<> policy(DevExeSpace(), nmnv, Kokkos::AUTO);
   Kokkos::parallel_for("SendBuff", policy, KOKKOS_LAMBDA(TeamMember_t tmember) {
@@ -59,174 +61,57 @@ TaskStatus MeshBoundaryValuesFC::PackAndSendFC(DvceFaceFld4D<Real> &b,
 
     // scalar loop over neighbors to prevent race condition in overlapping assignments
     for (int n=0; n<nnghbr; ++n) {
-      // only load buffers when neighbor exists
-      if (nghbr.d_view(m,n).gid >= 0) {
-        // if neighbor is at coarser level, use cindices to pack buffer
-        // Note indices can be different for each component of face-centered field.
-        int il, iu, jl, ju, kl, ku, ndat;
-        if (nghbr.d_view(m,n).lev < mblev.d_view(m)) {
-          il = sbuf[n].icoar[v].bis;
-          iu = sbuf[n].icoar[v].bie;
-          jl = sbuf[n].icoar[v].bjs;
-          ju = sbuf[n].icoar[v].bje;
-          kl = sbuf[n].icoar[v].bks;
-          ku = sbuf[n].icoar[v].bke;
-          ndat = sbuf[n].icoar_ndat;
-        // if neighbor is at same level, use sindices to pack buffer
-        } else if (nghbr.d_view(m,n).lev == mblev.d_view(m)) {
-          il = sbuf[n].isame[v].bis;
-          iu = sbuf[n].isame[v].bie;
-          jl = sbuf[n].isame[v].bjs;
-          ju = sbuf[n].isame[v].bje;
-          kl = sbuf[n].isame[v].bks;
-          ku = sbuf[n].isame[v].bke;
-          ndat = sbuf[n].isame_ndat;
-        // if neighbor is at finer level, use findices to pack buffer
-        } else {
-          il = sbuf[n].ifine[v].bis;
-          iu = sbuf[n].ifine[v].bie;
-          jl = sbuf[n].ifine[v].bjs;
-          ju = sbuf[n].ifine[v].bje;
-          kl = sbuf[n].ifine[v].bks;
-          ku = sbuf[n].ifine[v].bke;
-          ndat = sbuf[n].ifine_ndat;
-        }
-        const int ni = iu - il + 1;
-        const int nj = ju - jl + 1;
-        const int nk = ku - kl + 1;
+      TransferRegion t = xfer.d_view((m*nnghbr + n)*3 + v);
+      if (t.mode != xfer_none) {
+        const int il = t.il, jl = t.jl, kl = t.kl;
+        const int ni = t.iu - t.il + 1;
+        const int nj = t.ju - t.jl + 1;
+        const int nk = t.ku - t.kl + 1;
         const int nkji = nk*nj*ni;
         const int nji  = nj*ni;
-
-        // indices of recv'ing MB and buffer: assumes MB IDs are stored sequentially
-        int dm = nghbr.d_view(m,n).gid - mbgid.d_view(0);
-        int dn = nghbr.d_view(m,n).dest;
-
-        // copy field components directly into recv buffer if MeshBlocks on same rank
-        if (nghbr.d_view(m,n).rank == my_rank) {
-          // if neighbor is at same or finer level, load data from b0
-          if (nghbr.d_view(m,n).lev >= mblev.d_view(m)) {
-            Kokkos::parallel_for(Kokkos::TeamThreadRange<>(tmember, nkji),
-            [&](const int idx) {
-              int k = (idx)/nji;
-              int j = (idx - k*nji)/ni;
-              int i = (idx - k*nji - j*ni) + il;
-              k += kl;
-              j += jl;
-              if (v==0) {
-                rbuf[dn].vars(dm,i-il + ni*(j-jl + nj*(k-kl))) = b.x1f(m,k,j,i);
-              } else if (v==1) {
-                rbuf[dn].vars(dm,ndat*v + i-il + ni*(j-jl + nj*(k-kl))) = b.x2f(m,k,j,i);
-              } else if (v==2) {
-                rbuf[dn].vars(dm,ndat*v + i-il + ni*(j-jl + nj*(k-kl))) = b.x3f(m,k,j,i);
-              }
-            });
-            tmember.team_barrier();
-          // if neighbor is at coarser level, load data from coarse_b0
+        const bool coar = (t.mode == xfer_stage_coar) || (t.mode == xfer_send_coar);
+        const bool stage = (t.mode == xfer_stage) || (t.mode == xfer_stage_coar);
+
+        Kokkos::parallel_for(Kokkos::TeamThreadRange<>(tmember, nkji),
+        [&](const int idx) {
+          int k = (idx)/nji;
+          int j = (idx - k*nji)/ni;
+          int i = (idx - k*nji - j*ni) + il;
+          k += kl;
+          j += jl;
+          // load component of b0 (or coarse_b0 when neighbor is at coarser level)
+          Real val;
+          if (coar) {
+            val = (v==0)? cb.x1f(m,k,j,i) : ((v==1)? cb.x2f(m,k,j,i) : cb.x3f(m,k,j,i));
           } else {
-            Kokkos::parallel_for(Kokkos::TeamThreadRange<>(tmember, nkji),
-            [&](const int idx) {
-              int k = (idx)/nji;
-              int j = (idx - k*nji)/ni;
-              int i = (idx - k*nji - j*ni) + il;
-              k += kl;
-              j += jl;
-              if (v==0) {
-                rbuf[dn].vars(dm,i-il + ni*(j-jl + nj*(k-kl))) = cb.x1f(m,k,j,i);
-              } else if (v==1) {
-                rbuf[dn].vars(dm,ndat*v + i-il + ni*(j-jl + nj*(k-kl))) = cb.x2f(m,k,j,i);
-              } else if (v==2) {
-                rbuf[dn].vars(dm,ndat*v + i-il + ni*(j-jl + nj*(k-kl))) = cb.x3f(m,k,j,i);
-              }
-            });
-            tmember.team_barrier();
+            val = (v==0)? b.x1f(m,k,j,i) : ((v==1)? b.x2f(m,k,j,i) : b.x3f(m,k,j,i));
           }
-
-        // else copy field components into send buffer for MPI communication below
-        } else {
-          // if neighbor is at same or finer level, load data from b0
-          if (nghbr.d_view(m,n).lev >= mblev.d_view(m)) {
-            Kokkos::parallel_for(Kokkos::TeamThreadRange<>(tmember, nkji),
-            [&](const int idx) {
-              int k = (idx)/nji;
-              int j = (idx - k*nji)/ni;
-              int i = (idx - k*nji - j*ni) + il;
-              k += kl;
-              j += jl;
-              if (v==0) {
-                sbuf[n].vars(m,i-il + ni*(j-jl + nj*(k-kl))) = b.x1f(m,k,j,i);
-              } else if (v==1) {
-                sbuf[n].vars(m,ndat*v + i-il + ni*(j-jl + nj*(k-kl))) = b.x2f(m,k,j,i);
-              } else if (v==2) {
-                sbuf[n].vars(m,ndat*v + i-il + ni*(j-jl + nj*(k-kl))) = b.x3f(m,k,j,i);
-              }
-            });
-            tmember.team_barrier();
-          // if neighbor is at coarser level, load data from coarse_b0
+          // copy directly into recv buffer if MeshBlocks on same rank, else into send
+          // buffer for MPI communication below
+          if (stage) {
+            rbuf[t.dn].vars(t.dm, t.offset + i-il + ni*(j-jl + nj*(k-kl))) = val;
           } else {
-            Kokkos::parallel_for(Kokkos::TeamThreadRange<>(tmember, nkji),
-            [&](const int idx) {
-              int k = (idx)/nji;
-              int j = (idx - k*nji)/ni;
-              int i = (idx - k*nji - j*ni) + il;
-              k += kl;
-              j += jl;
-              if (v==0) {
-                sbuf[n].vars(m,i-il + ni*(j-jl + nj*(k-kl))) = cb.x1f(m,k,j,i);
-              } else if (v==1) {
-                sbuf[n].vars(m,ndat*v + i-il + ni*(j-jl + nj*(k-kl))) = cb.x2f(m,k,j,i);
-              } else if (v==2) {
-                sbuf[n].vars(m,ndat*v + i-il + ni*(j-jl + nj*(k-kl))) = cb.x3f(m,k,j,i);
-              }
-            });
-            tmember.team_barrier();
+            sbuf[n].vars(m, t.offset + i-il + ni*(j-jl + nj*(k-kl))) = val;
           }
-        }
+        });
+        tmember.team_barrier();
       } // end if-neighbor-exists block
     }
   }); // end par_for_outer
   }
 
 #if MPI_PARALLEL_ENABLED
-  // Send boundary buffer to neighboring MeshBlocks using MPI
-  Kokkos::fence();
-  int my_rank = global_variable::my_rank;
-  auto &nghbr = pmy_pack->pmb->nghbr;
-  bool no_errors=true;
-  for (int m=0; m<nmb; ++m) {
-    for (int n=0; n<nnghbr; ++n) {
-      if (nghbr.h_view(m,n).gid >= 0) {  // neighbor exists and not a physical boundary
-        // index and rank of destination Neighbor
-        int dn = nghbr.h_view(m,n).dest;
-        int drank = nghbr.h_view(m,n).rank;
-        if (drank != my_rank) {
-          // create tag using local ID and buffer index of *receiving* MeshBlock
-          int lid = nghbr.h_view(m,n).gid - pmy_pack->pmesh->gids_eachrank[drank];
-          int tag = CreateBvals_MPI_Tag(lid, dn);
-
-          // get ptr to send buffer when neighbor is at coarser/same/fine level
-          int data_size = 3;
-          if ( nghbr.h_view(m,n).lev < pmy_pack->pmb->mb_lev.h_view(m) ) {
-            data_size *= sendbuf[n].icoar_ndat;
-          } else if ( nghbr.h_view(m,n).lev == pmy_pack->pmb->mb_lev.h_view(m) ) {
-            data_size *= sendbuf[n].isame_ndat;
-          } else {
-            data_size *= sendbuf[n].ifine_ndat;
-          }
-          auto send_ptr = Kokkos::subview(sendbuf[n].vars, m, Kokkos::ALL);
-
-          int ierr = MPI_Isend(send_ptr.data(), data_size, MPI_ATHENA_REAL, drank, tag,
-                               comm_vars, &(sendbuf[n].vars_req[m]));
-          if (ierr != MPI_SUCCESS) {no_errors=false;}
-        }
-      }
-    }
-  }
-  // Quit if MPI error detected
-  if (!(no_errors)) {
-    std::cout << "### FATAL ERROR in " << __FILE__ << " at line " << __LINE__
-       << std::endl << "MPI error in posting sends" << std::endl;
-    std::exit(EXIT_FAILURE);
+  // with coalesced comm, gather buffers into per-rank messages, one send per rank
+  if (coalesced_comm) {
+    PackAndSendCoalesced();
+    return TaskStatus::complete;
   }
+
+  // Start persistent sends of boundary buffers to neighboring MeshBlocks.  Tags, sizes,
+  // and buffer locations are fixed between remeshing events, so they are set once in
+  // InitPersistentRequests() rather than recomputed every stage.
+  Kokkos::fence();
+  StartPersistentSends();
 #endif
   return TaskStatus::complete;
 }
@@ -237,45 +122,31 @@ TaskStatus MeshBoundaryValuesFC::PackAndSendFC(DvceFaceFld4D<Real> &b,
 
 TaskStatus MeshBoundaryValuesFC::RecvAndUnpackFC(DvceFaceFld4D<Real> &b,
                                                  DvceFaceFld4D<Real> &cb) {
+  // rebuild cached transfer tables if neighbor connectivity has changed
+  if (xfer_stale) {InitTransferRegions();}
+
   // create local references for variables in kernel
   int nmb = pmy_pack->nmb_thispack;
   int nnghbr = pmy_pack->pmb->nnghbr;
-  auto &nghbr = pmy_pack->pmb->nghbr;
   auto &rbuf = recvbuf;
 #if MPI_PARALLEL_ENABLED
   //----- STEP 1: check that recv boundary buffer communications have all completed
 
-  bool bflag = false;
-  bool no_errors=true;
-  for (int m=0; m<nmb; ++m) {
-    for (int n=0; n<nnghbr; ++n) {
-      if (nghbr.h_view(m,n).gid >= 0) { // ID != -1, so not a physical boundary
-        if (nghbr.h_view(m,n).rank != global_variable::my_rank) {
-          int test;
-          int ierr = MPI_Test(&(rbuf[n].vars_req[m]), &test, MPI_STATUS_IGNORE);
-          if (ierr != MPI_SUCCESS) {no_errors=false;}
-          if (!(static_cast<bool>(test))) {
-            bflag = true;
-          }
-        }
-      }
-    }
-  }
-  // Quit if MPI error detected
-  if (!(no_errors)) {
-    std::cout << "### FATAL ERROR in " << __FILE__ << " at line " << __LINE__
-              << std::endl << "MPI error in testing non-blocking receives"
-              << std::endl;
-    std::exit(EXIT_FAILURE);
+  // with coalesced comm, test per-rank messages and scatter back into recv buffers
+  if (coalesced_comm) {
+    TaskStatus tstat = RecvCoalescedAndScatter();
+    if (tstat == TaskStatus::incomplete) {return tstat;}
+  } else {
+    // test receives progressively, staging each buffer to device as soon as it arrives
+    if (!(TestAndStageRecvs())) {return TaskStatus::incomplete;}
   }
-  // exit if recv boundary buffer communications have not completed
-  if (bflag) {return TaskStatus::incomplete;}
 #endif
 
   //----- STEP 2: buffers have all completed, so unpack 3-components of field
 
-  auto &mblev = pmy_pack->pmb->mb_lev;
-  // Outer loop over (# of MeshBlocks)*(# of buffers)*(three field components)
+  auto &xfer = xfer_recv;
+  // Outer loop over (# of MeshBlocks)*(three field components).  Per-neighbor index
+  // ranges and buffer offsets were resolved when the table was built.
   Kokkos::TeamPolicy<> policy(DevExeSpace(), (3*nmb), Kokkos::AUTO);
   Kokkos::parallel_for("RecvBuff", policy, KOKKOS_LAMBDA(TeamMember_t tmember) {
     const int m = tmember.league_rank()/3;
@@ -283,80 +154,44 @@ TaskStatus MeshBoundaryValuesFC::RecvAndUnpackFC(DvceFaceFld4D<Real> &b,
 
     // scalar loop over neighbors to prevent race condition in overlapping assignments
     for (int n=0; n<nnghbr; ++n) {
-      // only unpack buffers when neighbor exists
-      if (nghbr.d_view(m,n).gid >= 0) {
-        // if neighbor is at coarser level, use cindices to unpack buffer
-        int il, iu, jl, ju, kl, ku, ndat;
-        if (nghbr.d_view(m,n).lev < mblev.d_view(m)) {
-          il = rbuf[n].icoar[v].bis;
-          iu = rbuf[n].icoar[v].bie;
-          jl = rbuf[n].icoar[v].bjs;
-          ju = rbuf[n].icoar[v].bje;
-          kl = rbuf[n].icoar[v].bks;
-          ku = rbuf[n].icoar[v].bke;
-          ndat = rbuf[n].icoar_ndat;
-        // if neighbor is at same level, use sindices to unpack buffer
-        } else if (nghbr.d_view(m,n).lev == mblev.d_view(m)) {
-          il = rbuf[n].isame[v].bis;
-          iu = rbuf[n].isame[v].bie;
-          jl = rbuf[n].isame[v].bjs;
-          ju = rbuf[n].isame[v].bje;
-          kl = rbuf[n].isame[v].bks;
-          ku = rbuf[n].isame[v].bke;
-          ndat = rbuf[n].isame_ndat;
-        // if neighbor is at finer level, use findices to unpack buffer
-        } else {
-          il = rbuf[n].ifine[v].bis;
-          iu = rbuf[n].ifine[v].bie;
-          jl = rbuf[n].ifine[v].bjs;
-          ju = rbuf[n].ifine[v].bje;
-          kl = rbuf[n].ifine[v].bks;
-          ku = rbuf[n].ifine[v].bke;
-          ndat = rbuf[n].ifine_ndat;
-        }
-        const int ni = iu - il + 1;
-        const int nj = ju - jl + 1;
-        const int nk = ku - kl + 1;
+      TransferRegion t = xfer.d_view((m*nnghbr + n)*3 + v);
+      if (t.mode != xfer_none) {
+        const int il = t.il, jl = t.jl, kl = t.kl;
+        const int ni = t.iu - t.il + 1;
+        const int nj = t.ju - t.jl + 1;
+        const int nk = t.ku - t.kl + 1;
         const int nkji = nk*nj*ni;
         const int nji  = nj*ni;
-
-        // if neighbor is at same or finer level, load data directly into b0
-        if (nghbr.d_view(m,n).lev >= mblev.d_view(m)) {
-          Kokkos::parallel_for(Kokkos::TeamThreadRange<>(tmember, nkji),
-          [&](const int idx) {
-            int k = (idx)/nji;
-            int j = (idx - k*nji)/ni;
-            int i = (idx - k*nji - j*ni) + il;
-            k += kl;
-            j += jl;
+        const bool coar = (t.mode == xfer_unpack_coar);
+
+        Kokkos::parallel_for(Kokkos::TeamThreadRange<>(tmember, nkji),
+        [&](const int idx) {
+          int k = (idx)/nji;
+          int j = (idx - k*nji)/ni;
+          int i = (idx - k*nji - j*ni) + il;
+          k += kl;
+          j += jl;
+          Real val = rbuf[n].vars(m, t.offset + i-il + ni*(j-jl + nj*(k-kl)));
+          // load data into b0 (or coarse_b0 when neighbor is at coarser level)
+          if (coar) {
             if (v==0) {
-              b.x1f(m,k,j,i) = rbuf[n].vars(m,i-il + ni*(j-jl + nj*(k-kl)));
+              cb.x1f(m,k,j,i) = val;
             } else if (v==1) {
-              b.x2f(m,k,j,i) = rbuf[n].vars(m,ndat*v + i-il + ni*(j-jl + nj*(k-kl)));
-            } else if (v==2) {
-              b.x3f(m,k,j,i) = rbuf[n].vars(m,ndat*v + i-il + ni*(j-jl + nj*(k-kl)));
+              cb.x2f(m,k,j,i) = val;
+            } else {
+              cb.x3f(m,k,j,i) = val;
             }
-          });
-          tmember.team_barrier();
-        // if neighbor is at coarser level, load data into coarse_b0
-        } else {
-          Kokkos::parallel_for(Kokkos::TeamThreadRange<>(tmember, nkji),
-          [&](const int idx) {
-            int k = (idx)/nji;
-            int j = (idx - k*nji)/ni;
-            int i = (idx - k*nji - j*ni) + il;
-            k += kl;
-            j += jl;
+          } else {
             if (v==0) {
-              cb.x1f(m,k,j,i) = rbuf[n].vars(m,i-il + ni*(j-jl + nj*(k-kl)));
+              b.x1f(m,k,j,i) = val;
             } else if (v==1) {
-              cb.x2f(m,k,j,i) = rbuf[n].vars(m,ndat*v + i-il + ni*(j-jl + nj*(k-kl)));
-            } else if (v==2) {
-              cb.x3f(m,k,j,i) = rbuf[n].vars(m,ndat*v + i-il + ni*(j-jl + nj*(k-kl)));
+              b.x2f(m,k,j,i) = val;
+            } else {
+              b.x3f(m,k,j,i) = val;
             }
-          });
-          tmember.team_barrier();
-        }
+          }
+        });
+        tmember.team_barrier();
       }  // end if-neighbor-exists block
     }
   });  // end par_for_outer
@@ -10,9 +10,7 @@
 #include <iostream>
 #include <utility>
 #include <vector>
-#include <algorithm>
 #include <Kokkos_Core.hpp>
-#include <Kokkos_StdAlgorithms.hpp>
 
 #include "athena.hpp"
 #include "globals.hpp"
@@ -26,19 +24,18 @@ namespace particles {
 //----------------------------------------------------------------------------------------
 //! \fn void ParticlesBoundaryValues::UpdateGID()
 //! \brief Updates GID of particles that cross boundary of their parent MeshBlock.  If
-//! the new GID is on a different rank, then store in sendlist_buf DvceArray: (1) index of
+//! the new GID is on a different rank, then record in the caller's entry: (1) index of
 //! particle in prtcl array, (2) destination GID, and (3) destination rank.
 
 KOKKOS_INLINE_FUNCTION
-void UpdateGID(int &newgid, NeighborBlock nghbr, int myrank, int *pcounter,
-               DualArray1D<ParticleLocationData> slist, int p) {
+void UpdateGID(int &newgid, NeighborBlock nghbr, int myrank,
+               ParticleLocationData &entry, int p) {
   newgid = nghbr.gid;
 #if MPI_PARALLEL_ENABLED
   if (nghbr.rank != myrank) {
-    int index = Kokkos::atomic_fetch_add(pcounter,1);
-    slist.d_view(index).prtcl_indx = p;
-    slist.d_view(index).dest_gid   = nghbr.gid;
-    slist.d_view(index).dest_rank  = nghbr.rank;
+    entry.prtcl_indx = p;
+    entry.dest_gid   = nghbr.gid;
+    entry.dest_rank  = nghbr.rank;
   }
 #endif
   return;
@@ -60,117 +57,179 @@ TaskStatus ParticlesBoundaryValues::SetNewPrtclGID() {
   auto myrank = global_variable::my_rank;
   auto &nghbr = pmy_part->pmy_pack->pmb->nghbr;
   auto &psendl = sendlist;
-  int counter=0;
-  int *pcounter = &counter;
   bool &multi_d = pmy_part->pmy_pack->pmesh->multi_d;
   bool &three_d = pmy_part->pmy_pack->pmesh->three_d;
 
   Kokkos::realloc(sendlist, static_cast<int>(0.1*npart));
-  par_for("part_update",DevExeSpace(),0,(npart-1), KOKKOS_LAMBDA(const int p) {
-    int m = pi(PGID,p) - gids;
-    int mylevel = mblev.d_view(m);
-    Real x1 = pr(IPX,p);
-    Real x2 = pr(IPY,p);
-    Real x3 = pr(IPZ,p);
-
-    // length of MeshBlock in each direction
-    Real lx = (mbsize.d_view(m).x1max - mbsize.d_view(m).x1min);
-    Real ly = (mbsize.d_view(m).x2max - mbsize.d_view(m).x2min);
-    Real lz = (mbsize.d_view(m).x3max - mbsize.d_view(m).x3min);
-
-    // integer offset of particle relative to center of MeshBlock (-1,0,+1)
-    int ix = static_cast<int>((x1 - mbsize.d_view(m).x1min + lx)/lx) - 1;
-    int iy = static_cast<int>((x2 - mbsize.d_view(m).x2min + ly)/ly) - 1;
-    int iz = static_cast<int>((x3 - mbsize.d_view(m).x3min + lz)/lz) - 1;
-
-    // sublock indices for faces and edges with S/AMR
-    int fx = (x1 < 0.5*(mbsize.d_view(m).x1min + mbsize.d_view(m).x1max))? 0 : 1;
-    int fy = (x2 < 0.5*(mbsize.d_view(m).x2min + mbsize.d_view(m).x2max))? 0 : 1;
-    int fz = (x3 < 0.5*(mbsize.d_view(m).x3min + mbsize.d_view(m).x3max))? 0 : 1;
-    fy = multi_d ? fy : 0;
-    fz = three_d ? fz : 0;
-
-    // only update particle GID if it has crossed MeshBlock boundary
-    if ((abs(ix) + abs(iy) + abs(iz)) != 0) {
-      if (iz == 0) {
-        if (iy == 0) {
-          // x1 face
-          int indx = NeighborIndex(ix,0,0,0,0);           // neighbor at same level
-          if (nghbr.d_view(m,indx).lev > mylevel) {       // neighbor at finer level
-            indx = NeighborIndex(ix,0,0,fy,fz);
+
+  // Slots in sendlist are reserved with a two-level (team, global) counter hierarchy:
+  // migrants are assigned compact offsets within their team by a team-level scan, and
+  // one thread per team reserves a contiguous block of slots with a single global
+  // atomic.  This avoids serializing every thread on one counter when a burst of
+  // particles (e.g. a shock front) crosses a MeshBlock face in the same step.
+  const int chunk = 128;   // number of particles processed per team
+  int nteam = (npart + chunk - 1)/chunk;
+  DvceArray1D<int> ncnt("pmig_ncnt", 1);
+  Kokkos::deep_copy(ncnt, 0);
+
+  int scr_level = 0;
+  size_t scr_size = ScrArray1D<ParticleLocationData>::shmem_size(chunk) +
+                    ScrArray1D<int>::shmem_size(chunk);
+  Kokkos::TeamPolicy<> policy(DevExeSpace(), nteam, Kokkos::AUTO);
+  policy.set_scratch_size(scr_level, Kokkos::PerTeam(scr_size));
+  Kokkos::parallel_for("part_update", policy, KOKKOS_LAMBDA(TeamMember_t member) {
+    ScrArray1D<ParticleLocationData> entry(member.team_scratch(scr_level), chunk);
+    ScrArray1D<int> offset(member.team_scratch(scr_level), chunk);
+    const int pstart = member.league_rank()*chunk;
+    const int nthis = (pstart + chunk <= npart)? chunk : (npart - pstart);
+
+    // locate each particle relative to its parent MeshBlock, update the GID of any that
+    // crossed a boundary, and record migrants (particles bound for another rank)
+    Kokkos::parallel_for(Kokkos::TeamThreadRange(member, nthis), [&](const int t) {
+      const int p = pstart + t;
+      entry(t).prtcl_indx = -1;  // sentinel; set >= 0 by UpdateGID() for migrants
+      int m = pi(PGID,p) - gids;
+      int mylevel = mblev.d_view(m);
+      Real x1 = pr(IPX,p);
+      Real x2 = pr(IPY,p);
+      Real x3 = pr(IPZ,p);
+
+      // length of MeshBlock in each direction
+      Real lx = (mbsize.d_view(m).x1max - mbsize.d_view(m).x1min);
+      Real ly = (mbsize.d_view(m).x2max - mbsize.d_view(m).x2min);
+      Real lz = (mbsize.d_view(m).x3max - mbsize.d_view(m).x3min);
+
+      // integer offset of particle relative to center of MeshBlock (-1,0,+1)
+      int ix = static_cast<int>((x1 - mbsize.d_view(m).x1min + lx)/lx) - 1;
+      int iy = static_cast<int>((x2 - mbsize.d_view(m).x2min + ly)/ly) - 1;
+      int iz = static_cast<int>((x3 - mbsize.d_view(m).x3min + lz)/lz) - 1;
+
+      // sublock indices for faces and edges with S/AMR
+      int fx = (x1 < 0.5*(mbsize.d_view(m).x1min + mbsize.d_view(m).x1max))? 0 : 1;
+      int fy = (x2 < 0.5*(mbsize.d_view(m).x2min + mbsize.d_view(m).x2max))? 0 : 1;
+      int fz = (x3 < 0.5*(mbsize.d_view(m).x3min + mbsize.d_view(m).x3max))? 0 : 1;
+      fy = multi_d ? fy : 0;
+      fz = three_d ? fz : 0;
+
+      // only update particle GID if it has crossed MeshBlock boundary
+      if ((abs(ix) + abs(iy) + abs(iz)) != 0) {
+        if (iz == 0) {
+          if (iy == 0) {
+            // x1 face
+            int indx = NeighborIndex(ix,0,0,0,0);           // neighbor at same level
+            if (nghbr.d_view(m,indx).lev > mylevel) {       // neighbor at finer level
+              indx = NeighborIndex(ix,0,0,fy,fz);
+            }
+            while (nghbr.d_view(m,indx).gid < 0) {indx++;}  // neighbor at coarser level
+            UpdateGID(pi(PGID,p), nghbr.d_view(m,indx), myrank, entry(t), p);
+          } else if (ix == 0) {
+            // x2 face
+            int indx = NeighborIndex(0,iy,0,0,0);
+            if (nghbr.d_view(m,indx).lev > mylevel) {
+              indx = NeighborIndex(0,iy,0,fx,fz);
+            }
+            while (nghbr.d_view(m,indx).gid < 0) {indx++;}
+            UpdateGID(pi(PGID,p), nghbr.d_view(m,indx), myrank, entry(t), p);
+          } else {
+            // x1x2 edge
+            int indx = NeighborIndex(ix,iy,0,0,0);
+            if (nghbr.d_view(m,indx).lev > mylevel) {
+              indx = NeighborIndex(ix,iy,0,fz,0);
+            }
+            while (nghbr.d_view(m,indx).gid < 0) {indx++;}
+            UpdateGID(pi(PGID,p), nghbr.d_view(m,indx), myrank, entry(t), p);
           }
-          while (nghbr.d_view(m,indx).gid < 0) {indx++;}  // neighbor at coarser level
-          UpdateGID(pi(PGID,p), nghbr.d_view(m,indx), myrank, pcounter, psendl, p);
-        } else if (ix == 0) {
-          // x2 face
-          int indx = NeighborIndex(0,iy,0,0,0);
-          if (nghbr.d_view(m,indx).lev > mylevel) {
-            indx = NeighborIndex(0,iy,0,fx,fz);
+        } else if (iy == 0) {
+          if (ix == 0) {
+            // x3 face
+            int indx = NeighborIndex(0,0,iz,0,0);
+            if (nghbr.d_view(m,indx).lev > mylevel) {
+              indx = NeighborIndex(0,0,iz,fx,fy);
+            }
+            while (nghbr.d_view(m,indx).gid < 0) {indx++;}
+            UpdateGID(pi(PGID,p), nghbr.d_view(m,indx), myrank, entry(t), p);
+          } else {
+            // x3x1 edge
+            int indx = NeighborIndex(ix,0,iz,0,0);
+            if (nghbr.d_view(m,indx).lev > mylevel) {
+              indx = NeighborIndex(ix,0,iz,fy,0);
+            }
+            while (nghbr.d_view(m,indx).gid < 0) {indx++;}
+            UpdateGID(pi(PGID,p), nghbr.d_view(m,indx), myrank, entry(t), p);
           }
-          while (nghbr.d_view(m,indx).gid < 0) {indx++;}
-          UpdateGID(pi(PGID,p), nghbr.d_view(m,indx), myrank, pcounter, psendl, p);
         } else {
-          // x1x2 edge
-          int indx = NeighborIndex(ix,iy,0,0,0);
-          if (nghbr.d_view(m,indx).lev > mylevel) {
-            indx = NeighborIndex(ix,iy,0,fz,0);
+          if (ix == 0) {
+            // x2x3 edge
+            int indx = NeighborIndex(0,iy,iz,0,0);
+            if (nghbr.d_view(m,indx).lev > mylevel) {
+              indx = NeighborIndex(0,iy,iz,fx,0);
+            }
+            while (nghbr.d_view(m,indx).gid < 0) {indx++;}
+            UpdateGID(pi(PGID,p), nghbr.d_view(m,indx), myrank, entry(t), p);
+          } else {
+            // corners
+            int indx = NeighborIndex(ix,iy,iz,0,0);
+            UpdateGID(pi(PGID,p), nghbr.d_view(m,indx), myrank, entry(t), p);
           }
-          while (nghbr.d_view(m,indx).gid < 0) {indx++;}
-          UpdateGID(pi(PGID,p), nghbr.d_view(m,indx), myrank, pcounter, psendl, p);
         }
-      } else if (iy == 0) {
-        if (ix == 0) {
-          // x3 face
-          int indx = NeighborIndex(0,0,iz,0,0);
-          if (nghbr.d_view(m,indx).lev > mylevel) {
-            indx = NeighborIndex(0,0,iz,fx,fy);
-          }
-          while (nghbr.d_view(m,indx).gid < 0) {indx++;}
-          UpdateGID(pi(PGID,p), nghbr.d_view(m,indx), myrank, pcounter, psendl, p);
-        } else {
-          // x3x1 edge
-          int indx = NeighborIndex(ix,0,iz,0,0);
-          if (nghbr.d_view(m,indx).lev > mylevel) {
-            indx = NeighborIndex(ix,0,iz,fy,0);
-          }
-          while (nghbr.d_view(m,indx).gid < 0) {indx++;}
-          UpdateGID(pi(PGID,p), nghbr.d_view(m,indx), myrank, pcounter, psendl, p);
+
+        // reset x,y,z positions if particle crosses Mesh boundary using periodic BCs
+        if (x1 < meshsize.x1min) {
+          pr(IPX,p) += (meshsize.x1max - meshsize.x1min);
+        } else if (x1 > meshsize.x1max) {
+          pr(IPX,p) -= (meshsize.x1max - meshsize.x1min);
         }
-      } else {
-        if (ix == 0) {
-          // x2x3 edge
-          int indx = NeighborIndex(0,iy,iz,0,0);
-          if (nghbr.d_view(m,indx).lev > mylevel) {
-            indx = NeighborIndex(0,iy,iz,fx,0);
-          }
-          while (nghbr.d_view(m,indx).gid < 0) {indx++;}
-          UpdateGID(pi(PGID,p), nghbr.d_view(m,indx), myrank, pcounter, psendl, p);
-        } else {
-          // corners
-          int indx = NeighborIndex(ix,iy,iz,0,0);
-          UpdateGID(pi(PGID,p), nghbr.d_view(m,indx), myrank, pcounter, psendl, p);
+        if (x2 < meshsize.x2min) {
+          pr(IPY,p) += (meshsize.x2max - meshsize.x2min);
+        } else if (x2 > meshsize.x2max) {
+          pr(IPY,p) -= (meshsize.x2max - meshsize.x2min);
+        }
+        if (x3 < meshsize.x3min) {
+          pr(IPZ,p) += (meshsize.x3max - meshsize.x3min);
+        } else if (x3 > meshsize.x3max) {
+          pr(IPZ,p) -= (meshsize.x3max - meshsize.x3min);
         }
       }
-
-      // reset x,y,z positions if particle crosses Mesh boundary using periodic BCs
-      if (x1 < meshsize.x1min) {
-        pr(IPX,p) += (meshsize.x1max - meshsize.x1min);
-      } else if (x1 > meshsize.x1max) {
-        pr(IPX,p) -= (meshsize.x1max - meshsize.x1min);
-      }
-      if (x2 < meshsize.x2min) {
-        pr(IPY,p) += (meshsize.x2max - meshsize.x2min);
-      } else if (x2 > meshsize.x2max) {
-        pr(IPY,p) -= (meshsize.x2max - meshsize.x2min);
-      }
-      if (x3 < meshsize.x3min) {
-        pr(IPZ,p) += (meshsize.x3max - meshsize.x3min);
-      } else if (x3 > meshsize.x3max) {
-        pr(IPZ,p) -= (meshsize.x3max - meshsize.x3min);
-      }
+      offset(t) = (entry(t).prtcl_indx >= 0)? 1 : 0;
+    });
+    member.team_barrier();
+
+    // total number of migrants found by this team
+    int tcnt = 0;
+    Kokkos::parallel_reduce(Kokkos::TeamThreadRange(member, nthis),
+    [&](const int t, int &sum) {
+      sum += offset(t);
+    }, tcnt);
+
+    if (tcnt > 0) {
+      // exclusive scan assigns each migrant a compact offset within the team
+      Kokkos::parallel_scan(Kokkos::TeamThreadRange(member, nthis),
+      [&](const int t, int &sum, const bool final_pass) {
+        int f = offset(t);
+        if (final_pass) {offset(t) = sum;}
+        sum += f;
+      });
+      member.team_barrier();
+
+      // one atomic per team reserves a contiguous block of sendlist slots
+      int base = 0;
+      Kokkos::single(Kokkos::PerTeam(member), [&](int &b) {
+        b = Kokkos::atomic_fetch_add(&ncnt(0), tcnt);
+      }, base);
+      member.team_barrier();
+
+      Kokkos::parallel_for(Kokkos::TeamThreadRange(member, nthis), [&](const int t) {
+        if (entry(t).prtcl_indx >= 0) {
+          psendl.d_view(base + offset(t)) = entry(t);
+        }
+      });
     }
   });
-  nprtcl_send = counter;
+
+  // copy migrant count back to host
+  auto ncnt_h = Kokkos::create_mirror_view(ncnt);
+  Kokkos::deep_copy(ncnt_h, ncnt);
+  nprtcl_send = ncnt_h(0);
   Kokkos::resize(sendlist, nprtcl_send);
   // sync sendlist device array with host
   sendlist.template modify<DevExeSpace>();
@@ -181,134 +240,116 @@ TaskStatus ParticlesBoundaryValues::SetNewPrtclGID() {
 
 //----------------------------------------------------------------------------------------
 //! \fn void ParticlesBoundaryValues::CountSendsAndRecvs()
-//! \brief
+//! \brief Buckets sendlist by destination rank on device, then exchanges per-rank
+//! particle counts with a single all-to-all so each rank knows its receives directly.
 
 TaskStatus ParticlesBoundaryValues::CountSendsAndRecvs() {
 #if MPI_PARALLEL_ENABLED
-  // Sort sendlist on host by destrank.
-  namespace KE = Kokkos::Experimental;
-  std::sort(KE::begin(sendlist.h_view), KE::end(sendlist.h_view), SortByRank);
-  // sync sendlist host array with device.  This results in sorted array on device
-  sendlist.template modify<HostMemSpace>();
-  sendlist.template sync<DevExeSpace>();
+  int &myrank = global_variable::my_rank;
+  int nranks = global_variable::nranks;
+
+  // Count number of particles sent to each rank on device.  Counts are then scanned
+  // into bucket offsets used to scatter sendlist into rank-grouped order, which avoids
+  // sorting the entire sendlist on the host.
+  DvceArray1D<int> cnt("pmig_cnt", nranks);
+  Kokkos::deep_copy(cnt, 0);
+  auto &slist = sendlist;
+  int nsend = nprtcl_send;
+  par_for("pmig_count",DevExeSpace(),0,(nsend-1), KOKKOS_LAMBDA(const int n) {
+    Kokkos::atomic_fetch_add(&cnt(slist.d_view(n).dest_rank), 1);
+  });
+
+  // copy per-rank counts to host for message bookkeeping before they are overwritten
+  auto cnt_h = Kokkos::create_mirror_view(cnt);
+  Kokkos::deep_copy(cnt_h, cnt);
+  for (int r=0; r<nranks; ++r) {
+    nsend_torank[r] = cnt_h(r);
+  }
+
+  // exclusive prefix sum of counts into bucket offsets
+  Kokkos::parallel_scan("pmig_scan", Kokkos::RangePolicy<DevExeSpace>(0, nranks),
+  KOKKOS_LAMBDA(const int r, int &sum, const bool final_pass) {
+    int c = cnt(r);
+    if (final_pass) {cnt(r) = sum;}
+    sum += c;
+  });
+
+  // scatter sendlist entries into rank-grouped order (order within a rank is arbitrary)
+  if (nsend > 0) {
+    DualArray1D<ParticleLocationData> grouped("sendlist_grouped", nsend);
+    par_for("pmig_group",DevExeSpace(),0,(nsend-1), KOKKOS_LAMBDA(const int n) {
+      int indx = Kokkos::atomic_fetch_add(&cnt(slist.d_view(n).dest_rank), 1);
+      grouped.d_view(indx) = slist.d_view(n);
+    });
+    sendlist = grouped;
+    sendlist.template modify<DevExeSpace>();
+    sendlist.template sync<HostMemSpace>();
+  }
 
   // load STL::vector of ParticleMessageData with <sendrank, recvrank, nprtcls> for sends
-  // from this rank. Length will be nsends; initially this length is unknown
+  // from this rank
   sends_thisrank.clear();
-  if (nprtcl_send > 0) {
-    int &myrank = global_variable::my_rank;
-    int rank = sendlist.h_view(0).dest_rank;
-    int nprtcl = 1;
-
-    for (int n=1; n<nprtcl_send; ++n) {
-      if (sendlist.h_view(n).dest_rank == rank) {
-        ++nprtcl;
-      } else {
-        sends_thisrank.emplace_back(ParticleMessageData(myrank,rank,nprtcl));
-        rank = sendlist.h_view(n).dest_rank;
-        nprtcl = 1;
-      }
+  for (int r=0; r<nranks; ++r) {
+    if (nsend_torank[r] > 0) {
+      sends_thisrank.emplace_back(ParticleMessageData(myrank,r,nsend_torank[r]));
     }
-    sends_thisrank.emplace_back(ParticleMessageData(myrank,rank,nprtcl));
   }
   nsends = sends_thisrank.size();
 
-  // Share number of ranks to send to amongst all ranks
-  nsends_eachrank[global_variable::my_rank] = nsends;
-  MPI_Allgather(&nsends, 1, MPI_INT, nsends_eachrank.data(), 1, MPI_INT, mpi_comm_part);
-
-  // Now share ParticleMessageData amongst all ranks
-  // First create vector of starting indices in full vector
-  std::vector<int> nsends_displ;
-  nsends_displ.resize(global_variable::nranks);
-  nsends_displ[0] = 0;
-  for (int n=1; n<(global_variable::nranks); ++n) {
-    nsends_displ[n] = nsends_displ[n-1] + nsends_eachrank[n-1];
-  }
-  int nsends_allranks = nsends_displ[global_variable::nranks - 1] +
-                        nsends_eachrank[global_variable::nranks - 1];
-  // Load ParticleMessageData on this rank into full vector
-  sends_allranks.resize(nsends_allranks, ParticleMessageData(0,0,0));
-  for (int n=0; n<nsends_eachrank[global_variable::my_rank]; ++n) {
-    sends_allranks[n + nsends_displ[global_variable::my_rank]] = sends_thisrank[n];
+  // Exchange per-rank particle counts with a single all-to-all (one int per rank pair),
+  // and load receives on this rank.  This replaces allgathering every (send,recv,count)
+  // tuple across all ranks, which scales poorly with both ranks and messages.
+  std::vector<int> nrecv_fromrank(nranks);
+  MPI_Alltoall(nsend_torank.data(), 1, MPI_INT, nrecv_fromrank.data(), 1, MPI_INT,
+               mpi_comm_part);
+  recvs_thisrank.clear();
+  for (int r=0; r<nranks; ++r) {
+    if (nrecv_fromrank[r] > 0) {
+      recvs_thisrank.emplace_back(ParticleMessageData(r,myrank,nrecv_fromrank[r]));
+    }
   }
-
-  // Share tuples using MPI derived data type for tuple of 3*int
-  MPI_Datatype mpi_ituple;
-  MPI_Type_contiguous(3, MPI_INT, &mpi_ituple);
-  MPI_Allgatherv(MPI_IN_PLACE, nsends_eachrank[global_variable::my_rank],
-                   mpi_ituple, sends_allranks.data(), nsends_eachrank.data(),
-                   nsends_displ.data(), mpi_ituple, mpi_comm_part);
+  nrecvs = recvs_thisrank.size();
 #endif
   return TaskStatus::complete;
 }
 
 //----------------------------------------------------------------------------------------
 //! \fn void ParticlesBoundaryValues::InitPrtclRecv()
-//! \brief
+//! \brief Posts one non-blocking receive of packed particle records per sending rank.
+//! Receives on this rank were already determined in CountSendsAndRecvs().
 
 TaskStatus ParticlesBoundaryValues::InitPrtclRecv() {
 #if MPI_PARALLEL_ENABLED
-  // load STL::vector of ParticleMessageData with <sendrank,recvrank,nprtcl_recv> for
-  // receives // on this rank. Length will be nrecvs, initially this length is unknown
-  recvs_thisrank.clear();
-
-  int nsends_allranks = sends_allranks.size();
-  for (int n=0; n<nsends_allranks; ++n) {
-    if (sends_allranks[n].recvrank == global_variable::my_rank) {
-      recvs_thisrank.emplace_back(sends_allranks[n]);
-    }
-  }
-  nrecvs = recvs_thisrank.size();
-
   // Figure out how many particles will be received from all ranks
   nprtcl_recv=0;
   for (int n=0; n<nrecvs; ++n) {
     nprtcl_recv += recvs_thisrank[n].nprtcls;
   }
 
-  // Allocate receive buffer
-  Kokkos::realloc(prtcl_rrecvbuf, (pmy_part->nrdata)*nprtcl_recv);
-  Kokkos::realloc(prtcl_irecvbuf, (pmy_part->nidata)*nprtcl_recv);
+  // Allocate receive buffer.  Each particle record packs nrdata Reals followed by
+  // nidata ints so that only one message is needed per rank pair.
+  int recsize = (pmy_part->nrdata)*sizeof(Real) + (pmy_part->nidata)*sizeof(int);
+  Kokkos::realloc(prtcl_recvbuf, recsize*nprtcl_recv);
 
   // Post non-blocking receives
   bool no_errors=true;
-  rrecv_req.clear();
-  irecv_req.clear();
+  recv_req.clear();
   for (int n=0; n<nrecvs; ++n) {
-    rrecv_req.emplace_back(MPI_REQUEST_NULL);
-    irecv_req.emplace_back(MPI_REQUEST_NULL);
+    recv_req.emplace_back(MPI_REQUEST_NULL);
   }
 
-  // Init receives for Reals
   int data_start=0;
   for (int n=0; n<nrecvs; ++n) {
     // calculate amount of data to be passed, get pointer to variables
-    int data_size = (pmy_part->nrdata)*(recvs_thisrank[n].nprtcls);
-    int data_end = data_start + (pmy_part->nrdata)*(recvs_thisrank[n].nprtcls - 1);
-    auto recv_ptr = Kokkos::subview(prtcl_rrecvbuf, std::make_pair(data_start, data_end));
-    int drank = recvs_thisrank[n].sendrank;
-    int tag = 0; // 0 for Reals, 1 for ints
-
-    // Post non-blocking receive
-    int ierr = MPI_Irecv(recv_ptr.data(), data_size, MPI_ATHENA_REAL, drank, tag,
-                         mpi_comm_part, &(rrecv_req[n]));
-    if (ierr != MPI_SUCCESS) {no_errors=false;}
-    data_start += data_size;
-  }
-  // Init receives for ints
-  data_start=0;
-  for (int n=0; n<nrecvs; ++n) {
-    // calculate amount of data to be passed, get pointer to variables
-    int data_size = (pmy_part->nidata)*(recvs_thisrank[n].nprtcls);
-    int data_end = data_start + (pmy_part->nidata)*(recvs_thisrank[n].nprtcls - 1);
-    auto recv_ptr = Kokkos::subview(prtcl_irecvbuf, std::make_pair(data_start, data_end));
+    int data_size = recsize*(recvs_thisrank[n].nprtcls);
+    auto recv_ptr = Kokkos::subview(prtcl_recvbuf,
+                                    std::make_pair(data_start, data_start + data_size));
     int drank = recvs_thisrank[n].sendrank;
-    int tag = 1; // 0 for Reals, 1 for ints
+    int tag = 0;
 
     // Post non-blocking receive
-    int ierr = MPI_Irecv(recv_ptr.data(), data_size, MPI_INT, drank, tag,
-                         mpi_comm_part, &(irecv_req[n]));
+    int ierr = MPI_Irecv(recv_ptr.data(), data_size, MPI_BYTE, drank, tag,
+                         mpi_comm_part, &(recv_req[n]));
     if (ierr != MPI_SUCCESS) {no_errors=false;}
     data_start += data_size;
   }
@@ -325,7 +366,8 @@ TaskStatus ParticlesBoundaryValues::InitPrtclRecv() {
 
 //----------------------------------------------------------------------------------------
 //! \fn void ParticlesBoundaryValues::PackAndSendPrtcls()
-//! \brief
+//! \brief Packs leaving particles into byte records on device and posts one non-blocking
+//! send per destination rank.
 
 TaskStatus ParticlesBoundaryValues::PackAndSendPrtcls() {
 #if MPI_PARALLEL_ENABLED
@@ -337,66 +379,57 @@ TaskStatus ParticlesBoundaryValues::PackAndSendPrtcls() {
 
   bool no_errors=true;
   if (nprtcl_send > 0) {
-    // Allocate send buffer
-    Kokkos::realloc(prtcl_rsendbuf, (pmy_part->nrdata)*nprtcl_send);
-    Kokkos::realloc(prtcl_isendbuf, (pmy_part->nidata)*nprtcl_send);
-
-    // sendlist on device is already sorted by destrank in CountSendAndRecvs()
-    // Use sendlist on device to load particles into send buffer ordered by dest_rank
+    // Allocate send buffer of packed particle records (nrdata Reals then nidata ints)
     int nrdata = pmy_part->nrdata;
     int nidata = pmy_part->nidata;
+    int recsize = nrdata*sizeof(Real) + nidata*sizeof(int);
+    Kokkos::realloc(prtcl_sendbuf, recsize*nprtcl_send);
+
+    // sendlist on device is already grouped by destrank in CountSendsAndRecvs()
+    // Use sendlist on device to load particles into send buffer ordered by dest_rank.
+    // Records are packed byte-by-byte so no alignment is required of the buffer.
     auto &pr = pmy_part->prtcl_rdata;
     auto &pi = pmy_part->prtcl_idata;
-    auto &rsendbuf = prtcl_rsendbuf;
-    auto &isendbuf = prtcl_isendbuf;
+    auto &sendbuf = prtcl_sendbuf;
     par_for("ppack",DevExeSpace(),0,(nprtcl_send-1), KOKKOS_LAMBDA(const int n) {
       int p = sendlist.d_view(n).prtcl_indx;
-      for (int i=0; i<nidata; ++i) {
-        isendbuf(nidata*n + i) = pi(i,p);
-      }
+      char *rec = &sendbuf(n*recsize);
       for (int i=0; i<nrdata; ++i) {
-        rsendbuf(nrdata*n + i) = pr(i,p);
+        Real val = pr(i,p);
+        const char *src = reinterpret_cast<const char*>(&val);
+        for (int b=0; b<static_cast<int>(sizeof(Real)); ++b) {
+          rec[i*sizeof(Real) + b] = src[b];
+        }
+      }
+      char *irec = rec + nrdata*sizeof(Real);
+      for (int i=0; i<nidata; ++i) {
+        int val = pi(i,p);
+        const char *src = reinterpret_cast<const char*>(&val);
+        for (int b=0; b<static_cast<int>(sizeof(int)); ++b) {
+          irec[i*sizeof(int) + b] = src[b];
+        }
       }
     });
 
     // Post non-blocking sends
     Kokkos::fence();
-    rsend_req.clear();
-    isend_req.clear();
+    send_req.clear();
     for (int n=0; n<nsends; ++n) {
-      rsend_req.emplace_back(MPI_REQUEST_NULL);
-      isend_req.emplace_back(MPI_REQUEST_NULL);
+      send_req.emplace_back(MPI_REQUEST_NULL);
     }
 
-    // Send Reals
     int data_start=0;
     for (int n=0; n<nsends; ++n) {
       // calculate amount of data to be passed, get pointer to variables
-      int data_size = nrdata*(sends_thisrank[n].nprtcls);
-      int data_end = data_start + nrdata*(sends_thisrank[n].nprtcls - 1);
-      auto send_ptr = Kokkos::subview(prtcl_rsendbuf,std::make_pair(data_start,data_end));
+      int data_size = recsize*(sends_thisrank[n].nprtcls);
+      auto send_ptr = Kokkos::subview(prtcl_sendbuf,
+                                      std::make_pair(data_start, data_start + data_size));
       int drank = sends_thisrank[n].recvrank;
-      int tag = 0; // 0 for Reals, 1 for ints
+      int tag = 0;
 
       // Post non-blocking sends
-      int ierr = MPI_Isend(send_ptr.data(), data_size, MPI_ATHENA_REAL, drank, tag,
-                           mpi_comm_part, &(rsend_req[n]));
-      if (ierr != MPI_SUCCESS) {no_errors=false;}
-      data_start += data_size;
-    }
-    // Send ints
-    data_start=0;
-    for (int n=0; n<nsends; ++n) {
-      // calculate amount of data to be passed, get pointer to variables
-      int data_size = nidata*(sends_thisrank[n].nprtcls);
-      int data_end = data_start + nidata*(sends_thisrank[n].nprtcls - 1);
-      auto send_ptr = Kokkos::subview(prtcl_isendbuf,std::make_pair(data_start,data_end));
-      int drank = sends_thisrank[n].recvrank;
-      int tag = 1; // 0 for Reals, 1 for ints
-
-      // Post non-blocking sends
-      int ierr = MPI_Isend(send_ptr.data(), data_size, MPI_INT, drank, tag,
-                           mpi_comm_part, &(isend_req[n]));
+      int ierr = MPI_Isend(send_ptr.data(), data_size, MPI_BYTE, drank, tag,
+                           mpi_comm_part, &(send_req[n]));
       if (ierr != MPI_SUCCESS) {no_errors=false;}
       data_start += data_size;
     }
@@ -405,7 +438,7 @@ TaskStatus ParticlesBoundaryValues::PackAndSendPrtcls() {
   // Quit if MPI error detected
   if (!(no_errors)) {
     std::cout << "### FATAL ERROR in " << __FILE__ << " at line " << __LINE__
-              << std::endl << "MPI error in posting non-blocking receives" << std::endl;
+              << std::endl << "MPI error in posting non-blocking sends" << std::endl;
     std::exit(EXIT_FAILURE);
   }
 #endif
@@ -414,17 +447,11 @@ TaskStatus ParticlesBoundaryValues::PackAndSendPrtcls() {
 
 //----------------------------------------------------------------------------------------
 //! \fn void ParticlesBoundaryValues::RecvAndUnpackPrtcls()
-//! \brief
+//! \brief Unpacks received particle records into holes left by sends, then fills any
+//! remaining holes batched on device by compacting particles from the end of the arrays.
 
 TaskStatus ParticlesBoundaryValues::RecvAndUnpackPrtcls() {
 #if MPI_PARALLEL_ENABLED
-  // Sort sendlist on host by index in particle array
-  namespace KE = Kokkos::Experimental;
-  std::sort(KE::begin(sendlist.h_view), KE::end(sendlist.h_view), SortByIndex);
-  // sync sendlist host array with device.  This results in sorted array on device
-  sendlist.template modify<HostMemSpace>();
-  sendlist.template sync<DevExeSpace>();
-
   // increase size of particle arrays if needed
   int new_npart = pmy_part->nprtcl_thispack + (nprtcl_recv - nprtcl_send);
   if (nprtcl_recv > nprtcl_send) {
@@ -437,12 +464,7 @@ TaskStatus ParticlesBoundaryValues::RecvAndUnpackPrtcls() {
   bool no_errors=true;
   for (int n=0; n<nrecvs; ++n) {
     int test;
-    int ierr = MPI_Test(&(rrecv_req[n]), &test, MPI_STATUS_IGNORE);
-    if (ierr != MPI_SUCCESS) {no_errors=false;}
-    if (!(static_cast<bool>(test))) {
-      bflag = true;
-    }
-    ierr = MPI_Test(&(irecv_req[n]), &test, MPI_STATUS_IGNORE);
+    int ierr = MPI_Test(&(recv_req[n]), &test, MPI_STATUS_IGNORE);
     if (ierr != MPI_SUCCESS) {no_errors=false;}
     if (!(static_cast<bool>(test))) {
       bflag = true;
@@ -458,14 +480,15 @@ TaskStatus ParticlesBoundaryValues::RecvAndUnpackPrtcls() {
   // exit if particle communications have not completed
   if (bflag) {return TaskStatus::incomplete;}
 
+  int nrdata = pmy_part->nrdata;
+  int nidata = pmy_part->nidata;
+  int recsize = nrdata*sizeof(Real) + nidata*sizeof(int);
+  auto &pr = pmy_part->prtcl_rdata;
+  auto &pi = pmy_part->prtcl_idata;
+
   // unpack particles into positions of sent particles
   if (nprtcl_recv > 0) {
-    int nrdata = pmy_part->nrdata;
-    int nidata = pmy_part->nidata;
-    auto &pr = pmy_part->prtcl_rdata;
-    auto &pi = pmy_part->prtcl_idata;
-    auto &rrecvbuf = prtcl_rrecvbuf;
-    auto &irecvbuf = prtcl_irecvbuf;
+    auto &recvbuf = prtcl_recvbuf;
     int &npart = pmy_part->nprtcl_thispack;
     par_for("punpack",DevExeSpace(),0,(nprtcl_recv-1), KOKKOS_LAMBDA(const int n) {
       int p;
@@ -474,40 +497,75 @@ TaskStatus ParticlesBoundaryValues::RecvAndUnpackPrtcls() {
       } else {
         p = npart + (n - nprtcl_send);     // place particle at end of arrays
       }
-      for (int i=0; i<nidata; ++i) {
-        pi(i,p) = irecvbuf(nidata*n + i);
-      }
+      const char *rec = &recvbuf(n*recsize);
       for (int i=0; i<nrdata; ++i) {
-        pr(i,p) = rrecvbuf(nrdata*n + i);
+        Real val;
+        char *dst = reinterpret_cast<char*>(&val);
+        for (int b=0; b<static_cast<int>(sizeof(Real)); ++b) {
+          dst[b] = rec[i*sizeof(Real) + b];
+        }
+        pr(i,p) = val;
+      }
+      const char *irec = rec + nrdata*sizeof(Real);
+      for (int i=0; i<nidata; ++i) {
+        int val;
+        char *dst = reinterpret_cast<char*>(&val);
+        for (int b=0; b<static_cast<int>(sizeof(int)); ++b) {
+          dst[b] = irec[i*sizeof(int) + b];
+        }
+        pi(i,p) = val;
       }
     });
   }
 
   // At this point have filled npart_recv holes in particle arrays from sends
   // If (nprtcl_recv < nprtcl_send), have to move particles from end of arrays to fill
-  // remaining holes
+  // remaining holes.  Since the unfilled holes (sendlist entries [nprtcl_recv,
+  // nprtcl_send)) are in arbitrary positions, build on device the list of holes below
+  // new_npart and the list of surviving particles in the tail [new_npart,npart); the
+  // two lists have equal length, and tail particle i is copied into hole i in a single
+  // kernel instead of one host-driven copy per particle.
   int nremain = nprtcl_send - nprtcl_recv;
   if (nremain > 0) {
     int &npart = pmy_part->nprtcl_thispack;
-    int i_last_hole = nprtcl_send-1;
-    int i_next_hole = nprtcl_recv;
-    for (int n=1; n<=nremain; ++n) {
-      int nend = npart-n;
-      if (nend > sendlist.h_view(i_last_hole).prtcl_indx) {
-        // copy particle from end into hole
-        int next_hole = sendlist.h_view(i_next_hole).prtcl_indx;
-        auto rdest = Kokkos::subview(pmy_part->prtcl_rdata, Kokkos::ALL, next_hole);
-        auto rsrc  = Kokkos::subview(pmy_part->prtcl_rdata, Kokkos::ALL, nend);
-        Kokkos::deep_copy(rdest, rsrc);
-        auto idest = Kokkos::subview(pmy_part->prtcl_idata, Kokkos::ALL, next_hole);
-        auto isrc  = Kokkos::subview(pmy_part->prtcl_idata, Kokkos::ALL, nend);
-        Kokkos::deep_copy(idest, isrc);
-        i_next_hole += 1;
-      } else {
-        // this index contains a hole, so do nothing except find new index of last hole
-        i_last_hole -= 1;
+    DvceArray1D<int> ishole("pmig_hole", npart);
+    DvceArray1D<int> hole_indx("pmig_hindx", nremain);
+    DvceArray1D<int> tail_indx("pmig_tindx", nremain);
+    DvceArray1D<int> ctr("pmig_ctr", 2);
+    Kokkos::deep_copy(ishole, 0);
+    Kokkos::deep_copy(ctr, 0);
+    auto &slist = sendlist;
+    int nrecv = nprtcl_recv;
+    par_for("pmig_holes",DevExeSpace(),0,(nremain-1), KOKKOS_LAMBDA(const int n) {
+      int p = slist.d_view(nrecv + n).prtcl_indx;
+      ishole(p) = 1;
+      if (p < new_npart) {
+        int indx = Kokkos::atomic_fetch_add(&ctr(0), 1);
+        hole_indx(indx) = p;
       }
-    }
+    });
+    par_for("pmig_tail",DevExeSpace(),0,(nremain-1), KOKKOS_LAMBDA(const int n) {
+      int p = new_npart + n;
+      if (ishole(p) == 0) {
+        int indx = Kokkos::atomic_fetch_add(&ctr(1), 1);
+        tail_indx(indx) = p;
+      }
+    });
+
+    // number of holes below new_npart equals number of surviving tail particles
+    auto ctr_h = Kokkos::create_mirror_view(ctr);
+    Kokkos::deep_copy(ctr_h, ctr);
+    int nfill = ctr_h(0);
+    par_for("pmig_fill",DevExeSpace(),0,(nfill-1), KOKKOS_LAMBDA(const int n) {
+      int pdst = hole_indx(n);
+      int psrc = tail_indx(n);
+      for (int i=0; i<nrdata; ++i) {
+        pr(i,pdst) = pr(i,psrc);
+      }
+      for (int i=0; i<nidata; ++i) {
+        pi(i,pdst) = pi(i,psrc);
+      }
+    });
 
     // shrink size of particle data arrays
     Kokkos::resize(pmy_part->prtcl_idata, pmy_part->nidata, new_npart);
@@ -531,10 +589,8 @@ TaskStatus ParticlesBoundaryValues::ClearPrtclSend() {
 #if MPI_PARALLEL_ENABLED
   bool no_errors=true;
   // wait for all non-blocking sends for vars to finish before continuing
-  for (int n=0; n<nsends; ++n) {
-    int ierr = MPI_Wait(&(rsend_req[n]), MPI_STATUS_IGNORE);
-    if (ierr != MPI_SUCCESS) {no_errors=false;}
-    ierr = MPI_Wait(&(isend_req[n]), MPI_STATUS_IGNORE);
+  for (int n=0; n<(static_cast<int>(send_req.size())); ++n) {
+    int ierr = MPI_Wait(&(send_req[n]), MPI_STATUS_IGNORE);
     if (ierr != MPI_SUCCESS) {no_errors=false;}
   }
   // Quit if MPI error detected
@@ -543,8 +599,7 @@ TaskStatus ParticlesBoundaryValues::ClearPrtclSend() {
        << std::endl << "MPI error in clearing sends" << std::endl;
     std::exit(EXIT_FAILURE);
   }
-  rsend_req.clear();
-  isend_req.clear();
+  send_req.clear();
 #endif
   nsends=0;
   return TaskStatus::complete;
@@ -559,9 +614,7 @@ TaskStatus ParticlesBoundaryValues::ClearPrtclRecv() {
   bool no_errors=true;
   // wait for all non-blocking receives to finish before continuing
   for (int n=0; n<nrecvs; ++n) {
-    int ierr = MPI_Wait(&(rrecv_req[n]), MPI_STATUS_IGNORE);
-    if (ierr != MPI_SUCCESS) {no_errors=false;}
-    ierr = MPI_Wait(&(irecv_req[n]), MPI_STATUS_IGNORE);
+    int ierr = MPI_Wait(&(recv_req[n]), MPI_STATUS_IGNORE);
     if (ierr != MPI_SUCCESS) {no_errors=false;}
   }
   // Quit if MPI error detected
@@ -570,8 +623,7 @@ TaskStatus ParticlesBoundaryValues::ClearPrtclRecv() {
        << std::endl << "MPI error in clearing receives" << std::endl;
     std::exit(EXIT_FAILURE);
   }
-  rrecv_req.clear();
-  irecv_req.clear();
+  recv_req.clear();
 #endif
   nrecvs=0;
   return TaskStatus::complete;
@@ -22,6 +22,7 @@
 #include "globals.hpp"
 #include "parameter_input.hpp"
 #include "mesh/mesh.hpp"
+#include "utils/profiler.hpp"
 #include "bvals.hpp"
 
 //----------------------------------------------------------------------------------------
@@ -29,43 +30,51 @@
 //! \brief Posts non-blocking receives (with MPI) for boundary communications of vars.
 
 TaskStatus MeshBoundaryValues::InitRecv(const int nvars) {
+  // receives were already pre-posted before problem generation (see ProblemGenerator
+  // constructor); consume the flag so this call does not post them a second time
+  if (init_recv_posted) {
+    init_recv_posted = false;
+    return TaskStatus::complete;
+  }
 #if MPI_PARALLEL_ENABLED
   int &nmb = pmy_pack->nmb_thispack;
   int &nnghbr = pmy_pack->pmb->nnghbr;
   auto &nghbr = pmy_pack->pmb->nghbr;
 
-  // Initialize communications of variables
+  // with coalesced comm, start single aggregated receive per remote rank instead
+  if (coalesced_comm) {
+    if (comm_stale) {InitCoalescedIndices();}
+    int ierr = MPI_Startall(ncoal_recv, coal_recv_req.data());
+    // Quit if MPI error detected
+    if (ierr != MPI_SUCCESS) {
+      std::cout << "### FATAL ERROR in " << __FILE__ << " at line " << __LINE__
+         << std::endl << "MPI error in starting persistent receives" << std::endl;
+      std::exit(EXIT_FAILURE);
+    }
+    return TaskStatus::complete;
+  }
+
+  // Start persistent receives of variables.  Tags, sizes, and buffer locations are all
+  // fixed between remeshing events, so they are set once in InitPersistentRequests()
+  if (comm_stale) {InitPersistentRequests();}
+  // ensure arrival-flag array matches the MeshBlock layout before receives are
+  // enlisted with the progress engine, which may flip flags before the Recv task runs
+  if ((vars_recvd.extent_int(0) != nmb) || (vars_recvd.extent_int(1) != nnghbr)) {
+    Kokkos::realloc(vars_recvd, nmb, nnghbr);
+    for (int m=0; m<nmb; ++m) {
+      for (int n=0; n<nnghbr; ++n) {vars_recvd(m,n) = 0;}
+    }
+  }
+
   bool no_errors=true;
   for (int m=0; m<nmb; ++m) {
     for (int n=0; n<nnghbr; ++n) {
       if (nghbr.h_view(m,n).gid >= 0) {
-        // rank of destination buffer
-        int drank = nghbr.h_view(m,n).rank;
-
-        // post non-blocking receive if neighboring MeshBlock on a different rank
-        if (drank != global_variable::my_rank) {
-          // create tag using local ID and buffer index of *receiving* MeshBlock
-          int tag = CreateBvals_MPI_Tag(m, n);
-
-          // calculate amount of data to be passed, get pointer to variables
-          int data_size = nvars;
-          if ( nghbr.h_view(m,n).lev < pmy_pack->pmb->mb_lev.h_view(m) ) {
-            data_size *= recvbuf[n].icoar_ndat;
-          } else if ( nghbr.h_view(m,n).lev == pmy_pack->pmb->mb_lev.h_view(m) ) {
-            if (is_z4c_) {
-              data_size *= recvbuf[n].isame_z4c_ndat;
-            } else {
-              data_size *= recvbuf[n].isame_ndat;
-            }
-          } else {
-            data_size *= recvbuf[n].ifine_ndat;
-          }
-          auto recv_ptr = Kokkos::subview(recvbuf[n].vars, m, Kokkos::ALL);
-
-          // Post non-blocking receive for this buffer on this MeshBlock
-          int ierr = MPI_Irecv(recv_ptr.data(), data_size, MPI_ATHENA_REAL, drank, tag,
-                               comm_vars, &(recvbuf[n].vars_req[m]));
+        // start receive if neighboring MeshBlock on a different rank
+        if (nghbr.h_view(m,n).rank != global_variable::my_rank) {
+          int ierr = MPI_Start(&(recvbuf[n].vars_req[m]));
           if (ierr != MPI_SUCCESS) {no_errors=false;}
+          EnlistRecv(this, m, n, recvbuf[n].vars_req[m]);
         }
       }
     }
@@ -73,13 +82,147 @@ TaskStatus MeshBoundaryValues::InitRecv(const int nvars) {
   // Quit if MPI error detected
   if (!(no_errors)) {
     std::cout << "### FATAL ERROR in " << __FILE__ << " at line " << __LINE__
-       << std::endl << "MPI error in posting non-blocking receives" << std::endl;
+       << std::endl << "MPI error in starting persistent receives" << std::endl;
     std::exit(EXIT_FAILURE);
   }
 #endif
   return TaskStatus::complete;
 }
 
+#if MPI_PARALLEL_ENABLED
+//----------------------------------------------------------------------------------------
+//! \fn  void MeshBoundaryValues::StartPersistentSends
+//! \brief Starts persistent sends of variables to neighboring MeshBlocks on other ranks.
+//! Called by CC/FC pack functions after buffers are filled, in place of posting
+//! non-blocking sends with freshly computed tags and sizes every stage.
+
+void MeshBoundaryValues::StartPersistentSends() {
+  if (comm_stale) {InitPersistentRequests();}
+  int &nmb = pmy_pack->nmb_thispack;
+  int &nnghbr = pmy_pack->pmb->nnghbr;
+  auto &nghbr = pmy_pack->pmb->nghbr;
+
+  // with single-precision transport, down-convert packed messages into the float
+  // shadow buffers before sending.  Each shadow row is converted in full since message
+  // lengths differ between coarser/same/finer neighbors; converting the unused tail of
+  // a row is harmless and cheaper than branching on neighbor levels
+  if (single_prec_vars) {
+    auto &sbuf = sendbuf;
+    int my_rank = global_variable::my_rank;
+    int nn = nnghbr;
+    Kokkos::TeamPolicy<> policy(DevExeSpace(), (nmb*nn), Kokkos::AUTO);
+    Kokkos::parallel_for("SendBuffSP", policy, KOKKOS_LAMBDA(TeamMember_t tmember) {
+      const int m = tmember.league_rank()/nn;
+      const int n = tmember.league_rank() - m*nn;
+      if ((nghbr.d_view(m,n).gid >= 0) && (nghbr.d_view(m,n).rank != my_rank)) {
+        const int ndat = sbuf[n].vars.extent_int(1);
+        Kokkos::parallel_for(Kokkos::TeamThreadRange<>(tmember, ndat), [&](const int i) {
+          sbuf[n].vars_sp(m,i) = static_cast<float>(sbuf[n].vars(m,i));
+        });
+      }
+    });
+#if MPI_GPU_AWARE_ENABLED
+    // conversions must complete before MPI reads the shadow buffers on device
+    Kokkos::fence();
+#endif
+  }
+
+  // with transform-coded transport (Z4c), encode each variable's slab as its mean
+  // (split into a hi/lo float pair so Real precision is preserved) followed by float
+  // residuals about that mean.  Z4c fields are smooth with values of order unity, so
+  // the residuals are small and their float roundoff is far below truncation error
+  if (transform_vars) {
+    auto &sbuf = sendbuf;
+    auto &mblev = pmy_pack->pmb->mb_lev;
+    int my_rank = global_variable::my_rank;
+    int nn = nnghbr;
+    int nv = nvar_;
+    Kokkos::TeamPolicy<> policy(DevExeSpace(), (nmb*nn), Kokkos::AUTO);
+    Kokkos::parallel_for("SendBuffTC", policy, KOKKOS_LAMBDA(TeamMember_t tmember) {
+      const int m = tmember.league_rank()/nn;
+      const int n = tmember.league_rank() - m*nn;
+      if ((nghbr.d_view(m,n).gid >= 0) && (nghbr.d_view(m,n).rank != my_rank)) {
+        // number of cells per variable in this message depends on neighbor level
+        int ndat;
+        if (nghbr.d_view(m,n).lev < mblev.d_view(m)) {
+          ndat = sbuf[n].icoar_ndat;
+        } else if (nghbr.d_view(m,n).lev == mblev.d_view(m)) {
+          ndat = sbuf[n].isame_z4c_ndat;
+        } else {
+          ndat = sbuf[n].ifine_ndat;
+        }
+        for (int v=0; v<nv; ++v) {
+          Real vmean = 0.0;
+          Kokkos::parallel_reduce(Kokkos::TeamThreadRange<>(tmember, ndat),
+          [&](const int i, Real &sum) {
+            sum += sbuf[n].vars(m, v*ndat + i);
+          }, vmean);
+          vmean /= static_cast<Real>(ndat);
+          const int vs = v*(ndat + 2);
+          const float mhi = static_cast<float>(vmean);
+          const float mlo = static_cast<float>(vmean - static_cast<Real>(mhi));
+          Kokkos::single(Kokkos::PerTeam(tmember), [&]() {
+            sbuf[n].vars_sp(m,vs  ) = mhi;
+            sbuf[n].vars_sp(m,vs+1) = mlo;
+          });
+          Kokkos::parallel_for(Kokkos::TeamThreadRange<>(tmember, ndat),
+          [&](const int i) {
+            sbuf[n].vars_sp(m,vs+2+i) =
+                static_cast<float>(sbuf[n].vars(m,v*ndat+i) - vmean);
+          });
+        }
+      }
+    });
+#if MPI_GPU_AWARE_ENABLED
+    // encoding must complete before MPI reads the shadow buffers on device
+    Kokkos::fence();
+#endif
+  }
+
+#if !(MPI_GPU_AWARE_ENABLED)
+  // stage send buffers through host when MPI cannot access device memory.  Copies for
+  // each remote buffer are issued asynchronously and fenced once so D2H transfers
+  // overlap with one another
+  for (int m=0; m<nmb; ++m) {
+    for (int n=0; n<nnghbr; ++n) {
+      if ( (nghbr.h_view(m,n).gid >= 0) &&
+           (nghbr.h_view(m,n).rank != global_variable::my_rank) ) {
+        if (single_prec_vars || transform_vars) {
+          Kokkos::deep_copy(DevExeSpace(),
+                            Kokkos::subview(sendbuf[n].vars_sp_h, m, Kokkos::ALL),
+                            Kokkos::subview(sendbuf[n].vars_sp, m, Kokkos::ALL));
+        } else {
+          Kokkos::deep_copy(DevExeSpace(),
+                            Kokkos::subview(sendbuf[n].vars_h, m, Kokkos::ALL),
+                            Kokkos::subview(sendbuf[n].vars, m, Kokkos::ALL));
+        }
+      }
+    }
+  }
+  Kokkos::fence();
+#endif
+
+  bool no_errors=true;
+  for (int m=0; m<nmb; ++m) {
+    for (int n=0; n<nnghbr; ++n) {
+      if (nghbr.h_view(m,n).gid >= 0) {
+        if (nghbr.h_view(m,n).rank != global_variable::my_rank) {
+          int ierr = MPI_Start(&(sendbuf[n].vars_req[m]));
+          if (ierr != MPI_SUCCESS) {no_errors=false;}
+        }
+      }
+    }
+  }
+  // Quit if MPI error detected
+  if (!(no_errors)) {
+    std::cout << "### FATAL ERROR in " << __FILE__ << " at line " << __LINE__
+       << std::endl << "MPI error in starting persistent sends" << std::endl;
+    std::exit(EXIT_FAILURE);
+  }
+  return;
+}
+#endif
+
 //----------------------------------------------------------------------------------------
 //! \fn  void MeshBoundaryValues::ClearRecv
 //! \brief Waits for all MPI receives associated with communcation of boundary variables
@@ -87,11 +230,27 @@ TaskStatus MeshBoundaryValues::InitRecv(const int nvars) {
 
 TaskStatus MeshBoundaryValues::ClearRecv() {
 #if MPI_PARALLEL_ENABLED
+  // time spent waiting here counts towards the MPI wait fraction when profiling
+  profiler::RegionTimer rguard("mpi_wait_vars_recv");
   bool no_errors=true;
   int &nmb = pmy_pack->nmb_thispack;
   int &nnghbr = pmy_pack->pmb->nnghbr;
   auto &nghbr = pmy_pack->pmb->nghbr;
 
+  // with coalesced comm, wait on single aggregated receive per remote rank instead
+  if (coalesced_comm) {
+    for (int r=0; r<ncoal_recv; ++r) {
+      int ierr = MPI_Wait(&(coal_recv_req[r]), MPI_STATUS_IGNORE);
+      if (ierr != MPI_SUCCESS) {no_errors=false;}
+    }
+    if (!(no_errors)) {
+      std::cout << "### FATAL ERROR in " << __FILE__ << " at line " << __LINE__
+         << std::endl << "MPI error in clearing receives" << std::endl;
+      std::exit(EXIT_FAILURE);
+    }
+    return TaskStatus::complete;
+  }
+
   // wait for all non-blocking receives for vars to finish before continuing
   for (int m=0; m<nmb; ++m) {
     for (int n=0; n<nnghbr; ++n) {
@@ -119,11 +278,27 @@ TaskStatus MeshBoundaryValues::ClearRecv() {
 
 TaskStatus MeshBoundaryValues::ClearSend() {
 #if MPI_PARALLEL_ENABLED
+  // time spent waiting here counts towards the MPI wait fraction when profiling
+  profiler::RegionTimer rguard("mpi_wait_vars_send");
   bool no_errors=true;
   int &nmb = pmy_pack->nmb_thispack;
   int &nnghbr = pmy_pack->pmb->nnghbr;
   auto &nghbr = pmy_pack->pmb->nghbr;
 
+  // with coalesced comm, wait on single aggregated send per remote rank instead
+  if (coalesced_comm) {
+    for (int r=0; r<ncoal_send; ++r) {
+      int ierr = MPI_Wait(&(coal_send_req[r]), MPI_STATUS_IGNORE);
+      if (ierr != MPI_SUCCESS) {no_errors=false;}
+    }
+    if (!(no_errors)) {
+      std::cout << "### FATAL ERROR in " << __FILE__ << " at line " << __LINE__
+         << std::endl << "MPI error in clearing sends" << std::endl;
+      std::exit(EXIT_FAILURE);
+    }
+    return TaskStatus::complete;
+  }
+
   // wait for all non-blocking sends for vars to finish before continuing
   for (int m=0; m<nmb; ++m) {
     for (int n=0; n<nnghbr; ++n) {
@@ -152,10 +327,16 @@ TaskStatus MeshBoundaryValues::ClearSend() {
 TaskStatus MeshBoundaryValues::ClearFluxRecv() {
   bool no_errors=true;
 #if MPI_PARALLEL_ENABLED
+  // time spent waiting here counts towards the MPI wait fraction when profiling
+  profiler::RegionTimer rguard("mpi_wait_flux_recv");
   int &nmb = pmy_pack->nmb_thispack;
   int &nnghbr = pmy_pack->pmb->nnghbr;
   auto &nghbr = pmy_pack->pmb->nghbr;
 
+  // with neighborhood collective, the single exchange is always completed by the
+  // recv/unpack task, and there are no per-buffer receives to wait on
+  if (nbrhd_flux_comm) {return TaskStatus::complete;}
+
   // wait for all non-blocking receives for fluxes to finish before continuing
   for (int m=0; m<nmb; ++m) {
     for (int n=0; n<nnghbr; ++n) {
@@ -181,10 +362,24 @@ TaskStatus MeshBoundaryValues::ClearFluxRecv() {
 TaskStatus MeshBoundaryValues::ClearFluxSend() {
   bool no_errors=true;
 #if MPI_PARALLEL_ENABLED
+  // time spent waiting here counts towards the MPI wait fraction when profiling
+  profiler::RegionTimer rguard("mpi_wait_flux_send");
   int &nmb = pmy_pack->nmb_thispack;
   int &nnghbr = pmy_pack->pmb->nnghbr;
   auto &nghbr = pmy_pack->pmb->nghbr;
 
+  // with neighborhood collective, the single exchange normally completes in the
+  // recv/unpack task; wait here in case it is still in flight
+  if (nbrhd_flux_comm) {
+    if (flux_nbrhd_started) {
+      int ierr = MPI_Wait(&flux_nbrhd_req, MPI_STATUS_IGNORE);
+      if (ierr != MPI_SUCCESS) {no_errors=false;}
+      flux_nbrhd_started = false;
+    }
+    if (no_errors) return TaskStatus::complete;
+    return TaskStatus::fail;
+  }
+
   // wait for all non-blocking sends for fluxes to finish before continuing
   for (int m=0; m<nmb; ++m) {
     for (int n=0; n<nnghbr; ++n) {
@@ -201,3 +396,299 @@ TaskStatus MeshBoundaryValues::ClearFluxSend() {
 
   return TaskStatus::fail;
 }
+
+#if MPI_PARALLEL_ENABLED
+//----------------------------------------------------------------------------------------
+//! \fn  void MeshBoundaryValues::PackAndSendCoalesced
+//! \brief Gathers all variable send buffers destined for other ranks into contiguous
+//! per-rank messages, then posts one non-blocking send per remote rank.  Used by both CC
+//! and FC communication functions in place of per-buffer sends when coalescing enabled.
+
+void MeshBoundaryValues::PackAndSendCoalesced() {
+  if (comm_stale) {InitCoalescedIndices();}
+
+  // gather kernel: one team per buffer, copying packed data into message arena
+  int nsbuf = coal_send_buf.h_view.extent_int(0);
+  auto &cbuf = coal_send_buf;
+  auto &cdata = coal_send_data;
+  auto &sbuf = sendbuf;
+  Kokkos::TeamPolicy<> policy(DevExeSpace(), nsbuf, Kokkos::AUTO);
+  Kokkos::parallel_for("CoalSend", policy, KOKKOS_LAMBDA(TeamMember_t tmember) {
+    const int b = tmember.league_rank();
+    const int m = cbuf.d_view(b).m;
+    const int n = cbuf.d_view(b).n;
+    const int cnt = cbuf.d_view(b).cnt;
+    const int offset = cbuf.d_view(b).offset;
+    Kokkos::parallel_for(Kokkos::TeamThreadRange<>(tmember, cnt), [&](const int i) {
+      cdata(offset + i) = sbuf[n].vars(m,i);
+    });
+  });
+
+  // start one aggregated persistent send per remote rank
+#if MPI_GPU_AWARE_ENABLED
+  Kokkos::fence();
+#else
+  // stage message arena through host when MPI cannot access device memory
+  // (blocking deep_copy also fences the gather kernel above)
+  Kokkos::deep_copy(coal_send_data_h, coal_send_data);
+#endif
+  int ierr = MPI_Startall(ncoal_send, coal_send_req.data());
+  // Quit if MPI error detected
+  if (ierr != MPI_SUCCESS) {
+    std::cout << "### FATAL ERROR in " << __FILE__ << " at line " << __LINE__
+       << std::endl << "MPI error in starting persistent sends" << std::endl;
+    std::exit(EXIT_FAILURE);
+  }
+  return;
+}
+
+//----------------------------------------------------------------------------------------
+//! \fn  TaskStatus MeshBoundaryValues::RecvCoalescedAndScatter
+//! \brief Checks whether the aggregated message from every remote rank has arrived, and
+//! if so scatters data back into the individual recv buffers so that CC/FC unpack
+//! kernels can proceed unchanged.  Returns incomplete if any message is still in flight.
+
+TaskStatus MeshBoundaryValues::RecvCoalescedAndScatter() {
+  // check that aggregated receives from all remote ranks have completed
+  bool bflag = false;
+  bool no_errors=true;
+  for (int r=0; r<ncoal_recv; ++r) {
+    int test;
+    int ierr = MPI_Test(&(coal_recv_req[r]), &test, MPI_STATUS_IGNORE);
+    if (ierr != MPI_SUCCESS) {no_errors=false;}
+    if (!(static_cast<bool>(test))) {
+      bflag = true;
+    }
+  }
+  // Quit if MPI error detected
+  if (!(no_errors)) {
+    std::cout << "### FATAL ERROR in " << __FILE__ << " at line " << __LINE__
+       << std::endl << "MPI error in testing non-blocking receives" << std::endl;
+    std::exit(EXIT_FAILURE);
+  }
+  // exit if any coalesced message has not arrived
+  if (bflag) {return TaskStatus::incomplete;}
+
+#if !(MPI_GPU_AWARE_ENABLED)
+  // messages were staged through host, so copy arena to device before scattering
+  Kokkos::deep_copy(coal_recv_data, coal_recv_data_h);
+#endif
+
+  // scatter kernel: one team per buffer, copying message arena into recv buffers.
+  // No fence needed since unpack kernels are ordered behind this in execution space.
+  int nrbuf = coal_recv_buf.h_view.extent_int(0);
+  auto &cbuf = coal_recv_buf;
+  auto &cdata = coal_recv_data;
+  auto &rbuf = recvbuf;
+  Kokkos::TeamPolicy<> policy(DevExeSpace(), nrbuf, Kokkos::AUTO);
+  Kokkos::parallel_for("CoalRecv", policy, KOKKOS_LAMBDA(TeamMember_t tmember) {
+    const int b = tmember.league_rank();
+    const int m = cbuf.d_view(b).m;
+    const int n = cbuf.d_view(b).n;
+    const int cnt = cbuf.d_view(b).cnt;
+    const int offset = cbuf.d_view(b).offset;
+    Kokkos::parallel_for(Kokkos::TeamThreadRange<>(tmember, cnt), [&](const int i) {
+      rbuf[n].vars(m,i) = cdata(offset + i);
+    });
+  });
+
+  return TaskStatus::complete;
+}
+
+//----------------------------------------------------------------------------------------
+//! \fn  void MeshBoundaryValues::PackAndSendFluxNbrhd
+//! \brief Gathers all flux-correction send buffers destined for other ranks into
+//! contiguous per-rank messages, then starts a single non-blocking neighborhood
+//! collective (MPI_Ineighbor_alltoallv) that exchanges every message at once.  Used by
+//! both CC and FC flux correction functions in place of per-buffer sends when enabled.
+
+void MeshBoundaryValues::PackAndSendFluxNbrhd() {
+  if (flux_comm_stale) {InitFluxGraphIndices();}
+
+  // gather kernel: one team per buffer, copying packed flux data into message arena
+  int nsbuf = flx_send_buf.h_view.extent_int(0);
+  auto &cbuf = flx_send_buf;
+  auto &cdata = flx_send_data;
+  auto &sbuf = sendbuf;
+  Kokkos::TeamPolicy<> policy(DevExeSpace(), nsbuf, Kokkos::AUTO);
+  Kokkos::parallel_for("FlxNbrhdSend", policy, KOKKOS_LAMBDA(TeamMember_t tmember) {
+    const int b = tmember.league_rank();
+    const int m = cbuf.d_view(b).m;
+    const int n = cbuf.d_view(b).n;
+    const int cnt = cbuf.d_view(b).cnt;
+    const int offset = cbuf.d_view(b).offset;
+    Kokkos::parallel_for(Kokkos::TeamThreadRange<>(tmember, cnt), [&](const int i) {
+      cdata(offset + i) = sbuf[n].flux(m,i);
+    });
+  });
+  Kokkos::fence();
+
+  // start collective exchange of all per-rank messages.  Every rank participates, even
+  // those with no flux corrections to exchange (zero-degree nodes in the graph).
+  int ierr = MPI_Ineighbor_alltoallv(
+     flx_send_data.data(), flx_send_count.data(), flx_send_disp.data(), MPI_ATHENA_REAL,
+     flx_recv_data.data(), flx_recv_count.data(), flx_recv_disp.data(), MPI_ATHENA_REAL,
+     comm_flux_nbrhd, &flux_nbrhd_req);
+  // Quit if MPI error detected
+  if (ierr != MPI_SUCCESS) {
+    std::cout << "### FATAL ERROR in " << __FILE__ << " at line " << __LINE__
+       << std::endl << "MPI error in starting neighborhood collective" << std::endl;
+    std::exit(EXIT_FAILURE);
+  }
+  flux_nbrhd_started = true;
+  return;
+}
+
+//----------------------------------------------------------------------------------------
+//! \fn  TaskStatus MeshBoundaryValues::RecvFluxNbrhdAndScatter
+//! \brief Checks whether the collective flux-correction exchange has completed, and if
+//! so scatters the per-rank messages back into the individual recv buffers so that CC/FC
+//! unpack kernels can proceed unchanged.  Returns incomplete while still in flight.
+
+TaskStatus MeshBoundaryValues::RecvFluxNbrhdAndScatter() {
+  // test the single request for the neighborhood collective
+  if (flux_nbrhd_started) {
+    int test;
+    int ierr = MPI_Test(&flux_nbrhd_req, &test, MPI_STATUS_IGNORE);
+    // Quit if MPI error detected
+    if (ierr != MPI_SUCCESS) {
+      std::cout << "### FATAL ERROR in " << __FILE__ << " at line " << __LINE__
+         << std::endl << "MPI error in testing neighborhood collective" << std::endl;
+      std::exit(EXIT_FAILURE);
+    }
+    if (!(static_cast<bool>(test))) {return TaskStatus::incomplete;}
+    flux_nbrhd_started = false;
+  }
+
+  // scatter kernel: one team per buffer, copying message arena into recv buffers.
+  // No fence needed since unpack kernels are ordered behind this in execution space.
+  int nrbuf = flx_recv_buf.h_view.extent_int(0);
+  auto &cbuf = flx_recv_buf;
+  auto &cdata = flx_recv_data;
+  auto &rbuf = recvbuf;
+  Kokkos::TeamPolicy<> policy(DevExeSpace(), nrbuf, Kokkos::AUTO);
+  Kokkos::parallel_for("FlxNbrhdRecv", policy, KOKKOS_LAMBDA(TeamMember_t tmember) {
+    const int b = tmember.league_rank();
+    const int m = cbuf.d_view(b).m;
+    const int n = cbuf.d_view(b).n;
+    const int cnt = cbuf.d_view(b).cnt;
+    const int offset = cbuf.d_view(b).offset;
+    Kokkos::parallel_for(Kokkos::TeamThreadRange<>(tmember, cnt), [&](const int i) {
+      rbuf[n].flux(m,i) = cdata(offset + i);
+    });
+  });
+
+  return TaskStatus::complete;
+}
+
+//----------------------------------------------------------------------------------------
+//! \fn  bool MeshBoundaryValues::TestAndStageRecvs
+//! \brief Progressively polls the non-blocking receives for variables through the
+//! per-rank progress engine (see DriveProgress), which advances every outstanding
+//! receive on this rank in one sweep rather than testing only this object's requests.
+//! When messages are staged through host the host->device copy for a buffer is issued
+//! the moment it lands, overlapped with receives still in flight rather than serialized
+//! after the last arrival.  Copies are asynchronous; no fence is needed since unpack
+//! kernels are ordered behind them in the execution space.  Returns true only once
+//! every receive has completed, resetting the per-buffer flags for the next exchange.
+
+bool MeshBoundaryValues::TestAndStageRecvs() {
+  int &nmb = pmy_pack->nmb_thispack;
+  int &nnghbr = pmy_pack->pmb->nnghbr;
+  auto &nghbr = pmy_pack->pmb->nghbr;
+
+  // drive every outstanding receive on this rank (across all physics modules) with a
+  // single MPI_Testsome sweep; arrivals flip the vars_recvd flags scanned below
+  DriveProgress();
+
+  bool bflag = false;
+  for (int m=0; m<nmb; ++m) {
+    for (int n=0; n<nnghbr; ++n) {
+      if (nghbr.h_view(m,n).gid >= 0) { // neighbor exists and not a physical boundary
+        if (nghbr.h_view(m,n).rank != global_variable::my_rank) {
+          if (vars_recvd(m,n) == 0) {  // message still in flight
+            bflag = true;
+          } else if (vars_recvd(m,n) == 1) {  // arrived but not yet staged
+            vars_recvd(m,n) = 2;
+#if !(MPI_GPU_AWARE_ENABLED)
+            // message was staged through host, so copy this buffer to device now
+            if (single_prec_vars || transform_vars) {
+              Kokkos::deep_copy(DevExeSpace(),
+                                Kokkos::subview(recvbuf[n].vars_sp, m, Kokkos::ALL),
+                                Kokkos::subview(recvbuf[n].vars_sp_h, m, Kokkos::ALL));
+            } else {
+              Kokkos::deep_copy(DevExeSpace(),
+                                Kokkos::subview(recvbuf[n].vars, m, Kokkos::ALL),
+                                Kokkos::subview(recvbuf[n].vars_h, m, Kokkos::ALL));
+            }
+#endif
+          }
+        }
+      }
+    }
+  }
+  if (bflag) {return false;}
+
+  // with single-precision transport, up-convert the float shadow buffers into the Real
+  // buffers read by the unpack kernels.  No fence is needed: the conversions are ordered
+  // behind the staging copies above and ahead of the unpack kernels in the exec space
+  if (single_prec_vars) {
+    auto &rbuf = recvbuf;
+    int my_rank = global_variable::my_rank;
+    int nn = nnghbr;
+    Kokkos::TeamPolicy<> policy(DevExeSpace(), (nmb*nn), Kokkos::AUTO);
+    Kokkos::parallel_for("RecvBuffSP", policy, KOKKOS_LAMBDA(TeamMember_t tmember) {
+      const int m = tmember.league_rank()/nn;
+      const int n = tmember.league_rank() - m*nn;
+      if ((nghbr.d_view(m,n).gid >= 0) && (nghbr.d_view(m,n).rank != my_rank)) {
+        const int ndat = rbuf[n].vars.extent_int(1);
+        Kokkos::parallel_for(Kokkos::TeamThreadRange<>(tmember, ndat), [&](const int i) {
+          rbuf[n].vars(m,i) = static_cast<Real>(rbuf[n].vars_sp(m,i));
+        });
+      }
+    });
+  }
+
+  // with transform-coded transport (Z4c), decode each variable's slab by recombining
+  // the hi/lo float pair holding the slab mean and adding the float residuals
+  if (transform_vars) {
+    auto &rbuf = recvbuf;
+    auto &mblev = pmy_pack->pmb->mb_lev;
+    int my_rank = global_variable::my_rank;
+    int nn = nnghbr;
+    int nv = nvar_;
+    Kokkos::TeamPolicy<> policy(DevExeSpace(), (nmb*nn), Kokkos::AUTO);
+    Kokkos::parallel_for("RecvBuffTC", policy, KOKKOS_LAMBDA(TeamMember_t tmember) {
+      const int m = tmember.league_rank()/nn;
+      const int n = tmember.league_rank() - m*nn;
+      if ((nghbr.d_view(m,n).gid >= 0) && (nghbr.d_view(m,n).rank != my_rank)) {
+        // number of cells per variable in this message depends on neighbor level
+        int ndat;
+        if (nghbr.d_view(m,n).lev < mblev.d_view(m)) {
+          ndat = rbuf[n].icoar_ndat;
+        } else if (nghbr.d_view(m,n).lev == mblev.d_view(m)) {
+          ndat = rbuf[n].isame_z4c_ndat;
+        } else {
+          ndat = rbuf[n].ifine_ndat;
+        }
+        for (int v=0; v<nv; ++v) {
+          const int vs = v*(ndat + 2);
+          const Real vmean = static_cast<Real>(rbuf[n].vars_sp(m,vs))
+                           + static_cast<Real>(rbuf[n].vars_sp(m,vs+1));
+          Kokkos::parallel_for(Kokkos::TeamThreadRange<>(tmember, ndat),
+          [&](const int i) {
+            rbuf[n].vars(m,v*ndat+i) =
+                vmean + static_cast<Real>(rbuf[n].vars_sp(m,vs+2+i));
+          });
+        }
+      }
+    });
+  }
+
+  // every message has arrived and is staged; reset flags for the next exchange
+  for (int m=0; m<nmb; ++m) {
+    for (int n=0; n<nnghbr; ++n) {vars_recvd(m,n) = 0;}
+  }
+  return true;
+}
+#endif
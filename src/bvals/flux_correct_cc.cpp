@@ -27,6 +27,18 @@
 //! block boundaries.
 
 TaskStatus MeshBoundaryValuesCC::PackAndSendFluxCC(DvceFaceFld5D<Real> &flx) {
+  // blocks only send flux corrections across faces shared with a COARSER neighbor;
+  // when no block in this pack has any (counted per topology change) the pack kernel
+  // and sends can be skipped entirely.  The neighborhood collective must still be
+  // entered, since the exchange is collective over the graph communicator.
+  if (flux_faces_stale) {CountFluxFaces();}
+  if (nflx_send_faces == 0) {
+#if MPI_PARALLEL_ENABLED
+    if (nbrhd_flux_comm) {PackAndSendFluxNbrhd();}
+#endif
+    return TaskStatus::complete;
+  }
+
   // create local references for variables in kernel
   int nmb = pmy_pack->nmb_thispack;
   int nnghbr = pmy_pack->pmb->nnghbr;
@@ -155,6 +167,13 @@ TaskStatus MeshBoundaryValuesCC::PackAndSendFluxCC(DvceFaceFld5D<Real> &flx) {
   });  // end par_for_outer
 
 #if MPI_PARALLEL_ENABLED
+  // with neighborhood collective, exchange all flux buffers in one collective call
+  // instead of posting per-buffer sends below
+  if (nbrhd_flux_comm) {
+    PackAndSendFluxNbrhd();
+    return TaskStatus::complete;
+  }
+
   // Send boundary buffer to neighboring MeshBlocks using MPI
   // Sends only occur to neighbors on FACES at a COARSER level
   Kokkos::fence();
@@ -199,6 +218,20 @@ TaskStatus MeshBoundaryValuesCC::PackAndSendFluxCC(DvceFaceFld5D<Real> &flx) {
 //! \brief Unpack boundary buffers for flux correction of CC variables.
 
 TaskStatus MeshBoundaryValuesCC::RecvAndUnpackFluxCC(DvceFaceFld5D<Real> &flx) {
+  // blocks only receive flux corrections across faces shared with a FINER neighbor;
+  // skip the arrival polls and unpack kernel when no block in this pack has any.  The
+  // neighborhood collective exchange must still be completed when it was started.
+  if (flux_faces_stale) {CountFluxFaces();}
+  if (nflx_recv_faces == 0) {
+#if MPI_PARALLEL_ENABLED
+    if (nbrhd_flux_comm) {
+      TaskStatus tstat = RecvFluxNbrhdAndScatter();
+      if (tstat != TaskStatus::complete) {return tstat;}
+    }
+#endif
+    return TaskStatus::complete;
+  }
+
   // create local references for variables in kernel
   int nmb = pmy_pack->nmb_thispack;
   int nnghbr = pmy_pack->pmb->nnghbr;
@@ -209,33 +242,40 @@ TaskStatus MeshBoundaryValuesCC::RecvAndUnpackFluxCC(DvceFaceFld5D<Real> &flx) {
   //----- STEP 1: check that recv boundary buffer communications have all completed
   // receives only occur for neighbors on faces at a FINER level
 
-  bool bflag = false;
-  bool no_errors=true;
-  for (int m=0; m<nmb; ++m) {
-    for (int n=0; n<nnghbr; ++n) {
-      if ( (nghbr.h_view(m,n).gid >=0) &&
-           (nghbr.h_view(m,n).lev > mblev.h_view(m)) &&
-           ((n<16) || ((n>=24) && (n<32))) ) {
-        if (nghbr.h_view(m,n).rank != global_variable::my_rank) {
-          int test;
-          int ierr = MPI_Test(&(rbuf[n].flux_req[m]), &test, MPI_STATUS_IGNORE);
-          if (ierr != MPI_SUCCESS) {no_errors=false;}
-          if (!(static_cast<bool>(test))) {
-            bflag = true;
+  // with neighborhood collective, test the single exchange and scatter the per-rank
+  // messages into recv buffers instead
+  if (nbrhd_flux_comm) {
+    TaskStatus tstat = RecvFluxNbrhdAndScatter();
+    if (tstat != TaskStatus::complete) {return tstat;}
+  } else {
+    bool bflag = false;
+    bool no_errors=true;
+    for (int m=0; m<nmb; ++m) {
+      for (int n=0; n<nnghbr; ++n) {
+        if ( (nghbr.h_view(m,n).gid >=0) &&
+             (nghbr.h_view(m,n).lev > mblev.h_view(m)) &&
+             ((n<16) || ((n>=24) && (n<32))) ) {
+          if (nghbr.h_view(m,n).rank != global_variable::my_rank) {
+            int test;
+            int ierr = MPI_Test(&(rbuf[n].flux_req[m]), &test, MPI_STATUS_IGNORE);
+            if (ierr != MPI_SUCCESS) {no_errors=false;}
+            if (!(static_cast<bool>(test))) {
+              bflag = true;
+            }
           }
         }
       }
     }
+    // Quit if MPI error detected
+    if (!(no_errors)) {
+      std::cout << "### FATAL ERROR in " << __FILE__ << " at line " << __LINE__
+                << std::endl << "MPI error in testing non-blocking receives"
+                << std::endl;
+      std::exit(EXIT_FAILURE);
+    }
+    // exit if recv boundary buffer communications have not completed
+    if (bflag) {return TaskStatus::incomplete;}
   }
-  // Quit if MPI error detected
-  if (!(no_errors)) {
-    std::cout << "### FATAL ERROR in " << __FILE__ << " at line " << __LINE__
-              << std::endl << "MPI error in testing non-blocking receives"
-              << std::endl;
-    std::exit(EXIT_FAILURE);
-  }
-  // exit if recv boundary buffer communications have not completed
-  if (bflag) {return TaskStatus::incomplete;}
 #endif
 
   //----- STEP 2: buffers have all completed, so unpack
@@ -311,6 +351,14 @@ TaskStatus MeshBoundaryValuesCC::InitFluxRecv(const int nvars) {
   int &nnghbr = pmy_pack->pmb->nnghbr;
   auto &nghbr = pmy_pack->pmb->nghbr;
 
+  // no receives need to be posted with neighborhood collective exchange
+  if (nbrhd_flux_comm) {return TaskStatus::complete;}
+
+  // only blocks with a finer face neighbor receive flux corrections; skip the scan
+  // over every buffer when this pack has none
+  if (flux_faces_stale) {CountFluxFaces();}
+  if (nflx_recv_faces == 0) {return TaskStatus::complete;}
+
   // Initialize communications of fluxes
   bool no_errors=true;
   for (int m=0; m<nmb; ++m) {
@@ -349,3 +397,65 @@ TaskStatus MeshBoundaryValuesCC::InitFluxRecv(const int nvars) {
 #endif
   return TaskStatus::complete;
 }
+
+//----------------------------------------------------------------------------------------
+//! \fn void MeshBoundaryValuesCC::CountFluxFaces
+//! \brief Counts the (MeshBlock, face) pairs in this pack that participate in the flux
+//! correction step in each direction: sends go to FACE neighbors at a COARSER level,
+//! receives come from FACE neighbors at a FINER level (on any rank, since same-rank
+//! corrections are delivered through the recv buffers as well).  Recomputed on first
+//! use and whenever a remesh changes the neighbor connectivity, so on packs with no
+//! level mismatch the per-stage flux-correction tasks reduce to a counter check.
+
+void MeshBoundaryValuesCC::CountFluxFaces() {
+  int &nmb = pmy_pack->nmb_thispack;
+  int &nnghbr = pmy_pack->pmb->nnghbr;
+  auto &nghbr = pmy_pack->pmb->nghbr;
+  auto &mblev = pmy_pack->pmb->mb_lev;
+  nflx_send_faces = 0;
+  nflx_recv_faces = 0;
+  for (int m=0; m<nmb; ++m) {
+    for (int n=0; n<nnghbr; ++n) {
+      if ( (nghbr.h_view(m,n).gid >= 0) && ((n<16) || ((n>=24) && (n<32))) ) {
+        if (nghbr.h_view(m,n).lev < mblev.h_view(m)) {nflx_send_faces++;}
+        if (nghbr.h_view(m,n).lev > mblev.h_view(m)) {nflx_recv_faces++;}
+      }
+    }
+  }
+  flux_faces_stale = false;
+  return;
+}
+
+#if MPI_PARALLEL_ENABLED
+//----------------------------------------------------------------------------------------
+//! \fn int MeshBoundaryValuesCC::FluxSendCount
+//! \brief Returns number of Reals the given buffer contributes to the per-rank messages
+//! exchanged by the flux-correction neighborhood collective.  Fluxes of CC variables are
+//! only sent to neighbors on FACES at a COARSER level (same conditions as per-buffer
+//! sends in PackAndSendFluxCC() above).
+
+int MeshBoundaryValuesCC::FluxSendCount(int m, int n) {
+  auto &nghbr = pmy_pack->pmb->nghbr;
+  auto &mblev = pmy_pack->pmb->mb_lev;
+  if ( (nghbr.h_view(m,n).lev < mblev.h_view(m)) &&
+       ((n<16) || ((n>=24) && (n<32))) ) {
+    return nvar_*(sendbuf[n].iflxc_ndat);
+  }
+  return 0;
+}
+
+//----------------------------------------------------------------------------------------
+//! \fn int MeshBoundaryValuesCC::FluxRecvCount
+//! \brief Same as FluxSendCount(), but for receives, which only occur from neighbors on
+//! FACES at a FINER level.
+
+int MeshBoundaryValuesCC::FluxRecvCount(int m, int n) {
+  auto &nghbr = pmy_pack->pmb->nghbr;
+  auto &mblev = pmy_pack->pmb->mb_lev;
+  if ( (nghbr.h_view(m,n).lev > mblev.h_view(m)) &&
+       ((n<16) || ((n>=24) && (n<32))) ) {
+    return nvar_*(recvbuf[n].iflxc_ndat);
+  }
+  return 0;
+}
+#endif
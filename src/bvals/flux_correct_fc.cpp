@@ -326,6 +326,13 @@ TaskStatus MeshBoundaryValuesFC::PackAndSendFluxFC(DvceEdgeFld4D<Real> &flx) {
   });  // end par_for_outer
 
 #if MPI_PARALLEL_ENABLED
+  // with neighborhood collective, exchange all flux buffers in one collective call
+  // instead of posting per-buffer sends below
+  if (nbrhd_flux_comm) {
+    PackAndSendFluxNbrhd();
+    return TaskStatus::complete;
+  }
+
   // Send boundary buffer to neighboring MeshBlocks using MPI
   // Sends only occur to neighbors on FACES and EDGES at COARSER or SAME level
   Kokkos::fence();
@@ -387,33 +394,40 @@ TaskStatus MeshBoundaryValuesFC::RecvAndUnpackFluxFC(DvceEdgeFld4D<Real> &flx) {
   //----- STEP 1: check that recv boundary buffer communications have all completed
   // receives only occur for neighbors on faces and edges at FINER or SAME level
 
-  bool bflag = false;
-  bool no_errors=true;
-  for (int m=0; m<nmb; ++m) {
-    for (int n=0; n<nnghbr; ++n) {
-      if ( (nghbr.h_view(m,n).gid >=0) &&
-           (nghbr.h_view(m,n).lev >= mblev.h_view(m)) &&
-           (n<48) ) {
-        if (nghbr.h_view(m,n).rank != global_variable::my_rank) {
-          int test;
-          int ierr = MPI_Test(&(rbuf[n].flux_req[m]), &test, MPI_STATUS_IGNORE);
-          if (ierr != MPI_SUCCESS) {no_errors=false;}
-          if (!(static_cast<bool>(test))) {
-            bflag = true;
+  // with neighborhood collective, test the single exchange and scatter the per-rank
+  // messages into recv buffers instead
+  if (nbrhd_flux_comm) {
+    TaskStatus tstat = RecvFluxNbrhdAndScatter();
+    if (tstat != TaskStatus::complete) {return tstat;}
+  } else {
+    bool bflag = false;
+    bool no_errors=true;
+    for (int m=0; m<nmb; ++m) {
+      for (int n=0; n<nnghbr; ++n) {
+        if ( (nghbr.h_view(m,n).gid >=0) &&
+             (nghbr.h_view(m,n).lev >= mblev.h_view(m)) &&
+             (n<48) ) {
+          if (nghbr.h_view(m,n).rank != global_variable::my_rank) {
+            int test;
+            int ierr = MPI_Test(&(rbuf[n].flux_req[m]), &test, MPI_STATUS_IGNORE);
+            if (ierr != MPI_SUCCESS) {no_errors=false;}
+            if (!(static_cast<bool>(test))) {
+              bflag = true;
+            }
           }
         }
       }
     }
+    // Quit if MPI error detected
+    if (!(no_errors)) {
+      std::cout << "### FATAL ERROR in " << __FILE__ << " at line " << __LINE__
+                << std::endl << "MPI error in testing non-blocking receives"
+                << std::endl;
+      std::exit(EXIT_FAILURE);
+    }
+    // exit if recv boundary buffer communications have not completed
+    if (bflag) {return TaskStatus::incomplete;}
   }
-  // Quit if MPI error detected
-  if (!(no_errors)) {
-    std::cout << "### FATAL ERROR in " << __FILE__ << " at line " << __LINE__
-              << std::endl << "MPI error in testing non-blocking receives"
-              << std::endl;
-    std::exit(EXIT_FAILURE);
-  }
-  // exit if recv boundary buffer communications have not completed
-  if (bflag) {return TaskStatus::incomplete;}
 #endif
 
   //----- STEP 2: buffers have all completed, so unpack and perform appropriate averaging
@@ -1045,6 +1059,9 @@ TaskStatus MeshBoundaryValuesFC::InitFluxRecv(const int nvars) {
   int &nnghbr = pmy_pack->pmb->nnghbr;
   auto &nghbr = pmy_pack->pmb->nghbr;
 
+  // no receives need to be posted with neighborhood collective exchange
+  if (nbrhd_flux_comm) {return TaskStatus::complete;}
+
   // Initialize communications of fluxes
   bool no_errors=true;
   for (int m=0; m<nmb; ++m) {
@@ -1088,3 +1105,41 @@ TaskStatus MeshBoundaryValuesFC::InitFluxRecv(const int nvars) {
 #endif
   return TaskStatus::complete;
 }
+
+#if MPI_PARALLEL_ENABLED
+//----------------------------------------------------------------------------------------
+//! \fn int MeshBoundaryValuesFC::FluxSendCount
+//! \brief Returns number of Reals the given buffer contributes to the per-rank messages
+//! exchanged by the flux-correction neighborhood collective.  Fluxes (EMFs) of FC fields
+//! are sent to neighbors on FACES and EDGES at COARSER or SAME levels (same conditions
+//! as per-buffer sends in PackAndSendFluxFC() above), with 3 field components.
+
+int MeshBoundaryValuesFC::FluxSendCount(int m, int n) {
+  auto &nghbr = pmy_pack->pmb->nghbr;
+  auto &mblev = pmy_pack->pmb->mb_lev;
+  if ( (nghbr.h_view(m,n).lev <= mblev.h_view(m)) && (n<48) ) {
+    if (nghbr.h_view(m,n).lev < mblev.h_view(m)) {
+      return 3*(sendbuf[n].iflxc_ndat);
+    }
+    return 3*(sendbuf[n].iflxs_ndat);
+  }
+  return 0;
+}
+
+//----------------------------------------------------------------------------------------
+//! \fn int MeshBoundaryValuesFC::FluxRecvCount
+//! \brief Same as FluxSendCount(), but for receives, which only occur from neighbors on
+//! FACES and EDGES at FINER or SAME levels.
+
+int MeshBoundaryValuesFC::FluxRecvCount(int m, int n) {
+  auto &nghbr = pmy_pack->pmb->nghbr;
+  auto &mblev = pmy_pack->pmb->mb_lev;
+  if ( (nghbr.h_view(m,n).lev >= mblev.h_view(m)) && (n<48) ) {
+    if (nghbr.h_view(m,n).lev > mblev.h_view(m)) {
+      return 3*(recvbuf[n].iflxc_ndat);
+    }
+    return 3*(recvbuf[n].iflxs_ndat);
+  }
+  return 0;
+}
+#endif
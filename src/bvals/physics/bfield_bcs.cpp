@@ -30,8 +30,10 @@ void MeshBoundaryValues::BFieldBCs(MeshBlockPack *ppack, DualArray2D<Real> b_in,
   int n3 = (indcs.nx3 > 1)? (indcs.nx3 + 2*ng) : 1;
   int nmb = ppack->nmb_thispack;
 
-  // only apply BCs if not periodic
-  if (pm->mesh_bcs[BoundaryFace::inner_x1] != BoundaryFlag::periodic) {
+  // only apply BCs if not periodic, and only if some MeshBlock in the pack actually
+  // has a built-in physical BC face (skips empty kernel launches)
+  if (pm->mesh_bcs[BoundaryFace::inner_x1] != BoundaryFlag::periodic &&
+      AnyPhysicalBCs(ppack, BoundaryFace::inner_x1, BoundaryFace::outer_x1)) {
     int &is = indcs.is;
     int &ie = indcs.ie;
     par_for("bfield-bc_x1", DevExeSpace(), 0,(nmb-1),0,(n3-1),0,(n2-1),
@@ -117,8 +119,9 @@ void MeshBoundaryValues::BFieldBCs(MeshBlockPack *ppack, DualArray2D<Real> b_in,
   }
   if (pm->one_d) return;
 
-  // only apply BCs if not periodic
-  if (pm->mesh_bcs[BoundaryFace::inner_x2] != BoundaryFlag::periodic) {
+  // only apply BCs if not periodic and some MeshBlock has a physical x2-face
+  if (pm->mesh_bcs[BoundaryFace::inner_x2] != BoundaryFlag::periodic &&
+      AnyPhysicalBCs(ppack, BoundaryFace::inner_x2, BoundaryFace::outer_x2)) {
     int &js = indcs.js;
     int &je = indcs.je;
     par_for("bfield-bc_x2", DevExeSpace(), 0,(nmb-1),0,(n3-1),0,(n1-1),
@@ -204,8 +207,11 @@ void MeshBoundaryValues::BFieldBCs(MeshBlockPack *ppack, DualArray2D<Real> b_in,
   }
   if (pm->two_d) return;
 
-  // only apply BCs if not periodic
-  if (pm->mesh_bcs[BoundaryFace::inner_x3] == BoundaryFlag::periodic) return;
+  // only apply BCs if not periodic and some MeshBlock has a physical x3-face
+  if (pm->mesh_bcs[BoundaryFace::inner_x3] == BoundaryFlag::periodic ||
+      !(AnyPhysicalBCs(ppack, BoundaryFace::inner_x3, BoundaryFace::outer_x3))) {
+    return;
+  }
   int &ks = indcs.ks;
   int &ke = indcs.ke;
   par_for("bfield-bc_x3", DevExeSpace(), 0,(nmb-1),0,(n2-1),0,(n1-1),
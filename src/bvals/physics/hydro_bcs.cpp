@@ -33,9 +33,11 @@ void MeshBoundaryValues::HydroBCs(MeshBlockPack *ppack, DualArray2D<Real> u_in,
   int nvar = u0.extent_int(1);  // TODO(@user): 2nd index from L of in array must be NVAR
   int nmb = ppack->nmb_thispack;
 
-  // only apply BCs unless periodic or shear_periodic
+  // only apply BCs unless periodic or shear_periodic, and only if some MeshBlock in
+  // the pack actually has a built-in physical BC face (skips empty kernel launches)
   if (pm->mesh_bcs[BoundaryFace::inner_x1] != BoundaryFlag::periodic &&
-      pm->mesh_bcs[BoundaryFace::inner_x1] != BoundaryFlag::shear_periodic) {
+      pm->mesh_bcs[BoundaryFace::inner_x1] != BoundaryFlag::shear_periodic &&
+      AnyPhysicalBCs(ppack, BoundaryFace::inner_x1, BoundaryFace::outer_x1)) {
     int &is = indcs.is;
     int &ie = indcs.ie;
     par_for("hydrobc_x1", DevExeSpace(), 0,(nmb-1),0,(nvar-1),0,(n3-1),0,(n2-1),
@@ -122,8 +124,9 @@ void MeshBoundaryValues::HydroBCs(MeshBlockPack *ppack, DualArray2D<Real> u_in,
 
   if (pm->one_d) return;
 
-  // only apply BCs if not periodic
-  if (pm->mesh_bcs[BoundaryFace::inner_x2] != BoundaryFlag::periodic) {
+  // only apply BCs if not periodic and some MeshBlock has a physical x2-face
+  if (pm->mesh_bcs[BoundaryFace::inner_x2] != BoundaryFlag::periodic &&
+      AnyPhysicalBCs(ppack, BoundaryFace::inner_x2, BoundaryFace::outer_x2)) {
     int &js = indcs.js;
     int &je = indcs.je;
     par_for("hydrobc_x2", DevExeSpace(), 0,(nmb-1),0,(nvar-1),0,(n3-1),0,(n1-1),
@@ -209,8 +212,11 @@ void MeshBoundaryValues::HydroBCs(MeshBlockPack *ppack, DualArray2D<Real> u_in,
   }
   if (pm->two_d) return;
 
-  // only apply BCs if not periodic
-  if (pm->mesh_bcs[BoundaryFace::inner_x3] == BoundaryFlag::periodic) return;
+  // only apply BCs if not periodic and some MeshBlock has a physical x3-face
+  if (pm->mesh_bcs[BoundaryFace::inner_x3] == BoundaryFlag::periodic ||
+      !(AnyPhysicalBCs(ppack, BoundaryFace::inner_x3, BoundaryFace::outer_x3))) {
+    return;
+  }
   int &ks = indcs.ks;
   int &ke = indcs.ke;
   par_for("hydrobc_x3", DevExeSpace(), 0,(nmb-1),0,(nvar-1),0,(n2-1),0,(n1-1),
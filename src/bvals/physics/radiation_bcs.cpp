@@ -32,7 +32,8 @@ void MeshBoundaryValues::RadiationBCs(MeshBlockPack *ppack, DualArray2D<Real> i_
   int nmb = ppack->nmb_thispack;
 
   // only apply BCs if not periodic
-  if (pm->mesh_bcs[BoundaryFace::inner_x1] != BoundaryFlag::periodic) {
+  if (pm->mesh_bcs[BoundaryFace::inner_x1] != BoundaryFlag::periodic &&
+      AnyPhysicalBCs(ppack, BoundaryFace::inner_x1, BoundaryFace::outer_x1)) {
     int &is = indcs.is;
     int &ie = indcs.ie;
     par_for("radiationbc_x1", DevExeSpace(), 0,(nmb-1),0,(nvar-1),0,(n3-1),0,(n2-1),
@@ -73,7 +74,8 @@ void MeshBoundaryValues::RadiationBCs(MeshBlockPack *ppack, DualArray2D<Real> i_
   if (pm->one_d) return;
 
   // only apply BCs if not periodic
-  if (pm->mesh_bcs[BoundaryFace::inner_x2] != BoundaryFlag::periodic) {
+  if (pm->mesh_bcs[BoundaryFace::inner_x2] != BoundaryFlag::periodic &&
+      AnyPhysicalBCs(ppack, BoundaryFace::inner_x2, BoundaryFace::outer_x2)) {
     int &js = indcs.js;
     int &je = indcs.je;
     par_for("radiationbc_x2", DevExeSpace(), 0,(nmb-1),0,(nvar-1),0,(n3-1),0,(n1-1),
@@ -113,8 +115,11 @@ void MeshBoundaryValues::RadiationBCs(MeshBlockPack *ppack, DualArray2D<Real> i_
   }
   if (pm->two_d) return;
 
-  // only apply BCs if not periodic
-  if (pm->mesh_bcs[BoundaryFace::inner_x3] == BoundaryFlag::periodic) return;
+  // only apply BCs if not periodic and some MeshBlock has a physical x3-face
+  if (pm->mesh_bcs[BoundaryFace::inner_x3] == BoundaryFlag::periodic ||
+      !(AnyPhysicalBCs(ppack, BoundaryFace::inner_x3, BoundaryFace::outer_x3))) {
+    return;
+  }
   int &ks = indcs.ks;
   int &ke = indcs.ke;
   par_for("radiationbc_x3", DevExeSpace(), 0,(nmb-1),0,(nvar-1),0,(n2-1),0,(n1-1),
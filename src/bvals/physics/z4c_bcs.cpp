@@ -138,9 +138,12 @@ void BCHelper(MeshBlockPack *ppack, DualArray2D<Real> u_in, DvceArray5D<Real> u0
   int nvar = u0.extent_int(1);  // TODO(@user): 2nd index from L of in array must be NVAR
   int nmb = ppack->nmb_thispack;
 
-  // only apply BCs unless periodic or shear_periodic
+  // only apply BCs unless periodic or shear_periodic, and only if some MeshBlock in
+  // the pack actually has a built-in physical BC face (skips empty kernel launches)
   if (pm->mesh_bcs[BoundaryFace::inner_x1] != BoundaryFlag::periodic
-      && pm->mesh_bcs[BoundaryFace::inner_x1] != BoundaryFlag::shear_periodic) {
+      && pm->mesh_bcs[BoundaryFace::inner_x1] != BoundaryFlag::shear_periodic
+      && MeshBoundaryValues::AnyPhysicalBCs(ppack, BoundaryFace::inner_x1,
+                                            BoundaryFace::outer_x1)) {
     par_for("z4cbc_x1", DevExeSpace(), 0,(nmb-1),0,(nvar-1),0,(n3-1),0,(n2-1),
     KOKKOS_LAMBDA(int m, int n, int k, int j) {
       // apply physical boundaries to inner_x1
@@ -207,8 +210,10 @@ void BCHelper(MeshBlockPack *ppack, DualArray2D<Real> u_in, DvceArray5D<Real> u0
 
   if (pm->one_d) return;
 
-  // only apply BCs if not periodic
-  if (pm->mesh_bcs[BoundaryFace::inner_x2] != BoundaryFlag::periodic) {
+  // only apply BCs if not periodic and some MeshBlock has a physical x2-face
+  if (pm->mesh_bcs[BoundaryFace::inner_x2] != BoundaryFlag::periodic &&
+      MeshBoundaryValues::AnyPhysicalBCs(ppack, BoundaryFace::inner_x2,
+                                         BoundaryFace::outer_x2)) {
     par_for("z4cbc_x2", DevExeSpace(), 0,(nmb-1),0,(nvar-1),0,(n3-1),0,(n1-1),
     KOKKOS_LAMBDA(int m, int n, int k, int i) {
       // apply physical boundaries to inner_x2
@@ -274,8 +279,12 @@ void BCHelper(MeshBlockPack *ppack, DualArray2D<Real> u_in, DvceArray5D<Real> u0
   }
   if (pm->two_d) return;
 
-  // only apply BCs if not periodic
-  if (pm->mesh_bcs[BoundaryFace::inner_x3] == BoundaryFlag::periodic) return;
+  // only apply BCs if not periodic and some MeshBlock has a physical x3-face
+  if (pm->mesh_bcs[BoundaryFace::inner_x3] == BoundaryFlag::periodic ||
+      !(MeshBoundaryValues::AnyPhysicalBCs(ppack, BoundaryFace::inner_x3,
+                                           BoundaryFace::outer_x3))) {
+    return;
+  }
   par_for("z4cbc_x3", DevExeSpace(), 0,(nmb-1),0,(nvar-1),0,(n2-1),0,(n1-1),
   KOKKOS_LAMBDA(int m, int n, int j, int i) {
     // apply physical boundaries to inner_x3
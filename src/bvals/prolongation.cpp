@@ -29,6 +29,13 @@
 void MeshBoundaryValuesCC::FillCoarseInBndryCC(DvceArray5D<Real> &a,
                                                DvceArray5D<Real> &ca,
                                                bool is_z4c) {
+  // rebuild cached interface census if stale; nothing to do when pack contains no
+  // fine/coarse interfaces, since the coarse array filled here is only consumed by the
+  // prolongation stencils below.  Z4c packs coarse regions into same-level sends that
+  // neighboring packs may prolongate from, so it cannot skip
+  if (prol_stale) {InitProlongationInterfaces();}
+  if ((nprol == 0) && !(is_z4c)) {return;}
+
   // create local references for variables in kernel
   int nmb = pmy_pack->nmb_thispack;
   int nnghbr = pmy_pack->pmb->nnghbr;
@@ -127,6 +134,129 @@ void MeshBoundaryValuesCC::FillCoarseInBndryCC(DvceArray5D<Real> &a,
   return;
 }
 
+//----------------------------------------------------------------------------------------
+//! \fn void RestrictInterfaceCC()
+//! \brief Restricts CC data into coarse array only in cells adjacent to fine/coarse
+//! interfaces, i.e. the cells actually consumed downstream: the regions packed into send
+//! buffers shipped to coarser neighbors (icoar), the interior cells read by the
+//! prolongation interpolation stencil at boundaries with coarser neighbors (contained in
+//! the same regions), and for Z4c the coarse regions appended to same-level sends
+//! (isame_z4c).  Replaces the full-volume restriction sweep in RestrictU tasks; the
+//! full-volume MeshRefinement::RestrictCC is still used on AMR events, where coarse
+//! arrays are consumed over entire MeshBlocks for de-refinement.
+
+void MeshBoundaryValuesCC::RestrictInterfaceCC(DvceArray5D<Real> &a,
+                                               DvceArray5D<Real> &ca,
+                                               bool is_z4c) {
+  // rebuild cached interface census if stale; nothing to do when pack contains no
+  // fine/coarse interfaces (no icoar send regions exist).  Z4c also restricts the
+  // coarse regions appended to same-level sends, so it cannot skip
+  if (prol_stale) {InitProlongationInterfaces();}
+  if ((nprol == 0) && !(is_z4c)) {return;}
+
+  // create local references for variables in kernel
+  int nmb = pmy_pack->nmb_thispack;
+  int nnghbr = pmy_pack->pmb->nnghbr;
+
+  int nvar = a.extent_int(1);  // TODO(@user): 2nd index from L of in array must be NVAR
+  int nmnv = nmb*nnghbr*nvar;
+  auto &nghbr = pmy_pack->pmb->nghbr;
+  auto &mblev = pmy_pack->pmb->mb_lev;
+  auto &sbuf = sendbuf;
+  auto &indcs  = pmy_pack->pmesh->mb_indcs;
+  const bool multi_d = pmy_pack->pmesh->multi_d;
+  const bool three_d = pmy_pack->pmesh->three_d;
+  auto &nx1 = indcs.nx1;
+  auto &nx2 = indcs.nx2;
+  auto &nx3 = indcs.nx3;
+  auto& restrict_2nd = pmy_pack->pmesh->pmr->weights.restrict_2nd;
+  auto& restrict_4th = pmy_pack->pmesh->pmr->weights.restrict_4th;
+  auto& restrict_4th_edge = pmy_pack->pmesh->pmr->weights.restrict_4th_edge;
+
+  // Outer loop over (# of MeshBlocks)*(# of buffers)*(# of variables)
+  Kokkos::TeamPolicy<> policy(DevExeSpace(), nmnv, Kokkos::AUTO);
+  Kokkos::parallel_for("RestrIntfCC", policy, KOKKOS_LAMBDA(TeamMember_t tmember) {
+    const int m = (tmember.league_rank())/(nnghbr*nvar);
+    const int n = (tmember.league_rank() - m*(nnghbr*nvar))/nvar;
+    const int v = (tmember.league_rank() - m*(nnghbr*nvar) - n*nvar);
+
+    // restrict cells packed for coarser neighbors, and (with Z4c) the coarse regions
+    // appended to sends to same-level neighbors.  Regions from different buffers can
+    // overlap, but all writes to a given coarse cell store the same value
+    if (nghbr.d_view(m,n).gid >= 0) {
+      int il=0, iu=0, jl=0, ju=0, kl=0, ku=0;
+      bool fill = false;
+      if (nghbr.d_view(m,n).lev < mblev.d_view(m)) {
+        il = sbuf[n].icoar[0].bis;
+        iu = sbuf[n].icoar[0].bie;
+        jl = sbuf[n].icoar[0].bjs;
+        ju = sbuf[n].icoar[0].bje;
+        kl = sbuf[n].icoar[0].bks;
+        ku = sbuf[n].icoar[0].bke;
+        fill = true;
+      } else if ((is_z4c) && (nghbr.d_view(m,n).lev == mblev.d_view(m))) {
+        il = sbuf[n].isame_z4c.bis;
+        iu = sbuf[n].isame_z4c.bie;
+        jl = sbuf[n].isame_z4c.bjs;
+        ju = sbuf[n].isame_z4c.bje;
+        kl = sbuf[n].isame_z4c.bks;
+        ku = sbuf[n].isame_z4c.bke;
+        fill = true;
+      }
+      if (fill) {
+        const int ni = iu - il + 1;
+        const int nj = ju - jl + 1;
+        const int nk = ku - kl + 1;
+        const int nkji = nk*nj*ni;
+        const int nji  = nj*ni;
+
+        // Middle loop over k,j,i
+        Kokkos::parallel_for(Kokkos::TeamThreadRange<>(tmember, nkji),[&](const int idx) {
+          int k = idx/nji;
+          int j = (idx - k*nji)/ni;
+          int i = (idx - k*nji - j*ni) + il;
+          j += jl;
+          k += kl;
+
+          // indices refer to coarse array.  So must compute indices for fine array
+          int finei = (i - indcs.cis)*2 + indcs.is;
+          int finej = (j - indcs.cjs)*2 + indcs.js;
+          int finek = (k - indcs.cks)*2 + indcs.ks;
+
+          // restrict in 1D
+          if (!(multi_d)) {
+            ca(m,v,kl,jl,i) = 0.5*(a(m,v,kl,jl,finei) + a(m,v,kl,jl,finei+1));
+          // restrict in 2D
+          } else if (!(three_d)) {
+            ca(m,v,kl,j,i) = 0.25*(a(m,v,kl,finej  ,finei) + a(m,v,kl,finej  ,finei+1)
+                                 + a(m,v,kl,finej+1,finei) + a(m,v,kl,finej+1,finei+1));
+          // restrict in 3D
+          } else {
+            if (!is_z4c) {
+              ca(m,v,k,j,i) = 0.125*(
+                  a(m,v,finek  ,finej  ,finei) + a(m,v,finek  ,finej  ,finei+1)
+                + a(m,v,finek  ,finej+1,finei) + a(m,v,finek  ,finej+1,finei+1)
+                + a(m,v,finek+1,finej,  finei) + a(m,v,finek+1,finej,  finei+1)
+                + a(m,v,finek+1,finej+1,finei) + a(m,v,finek+1,finej+1,finei+1));
+            } else {
+              switch (indcs.ng) {
+                case 2: ca(m,v,k,j,i) = RestrictInterpolation<2>(m,v,finek,finej,finei,
+                            nx1,nx2,nx3,a,restrict_2nd,restrict_4th,restrict_4th_edge);
+                        break;
+                case 4: ca(m,v,k,j,i) = RestrictInterpolation<4>(m,v,finek,finej,finei,
+                            nx1,nx2,nx3,a,restrict_2nd,restrict_4th,restrict_4th_edge);
+                        break;
+              }
+            }
+          }
+        });
+        tmember.team_barrier();
+      }
+    }
+  });
+  return;
+}
+
 //----------------------------------------------------------------------------------------
 //! \fn void ProlongateCC()
 //! \brief Prolongate data at boundaries for cell-centered data.
@@ -134,6 +264,11 @@ void MeshBoundaryValuesCC::FillCoarseInBndryCC(DvceArray5D<Real> &a,
 
 void MeshBoundaryValuesCC::ProlongateCC(DvceArray5D<Real> &a, DvceArray5D<Real> &ca,
     bool is_z4c) {
+  // rebuild cached interface census if stale; all kernels below only act on boundaries
+  // with coarser neighbors, so a pack with no fine/coarse interfaces has nothing to do
+  if (prol_stale) {InitProlongationInterfaces();}
+  if (nprol == 0) {return;}
+
   // create local references for variables in kernel
   int nmb = pmy_pack->nmb_thispack;
   int nnghbr = pmy_pack->pmb->nnghbr;
@@ -220,6 +355,12 @@ void MeshBoundaryValuesCC::ProlongateCC(DvceArray5D<Real> &a, DvceArray5D<Real>
 
 void MeshBoundaryValuesFC::FillCoarseInBndryFC(DvceFaceFld4D<Real> &b,
                                            DvceFaceFld4D<Real> &cb) {
+  // rebuild cached interface census if stale; nothing to do when pack contains no
+  // fine/coarse interfaces, since the coarse field filled here is only consumed by the
+  // prolongation stencils below
+  if (prol_stale) {InitProlongationInterfaces();}
+  if (nprol == 0) {return;}
+
   // create local references for variables in kernel
   int nmb = pmy_pack->nmb_thispack;
   int nnghbr = pmy_pack->pmb->nnghbr;
@@ -315,6 +456,11 @@ void MeshBoundaryValuesFC::FillCoarseInBndryFC(DvceFaceFld4D<Real> &b,
 //! \brief Prolongate data at boundaries for face-centered data (e.g. magnetic fields).
 
 void MeshBoundaryValuesFC::ProlongateFC(DvceFaceFld4D<Real> &b, DvceFaceFld4D<Real> &cb) {
+  // rebuild cached interface census if stale; all kernels below only act on boundaries
+  // with coarser neighbors, so a pack with no fine/coarse interfaces has nothing to do
+  if (prol_stale) {InitProlongationInterfaces();}
+  if (nprol == 0) {return;}
+
   // create local references for variables in kernel
   int nmb = pmy_pack->nmb_thispack;
   int nnghbr = pmy_pack->pmb->nnghbr;
@@ -19,13 +19,14 @@
 // #define SMALL_NUMBER 1.0e-5
 
 //----------------------------------------------------------------------------------------
-//! \fn void ComputeMetricAndInverse
-//! \brief computes 10 covariant and contravariant components of metric in
-//!  Cartesian Kerr-Schild coordinates
+//! \fn void ComputeMetricScalars
+//! \brief computes the four scalars (f, l_1, l_2, l_3) from which the Cartesian
+//!  Kerr-Schild metric and its inverse are assembled: g_nm = f*l_n*l_m + eta_nm with
+//!  l_0 = 1.  On stationary spacetimes these depend only on position, so they can be
+//!  evaluated once per grid point and cached (see Coordinates::SetMetricCache)
 
 KOKKOS_INLINE_FUNCTION
-void ComputeMetricAndInverse(Real x, Real y, Real z, bool minkowski, Real a,
-                             Real glower[][4], Real gupper[][4]) {
+void ComputeMetricScalars(Real x, Real y, Real z, bool minkowski, Real a, Real scal[4]) {
   // NOTE(@pdmullen): The following commented out floor on z dealt with the metric
   // singularity encountered for small z near the horizon (e.g., see g_00). However, this
   // floor was operating on z even for r_ks > 1.0, where (I believe) the metric should be
@@ -41,60 +42,74 @@ void ComputeMetricAndInverse(Real x, Real y, Real z, bool minkowski, Real a,
   }
   //r = fmax(r, 1.0);  // floor r_ks to 0.5*(r_inner + r_outer)
 
-  // Set covariant components
-  // null vector l
-  Real l_lower[4];
-  l_lower[0] = 1.0;
-  l_lower[1] = (r*x + (a)*y)/( SQR(r) + SQR(a) );
-  l_lower[2] = (r*y - (a)*x)/( SQR(r) + SQR(a) );
-  l_lower[3] = z/r;
-
-  // g_nm = f*l_n*l_m + eta_nm, where eta_nm is Minkowski metric
   Real f = 2.0 * SQR(r)*r / (SQR(SQR(r)) + SQR(a)*SQR(z));
   if (minkowski) {f=0.0;}
-  glower[0][0] = f * l_lower[0]*l_lower[0] - 1.0;
-  glower[0][1] = f * l_lower[0]*l_lower[1];
-  glower[0][2] = f * l_lower[0]*l_lower[2];
-  glower[0][3] = f * l_lower[0]*l_lower[3];
+  scal[0] = f;
+  scal[1] = (r*x + (a)*y)/( SQR(r) + SQR(a) );
+  scal[2] = (r*y - (a)*x)/( SQR(r) + SQR(a) );
+  scal[3] = z/r;
+  return;
+}
+
+//----------------------------------------------------------------------------------------
+//! \fn void MetricFromScalars
+//! \brief assembles 10 covariant and contravariant components of the CKS metric from the
+//!  scalars computed by ComputeMetricScalars.  Costs only multiply-adds, so reading
+//!  cached scalars through this function avoids the sqrt/divide-heavy recompute above
+
+KOKKOS_INLINE_FUNCTION
+void MetricFromScalars(Real f, Real l1, Real l2, Real l3,
+                       Real glower[][4], Real gupper[][4]) {
+  // g_nm = f*l_n*l_m + eta_nm, where eta_nm is Minkowski metric and l_0 = 1
+  glower[0][0] = f - 1.0;
+  glower[0][1] = f * l1;
+  glower[0][2] = f * l2;
+  glower[0][3] = f * l3;
   glower[1][0] = glower[0][1];
-  glower[1][1] = f * l_lower[1]*l_lower[1] + 1.0;
-  glower[1][2] = f * l_lower[1]*l_lower[2];
-  glower[1][3] = f * l_lower[1]*l_lower[3];
+  glower[1][1] = f * l1*l1 + 1.0;
+  glower[1][2] = f * l1*l2;
+  glower[1][3] = f * l1*l3;
   glower[2][0] = glower[0][2];
   glower[2][1] = glower[1][2];
-  glower[2][2] = f * l_lower[2]*l_lower[2] + 1.0;
-  glower[2][3] = f * l_lower[2]*l_lower[3];
+  glower[2][2] = f * l2*l2 + 1.0;
+  glower[2][3] = f * l2*l3;
   glower[3][0] = glower[0][3];
   glower[3][1] = glower[1][3];
   glower[3][2] = glower[2][3];
-  glower[3][3] = f * l_lower[3]*l_lower[3] + 1.0;
-
-  // Set contravariant components
-  // null vector l
-  Real l_upper[4];
-  l_upper[0] = -1.0;
-  l_upper[1] = l_lower[1];
-  l_upper[2] = l_lower[2];
-  l_upper[3] = l_lower[3];
-
-  // g^nm = -f*l^n*l^m + eta^nm, where eta^nm is Minkowski metric
-  gupper[0][0] = -f * l_upper[0]*l_upper[0] - 1.0;
-  gupper[0][1] = -f * l_upper[0]*l_upper[1];
-  gupper[0][2] = -f * l_upper[0]*l_upper[2];
-  gupper[0][3] = -f * l_upper[0]*l_upper[3];
+  glower[3][3] = f * l3*l3 + 1.0;
+
+  // g^nm = -f*l^n*l^m + eta^nm, where eta^nm is Minkowski metric and l^0 = -1
+  gupper[0][0] = -f - 1.0;
+  gupper[0][1] = f * l1;
+  gupper[0][2] = f * l2;
+  gupper[0][3] = f * l3;
   gupper[1][0] = gupper[0][1];
-  gupper[1][1] = -f * l_upper[1]*l_upper[1] + 1.0;
-  gupper[1][2] = -f * l_upper[1]*l_upper[2];
-  gupper[1][3] = -f * l_upper[1]*l_upper[3];
+  gupper[1][1] = -f * l1*l1 + 1.0;
+  gupper[1][2] = -f * l1*l2;
+  gupper[1][3] = -f * l1*l3;
   gupper[2][0] = gupper[0][2];
   gupper[2][1] = gupper[1][2];
-  gupper[2][2] = -f * l_upper[2]*l_upper[2] + 1.0;
-  gupper[2][3] = -f * l_upper[2]*l_upper[3];
+  gupper[2][2] = -f * l2*l2 + 1.0;
+  gupper[2][3] = -f * l2*l3;
   gupper[3][0] = gupper[0][3];
   gupper[3][1] = gupper[1][3];
   gupper[3][2] = gupper[2][3];
-  gupper[3][3] = -f * l_upper[3]*l_upper[3] + 1.0;
+  gupper[3][3] = -f * l3*l3 + 1.0;
+
+  return;
+}
+
+//----------------------------------------------------------------------------------------
+//! \fn void ComputeMetricAndInverse
+//! \brief computes 10 covariant and contravariant components of metric in
+//!  Cartesian Kerr-Schild coordinates
 
+KOKKOS_INLINE_FUNCTION
+void ComputeMetricAndInverse(Real x, Real y, Real z, bool minkowski, Real a,
+                             Real glower[][4], Real gupper[][4]) {
+  Real scal[4];
+  ComputeMetricScalars(x, y, z, minkowski, a, scal);
+  MetricFromScalars(scal[0], scal[1], scal[2], scal[3], glower, gupper);
   return;
 }
 
@@ -23,7 +23,9 @@
 Coordinates::Coordinates(ParameterInput *pin, MeshBlockPack *ppack) :
     pmy_pack(ppack),
     excision_floor("excision_floor",1,1,1,1),
-    excision_flux("excision_flux",1,1,1,1) {
+    excision_flux("excision_flux",1,1,1,1),
+    mb_excised("mb_excised",1),
+    mb_all_excised("mb_all_excised",1) {
   // Check for relativistic dynamics
   // WGC: idea for handling new EOS
   is_dynamical_relativistic = (pin->DoesBlockExist("adm") || pin->DoesBlockExist("z4c"))
@@ -41,6 +43,7 @@ Coordinates::Coordinates(ParameterInput *pin, MeshBlockPack *ppack) :
   }
 
   // Read properties of metric and excision from input file for GR.
+  coord_data.cache_metric = false;
   if (is_general_relativistic || is_dynamical_relativistic) {
     coord_data.is_minkowski = pin->GetOrAddBoolean("coord","minkowski",false);
     if (!(coord_data.is_minkowski)) {
@@ -70,6 +73,12 @@ Coordinates::Coordinates(ParameterInput *pin, MeshBlockPack *ppack) :
         } else if (emethod.compare("lapse") == 0) {
           coord_data.excision_scheme = ExcisionScheme::lapse;
           coord_data.excise_lapse = pin->GetOrAddReal("coord","excise_lapse", 0.25);
+        } else if (emethod.compare("horizon") == 0) {
+          // masks are rebuilt from the apparent-horizon radius at the cadence of the
+          // horizon finder (see Z4c::HorizonFinder and UpdateExcisionRadius below)
+          coord_data.excision_scheme = ExcisionScheme::horizon;
+          coord_data.excise_horizon_frac =
+            pin->GetOrAddReal("coord","excise_horizon_frac", 0.85);
         } else {
           std::cout << "### FATAL ERROR in " << __FILE__ << " at line "
                     << __LINE__ << std::endl
@@ -86,11 +95,164 @@ Coordinates::Coordinates(ParameterInput *pin, MeshBlockPack *ppack) :
       int ncells3 = (indcs.nx3 > 1)? (indcs.nx3 + 2*(indcs.ng)) : 1;
       Kokkos::realloc(excision_floor, nmb, ncells3, ncells2, ncells1);
       Kokkos::realloc(excision_flux, nmb, ncells3, ncells2, ncells1);
-      if (coord_data.excision_scheme == ExcisionScheme::fixed) {
+      Kokkos::realloc(mb_excised, nmb);
+      Kokkos::realloc(mb_all_excised, nmb);
+      // fixed and horizon schemes start from the radius-based masks; for the latter
+      // they are retightened once the finder has located the horizon
+      if (coord_data.excision_scheme != ExcisionScheme::lapse) {
         SetExcisionMasks(excision_floor, excision_flux);
+        SetExcisionBlockFlags();
       }
     }
   }
+
+  // Cache cell-geometry (positions, volumes) of all MeshBlocks in this pack
+  SetGeometryCache();
+
+  // Optionally cache metric scalars at cell and face centers on stationary spacetimes.
+  // The metric is time-independent only for fixed (non-dynamical) GR, so the cache is
+  // not available with ADM/Z4c evolution.
+  if (is_general_relativistic) {
+    coord_data.cache_metric = pin->GetOrAddBoolean("coord","cache_metric",false);
+    if (coord_data.cache_metric) {SetMetricCache();}
+  }
+}
+
+//----------------------------------------------------------------------------------------
+//! \fn void Coordinates::SetMetricCache()
+//! \brief computes and stores the four scalars (f, l_1, l_2, l_3) from which the CKS
+//! metric and inverse are assembled, at cell centers and at each family of face centers
+//! over all MeshBlocks in this pack (including ghost zones).  GR kernels then rebuild
+//! the metric from these streamed loads via MetricFromScalars, replacing the
+//! sqrt/divide-heavy per-cell recompute in ComputeMetricAndInverse.  Since AMR events
+//! delete and reconstruct Coordinates, the cache is automatically rebuilt when the mesh
+//! changes.
+
+void Coordinates::SetMetricCache() {
+  int nmb = pmy_pack->nmb_thispack;
+  auto &indcs = pmy_pack->pmesh->mb_indcs;
+  int &is = indcs.is;
+  int &js = indcs.js;
+  int &ks = indcs.ks;
+  int ncells1 = indcs.nx1 + 2*(indcs.ng);
+  int ncells2 = (indcs.nx2 > 1)? (indcs.nx2 + 2*(indcs.ng)) : 1;
+  int ncells3 = (indcs.nx3 > 1)? (indcs.nx3 + 2*(indcs.ng)) : 1;
+  coord_data.mscal_cc  = DvceArray5D<Real>("mscal_cc", nmb,4,ncells3  ,ncells2  ,ncells1);
+  coord_data.mscal_fc1 = DvceArray5D<Real>("mscal_fc1",nmb,4,ncells3  ,ncells2,ncells1+1);
+  coord_data.mscal_fc2 = DvceArray5D<Real>("mscal_fc2",nmb,4,ncells3,ncells2+1,ncells1);
+  coord_data.mscal_fc3 = DvceArray5D<Real>("mscal_fc3",nmb,4,ncells3+1,ncells2,ncells1);
+
+  auto &size = pmy_pack->pmb->mb_size;
+  auto &flat = coord_data.is_minkowski;
+  auto &spin = coord_data.bh_spin;
+  auto &mscal_cc  = coord_data.mscal_cc;
+  auto &mscal_fc1 = coord_data.mscal_fc1;
+  auto &mscal_fc2 = coord_data.mscal_fc2;
+  auto &mscal_fc3 = coord_data.mscal_fc3;
+
+  // loop includes one extra point in each direction to cover the upper faces; writes to
+  // the cell-centered and transverse arrays are guarded so they stay in bounds
+  par_for("metric_cache", DevExeSpace(), 0, (nmb-1), 0, ncells3, 0, ncells2, 0, ncells1,
+  KOKKOS_LAMBDA(const int m, const int k, const int j, const int i) {
+    Real &x1min = size.d_view(m).x1min;
+    Real &x1max = size.d_view(m).x1max;
+    Real x1v = CellCenterX(i-is, indcs.nx1, x1min, x1max);
+    Real x1f = LeftEdgeX  (i-is, indcs.nx1, x1min, x1max);
+
+    Real &x2min = size.d_view(m).x2min;
+    Real &x2max = size.d_view(m).x2max;
+    Real x2v = CellCenterX(j-js, indcs.nx2, x2min, x2max);
+    Real x2f = LeftEdgeX  (j-js, indcs.nx2, x2min, x2max);
+
+    Real &x3min = size.d_view(m).x3min;
+    Real &x3max = size.d_view(m).x3max;
+    Real x3v = CellCenterX(k-ks, indcs.nx3, x3min, x3max);
+    Real x3f = LeftEdgeX  (k-ks, indcs.nx3, x3min, x3max);
+
+    Real scal[4];
+    if ((i < ncells1) && (j < ncells2) && (k < ncells3)) {
+      ComputeMetricScalars(x1v, x2v, x3v, flat, spin, scal);
+      for (int n=0; n<4; ++n) {mscal_cc(m,n,k,j,i) = scal[n];}
+    }
+    if ((j < ncells2) && (k < ncells3)) {
+      ComputeMetricScalars(x1f, x2v, x3v, flat, spin, scal);
+      for (int n=0; n<4; ++n) {mscal_fc1(m,n,k,j,i) = scal[n];}
+    }
+    if ((i < ncells1) && (k < ncells3)) {
+      ComputeMetricScalars(x1v, x2f, x3v, flat, spin, scal);
+      for (int n=0; n<4; ++n) {mscal_fc2(m,n,k,j,i) = scal[n];}
+    }
+    if ((i < ncells1) && (j < ncells2)) {
+      ComputeMetricScalars(x1v, x2v, x3f, flat, spin, scal);
+      for (int n=0; n<4; ++n) {mscal_fc3(m,n,k,j,i) = scal[n];}
+    }
+  });
+
+  return;
+}
+
+//----------------------------------------------------------------------------------------
+//! \fn void Coordinates::SetGeometryCache()
+//! \brief computes and stores cell-center and face positions along each axis, and the
+//! cell volume, of every MeshBlock in this pack (including ghost zones).  Kernels that
+//! read positions in their innermost loops can stream these arrays in place of the
+//! per-access arithmetic in CellCenterX/LeftEdgeX; this function is also the single
+//! place where that arithmetic must change for future nonuniform spacings.  Since AMR
+//! events delete and reconstruct Coordinates, the cache is rebuilt when the mesh changes
+
+void Coordinates::SetGeometryCache() {
+  int nmb = pmy_pack->nmb_thispack;
+  auto &indcs = pmy_pack->pmesh->mb_indcs;
+  int &is = indcs.is;
+  int &js = indcs.js;
+  int &ks = indcs.ks;
+  int ncells1 = indcs.nx1 + 2*(indcs.ng);
+  int ncells2 = (indcs.nx2 > 1)? (indcs.nx2 + 2*(indcs.ng)) : 1;
+  int ncells3 = (indcs.nx3 > 1)? (indcs.nx3 + 2*(indcs.ng)) : 1;
+  x1v = DvceArray2D<Real>("x1v", nmb, ncells1);
+  x2v = DvceArray2D<Real>("x2v", nmb, ncells2);
+  x3v = DvceArray2D<Real>("x3v", nmb, ncells3);
+  x1f = DvceArray2D<Real>("x1f", nmb, ncells1+1);
+  x2f = DvceArray2D<Real>("x2f", nmb, ncells2+1);
+  x3f = DvceArray2D<Real>("x3f", nmb, ncells3+1);
+  cell_vol = DvceArray1D<Real>("cell_vol", nmb);
+
+  auto &size = pmy_pack->pmb->mb_size;
+  auto &x1v_ = x1v;
+  auto &x2v_ = x2v;
+  auto &x3v_ = x3v;
+  auto &x1f_ = x1f;
+  auto &x2f_ = x2f;
+  auto &x3f_ = x3f;
+  auto &cell_vol_ = cell_vol;
+
+  // loops include one extra point to cover the upper face; cell-center writes guarded
+  par_for("geom_cache_x1", DevExeSpace(), 0, (nmb-1), 0, ncells1,
+  KOKKOS_LAMBDA(const int m, const int i) {
+    Real &x1min = size.d_view(m).x1min;
+    Real &x1max = size.d_view(m).x1max;
+    if (i < ncells1) {x1v_(m,i) = CellCenterX(i-is, indcs.nx1, x1min, x1max);}
+    x1f_(m,i) = LeftEdgeX(i-is, indcs.nx1, x1min, x1max);
+    if (i == 0) {
+      cell_vol_(m) = (size.d_view(m).dx1)*(size.d_view(m).dx2)*(size.d_view(m).dx3);
+    }
+  });
+  par_for("geom_cache_x2", DevExeSpace(), 0, (nmb-1), 0, ncells2,
+  KOKKOS_LAMBDA(const int m, const int j) {
+    Real &x2min = size.d_view(m).x2min;
+    Real &x2max = size.d_view(m).x2max;
+    if (j < ncells2) {x2v_(m,j) = CellCenterX(j-js, indcs.nx2, x2min, x2max);}
+    x2f_(m,j) = LeftEdgeX(j-js, indcs.nx2, x2min, x2max);
+  });
+  par_for("geom_cache_x3", DevExeSpace(), 0, (nmb-1), 0, ncells3,
+  KOKKOS_LAMBDA(const int m, const int k) {
+    Real &x3min = size.d_view(m).x3min;
+    Real &x3max = size.d_view(m).x3max;
+    if (k < ncells3) {x3v_(m,k) = CellCenterX(k-ks, indcs.nx3, x3min, x3max);}
+    x3f_(m,k) = LeftEdgeX(k-ks, indcs.nx3, x3min, x3max);
+  });
+
+  return;
 }
 
 //----------------------------------------------------------------------------------------
@@ -104,30 +266,31 @@ void Coordinates::CoordSrcTerms(const DvceArray5D<Real> &prim, const EOS_Data &e
   int is = indcs.is; int ie = indcs.ie;
   int js = indcs.js; int je = indcs.je;
   int ks = indcs.ks; int ke = indcs.ke;
-  auto &size = pmy_pack->pmb->mb_size;
   auto &flat = coord_data.is_minkowski;
   auto &spin = coord_data.bh_spin;
+  auto &use_cache = coord_data.cache_metric;
+  auto &mscal_cc = coord_data.mscal_cc;
+  auto &x1v_ = x1v;
+  auto &x2v_ = x2v;
+  auto &x3v_ = x3v;
 
   Real gamma_prime = eos.gamma / (eos.gamma - 1.0);
 
   int nmb1 = pmy_pack->nmb_thispack - 1;
   par_for("coord_src", DevExeSpace(), 0, nmb1, ks, ke, js, je, is, ie,
   KOKKOS_LAMBDA(const int m, const int k, const int j, const int i) {
-    // Extract components of metric
-    Real &x1min = size.d_view(m).x1min;
-    Real &x1max = size.d_view(m).x1max;
-    Real x1v = CellCenterX(i-is, indcs.nx1, x1min, x1max);
-
-    Real &x2min = size.d_view(m).x2min;
-    Real &x2max = size.d_view(m).x2max;
-    Real x2v = CellCenterX(j-js, indcs.nx2, x2min, x2max);
-
-    Real &x3min = size.d_view(m).x3min;
-    Real &x3max = size.d_view(m).x3max;
-    Real x3v = CellCenterX(k-ks, indcs.nx3, x3min, x3max);
+    // Extract cell-center positions from the geometry cache
+    Real x1v = x1v_(m,i);
+    Real x2v = x2v_(m,j);
+    Real x3v = x3v_(m,k);
 
     Real glower[4][4], gupper[4][4];
-    ComputeMetricAndInverse(x1v, x2v, x3v, flat, spin, glower, gupper);
+    if (use_cache) {
+      MetricFromScalars(mscal_cc(m,0,k,j,i), mscal_cc(m,1,k,j,i),
+                        mscal_cc(m,2,k,j,i), mscal_cc(m,3,k,j,i), glower, gupper);
+    } else {
+      ComputeMetricAndInverse(x1v, x2v, x3v, flat, spin, glower, gupper);
+    }
 
     // Extract primitives
     const Real &rho  = prim(m,IDN,k,j,i);
@@ -227,30 +390,31 @@ void Coordinates::CoordSrcTerms(const DvceArray5D<Real> &prim,
   int is = indcs.is; int ie = indcs.ie;
   int js = indcs.js; int je = indcs.je;
   int ks = indcs.ks; int ke = indcs.ke;
-  auto &size = pmy_pack->pmb->mb_size;
   auto &flat = coord_data.is_minkowski;
   auto &spin = coord_data.bh_spin;
+  auto &use_cache = coord_data.cache_metric;
+  auto &mscal_cc = coord_data.mscal_cc;
+  auto &x1v_ = x1v;
+  auto &x2v_ = x2v;
+  auto &x3v_ = x3v;
 
   Real gamma_prime = eos.gamma / (eos.gamma - 1.0);
 
   int nmb1 = pmy_pack->nmb_thispack - 1;
   par_for("coord_src", DevExeSpace(), 0, nmb1, ks, ke, js, je, is, ie,
   KOKKOS_LAMBDA(const int m, const int k, const int j, const int i) {
-    // Extract components of metric
-    Real &x1min = size.d_view(m).x1min;
-    Real &x1max = size.d_view(m).x1max;
-    Real x1v = CellCenterX(i-is, indcs.nx1, x1min, x1max);
-
-    Real &x2min = size.d_view(m).x2min;
-    Real &x2max = size.d_view(m).x2max;
-    Real x2v = CellCenterX(j-js, indcs.nx2, x2min, x2max);
-
-    Real &x3min = size.d_view(m).x3min;
-    Real &x3max = size.d_view(m).x3max;
-    Real x3v = CellCenterX(k-ks, indcs.nx3, x3min, x3max);
+    // Extract cell-center positions from the geometry cache
+    Real x1v = x1v_(m,i);
+    Real x2v = x2v_(m,j);
+    Real x3v = x3v_(m,k);
 
     Real glower[4][4], gupper[4][4];
-    ComputeMetricAndInverse(x1v, x2v, x3v, flat, spin, glower, gupper);
+    if (use_cache) {
+      MetricFromScalars(mscal_cc(m,0,k,j,i), mscal_cc(m,1,k,j,i),
+                        mscal_cc(m,2,k,j,i), mscal_cc(m,3,k,j,i), glower, gupper);
+    } else {
+      ComputeMetricAndInverse(x1v, x2v, x3v, flat, spin, glower, gupper);
+    }
 
     // Extract primitives
     const Real &rho  = prim(m,IDN,k,j,i);
@@ -21,7 +21,8 @@ struct EOS_Data;
 // Enumerator for the excision method
 enum class ExcisionScheme {
   fixed,
-  lapse
+  lapse,
+  horizon
 };
 
 //----------------------------------------------------------------------------------------
@@ -41,6 +42,18 @@ struct CoordData {
   Real flux_excise_r;              // reduce to first-order inside this radius
   ExcisionScheme excision_scheme;  // excision method
   Real excise_lapse;               // if excision_scheme = lapse, excise under this lapse
+  Real excise_horizon_frac;        // if excision_scheme = horizon, excise within this
+                                   // fraction of the found apparent-horizon radius
+
+  // per-point cache of the four scalars (f, l_1, l_2, l_3) from which the stationary
+  // CKS metric and its inverse are assembled (see MetricFromScalars).  Built once at
+  // construction (so also after every AMR event, which reconstructs Coordinates), and
+  // read inside GR kernels in place of the sqrt/divide-heavy recompute when enabled
+  bool cache_metric;               // flag to read metric scalars from cache in kernels
+  DvceArray5D<Real> mscal_cc;      // (m,0:3,k,j,i) metric scalars at cell centers
+  DvceArray5D<Real> mscal_fc1;     // (m,0:3,k,j,i) metric scalars at x1-face centers
+  DvceArray5D<Real> mscal_fc2;     // (m,0:3,k,j,i) metric scalars at x2-face centers
+  DvceArray5D<Real> mscal_fc3;     // (m,0:3,k,j,i) metric scalars at x3-face centers
 };
 
 //----------------------------------------------------------------------------------------
@@ -60,9 +73,23 @@ class Coordinates {
   // data needed to compute metric in GR
   CoordData coord_data;
 
+  // per-pack cell-geometry cache: cell-center and face positions along each axis of
+  // every MeshBlock including ghost zones (face arrays hold one extra entry for the
+  // upper face), plus the cell volume of each MeshBlock.  Values are identical to what
+  // CellCenterX/LeftEdgeX return on the uniform grids used today; kernels that read
+  // positions in their innermost loops can stream these instead of recomputing per
+  // access, and SetGeometryCache is the single point where position arithmetic must
+  // change for future nonuniform (e.g. log-spaced radial) spacings.  AMR events delete
+  // and reconstruct Coordinates, so the cache is automatically rebuilt on regridding
+  DvceArray2D<Real> x1v, x2v, x3v;  // cell-center positions, indexed (m,i)
+  DvceArray2D<Real> x1f, x2f, x3f;  // face positions, indexed (m,i)
+  DvceArray1D<Real> cell_vol;       // cell volume of each MeshBlock
+
   // excision masks
   DvceArray4D<bool> excision_floor;  // cell-centered mask for C2P flooring about horizon
   DvceArray4D<bool> excision_flux;   // cell-centered mask for FOFC about horizon
+  DvceArray1D<bool> mb_excised;      // true only for MBs with at least one masked cell
+  DvceArray1D<bool> mb_all_excised;  // true only for MBs with every cell in both masks
 
   // functions
   void CoordSrcTerms(const DvceArray5D<Real> &w0, const EOS_Data &eos, const Real dt,
@@ -70,8 +97,12 @@ class Coordinates {
   void CoordSrcTerms(const DvceArray5D<Real> &w0, const DvceArray5D<Real> &bcc,
                      const EOS_Data &eos, const Real dt, DvceArray5D<Real> &u0);
   void SetExcisionMasks(DvceArray4D<bool> &floor, DvceArray4D<bool> &flux);
+  void SetExcisionBlockFlags();
+  void SetMetricCache();
+  void SetGeometryCache();
 
   void UpdateExcisionMasks();
+  void UpdateExcisionRadius(Real rah);
 
  private:
   MeshBlockPack* pmy_pack;
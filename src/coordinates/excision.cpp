@@ -189,5 +189,71 @@ void Coordinates::UpdateExcisionMasks() {
       floor(m,k,j,i) = excise;
       flux(m,k,j,i) = excise;
     });
+    SetExcisionBlockFlags();
   }
 }
+
+//----------------------------------------------------------------------------------------
+//! \fn void Coordinates::UpdateExcisionRadius()
+//! \brief rebuilds the excision masks about a new apparent-horizon radius, excising
+//! within a fixed fraction of it.  Called at the cadence of the horizon finder (see
+//! Z4c::FindHorizon); a no-op unless the horizon excision scheme is selected
+
+void Coordinates::UpdateExcisionRadius(Real rah) {
+  if (!(is_general_relativistic || is_dynamical_relativistic)) {return;}
+  if (!(coord_data.bh_excise)) {return;}
+  if (coord_data.excision_scheme != ExcisionScheme::horizon) {return;}
+
+  Real rex = coord_data.excise_horizon_frac*rah;
+  if (rex == coord_data.rexcise) {return;}
+  coord_data.rexcise = rex;
+  coord_data.flux_excise_r = rex;
+  // SetExcisionMasks only ever sets cells, so clear both masks before shrinking them
+  Kokkos::deep_copy(excision_floor, false);
+  Kokkos::deep_copy(excision_flux, false);
+  SetExcisionMasks(excision_floor, excision_flux);
+  SetExcisionBlockFlags();
+  return;
+}
+
+//----------------------------------------------------------------------------------------
+//! \fn void Coordinates::SetExcisionBlockFlags()
+//  \brief Classifies each MeshBlock against the excision masks: mb_excised is true only
+//  if at least one cell is masked by either excision_floor or excision_flux, while
+//  mb_all_excised is true only if every cell is masked by both.  Kernels that consult
+//  the masks per cell check these flags first, so MBs far from the horizon skip the
+//  mask reads entirely and MBs fully inside it take the excised branch without them;
+//  only the (few) mixed MBs straddling the horizon pay for per-cell mask loads.
+//  Must be called every time the masks themselves are (re)computed.
+
+void Coordinates::SetExcisionBlockFlags() {
+  // capture variables for kernel
+  auto &indcs = pmy_pack->pmesh->mb_indcs;
+  int &ng = indcs.ng;
+  int n1 = indcs.nx1 + 2*ng;
+  int n2 = (indcs.nx2 > 1)? (indcs.nx2 + 2*ng) : 1;
+  int n3 = (indcs.nx3 > 1)? (indcs.nx3 + 2*ng) : 1;
+  const int nkji = n3*n2*n1;
+  int nmb1 = pmy_pack->nmb_thispack - 1;
+  auto &floor_ = excision_floor;
+  auto &flux_ = excision_flux;
+  auto &flags_ = mb_excised;
+  auto &all_flags_ = mb_all_excised;
+
+  par_for_outer("excise_flags", DevExeSpace(), 0, 0, 0, nmb1,
+  KOKKOS_LAMBDA(TeamMember_t member, const int m) {
+    int nmask = 0, nfull = 0;
+    Kokkos::parallel_reduce(Kokkos::TeamThreadRange(member, nkji),
+    [&](const int idx, int &count, int &full_count) {
+      int k = idx/(n2*n1);
+      int j = (idx - k*n2*n1)/n1;
+      int i = (idx - k*n2*n1 - j*n1);
+      if (floor_(m,k,j,i) || flux_(m,k,j,i)) {count++;}
+      if (floor_(m,k,j,i) && flux_(m,k,j,i)) {full_count++;}
+    }, Kokkos::Sum<int>(nmask), Kokkos::Sum<int>(nfull));
+    flags_(m) = (nmask > 0);
+    all_flags_(m) = (nfull == nkji);
+  });
+
+  return;
+}
@@ -6,11 +6,14 @@
 //! \file driver.cpp
 //  \brief implementation of functions in class Driver
 
+#include <math.h>
+
 #include <iostream>
 #include <iomanip>    // std::setprecision()
 #include <limits>
 #include <algorithm>
 #include <string> // string
+#include <vector>
 
 #include "athena.hpp"
 #include "globals.hpp"
@@ -23,6 +26,10 @@
 #include "dyn_grmhd/dyn_grmhd.hpp"
 #include "ion-neutral/ion-neutral.hpp"
 #include "radiation/radiation.hpp"
+#include "utils/autotune.hpp"
+#include "utils/memlog.hpp"
+#include "utils/perfrec.hpp"
+#include "utils/profiler.hpp"
 #include "driver.hpp"
 
 #if MPI_PARALLEL_ENABLED
@@ -59,12 +66,19 @@ Driver::Driver(ParameterInput *pin, Mesh *pmesh, Real wtlim, Kokkos::Timer* ptim
   tlim(-1.0),
   nlim(-1),
   ndiag(1),
+  nprof(0),
+  use_sts(false),
+  nsts_stages(0),
+  nstreams(1),
   nmb_updated_(0),
   npart_updated_(0),
   lb_efficiency_(0),
   pwall_clock_(ptimer),
   wall_time(wtlim),
   impl_src("ru",1,1,1,1,1,1) {
+  // pool of execution space instances used for asynchronous task launch.  streams[0]
+  // is always the default instance; more are added below when '<time> nstreams > 1'
+  streams.push_back(DevExeSpace());
   // set time-evolution option (no default)
   {
     std::string evolution_t = pin->GetString("time","evolution");
@@ -87,6 +101,53 @@ Driver::Driver(ParameterInput *pin, Mesh *pmesh, Real wtlim, Kokkos::Timer* ptim
     tlim = pin->GetReal("time", "tlim");
     nlim = pin->GetOrAddInteger("time", "nlim", -1);
     ndiag = pin->GetOrAddInteger("time", "ndiag", 1);
+    // advance diffusion terms with operator-split RKL2 super-time-stepping, removing
+    // the parabolic restriction from the global timestep (see Mesh::NewTimeStep)
+    use_sts = pin->GetOrAddBoolean("time", "sts", false);
+    pmesh->sts_split = use_sts;
+    // launch tasks flagged asynchronous on separate execution space instances (CUDA/HIP
+    // streams on devices), overlapping independent kernels in multi-physics runs
+    nstreams = pin->GetOrAddInteger("time", "nstreams", 1);
+    if (nstreams > 1) {
+      std::vector<int> weights(nstreams-1, 1);
+      auto insts = Kokkos::Experimental::partition_space(DevExeSpace(), weights);
+      for (auto &es : insts) {streams.push_back(es);}
+    }
+    // built-in instrumentation: time every kernel (keyed by the name string passed to
+    // the par_for wrappers) and MPI wait regions, dumping machine-readable statistics
+    // every 'nprof' cycles and at the end of the run (see utils/profiler.hpp).  Note
+    // timing fences each kernel, so this perturbs overlap of independent kernels
+    profiler::enabled = pin->GetOrAddBoolean("time", "profiler", false);
+    nprof = pin->GetOrAddInteger("time", "nprof", 0);
+    // also print the top kernels by time with their launch configurations to stdout on
+    // every profiler dump; implies the profiler itself
+    profiler::verbose = pin->GetOrAddBoolean("time", "verbose_kernels", false);
+    if (profiler::verbose) {profiler::enabled = true;}
+    // push a Kokkos profiling region per task name per stage around every task call
+    // (and one per task list), so external profilers (Nsight, Vampir, ...) see the
+    // kernel stream structured by task instead of a flat stream of par_for launches.
+    // When the built-in profiler is also enabled, per-task host times are accumulated
+    // into its registry and dumped as 'task' rows
+    profiler::annotate_regions = pin->GetOrAddBoolean("time", "annotate_regions", false);
+    // autotune team sizes of par_for_outer kernels: early launches of each kernel
+    // explore a list of candidate launch bounds and the fastest is pinned for the rest
+    // of the run (see utils/autotune.hpp).  Tuned bounds are cached on disk keyed by
+    // device and MeshBlock size, so later runs skip exploration.  Note exploration
+    // fences each measured launch, perturbing the first cycles
+    // report the per-module View allocation registry (bytes and device high-water
+    // marks, tracked continuously by callbacks installed in main()) to 'memory.csv'
+    // every 'nprof' cycles and at the end of the run (see utils/memlog.hpp)
+    memlog::enabled = pin->GetOrAddBoolean("time", "memlog", false);
+    // write a compact per-run performance record (throughput time series, AMR/IO stall
+    // totals, MPI wait fraction, top kernels) to 'perf_record.json' at the end of the
+    // run, in a stable schema for cross-run trend tracking (see utils/perfrec.hpp)
+    perfrec::enabled = pin->GetOrAddBoolean("time", "perf_record", false);
+    autotune::enabled = pin->GetOrAddBoolean("time", "autotune", false);
+    if (autotune::enabled) {
+      std::string tfile = pin->GetOrAddString("time", "autotune_file", "autotune.dat");
+      autotune::LoadCache(tfile, pmesh->mb_indcs.nx1, pmesh->mb_indcs.nx2,
+                          pmesh->mb_indcs.nx3);
+    }
 
     if (integrator == "rk1") {
       // RK1: first-order Runge-Kutta / the forward Euler (FE) method
@@ -245,20 +306,38 @@ Driver::Driver(ParameterInput *pin, Mesh *pmesh, Real wtlim, Kokkos::Timer* ptim
 
 void Driver::ExecuteTaskList(Mesh *pm, std::string tl, int stage) {
   MeshBlockPack* pmbp = pm->pmb_pack;
+  // resolve string key in tl_map once; polling loops below reach the list through this
+  // raw pointer so no map lookups or shared_ptr derefs occur per sweep
+  TaskList *plist = pmbp->tl_map[tl].get();
   for (int p=0; p<(pm->nmb_packs_thisrank); ++p) {
-    if (!(pmbp->tl_map[tl]->Empty())) {pmbp->tl_map[tl]->Reset();}
+    if (!(plist->Empty())) {plist->Reset();}
+  }
+  // enclose the whole list in a profiling region, so traces group kernels first by
+  // (task list, stage) and then by the per-task regions pushed in DoAvailable()
+  if (profiler::annotate_regions) {
+    Kokkos::Profiling::pushRegion(tl + "_stg" + std::to_string(stage));
   }
+  // Packs are polled round-robin, one pass through each incomplete list per sweep, so
+  // that on ranks owning more than one pack (hybrid runs with few ranks per node) ready
+  // tasks in one pack overlap with MPI waits in another, rather than each pack being
+  // driven to completion serially.
   int npack_left = (pm->nmb_packs_thisrank);
   while (npack_left > 0) {
-    if (pmbp->tl_map[tl]->Empty()) {
-      npack_left--;
-    } else {
-      if (!pmbp->tl_map[tl]->IsComplete()) {
-        auto status = pmbp->tl_map[tl]->DoAvailable(this, stage);
-        if (status == TaskListStatus::complete) { npack_left--; }
+    npack_left = 0;
+    for (int p=0; p<(pm->nmb_packs_thisrank); ++p) {
+      if (plist->Empty()) {continue;}
+      if (!plist->IsComplete()) {
+        auto status = (nstreams > 1)?
+          plist->DoAvailable(this, stage, streams, current_stream) :
+          plist->DoAvailable(this, stage);
+        if (status != TaskListStatus::complete) { npack_left++; }
       }
     }
   }
+  if (profiler::annotate_regions) {Kokkos::Profiling::popRegion();}
+  // ensure kernels launched asynchronously on other streams finish before moving on to
+  // tasks in another list (which only fence streams used within their own list)
+  for (int n=1; n<nstreams; ++n) {streams[n].fence();}
   return;
 }
 
@@ -284,9 +363,11 @@ void Driver::Initialize(Mesh *pmesh, ParameterInput *pin, Outputs *pout, bool re
     if (pmhd != nullptr) {
       (void) pmesh->pmb_pack->pmhd->NewTimeStep(this, nexp_stages);
     }
+#if RADIATION_ENABLED
     if (prad != nullptr) {
       (void) pmesh->pmb_pack->prad->NewTimeStep(this, nexp_stages);
     }
+#endif
     if (pz4c != nullptr) {
       (void) pmesh->pmb_pack->pz4c->NewTimeStep(this, nexp_stages);
     }
@@ -348,12 +429,50 @@ void Driver::Execute(Mesh *pmesh, ParameterInput *pin, Outputs *pout) {
     }
     while ((pmesh->time < tlim) && (pmesh->ncycle < nlim || nlim < 0) &&
            (elapsed_time < wall_time)) {
-      if (global_variable::my_rank == 0) {OutputCycleDiagnostics(pmesh);}
+      if (global_variable::my_rank == 0) {
+        OutputCycleDiagnostics(pmesh);
+        // sample the throughput time series at the diagnostic cadence
+        if ((perfrec::enabled) && ((pmesh->ncycle)%(ndiag) == 0)) {
+          std::uint64_t zcycles = nmb_updated_ *
+                                  static_cast<uint64_t>(pmesh->NumberOfMeshBlockCells());
+          perfrec::Sample(pmesh->ncycle, static_cast<double>(run_time_.seconds()),
+                          zcycles, npart_updated_);
+        }
+      }
+
+      // periodically dump cumulative kernel/region timing statistics in
+      // machine-readable form (gathers across ranks, so all ranks must call)
+      if ((profiler::enabled) && (nprof > 0) && (pmesh->ncycle % nprof == 0)) {
+        std::uint64_t zcycles = nmb_updated_ *
+                                static_cast<uint64_t>(pmesh->NumberOfMeshBlockCells());
+        profiler::Dump(pmesh->ncycle, run_time_.seconds(),
+                       static_cast<double>(zcycles));
+      }
+
+      // periodically dump the memory accounting registry, so the last dump before an
+      // OOM crash shows which module was growing (all ranks must call)
+      if ((memlog::enabled) && (nprof > 0) && (pmesh->ncycle % nprof == 0)) {
+        memlog::Dump(pmesh->ncycle);
+      }
 
       // Execute TaskLists
+      // timer for measured-cost load balancing (only read when lb_automatic set)
+      Kokkos::Timer lb_timer;
+
       // Work before time integrator indicated by "0" in stage
       ExecuteTaskList(pmesh, "before_timeintegrator", 0);
 
+      // Advance diffusion terms over the full timestep with RKL2 super-time-stepping,
+      // operator-split from the main integrator stages below
+      if (use_sts) {
+        nsts_stages = STSStages(pmesh);
+        for (int stage=1; stage<=(nsts_stages); ++stage) {
+          ExecuteTaskList(pmesh, "sts_before_stagen", stage);
+          ExecuteTaskList(pmesh, "sts_stagen", stage);
+          ExecuteTaskList(pmesh, "sts_after_stagen", stage);
+        }
+      }
+
       // time-integrator tasks for each stage of integrator
       for (int stage=1; stage<=(nexp_stages); ++stage) {
         ExecuteTaskList(pmesh, "before_stagen", stage);
@@ -364,6 +483,13 @@ void Driver::Execute(Mesh *pmesh, ParameterInput *pin, Outputs *pout) {
       // Work after time integrator indicated by "1" in stage
       ExecuteTaskList(pmesh, "after_timeintegrator", 1);
 
+      // With automatic load balancing, attribute time spent in task lists this cycle to
+      // MeshBlocks on this rank so AMR redistribution can track the measured load
+      if (pmesh->lb_automatic) {
+        Kokkos::fence();
+        pmesh->UpdateMeshBlockCosts(static_cast<float>(lb_timer.seconds()));
+      }
+
       // Work outside of TaskLists:
       // increment time, ncycle, etc.
       pmesh->time = pmesh->time + pmesh->dt;
@@ -380,8 +506,20 @@ void Driver::Execute(Mesh *pmesh, ParameterInput *pin, Outputs *pout) {
             static_cast<float>(pmesh->nmb_total);
       }
 
+      // Post the global timestep reduction now so the collective overlaps the output
+      // work below.  With AMR the local timestep limits change during refinement, so
+      // the reduction cannot be posted until refinement completes
+      if (!(pmesh->adaptive)) {pmesh->NewTimeStepStart();}
+
       // Test for/make outputs
+      Kokkos::Timer io_timer;   // time the loop stalls in the output path (perf record)
+      std::vector<BaseTypeOutput *> outs_due;
       for (auto &out : pout->pout_list) {
+        // accumulate windowed time averages every cycle (one cheap device kernel per
+        // variable); only the average over the window is written at the output cadence
+        if (out->out_params.time_average) {
+          out->AccumulateTimeAverage(pmesh, pmesh->dt);
+        }
         // compare at floating point (32-bit) precision to reduce effect of round off
         float time_32 = static_cast<float>(pmesh->time);
         float next_32 = static_cast<float>(out->out_params.last_time+out->out_params.dt);
@@ -390,15 +528,56 @@ void Driver::Execute(Mesh *pmesh, ParameterInput *pin, Outputs *pout) {
 
         if (((out->out_params.dt > 0.0) && ((time_32 >= next_32) && (time_32<tlim_32))) ||
             ((dcycle_ > 0) && ((pmesh->ncycle)%(dcycle_) == 0)) ) {
+          outs_due.push_back(out);
+        }
+      }
+
+      // Snapshot the union of grid output variables into the shared shadow buffer, so
+      // every writer due this cycle consumes one consistent snapshot and the output
+      // path synchronizes against the evolution arrays at a single point
+      if (!(outs_due.empty())) {pout->SnapshotOutputData(pmesh, outs_due);}
+      for (auto &out : outs_due) {
+        if (out->out_params.time_interp) {
+          // synthesize the dump at the exact requested time from the two bracketing
+          // states; the mesh time is swapped for the write so the file is stamped
+          // with the time its contents correspond to
+          Real tout = out->InterpolateToOutputTime(pmesh);
+          Real tnow = pmesh->time;
+          pmesh->time = tout;
+          out->LoadOutputData(pmesh);
+          out->WriteOutputFile(pmesh, pin);
+          pmesh->time = tnow;
+        } else {
           out->LoadOutputData(pmesh);
           out->WriteOutputFile(pmesh, pin);
         }
       }
+      if (!(outs_due.empty())) {pout->RestoreOutputData();}
+
+      // snapshot the state for temporal interpolation of the next dump (internally
+      // skipped while no output time can be crossed by the next cycle)
+      for (auto &out : pout->pout_list) {
+        if (out->out_params.time_interp) {
+          out->SnapshotTimeInterp(pmesh);
+        }
+      }
+      io_time_ += static_cast<double>(io_timer.seconds());
+
+      // Elastic rank rescaling: periodically check for a request to change the number
+      // of active ranks, and redistribute MeshBlocks to the new decomposition if found
+      if ((pmesh->lb_elastic) && ((pmesh->ncycle)%(pmesh->lb_elastic_ncyc) == 0)) {
+        pmesh->pmr->CheckElasticRescale(this, pin);
+      }
 
       // AMR
-      if (pmesh->adaptive) {pmesh->pmr->AdaptiveMeshRefinement(this, pin);}
-      // compute new timestep AFTER all Meshblocks refined/derefined
-      pmesh->NewTimeStep(tlim);
+      if (pmesh->adaptive) {
+        Kokkos::Timer amr_timer;   // time spent regridding (perf record)
+        pmesh->pmr->AdaptiveMeshRefinement(this, pin);
+        amr_time_ += static_cast<double>(amr_timer.seconds());
+        // compute new timestep AFTER all Meshblocks refined/derefined
+        pmesh->NewTimeStepStart();
+      }
+      pmesh->NewTimeStepFinish(tlim);
 
       // Update wall clock time if needed.
       if (wall_time > 0.) {
@@ -473,6 +652,46 @@ void Driver::Finalize(Mesh *pmesh, ParameterInput *pin, Outputs *pout) {
       std::cout << "zone-cycles/cpu_second = " << zcps << std::endl;
       std::cout << "particle-updates/cpu_second = " << pups << std::endl;
     }
+
+    // dump final kernel/region timing statistics covering the whole run (gathers
+    // across ranks, so all ranks must call)
+    if (profiler::enabled) {
+      std::uint64_t zcycles = nmb_updated_ *
+                              static_cast<uint64_t>(pmesh->NumberOfMeshBlockCells());
+      profiler::Dump(pmesh->ncycle, static_cast<double>(exe_time),
+                     static_cast<double>(zcycles));
+    }
+
+    // dump final memory accounting registry, including the per-module device
+    // high-water marks of the whole run (all ranks must call)
+    if (memlog::enabled) {memlog::Dump(pmesh->ncycle);}
+
+    // write the per-run performance record used for cross-run trend tracking (reduces
+    // stall totals across ranks, so all ranks must call)
+    if (perfrec::enabled) {
+      perfrec::RunSummary run;
+      run.ncycle = pmesh->ncycle;
+      run.time = static_cast<double>(pmesh->time);
+      run.wall_time = static_cast<double>(exe_time);
+      run.zone_cycles = nmb_updated_ *
+                        static_cast<uint64_t>(pmesh->NumberOfMeshBlockCells());
+      run.part_updates = npart_updated_;
+      run.nmb_total = pmesh->nmb_total;
+      run.adaptive = pmesh->adaptive;
+      run.nmb_created = (pmesh->adaptive)? pmesh->pmr->nmb_created : 0;
+      run.nmb_deleted = (pmesh->adaptive)? pmesh->pmr->nmb_deleted : 0;
+      run.nmb_sent_lb = (pmesh->adaptive)? pmesh->pmr->nmb_sent_thisrank : 0;
+      run.lb_efficiency = (pmesh->ncycle > 0)?
+          static_cast<double>(lb_efficiency_)/pmesh->ncycle : 0.0;
+      run.amr_time = amr_time_;
+      run.io_time = io_time_;
+      perfrec::Dump(run);
+    }
+
+    // persist autotuned launch bounds so subsequent runs skip exploration
+    if (autotune::enabled && (global_variable::my_rank == 0)) {
+      autotune::DumpCache();
+    }
   }
   return;
 }
@@ -491,6 +710,20 @@ void Driver::OutputCycleDiagnostics(Mesh *pm) {
   return;
 }
 
+//----------------------------------------------------------------------------------------
+//! \fn Driver::STSStages()
+//! \brief Computes number of stages s used to advance diffusion terms over the full
+//! (advective) timestep with RKL2 super-time-stepping.  RKL2 with s stages is stable for
+//! dt <= (dt_diff)*(s^2 + s - 2)/4, so s is taken as the smallest odd integer satisfying
+//! this bound (odd s preferred for stability, see Meyer, Balsara, & Aslam (2014) S2.2).
+
+int Driver::STSStages(Mesh *pm) {
+  Real ratio = (pm->dt)/(pm->dt_diff);
+  int s = 1 + static_cast<int>(0.5*(sqrt(9.0 + 16.0*ratio) - 1.0));
+  if (s%2 == 0) {s++;}
+  return s;
+}
+
 //----------------------------------------------------------------------------------------
 //! \fn Driver::UpdateWallClock()
 //! \brief Update and sync the wall clock across all MPI ranks. This is necessary because
@@ -530,12 +763,39 @@ void Driver::InitBoundaryValuesAndPrimitives(Mesh *pm) {
     (void) pz4c->Z4cBoundaryRHS(this, 0);
     (void) pz4c->ApplyPhysicalBCs(this, 0);
     (void) pz4c->Prolongate(this, 0);
+    // refresh ADM variables from the z4c state now that its ghost zones are filled
+    // (restart files hold interior zones only, so ADM ghosts are stale until here)
+    (void) pz4c->Z4cToADM_(this, 0);
+  }
+
+  // Initialize ion-neutral (two-fluid) MHD: ghost zones of both fluids are exchanged
+  // through the fused (combined size) MHD boundary buffers, so neither the Hydro nor
+  // the MHD per-fluid exchanges below can be used (message sizes would not match)
+  ion_neutral::IonNeutral *pionn = pm->pmb_pack->pionn;
+  hydro::Hydro *phydro = pm->pmb_pack->phydro;
+  mhd::MHD *pmhd = pm->pmb_pack->pmhd;
+  if (pionn != nullptr) {
+    (void) phydro->RestrictU(this, 0);
+    (void) pmhd->RestrictU(this, 0);
+    (void) pmhd->RestrictB(this, 0);
+    (void) pionn->InitRecv(this, -1);  // stage < 0 suppresses InitFluxRecv
+    (void) pionn->SendU(this, 0);
+    (void) pmhd->SendB(this, 0);
+    (void) pmhd->ClearSend(this, -1); // stage = -1 only clear SendU, SendB
+    (void) pmhd->ClearRecv(this, -1); // stage = -1 only clear RecvU, RecvB
+    (void) pionn->RecvU(this, 0);
+    (void) pmhd->RecvB(this, 0);
+    (void) pmhd->ApplyPhysicalBCs(this, 0);
+    (void) phydro->ApplyPhysicalBCs(this, 0);
+    (void) pmhd->Prolongate(this, 0);
+    (void) phydro->Prolongate(this, 0);
+    (void) pmhd->ConToPrim(this, 0);
+    (void) phydro->ConToPrim(this, 0);
   }
 
   // Initialize HYDRO: ghost zones and primitive variables (everywhere)
   // includes communications for shearing box boundaries
-  hydro::Hydro *phydro = pm->pmb_pack->phydro;
-  if (phydro != nullptr) {
+  if (phydro != nullptr && pionn == nullptr) {
     // following functions return a TaskStatus, but it is ignored so cast to (void)
     (void) phydro->RestrictU(this, 0);
     (void) phydro->InitRecv(this, -1);  // stage < 0 suppresses InitFluxRecv
@@ -554,9 +814,8 @@ void Driver::InitBoundaryValuesAndPrimitives(Mesh *pm) {
 
   // Initialize MHD: ghost zones and primitive variables (everywhere)
   // includes communications for shearing box boundaries
-  mhd::MHD *pmhd = pm->pmb_pack->pmhd;
   dyngr::DynGRMHD *pdyngr = pm->pmb_pack->pdyngr;
-  if (pmhd != nullptr) {
+  if (pmhd != nullptr && pionn == nullptr) {
     (void) pmhd->RestrictU(this, 0);
     (void) pmhd->RestrictB(this, 0);
     (void) pmhd->InitRecv(this, -1);  // stage < 0 suppresses InitFluxRecv
@@ -586,6 +845,7 @@ void Driver::InitBoundaryValuesAndPrimitives(Mesh *pm) {
 
   // Initialize radiation: ghost zones and intensity (everywhere)
   // DOES NOT include communications for shearing box boundaries
+#if RADIATION_ENABLED
   radiation::Radiation *prad = pm->pmb_pack->prad;
   if (prad != nullptr) {
     (void) prad->RestrictI(this, 0);
@@ -597,6 +857,7 @@ void Driver::InitBoundaryValuesAndPrimitives(Mesh *pm) {
     (void) prad->ApplyPhysicalBCs(this, 0);
     (void) prad->Prolongate(this, 0);
   }
+#endif
 
   return;
 }
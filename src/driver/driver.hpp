@@ -15,6 +15,7 @@
 #include <ctime>
 #include <memory>
 #include <string>
+#include <vector>
 
 #include "parameter_input.hpp"
 #include "outputs/outputs.hpp"
@@ -36,6 +37,7 @@ class Driver {
   Real tlim;      // stopping time
   int nlim;       // cycle-limit
   int ndiag;      // cycles between output of diagnostic information
+  int nprof;      // cycles between profiler dumps (0 = dump only in Finalize)
   // variables for various SSP and ImEx RK integrators
   std::string integrator;          // integrator name (rk1, rk2, rk3)
   int nimp_stages;                 // number of implicit stages (ImEx only)
@@ -44,9 +46,21 @@ class Driver {
   Real delta[4];                   // weights for updating the intermediate stage (u1)
   Real a_twid[4][4], a_impl;       // matrix elements for implicit stages in ImEx
   Real cfl_limit;                  // maximum CFL number for integrator
+  // variables for RKL2 super-time-stepping of diffusion terms
+  bool use_sts;                    // advance diffusion with operator-split RKL2 STS
+  int nsts_stages;                 // number of STS stages (s) used this cycle
+  // variables for asynchronous task launch over multiple execution space instances
+  int nstreams;                      // number of instances (streams) in pool
+  std::vector<DevExeSpace> streams;  // pool of instances; streams[0] is the default
+  int current_stream=0;              // pool index assigned to currently executing task
   Kokkos::Timer* pwall_clock_;     // timer for tracking the wall clock
   Real wall_time;
 
+  // returns execution space instance assigned to the currently executing task.  This is
+  // the default instance unless task was flagged asynchronous at AddTask() and the task
+  // list was executed with nstreams > 1
+  DevExeSpace &ExecSpace() {return streams[current_stream];}
+
   // functions
   void ExecuteTaskList(Mesh *pm, std::string tl, int stage);
   void Initialize(Mesh *pmesh, ParameterInput *pin, Outputs *pout, bool rflag);
@@ -59,7 +73,11 @@ class Driver {
   std::uint64_t nmb_updated_;   // running total of MB updated during run
   std::uint64_t npart_updated_; // running total of particles updated during run
   float lb_efficiency_;         // measure of how efficient was load balancing
+  // per-rank stall totals for the per-run performance record ('<time> perf_record')
+  double amr_time_ = 0.0;       // total time in AMR regridding (seconds)
+  double io_time_ = 0.0;        // total time in the per-cycle output path (seconds)
   void OutputCycleDiagnostics(Mesh *pm);
   Real UpdateWallClock();
+  int STSStages(Mesh *pm);
 };
 #endif // DRIVER_DRIVER_HPP_
@@ -156,22 +156,16 @@ void DynGRMHDPS<EOSPolicy, ErrorPolicy>::QueueDynGRMHDTasks() {
     abort();
   }
 
-  // Now the rest of the MHD run tasks
-  if (pz4c != nullptr) {
-    pnr->QueueTask(&DynGRMHD::SetTmunu, this, MHD_SetTmunu, "MHD_SetTmunu",
-                   Task_Run, {MHD_CopyU});
-  }
+  // Now the rest of the MHD run tasks.  Note there is no standalone Tmunu task: the
+  // stress-energy tensor consumed by Z4c_CalcRHS this stage is assembled by the fused
+  // epilogue of the previous stage's MHD_C2P (ConToPrim below), from the same state
+  // the old start-of-stage sweep would have read.
   pnr->QueueTask(&MHD::SendFlux, pmhd, MHD_SendFlux, "MHD_SendFlux",
                  Task_Run, {MHD_Flux});
   pnr->QueueTask(&MHD::RecvFlux, pmhd, MHD_RecvFlux, "MHD_RecvFlux",
                  Task_Run, {MHD_SendFlux});
-  if (pz4c != nullptr) {
-    pnr->QueueTask(&MHD::RKUpdate, pmhd, MHD_ExplRK, "MHD_ExplRK", Task_Run,
-                   {MHD_RecvFlux, MHD_SetTmunu});
-  } else {
-    pnr->QueueTask(&MHD::RKUpdate, pmhd, MHD_ExplRK, "MHD_ExplRK", Task_Run,
-                   {MHD_RecvFlux});
-  }
+  pnr->QueueTask(&MHD::RKUpdate, pmhd, MHD_ExplRK, "MHD_ExplRK", Task_Run,
+                 {MHD_RecvFlux});
   pnr->QueueTask(&MHD::MHDSrcTerms, pmhd, MHD_AddSrc, "MHD_AddSrc", Task_Run,
                  {MHD_ExplRK});
   pnr->QueueTask(&MHD::RestrictU, pmhd, MHD_RestU, "MHD_RestU", Task_Run, {MHD_AddSrc});
@@ -255,8 +249,10 @@ TaskStatus DynGRMHDPS<EOSPolicy, ErrorPolicy>::ConToPrim(Driver *pdrive, int sta
   int n1m1 = indcs.nx1 + 2*ng - 1;
   int n2m1 = (indcs.nx2 > 1)? (indcs.nx2 + 2*ng - 1) : 0;
   int n3m1 = (indcs.nx3 > 1)? (indcs.nx3 + 2*ng - 1) : 0;
+  // the stress-energy tensor needed by the z4c RHS of the next stage is assembled in
+  // the same sweep (set_tmunu), eliminating the standalone SetTmunu kernel
   eos.ConsToPrim(pmy_pack->pmhd->u0, pmy_pack->pmhd->b0, pmy_pack->pmhd->bcc0,
-                 pmy_pack->pmhd->w0, 0, n1m1, 0, n2m1, 0, n3m1, false);
+                 pmy_pack->pmhd->w0, 0, n1m1, 0, n2m1, 0, n3m1, false, true);
   return TaskStatus::complete;
 }
 
@@ -376,12 +372,26 @@ TaskStatus DynGRMHD::SetTmunu(Driver *pdrive, int stage) {
   auto &cons = pmy_pack->pmhd->u0;
   auto &bcc = pmy_pack->pmhd->bcc0;
 
+  const int imap[3][3] = {
+    {S11, S12, S13},
+    {S12, S22, S23},
+    {S13, S23, S33}
+  };
+
   par_for("dyngr_tmunu_loop",DevExeSpace(),0,nmb-1,ks,ke,js,je,is,ie,
   KOKKOS_LAMBDA(const int m, const int k, const int j, const int i) {
+    // Load the metric, velocity, field, and conserved quantities for this cell once;
+    // the assembly below then runs entirely on registers.
+    Real g3d[NSPMETRIC] = {adm.g_dd(m,0,0,k,j,i), adm.g_dd(m,0,1,k,j,i),
+                           adm.g_dd(m,0,2,k,j,i), adm.g_dd(m,1,1,k,j,i),
+                           adm.g_dd(m,1,2,k,j,i), adm.g_dd(m,2,2,k,j,i)};
+    Real v_u[3] = {prim(m, IVX, k, j, i), prim(m, IVY, k, j, i), prim(m, IVZ, k, j, i)};
+    Real B_u[3] = {bcc(m, IBX, k, j, i), bcc(m, IBY, k, j, i), bcc(m, IBZ, k, j, i)};
+    Real S_m[3] = {cons(m, IM1, k, j, i), cons(m, IM2, k, j, i), cons(m, IM3, k, j, i)};
+
     // Calculate the determinant/volume form
-    Real detg = adm::SpatialDet(adm.g_dd(m,0,0,k,j,i),adm.g_dd(m,0,1,k,j,i),
-                                adm.g_dd(m,0,2,k,j,i),adm.g_dd(m,1,1,k,j,i),
-                                adm.g_dd(m,1,2,k,j,i),adm.g_dd(m,2,2,k,j,i));
+    Real detg = adm::SpatialDet(g3d[S11], g3d[S12], g3d[S13],
+                                g3d[S22], g3d[S23], g3d[S33]);
     Real ivol = 1.0/sqrt(detg);
 
     // Calculate the lower velocity components
@@ -390,29 +400,29 @@ TaskStatus DynGRMHD::SetTmunu(Driver *pdrive, int stage) {
     Real B_d[3] = {0.0};
     for (int a = 0; a < 3; ++a) {
       for (int b = 0; b < 3; ++b) {
-        v_d[a] += prim(m, IVX + b, k, j, i)*adm.g_dd(m, a, b, k, j, i);
-        iW += prim(m, IVX + a, k, j, i)*prim(m, IVX + b, k, j, i) *
-                adm.g_dd(m, a, b, k, j, i);
-        B_d[a] += bcc(m, b, k, j, i)*adm.g_dd(m, a, b, k, j, i)*ivol;
+        v_d[a] += v_u[b]*g3d[imap[a][b]];
+        iW += v_u[a]*v_u[b]*g3d[imap[a][b]];
+        B_d[a] += B_u[b]*g3d[imap[a][b]]*ivol;
       }
     }
     iW = 1.0/sqrt(1. + iW);
     Real Bv = 0.;
     Real Bsq = 0.;
     for (int a = 0; a < 3; ++a) {
-      Bv += bcc(m, a, k, j, i) * v_d[a]*ivol;
-      Bsq += bcc(m, a, k, j, i) * B_d[a]*ivol;
+      Bv += B_u[a] * v_d[a]*ivol;
+      Bsq += B_u[a] * B_d[a]*ivol;
     }
     Real bsq = (Bsq + Bv*Bv)*(iW*iW);
+    Real ptot = prim(m, IPR, k, j, i) + 0.5*bsq;
 
     tmunu.E(m, k, j, i) = (cons(m, IEN, k, j, i) + cons(m, IDN, k, j, i))*ivol;
     for (int a = 0; a < 3; ++a) {
-      tmunu.S_d(m, a, k, j, i) = cons(m, IM1 + a, k, j, i)*ivol;
+      tmunu.S_d(m, a, k, j, i) = S_m[a]*ivol;
       for (int b = a; b < 3; ++b) {
         tmunu.S_dd(m, a, b, k, j, i) =
-              cons(m, IM1 + a, k, j, i)*ivol*v_d[b]*iW
+              S_m[a]*ivol*v_d[b]*iW
               - (B_d[a] + Bv*v_d[a])*SQR(iW)*B_d[b]
-              + (prim(m, IPR, k, j, i) + 0.5*bsq)*adm.g_dd(m, a, b, k, j, i);
+              + ptot*g3d[imap[a][b]];
       }
     }
   });
@@ -68,7 +68,8 @@ TaskStatus DynGRMHDPS<EOSPolicy, ErrorPolicy>::CalcFluxes(Driver *pdriver, int s
   // i-direction
 
   size_t scr_size = ScrArray2D<Real>::shmem_size(nvars, ncells1) * 2 +
-                    ScrArray2D<Real>::shmem_size(3, ncells1) * 2;
+                    ScrArray2D<Real>::shmem_size(3, ncells1) * 2 +
+                    ScrArray1D<Real>::shmem_size(ncells1);
   int scr_level = scratch_level;
   auto flx1_ = pmy_pack->pmhd->uflx.x1f;
   auto &e31_ = pmy_pack->pmhd->e3x1;
@@ -108,14 +109,25 @@ TaskStatus DynGRMHDPS<EOSPolicy, ErrorPolicy>::CalcFluxes(Driver *pdriver, int s
       // JF: These higher-order reconstruction methods all need EOS_Data to calculate a
       // floor. However, it isn't used by DynGRMHD at all.
       case ReconstructionMethod::ppm4:
-      case ReconstructionMethod::ppmx:
-        PiecewiseParabolicX1(member,eos_,extrema,false, m, k, j, il-1, iu, w0_, wl, wr);
-        PiecewiseParabolicX1(member,eos_,extrema,false, m, k, j, il-1, iu, b0_, bl, br);
+      case ReconstructionMethod::ppmx: {
+        // scratch pencil shared by both calls (barriers inside wrapper protect reuse)
+        ScrArray1D<Real> qs(member.team_scratch(scr_level), ncells1);
+        PiecewiseParabolicX1(member,eos_,extrema,false, m,k,j, il-1, iu, w0_, qs, wl, wr);
+        PiecewiseParabolicX1(member,eos_,extrema,false, m,k,j, il-1, iu, b0_, qs, bl, br);
         break;
-      case ReconstructionMethod::wenoz:
-        WENOZX1(member, eos_, false, m, k, j, il-1, iu, w0_, wl, wr);
-        WENOZX1(member, eos_, false, m, k, j, il-1, iu, b0_, bl, br);
+      }
+      case ReconstructionMethod::wenoz: {
+        ScrArray1D<Real> qs(member.team_scratch(scr_level), ncells1);
+        WENOZX1(member, eos_, false, m, k, j, il-1, iu, w0_, qs, wl, wr);
+        WENOZX1(member, eos_, false, m, k, j, il-1, iu, b0_, qs, bl, br);
+        break;
+      }
+      case ReconstructionMethod::wenoza: {
+        ScrArray1D<Real> qs(member.team_scratch(scr_level), ncells1);
+        WENOZAX1(member, eos_, false, m, k, j, il-1, iu, w0_, qs, wl, wr);
+        WENOZAX1(member, eos_, false, m, k, j, il-1, iu, b0_, qs, bl, br);
         break;
+      }
       default:
         break;
     }
@@ -228,6 +240,10 @@ TaskStatus DynGRMHDPS<EOSPolicy, ErrorPolicy>::CalcFluxes(Driver *pdriver, int s
             WENOZX2(member, eos_, false, m, k, j, is-1, ie+1, w0_, wl_jp1, wr);
             WENOZX2(member, eos_, false, m, k, j, is-1, ie+1, b0_, bl_jp1, br);
             break;
+          case ReconstructionMethod::wenoza:
+            WENOZAX2(member, eos_, false, m, k, j, is-1, ie+1, w0_, wl_jp1, wr);
+            WENOZAX2(member, eos_, false, m, k, j, is-1, ie+1, b0_, bl_jp1, br);
+            break;
           default:
             break;
         }
@@ -336,6 +352,10 @@ TaskStatus DynGRMHDPS<EOSPolicy, ErrorPolicy>::CalcFluxes(Driver *pdriver, int s
             WENOZX3(member, eos_, false, m, k, j, is-1, ie+1, w0_, wl_kp1, wr);
             WENOZX3(member, eos_, false, m, k, j, is-1, ie+1, b0_, bl_kp1, br);
             break;
+          case ReconstructionMethod::wenoza:
+            WENOZAX3(member, eos_, false, m, k, j, is-1, ie+1, w0_, wl_kp1, wr);
+            WENOZAX3(member, eos_, false, m, k, j, is-1, ie+1, b0_, bl_kp1, br);
+            break;
           default:
             break;
         }
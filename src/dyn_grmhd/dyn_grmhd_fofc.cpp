@@ -118,7 +118,7 @@ void DynGRMHDPS<EOSPolicy, ErrorPolicy>::FOFC(Driver *pdriver, int stage) {
           }
           if (utest_(m,indcs[n],k,j,i) > dmp_M_*varmax ||
               utest_(m,indcs[n],k,j,i) < varmin/dmp_M_) {
-            fofc_(m,k,j,i) = true;
+            fofc_.Set(m,k,j,i);
           }
         }
       }
@@ -156,6 +156,8 @@ void DynGRMHDPS<EOSPolicy, ErrorPolicy>::FOFC(Driver *pdriver, int stage) {
   auto &eos_ = eos;
   auto &use_excise_ = pmy_pack->pcoord->coord_data.bh_excise;
   auto &excision_flux_ = pmy_pack->pcoord->excision_flux;
+  auto &mb_excised_ = pmy_pack->pcoord->mb_excised;
+  auto &mb_all_excised_ = pmy_pack->pcoord->mb_all_excised;
   auto &w0_ = pmy_pack->pmhd->w0;
   auto &b0_ = pmy_pack->pmhd->b0;
   auto &adm = pmy_pack->padm->adm;
@@ -165,17 +167,26 @@ void DynGRMHDPS<EOSPolicy, ErrorPolicy>::FOFC(Driver *pdriver, int stage) {
   if (multi_d) { jl = js-1, ju = je+1; }
   if (three_d) { kl = ks-1, ku = ke+1; }
 
+  // Pack-level early-out: if no cell is flagged a cheap scan of the packed flag words
+  // (64 cells per word) skips the flux-replacement sweeps entirely.  Not applicable
+  // when excision can flag cells independently of the FOFC bits.
+  if (use_fofc_ && !use_excise_) {
+    if (!fofc_.AnySet()) { return; }
+  }
+
   // Replace fluxes with first-order LLF fluxes at i,j,k faces for any cell where FOFC
   // and/or excision is used (if GR+excising)
   par_for("FOFC-flx", DevExeSpace(), 0, nmb-1, kl, ku, jl, ju, il, iu,
   KOKKOS_LAMBDA(const int m, const int k, const int j, const int i) {
     // Check for FOFC flag
     bool fofc_flag = false;
-    if (use_fofc_) { fofc_flag = fofc_(m,k,j,i); }
+    if (use_fofc_) { fofc_flag = fofc_.Test(m,k,j,i); }
 
     // Check for GR + excision
     bool fofc_excision = false;
-    if (use_excise_) { fofc_excision = excision_flux_(m,k,j,i); }
+    if (use_excise_ && mb_excised_(m)) {
+      fofc_excision = mb_all_excised_(m) || excision_flux_(m,k,j,i);
+    }
 
     // Apply FOFC
     if (fofc_flag || fofc_excision) {
@@ -298,11 +309,13 @@ void DynGRMHDPS<EOSPolicy, ErrorPolicy>::FOFC(Driver *pdriver, int stage) {
   KOKKOS_LAMBDA(const int m, const int k, const int j, const int i) {
     // Check for FOFC flag
     bool fofc_flag = false;
-    if (use_fofc_) { fofc_flag = fofc_(m,k,j,i); }
+    if (use_fofc_) { fofc_flag = fofc_.Test(m,k,j,i); }
 
     // Check for GR + excision
     bool fofc_excision = false;
-    if (use_excise_) { fofc_excision = excision_flux_(m,k,j,i); }
+    if (use_excise_ && mb_excised_(m)) {
+      fofc_excision = mb_all_excised_(m) || excision_flux_(m,k,j,i);
+    }
 
     // Apply FOFC
     if (fofc_flag || fofc_excision) {
@@ -424,7 +437,7 @@ void DynGRMHDPS<EOSPolicy, ErrorPolicy>::FOFC(Driver *pdriver, int stage) {
 
   // reset FOFC flag (do not reset excision flag)
   if (use_fofc_) {
-    Kokkos::deep_copy(fofc_, false);
+    fofc_.ZeroClear();
   }
 
   return;
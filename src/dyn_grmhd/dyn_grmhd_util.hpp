@@ -11,6 +11,7 @@
 #include "athena.hpp"
 #include "coordinates/adm.hpp"
 #include "dyn_grmhd.hpp"
+#include "eos/eos.hpp"
 #include "eos/primitive_solver_hyd.hpp"
 #include "reconstruct/plm.hpp"
 
@@ -23,6 +23,9 @@ EquationOfState::EquationOfState(std::string bk, MeshBlockPack* pp, ParameterInp
   eos_data.pfloor = pin->GetOrAddReal(bk,"pfloor",(FLT_MIN));
   eos_data.tfloor = pin->GetOrAddReal(bk,"tfloor",(FLT_MIN));
   eos_data.sfloor = pin->GetOrAddReal(bk,"sfloor",(FLT_MIN));
+  // the FLT_MIN default leaves the entropy floor effectively disabled; record that so
+  // hot loops can skip the pow() needed to evaluate it
+  eos_data.use_sfloor = (eos_data.sfloor > (FLT_MIN));
 }
 
 //----------------------------------------------------------------------------------------
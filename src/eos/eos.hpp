@@ -31,6 +31,13 @@ struct EOS_Data {
   bool use_e, use_t; // use internal energy density (e) or temperature (t) as primitive
   Real dfloor, pfloor, tfloor, sfloor;  // density, pressure, temperature, entropy floors
   Real gamma_max;    // ceiling on Lorentz factor in SR/GR
+  // gamma-derived constants folded once in the ideal gas constructors, so the per-cell
+  // c2p/p2c inline functions and Riemann solvers use reciprocal multiplies and loads
+  // instead of recomputing divides for every cell/interface
+  Real gm1;          // gamma - 1
+  Real igm1;         // 1/(gamma - 1)
+  bool use_sfloor;   // true only when sfloor is set above its FLT_MIN sentinel; when
+                     // false the per-cell pow() in the entropy-floor checks is skipped
 
   // IDEAL GAS PRESSURE: converts primitive variable (either internal energy density e
   // or temperature e/d) into pressure.
@@ -203,6 +210,13 @@ class EquationOfState {
   MeshBlockPack* pmy_pack;
   EOS_Data eos_data;
 
+  // timestep min-reductions fused into the nonrelativistic ConsToPrim kernels.  Those
+  // kernels accumulate min(dx/max signal speed) in each direction over interior cells
+  // while converting, and set fused_newdt=true, so that Hydro/MHD::NewTimeStep can
+  // consume these values instead of re-reading the primitives they just wrote
+  bool fused_newdt=false;
+  Real dt1_fused, dt2_fused, dt3_fused;
+
   // virtual functions to convert cons to prim in either Hydro or MHD (depending on
   // arguments), overwritten in derived eos classes
   virtual void ConsToPrim(DvceArray5D<Real> &cons, DvceArray5D<Real> &prim,
@@ -384,6 +398,13 @@ class IdealGRMHD : public EquationOfState {
                   const bool only_testfloors,
                   const int il, const int iu, const int jl, const int ju,
                   const int kl, const int ku) override;
+
+  // compacted queue of cells not converged within the bulk-pass iteration cap in
+  // ConsToPrim; re-solved with the full iteration limit in a second dense kernel
+  DvceArray1D<int> retry_list;
+  DvceArray1D<int> nretry;
+  // device-side histogram of solver iteration counts, harvested into EventCounters
+  DvceArray1D<int> c2p_iter_hist;
   void PrimToCons(const DvceArray5D<Real> &prim, const DvceArray5D<Real> &bcc,
                   DvceArray5D<Real> &cons, const int il, const int iu,
                   const int jl, const int ju, const int kl, const int ku) override;
@@ -23,10 +23,10 @@ void SingleC2P_IdealHyd(HydCons1D &u, const EOS_Data &eos,
                         HydPrim1D &w,
                         bool &dfloor_used, bool &efloor_used, bool &tfloor_used) {
   const Real &dfloor_ = eos.dfloor;
-  Real efloor = eos.pfloor/(eos.gamma - 1.0);
+  Real efloor = eos.pfloor*eos.igm1;
   Real tfloor = eos.tfloor;
   Real sfloor = eos.sfloor;
-  Real gm1 = eos.gamma - 1.0;
+  Real gm1 = eos.gm1;
 
   // apply density floor, without changing momentum or energy
   if (u.d < dfloor_) {
@@ -51,16 +51,19 @@ void SingleC2P_IdealHyd(HydCons1D &u, const EOS_Data &eos,
   }
   // apply temperature floor
   if (gm1*w.e*di < tfloor) {
-    w.e = w.d*tfloor/gm1;
+    w.e = w.d*tfloor*eos.igm1;
     u.e = w.e + e_k;
     tfloor_used = true;
   }
-  // apply entropy floor
-  Real spe_over_eps = gm1/pow(w.d, gm1);
-  Real spe = spe_over_eps*w.e*di;
-  if (spe <= sfloor) {
-    w.e = w.d*sfloor/spe_over_eps;
-    efloor_used = true;
+  // apply entropy floor (skipped entirely when sfloor is left at its FLT_MIN sentinel,
+  // which saves the per-cell pow)
+  if (eos.use_sfloor) {
+    Real spe_over_eps = gm1/pow(w.d, gm1);
+    Real spe = spe_over_eps*w.e*di;
+    if (spe <= sfloor) {
+      w.e = w.d*sfloor/spe_over_eps;
+      efloor_used = true;
+    }
   }
   return;
 }
@@ -90,11 +93,12 @@ void SingleP2C_IdealHyd(const HydPrim1D &w, HydCons1D &u) {
 
 KOKKOS_INLINE_FUNCTION
 Real EquationC22(Real z, Real &u_d, Real q, Real r, EOS_Data eos) {
-  Real const gm1 = eos.gamma - 1.0;
+  Real const gm1 = eos.gm1;
   Real const w = sqrt(1.0 + z*z);         // (C15)
   Real const wd = u_d/w;                  // (C15)
   Real eps = w*q - z*r + (z*z)/(1.0 + w); // (C16)
-  Real epsmin = fmax(eos.pfloor/(wd*gm1), eos.sfloor*pow(wd, gm1)/gm1);
+  Real epsmin = eos.pfloor*eos.igm1/wd;
+  if (eos.use_sfloor) {epsmin = fmax(epsmin, eos.sfloor*pow(wd, gm1)*eos.igm1);}
   eps = fmax(eps, epsmin);                // (C18)
   Real const h = 1.0 + eos.gamma*eps;     // (C1) & (C21)
   return (z - r/h); // (C22)
@@ -104,17 +108,20 @@ Real EquationC22(Real z, Real &u_d, Real q, Real r, EOS_Data eos) {
 //! \fn void SingleC2P_IdealSRHyd()
 //! \brief Converts single state of conserved variables into primitive variables for
 //! special relativistic hydrodynamics with an ideal gas EOS.
+//! A non-negative z_old (the root z = Wv evaluated at the primitives of the previous
+//! stage) hot-starts the root find: one function evaluation at the guess collapses the
+//! side of the bracket the root is not in, so the iteration starts nearly converged.
 
 KOKKOS_INLINE_FUNCTION
 void SingleC2P_IdealSRHyd(HydCons1D &u, const EOS_Data &eos, const Real s2, HydPrim1D &w,
                           bool &dfloor_used, bool &efloor_used, bool &c2p_failure,
-                          int &iter_used) {
+                          int &iter_used, const Real z_old = -1.0) {
   // Parameters
   const int max_iterations = 25;
   const Real tol = 1.0e-12;
   const Real v_max = 0.9999999999995;  // NOTE(@pdmullen): SQR(v_max) = 1.0 - tol;
   const Real kmax = 2.0*v_max/(1.0 + v_max*v_max);
-  const Real gm1 = eos.gamma - 1.0;
+  const Real gm1 = eos.gm1;
 
   // apply density floor, without changing momentum or energy
   if (u.d < eos.dfloor) {
@@ -123,8 +130,8 @@ void SingleC2P_IdealSRHyd(HydCons1D &u, const EOS_Data &eos, const Real s2, HydP
   }
 
   // apply energy floor
-  if (u.e < eos.pfloor/gm1) {
-    u.e = eos.pfloor/gm1;
+  if (u.e < eos.pfloor*eos.igm1) {
+    u.e = eos.pfloor*eos.igm1;
     efloor_used = true;
   }
 
@@ -145,6 +152,18 @@ void SingleC2P_IdealSRHyd(HydCons1D &u, const EOS_Data &eos, const Real s2, HydP
   Real fm = EquationC22(zm, u.d, q, r, eos);
   Real fp = EquationC22(zp, u.d, q, r, eos);
 
+  // hot start: collapse one side of the bracket using the previous-stage root
+  if (z_old > zm && z_old < zp) {
+    Real fg = EquationC22(z_old, u.d, q, r, eos);
+    if (fg*fp < 0.0) {
+      zm = z_old;
+      fm = fg;
+    } else {
+      zp = z_old;
+      fp = fg;
+    }
+  }
+
   // For simplicity on the GPU, find roots using the false position method
   int iterations = max_iterations;
   // If bracket within tolerances, don't bother doing any iterations
@@ -182,7 +201,7 @@ void SingleC2P_IdealSRHyd(HydCons1D &u, const EOS_Data &eos, const Real s2, HydP
   // of a C2P failure.
   if (iter_used==max_iterations) {
     w.d = eos.dfloor;
-    w.e = eos.pfloor/gm1;
+    w.e = eos.pfloor*eos.igm1;
     w.vx = 0.0;
     w.vy = 0.0;
     w.vz = 0.0;
@@ -202,7 +221,8 @@ void SingleC2P_IdealSRHyd(HydCons1D &u, const EOS_Data &eos, const Real s2, HydP
 
   // compute specific internal energy density then apply floor
   Real eps = lor*q - z*r + (z*z)/(1.0 + lor);   // (C16)
-  Real epsmin = fmax(eos.pfloor/(dens*gm1), eos.sfloor*pow(dens, gm1)/gm1);
+  Real epsmin = eos.pfloor*eos.igm1/dens;
+  if (eos.use_sfloor) {epsmin = fmax(epsmin, eos.sfloor*pow(dens, gm1)*eos.igm1);}
   if (eps <= epsmin) {
     eps = epsmin;
     efloor_used = true;
@@ -22,10 +22,10 @@ void SingleC2P_IdealMHD(MHDCons1D &u, const EOS_Data &eos,
                         HydPrim1D &w,
                         bool &dfloor_used, bool &efloor_used, bool &tfloor_used) {
   const Real &dfloor_ = eos.dfloor;
-  Real efloor = eos.pfloor/(eos.gamma - 1.0);
+  Real efloor = eos.pfloor*eos.igm1;
   Real tfloor = eos.tfloor;
   Real sfloor = eos.sfloor;
-  Real gm1 = eos.gamma - 1.0;
+  Real gm1 = eos.gm1;
 
   // apply density floor, without changing momentum or energy
   if (u.d < dfloor_) {
@@ -51,16 +51,19 @@ void SingleC2P_IdealMHD(MHDCons1D &u, const EOS_Data &eos,
   }
   // apply temperature floor
   if (gm1*w.e*di < tfloor) {
-    w.e = w.d*tfloor/gm1;
+    w.e = w.d*tfloor*eos.igm1;
     u.e = w.e + e_k + e_m;
     tfloor_used =true;
   }
-  // apply entropy floor
-  Real spe_over_eps = gm1/pow(w.d, gm1);
-  Real spe = spe_over_eps*w.e*di;
-  if (spe <= sfloor) {
-    w.e = w.d*sfloor/spe_over_eps;
-    efloor_used = true;
+  // apply entropy floor (skipped entirely when sfloor is left at its FLT_MIN sentinel,
+  // which saves the per-cell pow)
+  if (eos.use_sfloor) {
+    Real spe_over_eps = gm1/pow(w.d, gm1);
+    Real spe = spe_over_eps*w.e*di;
+    if (spe <= sfloor) {
+      w.e = w.d*sfloor/spe_over_eps;
+      efloor_used = true;
+    }
   }
   return;
 }
@@ -110,8 +113,9 @@ Real Equation44(const Real mu, const Real b2, const Real rpar, const Real r, con
   Real w = sqrt(1.+z2);
   Real const wd = u_d/w;                           // (34)
   Real eps = w*(qbar - mu*rbar) + z2/(w+1.);
-  Real const gm1 = eos.gamma - 1.0;
-  Real epsmin = fmax(eos.pfloor/(wd*gm1), eos.sfloor*pow(wd, gm1)/gm1);
+  Real const gm1 = eos.gm1;
+  Real epsmin = eos.pfloor*eos.igm1/wd;
+  if (eos.use_sfloor) {epsmin = fmax(epsmin, eos.sfloor*pow(wd, gm1)*eos.igm1);}
   eps = fmax(eps, epsmin);
   Real const h = 1.0 + eos.gamma*eps;              // (43)
   return mu - 1./(h/w + rbar*mu);                  // (45)
@@ -122,15 +126,22 @@ Real Equation44(const Real mu, const Real b2, const Real rpar, const Real r, con
 //! \brief Converts single state of conserved variables into primitive variables for
 //! special relativistic MHD with an ideal gas EOS. Note input CONSERVED state contains
 //! cell-centered magnetic fields, but PRIMITIVE state returned via arguments does not.
+//! Iterations are capped at max_iterations; if the root find has not converged by then
+//! c2p_failure is set.  Callers may pass a cap below the default limit to defer hard
+//! cells to a separate retry pass (see IdealGRMHD::ConsToPrim).
+//! A non-negative mu_old (the root mu = 1/(hW) evaluated at the primitives of the
+//! previous stage) hot-starts the root find: one function evaluation at the guess
+//! collapses the side of the bracket the root is not in, so the iteration starts
+//! nearly converged.
 
 KOKKOS_INLINE_FUNCTION
 void SingleC2P_IdealSRMHD(MHDCons1D &u, const EOS_Data &eos, Real s2, Real b2, Real rpar,
                           HydPrim1D &w, bool &dfloor_used, bool &efloor_used,
-                          bool &c2p_failure, int &max_iter) {
+                          bool &c2p_failure, int &max_iter,
+                          const int max_iterations, const Real mu_old = -1.0) {
   // Parameters
-  const int max_iterations = 25;
   const Real tol = 1.0e-12;
-  const Real gm1 = eos.gamma - 1.0;
+  const Real gm1 = eos.gm1;
 
   // apply density floor, without changing momentum or energy
   if (u.d < eos.dfloor) {
@@ -139,8 +150,8 @@ void SingleC2P_IdealSRMHD(MHDCons1D &u, const EOS_Data &eos, Real s2, Real b2, R
   }
 
   // apply energy floor
-  if (u.e < (eos.pfloor/gm1 + 0.5*b2)) {
-    u.e = eos.pfloor/gm1 + 0.5*b2;
+  if (u.e < (eos.pfloor*eos.igm1 + 0.5*b2)) {
+    u.e = eos.pfloor*eos.igm1 + 0.5*b2;
     efloor_used = true;
   }
 
@@ -204,6 +215,18 @@ void SingleC2P_IdealSRMHD(MHDCons1D &u, const EOS_Data &eos, Real s2, Real b2, R
   fm = Equation44(zm, b2, rpar, r, q, u.d, eos);
   fp = Equation44(zp, b2, rpar, r, q, u.d, eos);
 
+  // hot start: collapse one side of the bracket using the previous-stage root
+  if (mu_old > zm && mu_old < zp) {
+    Real fg = Equation44(mu_old, b2, rpar, r, q, u.d, eos);
+    if (fg*fp < 0.0) {
+      zm = mu_old;
+      fm = fg;
+    } else {
+      zp = mu_old;
+      fp = fg;
+    }
+  }
+
   iterations = max_iterations;
   if ((fabs(zm-zp) < tol) || ((fabs(fm) + fabs(fp)) < 2.0*tol)) {
     iterations = -1;
@@ -238,7 +261,7 @@ void SingleC2P_IdealSRMHD(MHDCons1D &u, const EOS_Data &eos, Real s2, Real b2, R
   // of a C2P failure.
   if (max_iter==max_iterations) {
     w.d = eos.dfloor;
-    w.e = eos.pfloor/gm1;
+    w.e = eos.pfloor*eos.igm1;
     w.vx = 0.0;
     w.vy = 0.0;
     w.vz = 0.0;
@@ -263,7 +286,8 @@ void SingleC2P_IdealSRMHD(MHDCons1D &u, const EOS_Data &eos, Real s2, Real b2, R
 
   // compute specific internal energy density then apply floors
   Real eps = lor*(qbar - mu*rbar) + z2/(lor + 1.0);
-  Real epsmin = fmax(eos.pfloor/(dens*gm1), eos.sfloor*pow(dens, gm1)/gm1);
+  Real epsmin = eos.pfloor*eos.igm1/dens;
+  if (eos.use_sfloor) {epsmin = fmax(epsmin, eos.sfloor*pow(dens, gm1)*eos.igm1);}
   if (eps <= epsmin) {
     eps = epsmin;
     efloor_used = true;
@@ -283,6 +307,18 @@ void SingleC2P_IdealSRMHD(MHDCons1D &u, const EOS_Data &eos, Real s2, Real b2, R
   return;
 }
 
+//----------------------------------------------------------------------------------------
+//! \fn void SingleC2P_IdealSRMHD()
+//! \brief Overload with the default iteration limit.
+
+KOKKOS_INLINE_FUNCTION
+void SingleC2P_IdealSRMHD(MHDCons1D &u, const EOS_Data &eos, Real s2, Real b2, Real rpar,
+                          HydPrim1D &w, bool &dfloor_used, bool &efloor_used,
+                          bool &c2p_failure, int &max_iter, const Real mu_old = -1.0) {
+  SingleC2P_IdealSRMHD(u, eos, s2, b2, rpar, w, dfloor_used, efloor_used,
+                       c2p_failure, max_iter, 25, mu_old);
+}
+
 //--------------------------------------------------------------------------------------
 //! \fn void SingleP2C_IdealSRMHD()
 //! \brief Converts single set of primitive into conserved variables in SRMHD.
@@ -26,6 +26,8 @@ IdealGRHydro::IdealGRHydro(MeshBlockPack *pp, ParameterInput *pin) :
     EquationOfState("hydro", pp, pin) {
   eos_data.is_ideal = true;
   eos_data.gamma = pin->GetReal("hydro","gamma");
+  eos_data.gm1 = eos_data.gamma - 1.0;
+  eos_data.igm1 = 1.0/(eos_data.gamma - 1.0);
   eos_data.iso_cs = 0.0;
   eos_data.use_e = true;  // ideal gas EOS always uses internal energy
   eos_data.use_t = false;
@@ -53,9 +55,13 @@ void IdealGRHydro::ConsToPrim(DvceArray5D<Real> &cons, DvceArray5D<Real> &prim,
 
   auto &flat = pmy_pack->pcoord->coord_data.is_minkowski;
   auto &spin = pmy_pack->pcoord->coord_data.bh_spin;
+  auto &use_cache = pmy_pack->pcoord->coord_data.cache_metric;
+  auto &mscal_cc = pmy_pack->pcoord->coord_data.mscal_cc;
   auto &use_excise = pmy_pack->pcoord->coord_data.bh_excise;
   auto &excision_floor_ = pmy_pack->pcoord->excision_floor;
   auto &excision_flux_ = pmy_pack->pcoord->excision_flux;
+  auto &mb_excised_ = pmy_pack->pcoord->mb_excised;
+  auto &mb_all_excised_ = pmy_pack->pcoord->mb_all_excised;
   auto &dexcise_ = pmy_pack->pcoord->coord_data.dexcise;
   auto &pexcise_ = pmy_pack->pcoord->coord_data.pexcise;
 
@@ -96,7 +102,12 @@ void IdealGRHydro::ConsToPrim(DvceArray5D<Real> &cons, DvceArray5D<Real> &prim,
     Real x3v = CellCenterX(k-ks, indcs.nx3, x3min, x3max);
 
     Real glower[4][4], gupper[4][4];
-    ComputeMetricAndInverse(x1v, x2v, x3v, flat, spin, glower, gupper);
+    if (use_cache) {
+      MetricFromScalars(mscal_cc(m,0,k,j,i), mscal_cc(m,1,k,j,i),
+                        mscal_cc(m,2,k,j,i), mscal_cc(m,3,k,j,i), glower, gupper);
+    } else {
+      ComputeMetricAndInverse(x1v, x2v, x3v, flat, spin, glower, gupper);
+    }
 
     HydPrim1D w;
     bool dfloor_used=false, efloor_used=false;
@@ -104,9 +115,11 @@ void IdealGRHydro::ConsToPrim(DvceArray5D<Real> &cons, DvceArray5D<Real> &prim,
     int iter_used=0;
 
     // Only execute cons2prim if outside excised region
+    // per-MB flag skips mask reads entirely on MBs far from the horizon
     bool excised = false;
-    if (use_excise) {
-      if (excision_floor_(m,k,j,i)) {
+    if (use_excise && mb_excised_(m)) {
+      // fully-excised MBs take the excised branch without per-cell mask reads
+      if (mb_all_excised_(m) || excision_floor_(m,k,j,i)) {
         w.d = dexcise_;
         w.vx = 0.0;
         w.vy = 0.0;
@@ -115,7 +128,7 @@ void IdealGRHydro::ConsToPrim(DvceArray5D<Real> &cons, DvceArray5D<Real> &prim,
         excised = true;
       }
       if (only_testfloors) {
-        if (excision_flux_(m,k,j,i)) {
+        if (mb_all_excised_(m) || excision_flux_(m,k,j,i)) {
           excised = true;
         }
       }
@@ -127,10 +140,27 @@ void IdealGRHydro::ConsToPrim(DvceArray5D<Real> &cons, DvceArray5D<Real> &prim,
       Real s2;
       TransformToSRHyd(u,glower,gupper,s2,u_sr);
 
+      // hot-start guess for the c2p root from the previous-stage primitives stored in
+      // prim: the root is z = Wv, which changes little over one stage.  Invalid before
+      // prim is first initialized; a negative value disables the guess.
+      Real z_old = -1.0;
+      if (prim(m,IDN,k,j,i) > 0.0) {
+        Real usq = glower[1][1]*SQR(prim(m,IVX,k,j,i))
+                 + glower[2][2]*SQR(prim(m,IVY,k,j,i))
+                 + glower[3][3]*SQR(prim(m,IVZ,k,j,i))
+                 + 2.0*glower[1][2]*prim(m,IVX,k,j,i)*prim(m,IVY,k,j,i)
+                 + 2.0*glower[1][3]*prim(m,IVX,k,j,i)*prim(m,IVZ,k,j,i)
+                 + 2.0*glower[2][3]*prim(m,IVY,k,j,i)*prim(m,IVZ,k,j,i);
+        z_old = sqrt(usq);
+        if (!isfinite(z_old)) {
+          z_old = -1.0;
+        }
+      }
+
       // call c2p function
       // (inline function in ideal_c2p_hyd.hpp file)
       SingleC2P_IdealSRHyd(u_sr, eos, s2, w,
-                           dfloor_used, efloor_used, c2p_failure, iter_used);
+                           dfloor_used, efloor_used, c2p_failure, iter_used, z_old);
 
       // apply velocity ceiling if necessary
       Real tmp = glower[1][1]*SQR(w.vx)
@@ -151,7 +181,7 @@ void IdealGRHydro::ConsToPrim(DvceArray5D<Real> &cons, DvceArray5D<Real> &prim,
     // set FOFC flag and quit loop if this function called only to check floors
     if (only_testfloors) {
       if (dfloor_used || efloor_used || vceiling_used || c2p_failure) {
-        fofc_(m,k,j,i) = true;
+        fofc_.Set(m,k,j,i);
         sumd++;  // use dfloor as counter for when either is true
       }
     } else {
@@ -213,6 +243,8 @@ void IdealGRHydro::PrimToCons(const DvceArray5D<Real> &prim, DvceArray5D<Real> &
   auto &size = pmy_pack->pmb->mb_size;
   auto &flat = pmy_pack->pcoord->coord_data.is_minkowski;
   auto &spin = pmy_pack->pcoord->coord_data.bh_spin;
+  auto &use_cache = pmy_pack->pcoord->coord_data.cache_metric;
+  auto &mscal_cc = pmy_pack->pcoord->coord_data.mscal_cc;
   int &nhyd  = pmy_pack->phydro->nhydro;
   int &nscal = pmy_pack->phydro->nscalars;
   int &nmb = pmy_pack->nmb_thispack;
@@ -234,7 +266,12 @@ void IdealGRHydro::PrimToCons(const DvceArray5D<Real> &prim, DvceArray5D<Real> &
     Real x3v = CellCenterX(k-ks, indcs.nx3, x3min, x3max);
 
     Real glower[4][4], gupper[4][4];
-    ComputeMetricAndInverse(x1v, x2v, x3v, flat, spin, glower, gupper);
+    if (use_cache) {
+      MetricFromScalars(mscal_cc(m,0,k,j,i), mscal_cc(m,1,k,j,i),
+                        mscal_cc(m,2,k,j,i), mscal_cc(m,3,k,j,i), glower, gupper);
+    } else {
+      ComputeMetricAndInverse(x1v, x2v, x3v, flat, spin, glower, gupper);
+    }
 
     // Load single state of primitive variables
     HydPrim1D w;
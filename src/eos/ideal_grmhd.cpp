@@ -24,6 +24,8 @@ IdealGRMHD::IdealGRMHD(MeshBlockPack *pp, ParameterInput *pin) :
     EquationOfState("mhd", pp, pin) {
   eos_data.is_ideal = true;
   eos_data.gamma = pin->GetReal("mhd","gamma");
+  eos_data.gm1 = eos_data.gamma - 1.0;
+  eos_data.igm1 = 1.0/(eos_data.gamma - 1.0);
   eos_data.iso_cs = 0.0;
   eos_data.use_e = true;  // ideal gas EOS always uses internal energy
   eos_data.use_t = false;
@@ -52,9 +54,13 @@ void IdealGRMHD::ConsToPrim(DvceArray5D<Real> &cons, const DvceFaceFld4D<Real> &
 
   auto &flat = pmy_pack->pcoord->coord_data.is_minkowski;
   auto &spin = pmy_pack->pcoord->coord_data.bh_spin;
+  auto &use_cache = pmy_pack->pcoord->coord_data.cache_metric;
+  auto &mscal_cc = pmy_pack->pcoord->coord_data.mscal_cc;
   auto &use_excise = pmy_pack->pcoord->coord_data.bh_excise;
   auto &excision_floor_ = pmy_pack->pcoord->excision_floor;
   auto &excision_flux_ = pmy_pack->pcoord->excision_flux;
+  auto &mb_excised_ = pmy_pack->pcoord->mb_excised;
+  auto &mb_all_excised_ = pmy_pack->pcoord->mb_all_excised;
   auto &dexcise_ = pmy_pack->pcoord->coord_data.dexcise;
   auto &pexcise_ = pmy_pack->pcoord->coord_data.pexcise;
 
@@ -63,6 +69,30 @@ void IdealGRMHD::ConsToPrim(DvceArray5D<Real> &cons, const DvceFaceFld4D<Real> &
   const int nkji = (ku - kl + 1)*nji;
   const int nmkji = nmb*nkji;
 
+  // Iteration limits for two-pass c2p.  The bulk pass caps the root find at a few
+  // iterations so that a handful of hard cells cannot stall entire warps; unconverged
+  // cells are compacted into retry_list and re-solved with the full limit in a dense
+  // second kernel below.  Floor tests (FOFC) always use the full limit in one pass.
+  const int full_iterations = 25;
+  const int bulk_iterations = (only_testfloors)? full_iterations : 10;
+
+  // (re-)allocate retry queue if too small for current number of cells
+  if (!only_testfloors) {
+    if (retry_list.extent_int(0) < nmkji) { Kokkos::realloc(retry_list, nmkji); }
+    if (nretry.extent_int(0) < 1) { Kokkos::realloc(nretry, 1); }
+    Kokkos::deep_copy(nretry, 0);
+  }
+  auto &rlist_ = retry_list;
+  auto &nretry_ = nretry;
+
+  // (re-)allocate and zero device-side histogram of solver iteration counts
+  const int nhist = EventCounters::nhist_c2p;
+  if (!only_testfloors) {
+    if (c2p_iter_hist.extent_int(0) < nhist) { Kokkos::realloc(c2p_iter_hist, nhist); }
+    Kokkos::deep_copy(c2p_iter_hist, 0);
+  }
+  auto &hist_ = c2p_iter_hist;
+
   int nfloord_=0, nfloore_=0, nceilv_=0, nfail_=0, maxit_=0;
   Kokkos::parallel_reduce("grmhd_c2p",Kokkos::RangePolicy<>(DevExeSpace(), 0, nmkji),
   KOKKOS_LAMBDA(const int &idx, int &sumd, int &sume, int &sumv, int &sumf, int &max_it) {
@@ -108,7 +138,12 @@ void IdealGRMHD::ConsToPrim(DvceArray5D<Real> &cons, const DvceFaceFld4D<Real> &
     Real x3v = CellCenterX(k-ks, indcs.nx3, x3min, x3max);
 
     Real glower[4][4], gupper[4][4];
-    ComputeMetricAndInverse(x1v, x2v, x3v, flat, spin, glower, gupper);
+    if (use_cache) {
+      MetricFromScalars(mscal_cc(m,0,k,j,i), mscal_cc(m,1,k,j,i),
+                        mscal_cc(m,2,k,j,i), mscal_cc(m,3,k,j,i), glower, gupper);
+    } else {
+      ComputeMetricAndInverse(x1v, x2v, x3v, flat, spin, glower, gupper);
+    }
 
     HydPrim1D w;
     bool dfloor_used=false, efloor_used=false;
@@ -116,9 +151,11 @@ void IdealGRMHD::ConsToPrim(DvceArray5D<Real> &cons, const DvceFaceFld4D<Real> &
     int iter_used=0;
 
     // Only execute cons2prim if outside excised region
+    // per-MB flag skips mask reads entirely on MBs far from the horizon
     bool excised = false;
-    if (use_excise) {
-      if (excision_floor_(m,k,j,i)) {
+    if (use_excise && mb_excised_(m)) {
+      // fully-excised MBs take the excised branch without per-cell mask reads
+      if (mb_all_excised_(m) || excision_floor_(m,k,j,i)) {
         w.d = dexcise_;
         w.vx = 0.0;
         w.vy = 0.0;
@@ -127,43 +164,76 @@ void IdealGRMHD::ConsToPrim(DvceArray5D<Real> &cons, const DvceFaceFld4D<Real> &
         excised = true;
       }
       if (only_testfloors) {
-        if (excision_flux_(m,k,j,i)) {
+        if (mb_all_excised_(m) || excision_flux_(m,k,j,i)) {
           excised = true;
         }
       }
     }
 
+    bool deferred = false;
     if (!(excised)) {
       // calculate SR conserved quantities
       MHDCons1D u_sr;
       Real s2, b2, rpar;
       TransformToSRMHD(u,glower,gupper,s2,b2,rpar,u_sr);
 
-      // call c2p function
+      // hot-start guess for the c2p root from the previous-stage primitives stored in
+      // prim: the root is mu = 1/(hW), and both h and W change little over one stage.
+      // Invalid before prim is first initialized; a negative value disables the guess.
+      Real mu_old = -1.0;
+      if (prim(m,IDN,k,j,i) > 0.0) {
+        Real usq = glower[1][1]*SQR(prim(m,IVX,k,j,i))
+                 + glower[2][2]*SQR(prim(m,IVY,k,j,i))
+                 + glower[3][3]*SQR(prim(m,IVZ,k,j,i))
+                 + 2.0*glower[1][2]*prim(m,IVX,k,j,i)*prim(m,IVY,k,j,i)
+                 + 2.0*glower[1][3]*prim(m,IVX,k,j,i)*prim(m,IVZ,k,j,i)
+                 + 2.0*glower[2][3]*prim(m,IVY,k,j,i)*prim(m,IVZ,k,j,i);
+        Real lor_old = sqrt(1.0 + usq);
+        Real h_old = 1.0 + eos.gamma*prim(m,IEN,k,j,i)/prim(m,IDN,k,j,i);
+        mu_old = 1.0/(h_old*lor_old);
+        if (!isfinite(mu_old)) {
+          mu_old = -1.0;
+        }
+      }
+
+      // call c2p function with bulk-pass iteration cap
       // (inline function in ideal_c2p_mhd.hpp file)
       SingleC2P_IdealSRMHD(u_sr, eos, s2, b2, rpar, w,
-                           dfloor_used, efloor_used, c2p_failure, iter_used);
-
-      // apply velocity ceiling if necessary
-      Real tmp = glower[1][1]*SQR(w.vx)
-               + glower[2][2]*SQR(w.vy)
-               + glower[3][3]*SQR(w.vz)
-               + 2.0*glower[1][2]*w.vx*w.vy + 2.0*glower[1][3]*w.vx*w.vz
-               + 2.0*glower[2][3]*w.vy*w.vz;
-      Real lor = sqrt(1.0+tmp);
-      if (lor > eos.gamma_max) {
-        vceiling_used = true;
-        Real factor = sqrt((SQR(eos.gamma_max)-1.0)/(SQR(lor)-1.0));
-        w.vx *= factor;
-        w.vy *= factor;
-        w.vz *= factor;
+                           dfloor_used, efloor_used, c2p_failure, iter_used,
+                           bulk_iterations, mu_old);
+
+      // defer unconverged cells to the compacted retry pass below
+      if (c2p_failure && (bulk_iterations < full_iterations)) {
+        int n = Kokkos::atomic_fetch_add(&nretry_(0), 1);
+        rlist_(n) = idx;
+        deferred = true;
+      } else {
+        // apply velocity ceiling if necessary
+        Real tmp = glower[1][1]*SQR(w.vx)
+                 + glower[2][2]*SQR(w.vy)
+                 + glower[3][3]*SQR(w.vz)
+                 + 2.0*glower[1][2]*w.vx*w.vy + 2.0*glower[1][3]*w.vx*w.vz
+                 + 2.0*glower[2][3]*w.vy*w.vz;
+        Real lor = sqrt(1.0+tmp);
+        if (lor > eos.gamma_max) {
+          vceiling_used = true;
+          Real factor = sqrt((SQR(eos.gamma_max)-1.0)/(SQR(lor)-1.0));
+          w.vx *= factor;
+          w.vy *= factor;
+          w.vz *= factor;
+        }
       }
     }
 
+    // deferred cells are finalized in the retry pass; do nothing more here
+    if (deferred) {
+      return;
+    }
+
     // set FOFC flag and quit loop if this function called only to check floors
     if (only_testfloors) {
       if (dfloor_used || efloor_used || vceiling_used || c2p_failure) {
-        fofc_(m,k,j,i) = true;
+        fofc_.Set(m,k,j,i);
         sumd++;  // use dfloor as counter for when either is true
       }
     } else {
@@ -172,6 +242,9 @@ void IdealGRMHD::ConsToPrim(DvceArray5D<Real> &cons, const DvceFaceFld4D<Real> &
       if (vceiling_used) {sumv++;}
       if (c2p_failure) {sumf++;}
       max_it = (iter_used > max_it) ? iter_used : max_it;
+      if (!(excised)) {
+        Kokkos::atomic_add(&hist_((iter_used < nhist)? iter_used : nhist-1), 1);
+      }
 
       // store primitive state in 3D array
       prim(m,IDN,k,j,i) = w.d;
@@ -215,6 +288,146 @@ void IdealGRMHD::ConsToPrim(DvceArray5D<Real> &cons, const DvceFaceFld4D<Real> &
   }, Kokkos::Sum<int>(nfloord_), Kokkos::Sum<int>(nfloore_), Kokkos::Sum<int>(nceilv_),
      Kokkos::Sum<int>(nfail_), Kokkos::Max<int>(maxit_));
 
+  // Retry pass: re-solve cells deferred by the bulk pass with the full iteration limit.
+  // The queue is dense, so the cost of deep Newton iteration is paid only by the few
+  // cells that need it.
+  if (!only_testfloors) {
+    HostArray1D<int> nretry_h("nretry_h", 1);
+    Kokkos::deep_copy(nretry_h, nretry);
+    int nr = nretry_h(0);
+    if (nr > 0) {
+      int nfloord2_=0, nfloore2_=0, nceilv2_=0, nfail2_=0, maxit2_=0;
+      Kokkos::parallel_reduce("grmhd_c2p_retry",
+        Kokkos::RangePolicy<>(DevExeSpace(), 0, nr),
+      KOKKOS_LAMBDA(const int &n, int &sumd, int &sume, int &sumv, int &sumf,
+                    int &max_it) {
+        int idx = rlist_(n);
+        int m = (idx)/nkji;
+        int k = (idx - m*nkji)/nji;
+        int j = (idx - m*nkji - k*nji)/ni;
+        int i = (idx - m*nkji - k*nji - j*ni) + il;
+        j += jl;
+        k += kl;
+
+        // load single state conserved variables
+        MHDCons1D u;
+        u.d  = cons(m,IDN,k,j,i);
+        u.mx = cons(m,IM1,k,j,i);
+        u.my = cons(m,IM2,k,j,i);
+        u.mz = cons(m,IM3,k,j,i);
+        u.e  = cons(m,IEN,k,j,i);
+
+        // load cell-centered fields using linear average of face-centered fields
+        u.bx = 0.5*(b.x1f(m,k,j,i) + b.x1f(m,k,j,i+1));
+        u.by = 0.5*(b.x2f(m,k,j,i) + b.x2f(m,k,j+1,i));
+        u.bz = 0.5*(b.x3f(m,k,j,i) + b.x3f(m,k+1,j,i));
+
+        // Extract components of metric
+        Real &x1min = size.d_view(m).x1min;
+        Real &x1max = size.d_view(m).x1max;
+        Real x1v = CellCenterX(i-is, indcs.nx1, x1min, x1max);
+
+        Real &x2min = size.d_view(m).x2min;
+        Real &x2max = size.d_view(m).x2max;
+        Real x2v = CellCenterX(j-js, indcs.nx2, x2min, x2max);
+
+        Real &x3min = size.d_view(m).x3min;
+        Real &x3max = size.d_view(m).x3max;
+        Real x3v = CellCenterX(k-ks, indcs.nx3, x3min, x3max);
+
+        Real glower[4][4], gupper[4][4];
+        if (use_cache) {
+          MetricFromScalars(mscal_cc(m,0,k,j,i), mscal_cc(m,1,k,j,i),
+                            mscal_cc(m,2,k,j,i), mscal_cc(m,3,k,j,i), glower, gupper);
+        } else {
+          ComputeMetricAndInverse(x1v, x2v, x3v, flat, spin, glower, gupper);
+        }
+
+        HydPrim1D w;
+        bool dfloor_used=false, efloor_used=false;
+        bool vceiling_used=false, c2p_failure=false;
+        int iter_used=0;
+
+        // calculate SR conserved quantities (excised cells are never deferred)
+        MHDCons1D u_sr;
+        Real s2, b2, rpar;
+        TransformToSRMHD(u,glower,gupper,s2,b2,rpar,u_sr);
+
+        // call c2p function with the full iteration limit
+        SingleC2P_IdealSRMHD(u_sr, eos, s2, b2, rpar, w,
+                             dfloor_used, efloor_used, c2p_failure, iter_used);
+
+        // apply velocity ceiling if necessary
+        Real tmp = glower[1][1]*SQR(w.vx)
+                 + glower[2][2]*SQR(w.vy)
+                 + glower[3][3]*SQR(w.vz)
+                 + 2.0*glower[1][2]*w.vx*w.vy + 2.0*glower[1][3]*w.vx*w.vz
+                 + 2.0*glower[2][3]*w.vy*w.vz;
+        Real lor = sqrt(1.0+tmp);
+        if (lor > eos.gamma_max) {
+          vceiling_used = true;
+          Real factor = sqrt((SQR(eos.gamma_max)-1.0)/(SQR(lor)-1.0));
+          w.vx *= factor;
+          w.vy *= factor;
+          w.vz *= factor;
+        }
+
+        if (dfloor_used) {sumd++;}
+        if (efloor_used) {sume++;}
+        if (vceiling_used) {sumv++;}
+        if (c2p_failure) {sumf++;}
+        max_it = (iter_used > max_it) ? iter_used : max_it;
+        Kokkos::atomic_add(&hist_((iter_used < nhist)? iter_used : nhist-1), 1);
+
+        // store primitive state in 3D array
+        prim(m,IDN,k,j,i) = w.d;
+        prim(m,IVX,k,j,i) = w.vx;
+        prim(m,IVY,k,j,i) = w.vy;
+        prim(m,IVZ,k,j,i) = w.vz;
+        prim(m,IEN,k,j,i) = w.e;
+
+        // store cell-centered fields in 3D array
+        bcc(m,IBX,k,j,i) = u.bx;
+        bcc(m,IBY,k,j,i) = u.by;
+        bcc(m,IBZ,k,j,i) = u.bz;
+
+        // reset conserved variables if floor, ceiling, or failure encountered
+        if (dfloor_used || efloor_used || vceiling_used || c2p_failure) {
+          MHDPrim1D w_in;
+          w_in.d  = w.d;
+          w_in.vx = w.vx;
+          w_in.vy = w.vy;
+          w_in.vz = w.vz;
+          w_in.e  = w.e;
+          w_in.bx = u.bx;
+          w_in.by = u.by;
+          w_in.bz = u.bz;
+
+          HydCons1D u_out;
+          SingleP2C_IdealGRMHD(glower, gupper, w_in, eos.gamma, u_out);
+          cons(m,IDN,k,j,i) = u_out.d;
+          cons(m,IM1,k,j,i) = u_out.mx;
+          cons(m,IM2,k,j,i) = u_out.my;
+          cons(m,IM3,k,j,i) = u_out.mz;
+          cons(m,IEN,k,j,i) = u_out.e;
+          u.d = u_out.d;  // (needed if there are scalars below)
+        }
+
+        // convert scalars (if any)
+        for (int n2=nmhd; n2<(nmhd+nscal); ++n2) {
+          prim(m,n2,k,j,i) = cons(m,n2,k,j,i)/u.d;
+        }
+      }, Kokkos::Sum<int>(nfloord2_), Kokkos::Sum<int>(nfloore2_),
+         Kokkos::Sum<int>(nceilv2_), Kokkos::Sum<int>(nfail2_), Kokkos::Max<int>(maxit2_));
+
+      nfloord_ += nfloord2_;
+      nfloore_ += nfloore2_;
+      nceilv_  += nceilv2_;
+      nfail_   += nfail2_;
+      maxit_ = (maxit2_ > maxit_) ? maxit2_ : maxit_;
+    }
+  }
+
   // store appropriate counters
   if (only_testfloors) {
     pmy_pack->pmesh->ecounter.nfofc += nfloord_;
@@ -224,6 +437,12 @@ void IdealGRMHD::ConsToPrim(DvceArray5D<Real> &cons, const DvceFaceFld4D<Real> &
     pmy_pack->pmesh->ecounter.neos_vceil  += nceilv_;
     pmy_pack->pmesh->ecounter.neos_fail   += nfail_;
     pmy_pack->pmesh->ecounter.maxit_c2p = maxit_;
+    // harvest device-side iteration histogram into event counters
+    HostArray1D<int> hist_h("c2p_hist_h", nhist);
+    Kokkos::deep_copy(hist_h, c2p_iter_hist);
+    for (int n=0; n<nhist; ++n) {
+      pmy_pack->pmesh->ecounter.nc2p_iter[n] += hist_h(n);
+    }
   }
 
   return;
@@ -242,6 +461,8 @@ void IdealGRMHD::PrimToCons(const DvceArray5D<Real> &prim, const DvceArray5D<Rea
   auto &size = pmy_pack->pmb->mb_size;
   auto &flat = pmy_pack->pcoord->coord_data.is_minkowski;
   auto &spin = pmy_pack->pcoord->coord_data.bh_spin;
+  auto &use_cache = pmy_pack->pcoord->coord_data.cache_metric;
+  auto &mscal_cc = pmy_pack->pcoord->coord_data.mscal_cc;
   int &nmhd  = pmy_pack->pmhd->nmhd;
   int &nscal = pmy_pack->pmhd->nscalars;
   int &nmb = pmy_pack->nmb_thispack;
@@ -263,7 +484,12 @@ void IdealGRMHD::PrimToCons(const DvceArray5D<Real> &prim, const DvceArray5D<Rea
     Real x3v = CellCenterX(k-ks, indcs.nx3, x3min, x3max);
 
     Real glower[4][4], gupper[4][4];
-    ComputeMetricAndInverse(x1v, x2v, x3v, flat, spin, glower, gupper);
+    if (use_cache) {
+      MetricFromScalars(mscal_cc(m,0,k,j,i), mscal_cc(m,1,k,j,i),
+                        mscal_cc(m,2,k,j,i), mscal_cc(m,3,k,j,i), glower, gupper);
+    } else {
+      ComputeMetricAndInverse(x1v, x2v, x3v, flat, spin, glower, gupper);
+    }
 
     // Load single state of primitive variables
     MHDPrim1D w;
@@ -6,7 +6,10 @@
 //! \file ideal_hyd.cpp
 //! \brief derived class that implements ideal gas EOS in nonrelativistic hydro
 
+#include <limits>
+
 #include "athena.hpp"
+#include "mesh/mesh.hpp"
 #include "hydro/hydro.hpp"
 #include "eos/eos.hpp"
 #include "eos/ideal_c2p_hyd.hpp"
@@ -18,6 +21,8 @@ IdealHydro::IdealHydro(MeshBlockPack *pp, ParameterInput *pin) :
     EquationOfState("hydro", pp, pin) {
   eos_data.is_ideal = true;
   eos_data.gamma = pin->GetReal("hydro","gamma");
+  eos_data.gm1 = eos_data.gamma - 1.0;
+  eos_data.igm1 = 1.0/(eos_data.gamma - 1.0);
   eos_data.iso_cs = 0.0;
   eos_data.use_e = true;  // ideal gas EOS always uses internal energy
   eos_data.use_t = false;
@@ -37,6 +42,14 @@ void IdealHydro::ConsToPrim(DvceArray5D<Real> &cons, DvceArray5D<Real> &prim,
   int &nmb = pmy_pack->nmb_thispack;
   auto &eos = eos_data;
   auto &fofc_ = pmy_pack->phydro->fofc;
+  auto &indcs = pmy_pack->pmesh->mb_indcs;
+  auto &mbsize = pmy_pack->pmb->mb_size;
+  int &is = indcs.is, &ie = indcs.ie;
+  int &js = indcs.js, &je = indcs.je;
+  int &ks = indcs.ks, &ke = indcs.ke;
+  // fuse timestep min-reduction into this kernel when sweep covers all interior cells
+  const bool fuse_dt = !(only_testfloors) && (il <= is) && (iu >= ie) &&
+                       (jl <= js) && (ju >= je) && (kl <= ks) && (ku >= ke);
 
   const int ni   = (iu - il + 1);
   const int nji  = (ju - jl + 1)*ni;
@@ -44,8 +57,12 @@ void IdealHydro::ConsToPrim(DvceArray5D<Real> &cons, DvceArray5D<Real> &prim,
   const int nmkji = nmb*nkji;
 
   int nfloord_=0, nfloore_=0, nfloort_=0;
+  Real dt1 = std::numeric_limits<float>::max();
+  Real dt2 = std::numeric_limits<float>::max();
+  Real dt3 = std::numeric_limits<float>::max();
   Kokkos::parallel_reduce("hyd_c2p",Kokkos::RangePolicy<>(DevExeSpace(), 0, nmkji),
-  KOKKOS_LAMBDA(const int &idx, int &sumd, int &sume, int &sumt) {
+  KOKKOS_LAMBDA(const int &idx, int &sumd, int &sume, int &sumt,
+                Real &min_dt1, Real &min_dt2, Real &min_dt3) {
     int m = (idx)/nkji;
     int k = (idx - m*nkji)/nji;
     int j = (idx - m*nkji - k*nji)/ni;
@@ -70,7 +87,7 @@ void IdealHydro::ConsToPrim(DvceArray5D<Real> &cons, DvceArray5D<Real> &prim,
     // set FOFC flag and quit loop if this function called only to check floors
     if (only_testfloors) {
       if (dfloor_used || efloor_used || tfloor_used) {
-        fofc_(m,k,j,i) = true;
+        fofc_.Set(m,k,j,i);
         sumd++;  // use dfloor as counter for when either is true
       }
     } else {
@@ -101,8 +118,18 @@ void IdealHydro::ConsToPrim(DvceArray5D<Real> &cons, DvceArray5D<Real> &prim,
         }
         prim(m,n,k,j,i) = cons(m,n,k,j,i)/u.d;
       }
+      // fused timestep reduction: accumulate min(dx/(v+cs)) over interior cells using
+      // the primitive state just computed, so NewTimeStep need not re-read the array
+      if (fuse_dt && (k >= ks) && (k <= ke) && (j >= js) && (j <= je) &&
+          (i >= is) && (i <= ie)) {
+        Real cs = eos.IdealHydroSoundSpeed(w.d, eos.IdealGasPressure(w.e));
+        min_dt1 = fmin((mbsize.d_view(m).dx1/(fabs(w.vx) + cs)), min_dt1);
+        min_dt2 = fmin((mbsize.d_view(m).dx2/(fabs(w.vy) + cs)), min_dt2);
+        min_dt3 = fmin((mbsize.d_view(m).dx3/(fabs(w.vz) + cs)), min_dt3);
+      }
     }
-  }, Kokkos::Sum<int>(nfloord_), Kokkos::Sum<int>(nfloore_), Kokkos::Sum<int>(nfloort_));
+  }, Kokkos::Sum<int>(nfloord_), Kokkos::Sum<int>(nfloore_), Kokkos::Sum<int>(nfloort_),
+     Kokkos::Min<Real>(dt1), Kokkos::Min<Real>(dt2), Kokkos::Min<Real>(dt3));
 
   // store appropriate counters
   if (only_testfloors) {
@@ -112,6 +139,13 @@ void IdealHydro::ConsToPrim(DvceArray5D<Real> &cons, DvceArray5D<Real> &prim,
     pmy_pack->pmesh->ecounter.neos_efloor += nfloore_;
     pmy_pack->pmesh->ecounter.neos_tfloor += nfloort_;
   }
+  // store fused timestep mins for use in NewTimeStep
+  if (fuse_dt) {
+    dt1_fused = dt1;
+    dt2_fused = dt2;
+    dt3_fused = dt3;
+    fused_newdt = true;
+  }
 
   return;
 }
@@ -6,7 +6,10 @@
 //! \file ideal_mhd.cpp
 //! \brief derived class that implements ideal gas EOS in nonrelativistic mhd
 
+#include <limits>
+
 #include "athena.hpp"
+#include "mesh/mesh.hpp"
 #include "mhd/mhd.hpp"
 #include "eos.hpp"
 #include "eos/ideal_c2p_mhd.hpp"
@@ -18,6 +21,8 @@ IdealMHD::IdealMHD(MeshBlockPack *pp, ParameterInput *pin) :
     EquationOfState("mhd", pp, pin) {
   eos_data.is_ideal = true;
   eos_data.gamma = pin->GetReal("mhd","gamma");
+  eos_data.gm1 = eos_data.gamma - 1.0;
+  eos_data.igm1 = 1.0/(eos_data.gamma - 1.0);
   eos_data.iso_cs = 0.0;
   eos_data.use_e = true;  // ideal gas EOS always uses internal energy
   eos_data.use_t = false;
@@ -38,6 +43,14 @@ void IdealMHD::ConsToPrim(DvceArray5D<Real> &cons, const DvceFaceFld4D<Real> &b,
   int &nmb = pmy_pack->nmb_thispack;
   auto &eos = eos_data;
   auto &fofc_ = pmy_pack->pmhd->fofc;
+  auto &indcs = pmy_pack->pmesh->mb_indcs;
+  auto &mbsize = pmy_pack->pmb->mb_size;
+  int &is = indcs.is, &ie = indcs.ie;
+  int &js = indcs.js, &je = indcs.je;
+  int &ks = indcs.ks, &ke = indcs.ke;
+  // fuse timestep min-reduction into this kernel when sweep covers all interior cells
+  const bool fuse_dt = !(only_testfloors) && (il <= is) && (iu >= ie) &&
+                       (jl <= js) && (ju >= je) && (kl <= ks) && (ku >= ke);
 
   const int ni   = (iu - il + 1);
   const int nji  = (ju - jl + 1)*ni;
@@ -45,8 +58,12 @@ void IdealMHD::ConsToPrim(DvceArray5D<Real> &cons, const DvceFaceFld4D<Real> &b,
   const int nmkji = nmb*nkji;
 
   int nfloord_=0, nfloore_=0, nfloort_=0;
+  Real dt1 = std::numeric_limits<float>::max();
+  Real dt2 = std::numeric_limits<float>::max();
+  Real dt3 = std::numeric_limits<float>::max();
   Kokkos::parallel_reduce("mhd_c2p",Kokkos::RangePolicy<>(DevExeSpace(), 0, nmkji),
-  KOKKOS_LAMBDA(const int &idx, int &sumd, int &sume, int &sumt) {
+  KOKKOS_LAMBDA(const int &idx, int &sumd, int &sume, int &sumt,
+                Real &min_dt1, Real &min_dt2, Real &min_dt3) {
     int m = (idx)/nkji;
     int k = (idx - m*nkji)/nji;
     int j = (idx - m*nkji - k*nji)/ni;
@@ -84,7 +101,7 @@ void IdealMHD::ConsToPrim(DvceArray5D<Real> &cons, const DvceFaceFld4D<Real> &b,
     // set FOFC flag and quit loop if this function called only to check floors
     if (only_testfloors) {
       if (dfloor_used || efloor_used || tfloor_used) {
-        fofc_(m,k,j,i) = true;
+        fofc_.Set(m,k,j,i);
         sumd++;  // use dfloor as counter for when either is true
       }
     } else {
@@ -119,8 +136,21 @@ void IdealMHD::ConsToPrim(DvceArray5D<Real> &cons, const DvceFaceFld4D<Real> &b,
         }
         prim(m,n,k,j,i) = cons(m,n,k,j,i)/u.d;
       }
+      // fused timestep reduction: accumulate min(dx/(v+cf)) over interior cells using
+      // the primitive state just computed, so NewTimeStep need not re-read the arrays
+      if (fuse_dt && (k >= ks) && (k <= ke) && (j >= js) && (j <= je) &&
+          (i >= is) && (i <= ie)) {
+        Real p = eos.IdealGasPressure(w.e);
+        Real cf = eos.IdealMHDFastSpeed(w.d, p, u.bx, u.by, u.bz);
+        min_dt1 = fmin((mbsize.d_view(m).dx1/(fabs(w.vx) + cf)), min_dt1);
+        cf = eos.IdealMHDFastSpeed(w.d, p, u.by, u.bz, u.bx);
+        min_dt2 = fmin((mbsize.d_view(m).dx2/(fabs(w.vy) + cf)), min_dt2);
+        cf = eos.IdealMHDFastSpeed(w.d, p, u.bz, u.bx, u.by);
+        min_dt3 = fmin((mbsize.d_view(m).dx3/(fabs(w.vz) + cf)), min_dt3);
+      }
     }
-  }, Kokkos::Sum<int>(nfloord_), Kokkos::Sum<int>(nfloore_), Kokkos::Sum<int>(nfloort_));
+  }, Kokkos::Sum<int>(nfloord_), Kokkos::Sum<int>(nfloore_), Kokkos::Sum<int>(nfloort_),
+     Kokkos::Min<Real>(dt1), Kokkos::Min<Real>(dt2), Kokkos::Min<Real>(dt3));
 
   // store appropriate counters
   if (only_testfloors) {
@@ -130,6 +160,13 @@ void IdealMHD::ConsToPrim(DvceArray5D<Real> &cons, const DvceFaceFld4D<Real> &b,
     pmy_pack->pmesh->ecounter.neos_efloor += nfloore_;
     pmy_pack->pmesh->ecounter.neos_tfloor += nfloort_;
   }
+  // store fused timestep mins for use in NewTimeStep
+  if (fuse_dt) {
+    dt1_fused = dt1;
+    dt2_fused = dt2;
+    dt3_fused = dt3;
+    fused_newdt = true;
+  }
 
   return;
 }
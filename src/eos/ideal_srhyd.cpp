@@ -22,6 +22,8 @@ IdealSRHydro::IdealSRHydro(MeshBlockPack *pp, ParameterInput *pin) :
     EquationOfState("hydro", pp, pin) {
   eos_data.is_ideal = true;
   eos_data.gamma = pin->GetReal("hydro","gamma");
+  eos_data.gm1 = eos_data.gamma - 1.0;
+  eos_data.igm1 = 1.0/(eos_data.gamma - 1.0);
   eos_data.iso_cs = 0.0;
   eos_data.use_e = true;  // ideal gas EOS always uses internal energy
   eos_data.use_t = false;
@@ -88,6 +90,18 @@ void IdealSRHydro::ConsToPrim(DvceArray5D<Real> &cons, DvceArray5D<Real> &prim,
     // Compute (S^i S_i) (eqn C2)
     Real s2 = SQR(u.mx) + SQR(u.my) + SQR(u.mz);
 
+    // hot-start guess for the c2p root from the previous-stage primitives stored in
+    // prim: the root is z = Wv, which changes little over one stage.  Invalid before
+    // prim is first initialized; a negative value disables the guess.
+    Real z_old = -1.0;
+    if (prim(m,IDN,k,j,i) > 0.0) {
+      z_old = sqrt(SQR(prim(m,IVX,k,j,i)) + SQR(prim(m,IVY,k,j,i))
+                 + SQR(prim(m,IVZ,k,j,i)));
+      if (!isfinite(z_old)) {
+        z_old = -1.0;
+      }
+    }
+
     // call c2p function
     // (inline function in ideal_c2p_hyd.hpp file)
     HydPrim1D w;
@@ -95,7 +109,7 @@ void IdealSRHydro::ConsToPrim(DvceArray5D<Real> &cons, DvceArray5D<Real> &prim,
     bool vceiling_used=false, c2p_failure=false;
     int iter_used=0;
     SingleC2P_IdealSRHyd(u, eos, s2, w,
-                         dfloor_used, efloor_used, c2p_failure, iter_used);
+                         dfloor_used, efloor_used, c2p_failure, iter_used, z_old);
     // apply velocity ceiling if necessary
     Real lor = sqrt(1.0+SQR(w.vx)+SQR(w.vy)+SQR(w.vz));
     if (lor > eos.gamma_max) {
@@ -109,7 +123,7 @@ void IdealSRHydro::ConsToPrim(DvceArray5D<Real> &cons, DvceArray5D<Real> &prim,
     // set FOFC flag and quit loop if this function called only to check floors
     if (only_testfloors) {
       if (dfloor_used || efloor_used || vceiling_used || c2p_failure) {
-        fofc_(m,k,j,i) = true;
+        fofc_.Set(m,k,j,i);
         sumd++;  // use dfloor as counter for when either is true
       }
     } else {
@@ -20,6 +20,8 @@ IdealSRMHD::IdealSRMHD(MeshBlockPack *pp, ParameterInput *pin) :
     EquationOfState("mhd", pp, pin) {
   eos_data.is_ideal = true;
   eos_data.gamma = pin->GetReal("mhd","gamma");
+  eos_data.gm1 = eos_data.gamma - 1.0;
+  eos_data.igm1 = 1.0/(eos_data.gamma - 1.0);
   eos_data.iso_cs = 0.0;
   eos_data.use_e = true;  // ideal gas EOS always uses internal energy
   eos_data.use_t = false;
@@ -102,6 +104,20 @@ void IdealSRMHD::ConsToPrim(DvceArray5D<Real> &cons, const DvceFaceFld4D<Real> &
     Real b2 = SQR(u.bx) + SQR(u.by) + SQR(u.bz);
     Real rpar = (u.bx*u.mx +  u.by*u.my +  u.bz*u.mz)/u.d;
 
+    // hot-start guess for the c2p root from the previous-stage primitives stored in
+    // prim: the root is mu = 1/(hW), and both h and W change little over one stage.
+    // Invalid before prim is first initialized; a negative value disables the guess.
+    Real mu_old = -1.0;
+    if (prim(m,IDN,k,j,i) > 0.0) {
+      Real lor_old = sqrt(1.0 + SQR(prim(m,IVX,k,j,i)) + SQR(prim(m,IVY,k,j,i))
+                              + SQR(prim(m,IVZ,k,j,i)));
+      Real h_old = 1.0 + eos.gamma*prim(m,IEN,k,j,i)/prim(m,IDN,k,j,i);
+      mu_old = 1.0/(h_old*lor_old);
+      if (!isfinite(mu_old)) {
+        mu_old = -1.0;
+      }
+    }
+
     // call c2p function
     // (inline function in ideal_c2p_mhd.hpp file)
     HydPrim1D w;
@@ -109,7 +125,7 @@ void IdealSRMHD::ConsToPrim(DvceArray5D<Real> &cons, const DvceFaceFld4D<Real> &
     bool vceiling_used=false, c2p_failure=false;
     int iter_used=0;
     SingleC2P_IdealSRMHD(u, eos, s2, b2, rpar, w,
-                         dfloor_used, efloor_used, c2p_failure, iter_used);
+                         dfloor_used, efloor_used, c2p_failure, iter_used, mu_old);
     // apply velocity ceiling if necessary
     Real lor = sqrt(1.0+SQR(w.vx)+SQR(w.vy)+SQR(w.vz));
     if (lor > eos.gamma_max) {
@@ -123,7 +139,7 @@ void IdealSRMHD::ConsToPrim(DvceArray5D<Real> &cons, const DvceFaceFld4D<Real> &
     // set FOFC flag and quit loop if this function called only to check floors
     if (only_testfloors) {
       if (dfloor_used || efloor_used || vceiling_used || c2p_failure) {
-        fofc_(m,k,j,i) = true;
+        fofc_.Set(m,k,j,i);
         sumd++;  // use dfloor as counter for when either is true
       }
     } else {
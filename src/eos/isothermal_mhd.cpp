@@ -6,6 +6,8 @@
 //! \file isothermal_mhd.cpp
 //! \brief derived class that implements isothermal EOS for nonrelativistic mhd
 
+#include <limits>
+
 #include "athena.hpp"
 #include "parameter_input.hpp"
 #include "mesh/mesh.hpp"
@@ -20,6 +22,10 @@ IsothermalMHD::IsothermalMHD(MeshBlockPack *pp, ParameterInput *pin) :
   eos_data.is_ideal = false;
   eos_data.iso_cs = pin->GetReal("mhd","iso_sound_speed");
   eos_data.gamma = 0.0;
+  // gamma-derived constants are meaningless with an isothermal EOS, but are still read
+  // (and discarded) when computing floors in the reconstruction wrappers, so set them
+  eos_data.gm1 = 0.0;
+  eos_data.igm1 = 0.0;
   eos_data.use_e = false;
   eos_data.use_t = false;
 }
@@ -77,6 +83,15 @@ void IsothermalMHD::ConsToPrim(DvceArray5D<Real> &cons, const DvceFaceFld4D<Real
   int &nmb = pmy_pack->nmb_thispack;
   auto &fofc_ = pmy_pack->pmhd->fofc;
   Real dfloor = eos_data.dfloor;
+  auto &eos = eos_data;
+  auto &indcs = pmy_pack->pmesh->mb_indcs;
+  auto &mbsize = pmy_pack->pmb->mb_size;
+  int &is = indcs.is, &ie = indcs.ie;
+  int &js = indcs.js, &je = indcs.je;
+  int &ks = indcs.ks, &ke = indcs.ke;
+  // fuse timestep min-reduction into this kernel when sweep covers all interior cells
+  const bool fuse_dt = !(only_testfloors) && (il <= is) && (iu >= ie) &&
+                       (jl <= js) && (ju >= je) && (kl <= ks) && (ku >= ke);
 
   const int ni   = (iu - il + 1);
   const int nji  = (ju - jl + 1)*ni;
@@ -84,8 +99,12 @@ void IsothermalMHD::ConsToPrim(DvceArray5D<Real> &cons, const DvceFaceFld4D<Real
   const int nmkji = nmb*nkji;
 
   int nfloord_=0;
+  Real dt1 = std::numeric_limits<float>::max();
+  Real dt2 = std::numeric_limits<float>::max();
+  Real dt3 = std::numeric_limits<float>::max();
   Kokkos::parallel_reduce("isomhd_c2p",Kokkos::RangePolicy<>(DevExeSpace(), 0, nmkji),
-  KOKKOS_LAMBDA(const int &idx, int &sumd) {
+  KOKKOS_LAMBDA(const int &idx, int &sumd,
+                Real &min_dt1, Real &min_dt2, Real &min_dt3) {
     int m = (idx)/nkji;
     int k = (idx - m*nkji)/nji;
     int j = (idx - m*nkji - k*nji)/ni;
@@ -118,7 +137,7 @@ void IsothermalMHD::ConsToPrim(DvceArray5D<Real> &cons, const DvceFaceFld4D<Real
 
     // set FOFC flag and quit loop if this function called only to check floors
     if (only_testfloors) {
-      if (dfloor_used) {fofc_(m,k,j,i) = true;}
+      if (dfloor_used) {fofc_.Set(m,k,j,i);}
     } else {
       // store primitive state in 3D array
       prim(m,IDN,k,j,i) = w.d;
@@ -133,8 +152,20 @@ void IsothermalMHD::ConsToPrim(DvceArray5D<Real> &cons, const DvceFaceFld4D<Real
       for (int n=nmhd; n<(nmhd+nscal); ++n) {
         prim(m,n,k,j,i) = cons(m,n,k,j,i)/u.d;
       }
+      // fused timestep reduction: accumulate min(dx/(v+cf)) over interior cells using
+      // the primitive state just computed, so NewTimeStep need not re-read the arrays
+      if (fuse_dt && (k >= ks) && (k <= ke) && (j >= js) && (j <= je) &&
+          (i >= is) && (i <= ie)) {
+        Real cf = eos.IdealMHDFastSpeed(w.d, u.bx, u.by, u.bz);
+        min_dt1 = fmin((mbsize.d_view(m).dx1/(fabs(w.vx) + cf)), min_dt1);
+        cf = eos.IdealMHDFastSpeed(w.d, u.by, u.bz, u.bx);
+        min_dt2 = fmin((mbsize.d_view(m).dx2/(fabs(w.vy) + cf)), min_dt2);
+        cf = eos.IdealMHDFastSpeed(w.d, u.bz, u.bx, u.by);
+        min_dt3 = fmin((mbsize.d_view(m).dx3/(fabs(w.vz) + cf)), min_dt3);
+      }
     }
-  }, Kokkos::Sum<int>(nfloord_));
+  }, Kokkos::Sum<int>(nfloord_),
+     Kokkos::Min<Real>(dt1), Kokkos::Min<Real>(dt2), Kokkos::Min<Real>(dt3));
 
   // store appropriate counters
   if (only_testfloors) {
@@ -142,6 +173,13 @@ void IsothermalMHD::ConsToPrim(DvceArray5D<Real> &cons, const DvceFaceFld4D<Real
   } else {
     pmy_pack->pmesh->ecounter.neos_dfloor += nfloord_;
   }
+  // store fused timestep mins for use in NewTimeStep
+  if (fuse_dt) {
+    dt1_fused = dt1;
+    dt2_fused = dt2;
+    dt3_fused = dt3;
+    fused_newdt = true;
+  }
 
   return;
 }
@@ -46,13 +46,13 @@ void EOSCompOSE::ReadTableFromFile(std::string fname) {
     Kokkos::realloc(m_log_nb, m_nn);
     Kokkos::realloc(m_yq,     m_ny);
     Kokkos::realloc(m_log_t,  m_nt);
-    Kokkos::realloc(m_table, ECNVARS, m_nn, m_ny, m_nt);
+    Kokkos::realloc(m_table, ECNVARS*m_nn*m_ny*m_nt);
 
     // Create host storage to read into
     HostArray1D<Real>::HostMirror host_log_nb = create_mirror_view(m_log_nb);
     HostArray1D<Real>::HostMirror host_yq =     create_mirror_view(m_yq);
     HostArray1D<Real>::HostMirror host_log_t =  create_mirror_view(m_log_t);
-    HostArray4D<Real>::HostMirror host_table =  create_mirror_view(m_table);
+    HostArray1D<Real>::HostMirror host_table =  create_mirror_view(m_table);
 
     { // read nb
       Real * table_nb = table["nb"];
@@ -60,6 +60,7 @@ void EOSCompOSE::ReadTableFromFile(std::string fname) {
         host_log_nb(in) = log(table_nb[in]);
       }
       m_id_log_nb = 1.0/(host_log_nb(1) - host_log_nb(0));
+      m_log_nb0 = host_log_nb(0);
       min_n = table_nb[0];
       max_n = table_nb[m_nn-1];
     }
@@ -70,6 +71,7 @@ void EOSCompOSE::ReadTableFromFile(std::string fname) {
         host_yq(iy) = table_yq[iy];
       }
       m_id_yq = 1.0/(host_yq(1) - host_yq(0));
+      m_yq0 = host_yq(0);
       min_Y[0] = table_yq[0];
       max_Y[0] = table_yq[m_ny-1];
     }
@@ -80,6 +82,7 @@ void EOSCompOSE::ReadTableFromFile(std::string fname) {
         host_log_t(it) = log(table_t[it]);
       }
       m_id_log_t = 1.0/(host_log_t(1) - host_log_t(0));
+      m_log_t0 = host_log_t(0);
       min_T = table_t[1];      // These are different
       max_T = table_t[m_nt-2]; // on purpose
     }
@@ -90,7 +93,7 @@ void EOSCompOSE::ReadTableFromFile(std::string fname) {
         for (size_t iy=0; iy<m_ny; ++iy) {
           for (size_t it=0; it<m_nt; ++it) {
             size_t iflat = it + m_nt*(iy + m_ny*in);
-            host_table(ECLOGP,in,iy,it) = log(table_Q1[iflat]) + host_log_nb(in);
+            host_table(index(ECLOGP,in,iy,it)) = log(table_Q1[iflat]) + host_log_nb(in);
           }
         }
       }
@@ -102,7 +105,7 @@ void EOSCompOSE::ReadTableFromFile(std::string fname) {
         for (size_t iy=0; iy<m_ny; ++iy) {
           for (size_t it=0; it<m_nt; ++it) {
             size_t iflat = it + m_nt*(iy + m_ny*in);
-            host_table(ECENT,in,iy,it) = table_Q2[iflat];
+            host_table(index(ECENT,in,iy,it)) = table_Q2[iflat];
           }
         }
       }
@@ -114,7 +117,7 @@ void EOSCompOSE::ReadTableFromFile(std::string fname) {
         for (size_t iy=0; iy<m_ny; ++iy) {
           for (size_t it=0; it<m_nt; ++it) {
             size_t iflat = it + m_nt*(iy + m_ny*in);
-            host_table(ECMUB,in,iy,it) = (table_Q3[iflat]+1)*mb;
+            host_table(index(ECMUB,in,iy,it)) = (table_Q3[iflat]+1)*mb;
           }
         }
       }
@@ -126,7 +129,7 @@ void EOSCompOSE::ReadTableFromFile(std::string fname) {
         for (size_t iy=0; iy<m_ny; ++iy) {
           for (size_t it=0; it<m_nt; ++it) {
             size_t iflat = it + m_nt*(iy + m_ny*in);
-            host_table(ECMUB,in,iy,it) = table_Q4[iflat]*mb;
+            host_table(index(ECMUB,in,iy,it)) = table_Q4[iflat]*mb;
           }
         }
       }
@@ -138,7 +141,7 @@ void EOSCompOSE::ReadTableFromFile(std::string fname) {
         for (size_t iy=0; iy<m_ny; ++iy) {
           for (size_t it=0; it<m_nt; ++it) {
             size_t iflat = it + m_nt*(iy + m_ny*in);
-            host_table(ECMUL,in,iy,it) = table_Q5[iflat]*mb;
+            host_table(index(ECMUL,in,iy,it)) = table_Q5[iflat]*mb;
           }
         }
       }
@@ -150,7 +153,7 @@ void EOSCompOSE::ReadTableFromFile(std::string fname) {
         for (size_t iy=0; iy<m_ny; ++iy) {
           for (size_t it=0; it<m_nt; ++it) {
             size_t iflat = it + m_nt*(iy + m_ny*in);
-            host_table(ECLOGE,in,iy,it) = log(mb*(table_Q7[iflat] + 1)) + host_log_nb(in);
+            host_table(index(ECLOGE,in,iy,it)) = log(mb*(table_Q7[iflat] + 1)) + host_log_nb(in);
           }
         }
       }
@@ -162,7 +165,7 @@ void EOSCompOSE::ReadTableFromFile(std::string fname) {
         for (size_t iy=0; iy<m_ny; ++iy) {
           for (size_t it=0; it<m_nt; ++it) {
             size_t iflat = it + m_nt*(iy + m_ny*in);
-            host_table(ECCS,in,iy,it) = sqrt(table_cs2[iflat]);
+            host_table(index(ECCS,in,iy,it)) = sqrt(table_cs2[iflat]);
           }
         }
       }
@@ -184,8 +187,8 @@ void EOSCompOSE::ReadTableFromFile(std::string fname) {
         for (int iy = 0; iy < m_ny; ++iy) {
           // This would use GPU memory, and we are currently on the CPU, so Enthalpy is
           // hardcoded
-          Real e = exp(host_table(ECLOGE,in,iy,it));
-          Real p = exp(host_table(ECLOGP,in,iy,it));
+          Real e = exp(host_table(index(ECLOGE,in,iy,it)));
+          Real p = exp(host_table(index(ECLOGP,in,iy,it)));
           Real h = (e + p) / nb;
           m_min_h = fmin(m_min_h, h);
         }
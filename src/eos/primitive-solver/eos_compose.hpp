@@ -44,7 +44,7 @@ class EOSCompOSE : public EOSPolicyInterface {
       m_log_nb("log nb",1),
       m_log_t("log T",1),
       m_yq("yq",1),
-      m_table("EoS table",1,1,1,1) {
+      m_table("EoS table",1) {
     n_species = 1;
     eos_units = MakeNuclear();
     m_initialized = false;
@@ -53,6 +53,9 @@ class EOSCompOSE : public EOSPolicyInterface {
     m_id_log_nb = std::numeric_limits<Real>::quiet_NaN();
     m_id_log_t = std::numeric_limits<Real>::quiet_NaN();
     m_id_yq = std::numeric_limits<Real>::quiet_NaN();
+    m_log_nb0 = std::numeric_limits<Real>::quiet_NaN();
+    m_log_t0 = std::numeric_limits<Real>::quiet_NaN();
+    m_yq0 = std::numeric_limits<Real>::quiet_NaN();
     m_nn = std::numeric_limits<int>::quiet_NaN();
     m_nt = std::numeric_limits<int>::quiet_NaN();
     m_ny = std::numeric_limits<int>::quiet_NaN();
@@ -191,11 +194,13 @@ class EOSCompOSE : public EOSPolicyInterface {
     return m_log_t;
   }
   /// Get the raw table data
-  KOKKOS_INLINE_FUNCTION DvceArray4D<Real> const GetRawTable() const {
+  KOKKOS_INLINE_FUNCTION DvceArray1D<Real> const GetRawTable() const {
     return m_table;
   }
 
-  // Indexing used to access the data
+  // Indexing used to access the data.  The table is stored flattened in SoA order:
+  // one contiguous block per variable, with the temperature index varying fastest so
+  // that the trilinear interpolation stencil reads adjacent memory on any backend.
   KOKKOS_INLINE_FUNCTION ptrdiff_t index(int iv, int in, int iy, int it) const {
     return it + m_nt*(iy + m_ny*(in + m_nn*iv));
   }
@@ -239,28 +244,34 @@ class EOSCompOSE : public EOSPolicyInterface {
     weight_idx_lt(&wt0, &wt1, &it, log_t);
 
     return
-      wn0 * (wy0 * (wt0 * m_table(iv, in+0, iy+0, it+0)   +
-                    wt1 * m_table(iv, in+0, iy+0, it+1))  +
-             wy1 * (wt0 * m_table(iv, in+0, iy+1, it+0)   +
-                    wt1 * m_table(iv, in+0, iy+1, it+1))) +
-      wn1 * (wy0 * (wt0 * m_table(iv, in+1, iy+0, it+0)   +
-                    wt1 * m_table(iv, in+1, iy+0, it+1))  +
-             wy1 * (wt0 * m_table(iv, in+1, iy+1, it+0)   +
-                    wt1 * m_table(iv, in+1, iy+1, it+1)));
+      wn0 * (wy0 * (wt0 * m_table(index(iv, in+0, iy+0, it+0))   +
+                    wt1 * m_table(index(iv, in+0, iy+0, it+1)))  +
+             wy1 * (wt0 * m_table(index(iv, in+0, iy+1, it+0))   +
+                    wt1 * m_table(index(iv, in+0, iy+1, it+1)))) +
+      wn1 * (wy0 * (wt0 * m_table(index(iv, in+1, iy+0, it+0))   +
+                    wt1 * m_table(index(iv, in+1, iy+0, it+1)))  +
+             wy1 * (wt0 * m_table(index(iv, in+1, iy+1, it+0))   +
+                    wt1 * m_table(index(iv, in+1, iy+1, it+1))));
   }
 
+  // The interpolation weights below use the table origin and inverse spacing saved at
+  // load time, so that index math involves no global-memory loads.  This relies on the
+  // uniform spacing in log nb, log T, and yq assumed throughout this class.
+
   /// Evaluate interpolation weight for density
   KOKKOS_INLINE_FUNCTION void weight_idx_ln(Real *w0, Real *w1, int *in, Real log_n)
       const {
-    *in = (log_n - m_log_nb(0))*m_id_log_nb;
-    *w1 = (log_n - m_log_nb(*in))*m_id_log_nb;
+    Real x = (log_n - m_log_nb0)*m_id_log_nb;
+    *in = static_cast<int>(x);
+    *w1 = x - static_cast<Real>(*in);
     *w0 = 1.0 - (*w1);
     return;
   }
   /// Evaluate interpolation weight for composition
   KOKKOS_INLINE_FUNCTION void weight_idx_yq(Real *w0, Real *w1, int *iy, Real yq) const {
-    *iy = (yq - m_yq(0))*m_id_yq;
-    *w1 = (yq - m_yq(*iy))*m_id_yq;
+    Real x = (yq - m_yq0)*m_id_yq;
+    *iy = static_cast<int>(x);
+    *w1 = x - static_cast<Real>(*iy);
     *w0 = 1.0 - (*w1);
     return;
   }
@@ -268,8 +279,9 @@ class EOSCompOSE : public EOSPolicyInterface {
   /// Evaluate interpolation weight for temperature
   KOKKOS_INLINE_FUNCTION void weight_idx_lt(Real *w0, Real *w1, int *it, Real log_t)
       const {
-    *it = (log_t - m_log_t(0))*m_id_log_t;
-    *w1 = (log_t - m_log_t(*it))*m_id_log_t;
+    Real x = (log_t - m_log_t0)*m_id_log_t;
+    *it = static_cast<int>(x);
+    *w1 = x - static_cast<Real>(*it);
     *w0 = 1.0 - (*w1);
     return;
   }
@@ -285,10 +297,10 @@ class EOSCompOSE : public EOSPolicyInterface {
 
     auto f = [=](int it){
       Real var_pt =
-        wn0 * (wy0 * m_table(iv, in+0, iy+0, it)  +
-               wy1 * m_table(iv, in+0, iy+1, it)) +
-        wn1 * (wy0 * m_table(iv, in+1, iy+0, it)  +
-               wy1 * m_table(iv, in+1, iy+1, it));
+        wn0 * (wy0 * m_table(index(iv, in+0, iy+0, it))  +
+               wy1 * m_table(index(iv, in+0, iy+1, it))) +
+        wn1 * (wy0 * m_table(index(iv, in+1, iy+0, it))  +
+               wy1 * m_table(index(iv, in+1, iy+1, it)));
 
       return var - var_pt;
     };
@@ -352,6 +364,8 @@ class EOSCompOSE : public EOSPolicyInterface {
  private:
   // Inverse of table spacing
   Real m_id_log_nb, m_id_yq, m_id_log_t;
+  // Table origin (first grid point on each axis), saved at load for index math
+  Real m_log_nb0, m_yq0, m_log_t0;
   // Table size
   int m_nn, m_nt, m_ny;
   // Minimum enthalpy per baryon
@@ -361,11 +375,12 @@ class EOSCompOSE : public EOSPolicyInterface {
   // of table
   bool m_initialized;
 
-  // Table storage on DEVICE.
+  // Table storage on DEVICE.  The table itself is flattened in SoA order (see index()
+  // above) so that the interpolation stencil is contiguous regardless of backend.
   DvceArray1D<Real> m_log_nb;
   DvceArray1D<Real> m_yq;
   DvceArray1D<Real> m_log_t;
-  DvceArray4D<Real> m_table;
+  DvceArray1D<Real> m_table;
 };
 
 }; // namespace Primitive
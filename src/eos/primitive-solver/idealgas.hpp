@@ -23,11 +23,13 @@ class IdealGas : public EOSPolicyInterface {
   /// Adiabatic index
   Real gamma;
   Real gammam1;
+  Real igammam1;  // 1/(gamma - 1), cached so hot calls multiply instead of divide
 
   /// Constructor
   IdealGas() {
     gamma = 5.0/3.0;
     gammam1 = gamma - 1.0;
+    igammam1 = 1.0/gammam1;
     mb = 1.0;
 
     min_n = 0.0;
@@ -60,7 +62,7 @@ class IdealGas : public EOSPolicyInterface {
 
   /// Calculate the energy density using the ideal gas law.
   KOKKOS_INLINE_FUNCTION Real Energy(Real n, Real T, const Real *Y) const {
-    return n*(mb + T/gammam1);
+    return n*(mb + T*igammam1);
   }
 
   /// Calculate the pressure using the ideal gas law.
@@ -76,7 +78,7 @@ class IdealGas : public EOSPolicyInterface {
 
   /// Calculate the enthalpy per baryon using the ideal gas law.
   KOKKOS_INLINE_FUNCTION Real Enthalpy(Real n, Real T, Real *Y) const {
-    return mb + gamma/gammam1*T;
+    return mb + gamma*igammam1*T;
   }
 
   /// Get the minimum enthalpy per baryon according to the ideal gas law.
@@ -124,6 +126,7 @@ class IdealGas : public EOSPolicyInterface {
   KOKKOS_INLINE_FUNCTION void SetGamma(Real g) {
     gamma = (g <= 1.0) ? 1.00001 : ((g >= 2.0) ? 2.00001 : g);
     gammam1 = gamma - 1.0;
+    igammam1 = 1.0/gammam1;
   }
 
   /// Get the adiabatic index.
@@ -42,13 +42,36 @@ class Root {
   KOKKOS_INLINE_FUNCTION
   bool FalsePosition(Functor&& f, Real &lb, Real &ub, Real& x, Real tol,
                      Types ... args) const {
-    int side = 0;
-    Real ftest;
-    unsigned int count = 0;
-    //last_count = 0;
+    unsigned int count;
+    return FalsePositionCounted(f, lb, ub, x, tol, count, args...);
+  }
+
+  //! \brief Variant of FalsePosition() that also reports the number of iterations
+  //! actually used, so callers can histogram solver convergence.
+
+  template<class Functor, class ... Types>
+  KOKKOS_INLINE_FUNCTION
+  bool FalsePositionCounted(Functor&& f, Real &lb, Real &ub, Real& x, Real tol,
+                            unsigned int &count, Types ... args) const {
     // Get our initial bracket.
     Real flb = f(lb, args...);
     Real fub = f(ub, args...);
+    return FalsePositionWarm(f, lb, ub, flb, fub, x, tol, count, args...);
+  }
+
+  //! \brief Variant of FalsePositionCounted() that takes the function values at the
+  //! bounds as arguments instead of evaluating them.  Callers that already know one or
+  //! both endpoint values (e.g. from collapsing the bracket around a hot-start guess)
+  //! can pass them in, so the solve starts without re-evaluating f at either endpoint
+  //! and every subsequent iteration costs exactly one function evaluation.
+
+  template<class Functor, class ... Types>
+  KOKKOS_INLINE_FUNCTION
+  bool FalsePositionWarm(Functor&& f, Real &lb, Real &ub, Real flb, Real fub,
+                         Real& x, Real tol, unsigned int &count, Types ... args) const {
+    int side = 0;
+    Real ftest;
+    count = 0;
     Real xold;
     x = lb;
     // If one of the bounds is already within tolerance of the root, we have the root.
@@ -220,11 +220,17 @@ class PrimitiveSolver {
   //  \param[in,out] bu    The magnetic field
   //  \param[in]     g3d   The 3x3 spatial metric
   //  \param[in]     g3u   The 3x3 inverse spatial metric
+  //  \param[in]     mu_guess  Optional guess for the root mu = 1/(hW), e.g. computed
+  //                 from the primitives of the previous stage.  A valid guess collapses
+  //                 one side of the initial bracket with a single function evaluation,
+  //                 so the root solve starts nearly converged ("hot start").  Negative
+  //                 values (the default) disable the hot start.
   //
   //  \return information about the solve
   KOKKOS_INLINE_FUNCTION
   SolverResult ConToPrim(Real prim[NPRIM], Real cons[NCONS], Real b[NMAG],
-                         Real g3d[NSPMETRIC], Real g3u[NSPMETRIC]) const;
+                         Real g3d[NSPMETRIC], Real g3u[NSPMETRIC],
+                         Real mu_guess = -1.0) const;
 
   //! \brief Get the conserved variables from the primitive variables.
   //
@@ -364,7 +370,8 @@ Error PrimitiveSolver<EOSPolicy, ErrorPolicy>::CheckDensityValid(Real& mul, Real
 template<typename EOSPolicy, typename ErrorPolicy>
 KOKKOS_INLINE_FUNCTION
 SolverResult PrimitiveSolver<EOSPolicy, ErrorPolicy>::ConToPrim(Real prim[NPRIM],
-      Real cons[NCONS], Real b[NMAG], Real g3d[NSPMETRIC], Real g3u[NSPMETRIC]) const {
+      Real cons[NCONS], Real b[NMAG], Real g3d[NSPMETRIC], Real g3u[NSPMETRIC],
+      Real mu_guess) const {
   SolverResult solver_result{Error::SUCCESS, 0, false, false, false};
 
   // Extract the undensitized conserved variables.
@@ -512,13 +519,41 @@ SolverResult PrimitiveSolver<EOSPolicy, ErrorPolicy>::ConToPrim(Real prim[NPRIM]
   }
 
 
-  // Do the root solve.
+  // Hot start: if the caller provided a valid guess for mu inside the bracket, spend
+  // one function evaluation there to collapse the side of the bracket the root is not
+  // in.  With a guess from the previous stage the surviving interval is tiny, and the
+  // false position iteration below converges in a couple of steps.
   Real n, P, T, mu;
-  bool result = root.FalsePosition(RootFunction, mul, muh, mu, tol,
-                                   D, q, bsqr, rsqr, rbsqr, Y, &eos, &n, &T, &P);
-  // WARNING: the reported number of iterations is not thread-safe and should only be
-  // trusted on single-thread benchmarks.
-  solver_result.iterations = root.iterations;
+  Real flb = 0.0, fub = 0.0;
+  bool flb_known = false, fub_known = false;
+  if (mu_guess > mul && mu_guess < muh) {
+    Real fg = RootFunction(mu_guess, D, q, bsqr, rsqr, rbsqr, Y, &eos, &n, &T, &P);
+    if (fg < 0.0) {
+      mul = mu_guess;
+      flb = fg;
+      flb_known = true;
+    } else {
+      muh = mu_guess;
+      fub = fg;
+      fub_known = true;
+    }
+  }
+
+  // Evaluate whichever endpoint the hot start did not, then do the root solve reusing
+  // both values.  Each RootFunction call walks the full EOS call tree (table lookups
+  // for T, P, and h), so nothing is ever evaluated twice: the secant-style iteration
+  // inside FalsePositionWarm also costs one evaluation per step.
+  if (!flb_known) {
+    flb = RootFunction(mul, D, q, bsqr, rsqr, rbsqr, Y, &eos, &n, &T, &P);
+  }
+  if (!fub_known) {
+    fub = RootFunction(muh, D, q, bsqr, rsqr, rbsqr, Y, &eos, &n, &T, &P);
+  }
+  unsigned int iters_used;
+  bool result = root.FalsePositionWarm(RootFunction, mul, muh, flb, fub, mu, tol,
+                                   iters_used, D, q, bsqr, rsqr, rbsqr, Y, &eos,
+                                   &n, &T, &P);
+  solver_result.iterations = static_cast<int>(iters_used);
   if (!result) {
     HandleFailure(prim, cons, b, g3d);
     solver_result.error = Error::NO_SOLUTION;
@@ -34,6 +34,7 @@
 #include "mesh/mesh.hpp"
 #include "parameter_input.hpp"
 #include "coordinates/adm.hpp"
+#include "z4c/tmunu.hpp"
 #include "mhd/mhd.hpp"
 #include "coordinates/coordinates.hpp"
 #include "coordinates/cell_locations.hpp"
@@ -91,6 +92,8 @@ class PrimitiveSolverHydro {
   MeshBlockPack* pmy_pack;
   unsigned int nerrs;
   unsigned int errcap;
+  // device-side histogram of solver iteration counts, harvested into EventCounters
+  DvceArray1D<int> c2p_iter_hist;
 
   PrimitiveSolverHydro(std::string block, MeshBlockPack *pp, ParameterInput *pin) :
 //        pmy_pack(pp), ps{&eos} {
@@ -273,7 +276,8 @@ class PrimitiveSolverHydro {
   void ConsToPrim(DvceArray5D<Real> &cons, const DvceFaceFld4D<Real> &bfc,
                   DvceArray5D<Real> &bcc0, DvceArray5D<Real> &prim,
                   const int il, const int iu, const int jl, const int ju,
-                  const int kl, const int ku, bool floors_only=false) {
+                  const int kl, const int ku, bool floors_only=false,
+                  bool set_tmunu=false) {
     auto &indcs = pmy_pack->pmesh->mb_indcs;
     int &is = indcs.is, &js = indcs.js, &ks = indcs.ks;
     int &ie = indcs.ie, &je = indcs.ie, &ke = indcs.ke;
@@ -288,6 +292,8 @@ class PrimitiveSolverHydro {
     auto &excise = pmy_pack->pcoord->coord_data.bh_excise;
     auto &excision_floor_ = pmy_pack->pcoord->excision_floor;
     auto &excision_flux_ = pmy_pack->pcoord->excision_flux;
+    auto &mb_excised_ = pmy_pack->pcoord->mb_excised;
+    auto &mb_all_excised_ = pmy_pack->pcoord->mb_all_excised;
     auto &dexcise_ = pmy_pack->pcoord->coord_data.dexcise;
     auto &pexcise_ = pmy_pack->pcoord->coord_data.pexcise;
 
@@ -295,6 +301,12 @@ class PrimitiveSolverHydro {
     auto &eos_ = ps.GetEOS();
     auto &ps_  = ps;
 
+    // with set_tmunu the fluid stress-energy tensor is assembled in the same sweep
+    // (replacing the standalone DynGRMHD::SetTmunu() kernel)
+    const bool set_tmunu_ = set_tmunu && (pmy_pack->ptmunu != nullptr);
+    Tmunu::Tmunu_vars tmunu;
+    if (set_tmunu_) {tmunu = pmy_pack->ptmunu->tmunu;}
+
     const int ni = (iu - il + 1);
     const int nji = (ju - jl + 1)*ni;
     const int nkji = (ku - kl + 1)*nji;
@@ -306,6 +318,14 @@ class PrimitiveSolverHydro {
 
     Real mb = eos_.GetBaryonMass();
 
+    // (re-)allocate and zero device-side histogram of solver iteration counts
+    const int nhist = EventCounters::nhist_c2p;
+    if (!floors_only) {
+      if (c2p_iter_hist.extent_int(0) < nhist) { Kokkos::realloc(c2p_iter_hist, nhist); }
+      Kokkos::deep_copy(c2p_iter_hist, 0);
+    }
+    auto &hist_ = c2p_iter_hist;
+
     // FIXME: This only works for a flooring policy that has these functions!
     bool prim_failure, cons_failure;
     if (floors_only) {
@@ -328,11 +348,11 @@ class PrimitiveSolverHydro {
       k += kl;
 
       // Add in a short circuit where FOFC is guaranteed.
-      if (floors_only && fofc_(m, k, j, i)) {
+      if (floors_only && fofc_.Test(m, k, j, i)) {
         return;
       }
-      if (floors_only && excise) {
-        if (excision_flux_(m,k,j,i)) {
+      if (floors_only && excise && mb_excised_(m)) {
+        if (mb_all_excised_(m) || excision_flux_(m,k,j,i)) {
           return;
         }
       }
@@ -379,10 +399,37 @@ class PrimitiveSolverHydro {
         b3u[IBZ] = bcc0(m, IBZ, k, j, i)*isdetg;
       }
 
+      // Hot-start guess for the root solve computed from the primitives of the previous
+      // stage still stored in prim (guaranteed available after CopyCons): the root is
+      // mu = 1/(hW), and h and W change little over one stage.  A negative guess (e.g.
+      // before prim is first initialized) disables the hot start in ConToPrim.
+      Real mu_guess = -1.0;
+      {
+        Real n_old = prim(m, IDN, k, j, i)/mb;
+        if (isfinite(n_old) && n_old > 0.0) {
+          Real Y_old[MAX_SPECIES] = {0.0};
+          for (int n = 0; n < nscal; n++) {
+            Y_old[n] = prim(m, nhyd + n, k, j, i);
+          }
+          Real Wv_old[3] = {prim(m, IVX, k, j, i), prim(m, IVY, k, j, i),
+                            prim(m, IVZ, k, j, i)};
+          Real W_old = sqrt(1.0 + Primitive::SquareVector(Wv_old, g3d));
+          Real T_old = eos_.GetTemperatureFromP(n_old, prim(m, IPR, k, j, i), Y_old);
+          Real h_old = eos_.GetEnthalpy(n_old, T_old, Y_old);
+          mu_guess = 1.0/(h_old*W_old);
+          if (!isfinite(mu_guess)) {
+            mu_guess = -1.0;
+          }
+        }
+      }
+
       // If we're in an excised region, set the primitives to some default value.
+      // MBs with no masked cells skip the mask read entirely.
       Primitive::SolverResult result;
-      if (excise) {
-        if (excision_floor_(m,k,j,i)) {
+      bool solved = false;
+      // fully-excised MBs take the excised branch without per-cell mask reads
+      if (excise && mb_excised_(m)) {
+        if (mb_all_excised_(m) || excision_floor_(m,k,j,i)) {
           prim_pt[PRH] = dexcise_/mb;
           prim_pt[PVX] = 0.0;
           prim_pt[PVY] = 0.0;
@@ -402,14 +449,22 @@ class PrimitiveSolverHydro {
           result.cons_adjusted = true;
           ps_.PrimToCon(prim_pt, cons_pt, b3u, g3d);
         } else {
-          result = ps_.ConToPrim(prim_pt, cons_pt, b3u, g3d, g3u);
+          result = ps_.ConToPrim(prim_pt, cons_pt, b3u, g3d, g3u, mu_guess);
+          solved = true;
         }
       } else {
-        result = ps_.ConToPrim(prim_pt, cons_pt, b3u, g3d, g3u);
+        result = ps_.ConToPrim(prim_pt, cons_pt, b3u, g3d, g3u, mu_guess);
+        solved = true;
+      }
+
+      // bin solver iteration count into the convergence histogram
+      if (!floors_only && solved) {
+        int it = result.iterations;
+        Kokkos::atomic_add(&hist_((it < nhist)? it : nhist-1), 1);
       }
 
       if (result.error != Primitive::Error::SUCCESS && floors_only) {
-        fofc_(m,k,j,i) = true;
+        fofc_.Set(m,k,j,i);
       } else if (!floors_only) {
         if (result.error != Primitive::Error::SUCCESS && (nerrs_ + sumerrs < errcap_)) {
           // TODO(JF): put in a proper error response here.
@@ -500,6 +555,45 @@ class PrimitiveSolverHydro {
             cons(m, nhyd + n, k, j, i) = cons_pt[CYD + n]*sdetg;
           }
         }
+
+        // Assemble the fluid contribution to the stress-energy tensor from the
+        // registers already holding the metric, field, conserved, and primitive state
+        // of this cell; the undensitized conserved variables are exactly the E and S_i
+        // of Tmunu (see DynGRMHD::SetTmunu() for the standalone form).
+        if (set_tmunu_) {
+          const int imap[3][3] = {{S11, S12, S13}, {S12, S22, S23}, {S13, S23, S33}};
+          Real v_u[3] = {prim_pt[PVX], prim_pt[PVY], prim_pt[PVZ]};
+          Real v_d[3] = {0.0};
+          Real B_d[3] = {0.0};
+          Real vsq = 0.0;
+          for (int a = 0; a < 3; ++a) {
+            for (int b = 0; b < 3; ++b) {
+              v_d[a] += v_u[b]*g3d[imap[a][b]];
+              vsq += v_u[a]*v_u[b]*g3d[imap[a][b]];
+              B_d[a] += b3u[b]*g3d[imap[a][b]];
+            }
+          }
+          Real iW = 1.0/sqrt(1.0 + vsq);
+          Real Bv = 0.0;
+          Real Bsq = 0.0;
+          for (int a = 0; a < 3; ++a) {
+            Bv += b3u[a]*v_d[a];
+            Bsq += b3u[a]*B_d[a];
+          }
+          Real bsq = (Bsq + Bv*Bv)*(iW*iW);
+          Real ptot = prim_pt[PPR] + 0.5*bsq;
+
+          tmunu.E(m, k, j, i) = cons_pt[CTA] + cons_pt[CDN];
+          for (int a = 0; a < 3; ++a) {
+            tmunu.S_d(m, a, k, j, i) = cons_pt[CSX + a];
+            for (int b = a; b < 3; ++b) {
+              tmunu.S_dd(m, a, b, k, j, i) =
+                    cons_pt[CSX + a]*v_d[b]*iW
+                    - (B_d[a] + Bv*v_d[a])*SQR(iW)*B_d[b]
+                    + ptot*g3d[imap[a][b]];
+            }
+          }
+        }
       }
     }, Kokkos::Sum<int>(count_errs));
 
@@ -508,6 +602,12 @@ class PrimitiveSolverHydro {
       ps.GetEOSMutable().SetConservedFloorFailure(cons_failure);
     } else {
       nerrs += count_errs;
+      // harvest device-side iteration histogram into event counters
+      HostArray1D<int> hist_h("c2p_hist_h", nhist);
+      Kokkos::deep_copy(hist_h, c2p_iter_hist);
+      for (int n=0; n<nhist; ++n) {
+        pmy_pack->pmesh->ecounter.nc2p_iter[n] += hist_h(n);
+      }
     }
   }
 
@@ -8,7 +8,10 @@
 
 // C/C++ headers
 #include <float.h>
+#include <array>
 #include <iostream>
+#include <map>
+#include <vector>
 
 // AthenaK headers
 #include "athena.hpp"
@@ -30,6 +33,9 @@ GeodesicGrid::GeodesicGrid(int nlev, bool rotate, bool fluxes) :
     ind_neighbors_edges("ind_neighbors_edges",1,1),
     solid_angles("solid_angles",1),
     arc_lengths("arc_lengths",1,1),
+    nghbr_ptr("nghbr_ptr",1),
+    nghbr_ind("nghbr_ind",1),
+    nghbr_wght("nghbr_wght",1),
     cart_pos("cart_pos",1,1),
     cart_pos_mid("cart_pos_mid",1,1,1),
     polar_pos("polar_pos",1,1),
@@ -314,6 +320,23 @@ GeodesicGrid::GeodesicGrid(int nlev, bool rotate, bool fluxes) :
       }
     }
 
+    // compile angular connectivity into CSR-format arrays, with the solid-angle
+    // normalization prefused into the edge weights (used by radiation angular fluxes)
+    Kokkos::realloc(nghbr_ptr,nangles+1);
+    nghbr_ptr.h_view(0) = 0;
+    for (int n=0; n<nangles; ++n) {
+      nghbr_ptr.h_view(n+1) = nghbr_ptr.h_view(n) + numn.h_view(n);
+    }
+    Kokkos::realloc(nghbr_ind,nghbr_ptr.h_view(nangles));
+    Kokkos::realloc(nghbr_wght,nghbr_ptr.h_view(nangles));
+    for (int n=0; n<nangles; ++n) {
+      for (int nb=0; nb<numn.h_view(n); ++nb) {
+        nghbr_ind.h_view(nghbr_ptr.h_view(n) + nb) = indn.h_view(n,nb);
+        nghbr_wght.h_view(nghbr_ptr.h_view(n) + nb) =
+            arcl.h_view(n,nb)/solid_angles.h_view(n);
+      }
+    }
+
     // sync dual arrays
     num_neighbors.template modify<HostMemSpace>();
     num_neighbors.template sync<DevExeSpace>();
@@ -325,6 +348,12 @@ GeodesicGrid::GeodesicGrid(int nlev, bool rotate, bool fluxes) :
     arc_lengths.template sync<DevExeSpace>();
     solid_angles.template modify<HostMemSpace>();
     solid_angles.template sync<DevExeSpace>();
+    nghbr_ptr.template modify<HostMemSpace>();
+    nghbr_ptr.template sync<DevExeSpace>();
+    nghbr_ind.template modify<HostMemSpace>();
+    nghbr_ind.template sync<DevExeSpace>();
+    nghbr_wght.template modify<HostMemSpace>();
+    nghbr_wght.template sync<DevExeSpace>();
     cart_pos.template modify<HostMemSpace>();
     cart_pos.template sync<DevExeSpace>();
     cart_pos_mid.template modify<HostMemSpace>();
@@ -547,25 +576,44 @@ Real GeodesicGrid::ArcLength(int n1, int n2) {
 //! \brief find an optimal angle by which to rotate the geodesic mesh
 
 void GeodesicGrid::OptimalAngles(Real ang[2]) {
+  // The unrotated mesh at a given nlevel is deterministic, so the optimal angles found
+  // by the brute-force search below depend only on nlevel.  Memoize them per process so
+  // that runs with many grids at the same angular order (e.g. multiple extraction
+  // spheres, or grids rebuilt at restart) pay for the search at most once per nlevel.
+  static std::map<int, std::array<Real,2>> opt_angles;
+  auto it = opt_angles.find(nlevel);
+  if (it != opt_angles.end()) {
+    ang[0] = it->second[0];
+    ang[1] = it->second[1];
+    return;
+  }
   int nzeta = 200;  // nzeta val inherited from Viktoriya Giryanskaya
   int npsi  = 200;  // npsi  val inherited from Viktoriya Giryanskaya
   Real maxangle = ArcLength(0,1);
   Real deltazeta = maxangle/nzeta;
   Real deltapsi = M_PI/npsi;
   Real vmax = 0.0;
+  // cache grid positions; the search sweeps all of them nzeta*npsi times
+  std::vector<Real> vpos(3*nangles);
+  for (int n=0; n<nangles; ++n) {
+    GridCartPosition(n,vpos[3*n],vpos[3*n+1],vpos[3*n+2]);
+  }
   for (int l=0; l<nzeta; ++l) {
     Real zeta = (l+1)*deltazeta;
+    Real cosz = cos(zeta);
+    Real sinz = sin(zeta);
     for (int k=0; k<npsi; ++k) {
       Real psi = (k+1)*deltapsi;
       Real kx = -sin(psi);
       Real ky =  cos(psi);
       Real vmin_curr = 1.0;
       for (int n=0; n<nangles; ++n) {
-        Real vx, vy, vz;
-        GridCartPosition(n,vx,vy,vz);
-        Real vrx = vx*cos(zeta)+ky*vz*sin(zeta)+kx*(kx*vx+ky*vy)*(1.0-cos(zeta));
-        Real vry = vy*cos(zeta)-kx*vz*sin(zeta)+ky*(kx*vx+ky*vy)*(1.0-cos(zeta));
-        Real vrz = vz*cos(zeta)+(kx*vy-ky*vx)*sin(zeta);
+        Real vx = vpos[3*n];
+        Real vy = vpos[3*n+1];
+        Real vz = vpos[3*n+2];
+        Real vrx = vx*cosz+ky*vz*sinz+kx*(kx*vx+ky*vy)*(1.0-cosz);
+        Real vry = vy*cosz-kx*vz*sinz+ky*(kx*vx+ky*vy)*(1.0-cosz);
+        Real vrz = vz*cosz+(kx*vy-ky*vx)*sinz;
         if (fabs(vrx) < vmin_curr) {vmin_curr = fabs(vrx);}
         if (fabs(vry) < vmin_curr) {vmin_curr = fabs(vry);}
         if (fabs(vrz) < vmin_curr) {vmin_curr = fabs(vrz);}
@@ -577,6 +625,7 @@ void GeodesicGrid::OptimalAngles(Real ang[2]) {
       }
     }
   }
+  opt_angles[nlevel] = {ang[0], ang[1]};
   return;
 }
 
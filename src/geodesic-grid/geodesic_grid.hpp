@@ -24,6 +24,12 @@ class GeodesicGrid {
   DualArray2D<int>  ind_neighbors_edges;  // indices of neighbor edge
   DualArray1D<Real> solid_angles;         // solid angles
   DualArray2D<Real> arc_lengths;          // arc lengths
+  // angular connectivity in CSR format: entries [nghbr_ptr(n),nghbr_ptr(n+1)) hold the
+  // (5 or 6) neighbors of angle n, with the (arc length)/(solid angle) edge weights
+  // prefused, used by the angular flux divergence in radiation
+  DualArray1D<int>  nghbr_ptr;            // CSR offsets into packed neighbor arrays
+  DualArray1D<int>  nghbr_ind;            // packed indices of neighbors
+  DualArray1D<Real> nghbr_wght;           // packed edge weights
   DualArray2D<Real> cart_pos;             // coord position (cartesian) at face center
   DualArray3D<Real> cart_pos_mid;         // coord position (cartesian) at face edges
   DualArray2D<Real> polar_pos;            // polar coordinates at face center
@@ -18,6 +18,7 @@
 #include "hydro/hydro.hpp"
 #include "mhd/mhd.hpp"
 #include "coordinates/coordinates.hpp"
+#include "utils/lagrange_interpolator.hpp"
 #include "spherical_grid.hpp"
 
 //----------------------------------------------------------------------------------------
@@ -30,7 +31,8 @@ SphericalGrid::SphericalGrid(MeshBlockPack *ppack, int nlev, Real rad):
     interp_coord("interp_coord",1,1),
     interp_indcs("interp_indcs",1,1),
     interp_wghts("interp_wghts",1,1,1),
-    interp_vals("interp_vals",1,1) {
+    interp_vals("interp_vals",1,1),
+    stencil_gen_(0) {
   // reallocate and set interpolation coordinates, indices, and weights
   int &ng = pmy_pack->pmesh->mb_indcs.ng;
   Kokkos::realloc(interp_coord,nangles,3);
@@ -39,8 +41,10 @@ SphericalGrid::SphericalGrid(MeshBlockPack *ppack, int nlev, Real rad):
 
   // Call functions to prepare SphericalGrid object for interpolation
   SetInterpolationCoordinates();
-  SetInterpolationIndices();
-  SetInterpolationWeights();
+  SetInterpolationIndicesAndWeights();
+  if (pmy_pack->pmesh->adaptive) {
+    stencil_gen_ = pmy_pack->pmesh->pmr->nmb_created + pmy_pack->pmesh->pmr->nmb_deleted;
+  }
 
   return;
 }
@@ -88,124 +92,32 @@ void SphericalGrid::SetInterpolationCoordinates() {
 }
 
 //----------------------------------------------------------------------------------------
-//! \fn void SphericalGrid::SetInterpolationIndices
+//! \fn void SphericalGrid::SetInterpolationIndicesAndWeights
 //! \brief determine which MeshBlocks and MeshBlock zones therein will be used in
-//         interpolation onto the sphere
-
-void SphericalGrid::SetInterpolationIndices() {
-  auto &size = pmy_pack->pmb->mb_size;
-  int nmb1 = pmy_pack->nmb_thispack - 1;
-  int nang1 = nangles - 1;
-
-  auto &rcoord = interp_coord;
-  auto &iindcs = interp_indcs;
-  for (int n=0; n<=nang1; ++n) {
-    // indices default to -1 if angle does not reside in this MeshBlockPack
-    iindcs.h_view(n,0) = -1;
-    iindcs.h_view(n,1) = -1;
-    iindcs.h_view(n,2) = -1;
-    iindcs.h_view(n,3) = -1;
-    for (int m=0; m<=nmb1; ++m) {
-      // extract MeshBlock bounds
-      Real &x1min = size.h_view(m).x1min;
-      Real &x1max = size.h_view(m).x1max;
-      Real &x2min = size.h_view(m).x2min;
-      Real &x2max = size.h_view(m).x2max;
-      Real &x3min = size.h_view(m).x3min;
-      Real &x3max = size.h_view(m).x3max;
-
-      // extract MeshBlock grid cell spacings
-      Real &dx1 = size.h_view(m).dx1;
-      Real &dx2 = size.h_view(m).dx2;
-      Real &dx3 = size.h_view(m).dx3;
-
-      // save MeshBlock and zone indicies for nearest position to spherical patch center
-      // if this angle position resides in this MeshBlock
-      if ((rcoord.h_view(n,0) >= x1min && rcoord.h_view(n,0) <= x1max) &&
-          (rcoord.h_view(n,1) >= x2min && rcoord.h_view(n,1) <= x2max) &&
-          (rcoord.h_view(n,2) >= x3min && rcoord.h_view(n,2) <= x3max)) {
-        iindcs.h_view(n,0) = m;
-        iindcs.h_view(n,1) = static_cast<int>(std::floor((rcoord.h_view(n,0)-
-                                                          (x1min+dx1/2.0))/dx1));
-        iindcs.h_view(n,2) = static_cast<int>(std::floor((rcoord.h_view(n,1)-
-                                                          (x2min+dx2/2.0))/dx2));
-        iindcs.h_view(n,3) = static_cast<int>(std::floor((rcoord.h_view(n,2)-
-                                                          (x3min+dx3/2.0))/dx3));
-      }
-    }
-  }
-
-  // sync dual arrays
-  interp_indcs.template modify<HostMemSpace>();
-  interp_indcs.template sync<DevExeSpace>();
+//         interpolation onto the sphere, and the Lagrange weights.  Built for all
+//         angles in a single device kernel; called at construction and again whenever
+//         AMR changes the MeshBlock layout (see InterpolateToSphere)
 
+void SphericalGrid::SetInterpolationIndicesAndWeights() {
+  lagrange_interp::BuildStencil(pmy_pack, interp_coord, nangles,
+                                interp_indcs, interp_wghts);
   return;
 }
 
 //----------------------------------------------------------------------------------------
-//! \fn void SphericalGrid::SetInterpolationWeights
-//! \brief set weights used by Lagrangian interpolation
-
-void SphericalGrid::SetInterpolationWeights() {
-  auto &indcs = pmy_pack->pmesh->mb_indcs;
-  auto &size = pmy_pack->pmb->mb_size;
-  int &ng = indcs.ng;
-
-  auto &iindcs = interp_indcs;
-  auto &iwghts = interp_wghts;
-  for (int n=0; n<nangles; ++n) {
-    // extract indices
-    int &ii0 = iindcs.h_view(n,0);
-    int &ii1 = iindcs.h_view(n,1);
-    int &ii2 = iindcs.h_view(n,2);
-    int &ii3 = iindcs.h_view(n,3);
-
-    if (ii0==-1) {  // angle not on this rank
-      for (int i=0; i<2*ng; ++i) {
-        iwghts.h_view(n,i,0) = 0.0;
-        iwghts.h_view(n,i,1) = 0.0;
-        iwghts.h_view(n,i,2) = 0.0;
-      }
-    } else {
-      // extract spherical grid positions
-      Real &x0 = interp_coord.h_view(n,0);
-      Real &y0 = interp_coord.h_view(n,1);
-      Real &z0 = interp_coord.h_view(n,2);
-
-      // extract MeshBlock bounds
-      Real &x1min = size.h_view(ii0).x1min;
-      Real &x1max = size.h_view(ii0).x1max;
-      Real &x2min = size.h_view(ii0).x2min;
-      Real &x2max = size.h_view(ii0).x2max;
-      Real &x3min = size.h_view(ii0).x3min;
-      Real &x3max = size.h_view(ii0).x3max;
-
-      // set interpolation weights
-      for (int i=0; i<2*ng; ++i) {
-        iwghts.h_view(n,i,0) = 1.;
-        iwghts.h_view(n,i,1) = 1.;
-        iwghts.h_view(n,i,2) = 1.;
-        for (int j=0; j<2*ng; ++j) {
-          if (j != i) {
-            Real x1vpi1 = CellCenterX(ii1-ng+i+1, indcs.nx1, x1min, x1max);
-            Real x1vpj1 = CellCenterX(ii1-ng+j+1, indcs.nx1, x1min, x1max);
-            iwghts.h_view(n,i,0) *= (x0-x1vpj1)/(x1vpi1-x1vpj1);
-            Real x2vpi1 = CellCenterX(ii2-ng+i+1, indcs.nx2, x2min, x2max);
-            Real x2vpj1 = CellCenterX(ii2-ng+j+1, indcs.nx2, x2min, x2max);
-            iwghts.h_view(n,i,1) *= (y0-x2vpj1)/(x2vpi1-x2vpj1);
-            Real x3vpi1 = CellCenterX(ii3-ng+i+1, indcs.nx3, x3min, x3max);
-            Real x3vpj1 = CellCenterX(ii3-ng+j+1, indcs.nx3, x3min, x3max);
-            iwghts.h_view(n,i,2) *= (z0-x3vpj1)/(x3vpi1-x3vpj1);
-          }
-        }
-      }
-    }
+//! \fn void SphericalGrid::SetRadius
+//! \brief move the sphere to a new radius, recomputing the interpolation coordinates
+//! and stencils.  Used by solvers that iterate on the surface radius (e.g. the
+//! apparent-horizon finder); a no-op when the radius is unchanged
+
+void SphericalGrid::SetRadius(Real rad) {
+  if (rad == radius) return;
+  radius = rad;
+  SetInterpolationCoordinates();
+  SetInterpolationIndicesAndWeights();
+  if (pmy_pack->pmesh->adaptive) {
+    stencil_gen_ = pmy_pack->pmesh->pmr->nmb_created + pmy_pack->pmesh->pmr->nmb_deleted;
   }
-
-  // sync dual arrays
-  interp_wghts.template modify<HostMemSpace>();
-  interp_wghts.template sync<DevExeSpace>();
-
   return;
 }
 
@@ -214,51 +126,27 @@ void SphericalGrid::SetInterpolationWeights() {
 //! \brief interpolate Cartesian data to surface of sphere
 
 void SphericalGrid::InterpolateToSphere(int nvars, DvceArray5D<Real> &val) {
-  // reinitialize interpolation indices and weights if AMR
+  // The sphere is static between AMR events, so reuse the stencils built by the last
+  // call and rebuild only when AMR has actually changed the MeshBlock layout.  Blocks
+  // are only redistributed when at least one is created or deleted (see
+  // MeshRefinement::ApplyMeshUpdate), so the sum of those counters identifies the
+  // layout the stencils were built for.
   if (pmy_pack->pmesh->adaptive) {
-    SetInterpolationIndices();
-    SetInterpolationWeights();
-  }
-
-  // capturing variables for kernel
-  auto &indcs = pmy_pack->pmesh->mb_indcs;
-  int &is = indcs.is; int &js = indcs.js; int &ks = indcs.ks;
-  int &ng = indcs.ng;
-  int nang1 = nangles - 1;
-  int nvar1 = nvars - 1;
-
-  // reallocate container
-  Kokkos::realloc(interp_vals,nangles,nvars);
-
-  auto &iindcs = interp_indcs;
-  auto &iwghts = interp_wghts;
-  auto &ivals = interp_vals;
-  par_for("int2sph",DevExeSpace(),0,nang1,0,nvar1,
-  KOKKOS_LAMBDA(int n, int v) {
-    int ii0 = iindcs.d_view(n,0);
-    int ii1 = iindcs.d_view(n,1);
-    int ii2 = iindcs.d_view(n,2);
-    int ii3 = iindcs.d_view(n,3);
-
-    if (ii0==-1) {  // angle not on this rank
-      ivals.d_view(n,v) = 0.0;
-    } else {
-      Real int_value = 0.0;
-      for (int i=0; i<2*ng; i++) {
-        for (int j=0; j<2*ng; j++) {
-          for (int k=0; k<2*ng; k++) {
-            Real iwght = iwghts.d_view(n,i,0)*iwghts.d_view(n,j,1)*iwghts.d_view(n,k,2);
-            int_value += iwght*val(ii0,v,ii3-(ng-k-ks)+1,ii2-(ng-j-js)+1,ii1-(ng-i-is)+1);
-          }
-        }
-      }
-      ivals.d_view(n,v) = int_value;
+    int mesh_gen = pmy_pack->pmesh->pmr->nmb_created + pmy_pack->pmesh->pmr->nmb_deleted;
+    if (mesh_gen != stencil_gen_) {
+      SetInterpolationIndicesAndWeights();
+      stencil_gen_ = mesh_gen;
     }
-  });
+  }
 
-  // sync dual arrays
-  interp_vals.template modify<DevExeSpace>();
-  interp_vals.template sync<HostMemSpace>();
+  // reallocate container (no-op unless nvars differs from the previous call)
+  if (interp_vals.h_view.extent_int(0) != nangles ||
+      interp_vals.h_view.extent_int(1) != nvars) {
+    Kokkos::realloc(interp_vals,nangles,nvars);
+  }
 
+  // evaluate with team parallelism over angles x stencil; also syncs interp_vals
+  lagrange_interp::InterpolateBatch(pmy_pack, val, nvars, nangles,
+                                    interp_indcs, interp_wghts, interp_vals);
   return;
 }
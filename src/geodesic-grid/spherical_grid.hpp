@@ -24,18 +24,22 @@ class SphericalGrid: public GeodesicGrid {
     SphericalGrid(MeshBlockPack *pmy_pack, int nlev, Real rad);
     ~SphericalGrid();
 
-    Real radius;  // const radius for SphericalGrid
+    Real radius;  // radius for SphericalGrid, fixed between calls to SetRadius
     DualArray2D<Real> interp_coord;  // Cartesian coordinates for grid points
     DualArray2D<Real> interp_vals;   // container for data interpolated to sphere
     void InterpolateToSphere(int nvars, DvceArray5D<Real> &val);  // interpolate to sphere
+    void SetRadius(Real rad);  // move sphere to new radius, rebuilding the stencils
 
  private:
     MeshBlockPack* pmy_pack;  // ptr to MeshBlockPack containing this Hydro
     DualArray2D<int> interp_indcs;   // indices of MeshBlock and zones therein for interp
     DualArray3D<Real> interp_wghts;  // weights for interpolation
+    // MeshBlock layout generation (# of MBs created+deleted by AMR) for which the
+    // stencils above were built; they are rebuilt only when this changes
+    int stencil_gen_;
     void SetInterpolationCoordinates();  // set indexing for interpolation
-    void SetInterpolationIndices();      // set indexing for interpolation
-    void SetInterpolationWeights();      // set weights for interpolation
+    // set stencil indices and weights for all angles in one device kernel
+    void SetInterpolationIndicesAndWeights();
 };
 
 #endif // GEODESIC_GRID_SPHERICAL_GRID_HPP_
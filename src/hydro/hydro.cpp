@@ -19,6 +19,7 @@
 #include "srcterms/srcterms.hpp"
 #include "shearing_box/shearing_box.hpp"
 #include "bvals/bvals.hpp"
+#include "utils/numa_audit.hpp"
 #include "hydro/hydro.hpp"
 
 namespace hydro {
@@ -34,7 +35,9 @@ Hydro::Hydro(MeshBlockPack *ppack, ParameterInput *pin) :
     u1("cons1",1,1,1,1,1),
     uflx("uflx",1,1,1,1,1),
     utest("utest",1,1,1,1,1),
-    fofc("fofc",1,1,1,1) {
+    fofc("fofc"),
+    u_sts("u_sts",1,1,1,1,1),
+    divf_sts("divf_sts",1,1,1,1,1) {
   // Total number of MeshBlocks on this rank to be used in array dimensioning
   int nmb = std::max((ppack->nmb_thispack), (ppack->pmesh->nmb_maxperrank));
 
@@ -101,8 +104,10 @@ Hydro::Hydro(MeshBlockPack *ppack, ParameterInput *pin) :
     int ncells1 = indcs.nx1 + 2*(indcs.ng);
     int ncells2 = (indcs.nx2 > 1)? (indcs.nx2 + 2*(indcs.ng)) : 1;
     int ncells3 = (indcs.nx3 > 1)? (indcs.nx3 + 2*(indcs.ng)) : 1;
-    Kokkos::realloc(u0, nmb, (nhydro+nscalars), ncells3, ncells2, ncells1);
-    Kokkos::realloc(w0, nmb, (nhydro+nscalars), ncells3, ncells2, ncells1);
+    // first-touch allocation places pages on the NUMA node of the thread that later
+    // iterates over them in the flux/update kernels (no-op on device builds)
+    realloc_first_touch(u0, nmb, (nhydro+nscalars), ncells3, ncells2, ncells1);
+    realloc_first_touch(w0, nmb, (nhydro+nscalars), ncells3, ncells2, ncells1);
   }
 
   // allocate memory for conserved variables on coarse mesh
@@ -112,11 +117,28 @@ Hydro::Hydro(MeshBlockPack *ppack, ParameterInput *pin) :
     int n_ccells2 = (indcs.cnx2 > 1)? (indcs.cnx2 + 2*(indcs.ng)) : 1;
     int n_ccells3 = (indcs.cnx3 > 1)? (indcs.cnx3 + 2*(indcs.ng)) : 1;
     Kokkos::realloc(coarse_u0, nmb, (nhydro+nscalars), n_ccells3, n_ccells2, n_ccells1);
-    Kokkos::realloc(coarse_w0, nmb, (nhydro+nscalars), n_ccells3, n_ccells2, n_ccells1);
+    // coarse primitives are only touched when prolongating primitive variables, so do
+    // not spend device memory on them otherwise
+    if (ppack->pmesh->pmr->prolong_prims) {
+      Kokkos::realloc(coarse_w0, nmb, (nhydro+nscalars), n_ccells3, n_ccells2, n_ccells1);
+    }
   }
 
-  // allocate boundary buffers for conserved (cell-centered) variables
-  pbval_u = new MeshBoundaryValuesCC(ppack, pin, false);
+  // allocate boundary buffers for conserved (cell-centered) variables.  Exchange only
+  // the ghost layers the reconstruction stencil reads (+1 with FOFC) instead of the
+  // global nghost, which mixed-physics runs must set for the deepest stencil present
+  // (e.g. the z4c FD stencil); checks that nghost itself is deep enough for the method
+  // are made where the method is selected below.  Ion-neutral runs exchange both fluids
+  // through the MHD buffers, so the default full depth is kept there
+  int ng_exch = -1;
+  if (evolution_t.compare("stationary") != 0 && !(pin->DoesBlockExist("ion-neutral"))) {
+    std::string xorder = pin->GetOrAddString("hydro","reconstruct","plm");
+    ng_exch = (xorder.compare("dc") == 0)? 1 : ((xorder.compare("plm") == 0)? 2 : 3);
+    if (pin->GetOrAddBoolean("hydro","fofc",false)) {ng_exch += 1;}
+    // diffusive fluxes read transverse gradients one cell beyond the flux face
+    if ((pvisc != nullptr) || (pcond != nullptr)) {ng_exch = std::max(ng_exch,2);}
+  }
+  pbval_u = new MeshBoundaryValuesCC(ppack, pin, false, ng_exch);
   pbval_u->InitializeBuffers((nhydro+nscalars));
 
   // Orbital advection and shearing box BCs (if requested in input file)
@@ -133,6 +155,63 @@ Hydro::Hydro(MeshBlockPack *ppack, ParameterInput *pin) :
     // determine if FOFC is enabled
     use_fofc = pin->GetOrAddBoolean("hydro","fofc",false);
 
+    // determine if cell-local source terms are applied inside the RK update kernel
+    // (single sweep over memory) instead of in separate kernels in HydroSrcTerms()
+    fused_srcterms = pin->GetOrAddBoolean("hydro","fused_srcterms",false);
+
+    // determine if quiescence detection is enabled, i.e. MeshBlocks whose state changed
+    // by less than quiescence_tol (relative) over the previous step skip the flux
+    // recompute and reuse their stored fluxes (see CopyCons() and CalculateFluxes())
+    use_quiescence = pin->GetOrAddBoolean("hydro","quiescence",false);
+    if (use_quiescence) {
+      quiescence_tol = pin->GetOrAddReal("hydro","quiescence_tol",1.0e-12);
+      quiescence_ncycle = pin->GetOrAddInteger("hydro","quiescence_ncycle",10);
+      // residual measured as change of u0 relative to u1 (= u^n) in CopyCons(), which
+      // requires integrators that leave u1 unchanged after the first stage
+      std::string integrator = pin->GetOrAddString("time","integrator","rk2");
+      if (integrator.compare("rk1") != 0 && integrator.compare("rk2") != 0 &&
+          integrator.compare("rk3") != 0) {
+        std::cout << "### FATAL ERROR in " << __FILE__ << " at line " << __LINE__
+                  << std::endl << "<hydro> quiescence=true only works with rk1/rk2/rk3 "
+                  << "integrators" << std::endl;
+        std::exit(EXIT_FAILURE);
+      }
+      // stored fluxes cannot be reused when the MeshBlock list changes (AMR), when
+      // FOFC selectively rewrites them, or when diffusive fluxes are added each stage
+      if (pmy_pack->pmesh->adaptive || use_fofc ||
+          (pvisc != nullptr) || (pcond != nullptr)) {
+        std::cout << "### FATAL ERROR in " << __FILE__ << " at line " << __LINE__
+                  << std::endl << "<hydro> quiescence=true incompatible with AMR, "
+                  << "FOFC, viscosity, and conductivity" << std::endl;
+        std::exit(EXIT_FAILURE);
+      }
+    }
+
+    // determine if diffusion terms are advanced with RKL2 super-time-stepping
+    use_sts = pin->GetOrAddBoolean("time","sts",false);
+    if (use_sts) {
+      if ((pvisc == nullptr) && (pcond == nullptr)) {
+        std::cout << "### FATAL ERROR in " << __FILE__ << " at line " << __LINE__
+                  << std::endl << "<time> sts=true requires viscosity and/or "
+                  << "conductivity in <hydro> block" << std::endl;
+        std::exit(EXIT_FAILURE);
+      }
+      if (psrc->shearing_box) {
+        std::cout << "### FATAL ERROR in " << __FILE__ << " at line " << __LINE__
+                  << std::endl << "<time> sts=true not implemented for shearing box"
+                  << std::endl;
+        std::exit(EXIT_FAILURE);
+      }
+      // STS task lists are only assembled for single-fluid (M)HD
+      if (pin->DoesBlockExist("radiation") || pin->DoesBlockExist("adm") ||
+          pin->DoesBlockExist("z4c") || pin->DoesBlockExist("ion-neutral")) {
+        std::cout << "### FATAL ERROR in " << __FILE__ << " at line " << __LINE__
+                  << std::endl << "<time> sts=true only implemented for single-fluid "
+                  << "hydro and MHD" << std::endl;
+        std::exit(EXIT_FAILURE);
+      }
+    }
+
     // select reconstruction method (default PLM)
     std::string xorder = pin->GetOrAddString("hydro","reconstruct","plm");
     if (xorder.compare("dc") == 0) {
@@ -149,7 +228,8 @@ Hydro::Hydro(MeshBlockPack *ppack, ParameterInput *pin) :
       }
     } else if (xorder.compare("ppm4") == 0 ||
                xorder.compare("ppmx") == 0 ||
-               xorder.compare("wenoz") == 0) {
+               xorder.compare("wenoz") == 0 ||
+               xorder.compare("wenoza") == 0) {
       // check that nghost > 2
       auto &indcs = pmy_pack->pmesh->mb_indcs;
       if (indcs.ng < 3) {
@@ -171,6 +251,8 @@ Hydro::Hydro(MeshBlockPack *ppack, ParameterInput *pin) :
         recon_method = ReconstructionMethod::ppmx;
       } else if (xorder.compare("wenoz") == 0) {
         recon_method = ReconstructionMethod::wenoz;
+      } else if (xorder.compare("wenoza") == 0) {
+        recon_method = ReconstructionMethod::wenoza;
       }
     } else {
       std::cout << "### FATAL ERROR in " << __FILE__ << " at line " << __LINE__
@@ -272,16 +354,50 @@ Hydro::Hydro(MeshBlockPack *ppack, ParameterInput *pin) :
       int ncells1 = indcs.nx1 + 2*(indcs.ng);
       int ncells2 = (indcs.nx2 > 1)? (indcs.nx2 + 2*(indcs.ng)) : 1;
       int ncells3 = (indcs.nx3 > 1)? (indcs.nx3 + 2*(indcs.ng)) : 1;
-      Kokkos::realloc(u1,       nmb, (nhydro+nscalars), ncells3, ncells2, ncells1);
-      Kokkos::realloc(uflx.x1f, nmb, (nhydro+nscalars), ncells3, ncells2, ncells1);
-      Kokkos::realloc(uflx.x2f, nmb, (nhydro+nscalars), ncells3, ncells2, ncells1);
-      Kokkos::realloc(uflx.x3f, nmb, (nhydro+nscalars), ncells3, ncells2, ncells1);
+      // first-touch allocations, as for u0/w0 above
+      realloc_first_touch(u1,       nmb, (nhydro+nscalars), ncells3, ncells2, ncells1);
+      realloc_first_touch(uflx.x1f, nmb, (nhydro+nscalars), ncells3, ncells2, ncells1);
+      realloc_first_touch(uflx.x2f, nmb, (nhydro+nscalars), ncells3, ncells2, ncells1);
+      realloc_first_touch(uflx.x3f, nmb, (nhydro+nscalars), ncells3, ncells2, ncells1);
+
+      // optionally report NUMA page placement of the largest pack-level arrays
+      if (pin->GetOrAddBoolean("mesh", "numa_audit", false) &&
+          global_variable::my_rank == 0) {
+        numa::AuditPages("hydro u0", u0.data(), u0.span()*sizeof(Real));
+        numa::AuditPages("hydro w0", w0.data(), w0.span()*sizeof(Real));
+        numa::AuditPages("hydro u1", u1.data(), u1.span()*sizeof(Real));
+        numa::AuditPages("hydro uflx.x1f", uflx.x1f.data(),
+                         uflx.x1f.span()*sizeof(Real));
+      }
+
+      // allocate per-MB residuals and flags used with quiescence detection
+      if (use_quiescence) {
+        Kokkos::realloc(qres, nmb);
+        Kokkos::realloc(qflag, nmb);
+        Kokkos::deep_copy(qres, 0.0);
+        for (int m=0; m<nmb; ++m) {qflag.h_view(m) = 0;}
+        qflag.template modify<HostMemSpace>();
+        qflag.template sync<DevExeSpace>();
+      }
 
       // allocate array of flags used with FOFC
       if (use_fofc) {
-        Kokkos::realloc(fofc,  nmb, ncells3, ncells2, ncells1);
+        fofc.Realloc(nmb, ncells3, ncells2, ncells1);
         Kokkos::realloc(utest, nmb, nhydro, ncells3, ncells2, ncells1);
       }
+
+      // allocate compacted list of flagged cells used with FOFC and/or excision
+      if (use_fofc || (pmy_pack->pcoord->is_general_relativistic &&
+                       pmy_pack->pcoord->coord_data.bh_excise)) {
+        Kokkos::realloc(fofc_list, nmb*ncells3*ncells2*ncells1);
+        Kokkos::realloc(nfofc, 1);
+      }
+
+      // allocate registers used by RKL2 super-time-stepping of diffusion terms
+      if (use_sts) {
+        Kokkos::realloc(u_sts,    nmb, (nhydro+nscalars), ncells3, ncells2, ncells1);
+        Kokkos::realloc(divf_sts, nmb, (nhydro+nscalars), ncells3, ncells2, ncells1);
+      }
     }
   }
 }
@@ -48,6 +48,7 @@ struct HydroTaskIDs {
   TaskID recvu_oa;
   TaskID restu;
   TaskID sendu;
+  TaskID c2p_int;
   TaskID recvu;
   TaskID sendu_shr;
   TaskID recvu_shr;
@@ -55,8 +56,22 @@ struct HydroTaskIDs {
   TaskID prol;
   TaskID c2p;
   TaskID newdt;
+  TaskID coolsub;
   TaskID csend;
   TaskID crecv;
+  TaskID sts_irecv;
+  TaskID sts_flux;
+  TaskID sts_sendf;
+  TaskID sts_recvf;
+  TaskID sts_rkupdt;
+  TaskID sts_restu;
+  TaskID sts_sendu;
+  TaskID sts_recvu;
+  TaskID sts_bcs;
+  TaskID sts_prol;
+  TaskID sts_c2p;
+  TaskID sts_csend;
+  TaskID sts_crecv;
 };
 
 namespace hydro {
@@ -100,9 +115,27 @@ class Hydro {
   Real dtnew;
 
   // following used for FOFC
-  DvceArray4D<bool> fofc;  // flag for each cell to indicate if FOFC is needed
+  DvceBitFlag4D fofc;  // per-cell flag (bit-packed) to indicate if FOFC is needed
   bool use_fofc = false;   // flag to enable FOFC
   DvceArray5D<Real> utest;  // scratch array for FOFC
+  DvceArray1D<int> fofc_list;  // compacted list of flagged cells (encoded indices)
+  DvceArray1D<int> nfofc;      // number of cells in fofc_list (single element)
+
+  // flag to apply cell-local source terms inside the RKUpdate kernel, rather than in
+  // separate sweeps over u0/w0 in HydroSrcTerms()
+  bool fused_srcterms = false;
+
+  // following used for quiescence detection (skip flux recompute on quiescent MBs)
+  bool use_quiescence = false;  // flag to enable quiescence detection
+  Real quiescence_tol;      // per-step relative change below which a MB is quiescent
+  int quiescence_ncycle;    // force flux recompute on all MBs every this many cycles
+  DvceArray1D<Real> qres;   // per-MB max relative change in u0 over previous step
+  DualArray1D<int> qflag;   // per-MB flag: 1 = quiescent, stored fluxes reused
+
+  // following used for RKL2 super-time-stepping of diffusion terms
+  bool use_sts = false;        // flag to advance diffusion with operator-split RKL2 STS
+  DvceArray5D<Real> u_sts;     // conserved variables at start of STS update (Y_0)
+  DvceArray5D<Real> divf_sts;  // diffusive flux divergence at Y_0
 
   // container to hold names of TaskIDs
   HydroTaskIDs id;
@@ -117,6 +150,10 @@ class Hydro {
   TaskStatus SendFlux(Driver *d, int stage);
   TaskStatus RecvFlux(Driver *d, int stage);
   TaskStatus RKUpdate(Driver *d, int stage);
+  // RKUpdate kernel templated over dimensionality; RKUpdate() dispatches to the
+  // specialization for this problem so 1D/2D runs compile out the transverse terms
+  template <bool MULTI_D, bool THREE_D>
+  TaskStatus RKUpdateDim(Driver *d, int stage);
   TaskStatus HydroSrcTerms(Driver *d, int stage);
   TaskStatus SendU_OA(Driver *d, int stage);
   TaskStatus RecvU_OA(Driver *d, int stage);
@@ -128,18 +165,42 @@ class Hydro {
   TaskStatus ApplyPhysicalBCs(Driver* pdrive, int stage);
   TaskStatus Prolongate(Driver* pdrive, int stage);
   TaskStatus ConToPrim(Driver *d, int stage);
+  TaskStatus ConToPrimInterior(Driver *d, int stage);
+  TaskStatus ConToPrimGhosts(Driver *d, int stage);
   TaskStatus NewTimeStep(Driver *d, int stage);
+  // ...in "after_timeintegrator" task list
+  TaskStatus CoolingSubcycle(Driver *d, int stage);
   // ...in "after_stagen_tl" list
   TaskStatus ClearSend(Driver *d, int stage);
   TaskStatus ClearRecv(Driver *d, int stage);  // also in Driver::Initialize
-
-  // CalculateFluxes function templated over Riemann Solvers
+  // ...in "sts_*" task lists (RKL2 super-time-stepping of diffusion terms)
+  TaskStatus STSInitRecv(Driver *d, int stage);
+  TaskStatus STSFluxes(Driver *d, int stage);
+  TaskStatus STSRKUpdate(Driver *d, int stage);
+  TaskStatus STSClearSend(Driver *d, int stage);
+  TaskStatus STSClearRecv(Driver *d, int stage);
+
+  // CalculateFluxes function templated over Riemann Solver, reconstruction method, EOS
+  // branch, and inline viscous flux hook, so each enabled combination gets its own
+  // specialized kernel
+  template <Hydro_RSolver T, ReconstructionMethod R, bool is_ideal, bool add_visc>
+  void CalculateFluxes(Driver *d, int stage);
+  // dispatch function templated over Riemann Solver, EOS branch, and hook; selects
+  // reconstruction
+  template <Hydro_RSolver T, bool is_ideal, bool add_visc>
+  void CalculateFluxes(Driver *d, int stage);
+  // dispatch function templated over Riemann Solver only; enables the viscous hook at
+  // compile time when viscosity is active (and not advanced with operator-split STS),
+  // and selects the ideal-gas or isothermal EOS branch for non-relativistic solvers
   template <Hydro_RSolver T>
   void CalculateFluxes(Driver *d, int stage);
 
   // first-order flux correction
   void FOFC(Driver *d, int stage);
 
+  // set per-MB quiescence flags from residuals measured in CopyCons()
+  void UpdateQuiescenceFlags();
+
  private:
   MeshBlockPack* pmy_pack;  // ptr to MeshBlockPack containing this Hydro
 };
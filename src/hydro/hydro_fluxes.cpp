@@ -11,6 +11,8 @@
 #include "athena.hpp"
 #include "mesh/mesh.hpp"
 #include "coordinates/coordinates.hpp"
+#include "driver/driver.hpp"
+#include "diffusion/viscosity.hpp"
 #include "hydro.hpp"
 #include "eos/eos.hpp"
 #include "reconstruct/dc.hpp"
@@ -32,9 +34,18 @@ namespace hydro {
 //----------------------------------------------------------------------------------------
 //! \fn void Hydro::CalculateFluxes
 //! \brief Calls reconstruction and Riemann solver functions to compute hydro fluxes
-//! Note this function is templated over RS for better performance on GPUs.
-
-template <Hydro_RSolver rsolver_method_>
+//! Note this function is templated over the RS, reconstruction method, EOS branch, and
+//! the inline viscous flux hook, so that each enabled combination compiles to its own
+//! lean kernel with no runtime branches, for better performance on GPUs.  With add_visc_
+//! enabled, viscous fluxes are added inside these kernels while the flux at each face is
+//! still resident, instead of a second full pass over w0 and the flux arrays per stage
+//! (the standalone kernel in diffusion/viscosity.cpp remains for the STS integrator).
+//! With is_ideal_ disabled, the per-interface is_ideal branches and all energy-variable
+//! work inside the non-relativistic Riemann solvers compile out, so isothermal runs
+//! carry exactly four hydro variables through the flux loops end-to-end.
+
+template <Hydro_RSolver rsolver_method_, ReconstructionMethod recon_method_,
+          bool is_ideal_, bool add_visc_>
 void Hydro::CalculateFluxes(Driver *pdriver, int stage) {
   RegionIndcs &indcs_ = pmy_pack->pmesh->mb_indcs;
   int is = indcs_.is, ie = indcs_.ie;
@@ -45,21 +56,33 @@ void Hydro::CalculateFluxes(Driver *pdriver, int stage) {
   int &nhyd_  = nhydro;
   int nvars = nhydro + nscalars;
   int nmb1 = pmy_pack->nmb_thispack - 1;
-  const auto recon_method_ = recon_method;
-  bool extrema = false;
-  if (recon_method == ReconstructionMethod::ppmx) {
-    extrema = true;
-  }
+  constexpr bool extrema = (recon_method_ == ReconstructionMethod::ppmx);
 
   auto &eos_ = peos->eos_data;
   auto &size_ = pmy_pack->pmb->mb_size;
   auto &coord_ = pmy_pack->pcoord->coord_data;
   auto &w0_ = w0;
+  bool multi_d_ = pmy_pack->pmesh->multi_d;
+  bool three_d_ = pmy_pack->pmesh->three_d;
+  Real nu_ = (pvisc != nullptr)? pvisc->nu : 0.0;
+  // with quiescence detection, MBs flagged quiescent skip the recompute below and the
+  // fluxes stored in uflx from the last active step are reused
+  const bool use_q = use_quiescence;
+  auto &qflag_ = qflag;
+  // stream this task was launched on (default instance unless task flagged async)
+  DevExeSpace exec = pdriver->ExecSpace();
 
   //--------------------------------------------------------------------------------------
   // i-direction
 
   size_t scr_size = ScrArray2D<Real>::shmem_size(nvars, ncells1) * 2;
+  if constexpr (recon_method_ == ReconstructionMethod::ppm4 ||
+                recon_method_ == ReconstructionMethod::ppmx ||
+                recon_method_ == ReconstructionMethod::wenoz ||
+                recon_method_ == ReconstructionMethod::wenoza) {
+    // extra pencil staged in scratch by the X1 reconstruction wrappers
+    scr_size += ScrArray1D<Real>::shmem_size(ncells1);
+  }
   int scr_level = 0;
   auto &flx1_ = uflx.x1f;
 
@@ -74,28 +97,27 @@ void Hydro::CalculateFluxes(Driver *pdriver, int stage) {
     }
   }
 
-  par_for_outer("hflux_x1",DevExeSpace(), scr_size, scr_level, 0, nmb1, kl, ku, jl, ju,
+  par_for_outer("hflux_x1",exec, scr_size, scr_level, 0, nmb1, kl, ku, jl, ju,
   KOKKOS_LAMBDA(TeamMember_t member, const int m, const int k, const int j) {
+    if (use_q && (qflag_.d_view(m) != 0)) {return;}
     ScrArray2D<Real> wl(member.team_scratch(scr_level), nvars, ncells1);
     ScrArray2D<Real> wr(member.team_scratch(scr_level), nvars, ncells1);
 
     // Reconstruct qR[i] and qL[i+1]
-    switch (recon_method_) {
-      case ReconstructionMethod::dc:
-        DonorCellX1(member, m, k, j, il-1, iu, w0_, wl, wr);
-        break;
-      case ReconstructionMethod::plm:
-        PiecewiseLinearX1(member, m, k, j, il-1, iu, w0_, wl, wr);
-        break;
-      case ReconstructionMethod::ppm4:
-      case ReconstructionMethod::ppmx:
-        PiecewiseParabolicX1(member,eos_,extrema,true, m, k, j, il-1, iu, w0_, wl, wr);
-        break;
-      case ReconstructionMethod::wenoz:
-        WENOZX1(member, eos_, true, m, k, j, il-1, iu, w0_, wl, wr);
-        break;
-      default:
-        break;
+    if constexpr (recon_method_ == ReconstructionMethod::dc) {
+      DonorCellX1(member, m, k, j, il-1, iu, w0_, wl, wr);
+    } else if constexpr (recon_method_ == ReconstructionMethod::plm) {
+      PiecewiseLinearX1(member, eos_, m, k, j, il-1, iu, w0_, wl, wr);
+    } else if constexpr (recon_method_ == ReconstructionMethod::ppm4 ||
+                         recon_method_ == ReconstructionMethod::ppmx) {
+      ScrArray1D<Real> qs(member.team_scratch(scr_level), ncells1);
+      PiecewiseParabolicX1(member,eos_,extrema,true, m, k, j, il-1, iu, w0_, qs, wl, wr);
+    } else if constexpr (recon_method_ == ReconstructionMethod::wenoz) {
+      ScrArray1D<Real> qs(member.team_scratch(scr_level), ncells1);
+      WENOZX1(member, eos_, true, m, k, j, il-1, iu, w0_, qs, wl, wr);
+    } else if constexpr (recon_method_ == ReconstructionMethod::wenoza) {
+      ScrArray1D<Real> qs(member.team_scratch(scr_level), ncells1);
+      WENOZAX1(member, eos_, true, m, k, j, il-1, iu, w0_, qs, wl, wr);
     }
     // Sync all threads in the team so that scratch memory is consistent
     member.team_barrier();
@@ -110,13 +132,16 @@ void Hydro::CalculateFluxes(Driver *pdriver, int stage) {
     if constexpr (rsolver_method_ == Hydro_RSolver::advect) {
       Advect(member, eos, indcs, size, coord, m, k, j, il, iu, IVX, wl, wr, flx1);
     } else if constexpr (rsolver_method_ == Hydro_RSolver::llf) {
-      LLF(member, eos, indcs, size, coord, m, k, j, il, iu, IVX, wl, wr, flx1);
+      LLF<is_ideal_>(member, eos, indcs, size, coord,
+                     m, k, j, il, iu, IVX, wl, wr, flx1);
     } else if constexpr (rsolver_method_ == Hydro_RSolver::hlle) {
-      HLLE(member, eos, indcs, size, coord, m, k, j, il, iu, IVX, wl, wr, flx1);
+      HLLE<is_ideal_>(member, eos, indcs, size, coord,
+                      m, k, j, il, iu, IVX, wl, wr, flx1);
     } else if constexpr (rsolver_method_ == Hydro_RSolver::hllc) {
       HLLC(member, eos, indcs, size, coord, m, k, j, il, iu, IVX, wl, wr, flx1);
     } else if constexpr (rsolver_method_ == Hydro_RSolver::roe) {
-      Roe(member, eos, indcs, size, coord, m, k, j, il, iu, IVX, wl, wr, flx1);
+      Roe<is_ideal_>(member, eos, indcs, size, coord,
+                    m, k, j, il, iu, IVX, wl, wr, flx1);
     } else if constexpr (rsolver_method_ == Hydro_RSolver::llf_sr) {
       LLF_SR(member, eos, indcs, size, coord, m, k, j, il, iu, IVX, wl, wr, flx1);
     } else if constexpr (rsolver_method_ == Hydro_RSolver::hlle_sr) {
@@ -142,6 +167,44 @@ void Hydro::CalculateFluxes(Driver *pdriver, int stage) {
         });
       }
     }
+
+    // add viscous fluxes over the same faces covered by the standalone kernel
+    if constexpr (add_visc_) {
+      if ((j >= js) && (j <= je) && (k >= ks) && (k <= ke)) {
+        const Real dx1 = size_.d_view(m).dx1;
+        const Real dx2 = size_.d_view(m).dx2;
+        const Real dx3 = size_.d_view(m).dx3;
+        par_for_inner(member, is, ie+1, [&](const int i) {
+          // [2(dVx/dx)-(2/3)dVx/dx, dVy/dx, dVz/dx]
+          Real fvx = 4.0*(w0_(m,IVX,k,j,i) - w0_(m,IVX,k,j,i-1))/(3.0*dx1);
+          Real fvy =     (w0_(m,IVY,k,j,i) - w0_(m,IVY,k,j,i-1))/dx1;
+          Real fvz =     (w0_(m,IVZ,k,j,i) - w0_(m,IVZ,k,j,i-1))/dx1;
+          // in 2D/3D add [(-2/3)dVy/dy, dVx/dy, 0]
+          if (multi_d_) {
+            fvx -= ((w0_(m,IVY,k,j+1,i) + w0_(m,IVY,k,j+1,i-1)) -
+                    (w0_(m,IVY,k,j-1,i) + w0_(m,IVY,k,j-1,i-1)))/(6.0*dx2);
+            fvy += ((w0_(m,IVX,k,j+1,i) + w0_(m,IVX,k,j+1,i-1)) -
+                    (w0_(m,IVX,k,j-1,i) + w0_(m,IVX,k,j-1,i-1)))/(4.0*dx2);
+          }
+          // in 3D add [(-2/3)dVz/dz, 0,  dVx/dz]
+          if (three_d_) {
+            fvx -= ((w0_(m,IVZ,k+1,j,i) + w0_(m,IVZ,k+1,j,i-1)) -
+                    (w0_(m,IVZ,k-1,j,i) + w0_(m,IVZ,k-1,j,i-1)))/(6.0*dx3);
+            fvz += ((w0_(m,IVX,k+1,j,i) + w0_(m,IVX,k+1,j,i-1)) -
+                    (w0_(m,IVX,k-1,j,i) + w0_(m,IVX,k-1,j,i-1)))/(4.0*dx3);
+          }
+          Real nud = 0.5*nu_*(w0_(m,IDN,k,j,i) + w0_(m,IDN,k,j,i-1));
+          flx1_(m,IVX,k,j,i) -= nud*fvx;
+          flx1_(m,IVY,k,j,i) -= nud*fvy;
+          flx1_(m,IVZ,k,j,i) -= nud*fvz;
+          if constexpr (is_ideal_) {
+            flx1_(m,IEN,k,j,i) -= 0.5*nud*((w0_(m,IVX,k,j,i-1) + w0_(m,IVX,k,j,i))*fvx +
+                                           (w0_(m,IVY,k,j,i-1) + w0_(m,IVY,k,j,i))*fvy +
+                                           (w0_(m,IVZ,k,j,i-1) + w0_(m,IVZ,k,j,i))*fvz);
+          }
+        });
+      }
+    }
   });
 
   //--------------------------------------------------------------------------------------
@@ -162,8 +225,9 @@ void Hydro::CalculateFluxes(Driver *pdriver, int stage) {
       }
     }
 
-    par_for_outer("hflux_x2",DevExeSpace(), scr_size, scr_level, 0, nmb1, kl, ku,
+    par_for_outer("hflux_x2",exec, scr_size, scr_level, 0, nmb1, kl, ku,
     KOKKOS_LAMBDA(TeamMember_t member, const int m, const int k) {
+      if (use_q && (qflag_.d_view(m) != 0)) {return;}
       ScrArray2D<Real> scr1(member.team_scratch(scr_level), nvars, ncells1);
       ScrArray2D<Real> scr2(member.team_scratch(scr_level), nvars, ncells1);
       ScrArray2D<Real> scr3(member.team_scratch(scr_level), nvars, ncells1);
@@ -179,22 +243,17 @@ void Hydro::CalculateFluxes(Driver *pdriver, int stage) {
         }
 
         // Reconstruct qR[j] and qL[j+1]
-        switch (recon_method_) {
-          case ReconstructionMethod::dc:
-            DonorCellX2(member, m, k, j, il, iu, w0_, wl_jp1, wr);
-            break;
-          case ReconstructionMethod::plm:
-            PiecewiseLinearX2(member, m, k, j, il, iu, w0_, wl_jp1, wr);
-            break;
-          case ReconstructionMethod::ppm4:
-          case ReconstructionMethod::ppmx:
-            PiecewiseParabolicX2(member,eos_,extrema,true,m,k,j,il,iu, w0_, wl_jp1, wr);
-            break;
-          case ReconstructionMethod::wenoz:
-            WENOZX2(member, eos_, true, m, k, j, il, iu, w0_, wl_jp1, wr);
-            break;
-          default:
-            break;
+        if constexpr (recon_method_ == ReconstructionMethod::dc) {
+          DonorCellX2(member, m, k, j, il, iu, w0_, wl_jp1, wr);
+        } else if constexpr (recon_method_ == ReconstructionMethod::plm) {
+          PiecewiseLinearX2(member, eos_, m, k, j, il, iu, w0_, wl_jp1, wr);
+        } else if constexpr (recon_method_ == ReconstructionMethod::ppm4 ||
+                             recon_method_ == ReconstructionMethod::ppmx) {
+          PiecewiseParabolicX2(member,eos_,extrema,true,m,k,j,il,iu, w0_, wl_jp1, wr);
+        } else if constexpr (recon_method_ == ReconstructionMethod::wenoz) {
+          WENOZX2(member, eos_, true, m, k, j, il, iu, w0_, wl_jp1, wr);
+        } else if constexpr (recon_method_ == ReconstructionMethod::wenoza) {
+          WENOZAX2(member, eos_, true, m, k, j, il, iu, w0_, wl_jp1, wr);
         }
         member.team_barrier();
 
@@ -209,13 +268,16 @@ void Hydro::CalculateFluxes(Driver *pdriver, int stage) {
           if constexpr (rsolver_method_ == Hydro_RSolver::advect) {
             Advect(member, eos, indcs, size, coord, m, k, j, il, iu, IVY, wl, wr, flx2);
           } else if constexpr (rsolver_method_ == Hydro_RSolver::llf) {
-            LLF(member, eos, indcs, size, coord, m, k, j, il, iu, IVY, wl, wr, flx2);
+            LLF<is_ideal_>(member, eos, indcs, size, coord,
+                     m, k, j, il, iu, IVY, wl, wr, flx2);
           } else if constexpr (rsolver_method_ == Hydro_RSolver::hlle) {
-            HLLE(member, eos, indcs, size, coord, m, k, j, il, iu, IVY, wl, wr, flx2);
+            HLLE<is_ideal_>(member, eos, indcs, size, coord,
+                      m, k, j, il, iu, IVY, wl, wr, flx2);
           } else if constexpr (rsolver_method_ == Hydro_RSolver::hllc) {
             HLLC(member, eos, indcs, size, coord, m, k, j, il, iu, IVY, wl, wr, flx2);
           } else if constexpr (rsolver_method_ == Hydro_RSolver::roe) {
-            Roe(member, eos, indcs, size, coord, m, k, j, il, iu, IVY, wl, wr, flx2);
+            Roe<is_ideal_>(member, eos, indcs, size, coord,
+                    m, k, j, il, iu, IVY, wl, wr, flx2);
           } else if constexpr (rsolver_method_ == Hydro_RSolver::llf_sr) {
             LLF_SR(member, eos, indcs, size, coord, m, k, j, il, iu, IVY, wl, wr, flx2);
           } else if constexpr (rsolver_method_ == Hydro_RSolver::hlle_sr) {
@@ -242,6 +304,42 @@ void Hydro::CalculateFluxes(Driver *pdriver, int stage) {
             });
           }
         }
+
+        // add viscous fluxes over the same faces covered by the standalone kernel
+        if constexpr (add_visc_) {
+          if ((j >= js) && (j <= je+1) && (k >= ks) && (k <= ke)) {
+            const Real dx1 = size_.d_view(m).dx1;
+            const Real dx2 = size_.d_view(m).dx2;
+            const Real dx3 = size_.d_view(m).dx3;
+            par_for_inner(member, is, ie, [&](const int i) {
+              // [(dVx/dy+dVy/dx), 2(dVy/dy)-(2/3)(dVx/dx+dVy/dy), dVz/dy]
+              Real fvx = (w0_(m,IVX,k,j,i  ) - w0_(m,IVX,k,j-1,i  ))/dx2 +
+                        ((w0_(m,IVY,k,j,i+1) + w0_(m,IVY,k,j-1,i+1)) -
+                         (w0_(m,IVY,k,j,i-1) + w0_(m,IVY,k,j-1,i-1)))/(4.0*dx1);
+              Real fvy = (w0_(m,IVY,k,j,i) - w0_(m,IVY,k,j-1,i))*4.0/(3.0*dx2) -
+                        ((w0_(m,IVX,k,j,i+1) + w0_(m,IVX,k,j-1,i+1)) -
+                         (w0_(m,IVX,k,j,i-1) + w0_(m,IVX,k,j-1,i-1)))/(6.0*dx1);
+              Real fvz = (w0_(m,IVZ,k,j,i  ) - w0_(m,IVZ,k,j-1,i  ))/dx2;
+              // in 3D add [0, (-2/3)dVz/dz, dVy/dz]
+              if (three_d_) {
+                fvy -= ((w0_(m,IVZ,k+1,j,i) + w0_(m,IVZ,k+1,j-1,i)) -
+                        (w0_(m,IVZ,k-1,j,i) + w0_(m,IVZ,k-1,j-1,i)))/(6.0*dx3);
+                fvz += ((w0_(m,IVY,k+1,j,i) + w0_(m,IVY,k+1,j-1,i)) -
+                        (w0_(m,IVY,k-1,j,i) + w0_(m,IVY,k-1,j-1,i)))/(4.0*dx3);
+              }
+              Real nud = 0.5*nu_*(w0_(m,IDN,k,j,i) + w0_(m,IDN,k,j-1,i));
+              flx2_(m,IVX,k,j,i) -= nud*fvx;
+              flx2_(m,IVY,k,j,i) -= nud*fvy;
+              flx2_(m,IVZ,k,j,i) -= nud*fvz;
+              if constexpr (is_ideal_) {
+                flx2_(m,IEN,k,j,i) -=
+                    0.5*nud*((w0_(m,IVX,k,j-1,i) + w0_(m,IVX,k,j,i))*fvx +
+                             (w0_(m,IVY,k,j-1,i) + w0_(m,IVY,k,j,i))*fvy +
+                             (w0_(m,IVZ,k,j-1,i) + w0_(m,IVZ,k,j,i))*fvz);
+              }
+            });
+          }
+        }
       } // end of loop over j
     });
   }
@@ -250,46 +348,52 @@ void Hydro::CalculateFluxes(Driver *pdriver, int stage) {
   // k-direction. Note order of k,j loops switched
 
   if (pmy_pack->pmesh->three_d) {
-    scr_size = ScrArray2D<Real>::shmem_size(nvars, ncells1) * 3;
+    scr_size = ScrArray2D<Real>::shmem_size(nvars, ncells1) * (2*flux_tile_x3 + 1);
     auto &flx3_ = uflx.x3f;
 
     // set the loop limits
     il = is, iu = ie, jl = js, ju = je, kl = ks-1, ku = ke+1;
     if (use_fofc) { il = is-1, iu = ie+1, jl = js-1, ju = je+1, kl = ks-2, ku = ke+2; }
 
-    par_for_outer("hflux_x3",DevExeSpace(), scr_size, scr_level, 0, nmb1, jl, ju,
-    KOKKOS_LAMBDA(TeamMember_t member, const int m, const int j) {
-      ScrArray2D<Real> scr1(member.team_scratch(scr_level), nvars, ncells1);
-      ScrArray2D<Real> scr2(member.team_scratch(scr_level), nvars, ncells1);
+    // each team advances a tile of (up to) flux_tile_x3 adjacent pencils through k
+    // together so that stencil planes are read contiguously (see athena.hpp)
+    int njtile = (ju - jl + flux_tile_x3)/flux_tile_x3;
+
+    par_for_outer("hflux_x3",exec, scr_size, scr_level, 0, nmb1, 0, njtile-1,
+    KOKKOS_LAMBDA(TeamMember_t member, const int m, const int jt) {
+      if (use_q && (qflag_.d_view(m) != 0)) {return;}
+      const int jtl = jl + jt*flux_tile_x3;
+      const int jtu = (jtl + flux_tile_x3 - 1 < ju)? (jtl + flux_tile_x3 - 1) : ju;
+      ScrArray2D<Real> scr1[flux_tile_x3], scr2[flux_tile_x3];
+      for (int jj=0; jj<=(jtu-jtl); ++jj) {
+        scr1[jj] = ScrArray2D<Real>(member.team_scratch(scr_level), nvars, ncells1);
+        scr2[jj] = ScrArray2D<Real>(member.team_scratch(scr_level), nvars, ncells1);
+      }
       ScrArray2D<Real> scr3(member.team_scratch(scr_level), nvars, ncells1);
 
       for (int k=kl; k<=ku; ++k) {
+      for (int j=jtl; j<=jtu; ++j) {
         // Permute scratch arrays.
-        auto wl     = scr1;
-        auto wl_kp1 = scr2;
+        auto wl     = scr1[j-jtl];
+        auto wl_kp1 = scr2[j-jtl];
         auto wr     = scr3;
         if ((k%2) == 0) {
-          wl     = scr2;
-          wl_kp1 = scr1;
+          wl     = scr2[j-jtl];
+          wl_kp1 = scr1[j-jtl];
         }
 
         // Reconstruct qR[k] and qL[k+1]
-        switch (recon_method_) {
-          case ReconstructionMethod::dc:
-            DonorCellX3(member, m, k, j, il, iu, w0_, wl_kp1, wr);
-            break;
-          case ReconstructionMethod::plm:
-            PiecewiseLinearX3(member, m, k, j, il, iu, w0_, wl_kp1, wr);
-            break;
-          case ReconstructionMethod::ppm4:
-          case ReconstructionMethod::ppmx:
-            PiecewiseParabolicX3(member,eos_,extrema,true,m,k,j,il,iu, w0_, wl_kp1, wr);
-            break;
-          case ReconstructionMethod::wenoz:
-            WENOZX3(member, eos_, true, m, k, j, il, iu, w0_, wl_kp1, wr);
-            break;
-          default:
-            break;
+        if constexpr (recon_method_ == ReconstructionMethod::dc) {
+          DonorCellX3(member, m, k, j, il, iu, w0_, wl_kp1, wr);
+        } else if constexpr (recon_method_ == ReconstructionMethod::plm) {
+          PiecewiseLinearX3(member, eos_, m, k, j, il, iu, w0_, wl_kp1, wr);
+        } else if constexpr (recon_method_ == ReconstructionMethod::ppm4 ||
+                             recon_method_ == ReconstructionMethod::ppmx) {
+          PiecewiseParabolicX3(member,eos_,extrema,true,m,k,j,il,iu, w0_, wl_kp1, wr);
+        } else if constexpr (recon_method_ == ReconstructionMethod::wenoz) {
+          WENOZX3(member, eos_, true, m, k, j, il, iu, w0_, wl_kp1, wr);
+        } else if constexpr (recon_method_ == ReconstructionMethod::wenoza) {
+          WENOZAX3(member, eos_, true, m, k, j, il, iu, w0_, wl_kp1, wr);
         }
         member.team_barrier();
 
@@ -304,13 +408,16 @@ void Hydro::CalculateFluxes(Driver *pdriver, int stage) {
           if constexpr (rsolver_method_ == Hydro_RSolver::advect) {
             Advect(member, eos, indcs, size, coord, m, k, j, il, iu, IVZ, wl, wr, flx3);
           } else if constexpr (rsolver_method_ == Hydro_RSolver::llf) {
-            LLF(member, eos, indcs, size, coord, m, k, j, il, iu, IVZ, wl, wr, flx3);
+            LLF<is_ideal_>(member, eos, indcs, size, coord,
+                     m, k, j, il, iu, IVZ, wl, wr, flx3);
           } else if constexpr (rsolver_method_ == Hydro_RSolver::hlle) {
-            HLLE(member, eos, indcs, size, coord, m, k, j, il, iu, IVZ, wl, wr, flx3);
+            HLLE<is_ideal_>(member, eos, indcs, size, coord,
+                      m, k, j, il, iu, IVZ, wl, wr, flx3);
           } else if constexpr (rsolver_method_ == Hydro_RSolver::hllc) {
             HLLC(member, eos, indcs, size, coord, m, k, j, il, iu, IVZ, wl, wr, flx3);
           } else if constexpr (rsolver_method_ == Hydro_RSolver::roe) {
-            Roe(member, eos, indcs, size, coord, m, k, j, il, iu, IVZ, wl, wr, flx3);
+            Roe<is_ideal_>(member, eos, indcs, size, coord,
+                    m, k, j, il, iu, IVZ, wl, wr, flx3);
           } else if constexpr (rsolver_method_ == Hydro_RSolver::llf_sr) {
             LLF_SR(member, eos, indcs, size, coord, m, k, j, il, iu, IVZ, wl, wr, flx3);
           } else if constexpr (rsolver_method_ == Hydro_RSolver::hlle_sr) {
@@ -337,6 +444,40 @@ void Hydro::CalculateFluxes(Driver *pdriver, int stage) {
             });
           }
         }
+
+        // add viscous fluxes over the same faces covered by the standalone kernel
+        if constexpr (add_visc_) {
+          if ((k >= ks) && (k <= ke+1) && (j >= js) && (j <= je)) {
+            const Real dx1 = size_.d_view(m).dx1;
+            const Real dx2 = size_.d_view(m).dx2;
+            const Real dx3 = size_.d_view(m).dx3;
+            par_for_inner(member, is, ie, [&](const int i) {
+              // [(dVx/dz+dVz/dx), (dVy/dz+dVz/dy), 2(dVz/dz)-(2/3)(dVx/dx+dVy/dy+dVz/dz)]
+              Real fvx = (w0_(m,IVX,k,j,i  ) - w0_(m,IVX,k-1,j,i  ))/dx3 +
+                        ((w0_(m,IVZ,k,j,i+1) + w0_(m,IVZ,k-1,j,i+1)) -
+                         (w0_(m,IVZ,k,j,i-1) + w0_(m,IVZ,k-1,j,i-1)))/(4.0*dx1);
+              Real fvy = (w0_(m,IVY,k,j,i  ) - w0_(m,IVY,k-1,j,i  ))/dx3 +
+                        ((w0_(m,IVZ,k,j+1,i) + w0_(m,IVZ,k-1,j+1,i)) -
+                         (w0_(m,IVZ,k,j-1,i) + w0_(m,IVZ,k-1,j-1,i)))/(4.0*dx2);
+              Real fvz = (w0_(m,IVZ,k,j,i) - w0_(m,IVZ,k-1,j,i))*4.0/(3.0*dx3) -
+                        ((w0_(m,IVX,k,j,i+1) + w0_(m,IVX,k-1,j,i+1)) -
+                         (w0_(m,IVX,k,j,i-1) + w0_(m,IVX,k-1,j,i-1)))/(6.0*dx1) -
+                        ((w0_(m,IVY,k,j+1,i) + w0_(m,IVY,k-1,j+1,i)) -
+                         (w0_(m,IVY,k,j-1,i) + w0_(m,IVY,k-1,j-1,i)))/(6.0*dx2);
+              Real nud = 0.5*nu_*(w0_(m,IDN,k,j,i) + w0_(m,IDN,k-1,j,i));
+              flx3_(m,IVX,k,j,i) -= nud*fvx;
+              flx3_(m,IVY,k,j,i) -= nud*fvy;
+              flx3_(m,IVZ,k,j,i) -= nud*fvz;
+              if constexpr (is_ideal_) {
+                flx3_(m,IEN,k,j,i) -=
+                    0.5*nud*((w0_(m,IVX,k-1,j,i) + w0_(m,IVX,k,j,i))*fvx +
+                             (w0_(m,IVY,k-1,j,i) + w0_(m,IVY,k,j,i))*fvy +
+                             (w0_(m,IVZ,k-1,j,i) + w0_(m,IVZ,k,j,i))*fvz);
+              }
+            });
+          }
+        }
+      } // end loop over j tile
       } // end loop over k
     });
   }
@@ -344,7 +485,81 @@ void Hydro::CalculateFluxes(Driver *pdriver, int stage) {
   return;
 }
 
-// function definitions for each template parameter
+//----------------------------------------------------------------------------------------
+//! \fn void Hydro::CalculateFluxes
+//! \brief Dispatch function templated over the RS, EOS branch, and viscous hook.
+//! Selects the reconstruction method at runtime (once per call) and invokes the
+//! specialized kernel.
+
+template <Hydro_RSolver rsolver_method_, bool is_ideal_, bool add_visc_>
+void Hydro::CalculateFluxes(Driver *pdriver, int stage) {
+  switch (recon_method) {
+    case ReconstructionMethod::dc:
+      CalculateFluxes<rsolver_method_, ReconstructionMethod::dc,
+                      is_ideal_, add_visc_>(pdriver, stage);
+      break;
+    case ReconstructionMethod::plm:
+      CalculateFluxes<rsolver_method_, ReconstructionMethod::plm,
+                      is_ideal_, add_visc_>(pdriver, stage);
+      break;
+    case ReconstructionMethod::ppm4:
+      CalculateFluxes<rsolver_method_, ReconstructionMethod::ppm4,
+                      is_ideal_, add_visc_>(pdriver, stage);
+      break;
+    case ReconstructionMethod::ppmx:
+      CalculateFluxes<rsolver_method_, ReconstructionMethod::ppmx,
+                      is_ideal_, add_visc_>(pdriver, stage);
+      break;
+    case ReconstructionMethod::wenoz:
+      CalculateFluxes<rsolver_method_, ReconstructionMethod::wenoz,
+                      is_ideal_, add_visc_>(pdriver, stage);
+      break;
+    case ReconstructionMethod::wenoza:
+      CalculateFluxes<rsolver_method_, ReconstructionMethod::wenoza,
+                      is_ideal_, add_visc_>(pdriver, stage);
+      break;
+    default:
+      break;
+  }
+  return;
+}
+
+//----------------------------------------------------------------------------------------
+//! \fn void Hydro::CalculateFluxes
+//! \brief Dispatch function templated over the RS only.  Enables the inline viscous
+//! flux hook when viscosity is active and not advanced with the operator-split STS
+//! integrator (which applies the standalone kernel in diffusion/viscosity.cpp instead),
+//! and selects the ideal-gas or isothermal EOS branch at compile time.  Only the
+//! non-relativistic solvers admit an isothermal EOS (checked at construction), so the
+//! isothermal instantiations are only generated for them.
+
+template <Hydro_RSolver rsolver_method_>
+void Hydro::CalculateFluxes(Driver *pdriver, int stage) {
+  const bool add_visc = ((pvisc != nullptr) && (!use_sts));
+  constexpr bool nonrel = (rsolver_method_ == Hydro_RSolver::advect) ||
+                          (rsolver_method_ == Hydro_RSolver::llf) ||
+                          (rsolver_method_ == Hydro_RSolver::hlle) ||
+                          (rsolver_method_ == Hydro_RSolver::roe);
+  if constexpr (nonrel) {
+    if (!(peos->eos_data.is_ideal)) {
+      if (add_visc) {
+        CalculateFluxes<rsolver_method_, false, true>(pdriver, stage);
+      } else {
+        CalculateFluxes<rsolver_method_, false, false>(pdriver, stage);
+      }
+      return;
+    }
+  }
+  if (add_visc) {
+    CalculateFluxes<rsolver_method_, true, true>(pdriver, stage);
+  } else {
+    CalculateFluxes<rsolver_method_, true, false>(pdriver, stage);
+  }
+  return;
+}
+
+// function definitions for each template parameter.  Each dispatch function implicitly
+// instantiates the specialized kernels for all reconstruction methods and hook settings.
 template void Hydro::CalculateFluxes<Hydro_RSolver::advect>(Driver *pdriver, int stage);
 template void Hydro::CalculateFluxes<Hydro_RSolver::llf>(Driver *pdriver, int stage);
 template void Hydro::CalculateFluxes<Hydro_RSolver::hlle>(Driver *pdriver, int stage);
@@ -90,6 +90,8 @@ void Hydro::FOFC(Driver *pdriver, int stage) {
   auto &fofc_ = fofc;
   auto &use_excise = pmy_pack->pcoord->coord_data.bh_excise;
   auto &excision_flux_ = pmy_pack->pcoord->excision_flux;
+  auto &mb_excised_ = pmy_pack->pcoord->mb_excised;
+  auto &mb_all_excised_ = pmy_pack->pcoord->mb_all_excised;
   auto &w0_ = w0;
 
   // Index bounds
@@ -97,22 +99,70 @@ void Hydro::FOFC(Driver *pdriver, int stage) {
   if (multi_d) { jl = js-1, ju = je+1; }
   if (three_d) { kl = ks-1, ku = ke+1; }
 
-  // Now replace fluxes with first-order LLF fluxes for any cell where floors needed (if
-  // using FOFC) and/or for any cell about the excision (if GR+excising)
-  par_for("FOFC-flx", DevExeSpace(), 0, nmb-1, kl, ku, jl, ju, il, iu,
+  // Pack-level early-out: in smooth flows no cell is ever flagged, so a cheap scan of
+  // the packed flag words (64 cells per word) avoids building the list at all.  Not
+  // applicable when excision can flag cells independently of the FOFC bits.
+  if (use_fofc && !(is_gr && use_excise)) {
+    if (!fofc.AnySet()) { return; }
+  }
+
+  // Build compacted list of cells where floors needed (if using FOFC) and/or cells about
+  // the excision (if GR+excising), so that the flux-replacement kernel below only does
+  // work proportional to the number of flagged cells (usually a small fraction of grid)
+  int ncells1 = nx1 + 2*(indcs.ng);
+  int ncells2 = (nx2 > 1)? (nx2 + 2*(indcs.ng)) : 1;
+  int ncells3 = (nx3 > 1)? (nx3 + 2*(indcs.ng)) : 1;
+  auto &flist_ = fofc_list;
+  auto &nflist_ = nfofc;
+  Kokkos::deep_copy(nflist_, 0);
+  par_for("FOFC-list", DevExeSpace(), 0, nmb-1, kl, ku, jl, ju, il, iu,
   KOKKOS_LAMBDA(const int m, const int k, const int j, const int i) {
     // Check for FOFC flag
     bool fofc_flag = false;
-    if (use_fofc_) { fofc_flag = fofc_(m,k,j,i); }
+    if (use_fofc_) { fofc_flag = fofc_.Test(m,k,j,i); }
 
     // Check for GR + excision
     bool fofc_excision = false;
     if (is_gr) {
-      if (use_excise) { fofc_excision = excision_flux_(m,k,j,i); }
+      if (use_excise && mb_excised_(m)) {
+        fofc_excision = mb_all_excised_(m) || excision_flux_(m,k,j,i);
+      }
     }
 
-    // Apply FOFC
     if (fofc_flag || fofc_excision) {
+      int indx = Kokkos::atomic_fetch_add(&nflist_(0), 1);
+      flist_(indx) = i + ncells1*(j + ncells2*(k + ncells3*m));
+    }
+  });
+
+  // copy number of flagged cells to host; if no cells flagged there is no work to do
+  HostArray1D<int> nflist_h("nfofc_h", 1);
+  Kokkos::deep_copy(nflist_h, nflist_);
+  int nflagged = nflist_h(0);
+  if (nflagged == 0) { return; }
+
+  // Now replace fluxes with first-order LLF fluxes on faces of all flagged cells.
+  // Flagged cells are processed in batches, one batch per team with one cell per vector
+  // lane, and each direction in its own inner loop so every lane executes the same
+  // straight-line single-state solver body.  On CPU backends the TeamVectorRange inner
+  // loops emit simd loops the compiler can auto-vectorize across interfaces; on GPU the
+  // mapping to threads is unchanged.
+  const int fofc_batch = 32;
+  const int nbatch = (nflagged + fofc_batch - 1)/fofc_batch;
+  par_for_outer("FOFC-flx", DevExeSpace(), 0, 0, 0, nbatch-1,
+  KOKKOS_LAMBDA(TeamMember_t tmember, const int b) {
+    const int nlane = (fofc_batch < (nflagged - b*fofc_batch))?
+                       fofc_batch : (nflagged - b*fofc_batch);
+
+    // replace x1-fluxes at i and i+1
+    par_for_inner(tmember, 0, nlane-1, [&](const int l) {
+      // decode (m,k,j,i) indices of flagged cell
+      int cell = flist_(b*fofc_batch + l);
+      const int i = cell%ncells1;
+      const int j = (cell/ncells1)%ncells2;
+      const int k = (cell/(ncells1*ncells2))%ncells3;
+      const int m = cell/(ncells1*ncells2*ncells3);
+
       // replace x1-flux at i
       // load left state
       HydPrim1D wim1;
@@ -194,7 +244,21 @@ void Hydro::FOFC(Driver *pdriver, int stage) {
       flx1(m,IM3,k,j,i+1) = flux.mz;
       if (eos.is_ideal) {flx1(m,IEN,k,j,i+1) = flux.e;}
 
-      if (multi_d) {
+      // reset FOFC flag (do not reset excision flag)
+      if (use_fofc_) { fofc_.Clear(m,k,j,i); }
+    });
+
+    // replace x2-fluxes at j and j+1
+    if (multi_d) {
+      par_for_inner(tmember, 0, nlane-1, [&](const int l) {
+        // decode (m,k,j,i) indices of flagged cell
+        int cell = flist_(b*fofc_batch + l);
+        const int i = cell%ncells1;
+        const int j = (cell/ncells1)%ncells2;
+        const int k = (cell/(ncells1*ncells2))%ncells3;
+        const int m = cell/(ncells1*ncells2*ncells3);
+        HydCons1D flux;
+
         // replace x2-flux at j
         // load left state, permutting components of vectors
         HydPrim1D wjm1;
@@ -275,9 +339,20 @@ void Hydro::FOFC(Driver *pdriver, int stage) {
         flx2(m,IM3,k,j+1,i) = flux.my;
         flx2(m,IM1,k,j+1,i) = flux.mz;
         if (eos.is_ideal) {flx2(m,IEN,k,j+1,i) = flux.e;}
-      }
+      });
+    }
+
+    // replace x3-fluxes at k and k+1
+    if (three_d) {
+      par_for_inner(tmember, 0, nlane-1, [&](const int l) {
+        // decode (m,k,j,i) indices of flagged cell
+        int cell = flist_(b*fofc_batch + l);
+        const int i = cell%ncells1;
+        const int j = (cell/ncells1)%ncells2;
+        const int k = (cell/(ncells1*ncells2))%ncells3;
+        const int m = cell/(ncells1*ncells2*ncells3);
+        HydCons1D flux;
 
-      if (three_d) {
         // replace x3-flux at k
         // load left state, permutting components of vectors
         HydPrim1D wkm1;
@@ -358,10 +433,7 @@ void Hydro::FOFC(Driver *pdriver, int stage) {
         flx3(m,IM1,k+1,j,i) = flux.my;
         flx3(m,IM2,k+1,j,i) = flux.mz;
         if (eos.is_ideal) {flx3(m,IEN,k+1,j,i) = flux.e;}
-      }
-
-      // reset FOFC flag (do not reset excision flag)
-      if (use_fofc_ && fofc_flag) { fofc_(m,k,j,i) = false; }
+      });
     }
   });
 
@@ -0,0 +1,220 @@
+//========================================================================================
+// AthenaK astrophysical fluid dynamics and numerical relativity code
+// Copyright(C) 2020 James M. Stone <jmstone@ias.edu> and the Athena code team
+// Licensed under the 3-clause BSD License (the "LICENSE")
+//========================================================================================
+//! \file hydro_sts.cpp
+//! \brief Task list functions that advance diffusion terms (viscosity, thermal
+//! conduction) with the RKL2 super-time-stepping (STS) method of Meyer, Balsara, &
+//! Aslam (2014), operator-split from the main RK integrator.  Each STS stage computes
+//! only the diffusive fluxes and updates the conserved variables with the RKL2
+//! recursion; boundary communication, physical BCs, and ConsToPrim reuse the regular
+//! task list functions.  The number of stages (s) is set each cycle by the Driver from
+//! the ratio of the advective to the diffusive timestep.
+
+#include <iostream>
+
+#include "athena.hpp"
+#include "mesh/mesh.hpp"
+#include "driver/driver.hpp"
+#include "eos/eos.hpp"
+#include "diffusion/viscosity.hpp"
+#include "diffusion/conduction.hpp"
+#include "hydro.hpp"
+
+namespace hydro {
+//----------------------------------------------------------------------------------------
+//! \fn void STSCoefficients()
+//! \brief Computes RKL2 coefficients for given stage 1 <= j <= s (Meyer, Balsara, &
+//! Aslam (2014), Section 2.2), used in the recursion
+//!    Y_j = mu*Y_{j-1} + nu*Y_{j-2} + (1 - mu - nu)*Y_0
+//!          + mu_tilde*dt*M(Y_{j-1}) + gam_tilde*dt*M(Y_0)
+//! Stage 1 is cast in the same form by setting mu=1, nu=0, gam_tilde=0, which reduces
+//! to Y_1 = Y_0 + mu_tilde*dt*M(Y_0) since all registers hold Y_0 at the first stage.
+
+static void STSCoefficients(const int stage, const int s, Real &mu, Real &nu,
+                            Real &mu_tilde, Real &gam_tilde) {
+  Real w1 = 4.0/(static_cast<Real>(s*s + s - 2));
+  if (stage == 1) {
+    mu = 1.0;
+    nu = 0.0;
+    mu_tilde = w1/3.0;  // = b_1*w1 with b_1 = 1/3
+    gam_tilde = 0.0;
+  } else {
+    int j = stage;
+    // b_j = 1/3 for j < 2, else (j^2 + j - 2)/(2j(j+1))
+    Real bj   = (SQR(j) + j - 2.0)/(2.0*j*(j + 1.0));
+    Real bjm1 = (j > 2)? (SQR(j-1) + j - 3.0)/(2.0*(j - 1.0)*j) : 1.0/3.0;
+    Real bjm2 = (j > 3)? (SQR(j-2) + j - 4.0)/(2.0*(j - 2.0)*(j - 1.0)) : 1.0/3.0;
+    mu = ((2.0*j - 1.0)/j)*(bj/bjm1);
+    nu = -((j - 1.0)/j)*(bj/bjm2);
+    mu_tilde = w1*mu;
+    gam_tilde = -(1.0 - bjm1)*mu_tilde;
+  }
+  return;
+}
+
+//----------------------------------------------------------------------------------------
+//! \fn TaskStatus Hydro::STSInitRecv
+//! \brief Task list function to post non-blocking receives for U (and with SMR/AMR for
+//! fluxes of U) before each STS stage.  Unlike InitRecv, never posts receives for
+//! orbital advection or shearing box communication (not used with STS).
+
+TaskStatus Hydro::STSInitRecv(Driver *pdrive, int stage) {
+  // post receives for U
+  TaskStatus tstat = pbval_u->InitRecv(nhydro+nscalars);
+  if (tstat != TaskStatus::complete) return tstat;
+
+  // with SMR/AMR post receives for fluxes of U
+  if (pmy_pack->pmesh->multilevel) {
+    tstat = pbval_u->InitFluxRecv(nhydro+nscalars);
+  }
+  return tstat;
+}
+
+//----------------------------------------------------------------------------------------
+//! \fn TaskStatus Hydro::STSFluxes
+//! \brief Task list function that computes ONLY the diffusive fluxes of the conserved
+//! variables from the current primitives.  Fluxes are zeroed first since the diffusion
+//! functions sum into the flux arrays.
+
+TaskStatus Hydro::STSFluxes(Driver *pdriver, int stage) {
+  // zero fluxes over directions used by this problem
+  Kokkos::deep_copy(DevExeSpace(), uflx.x1f, 0.0);
+  if (pmy_pack->pmesh->multi_d) {
+    Kokkos::deep_copy(DevExeSpace(), uflx.x2f, 0.0);
+  }
+  if (pmy_pack->pmesh->three_d) {
+    Kokkos::deep_copy(DevExeSpace(), uflx.x3f, 0.0);
+  }
+
+  // sum diffusive fluxes, computed from primitives
+  if (pvisc != nullptr) {
+    pvisc->IsotropicViscousFlux(w0, pvisc->nu, peos->eos_data, uflx);
+  }
+  if (pcond != nullptr) {
+    pcond->AddHeatFlux(w0, peos->eos_data, uflx);
+  }
+
+  return TaskStatus::complete;
+}
+
+//----------------------------------------------------------------------------------------
+//! \fn TaskStatus Hydro::STSRKUpdate
+//! \brief Update of conserved variables for each stage of the RKL2 recursion.  Uses u0
+//! as Y_{j-1}, u1 as Y_{j-2} (free outside the main integrator stages), and u_sts as
+//! Y_0.  The diffusive flux divergence at Y_0 is saved in divf_sts at the first stage
+//! and reused at all later stages.
+
+TaskStatus Hydro::STSRKUpdate(Driver *pdriver, int stage) {
+  auto &indcs = pmy_pack->pmesh->mb_indcs;
+  int is = indcs.is, ie = indcs.ie;
+  int js = indcs.js, je = indcs.je;
+  int ks = indcs.ks, ke = indcs.ke;
+  int ncells1 = indcs.nx1 + 2*(indcs.ng);
+  bool &multi_d = pmy_pack->pmesh->multi_d;
+  bool &three_d = pmy_pack->pmesh->three_d;
+
+  // compute RKL2 coefficients for this stage
+  Real mu, nu, mu_tilde, gam_tilde;
+  STSCoefficients(stage, pdriver->nsts_stages, mu, nu, mu_tilde, gam_tilde);
+  Real &dt = pmy_pack->pmesh->dt;
+
+  // at the first stage all registers hold Y_0
+  bool first_stage = (stage == 1);
+  if (first_stage) {
+    Kokkos::deep_copy(DevExeSpace(), u_sts, u0);
+    Kokkos::deep_copy(DevExeSpace(), u1, u0);
+  }
+
+  int nmb1 = pmy_pack->nmb_thispack - 1;
+  int nvar = nhydro + nscalars;
+  auto u0_ = u0;
+  auto u1_ = u1;
+  auto usts_ = u_sts;
+  auto divf0_ = divf_sts;
+  auto flx1 = uflx.x1f;
+  auto flx2 = uflx.x2f;
+  auto flx3 = uflx.x3f;
+  auto &mbsize = pmy_pack->pmb->mb_size;
+
+  int scr_level = 0;
+  size_t scr_size = ScrArray1D<Real>::shmem_size(ncells1);
+
+  par_for_outer("sts_update",DevExeSpace(),scr_size,scr_level,0,nmb1,0,nvar-1,
+                ks,ke,js,je,
+  KOKKOS_LAMBDA(TeamMember_t member, const int m, const int n, const int k, const int j) {
+    ScrArray1D<Real> divf(member.team_scratch(scr_level), ncells1);
+
+    // compute dF1/dx1
+    par_for_inner(member, is, ie, [&](const int i) {
+      divf(i) = (flx1(m,n,k,j,i+1) - flx1(m,n,k,j,i))/mbsize.d_view(m).dx1;
+    });
+    member.team_barrier();
+
+    // Add dF2/dx2
+    if (multi_d) {
+      par_for_inner(member, is, ie, [&](const int i) {
+        divf(i) += (flx2(m,n,k,j+1,i) - flx2(m,n,k,j,i))/mbsize.d_view(m).dx2;
+      });
+      member.team_barrier();
+    }
+
+    // Add dF3/dx3
+    if (three_d) {
+      par_for_inner(member, is, ie, [&](const int i) {
+        divf(i) += (flx3(m,n,k+1,j,i) - flx3(m,n,k,j,i))/mbsize.d_view(m).dx3;
+      });
+      member.team_barrier();
+    }
+
+    par_for_inner(member, is, ie, [&](const int i) {
+      // at first stage save flux divergence at Y_0, reused at all later stages
+      if (first_stage) {
+        divf0_(m,n,k,j,i) = divf(i);
+      }
+      Real uold = u0_(m,n,k,j,i);
+      Real unew = mu*uold + nu*u1_(m,n,k,j,i) + (1.0 - mu - nu)*usts_(m,n,k,j,i)
+                - dt*(mu_tilde*divf(i) + gam_tilde*divf0_(m,n,k,j,i));
+      u1_(m,n,k,j,i) = uold;
+      u0_(m,n,k,j,i) = unew;
+    });
+  });
+  return TaskStatus::complete;
+}
+
+//----------------------------------------------------------------------------------------
+//! \fn TaskStatus Hydro::STSClearSend
+//! \brief Task list function that checks sends of U (and with SMR/AMR of fluxes of U)
+//! have completed after each STS stage
+
+TaskStatus Hydro::STSClearSend(Driver *pdrive, int stage) {
+  // check sends of U complete
+  TaskStatus tstat = pbval_u->ClearSend();
+  if (tstat != TaskStatus::complete) return tstat;
+
+  // with SMR/AMR check sends of restricted fluxes of U complete
+  if (pmy_pack->pmesh->multilevel) {
+    tstat = pbval_u->ClearFluxSend();
+  }
+  return tstat;
+}
+
+//----------------------------------------------------------------------------------------
+//! \fn TaskStatus Hydro::STSClearRecv
+//! \brief Task list function that checks receives of U (and with SMR/AMR of fluxes of
+//! U) have completed after each STS stage
+
+TaskStatus Hydro::STSClearRecv(Driver *pdrive, int stage) {
+  // check receives of U complete
+  TaskStatus tstat = pbval_u->ClearRecv();
+  if (tstat != TaskStatus::complete) return tstat;
+
+  // with SMR/AMR check receives of restricted fluxes of U complete
+  if (pmy_pack->pmesh->multilevel) {
+    tstat = pbval_u->ClearFluxRecv();
+  }
+  return tstat;
+}
+
+} // namespace hydro
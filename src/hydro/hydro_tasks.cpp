@@ -48,32 +48,130 @@ void Hydro::AssembleHydroTasks(std::map<std::string, std::shared_ptr<TaskList>>
   TaskID none(0);
 
   // assemble "before_stagen" task list
-  id.irecv = tl["before_stagen"]->AddTask(&Hydro::InitRecv, this, none);
+  id.irecv = tl["before_stagen"]->AddTask(&Hydro::InitRecv, this, none,
+                                          "Hydro::InitRecv");
 
   // assemble "stagen" task list
-  id.copyu     = tl["stagen"]->AddTask(&Hydro::CopyCons, this, none);
-  id.flux      = tl["stagen"]->AddTask(&Hydro::Fluxes,this,id.copyu);
-  id.sendf     = tl["stagen"]->AddTask(&Hydro::SendFlux, this, id.flux);
-  id.recvf     = tl["stagen"]->AddTask(&Hydro::RecvFlux, this, id.sendf);
-  id.rkupdt    = tl["stagen"]->AddTask(&Hydro::RKUpdate, this, id.recvf);
-  id.srctrms   = tl["stagen"]->AddTask(&Hydro::HydroSrcTerms, this, id.rkupdt);
-  id.sendu_oa  = tl["stagen"]->AddTask(&Hydro::SendU_OA, this, id.srctrms);
-  id.recvu_oa  = tl["stagen"]->AddTask(&Hydro::RecvU_OA, this, id.sendu_oa);
-  id.restu     = tl["stagen"]->AddTask(&Hydro::RestrictU, this, id.recvu_oa);
-  id.sendu     = tl["stagen"]->AddTask(&Hydro::SendU, this, id.restu);
-  id.recvu     = tl["stagen"]->AddTask(&Hydro::RecvU, this, id.sendu);
-  id.sendu_shr = tl["stagen"]->AddTask(&Hydro::SendU_Shr, this, id.recvu);
-  id.recvu_shr = tl["stagen"]->AddTask(&Hydro::RecvU_Shr, this, id.sendu_shr);
-  id.bcs       = tl["stagen"]->AddTask(&Hydro::ApplyPhysicalBCs, this, id.recvu_shr);
-  id.prol      = tl["stagen"]->AddTask(&Hydro::Prolongate, this, id.bcs);
-  id.c2p       = tl["stagen"]->AddTask(&Hydro::ConToPrim, this, id.prol);
-  id.newdt     = tl["stagen"]->AddTask(&Hydro::NewTimeStep, this, id.c2p);
+  // Fluxes and RKUpdate launch all their kernels through Driver::ExecSpace(), so they
+  // can be launched asynchronously on a non-default stream with '<time> nstreams > 1'.
+  // Only safe when no extra physics launches kernels on the default instance inside
+  // these tasks (diffusion, FOFC, excision).
+  bool async = (pvisc == nullptr) && (pcond == nullptr) && (!use_fofc) &&
+               (!(pmy_pack->pcoord->is_general_relativistic));
+  id.copyu     = tl["stagen"]->AddTask(&Hydro::CopyCons, this, none, "Hydro::CopyCons");
+  id.flux      = tl["stagen"]->AddTask(&Hydro::Fluxes, this, id.copyu,
+                                       "Hydro::Fluxes", async);
+  // flux-correction tasks are only inserted with SMR/AMR; on uniform grids they would
+  // be no-ops cycled by the scheduler every stage
+  if (pmy_pack->pmesh->multilevel) {
+    id.sendf   = tl["stagen"]->AddTask(&Hydro::SendFlux, this, id.flux,
+                                       "Hydro::SendFlux");
+    id.recvf   = tl["stagen"]->AddTask(&Hydro::RecvFlux, this, id.sendf,
+                                       "Hydro::RecvFlux");
+  } else {
+    id.sendf = id.flux;
+    id.recvf = id.flux;
+  }
+  id.rkupdt    = tl["stagen"]->AddTask(&Hydro::RKUpdate, this, id.recvf,
+                                       "Hydro::RKUpdate", async);
+  id.srctrms   = tl["stagen"]->AddTask(&Hydro::HydroSrcTerms, this, id.rkupdt,
+                                       "Hydro::HydroSrcTerms");
+  id.sendu_oa  = tl["stagen"]->AddTask(&Hydro::SendU_OA, this, id.srctrms,
+                                       "Hydro::SendU_OA");
+  id.recvu_oa  = tl["stagen"]->AddTask(&Hydro::RecvU_OA, this, id.sendu_oa,
+                                       "Hydro::RecvU_OA");
+  // restriction/prolongation tasks are likewise only inserted with SMR/AMR; on uniform
+  // grids they would be no-ops cycled by the scheduler every stage
+  if (pmy_pack->pmesh->multilevel) {
+    id.restu   = tl["stagen"]->AddTask(&Hydro::RestrictU, this, id.recvu_oa,
+                                       "Hydro::RestrictU");
+  } else {
+    id.restu = id.recvu_oa;
+  }
+  id.sendu     = tl["stagen"]->AddTask(&Hydro::SendU, this, id.restu, "Hydro::SendU");
+  // interior cells are converted while boundary messages for u are in flight; the ghost
+  // zones are converted separately once receives and prolongation have completed
+  id.c2p_int   = tl["stagen"]->AddTask(&Hydro::ConToPrimInterior, this, id.sendu,
+                                       "Hydro::ConToPrimInterior");
+  id.recvu     = tl["stagen"]->AddTask(&Hydro::RecvU, this, id.sendu, "Hydro::RecvU");
+  id.sendu_shr = tl["stagen"]->AddTask(&Hydro::SendU_Shr, this, id.recvu,
+                                       "Hydro::SendU_Shr");
+  id.recvu_shr = tl["stagen"]->AddTask(&Hydro::RecvU_Shr, this, id.sendu_shr,
+                                       "Hydro::RecvU_Shr");
+  id.bcs       = tl["stagen"]->AddTask(&Hydro::ApplyPhysicalBCs, this, id.recvu_shr,
+                                       "Hydro::ApplyPhysicalBCs");
+  if (pmy_pack->pmesh->multilevel) {
+    id.prol    = tl["stagen"]->AddTask(&Hydro::Prolongate, this, id.bcs,
+                                       "Hydro::Prolongate");
+  } else {
+    id.prol = id.bcs;
+  }
+  TaskID c2p_dep = (id.prol | id.c2p_int);
+  id.c2p       = tl["stagen"]->AddTask(&Hydro::ConToPrimGhosts, this, c2p_dep,
+                                       "Hydro::ConToPrimGhosts");
+  id.newdt     = tl["stagen"]->AddTask(&Hydro::NewTimeStep, this, id.c2p,
+                                       "Hydro::NewTimeStep");
+
+  // assemble "after_timeintegrator" task list
+  // subcycled cooling is operator-split from the integrator, applied once per cycle
+  if (psrc->ism_cooling && psrc->ism_cool_subcycle) {
+    id.coolsub = tl["after_timeintegrator"]->AddTask(&Hydro::CoolingSubcycle, this, none,
+                                                     "Hydro::CoolingSubcycle");
+  }
 
   // assemble "after_stagen" task list
-  id.csend = tl["after_stagen"]->AddTask(&Hydro::ClearSend, this, none);
+  id.csend = tl["after_stagen"]->AddTask(&Hydro::ClearSend, this, none,
+                                         "Hydro::ClearSend");
   // although RecvFlux/U functions check that all recvs complete, add ClearRecv to
   // task list anyways to catch potential bugs in MPI communication logic
-  id.crecv = tl["after_stagen"]->AddTask(&Hydro::ClearRecv, this, id.csend);
+  id.crecv = tl["after_stagen"]->AddTask(&Hydro::ClearRecv, this, id.csend,
+                                         "Hydro::ClearRecv");
+
+  // assemble "sts_*" task lists, used to advance diffusion terms with RKL2
+  // super-time-stepping, operator-split from the main integrator
+  if (use_sts) {
+    id.sts_irecv  = tl["sts_before_stagen"]->AddTask(&Hydro::STSInitRecv, this, none,
+                                                     "Hydro::STSInitRecv");
+
+    id.sts_flux   = tl["sts_stagen"]->AddTask(&Hydro::STSFluxes, this, none,
+                                              "Hydro::STSFluxes");
+    if (pmy_pack->pmesh->multilevel) {
+      id.sts_sendf = tl["sts_stagen"]->AddTask(&Hydro::SendFlux, this, id.sts_flux,
+                                               "Hydro::SendFlux");
+      id.sts_recvf = tl["sts_stagen"]->AddTask(&Hydro::RecvFlux, this, id.sts_sendf,
+                                               "Hydro::RecvFlux");
+    } else {
+      id.sts_sendf = id.sts_flux;
+      id.sts_recvf = id.sts_flux;
+    }
+    id.sts_rkupdt = tl["sts_stagen"]->AddTask(&Hydro::STSRKUpdate, this, id.sts_recvf,
+                                              "Hydro::STSRKUpdate");
+    if (pmy_pack->pmesh->multilevel) {
+      id.sts_restu = tl["sts_stagen"]->AddTask(&Hydro::RestrictU, this, id.sts_rkupdt,
+                                               "Hydro::RestrictU");
+    } else {
+      id.sts_restu = id.sts_rkupdt;
+    }
+    id.sts_sendu  = tl["sts_stagen"]->AddTask(&Hydro::SendU, this, id.sts_restu,
+                                              "Hydro::SendU");
+    id.sts_recvu  = tl["sts_stagen"]->AddTask(&Hydro::RecvU, this, id.sts_sendu,
+                                              "Hydro::RecvU");
+    id.sts_bcs    = tl["sts_stagen"]->AddTask(&Hydro::ApplyPhysicalBCs,this,id.sts_recvu,
+                                              "Hydro::ApplyPhysicalBCs");
+    if (pmy_pack->pmesh->multilevel) {
+      id.sts_prol = tl["sts_stagen"]->AddTask(&Hydro::Prolongate, this, id.sts_bcs,
+                                              "Hydro::Prolongate");
+    } else {
+      id.sts_prol = id.sts_bcs;
+    }
+    id.sts_c2p    = tl["sts_stagen"]->AddTask(&Hydro::ConToPrim, this, id.sts_prol,
+                                              "Hydro::ConToPrim");
+
+    id.sts_csend  = tl["sts_after_stagen"]->AddTask(&Hydro::STSClearSend, this, none,
+                                                    "Hydro::STSClearSend");
+    id.sts_crecv  = tl["sts_after_stagen"]->AddTask(&Hydro::STSClearRecv, this,
+                                                    id.sts_csend, "Hydro::STSClearRecv");
+  }
 
   return;
 }
@@ -121,11 +219,44 @@ TaskStatus Hydro::InitRecv(Driver *pdrive, int stage) {
 //----------------------------------------------------------------------------------------
 //! \fn  void Hydro::CopyCons
 //! \brief Simple task list function that copies u0 --> u1 in first stage.  Extended to
-//!  handle RK register logic at given stage
+//!  handle RK register logic at given stage.  With quiescence detection, the copy is
+//!  fused with a reduction measuring the largest relative change in u0 since the
+//!  previous copy (i.e. over the last full step, including all source terms).
 
 TaskStatus Hydro::CopyCons(Driver *pdrive, int stage) {
   if (stage == 1) {
-    Kokkos::deep_copy(DevExeSpace(), u1, u0);
+    if (use_quiescence) {
+      // Ghost zones are included in the residual so that changes in neighboring MBs
+      // (which appear here through the boundary exchange) conservatively re-activate
+      // this MB before any disturbance can reach its interior.
+      auto &indcs = pmy_pack->pmesh->mb_indcs;
+      int n1 = indcs.nx1 + 2*indcs.ng;
+      int n2 = (indcs.nx2 > 1)? (indcs.nx2 + 2*indcs.ng) : 1;
+      int n3 = (indcs.nx3 > 1)? (indcs.nx3 + 2*indcs.ng) : 1;
+      int nmb1 = pmy_pack->nmb_thispack - 1;
+      int nvar = nhydro + nscalars;
+      auto u0_ = u0;
+      auto u1_ = u1;
+      auto qres_ = qres;
+      par_for_outer("qcopy_cons",DevExeSpace(),0,0,0,nmb1,0,(nvar-1),0,(n3-1),0,(n2-1),
+      KOKKOS_LAMBDA(TeamMember_t member,const int m,const int n,const int k,const int j) {
+        Real tres = 0.0;
+        Kokkos::parallel_reduce(Kokkos::TeamThreadRange(member, n1),
+        [&](const int i, Real &max_r) {
+          Real du = fabs(u0_(m,n,k,j,i) - u1_(m,n,k,j,i));
+          // normalize by |u| plus the local density so near-zero momenta stay finite
+          Real r = du/(fabs(u1_(m,n,k,j,i)) + fabs(u0_(m,IDN,k,j,i)));
+          max_r = fmax(max_r, r);
+          u1_(m,n,k,j,i) = u0_(m,n,k,j,i);
+        }, Kokkos::Max<Real>(tres));
+        Kokkos::single(Kokkos::PerTeam(member), [&]() {
+          Kokkos::atomic_fetch_max(&qres_(m), tres);
+        });
+      });
+      UpdateQuiescenceFlags();
+    } else {
+      Kokkos::deep_copy(DevExeSpace(), u1, u0);
+    }
   } else {
     if (pdrive->integrator == "rk4") {
       // parallel loop to update u1 with u0 at later stages, only for rk4
@@ -147,6 +278,29 @@ TaskStatus Hydro::CopyCons(Driver *pdrive, int stage) {
   return TaskStatus::complete;
 }
 
+//----------------------------------------------------------------------------------------
+//! \fn  void Hydro::UpdateQuiescenceFlags
+//! \brief Sets per-MB quiescence flags from the residuals measured in CopyCons().  MBs
+//! flagged quiescent skip the flux recompute in CalculateFluxes() this step and their
+//! stored fluxes are reused in RKUpdate().  Called once per step at the first stage.
+
+void Hydro::UpdateQuiescenceFlags() {
+  int nmb = pmy_pack->nmb_thispack;
+  // periodically force a full recompute on every MB as a safety net against slow
+  // secular drift accumulating below the per-step tolerance
+  bool force = ((pmy_pack->pmesh->ncycle % quiescence_ncycle) == 0);
+  auto qres_h = Kokkos::create_mirror_view(qres);
+  Kokkos::deep_copy(qres_h, qres);
+  for (int m=0; m<nmb; ++m) {
+    qflag.h_view(m) = (!force && (qres_h(m) <= quiescence_tol))? 1 : 0;
+  }
+  qflag.template modify<HostMemSpace>();
+  qflag.template sync<DevExeSpace>();
+  // reset residuals for accumulation over the next step
+  Kokkos::deep_copy(qres, 0.0);
+  return;
+}
+
 //----------------------------------------------------------------------------------------
 //! \fn TaskStatus Hydro::Fluxes
 //! \brief Wrapper task list function that calls everything necessary to compute fluxes
@@ -176,12 +330,12 @@ TaskStatus Hydro::Fluxes(Driver *pdrive, int stage) {
     CalculateFluxes<Hydro_RSolver::hlle_gr>(pdrive, stage);
   }
 
-  // Add viscous, heat-flux, etc fluxes
-  if (pvisc != nullptr) {
-    pvisc->IsotropicViscousFlux(w0, pvisc->nu, peos->eos_data, uflx);
-  }
-  if (pcond != nullptr) {
-    pcond->AddHeatFlux(w0, peos->eos_data, uflx);
+  // Add heat fluxes (unless advanced with operator-split STS).  Viscous fluxes are
+  // added inline by the CalculateFluxes kernels themselves (see hydro_fluxes.cpp).
+  if (!use_sts) {
+    if (pcond != nullptr) {
+      pcond->AddHeatFlux(w0, peos->eos_data, uflx);
+    }
   }
 
   // call FOFC if necessary
@@ -216,11 +370,13 @@ TaskStatus Hydro::SendFlux(Driver *pdrive, int stage) {
 //! conserved variables at fine/coarse boundaries
 
 TaskStatus Hydro::RecvFlux(Driver *pdrive, int stage) {
+  profiler::WaitTimer wtimer("hydro_recv_flux", stage);
   TaskStatus tstat = TaskStatus::complete;
   // Only execute BoundaryValues function with SMR/SMR
   if (pmy_pack->pmesh->multilevel) {
     tstat = pbval_u->RecvAndUnpackFluxCC(uflx);
   }
+  if (tstat == TaskStatus::complete) {wtimer.Completed();}
   return tstat;
 }
 
@@ -234,10 +390,15 @@ TaskStatus Hydro::HydroSrcTerms(Driver *pdrive, int stage) {
   Real beta_dt = (pdrive->beta[stage-1])*(pmy_pack->pmesh->dt);
 
   // Add source terms for various physics.  Must be computed from primitives.
-  if (psrc->const_accel)  psrc->ConstantAccel(w0, peos->eos_data,  beta_dt, u0);
-  if (psrc->ism_cooling)  psrc->ISMCooling(w0, peos->eos_data, beta_dt, u0);
-  if (psrc->rel_cooling)  psrc->RelCooling(w0, peos->eos_data, beta_dt, u0);
-  if (psrc->shearing_box) psrc->ShearingBox(w0, peos->eos_data, beta_dt, u0);
+  // When fused_srcterms=true these cell-local terms are applied in the RKUpdate kernel.
+  if (!fused_srcterms) {
+    if (psrc->const_accel)  psrc->ConstantAccel(w0, peos->eos_data,  beta_dt, u0);
+    if (psrc->ism_cooling && !psrc->ism_cool_subcycle) {
+      psrc->ISMCooling(w0, peos->eos_data, beta_dt, u0);
+    }
+    if (psrc->rel_cooling)  psrc->RelCooling(w0, peos->eos_data, beta_dt, u0);
+    if (psrc->shearing_box) psrc->ShearingBox(w0, peos->eos_data, beta_dt, u0);
+  }
 
   // Add coordinate source terms in GR.  Again, must be computed with only primitives.
   if (pmy_pack->pcoord->is_general_relativistic) {
@@ -252,6 +413,16 @@ TaskStatus Hydro::HydroSrcTerms(Driver *pdrive, int stage) {
   return TaskStatus::complete;
 }
 
+//----------------------------------------------------------------------------------------
+//! \fn TaskStatus Hydro::CoolingSubcycle
+//! \brief Wrapper task list function for operator-split subcycled cooling, applied once
+//! per cycle over the full timestep after the main integrator stages complete.
+
+TaskStatus Hydro::CoolingSubcycle(Driver *pdrive, int stage) {
+  psrc->ISMCoolingSubcycled(w0, peos->eos_data, pmy_pack->pmesh->dt, u0);
+  return TaskStatus::complete;
+}
+
 //----------------------------------------------------------------------------------------
 //! \fn TaskList Hydro::SendU_OA
 //! \brief Wrapper task list function to pack/send data for orbital advection
@@ -288,8 +459,11 @@ TaskStatus Hydro::RecvU_OA(Driver *pdrive, int stage) {
 
 TaskStatus Hydro::RestrictU(Driver *pdrive, int stage) {
   // Only execute Mesh function with SMR/SMR
+  // Restriction is limited to interface-adjacent cells; coarse data is only consumed by
+  // sends to coarser neighbors and prolongation stencils.  AMR events restrict the full
+  // volume themselves before de-refining.
   if (pmy_pack->pmesh->multilevel) {
-    pmy_pack->pmesh->pmr->RestrictCC(u0, coarse_u0);
+    pbval_u->RestrictInterfaceCC(u0, coarse_u0);
   }
   return TaskStatus::complete;
 }
@@ -308,7 +482,9 @@ TaskStatus Hydro::SendU(Driver *pdrive, int stage) {
 //! \brief Wrapper task list function to receive/unpack cell-centered conserved variables
 
 TaskStatus Hydro::RecvU(Driver *pdrive, int stage) {
+  profiler::WaitTimer wtimer("hydro_recv_u", stage);
   TaskStatus tstat = pbval_u->RecvAndUnpackCC(u0, coarse_u0);
+  if (tstat == TaskStatus::complete) {wtimer.Completed();}
   return tstat;
 }
 
@@ -390,6 +566,45 @@ TaskStatus Hydro::ConToPrim(Driver *pdrive, int stage) {
   return TaskStatus::complete;
 }
 
+//----------------------------------------------------------------------------------------
+//! \fn TaskList Hydro::ConToPrimInterior
+//! \brief Wrapper task list function to call ConsToPrim over interior cells only.
+//! Scheduled before the boundary receive tasks so the conversion overlaps with messages
+//! in flight; ghost zones are converted afterwards by ConToPrimGhosts.
+
+TaskStatus Hydro::ConToPrimInterior(Driver *pdrive, int stage) {
+  auto &indcs = pmy_pack->pmesh->mb_indcs;
+  peos->ConsToPrim(u0, w0, false, indcs.is, indcs.ie, indcs.js, indcs.je,
+                   indcs.ks, indcs.ke);
+  return TaskStatus::complete;
+}
+
+//----------------------------------------------------------------------------------------
+//! \fn TaskList Hydro::ConToPrimGhosts
+//! \brief Wrapper task list function to call ConsToPrim over ghost zones only, after
+//! boundary receives and prolongation complete.  The strips tile the ghost shell exactly
+//! once: x1-faces span the full x2/x3 extents, x2-faces span only the x1 interior, and
+//! x3-faces span only the x1/x2 interior.
+
+TaskStatus Hydro::ConToPrimGhosts(Driver *pdrive, int stage) {
+  auto &indcs = pmy_pack->pmesh->mb_indcs;
+  int &ng = indcs.ng;
+  int n1m1 = indcs.nx1 + 2*ng - 1;
+  int n2m1 = (indcs.nx2 > 1)? (indcs.nx2 + 2*ng - 1) : 0;
+  int n3m1 = (indcs.nx3 > 1)? (indcs.nx3 + 2*ng - 1) : 0;
+  peos->ConsToPrim(u0, w0, false, 0, (ng-1), 0, n2m1, 0, n3m1);
+  peos->ConsToPrim(u0, w0, false, (n1m1-ng+1), n1m1, 0, n2m1, 0, n3m1);
+  if (pmy_pack->pmesh->multi_d) {
+    peos->ConsToPrim(u0, w0, false, ng, (n1m1-ng), 0, (ng-1), 0, n3m1);
+    peos->ConsToPrim(u0, w0, false, ng, (n1m1-ng), (n2m1-ng+1), n2m1, 0, n3m1);
+  }
+  if (pmy_pack->pmesh->three_d) {
+    peos->ConsToPrim(u0, w0, false, ng, (n1m1-ng), ng, (n2m1-ng), 0, (ng-1));
+    peos->ConsToPrim(u0, w0, false, ng, (n1m1-ng), ng, (n2m1-ng), (n3m1-ng+1), n3m1);
+  }
+  return TaskStatus::complete;
+}
+
 //----------------------------------------------------------------------------------------
 //! \fn TaskList Hydro::ClearSend
 //! \brief Wrapper task list function that checks all MPI sends have completed. Used in
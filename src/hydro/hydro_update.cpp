@@ -7,27 +7,46 @@
 //! \brief Performs explicit update of Hydro conserved variables (u0) for each stage of
 //! the SSP RK integrators (e.g. RK1, RK2, RK3) implemented in AthenaK, using weighted
 //! average and partial time step update of flux divergence. Source terms are added in
-//! the HydroSrcTerms() function.
+//! the HydroSrcTerms() function, unless <hydro>/fused_srcterms=true, in which case
+//! cell-local source terms are applied inside the update kernel itself so that u0/w0
+//! are swept through memory only once.
 
 #include "athena.hpp"
 #include "mesh/mesh.hpp"
 #include "driver/driver.hpp"
 #include "eos/eos.hpp"
+#include "srcterms/srcterms.hpp"
+#include "srcterms/ismcooling.hpp"
+#include "units/units.hpp"
 #include "hydro.hpp"
 
 namespace hydro {
 //----------------------------------------------------------------------------------------
 //! \fn  void Hydro::Update
-//  \brief Explicit RK update including flux divergence terms
+//  \brief Explicit RK update including flux divergence terms.  Dispatches to the kernel
+//  specialized for this problem's dimensionality, so 1D/2D runs compile out the
+//  transverse flux-divergence terms instead of branching on them per cell
 
 TaskStatus Hydro::RKUpdate(Driver *pdriver, int stage) {
+  if (pmy_pack->pmesh->three_d) {
+    return RKUpdateDim<true,true>(pdriver, stage);
+  } else if (pmy_pack->pmesh->multi_d) {
+    return RKUpdateDim<true,false>(pdriver, stage);
+  }
+  return RKUpdateDim<false,false>(pdriver, stage);
+}
+
+//----------------------------------------------------------------------------------------
+//! \fn  void Hydro::RKUpdateDim
+//  \brief RK update kernel with dimensionality lifted to compile time
+
+template <bool MULTI_D, bool THREE_D>
+TaskStatus Hydro::RKUpdateDim(Driver *pdriver, int stage) {
   auto &indcs = pmy_pack->pmesh->mb_indcs;
   int is = indcs.is, ie = indcs.ie;
   int js = indcs.js, je = indcs.je;
   int ks = indcs.ks, ke = indcs.ke;
   int ncells1 = indcs.nx1 + 2*(indcs.ng);
-  bool &multi_d = pmy_pack->pmesh->multi_d;
-  bool &three_d = pmy_pack->pmesh->three_d;
 
   Real &gam0 = pdriver->gam0[stage-1];
   Real &gam1 = pdriver->gam1[stage-1];
@@ -41,13 +60,72 @@ TaskStatus Hydro::RKUpdate(Driver *pdriver, int stage) {
   auto flx3 = uflx.x3f;
   auto &mbsize = pmy_pack->pmb->mb_size;
 
+  // With fused source terms, capture flags and coefficients for each cell-local source
+  // term applied in the update kernel below.  The in-kernel expressions must be kept
+  // consistent with the corresponding functions in the SourceTerms class.
+  bool add_accel = false, add_ism_cool = false, add_rel_cool = false, add_sbox = false;
+  if (fused_srcterms) {
+    add_accel = psrc->const_accel;
+    add_ism_cool = psrc->ism_cooling && !(psrc->ism_cool_subcycle);
+    add_rel_cool = psrc->rel_cooling;
+    add_sbox = psrc->shearing_box;
+  }
+  auto w0_ = w0;
+  bool is_ideal = peos->eos_data.is_ideal;
+  bool use_e = peos->eos_data.use_e;
+  Real gm1 = peos->eos_data.gamma - 1.0;
+  // constant (gravitational) acceleration
+  Real accel_g = 0.0;
+  int accel_dir = 1;
+  if (add_accel) {
+    accel_g = psrc->const_accel_val;
+    accel_dir = psrc->const_accel_dir;
+  }
+  // ISM cooling/heating (cgs conversion factors, cf. SourceTerms::ISMCooling)
+  Real temp_unit = 1.0, cooling_unit = 1.0, gamma_heating = 0.0;
+  DualArray1D<Real> ism_ctab;
+  Real ism_logtmin = 0.0, ism_invdlogt = 1.0;
+  int ism_ntab = 2;
+  if (add_ism_cool) {
+    temp_unit = pmy_pack->punit->temperature_cgs();
+    Real n_unit = pmy_pack->punit->density_cgs()/pmy_pack->punit->mu()
+                  /pmy_pack->punit->atomic_mass_unit_cgs;
+    cooling_unit = pmy_pack->punit->pressure_cgs()/pmy_pack->punit->time_cgs()
+                   /n_unit/n_unit;
+    Real heating_unit = pmy_pack->punit->pressure_cgs()/pmy_pack->punit->time_cgs()
+                        /n_unit;
+    gamma_heating = (psrc->hrate)/heating_unit;
+    ism_ctab = psrc->ism_cool_table;
+    ism_logtmin = psrc->ism_logtmin;
+    ism_invdlogt = psrc->ism_invdlogt;
+    ism_ntab = psrc->ism_ntab;
+  }
+  // relativistic cooling
+  Real crate = 0.0, cpower = 1.0;
+  if (add_rel_cool) {
+    crate = psrc->crate_rel;
+    cpower = psrc->cpower_rel;
+  }
+  // shearing box
+  bool sbox_r_phi = false;
+  Real sbox_coef1 = 0.0, sbox_coef2 = 0.0, qo = 0.0;
+  if (add_sbox) {
+    sbox_r_phi = (psrc->shearing_box_r_phi || THREE_D);
+    sbox_coef1 = 2.0*beta_dt*(psrc->omega0);
+    sbox_coef2 = (2.0 - psrc->qshear)*beta_dt*(psrc->omega0);
+    qo = (psrc->qshear)*(psrc->omega0);
+  }
+
   // hierarchical parallel loop that updates conserved variables to intermediate step
   // using weights and fractional time step appropriate to stages of time-integrator.
   // Vector inner loop used for good performance on cpus
   int scr_level = 0;
   size_t scr_size = ScrArray1D<Real>::shmem_size(ncells1);
 
-  par_for_outer("h_update",DevExeSpace(),scr_size,scr_level,0,nmb1,0,nvar-1,ks,ke,js,je,
+  // stream this task was launched on (default instance unless task flagged async)
+  DevExeSpace exec = pdriver->ExecSpace();
+
+  par_for_outer("h_update",exec,scr_size,scr_level,0,nmb1,0,nvar-1,ks,ke,js,je,
   KOKKOS_LAMBDA(TeamMember_t member, const int m, const int n, const int k, const int j) {
     ScrArray1D<Real> divf(member.team_scratch(scr_level), ncells1);
 
@@ -59,7 +137,7 @@ TaskStatus Hydro::RKUpdate(Driver *pdriver, int stage) {
 
     // Add dF2/dx2
     // Fluxes must be summed in pairs to symmetrize round-off error in each dir
-    if (multi_d) {
+    if (MULTI_D) {
       par_for_inner(member, is, ie, [&](const int i) {
         divf(i) += (flx2(m,n,k,j+1,i) - flx2(m,n,k,j,i))/mbsize.d_view(m).dx2;
       });
@@ -68,7 +146,7 @@ TaskStatus Hydro::RKUpdate(Driver *pdriver, int stage) {
 
     // Add dF3/dx3
     // Fluxes must be summed in pairs to symmetrize round-off error in each dir
-    if (three_d) {
+    if (THREE_D) {
       par_for_inner(member, is, ie, [&](const int i) {
         divf(i) += (flx3(m,n,k+1,j,i) - flx3(m,n,k,j,i))/mbsize.d_view(m).dx3;
       });
@@ -76,9 +154,59 @@ TaskStatus Hydro::RKUpdate(Driver *pdriver, int stage) {
     }
 
     par_for_inner(member, is, ie, [&](const int i) {
-      u0_(m,n,k,j,i) = gam0*u0_(m,n,k,j,i) + gam1*u1_(m,n,k,j,i) - beta_dt*divf(i);
+      Real u = gam0*u0_(m,n,k,j,i) + gam1*u1_(m,n,k,j,i) - beta_dt*divf(i);
+
+      // (optional) fused cell-local source terms, computed from primitives (w0) only
+      if (add_accel) {
+        Real src = beta_dt*accel_g*w0_(m,IDN,k,j,i);
+        if (n == accel_dir) { u += src; }
+        if (n == IEN && is_ideal) { u += src*w0_(m,accel_dir,k,j,i); }
+      }
+      if (add_ism_cool && n == IEN) {
+        // temperature in cgs unit
+        Real temp = (use_e) ? temp_unit*w0_(m,IEN,k,j,i)/w0_(m,IDN,k,j,i)*gm1
+                            : temp_unit*w0_(m,ITM,k,j,i);
+        Real lambda_cooling = ISMCoolTableFn(temp, ism_ctab, ism_logtmin,
+                                             ism_invdlogt, ism_ntab)/cooling_unit;
+        u -= beta_dt * w0_(m,IDN,k,j,i) *
+             (w0_(m,IDN,k,j,i) * lambda_cooling - gamma_heating);
+      }
+      if (add_rel_cool && (n == IEN || n == IM1 || n == IM2 || n == IM3)) {
+        Real temp = (use_e) ? w0_(m,IEN,k,j,i)/w0_(m,IDN,k,j,i)*gm1
+                            : w0_(m,ITM,k,j,i);
+        Real ucov;  // four-velocity component multiplying this variable
+        if (n == IEN) {
+          ucov = sqrt(1.0 + SQR(w0_(m,IVX,k,j,i)) + SQR(w0_(m,IVY,k,j,i))
+                          + SQR(w0_(m,IVZ,k,j,i)));
+        } else {
+          ucov = w0_(m,n,k,j,i);  // IM1/IM2/IM3 alias IVX/IVY/IVZ
+        }
+        u -= beta_dt*w0_(m,IDN,k,j,i)*ucov*pow((temp*crate), cpower);
+      }
+      if (add_sbox) {
+        Real &den = w0_(m,IDN,k,j,i);
+        if (sbox_r_phi) {
+          if (n == IM1) { u += sbox_coef1*den*w0_(m,IVY,k,j,i); }
+          if (n == IM2) { u -= sbox_coef2*den*w0_(m,IVX,k,j,i); }
+          if (n == IEN && is_ideal) {
+            u += beta_dt*qo*den*w0_(m,IVX,k,j,i)*w0_(m,IVY,k,j,i);
+          }
+        } else {
+          if (n == IM1) { u += sbox_coef1*den*w0_(m,IVZ,k,j,i); }
+          if (n == IM3) { u -= sbox_coef2*den*w0_(m,IVX,k,j,i); }
+          if (n == IEN && is_ideal) {
+            u += beta_dt*qo*den*w0_(m,IVX,k,j,i)*w0_(m,IVZ,k,j,i);
+          }
+        }
+      }
+
+      u0_(m,n,k,j,i) = u;
     });
   });
   return TaskStatus::complete;
 }
+
+template TaskStatus Hydro::RKUpdateDim<false,false>(Driver *pdriver, int stage);
+template TaskStatus Hydro::RKUpdateDim<true,false>(Driver *pdriver, int stage);
+template TaskStatus Hydro::RKUpdateDim<true,true>(Driver *pdriver, int stage);
 } // namespace hydro
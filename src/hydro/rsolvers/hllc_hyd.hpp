@@ -32,8 +32,8 @@ void HLLC(TeamMember_t const &member, const EOS_Data &eos,
   int ivy = IVX + ((ivx-IVX)+1)%3;
   int ivz = IVX + ((ivx-IVX)+2)%3;
 
-  Real gm1 = eos.gamma - 1.0;
-  Real igm1 = 1.0/gm1;
+  Real gm1 = eos.gm1;
+  Real igm1 = eos.igm1;
   Real alpha = ((eos.gamma) + 1.0)/(2.0*(eos.gamma));
 
   par_for_inner(member, il, iu, [&](const int i) {
@@ -30,7 +30,7 @@ void HLLC_SR(TeamMember_t const &member, const EOS_Data &eos,
      const ScrArray2D<Real> &wl, const ScrArray2D<Real> &wr, DvceArray5D<Real> flx) {
   int ivy = IVX + ((ivx-IVX)+1)%3;
   int ivz = IVX + ((ivx-IVX)+2)%3;
-  const Real gamma_prime = eos.gamma/(eos.gamma - 1.0);
+  const Real gamma_prime = eos.gamma*eos.igm1;
 
   par_for_inner(member, il, iu, [&](const int i) {
     // Create local references for L/R states (helps compiler vectorize)
@@ -29,7 +29,7 @@ void HLLE_GR(TeamMember_t const &member, const EOS_Data &eos,
      const ScrArray2D<Real> &wl, const ScrArray2D<Real> &wr, DvceArray5D<Real> flx) {
   int ivy = IVX + ((ivx-IVX)+1)%3;
   int ivz = IVX + ((ivx-IVX)+2)%3;
-  const Real gamma_prime = eos.gamma/(eos.gamma - 1.0);
+  const Real gamma_prime = eos.gamma*eos.igm1;
   auto &flat = coord.is_minkowski;
   auto &spin = coord.bh_spin;
 
@@ -75,7 +75,15 @@ void HLLE_GR(TeamMember_t const &member, const EOS_Data &eos,
       x3v = LeftEdgeX  (k-ks, indcs.nx3, x3min, x3max);
     }
     Real glower[4][4], gupper[4][4];
-    ComputeMetricAndInverse(x1v, x2v, x3v, flat, spin, glower, gupper);
+    if (coord.cache_metric) {
+      // read cached metric scalars at this face center instead of recomputing
+      const DvceArray5D<Real> &ms = (ivx == IVX)? coord.mscal_fc1 :
+                                    ((ivx == IVY)? coord.mscal_fc2 : coord.mscal_fc3);
+      MetricFromScalars(ms(m,0,k,j,i), ms(m,1,k,j,i), ms(m,2,k,j,i), ms(m,3,k,j,i),
+                        glower, gupper);
+    } else {
+      ComputeMetricAndInverse(x1v, x2v, x3v, flat, spin, glower, gupper);
+    }
 
     // Calculate 4-velocity in left state (contravariant compt)
     Real q = glower[ivx][ivx] * SQR(wl_ivx) + glower[ivy][ivy] * SQR(wl_ivy) +
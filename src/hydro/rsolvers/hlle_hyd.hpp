@@ -34,8 +34,11 @@ namespace hydro {
 
 //----------------------------------------------------------------------------------------
 //! \fn void HLLE
-//! \brief The HLLE Riemann solver for hydrodynamics (both ideal gas and isothermal)
+//! \brief The HLLE Riemann solver for hydrodynamics (both ideal gas and isothermal).
+//! Templated over the EOS branch so each instantiation compiles to straight-line code
+//! with no per-interface is_ideal branches
 
+template <bool is_ideal_>
 KOKKOS_INLINE_FUNCTION
 void HLLE(TeamMember_t const &member, const EOS_Data &eos,
      const RegionIndcs &indcs,const DualArray1D<RegionSize> &size,const CoordData &coord,
@@ -43,8 +46,8 @@ void HLLE(TeamMember_t const &member, const EOS_Data &eos,
      const ScrArray2D<Real> &wl, const ScrArray2D<Real> &wr, DvceArray5D<Real> flx) {
   int ivy = IVX + ((ivx-IVX)+1)%3;
   int ivz = IVX + ((ivx-IVX)+2)%3;
-  Real gm1 = eos.gamma - 1.0;
-  Real igm1 = 1.0/gm1;
+  Real gm1 = eos.gm1;
+  Real igm1 = eos.igm1;
   Real iso_cs = eos.iso_cs;
 
   par_for_inner(member, il, iu, [&](const int i) {
@@ -61,7 +64,7 @@ void HLLE(TeamMember_t const &member, const EOS_Data &eos,
     Real &wr_ivz = wr(ivz,i);
 
     Real wl_ipr, wr_ipr;
-    if (eos.is_ideal) {
+    if constexpr (is_ideal_) {
       wl_ipr = eos.IdealGasPressure(wl(IEN,i));
       wr_ipr = eos.IdealGasPressure(wr(IEN,i));
     }
@@ -79,7 +82,7 @@ void HLLE(TeamMember_t const &member, const EOS_Data &eos,
     // Following Roe(1981), the enthalpy H=(E+P)/d is averaged for ideal gas EOS,
     // rather than E or P directly.  sqrtdl*hl = sqrtdl*(el+pl)/dl = (el+pl)/sqrtdl
     Real el,er,hroe;
-    if (eos.is_ideal) {
+    if constexpr (is_ideal_) {
       el = wl_ipr*igm1 + 0.5*wl_idn*(SQR(wl_ivx) + SQR(wl_ivy) + SQR(wl_ivz));
       er = wr_ipr*igm1 + 0.5*wr_idn*(SQR(wr_ivx) + SQR(wr_ivy) + SQR(wr_ivz));
       hroe = ((el + wl_ipr)/sqrtdl + (er + wr_ipr)/sqrtdr)*isdlpdr;
@@ -89,7 +92,7 @@ void HLLE(TeamMember_t const &member, const EOS_Data &eos,
 
     Real qa,qb;
     Real a  = iso_cs;
-    if (eos.is_ideal) {
+    if constexpr (is_ideal_) {
       qa = eos.IdealHydroSoundSpeed(wl_idn, wl_ipr);
       qb = eos.IdealHydroSoundSpeed(wr_idn, wr_ipr);
       a = hroe - 0.5*(SQR(wroe_ivx) + SQR(wroe_ivy) + SQR(wroe_ivz));
@@ -126,7 +129,7 @@ void HLLE(TeamMember_t const &member, const EOS_Data &eos,
     fl.mz = wl_idn*wl_ivz*qa;
     fr.mz = wr_idn*wr_ivz*qb;
 
-    if (eos.is_ideal) {
+    if constexpr (is_ideal_) {
       fl.mx += wl_ipr;
       fr.mx += wr_ipr;
       fl.e  = el*qa + wl_ipr*wl_ivx;
@@ -146,7 +149,7 @@ void HLLE(TeamMember_t const &member, const EOS_Data &eos,
     flx(m,ivx,k,j,i) = 0.5*(fl.mx + fr.mx) + qa*(fl.mx - fr.mx);
     flx(m,ivy,k,j,i) = 0.5*(fl.my + fr.my) + qa*(fl.my - fr.my);
     flx(m,ivz,k,j,i) = 0.5*(fl.mz + fr.mz) + qa*(fl.mz - fr.mz);
-    if (eos.is_ideal) flx(m,IEN,k,j,i) = 0.5*(fl.e + fr.e) + qa*(fl.e - fr.e);
+    if constexpr (is_ideal_) {flx(m,IEN,k,j,i) = 0.5*(fl.e + fr.e) + qa*(fl.e - fr.e);}
   });
 
   return;
@@ -14,8 +14,10 @@ namespace hydro {
 //----------------------------------------------------------------------------------------
 //! \fn void LLF
 //! \brief Wrapper function for the LLF Riemann solver for hydrodynamics (both ideal gas
-//! and isothermal) which calls single state LLF solver.
+//! and isothermal) which calls single state LLF solver.  Templated over the EOS branch
+//! so the energy-variable loads/stores compile out entirely for isothermal runs.
 
+template <bool is_ideal_>
 KOKKOS_INLINE_FUNCTION
 void LLF(TeamMember_t const &member, const EOS_Data &eos,
      const RegionIndcs &indcs,const DualArray1D<RegionSize> &size,const CoordData &coord,
@@ -37,21 +39,21 @@ void LLF(TeamMember_t const &member, const EOS_Data &eos,
     wri.vy = wr(ivy,i);
     wri.vz = wr(ivz,i);
 
-    if (eos.is_ideal) {
+    if constexpr (is_ideal_) {
       wli.e = wl(IEN,i);
       wri.e = wr(IEN,i);
     }
 
     // Call LLF solver on single interface state
     HydCons1D flux;
-    SingleStateLLF_Hyd(wli,wri,eos,flux);
+    SingleStateLLF_Hyd<is_ideal_>(wli,wri,eos,flux);
 
     // Store results in 3D array of fluxes
     flx(m,IDN,k,j,i) = flux.d;
     flx(m,ivx,k,j,i) = flux.mx;
     flx(m,ivy,k,j,i) = flux.my;
     flx(m,ivz,k,j,i) = flux.mz;
-    if (eos.is_ideal) {flx(m,IEN,k,j,i) = flux.e;}
+    if constexpr (is_ideal_) {flx(m,IEN,k,j,i) = flux.e;}
   });
 
   return;
@@ -23,7 +23,10 @@ namespace hydro {
 //----------------------------------------------------------------------------------------
 //! \fn void SingleStateLLF_HYD
 //  \brief The LLF Riemann solver for hydrodynamics for a single L/R state
+//  Templated over the EOS branch so each instantiation compiles to straight-line code
+//  with no per-interface is_ideal branches (and no energy flux work when isothermal)
 
+template <bool is_ideal_>
 KOKKOS_INLINE_FUNCTION
 void SingleStateLLF_Hyd(const HydPrim1D &wl, const HydPrim1D &wr, const EOS_Data &eos,
                         HydCons1D &flux) {
@@ -38,7 +41,7 @@ void SingleStateLLF_Hyd(const HydPrim1D &wl, const HydPrim1D &wr, const EOS_Data
   fsum.mz = qa*wl.vz + qb*wr.vz;
 
   Real el,er,pl,pr;
-  if (eos.is_ideal) {
+  if constexpr (is_ideal_) {
     pl = eos.IdealGasPressure(wl.e);
     pr = eos.IdealGasPressure(wr.e);
     el = wl.e + 0.5*wl.d*(SQR(wl.vx) + SQR(wl.vy) + SQR(wl.vz));
@@ -50,7 +53,7 @@ void SingleStateLLF_Hyd(const HydPrim1D &wl, const HydPrim1D &wr, const EOS_Data
   }
 
   // Compute max wave speed in L,R states (see Toro eq. 10.43)
-  if (eos.is_ideal) {
+  if constexpr (is_ideal_) {
     qa = eos.IdealHydroSoundSpeed(wl.d, pl);
     qb = eos.IdealHydroSoundSpeed(wr.d, pr);
   } else {
@@ -65,15 +68,31 @@ void SingleStateLLF_Hyd(const HydPrim1D &wl, const HydPrim1D &wr, const EOS_Data
   du.mx = a*(wr.d*wr.vx - wl.d*wl.vx);
   du.my = a*(wr.d*wr.vy - wl.d*wl.vy);
   du.mz = a*(wr.d*wr.vz - wl.d*wl.vz);
-  if (eos.is_ideal) du.e = a*(er - el);
+  if constexpr (is_ideal_) {du.e = a*(er - el);}
 
   // Compute the LLF flux at interface (see Toro eq. 10.42).
   flux.d  = 0.5*(fsum.d  - du.d );
   flux.mx = 0.5*(fsum.mx - du.mx);
   flux.my = 0.5*(fsum.my - du.my);
   flux.mz = 0.5*(fsum.mz - du.mz);
-  if (eos.is_ideal) {flux.e = 0.5*(fsum.e - du.e);}
+  if constexpr (is_ideal_) {flux.e = 0.5*(fsum.e - du.e);}
+
+  return;
+}
+
+//----------------------------------------------------------------------------------------
+//! \fn void SingleStateLLF_HYD
+//  \brief Runtime-dispatch overload retained for callers without a compile-time EOS
+//  branch (e.g. the scalar fallback interfaces in FOFC)
 
+KOKKOS_INLINE_FUNCTION
+void SingleStateLLF_Hyd(const HydPrim1D &wl, const HydPrim1D &wr, const EOS_Data &eos,
+                        HydCons1D &flux) {
+  if (eos.is_ideal) {
+    SingleStateLLF_Hyd<true>(wl, wr, eos, flux);
+  } else {
+    SingleStateLLF_Hyd<false>(wl, wr, eos, flux);
+  }
   return;
 }
 
@@ -154,7 +173,7 @@ void SingleStateLLF_GRHyd(const HydPrim1D wl, const HydPrim1D wr,
   // Cyclic permutation of array indices
   int ivy = IVX + ((ivx-IVX)+1)%3;
   int ivz = IVX + ((ivx-IVX)+2)%3;
-  const Real gamma_prime = eos.gamma/(eos.gamma - 1.0);
+  const Real gamma_prime = eos.gamma*eos.igm1;
 
   // References to left primitives
   const Real &wl_idn=wl.d;
@@ -36,8 +36,11 @@ void RoeFluxIso(const Real wroe[], const Real du[], const Real wli[],
 
 //----------------------------------------------------------------------------------------
 //! \fn void Roe
-//! \brief The Roe Riemann solver for hydrodynamics (both ideal gas and isothermal)
+//! \brief The Roe Riemann solver for hydrodynamics (both ideal gas and isothermal).
+//! Templated over the EOS branch so each instantiation compiles to straight-line code
+//! with no per-interface is_ideal branches
 
+template <bool is_ideal_>
 KOKKOS_INLINE_FUNCTION
 void Roe(TeamMember_t const &member, const EOS_Data &eos,
      const RegionIndcs &indcs,const DualArray1D<RegionSize> &size,const CoordData &coord,
@@ -48,7 +51,7 @@ void Roe(TeamMember_t const &member, const EOS_Data &eos,
   Real wli[5],wri[5],wroe[5];
   Real fl[5],fr[5],flxi[5];
   Real ev[5],du[5];
-  Real gm1 = eos.gamma - 1.0;
+  Real gm1 = eos.gm1;
   Real iso_cs = eos.iso_cs;
 
   par_for_inner(member, il, iu, [&](const int i) {
@@ -64,7 +67,7 @@ void Roe(TeamMember_t const &member, const EOS_Data &eos,
     wri[IVZ]=wr(ivz,i);
 
     // store pressure in L/R primitives
-    if (eos.is_ideal) {
+    if constexpr (is_ideal_) {
       wli[IEN] = eos.IdealGasPressure(wl(IEN,i));
       wri[IEN] = eos.IdealGasPressure(wr(IEN,i));
     }
@@ -83,7 +86,7 @@ void Roe(TeamMember_t const &member, const EOS_Data &eos,
     // Following Roe(1981), the enthalpy H=(E+P)/d is averaged for ideal gas EOS,
     // rather than E or P directly.  sqrtdl*hl = sqrtdl*(el+pl)/dl = (el+pl)/sqrtdl
     Real el,er;
-    if (eos.is_ideal) {
+    if constexpr (is_ideal_) {
       el = wli[IEN]/gm1 + 0.5*wli[IDN]*(SQR(wli[IVX])+SQR(wli[IVY])+SQR(wli[IVZ]));
       er = wri[IEN]/gm1 + 0.5*wri[IDN]*(SQR(wri[IVX])+SQR(wri[IVY])+SQR(wri[IVZ]));
       wroe[IEN] = ((el + wli[IEN])/sqrtdl + (er + wri[IEN])/sqrtdr)*isdlpdr;
@@ -106,7 +109,7 @@ void Roe(TeamMember_t const &member, const EOS_Data &eos,
     fl[IVZ] = mxl*wli[IVZ];
     fr[IVZ] = mxr*wri[IVZ];
 
-    if (eos.is_ideal) {
+    if constexpr (is_ideal_) {
       fl[IVX] += wli[IEN];
       fr[IVX] += wri[IEN];
       fl[IEN] = (el + wli[IEN])*wli[IVX];
@@ -122,52 +125,37 @@ void Roe(TeamMember_t const &member, const EOS_Data &eos,
     du[IVX] = wri[IDN]*wri[IVX] - wli[IDN]*wli[IVX];
     du[IVY] = wri[IDN]*wri[IVY] - wli[IDN]*wli[IVY];
     du[IVZ] = wri[IDN]*wri[IVZ] - wli[IDN]*wli[IVZ];
-    if (eos.is_ideal) du[IEN] = er - el;
+    if constexpr (is_ideal_) {du[IEN] = er - el;}
 
     flxi[IDN] = 0.5*(fl[IDN] + fr[IDN]);
     flxi[IVX] = 0.5*(fl[IVX] + fr[IVX]);
     flxi[IVY] = 0.5*(fl[IVY] + fr[IVY]);
     flxi[IVZ] = 0.5*(fl[IVZ] + fr[IVZ]);
-    if (eos.is_ideal) flxi[IEN] = 0.5*(fl[IEN] + fr[IEN]);
+    if constexpr (is_ideal_) {flxi[IEN] = 0.5*(fl[IEN] + fr[IEN]);}
 
     int llf_flag = 0;
-    if (eos.is_ideal) {
+    if constexpr (is_ideal_) {
       roe::RoeFluxAdb(wroe,du,wli,gm1,flxi,ev,llf_flag);
     } else {
       roe::RoeFluxIso(wroe,du,wli,iso_cs,flxi,ev,llf_flag);
     }
 
-    //--- Step 5.  Overwrite with upwind flux if flow is supersonic
+    //--- Step 5.  Overwrite with upwind flux if flow is supersonic.  Written as selects
+    // rather than branches so vector lanes stay converged
 
-    if (ev[0] >= 0.0) {
-      flxi[IDN] = fl[IDN];
-      flxi[IVX] = fl[IVX];
-      flxi[IVY] = fl[IVY];
-      flxi[IVZ] = fl[IVZ];
-      if (eos.is_ideal) flxi[IEN] = fl[IEN];
-    }
-    if (eos.is_ideal) {
-      if (ev[4] <= 0.0) {
-        flxi[IDN] = fr[IDN];
-        flxi[IVX] = fr[IVX];
-        flxi[IVY] = fr[IVY];
-        flxi[IVZ] = fr[IVZ];
-        flxi[IEN] = fr[IEN];
-      }
-    } else {
-      if (ev[3] <= 0.0) {
-        flxi[IDN] = fr[IDN];
-        flxi[IVX] = fr[IVX];
-        flxi[IVY] = fr[IVY];
-        flxi[IVZ] = fr[IVZ];
-      }
-    }
+    const bool lsup = (ev[0] >= 0.0);
+    const bool rsup = (is_ideal_)? (ev[4] <= 0.0) : (ev[3] <= 0.0);
+    flxi[IDN] = rsup? fr[IDN] : (lsup? fl[IDN] : flxi[IDN]);
+    flxi[IVX] = rsup? fr[IVX] : (lsup? fl[IVX] : flxi[IVX]);
+    flxi[IVY] = rsup? fr[IVY] : (lsup? fl[IVY] : flxi[IVY]);
+    flxi[IVZ] = rsup? fr[IVZ] : (lsup? fl[IVZ] : flxi[IVZ]);
+    if constexpr (is_ideal_) {flxi[IEN] = rsup? fr[IEN] : (lsup? fl[IEN] : flxi[IEN]);}
 
     //--- Step 6.  Overwrite with LLF flux if any of intermediate states are negative
 
     if (llf_flag != 0) {
       Real cl,cr;
-      if (eos.is_ideal) {
+      if constexpr (is_ideal_) {
         cl = eos.IdealHydroSoundSpeed(wli[IDN], wli[IEN]);
         cr = eos.IdealHydroSoundSpeed(wri[IDN], wri[IEN]);
       } else {
@@ -180,7 +168,7 @@ void Roe(TeamMember_t const &member, const EOS_Data &eos,
       flxi[IVX] = 0.5*(fl[IVX] + fr[IVX]) - a*du[IVX];
       flxi[IVY] = 0.5*(fl[IVY] + fr[IVY]) - a*du[IVY];
       flxi[IVZ] = 0.5*(fl[IVZ] + fr[IVZ]) - a*du[IVZ];
-      if (eos.is_ideal) {flxi[IEN] = 0.5*(fl[IEN] + fr[IEN]) - a*du[IEN];}
+      if constexpr (is_ideal_) {flxi[IEN] = 0.5*(fl[IEN] + fr[IEN]) - a*du[IEN];}
     }
 
     //--- Step 7. Store results into 3D array of fluxes
@@ -189,7 +177,7 @@ void Roe(TeamMember_t const &member, const EOS_Data &eos,
     flx(m,ivx,k,j,i) = flxi[IVX];
     flx(m,ivy,k,j,i) = flxi[IVY];
     flx(m,ivz,k,j,i) = flxi[IVZ];
-    if (eos.is_ideal) flx(m,IEN,k,j,i) = flxi[IEN];
+    if constexpr (is_ideal_) {flx(m,IEN,k,j,i) = flxi[IEN];}
   });
   return;
 }
@@ -228,89 +216,67 @@ void RoeFluxAdb(const Real wroe[], const Real du[], const Real wli[], const Real
   Real v2 = wroe[IVY];
   Real v3 = wroe[IVZ];
 
-    Real h = wroe[IEN];
-    Real vsq = v1*v1 + v2*v2 + v3*v3;
-    Real q = h - 0.5*vsq;
-    Real cs_sq = (q < 0.0) ? (FLT_MIN) : gm1*q;
-    Real cs = sqrt(cs_sq);
-
-    // Compute eigenvalues (eq. B2)
-    ev[0] = v1 - cs;
-    ev[1] = v1;
-    ev[2] = v1;
-    ev[3] = v1;
-    ev[4] = v1 + cs;
-
-    // Compute projection of dU onto L-eigenvectors using matrix elements from eq. B4
-    Real a[5];
-    Real na = 0.5/cs_sq;
-    a[0]  = du[0]*(0.5*gm1*vsq + v1*cs);
-    a[0] -= du[1]*(gm1*v1 + cs);
-    a[0] -= du[2]*gm1*v2;
-    a[0] -= du[3]*gm1*v3;
-    a[0] += du[4]*gm1;
-    a[0] *= na;
-
-    a[1]  = du[0]*(-v2);
-    a[1] += du[2];
-
-    a[2]  = du[0]*(-v3);
-    a[2] += du[3];
-
-    Real qa = gm1/cs_sq;
-    a[3]  = du[0]*(1.0 - na*gm1*vsq);
-    a[3] += du[1]*qa*v1;
-    a[3] += du[2]*qa*v2;
-    a[3] += du[3]*qa*v3;
-    a[3] -= du[4]*qa;
-
-    a[4]  = du[0]*(0.5*gm1*vsq - v1*cs);
-    a[4] -= du[1]*(gm1*v1 - cs);
-    a[4] -= du[2]*gm1*v2;
-    a[4] -= du[3]*gm1*v3;
-    a[4] += du[4]*gm1;
-    a[4] *= na;
-
-    Real coeff[5];
-    coeff[0] = -0.5*fabs(ev[0])*a[0];
-    coeff[1] = -0.5*fabs(ev[1])*a[1];
-    coeff[2] = -0.5*fabs(ev[2])*a[2];
-    coeff[3] = -0.5*fabs(ev[3])*a[3];
-    coeff[4] = -0.5*fabs(ev[4])*a[4];
-
-    // compute density in intermediate states and check that it is positive, set flag
-    // This requires computing the [0][*] components of the right-eigenmatrix
-    Real dens = wli[IDN] + a[0];  // rem[0][0]=1, so don't bother to compute or store
-    if (dens < 0.0) llf_flag=1;
-
-    dens += a[3];  // rem[0][3]=1, so don't bother to compute or store
-    if (dens < 0.0) llf_flag=1;
-
-    // Now multiply projection with R-eigenvectors from eq. B3 and SUM into output fluxes
-    flx[0] += coeff[0];
-    flx[0] += coeff[3];
-    flx[0] += coeff[4];
-
-    flx[1] += coeff[0]*(v1 - cs);
-    flx[1] += coeff[3]*v1;
-    flx[1] += coeff[4]*(v1 + cs);
-
-    flx[2] += coeff[0]*v2;
-    flx[2] += coeff[1];
-    flx[2] += coeff[3]*v2;
-    flx[2] += coeff[4]*v2;
-
-    flx[3] += coeff[0]*v3;
-    flx[3] += coeff[2];
-    flx[3] += coeff[3]*v3;
-    flx[3] += coeff[4]*v3;
-
-    flx[4] += coeff[0]*(h - v1*cs);
-    flx[4] += coeff[1]*v2;
-    flx[4] += coeff[2]*v3;
-    flx[4] += coeff[3]*0.5*vsq;
-    flx[4] += coeff[4]*(h + v1*cs);
-
+  Real h = wroe[IEN];
+  Real vsq = v1*v1 + v2*v2 + v3*v3;
+  Real q = h - 0.5*vsq;
+  Real cs_sq = (q < 0.0) ? (FLT_MIN) : gm1*q;
+  Real cs = sqrt(cs_sq);
+
+  // Compute eigenvalues (eq. B2)
+  ev[0] = v1 - cs;
+  ev[1] = v1;
+  ev[2] = v1;
+  ev[3] = v1;
+  ev[4] = v1 + cs;
+
+  // Dense matrix of L-eigenvectors (eq. B4).  Storing the full matrix lets the
+  // projections below be assembled as unrolled matrix-vector products with identical
+  // instruction sequences for every wave family (no per-family branches), which keeps
+  // SIMD/SIMT lanes converged inside the vector loop over faces
+  Real na = 0.5/cs_sq;
+  Real qa = gm1/cs_sq;
+  const Real lem[5][5] = {
+    {na*(0.5*gm1*vsq + v1*cs), -na*(gm1*v1 + cs), -na*gm1*v2, -na*gm1*v3,  na*gm1},
+    {-v2,                       0.0,               1.0,        0.0,        0.0},
+    {-v3,                       0.0,               0.0,        1.0,        0.0},
+    {1.0 - na*gm1*vsq,          qa*v1,             qa*v2,      qa*v3,     -qa},
+    {na*(0.5*gm1*vsq - v1*cs), -na*(gm1*v1 - cs), -na*gm1*v2, -na*gm1*v3,  na*gm1}};
+
+  // Dense matrix of R-eigenvectors (eq. B3)
+  const Real rem[5][5] = {
+    {1.0,       0.0, 0.0, 1.0,     1.0},
+    {v1 - cs,   0.0, 0.0, v1,      v1 + cs},
+    {v2,        1.0, 0.0, v2,      v2},
+    {v3,        0.0, 1.0, v3,      v3},
+    {h - v1*cs, v2,  v3,  0.5*vsq, h + v1*cs}};
+
+  // Compute projection of dU onto L-eigenvectors, a = lem.du
+  Real a[5];
+  for (int n=0; n<5; ++n) {
+    a[n] = lem[n][0]*du[0];
+    for (int m=1; m<5; ++m) {
+      a[n] += lem[n][m]*du[m];
+    }
+  }
+
+  Real coeff[5];
+  for (int n=0; n<5; ++n) {
+    coeff[n] = -0.5*fabs(ev[n])*a[n];
+  }
+
+  // compute density in intermediate states and check that it is positive, set flag
+  // rem[0][0]=rem[0][3]=1, so only sums of wave strengths are needed
+  llf_flag |= ((wli[IDN] + a[0]) < 0.0);
+  llf_flag |= ((wli[IDN] + a[0] + a[3]) < 0.0);
+
+  // Now multiply projection with R-eigenvectors and SUM into output fluxes, flx += rem.c
+  for (int n=0; n<5; ++n) {
+    Real f = rem[n][0]*coeff[0];
+    for (int m=1; m<5; ++m) {
+      f += rem[n][m]*coeff[m];
+    }
+    flx[n] += f;
+  }
   return;
 }
 
@@ -324,56 +290,57 @@ void RoeFluxIso(const Real wroe[], const Real du[], const Real wli[], const Real
   Real v2 = wroe[IVY];
   Real v3 = wroe[IVZ];
 
-    //--- Isothermal hydrodynamics
-
-    // Compute eigenvalues (eq. B6)
-    ev[0] = v1 - iso_cs;
-    ev[1] = v1;
-    ev[2] = v1;
-    ev[3] = v1 + iso_cs;
-
-    // Compute projection of dU onto L-eigenvectors using matrix elements from eq. B7
-    Real a[4];
-    a[0]  = du[0]*(0.5 + 0.5*v1/iso_cs);
-    a[0] -= du[1]*0.5/iso_cs;
-
-    a[1]  = du[0]*(-v2);
-    a[1] += du[2];
-
-    a[2]  = du[0]*(-v3);
-    a[2] += du[3];
-
-    a[3]  = du[0]*(0.5 - 0.5*v1/iso_cs);
-    a[3] += du[1]*0.5/iso_cs;
-
-    Real coeff[4];
-    coeff[0] = -0.5*fabs(ev[0])*a[0];
-    coeff[1] = -0.5*fabs(ev[1])*a[1];
-    coeff[2] = -0.5*fabs(ev[2])*a[2];
-    coeff[3] = -0.5*fabs(ev[3])*a[3];
-
-    // compute density in intermediate states and check that it is positive, set flag
-    // This requires computing the [0][*] components of the right-eigenmatrix
-    Real dens = wli[IDN] + a[0];  // rem[0][0]=1, so don't bother to compute or store
-    if (dens < 0.0) llf_flag=1;
-
-    dens += a[3];  // rem[0][3]=1, so don't bother to compute or store
-    if (dens < 0.0) llf_flag=1;
-
-    // Now multiply projection with R-eigenvectors from eq. B3 and SUM into output fluxes
-    flx[0] += coeff[0];
-    flx[0] += coeff[3];
-
-    flx[1] += coeff[0]*(v1 - iso_cs);
-    flx[1] += coeff[3]*(v1 + iso_cs);
-
-    flx[2] += coeff[0]*v2;
-    flx[2] += coeff[1];
-    flx[2] += coeff[3]*v2;
-
-    flx[3] += coeff[0]*v3;
-    flx[3] += coeff[2];
-    flx[3] += coeff[3]*v3;
+  //--- Isothermal hydrodynamics
+
+  // Compute eigenvalues (eq. B6)
+  ev[0] = v1 - iso_cs;
+  ev[1] = v1;
+  ev[2] = v1;
+  ev[3] = v1 + iso_cs;
+
+  // Dense matrix of L-eigenvectors (eq. B7), stored in full so projections are assembled
+  // as unrolled matrix-vector products with no per-wave-family branches
+  Real hcsi = 0.5/iso_cs;
+  const Real lem[4][4] = {
+    {0.5 + v1*hcsi, -hcsi, 0.0, 0.0},
+    {-v2,            0.0,  1.0, 0.0},
+    {-v3,            0.0,  0.0, 1.0},
+    {0.5 - v1*hcsi,  hcsi, 0.0, 0.0}};
+
+  // Dense matrix of R-eigenvectors (eq. B3)
+  const Real rem[4][4] = {
+    {1.0,          0.0, 0.0, 1.0},
+    {v1 - iso_cs,  0.0, 0.0, v1 + iso_cs},
+    {v2,           1.0, 0.0, v2},
+    {v3,           0.0, 1.0, v3}};
+
+  // Compute projection of dU onto L-eigenvectors, a = lem.du
+  Real a[4];
+  for (int n=0; n<4; ++n) {
+    a[n] = lem[n][0]*du[0];
+    for (int m=1; m<4; ++m) {
+      a[n] += lem[n][m]*du[m];
+    }
+  }
+
+  Real coeff[4];
+  for (int n=0; n<4; ++n) {
+    coeff[n] = -0.5*fabs(ev[n])*a[n];
+  }
+
+  // compute density in intermediate states and check that it is positive, set flag
+  // rem[0][0]=rem[0][3]=1, so only sums of wave strengths are needed
+  llf_flag |= ((wli[IDN] + a[0]) < 0.0);
+  llf_flag |= ((wli[IDN] + a[0] + a[3]) < 0.0);
+
+  // Now multiply projection with R-eigenvectors and SUM into output fluxes, flx += rem.c
+  for (int n=0; n<4; ++n) {
+    Real f = rem[n][0]*coeff[0];
+    for (int m=1; m<4; ++m) {
+      f += rem[n][m]*coeff[m];
+    }
+    flx[n] += f;
+  }
   return;
 }
 } // namespace roe
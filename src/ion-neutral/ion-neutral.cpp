@@ -28,5 +28,14 @@ IonNeutral::IonNeutral(MeshBlockPack *pp, ParameterInput *pin) :
   drag_coeff = pin->GetReal("ion-neutral","drag_coeff");
   ionization_coeff = pin->GetOrAddReal("ion-neutral","ionization_coeff",0.0);
   recombination_coeff = pin->GetOrAddReal("ion-neutral","recombination_coeff",0.0);
+
+  // Re-initialize the cell-centered MHD boundary buffers to hold the conserved
+  // variables of BOTH fluids, so ion and neutral ghost zones are exchanged through a
+  // single fused message stream per stage (see IonNeutral::SendU/RecvU).  Requires both
+  // Hydro and MHD to have been constructed first (enforced in MeshBlockPack).
+  if (pp->pmhd != nullptr && pp->phydro != nullptr) {
+    pp->pmhd->pbval_u->InitializeBuffers((pp->pmhd->nmhd) + (pp->pmhd->nscalars) +
+                                         (pp->phydro->nhydro) + (pp->phydro->nscalars));
+  }
 }
 } // namespace ion_neutral
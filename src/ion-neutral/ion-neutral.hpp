@@ -22,8 +22,7 @@
 //  \brief container to hold TaskIDs of all ion-neutral tasks
 
 struct IonNeutralTaskIDs {
-  TaskID i_irecv;
-  TaskID n_irecv;
+  TaskID irecv;
   TaskID impl_2x;
   TaskID i_flux;
   TaskID i_sendf;
@@ -36,10 +35,8 @@ struct IonNeutralTaskIDs {
   TaskID n_rkupdt;
   TaskID n_restu;
   TaskID impl;
-  TaskID i_sendu;
-  TaskID i_recvu;
-  TaskID n_sendu;
-  TaskID n_recvu;
+  TaskID sendu;
+  TaskID recvu;
   TaskID efld;
   TaskID ct;
   TaskID restb;
@@ -49,6 +46,8 @@ struct IonNeutralTaskIDs {
   TaskID n_bcs;
   TaskID i_prol;
   TaskID n_prol;
+  TaskID i_c2p_int;
+  TaskID n_c2p_int;
   TaskID i_c2p;
   TaskID n_c2p;
   TaskID i_newdt;
@@ -78,6 +77,9 @@ class IonNeutral {
 
   // functions
   void AssembleIonNeutralTasks(std::map<std::string, std::shared_ptr<TaskList>> tl);
+  TaskStatus InitRecv(Driver* pdrive, int stage);
+  TaskStatus SendU(Driver* pdrive, int stage);
+  TaskStatus RecvU(Driver* pdrive, int stage);
   TaskStatus FirstTwoImpRK(Driver* pdrive, int stage);
   TaskStatus ImpRKUpdate(Driver* pdrive, int stage);
 
@@ -36,54 +36,148 @@ void IonNeutral::AssembleIonNeutralTasks(
   Hydro *phyd = pmy_pack->phydro;
 
   // assemble "before_stagen_tl" task list
-  id.i_irecv = tl["before_stagen"]->AddTask(&MHD::InitRecv, pmhd, none);
-  id.n_irecv = tl["before_stagen"]->AddTask(&Hydro::InitRecv, phyd, none);
+  id.irecv = tl["before_stagen"]->AddTask(&IonNeutral::InitRecv, this, none,
+                                          "IonNeutral::InitRecv");
 
   // assemble "stagen_tl" task list
-  id.impl_2x = tl["stagen"]->AddTask(&IonNeutral::FirstTwoImpRK, this, none);
+  id.impl_2x = tl["stagen"]->AddTask(&IonNeutral::FirstTwoImpRK, this, none,
+                                     "IonNeutral::FirstTwoImpRK");
   // above does CopyCons
 
-  id.i_flux   = tl["stagen"]->AddTask(&MHD::Fluxes, pmhd, id.impl_2x);
-  id.i_sendf  = tl["stagen"]->AddTask(&MHD::SendFlux, pmhd, id.i_flux);
-  id.i_recvf  = tl["stagen"]->AddTask(&MHD::RecvFlux, pmhd, id.i_sendf);
-  id.i_rkupdt = tl["stagen"]->AddTask(&MHD::RKUpdate, pmhd, id.i_recvf);
-
-  id.n_flux   = tl["stagen"]->AddTask(&Hydro::Fluxes, phyd, id.i_rkupdt);
-  id.n_sendf  = tl["stagen"]->AddTask(&Hydro::SendFlux, phyd, id.n_flux);
-  id.n_recvf  = tl["stagen"]->AddTask(&Hydro::RecvFlux, phyd, id.n_sendf);
-  id.n_rkupdt = tl["stagen"]->AddTask(&Hydro::RKUpdate, phyd, id.n_recvf);
-
-  id.impl     = tl["stagen"]->AddTask(&IonNeutral::ImpRKUpdate, this, id.n_rkupdt);
-  id.i_restu  = tl["stagen"]->AddTask(&MHD::RestrictU, pmhd, id.impl);
-  id.n_restu  = tl["stagen"]->AddTask(&Hydro::RestrictU, phyd, id.i_restu);
-
-  id.i_sendu  = tl["stagen"]->AddTask(&MHD::SendU, pmhd, id.n_restu);
-  id.n_sendu  = tl["stagen"]->AddTask(&Hydro::SendU, phyd, id.n_restu);
-  id.i_recvu  = tl["stagen"]->AddTask(&MHD::RecvU, pmhd, id.i_sendu);
-  id.n_recvu  = tl["stagen"]->AddTask(&Hydro::RecvU, phyd, id.n_sendu);
-
-  id.efld     = tl["stagen"]->AddTask(&MHD::CornerE, pmhd, id.i_recvu);
-  id.ct       = tl["stagen"]->AddTask(&MHD::CT, pmhd, id.efld);
-  id.restb    = tl["stagen"]->AddTask(&MHD::RestrictB, pmhd, id.ct);
-  id.sendb    = tl["stagen"]->AddTask(&MHD::SendB, pmhd, id.restb);
-  id.recvb    = tl["stagen"]->AddTask(&MHD::RecvB, pmhd, id.sendb);
-
-  id.i_bcs    = tl["stagen"]->AddTask(&MHD::ApplyPhysicalBCs, pmhd, id.recvb);
-  id.n_bcs    = tl["stagen"]->AddTask(&Hydro::ApplyPhysicalBCs, phyd, id.n_recvu);
-  id.i_prol   = tl["stagen"]->AddTask(&MHD::Prolongate, pmhd, id.i_bcs);
-  id.n_prol   = tl["stagen"]->AddTask(&Hydro::Prolongate, phyd, id.n_bcs);
-  id.i_c2p    = tl["stagen"]->AddTask(&MHD::ConToPrim, pmhd, id.i_prol);
-  id.n_c2p    = tl["stagen"]->AddTask(&Hydro::ConToPrim, phyd, id.n_prol);
-  id.i_newdt  = tl["stagen"]->AddTask(&MHD::NewTimeStep, pmhd, id.i_c2p);
-  id.n_newdt  = tl["stagen"]->AddTask(&Hydro::NewTimeStep, phyd, id.n_c2p);
+  // ion and neutral explicit flux/update chains are independent between FirstTwoImpRK
+  // and ImpRKUpdate; both depend only on impl_2x so they may overlap on pool streams.
+  // Fluxes/RKUpdate route their kernels through Driver::ExecSpace(); flag asynchronous
+  // only when no diffusion/FOFC kernels (which still launch on the default instance)
+  // execute inside these tasks.
+  bool i_async = (pmhd->pvisc == nullptr) && (pmhd->presist == nullptr) &&
+                 (pmhd->pcond == nullptr) && (!(pmhd->use_fofc)) &&
+                 (!(pmy_pack->pcoord->is_general_relativistic));
+  bool n_async = (phyd->pvisc == nullptr) && (phyd->pcond == nullptr) &&
+                 (!(phyd->use_fofc)) &&
+                 (!(pmy_pack->pcoord->is_general_relativistic));
+
+  id.i_flux   = tl["stagen"]->AddTask(&MHD::Fluxes, pmhd, id.impl_2x,
+                                      "MHD::Fluxes", i_async);
+  id.i_sendf  = tl["stagen"]->AddTask(&MHD::SendFlux, pmhd, id.i_flux, "MHD::SendFlux");
+  id.i_recvf  = tl["stagen"]->AddTask(&MHD::RecvFlux, pmhd, id.i_sendf, "MHD::RecvFlux");
+  id.i_rkupdt = tl["stagen"]->AddTask(&MHD::RKUpdate, pmhd, id.i_recvf,
+                                      "MHD::RKUpdate", i_async);
+
+  id.n_flux   = tl["stagen"]->AddTask(&Hydro::Fluxes, phyd, id.impl_2x,
+                                      "Hydro::Fluxes", n_async);
+  id.n_sendf  = tl["stagen"]->AddTask(&Hydro::SendFlux, phyd, id.n_flux,
+                                      "Hydro::SendFlux");
+  id.n_recvf  = tl["stagen"]->AddTask(&Hydro::RecvFlux, phyd, id.n_sendf,
+                                      "Hydro::RecvFlux");
+  id.n_rkupdt = tl["stagen"]->AddTask(&Hydro::RKUpdate, phyd, id.n_recvf,
+                                      "Hydro::RKUpdate", n_async);
+
+  // implicit update needs BOTH explicit chains complete
+  TaskID impl_dep = (id.i_rkupdt | id.n_rkupdt);
+  id.impl     = tl["stagen"]->AddTask(&IonNeutral::ImpRKUpdate, this, impl_dep,
+                                      "IonNeutral::ImpRKUpdate");
+  id.i_restu  = tl["stagen"]->AddTask(&MHD::RestrictU, pmhd, id.impl, "MHD::RestrictU");
+  id.n_restu  = tl["stagen"]->AddTask(&Hydro::RestrictU, phyd, id.i_restu,
+                                      "Hydro::RestrictU");
+
+  // both fluids are packed/sent/unpacked through the (combined size) MHD boundary
+  // buffers, halving the number of messages exchanged per stage
+  id.sendu    = tl["stagen"]->AddTask(&IonNeutral::SendU, this, id.n_restu,
+                                      "IonNeutral::SendU");
+  // neutral interior cells are converted while the fused boundary messages are in
+  // flight (neutral u0 is final after the implicit update); ion conversion must wait
+  // for CT since CornerE reads the ion primitives of the previous stage
+  id.n_c2p_int = tl["stagen"]->AddTask(&Hydro::ConToPrimInterior, phyd, id.sendu,
+                                       "Hydro::ConToPrimInterior");
+  id.recvu    = tl["stagen"]->AddTask(&IonNeutral::RecvU, this, id.sendu,
+                                      "IonNeutral::RecvU");
+
+  id.efld     = tl["stagen"]->AddTask(&MHD::CornerE, pmhd, id.recvu, "MHD::CornerE");
+  id.ct       = tl["stagen"]->AddTask(&MHD::CT, pmhd, id.efld, "MHD::CT");
+  id.restb    = tl["stagen"]->AddTask(&MHD::RestrictB, pmhd, id.ct, "MHD::RestrictB");
+  id.sendb    = tl["stagen"]->AddTask(&MHD::SendB, pmhd, id.restb, "MHD::SendB");
+  id.i_c2p_int = tl["stagen"]->AddTask(&MHD::ConToPrimInterior, pmhd, id.sendb,
+                                       "MHD::ConToPrimInterior");
+  id.recvb    = tl["stagen"]->AddTask(&MHD::RecvB, pmhd, id.sendb, "MHD::RecvB");
+
+  id.i_bcs    = tl["stagen"]->AddTask(&MHD::ApplyPhysicalBCs, pmhd, id.recvb,
+                                      "MHD::ApplyPhysicalBCs");
+  id.n_bcs    = tl["stagen"]->AddTask(&Hydro::ApplyPhysicalBCs, phyd, id.recvu,
+                                      "Hydro::ApplyPhysicalBCs");
+  id.i_prol   = tl["stagen"]->AddTask(&MHD::Prolongate, pmhd, id.i_bcs,
+                                      "MHD::Prolongate");
+  id.n_prol   = tl["stagen"]->AddTask(&Hydro::Prolongate, phyd, id.n_bcs,
+                                      "Hydro::Prolongate");
+  // ghost zones are converted once receives and prolongation have completed
+  id.i_c2p    = tl["stagen"]->AddTask(&MHD::ConToPrimGhosts, pmhd,
+                                      (id.i_prol | id.i_c2p_int), "MHD::ConToPrimGhosts");
+  id.n_c2p    = tl["stagen"]->AddTask(&Hydro::ConToPrimGhosts, phyd,
+                                      (id.n_prol | id.n_c2p_int),
+                                          "Hydro::ConToPrimGhosts");
+  id.i_newdt  = tl["stagen"]->AddTask(&MHD::NewTimeStep, pmhd, id.i_c2p,
+                                      "MHD::NewTimeStep");
+  id.n_newdt  = tl["stagen"]->AddTask(&Hydro::NewTimeStep, phyd, id.n_c2p,
+                                      "Hydro::NewTimeStep");
 
   // assemble "after_stagen_tl" task list
-  id.i_clear = tl["after_stagen"]->AddTask(&MHD::ClearSend, pmhd, none);
-  id.n_clear = tl["after_stagen"]->AddTask(&Hydro::ClearSend, phyd, none);
+  id.i_clear = tl["after_stagen"]->AddTask(&MHD::ClearSend, pmhd, none, "MHD::ClearSend");
+  id.n_clear = tl["after_stagen"]->AddTask(&Hydro::ClearSend, phyd, none,
+                                           "Hydro::ClearSend");
 
   return;
 }
 
+//----------------------------------------------------------------------------------------
+//! \fn TaskStatus IonNeutral::InitRecv
+//  \brief Wrapper task list function to post non-blocking receives for the fused
+//  (ion+neutral) boundary communication.  The cell-centered MHD boundary buffers were
+//  initialized with the combined variable count in the IonNeutral constructor, so
+//  MHD::InitRecv() posts receives sized for both fluids; separate receives for the
+//  neutral fluid variables are NOT posted.  Flux corrections remain per-fluid since
+//  each fluid carries its own flux arrays, so neutral flux receives are still needed
+//  with SMR/AMR.
+
+TaskStatus IonNeutral::InitRecv(Driver *pdrive, int stage) {
+  mhd::MHD *pmhd = pmy_pack->pmhd;
+  hydro::Hydro *phyd = pmy_pack->phydro;
+
+  // post receives for fused (ion+neutral) U, B, and MHD fluxes
+  TaskStatus tstat = pmhd->InitRecv(pdrive, stage);
+  if (tstat != TaskStatus::complete) return tstat;
+
+  // with SMR/AMR post receives for fluxes of neutral U
+  // do not post receives for fluxes when stage < 0 (i.e. ICs)
+  if (pmy_pack->pmesh->multilevel && (stage >= 0)) {
+    tstat = phyd->pbval_u->InitFluxRecv(phyd->nhydro + phyd->nscalars);
+  }
+  return tstat;
+}
+
+//----------------------------------------------------------------------------------------
+//! \fn TaskStatus IonNeutral::SendU
+//  \brief Wrapper task list function to pack/send BOTH the ion and neutral conserved
+//  variables through the (combined size) MHD boundary buffers with one kernel launch
+//  and one message per neighbor pair.
+
+TaskStatus IonNeutral::SendU(Driver *pdrive, int stage) {
+  mhd::MHD *pmhd = pmy_pack->pmhd;
+  hydro::Hydro *phyd = pmy_pack->phydro;
+  return pmhd->pbval_u->PackAndSendCC(pmhd->u0, pmhd->coarse_u0,
+                                      phyd->u0, phyd->coarse_u0);
+}
+
+//----------------------------------------------------------------------------------------
+//! \fn TaskStatus IonNeutral::RecvU
+//  \brief Wrapper task list function to receive/unpack BOTH the ion and neutral
+//  conserved variables from the fused boundary buffers.
+
+TaskStatus IonNeutral::RecvU(Driver *pdrive, int stage) {
+  mhd::MHD *pmhd = pmy_pack->pmhd;
+  hydro::Hydro *phyd = pmy_pack->phydro;
+  return pmhd->pbval_u->RecvAndUnpackCC(pmhd->u0, pmhd->coarse_u0,
+                                        phyd->u0, phyd->coarse_u0);
+}
+
 //----------------------------------------------------------------------------------------
 //! \fn IonNeutral::FirstTwoImpRK
 //  \brief Executes first two implicit stages of the ImEx integrator for ion-neutral
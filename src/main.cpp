@@ -24,7 +24,9 @@
 //========================================================================================
 
 // C/C++ headers
+#include <cstdint>
 #include <cstdlib>
+#include <iomanip> // std::setprecision()
 #include <iostream>
 #include <string>
 #include <memory>
@@ -34,6 +36,7 @@
 #include "athena.hpp"
 #include "globals.hpp"
 #include "utils/utils.hpp"
+#include "utils/memlog.hpp"
 #include "parameter_input.hpp"
 #include "mesh/mesh.hpp"
 #include "outputs/outputs.hpp"
@@ -42,6 +45,9 @@
 // MPI/OpenMP headers
 #if MPI_PARALLEL_ENABLED
 #include <mpi.h>
+#if MPI_GPU_AWARE_ENABLED && defined(OPEN_MPI)
+#include <mpi-ext.h>  // for MPIX_Query_cuda_support
+#endif
 #endif
 
 #if OPENMP_PARALLEL_ENABLED
@@ -59,6 +65,7 @@
 int main(int argc, char *argv[]) {
   std::string input_file, restart_file, run_dir;
   bool iarg_flag = false;  // set to true if -i <file> argument is on cmdline
+  bool carg_flag = false;  // set to true if -c        argument is on cmdline
   bool marg_flag = false;  // set to true if -m        argument is on cmdline
   bool narg_flag = false;  // set to true if -n        argument is on cmdline
   bool  res_flag = false;  // set to true if -r <file> argument is on cmdline
@@ -90,7 +97,11 @@ int main(int argc, char *argv[]) {
     return(0);
   }
 #else  // no OpenMP
-  if (MPI_SUCCESS != MPI_Init(&argc, &argv)) {
+  // Request MPI_THREAD_MULTIPLE for the background writer thread used with 'async'
+  // outputs.  A lower thread level is not fatal here; the Outputs constructor checks
+  // the level actually provided if an async output is requested in the input file.
+  int mpiprv;
+  if (MPI_SUCCESS != MPI_Init_thread(&argc, &argv, MPI_THREAD_MULTIPLE, &mpiprv)) {
     std::cout << "### FATAL ERROR in " << __FILE__ << " at line " << __LINE__ << std::endl
               << "MPI Initialization failed." << std::endl;
     return(0);
@@ -111,13 +122,90 @@ int main(int argc, char *argv[]) {
     MPI_Finalize();
     return(0);
   }
+
+  // When built to pass device memory directly to MPI calls, verify at runtime that the
+  // MPI library actually supports this (query currently only available with Open MPI +
+  // CUDA).  Aborting here avoids opaque segfaults in the first boundary exchange.
+#if MPI_GPU_AWARE_ENABLED && defined(KOKKOS_ENABLE_CUDA) && defined(MPIX_CUDA_AWARE_SUPPORT)
+  if (1 != MPIX_Query_cuda_support()) {
+    if (global_variable::my_rank == 0) {
+      std::cout << "### FATAL ERROR in " << __FILE__ << " at line " << __LINE__
+                << std::endl << "MPI library cannot access device memory. Reconfigure "
+                << "with -D Athena_ENABLE_GPU_AWARE_MPI=OFF to stage boundary buffers "
+                << "through host memory." << std::endl;
+    }
+    MPI_Finalize();
+    return(0);
+  }
+#endif
 #else  // no MPI
   global_variable::my_rank = 0;
   global_variable::nranks  = 1;
 #endif  // MPI_PARALLEL_ENABLED
 
+#if MPI_PARALLEL_ENABLED && (defined(KOKKOS_ENABLE_CUDA) || defined(KOKKOS_ENABLE_HIP))
+  // Bind each rank to its own GPU before Kokkos initializes.  With one rank launched
+  // per GPU on multi-GPU nodes, Kokkos' default selection depends on launcher-specific
+  // environment variables; ranks that fall through to device 0 silently timeshare one
+  // GPU while the rest idle.  Deriving the binding from the node-local rank (via the
+  // shared-memory communicator) guarantees a one-to-one mapping under any launcher,
+  // and keeps intra-node exchanges with GPU-aware MPI on direct peer-to-peer copies
+  // between distinct devices.  An explicit selection made through the Kokkos command
+  // line or environment is respected.
+  {
+    bool user_selected = (std::getenv("KOKKOS_DEVICE_ID") != nullptr) ||
+                         (std::getenv("KOKKOS_NUM_DEVICES") != nullptr);
+    for (int i=1; i<argc; i++) {
+      std::string arg(argv[i]);
+      if ((arg.rfind("--kokkos-device-id",0) == 0) ||
+          (arg.rfind("--kokkos-num-devices",0) == 0)) {
+        user_selected = true;
+      }
+    }
+    if (!user_selected) {
+      MPI_Comm node_comm;
+      MPI_Comm_split_type(MPI_COMM_WORLD, MPI_COMM_TYPE_SHARED, 0, MPI_INFO_NULL,
+                          &node_comm);
+      int node_rank;
+      MPI_Comm_rank(node_comm, &node_rank);
+      MPI_Comm_free(&node_comm);
+      int ndev = 0;
+#if defined(KOKKOS_ENABLE_CUDA)
+      cudaGetDeviceCount(&ndev);
+#else
+      hipGetDeviceCount(&ndev);
+#endif
+      if (ndev > 0) {
+        setenv("KOKKOS_DEVICE_ID", std::to_string(node_rank % ndev).c_str(), 1);
+      }
+    }
+  }
+#endif
+
   Kokkos::initialize(argc, argv);
 
+  // install View allocation accounting callbacks before anything is allocated; the
+  // '<time> memlog' input flag (parsed later, in the Driver) only controls reporting
+  memlog::Enroll();
+
+#if defined(KOKKOS_ENABLE_CUDA)
+  // Device Views are allocated with cudaMallocAsync from the stream-ordered memory
+  // pool (Kokkos_ENABLE_IMPL_CUDA_MALLOC_ASYNC, set in CMakeLists.txt).  By default
+  // the pool releases cached memory back to the driver at every synchronization
+  // point, so every AMR regrid would pay the raw cudaMalloc cost all over again.
+  // Raising the release threshold keeps freed blocks cached in the pool, so view
+  // reallocations after the first are serviced without calling into the driver.
+  {
+    int device = 0;
+    cudaGetDevice(&device);
+    cudaMemPool_t mempool;
+    if (cudaDeviceGetDefaultMemPool(&mempool, device) == cudaSuccess) {
+      uint64_t threshold = UINT64_MAX;
+      cudaMemPoolSetAttribute(mempool, cudaMemPoolAttrReleaseThreshold, &threshold);
+    }
+  }
+#endif
+
   //--- Step 2. --------------------------------------------------------------------------
   // Check for command line options and respond.
 
@@ -173,12 +261,9 @@ int main(int argc, char *argv[]) {
           wtlim = static_cast<Real>(wth*3600 + wtm*60 + wts);
           break;
         case 'c':
-          if (global_variable::my_rank == 0) ShowConfig();
-          Kokkos::finalize();
-#if MPI_PARALLEL_ENABLED
-          MPI_Finalize();
-#endif
-          return(0);
+          // handled after the input file (if any) is read, so that the footprint
+          // estimator can be run on it
+          carg_flag = true;
           break;
         case 'h':
         default:
@@ -191,7 +276,8 @@ int main(int argc, char *argv[]) {
             std::cout << "  -r <file>       restart with this file\n";
             std::cout << "  -d <directory>  specify run dir [current dir]\n";
             std::cout << "  -n              parse input file and quit\n";
-            std::cout << "  -c              show configuration and quit\n";
+            std::cout << "  -c              show configuration (and estimated memory "
+                      << "footprint if an input file is given) and quit\n";
             std::cout << "  -m              output mesh structure and quit\n";
             std::cout << "  -t hh:mm:ss     wall time limit for final output\n";
             std::cout << "  -h              this help\n";
@@ -207,6 +293,16 @@ int main(int argc, char *argv[]) {
     } // else if argv[i] not of form "-?" ignore it here (tested in ModifyFromCmdline)
   }
 
+  // with -c and no input or restart file, just show configuration and quit
+  if (carg_flag && restart_file.empty() && input_file.empty()) {
+    if (global_variable::my_rank == 0) ShowConfig();
+    Kokkos::finalize();
+#if MPI_PARALLEL_ENABLED
+    MPI_Finalize();
+#endif
+    return(0);
+  }
+
   // print error if input or restart file not given
   if (restart_file.empty() && input_file.empty()) {
     // no input file is given
@@ -243,6 +339,24 @@ int main(int argc, char *argv[]) {
     infile.Close();
   }
   pinput->ModifyFromCmdline(argc, argv);
+  double t_params = timer.seconds();  // startup phase timings reported after Step 6
+
+  // With -c and an input file, show configuration and the estimated per-rank device
+  // memory footprint of the run described by the input file, then quit.  Nothing has
+  // been allocated yet, so jobs can be sized to GPUs without trial runs.
+  if (carg_flag) {
+    if (global_variable::my_rank == 0) {
+      ShowConfig();
+      memlog::EstimateFootprint(pinput);
+    }
+    if (res_flag) restartfile.Close();
+    delete pinput;
+    Kokkos::finalize();
+#if MPI_PARALLEL_ENABLED
+    MPI_Finalize();
+#endif
+    return(0);
+  }
 
   // Dump input parameters and quit if code was run with -n option.
   if (narg_flag) {
@@ -267,6 +381,7 @@ int main(int argc, char *argv[]) {
   } else {
     pmesh->BuildTreeFromRestart(pinput, restartfile);
   }
+  double t_tree = timer.seconds();
 
   //  If code was run with -m option, write mesh structure to file and quit.
   if (marg_flag) {
@@ -295,6 +410,7 @@ int main(int argc, char *argv[]) {
     pmesh->pgen = std::make_unique<ProblemGenerator>(pinput, pmesh, restartfile);
     restartfile.Close();
   }
+  double t_pgen = timer.seconds();
 
   //--- Step 6. --------------------------------------------------------------------------
   // Construct Driver and Outputs. Actual outputs (including initial conditions) are made
@@ -304,6 +420,18 @@ int main(int argc, char *argv[]) {
   Driver* pdriver = new Driver(pinput, pmesh, wtlim, &timer);
   Outputs* pout = new Outputs(pinput, pmesh);
 
+  // report time spent in each startup phase: parameter loading, Mesh/tree construction,
+  // physics + problem generator (which includes any EOS/opacity table loads and, on
+  // restarts, reading the MeshBlock data), and Driver/Outputs construction
+  if (global_variable::my_rank == 0) {
+    double t_setup = timer.seconds();
+    std::cout << std::endl << "Startup phase times:" << std::setprecision(4) << std::endl
+              << "  input parameters = " << t_params << " sec" << std::endl
+              << "  mesh/tree build  = " << (t_tree - t_params) << " sec" << std::endl
+              << "  physics and pgen = " << (t_pgen - t_tree) << " sec" << std::endl
+              << "  driver + outputs = " << (t_setup - t_pgen) << " sec" << std::endl;
+  }
+
   //--- Step 7. --------------------------------------------------------------------------
   // Execute Driver.
   //    1. Initial conditions set in Driver::Initialize()
@@ -303,7 +303,12 @@ void Mesh::BuildTreeFromScratch(ParameterInput *pin) {
   // set initial time/cycle parameters, output diagnostics
   time = pin->GetOrAddReal("time", "start_time", 0.0);
   dt   = std::numeric_limits<float>::max();
+  dt_diff = std::numeric_limits<float>::max();
   cfl_no = pin->GetReal("time", "cfl_number");
+  deferred_dt = pin->GetOrAddBoolean("time", "deferred_dt", false);
+  dt_safety = pin->GetOrAddReal("time", "dt_safety_factor", 0.9);
+  dt_eval_max = pin->GetOrAddInteger("time", "dt_eval_max_interval", 1);
+  dt_eval_tol = pin->GetOrAddReal("time", "dt_eval_tol", 1.0e-3);
   ncycle = 0;
   if (global_variable::my_rank == 0) {PrintMeshDiagnostics();}
 
@@ -419,10 +424,12 @@ void Mesh::BuildTreeFromRestart(ParameterInput *pin, IOWrapper &resfile) {
   delete [] idlist;
   if (!adaptive) max_level = current_level;
 
-  // rebuild the MeshBlockTree
+  // rebuild the MeshBlockTree; list in restart file is Z-order sorted (it was written
+  // from the output of CreateZOrderedLLList), so nodes can be bulk-loaded in O(nmb_total)
+  // operations instead of inserting every location one-by-one from the root
   ptree = std::make_unique<MeshBlockTree>(this);
   ptree->CreateRootGrid();
-  for (int i=0; i<nmb_total; i++) {ptree->AddNodeWithoutRefinement(lloc_eachmb[i]);}
+  ptree->AddZOrderedNodes(lloc_eachmb, nmb_total);
 
   // check the tree structure by making sure total # of MBs counted in tree same as the
   // number read from the restart file.
@@ -486,5 +493,9 @@ void Mesh::BuildTreeFromRestart(ParameterInput *pin, IOWrapper &resfile) {
 
   // set remaining parameters, output diagnostics
   cfl_no = pin->GetReal("time", "cfl_number");
+  deferred_dt = pin->GetOrAddBoolean("time", "deferred_dt", false);
+  dt_safety = pin->GetOrAddReal("time", "dt_safety_factor", 0.9);
+  dt_eval_max = pin->GetOrAddInteger("time", "dt_eval_max_interval", 1);
+  dt_eval_tol = pin->GetOrAddReal("time", "dt_eval_tol", 1.0e-3);
   if (global_variable::my_rank == 0) {PrintMeshDiagnostics();}
 }
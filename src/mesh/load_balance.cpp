@@ -11,6 +11,7 @@
 #include <limits> // numeric_limits<>
 #include <algorithm> // max
 #include <utility> // make_pair
+#include <vector>
 
 #include "athena.hpp"
 #include "globals.hpp"
@@ -18,6 +19,7 @@
 #include "hydro/hydro.hpp"
 #include "mhd/mhd.hpp"
 #include "z4c/z4c.hpp"
+#include "particles/particles.hpp"
 
 #if MPI_PARALLEL_ENABLED
 #include <mpi.h>
@@ -44,8 +46,10 @@ void Mesh::LoadBalance(float *clist, int *rlist, int *slist, int *nlist, int nb)
     max_cost = std::max(max_cost,clist[i]);
   }
 
-  int j = (global_variable::nranks) - 1;
-  float targetcost = totalcost/global_variable::nranks;
+  // distribute over the active ranks only; nranks_active < nranks when an elastic
+  // rescale has drained ranks (see MeshRefinement::CheckElasticRescale)
+  int j = nranks_active - 1;
+  float targetcost = totalcost/nranks_active;
   float mycost = 0.0;
   // create rank list from the end: the master MPI rank should have less load
   for (int i=nb-1; i>=0; i--) {
@@ -65,15 +69,35 @@ void Mesh::LoadBalance(float *clist, int *rlist, int *slist, int *nlist, int nb)
       targetcost = totalcost/(j+1);
     }
   }
-  slist[0] = 0;
-  j = 0;
-  for (int i=1; i<nb; i++) { // make the list of nbstart and nblocks
+#if MPI_PARALLEL_ENABLED
+  // with topology-aware placement, remap each curve segment to a rank chosen so that
+  // curve-adjacent segments (which exchange the most boundary data) share nodes.
+  // Skipped while ranks are drained, since the remap could assign blocks to ranks that
+  // an elastic rescale request explicitly evacuated
+  if (lb_topo_aware && (nranks_active == global_variable::nranks)) {
+    if (lb_rank_order == nullptr) {BuildRankOrder();}
+    for (int i=0; i<nb; i++) {rlist[i] = lb_rank_order[rlist[i]];}
+  }
+#endif
+
+  // make the lists of starting gid and number of MBs on each rank.  Each rank owns one
+  // contiguous segment of the curve, though segments need not be assigned to ranks in
+  // curve order when topology-aware placement is enabled.  Drained ranks appear in no
+  // segment, so initialize every rank as empty (starting past the end of the curve)
+  for (int r=0; r<(global_variable::nranks); r++) {
+    slist[r] = nb;
+    nlist[r] = 0;
+  }
+  int sstart = 0;
+  for (int i=1; i<nb; i++) {
     if (rlist[i] != rlist[i-1]) {
-      nlist[j] = i-slist[j];
-      slist[++j] = i;
+      slist[rlist[i-1]] = sstart;
+      nlist[rlist[i-1]] = i - sstart;
+      sstart = i;
     }
   }
-  nlist[j] = nb-slist[j];
+  slist[rlist[nb-1]] = sstart;
+  nlist[rlist[nb-1]] = nb - sstart;
 
 #if MPI_PARALLEL_ENABLED
   if (nb % global_variable::nranks != 0
@@ -86,6 +110,114 @@ void Mesh::LoadBalance(float *clist, int *rlist, int *slist, int *nlist, int nb)
   return;
 }
 
+#if MPI_PARALLEL_ENABLED
+//----------------------------------------------------------------------------------------
+//! \fn void Mesh::BuildRankOrder()
+//! \brief Orders MPI ranks so that ranks sharing a physical node receive consecutive
+//! segments of the Z-order curve.  Curve-adjacent segments exchange the most boundary
+//! data, so grouping them onto nodes keeps those exchanges on fast intra-node paths
+//! regardless of how the launcher numbered the ranks.  The ordering depends only on the
+//! node membership of each rank, so it is built once and reused by every call to
+//! LoadBalance(), including during AMR redistribution.
+
+void Mesh::BuildRankOrder() {
+  int nranks = global_variable::nranks;
+  lb_rank_order = new int[nranks];
+
+  // identify node membership of each rank by the world rank of its node leader
+  MPI_Comm node_comm;
+  MPI_Comm_split_type(MPI_COMM_WORLD, MPI_COMM_TYPE_SHARED, 0, MPI_INFO_NULL,
+                      &node_comm);
+  int node_id = global_variable::my_rank;
+  MPI_Bcast(&node_id, 1, MPI_INT, 0, node_comm);
+  MPI_Comm_free(&node_comm);
+  std::vector<int> node_eachrank(nranks);
+  MPI_Allgather(&node_id, 1, MPI_INT, node_eachrank.data(), 1, MPI_INT, MPI_COMM_WORLD);
+
+  // assign segments to ranks sorted by (node, rank).  The node leader is the lowest
+  // world rank on each node, so with the usual block mapping of ranks to nodes this
+  // reduces to the identity and the default distribution is untouched
+  std::vector<std::pair<int,int>> keys(nranks);
+  for (int r=0; r<nranks; ++r) {keys[r] = std::make_pair(node_eachrank[r], r);}
+  std::sort(keys.begin(), keys.end());
+  for (int s=0; s<nranks; ++s) {lb_rank_order[s] = keys[s].second;}
+  return;
+}
+#endif
+
+//----------------------------------------------------------------------------------------
+//! \fn void Mesh::UpdateMeshBlockCosts(float wtime)
+//! \brief Folds measured wall-clock time spent in kernel work this cycle into the
+//! smoothed cost of each MeshBlock on this rank.  Since all MeshBlocks on a rank are
+//! grouped into packs that execute together, the measured time is attributed evenly
+//! across local MeshBlocks; rank-to-rank variations (e.g. FOFC-heavy shocked regions)
+//! are still captured and persist through redistribution.  With particles and a nonzero
+//! <loadbalancing>/particle_weight the attribution is instead proportional to each
+//! MeshBlock's share of (ncells + weight*nparticles), so blocks holding many particles
+//! (e.g. clumps in streaming-instability runs) carry a higher cost and the partition in
+//! LoadBalance() equalizes combined fluid+particle work rather than block count alone.
+//! Called by Driver each cycle when automatic (timer-based) load balancing is enabled.
+
+void Mesh::UpdateMeshBlockCosts(float wtime) {
+  if (nmb_thisrank == 0) return;
+  int mbs = gids_eachrank[global_variable::my_rank];
+
+  particles::Particles *ppart = pmb_pack->ppart;
+  if ((ppart != nullptr) && (lb_prtcl_weight > 0.0)) {
+    // count particles in each local MeshBlock on the device.  Particle data is only
+    // ever resident on the device, so a small atomic histogram over gids is cheaper
+    // than staging positions to the host
+    int nmb = nmb_thisrank;
+    int npart = ppart->nprtcl_thispack;
+    DvceArray1D<int> nprtcl_eachmb("lb_pcount", nmb);
+    Kokkos::deep_copy(nprtcl_eachmb, 0);
+    if (npart > 0) {
+      auto &pi = ppart->prtcl_idata;
+      auto gids = pmb_pack->gids;
+      par_for("lb_pcount",DevExeSpace(),0,(npart-1),
+      KOKKOS_LAMBDA(const int p) {
+        Kokkos::atomic_fetch_add(&nprtcl_eachmb(pi(PGID,p) - gids), 1);
+      });
+    }
+    auto nprtcl_eachmb_h = Kokkos::create_mirror_view(nprtcl_eachmb);
+    Kokkos::deep_copy(nprtcl_eachmb_h, nprtcl_eachmb);
+
+    // apportion measured time over local MeshBlocks by their weighted work, with one
+    // cell update as the unit and particle_weight the relative cost of one particle
+    float ncells = static_cast<float>(NumberOfMeshBlockCells());
+    float totwork = 0.0;
+    for (int m=0; m<nmb; ++m) {
+      totwork += ncells + lb_prtcl_weight*static_cast<float>(nprtcl_eachmb_h(m));
+    }
+    for (int m=0; m<nmb; ++m) {
+      float work = ncells + lb_prtcl_weight*static_cast<float>(nprtcl_eachmb_h(m));
+      float cost = wtime*(work/totwork);
+      cost_eachmb[mbs+m] = (1.0 - lb_alpha)*cost_eachmb[mbs+m] + lb_alpha*cost;
+    }
+    return;
+  }
+
+  float cost = wtime/static_cast<float>(nmb_thisrank);
+  for (int m=0; m<nmb_thisrank; ++m) {
+    cost_eachmb[mbs+m] = (1.0 - lb_alpha)*cost_eachmb[mbs+m] + lb_alpha*cost;
+  }
+  return;
+}
+
+//----------------------------------------------------------------------------------------
+//! \fn void Mesh::SyncMeshBlockCosts()
+//! \brief Gathers measured MeshBlock costs across all ranks.  Each rank only updates the
+//! slice of cost_eachmb for its own MeshBlocks, so the full list must be synchronized
+//! before it is passed to LoadBalance() during AMR redistribution.
+
+void Mesh::SyncMeshBlockCosts() {
+#if MPI_PARALLEL_ENABLED
+  MPI_Allgatherv(MPI_IN_PLACE, nmb_thisrank, MPI_FLOAT, cost_eachmb,
+                 nmb_eachrank, gids_eachrank, MPI_FLOAT, MPI_COMM_WORLD);
+#endif
+  return;
+}
+
 //----------------------------------------------------------------------------------------
 //! \fn void MeshRefinement::InitRecvAMR()
 //! \brief Allocates and initializes receive buffers, and posts non-blocking receives,
@@ -126,14 +258,19 @@ void MeshRefinement::InitRecvAMR(int nleaf) {
   }
   if (nmb_recv == 0) return;  // nothing to do
 
-  // allocate array of recv buffers
-  Kokkos::realloc(recvbuf, nmb_recv);
-  recv_req = new MPI_Request[nmb_recv];
+  // grow pooled array of recv buffers only if this event needs more than any previous
+  if (nmb_recv > recvbuf_cap) {
+    recvbuf_cap = std::max(2*recvbuf_cap, nmb_recv);
+    Kokkos::realloc(recvbuf, recvbuf_cap);
+    delete [] recv_req;
+    recv_req = new MPI_Request[recvbuf_cap];
+  }
   for (int n=0; n<nmb_recv; ++n) {
     recv_req[n] = MPI_REQUEST_NULL;
   }
 
   // count number of cell- and face-centered variables communicated depending on physics
+  // (see PackAndSendAMR below for the split of what is and is not communicated)
   int ncc_tosend=0, nfc_tosend=0;
   if (pmy_mesh->pmb_pack->phydro != nullptr) {
     ncc_tosend += (pmy_mesh->pmb_pack->phydro->nhydro);
@@ -253,12 +390,15 @@ void MeshRefinement::InitRecvAMR(int nleaf) {
       }
     }
   }
-  // Sync dual array, reallocate receive data array
+  // Sync dual array, grow pooled receive data array if needed
   recvbuf.template modify<HostMemSpace>();
   recvbuf.template sync<DevExeSpace>();
   {
     int ndata = recvbuf.h_view((nmb_recv-1)).offset + recvbuf.h_view((nmb_recv-1)).cnt;
-    Kokkos::realloc(recv_data, ndata);
+    if (ndata > recv_data_cap) {
+      recv_data_cap = std::max(2*recv_data_cap, ndata);
+      Kokkos::realloc(recv_data, recv_data_cap);
+    }
   }
 
   // Step 3. (InitRecvAMR)
@@ -376,14 +516,27 @@ void MeshRefinement::PackAndSendAMR(int nleaf) {
 
   if (nmb_send == 0) return;  // nothing to do
 
-  // allocate array of send buffers
-  Kokkos::realloc(sendbuf, nmb_send);
-  send_req = new MPI_Request[nmb_send];
+  // grow pooled array of send buffers only if this event needs more than any previous
+  if (nmb_send > sendbuf_cap) {
+    sendbuf_cap = std::max(2*sendbuf_cap, nmb_send);
+    Kokkos::realloc(sendbuf, sendbuf_cap);
+    delete [] send_req;
+    send_req = new MPI_Request[sendbuf_cap];
+  }
   for (int n=0; n<nmb_send; ++n) {
     send_req[n] = MPI_REQUEST_NULL;
   }
 
-  // count number of cell- and face-centered variables communicated depending on physics
+  // count number of cell- and face-centered variables communicated depending on physics.
+  // Only state that cannot be rebuilt on the receiving rank is shipped: the evolved
+  // conserved variables and face-centered fields (with the coarse arrays standing in as
+  // the restricted source for de-refined blocks).  Everything else attached to a
+  // MeshBlock is reconstructed on arrival instead of moved -- primitives by the c2p
+  // pass in InitBoundaryValuesAndPrimitives(), cell-centered fields from the shipped
+  // face-centered ones, coarse arrays by per-stage restriction, and flux/scratch arrays
+  // by the next stage that writes them.  Physics modules added here must keep to this
+  // split, or AMR payloads (and the pooled send/recv data arrays, which grow to the
+  // high-water mark of all events) inflate with data the receiver could have rebuilt.
   int ncc_tosend=0, nfc_tosend=0;
   if (pmy_mesh->pmb_pack->phydro != nullptr) {
     ncc_tosend += (pmy_mesh->pmb_pack->phydro->nhydro);
@@ -505,12 +658,15 @@ void MeshRefinement::PackAndSendAMR(int nleaf) {
       }
     }
   }
-  // Sync dual array, reallocate send data array
+  // Sync dual array, grow pooled send data array if needed
   sendbuf.template modify<HostMemSpace>();
   sendbuf.template sync<DevExeSpace>();
   {
     int ndata = sendbuf.h_view((nmb_send-1)).offset + sendbuf.h_view((nmb_send-1)).cnt;
-    Kokkos::realloc(send_data, ndata);
+    if (ndata > send_data_cap) {
+      send_data_cap = std::max(2*send_data_cap, ndata);
+      Kokkos::realloc(send_data, send_data_cap);
+    }
   }
 
   // Step 3. (PackAndSendAMR)
@@ -796,7 +952,6 @@ void MeshRefinement::ClearRecvAndUnpackAMR() {
               << std::endl;
     std::exit(EXIT_FAILURE);
   }
-  delete [] recv_req;
 
   // Unpack data
   hydro::Hydro* phydro = pmy_mesh->pmb_pack->phydro;
@@ -1003,7 +1158,6 @@ void MeshRefinement::ClearSendAMR() {
               << std::endl;
     std::exit(EXIT_FAILURE);
   }
-  delete [] send_req;
 #endif
   return;
 }
@@ -6,6 +6,8 @@
 //! \file mesh.cpp
 //  \brief implementation of constructor and functions in Mesh class
 
+#include <math.h>
+
 #include <algorithm>
 #include <cinttypes>
 #include <iostream>
@@ -280,6 +282,54 @@ Mesh::Mesh(ParameterInput *pin) :
     std::exit(EXIT_FAILURE);
   }
 
+  // Options for load balancing.  With "balancer = timer" the distribution of MeshBlocks
+  // over ranks is computed from per-MeshBlock costs measured by timing the kernel work
+  // each cycle (see Driver::Execute), smoothed with an exponential moving average.
+  lb_automatic = false;
+  lb_alpha = 0.5;
+  lb_prtcl_weight = 0.0;
+  lb_topo_aware = false;
+  lb_elastic = false;
+  lb_elastic_ncyc = 100;
+  nranks_active = global_variable::nranks;
+  if (pin->DoesBlockExist("loadbalancing")) {
+    std::string balancer = pin->GetOrAddString("loadbalancing", "balancer", "static");
+    if (balancer.compare("timer") == 0) {
+      lb_automatic = true;
+    } else if (balancer.compare("static") != 0) {
+      std::cout << "### FATAL ERROR in " << __FILE__ << " at line " << __LINE__
+                << std::endl << "<loadbalancing> balancer = '" << balancer
+                << "' not implemented. Valid choices are [static,timer]." << std::endl;
+      std::exit(EXIT_FAILURE);
+    }
+    lb_alpha = pin->GetOrAddReal("loadbalancing", "alpha", 0.5);
+    // cost of advancing one particle relative to updating one cell, used with the timer
+    // balancer to apportion each rank's measured time over its MeshBlocks by particle
+    // count (see Mesh::UpdateMeshBlockCosts).  Measure it from the ratio of the particle
+    // push/comm task timers to the fluid task timers in the profiler dump; the default
+    // 0.0 attributes measured time evenly across MeshBlocks as before
+    lb_prtcl_weight = pin->GetOrAddReal("loadbalancing", "particle_weight", 0.0);
+    // optionally assign curve-adjacent segments of the Z-order curve to MPI ranks that
+    // share a physical node, so the heaviest neighbor exchanges stay intra-node even
+    // when the launcher scatters consecutive ranks across nodes (e.g. cyclic mapping)
+    lb_topo_aware = pin->GetOrAddBoolean("loadbalancing", "topology_aware", false);
+    // optionally allow the number of active ranks to be changed at a cycle boundary
+    // while the job is running (see MeshRefinement::CheckElasticRescale), so jobs in
+    // preemptible allocations can evacuate ranks without a checkpoint round-trip
+    lb_elastic = pin->GetOrAddBoolean("loadbalancing", "elastic", false);
+    lb_elastic_ncyc = pin->GetOrAddInteger("loadbalancing", "elastic_ncycle_check", 100);
+  }
+#if !(MPI_PARALLEL_ENABLED)
+  lb_topo_aware = false;
+  lb_elastic = false;
+#endif
+  if (lb_elastic && !(multilevel)) {
+    std::cout << "### FATAL ERROR in " << __FILE__ << " at line " << __LINE__ << std::endl
+      << "<loadbalancing> elastic = true uses the AMR redistribution machinery, so it "
+      << "requires a <mesh_refinement> block." << std::endl;
+    std::exit(EXIT_FAILURE);
+  }
+
   // initialize indices for Mesh cells, MeshBlock cells, and MeshBlock coarse cells
   mb_indcs.ng  = mesh_indcs.ng;
   mb_indcs.cnx1 = mb_indcs.nx1/2;
@@ -335,6 +385,11 @@ Mesh::Mesh(ParameterInput *pin) :
 // destructor
 
 Mesh::~Mesh() {
+#if MPI_PARALLEL_ENABLED
+  // complete any timestep reduction still in flight (deferred mode) before finalize
+  if (dt_req_active_) {MPI_Wait(&dt_req_, MPI_STATUS_IGNORE);}
+  delete [] lb_rank_order;
+#endif
   delete [] cost_eachmb;
   delete [] rank_eachmb;
   delete [] lloc_eachmb;
@@ -380,6 +435,19 @@ void Mesh::PrintMeshDiagnostics() {
                   << cost_per_plevel[i-root_level] <<  std::endl;
       }
     }
+
+    // estimate of the speedup available from hierarchical subcycling (per-level dt with
+    // 2:1 stepping between levels, assuming hyperbolic dt ~ dx): ratio of MeshBlock
+    // updates per unit time when every level advances at the global (finest-level) dt,
+    // as now, to when each level advances at its own stable dt
+    double work_single = 0.0, work_multi = 0.0;
+    int nplevel = max_level - root_level;
+    for (int i=0; i<=nplevel; ++i) {
+      work_single += static_cast<double>(nb_per_plevel[i])*(1 << nplevel);
+      work_multi  += static_cast<double>(nb_per_plevel[i])*(1 << i);
+    }
+    std::cout << "  Hierarchical subcycling headroom (hyperbolic dt ~ dx) = "
+              << work_single/work_multi << "x" << std::endl;
   }
 
   std::cout << "Number of parallel ranks = " << global_variable::nranks << std::endl;
@@ -563,8 +631,44 @@ std::string Mesh::GetBoundaryString(BoundaryFlag input_flag) {
 
 //----------------------------------------------------------------------------------------
 // \fn Mesh::NewTimeStep()
+// \brief compute global timestep.  Kept as the blocking combination of the Start/Finish
+// pair below for callers outside the main cycle loop (e.g. Driver::Initialize)
 
 void Mesh::NewTimeStep(const Real tlim) {
+  NewTimeStepStart();
+  NewTimeStepFinish(tlim);
+  return;
+}
+
+//----------------------------------------------------------------------------------------
+// \fn Mesh::NewTimeStepStart()
+// \brief compute minimum timestep over all MeshBlocks on this rank and post the global
+// min reduction without blocking, so that the collective overlaps output/diagnostic work
+// until NewTimeStepFinish() is called.  With deferred_dt, also completes the reduction
+// left in flight by the PREVIOUS cycle (which by now has had an entire cycle of task
+// work to progress) and checks a posteriori that the deferred timestep just used did not
+// exceed the true global minimum; if it did, a flag is set so that NewTimeStepFinish()
+// re-syncs through the blocking path
+
+void Mesh::NewTimeStepStart() {
+#if MPI_PARALLEL_ENABLED
+  if (dt_req_active_) {
+    MPI_Wait(&dt_req_, MPI_STATUS_IGNORE);
+    dt_req_active_ = false;
+    if (dt > dt_flight_[0]) {
+      dt_resync_ = true;
+      if (global_variable::my_rank == 0) {
+        std::cout << "### WARNING! in " << __FILE__ << " at line " << __LINE__
+           << std::endl << "deferred timestep dt=" << dt << " exceeded global minimum "
+           << dt_flight_[0] << " on last cycle, re-syncing" << std::endl;
+      }
+    }
+    dt_global_[0] = dt_flight_[0];
+    dt_global_[1] = dt_flight_[1];
+    dt_global_valid_ = true;
+  }
+#endif
+
   // save old timestep
   dtold = dt;
   if (dt == std::numeric_limits<float>::max()) {
@@ -576,16 +680,20 @@ void Mesh::NewTimeStep(const Real tlim) {
   // limit increase in timestep to 2x old value
   dt = 2.0*dt;
 
+  // diffusion (parabolic) timestep accumulated separately, so that it can be excluded
+  // from dt when diffusion terms are advanced with operator-split super-time-stepping
+  dt_diff = static_cast<Real>(std::numeric_limits<float>::max());
+
   // Hydro timestep
   if (pmb_pack->phydro != nullptr) {
     dt = std::min(dt, (cfl_no)*(pmb_pack->phydro->dtnew) );
     // viscosity timestep
     if (pmb_pack->phydro->pvisc != nullptr) {
-      dt = std::min(dt, (cfl_no)*(pmb_pack->phydro->pvisc->dtnew) );
+      dt_diff = std::min(dt_diff, (cfl_no)*(pmb_pack->phydro->pvisc->dtnew) );
     }
     // thermal conduction timestep
     if (pmb_pack->phydro->pcond != nullptr) {
-      dt = std::min(dt, (cfl_no)*(pmb_pack->phydro->pcond->dtnew) );
+      dt_diff = std::min(dt_diff, (cfl_no)*(pmb_pack->phydro->pcond->dtnew) );
     }
     // source terms timestep
     dt = std::min(dt, (cfl_no)*(pmb_pack->phydro->psrc->dtnew) );
@@ -595,19 +703,24 @@ void Mesh::NewTimeStep(const Real tlim) {
     dt = std::min(dt, (cfl_no)*(pmb_pack->pmhd->dtnew) );
     // viscosity timestep
     if (pmb_pack->pmhd->pvisc != nullptr) {
-      dt = std::min(dt, (cfl_no)*(pmb_pack->pmhd->pvisc->dtnew) );
+      dt_diff = std::min(dt_diff, (cfl_no)*(pmb_pack->pmhd->pvisc->dtnew) );
     }
     // resistivity timestep
     if (pmb_pack->pmhd->presist != nullptr) {
-      dt = std::min(dt, (cfl_no)*(pmb_pack->pmhd->presist->dtnew) );
+      dt_diff = std::min(dt_diff, (cfl_no)*(pmb_pack->pmhd->presist->dtnew) );
     }
     // thermal conduction timestep
     if (pmb_pack->pmhd->pcond != nullptr) {
-      dt = std::min(dt, (cfl_no)*(pmb_pack->pmhd->pcond->dtnew) );
+      dt_diff = std::min(dt_diff, (cfl_no)*(pmb_pack->pmhd->pcond->dtnew) );
     }
     // source terms timestep
     dt = std::min(dt, (cfl_no)*(pmb_pack->pmhd->psrc->dtnew) );
   }
+  // with super-time-stepping diffusion does not limit dt; otherwise fold the parabolic
+  // restriction into dt as usual
+  if (!sts_split) {
+    dt = std::min(dt, dt_diff);
+  }
   // z4c timestep
   if (pmb_pack->pz4c != nullptr) {
     dt = std::min(dt, (cfl_no)*(pmb_pack->pz4c->dtnew) );
@@ -622,13 +735,79 @@ void Mesh::NewTimeStep(const Real tlim) {
   }
 
 #if MPI_PARALLEL_ENABLED
-  // get minimum dt over all MPI ranks
-  MPI_Allreduce(MPI_IN_PLACE, &dt, 1, MPI_ATHENA_REAL, MPI_MIN, MPI_COMM_WORLD);
+  // post non-blocking reduction for minimum dt over all MPI ranks.  Unlike the history
+  // sums, MIN is insensitive to evaluation order, so this reduction is already bitwise
+  // reproducible across rank counts and needs no deterministic alternative
+  dt_flight_[0] = dt;
+  dt_flight_[1] = dt_diff;
+  MPI_Iallreduce(MPI_IN_PLACE, dt_flight_, 2, MPI_ATHENA_REAL, MPI_MIN,
+                 MPI_COMM_WORLD, &dt_req_);
+  dt_req_active_ = true;
+#endif
+  return;
+}
+
+//----------------------------------------------------------------------------------------
+// \fn Mesh::NewTimeStepFinish()
+// \brief complete the global timestep reduction posted in NewTimeStepStart().  In
+// deferred mode the reduction is instead left in flight and last cycle's reduced dt is
+// applied with a safety factor, removing the collective from the critical path entirely
+// when dt varies smoothly.  The blocking path is taken until a first reduction has
+// completed and whenever the a-posteriori check in NewTimeStepStart() flags a violation.
+// Also adapts the dt-evaluation cadence: when dt has changed by less than dt_eval_tol
+// between cycles the interval between full per-cell dt reductions is doubled (up to
+// dt_eval_max_interval), and on the intervening cycles dt_full_eval is cleared so that
+// the module NewTimeStep tasks skip their reductions and reuse dtnew
+
+void Mesh::NewTimeStepFinish(const Real tlim) {
+#if MPI_PARALLEL_ENABLED
+  if (deferred_dt && dt_global_valid_ && !dt_resync_) {
+    // deferred dt is built only from globally-reduced values (and dtold, itself global),
+    // so it is identical on every rank even though no collective completes this cycle
+    dt = dt_safety*dt_global_[0];
+    if (dt > 2.0*dtold) {dt = 2.0*dtold;}
+    dt_diff = dt_safety*dt_global_[1];
+  } else {
+    MPI_Wait(&dt_req_, MPI_STATUS_IGNORE);
+    dt_req_active_ = false;
+    dt_global_[0] = dt_flight_[0];
+    dt_global_[1] = dt_flight_[1];
+    dt_global_valid_ = true;
+    dt = dt_global_[0];
+    dt_diff = dt_global_[1];
+    dt_resync_ = false;
+  }
 #endif
 
   // limit last time step to stop at tlim *exactly*
   if ( (time < tlim) && ((time + dt) > tlim) ) {dt = tlim - time;}
 
+  // adaptive dt-evaluation cadence (disabled with AMR, where every regridding changes
+  // the cell sizes that enter dtnew).  NewTimeStepStart() and the global reduction above
+  // still run every cycle: they cost only host-side minimums plus a non-blocking
+  // collective, and they propagate any drop in dtnew flagged by the wavespeed monitors
+  // fused into ConsToPrim, which keep refreshing dtnew even on skipped cycles
+  if ((dt_eval_max > 1) && !adaptive) {
+    if (dt_full_eval) {
+      // stretch the interval while dt is quasi-steady, otherwise re-evaluate each cycle
+      if ((dtold > 0.0) && (fabs(dt - dtold) < dt_eval_tol*dt)) {
+        dt_eval_interval_ = std::min(2*dt_eval_interval_, dt_eval_max);
+      } else {
+        dt_eval_interval_ = 1;
+      }
+      dt_eval_count_ = dt_eval_interval_ - 1;
+    } else {
+      dt_eval_count_--;
+      // a signal-speed jump caught by the fused monitors lowers dt mid-interval; fall
+      // back to evaluating every cycle until dt is steady again
+      if (dt < (1.0 - dt_eval_tol)*dtold) {
+        dt_eval_interval_ = 1;
+        dt_eval_count_ = 0;
+      }
+    }
+    dt_full_eval = (dt_eval_count_ <= 0);
+  }
+
   return;
 }
 
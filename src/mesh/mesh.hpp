@@ -17,6 +17,10 @@
 
 #include "athena.hpp"
 
+#if MPI_PARALLEL_ENABLED
+#include <mpi.h>
+#endif
+
 // Define following structure before other "include" files to resolve declarations
 //----------------------------------------------------------------------------------------
 //! \struct RegionSize
@@ -32,6 +36,10 @@ struct RegionSize {
 //----------------------------------------------------------------------------------------
 //! \struct RegionIndcs
 //! \brief Cell indices and number of active and ghost cells in a Mesh or a MeshBlock
+//! WARNING: a single MeshBlock size shared by every block (and level) is a load-bearing
+//! invariant, not a convenience: the flattened 1D-range kernels, boundary buffer sizing,
+//! output staging, and the restart file layout all index blocks as equal-sized slabs of
+//! one MeshBlockPack.  Level-dependent block sizes would require one pack per level.
 
 struct RegionIndcs {
   int ng;                       // number of ghost cells
@@ -69,9 +77,14 @@ struct LogicalLocation {
 //! \brief stores various counters used as diagnostics throughout the code
 
 struct EventCounters {
+  // number of bins in the c2p solver iteration histogram (last bin counts overflows)
+  static const int nhist_c2p = 8;
   int nfofc, neos_dfloor, neos_efloor, neos_tfloor, neos_vceil, neos_fail, maxit_c2p;
+  int nc2p_iter[nhist_c2p];  // histogram of iteration counts used by iterative solvers
   EventCounters() : nfofc(0), neos_dfloor(0), neos_efloor(0), neos_tfloor(0),
-                    neos_vceil(0), neos_fail(0), maxit_c2p(0) {}
+                    neos_vceil(0), neos_fail(0), maxit_c2p(0) {
+    for (int n=0; n<nhist_c2p; ++n) {nc2p_iter[n] = 0;}
+  }
 };
 
 // Forward declarations required due to recursive definitions amongst mesh classes
@@ -127,6 +140,14 @@ class Mesh {
   int nprtcl_thisrank;     // number of particles this rank
   int nprtcl_total;        // total number of particles across all ranks
 
+  bool lb_automatic;       // balance using measured kernel timings instead of unit costs
+  bool lb_elastic;         // allow changing number of active ranks while running
+  int lb_elastic_ncyc;     // cycles between checks for an elastic rescale request
+  int nranks_active;       // number of ranks currently assigned MeshBlocks
+  float lb_alpha;          // exponential smoothing parameter for measured costs
+  float lb_prtcl_weight;   // cost of one particle relative to one cell update
+  bool lb_topo_aware;      // group curve-adjacent rank segments onto shared nodes
+
   // following 3x arrays allocated with length [nmb_total] in BuildTreeFromXXXX()
   float *cost_eachmb;            // cost of each MeshBlock
   int *rank_eachmb;              // rank of each MeshBlock
@@ -139,6 +160,13 @@ class Mesh {
   int *nprtcl_eachrank;    // number of particles on each rank
 
   Real time, dt, dtold, cfl_no;
+  Real dt_diff;           // most restrictive diffusion (parabolic) timestep
+  bool sts_split=false;   // diffusion advanced by operator-split STS (set by Driver)
+  bool deferred_dt;       // apply reduced dt from previous cycle with safety factor
+  Real dt_safety;         // safety factor applied to deferred global timestep
+  int dt_eval_max;        // max cycles between full dt evaluations (1 = every cycle)
+  Real dt_eval_tol;       // relative dt change below which the eval cadence stretches
+  bool dt_full_eval=true; // per-cell dt reductions run this cycle (set by cadence)
   int ncycle;
   EventCounters ecounter;
 
@@ -153,6 +181,10 @@ class Mesh {
   void PrintMeshDiagnostics();
   void WriteMeshStructure();
   void NewTimeStep(const Real tlim);
+  void NewTimeStepStart();
+  void NewTimeStepFinish(const Real tlim);
+  void UpdateMeshBlockCosts(float wtime);
+  void SyncMeshBlockCosts();
   void AddCoordinatesAndPhysics(ParameterInput *pinput);
   BoundaryFlag GetBoundaryFlag(const std::string& input_string);
   std::string GetBoundaryString(BoundaryFlag input_flag);
@@ -176,5 +208,17 @@ class Mesh {
  private:
   std::unique_ptr<MeshBlockTree> ptree;  // pointer to root node in binary/quad/oct-tree
   void LoadBalance(float *clist, int *rlist, int *slist, int *nlist, int nb);
+  int dt_eval_interval_ = 1;  // current number of cycles between full dt evaluations
+  int dt_eval_count_ = 0;     // cycles remaining until the next full evaluation
+#if MPI_PARALLEL_ENABLED
+  int *lb_rank_order = nullptr;   // curve segment -> rank map, built by BuildRankOrder
+  void BuildRankOrder();
+  MPI_Request dt_req_;            // request for in-flight global timestep reduction
+  bool dt_req_active_ = false;    // a reduction posted by NewTimeStepStart is in flight
+  Real dt_flight_[2];             // {dt, dt_diff} buffer for in-flight reduction
+  Real dt_global_[2];             // last completed global {dt, dt_diff}
+  bool dt_global_valid_ = false;  // at least one reduction has completed
+  bool dt_resync_ = false;        // deferred dt violated CFL min; take blocking path
+#endif
 };
 #endif  // MESH_MESH_HPP_
@@ -10,9 +10,11 @@
 //! are used both here for AMR and in the BVals class at fine/coarse boundaries).
 
 #include <cstdint>   // int32_t
+#include <cstdio>    // remove
+#include <fstream>
 #include <iostream>
 #include <cmath>     // abs
-#include <algorithm> // sort
+#include <algorithm> // sort, min
 #include <utility>   // pair
 
 #include "athena.hpp"
@@ -28,6 +30,7 @@
 #include "z4c/z4c_amr.hpp"
 #include "prolongation.hpp"
 #include "restriction.hpp"
+#include "utils/memlog.hpp"
 
 #if MPI_PARALLEL_ENABLED
 #include <mpi.h>
@@ -41,12 +44,17 @@ MeshRefinement::MeshRefinement(Mesh *pm, ParameterInput *pin) :
   pmy_mesh(pm),
   refine_flag("rflag",pm->nmb_total),
   ncyc_since_ref("cyc_since_ref",pm->nmb_total),
+  nderef_count("nderef_count",pm->nmb_total),
   nmb_created(0),
   nmb_deleted(0),
   nmb_sent_thisrank(0),
   ncyc_check_amr(1),
   refinement_interval(5),
+  nchecks_derefine(1),
   prolong_prims(false),
+  pipelined(false),
+  nnew_pending_(0),
+  ndel_pending_(0),
   d_threshold_(0.0),
   dd_threshold_(0.0),
   dp_threshold_(0.0),
@@ -56,10 +64,15 @@ MeshRefinement::MeshRefinement(Mesh *pm, ParameterInput *pin) :
     // read interval (in cycles) between check of AMR and derefinement
     ncyc_check_amr = pin->GetOrAddReal("mesh_refinement", "ncycle_check", 1);
     refinement_interval = pin->GetOrAddReal("mesh_refinement", "refinement_interval", 5);
+    // read # of consecutive checks the derefinement condition must hold before a
+    // MeshBlock is flagged for derefinement (hysteresis against refine/derefine churn)
+    nchecks_derefine = pin->GetOrAddInteger("mesh_refinement", "nchecks_derefine", 1);
     // read prolongate primitives flag
     if (pin->DoesParameterExist("mesh_refinement", "prolong_primitives")) {
       prolong_prims = pin->GetBoolean("mesh_refinement", "prolong_primitives");
     }
+    // read pipelined AMR flag (defer redistribution one cycle after flag evaluation)
+    pipelined = pin->GetOrAddBoolean("mesh_refinement", "pipelined", false);
     // read refinement criteria thresholds
     if (pin->DoesParameterExist("mesh_refinement", "dens_max")) {
       d_threshold_ = pin->GetReal("mesh_refinement", "dens_max");
@@ -90,6 +103,7 @@ MeshRefinement::MeshRefinement(Mesh *pm, ParameterInput *pin) :
   for (int m=0; m<(pm->nmb_total); ++m) {
     refine_flag.h_view(m) = 0;
     ncyc_since_ref(m) = 0;
+    nderef_count(m) = 0;
   }
   refine_flag.template modify<HostMemSpace>();
   refine_flag.template sync<DevExeSpace>();
@@ -113,6 +127,11 @@ MeshRefinement::~MeshRefinement() {
     delete [] nref_rsum;
     delete [] nderef_rsum;
   }
+#if MPI_PARALLEL_ENABLED
+  // deallocate pooled AMR communication request arrays
+  delete [] send_req;
+  delete [] recv_req;
+#endif
 }
 
 //----------------------------------------------------------------------------------------
@@ -120,35 +139,112 @@ MeshRefinement::~MeshRefinement() {
 //! \brief Simple driver function for adaptive mesh refinement
 
 void MeshRefinement::AdaptiveMeshRefinement(Driver *pdriver, ParameterInput *pin) {
-  // first check refinement criteria
+  // With pipelined AMR, first apply any tree update decided during the previous cycle.
+  // The refinement flags and updated tree were computed one cycle ahead, so the
+  // (collective) flag reduction and host-side tree update are off the critical path of
+  // the cycle in which the data is actually moved.
+  if (pipelined && (nnew_pending_ != 0 || ndel_pending_ != 0)) {
+    ApplyMeshUpdate(pdriver, pin, nnew_pending_, ndel_pending_);
+    nnew_pending_ = 0;
+    ndel_pending_ = 0;
+  }
+
+  // check refinement criteria
   CheckForRefinement(pmy_mesh->pmb_pack);
 
   // then update mesh tree if MeshBlock anywhere (on any rank) is flagged for refinement
   int nnew = 0, ndel = 0;
   UpdateMeshBlockTree(nnew, ndel);
 
-  // Refine/derefine mesh and evolved data, set boundary conditions/timestep on new mesh
+  // Refine/derefine mesh and evolved data, set boundary conditions/timestep on new mesh.
+  // With pipelined AMR the redistribution is deferred to the next cycle; integration
+  // continues on the old layout (neighbor lists built before the tree was modified
+  // remain valid) and only synchronizes when the new layout is actually needed.
   if (nnew != 0 || ndel != 0) { // at least one (de)refinement flagged
-    RedistAndRefineMeshBlocks(pin, nnew, ndel);
-    pdriver->InitBoundaryValuesAndPrimitives(pmy_mesh);
-
-    MeshBlockPack* pmbp = pmy_mesh->pmb_pack;
-    if (pmbp->phydro != nullptr) {
-      (void) pmbp->phydro->NewTimeStep(pdriver, pdriver->nexp_stages);
-    }
-    if (pmbp->pmhd != nullptr) {
-      (void) pmbp->pmhd->NewTimeStep(pdriver, pdriver->nexp_stages);
-    }
-    if (pmbp->prad != nullptr) {
-      (void) pmbp->prad->NewTimeStep(pdriver, pdriver->nexp_stages);
-    }
-    if (pmbp->pz4c != nullptr) {
-      (void) pmbp->pz4c->NewTimeStep(pdriver, pdriver->nexp_stages);
+    if (pipelined) {
+      nnew_pending_ = nnew;
+      ndel_pending_ = ndel;
+    } else {
+      ApplyMeshUpdate(pdriver, pin, nnew, ndel);
     }
+  }
+  return;
+}
+
+//----------------------------------------------------------------------------------------
+//! \fn void MeshRefinement::ApplyMeshUpdate()
+//! \brief Redistributes MeshBlocks for an already-updated tree, then resets boundary
+//! values, primitives, and the timestep on the new mesh.  Called either immediately
+//! after UpdateMeshBlockTree(), or one cycle later with pipelined AMR.
+
+void MeshRefinement::ApplyMeshUpdate(Driver *pdriver, ParameterInput *pin,
+                                     int nnew, int ndel) {
+  RedistAndRefineMeshBlocks(pin, nnew, ndel);
+  pdriver->InitBoundaryValuesAndPrimitives(pmy_mesh);
 
-    nmb_created += nnew;
-    nmb_deleted += ndel;
+  MeshBlockPack* pmbp = pmy_mesh->pmb_pack;
+  if (pmbp->phydro != nullptr) {
+    (void) pmbp->phydro->NewTimeStep(pdriver, pdriver->nexp_stages);
+  }
+  if (pmbp->pmhd != nullptr) {
+    (void) pmbp->pmhd->NewTimeStep(pdriver, pdriver->nexp_stages);
+  }
+#if RADIATION_ENABLED
+  if (pmbp->prad != nullptr) {
+    (void) pmbp->prad->NewTimeStep(pdriver, pdriver->nexp_stages);
+  }
+#endif
+  if (pmbp->pz4c != nullptr) {
+    (void) pmbp->pz4c->NewTimeStep(pdriver, pdriver->nexp_stages);
   }
+
+  nmb_created += nnew;
+  nmb_deleted += ndel;
+  return;
+}
+
+//----------------------------------------------------------------------------------------
+//! \fn void MeshRefinement::CheckElasticRescale()
+//! \brief Checks for a rank-rescale request (a file named "rescale_nranks" in the run
+//! directory containing the new number of active ranks) and, if one is found, moves all
+//! MeshBlocks onto the first nranks_active ranks over the network using the AMR
+//! redistribution machinery.  Lets a job in a preemptible allocation evacuate ranks that
+//! are about to be reclaimed (or refill ranks that were returned) at a cycle boundary
+//! without writing and re-reading a checkpoint.  The request file is removed once read,
+//! so each request is applied exactly once.  Enabled with <loadbalancing> elastic = true
+//! and called periodically from Driver::Execute.
+
+void MeshRefinement::CheckElasticRescale(Driver *pdriver, ParameterInput *pin) {
+  Mesh* pm = pmy_mesh;
+  int new_nranks = -1;
+  if (global_variable::my_rank == 0) {
+    std::ifstream rfile("rescale_nranks");
+    if (rfile.is_open()) {
+      if (!(rfile >> new_nranks)) {new_nranks = -1;}
+      rfile.close();
+      std::remove("rescale_nranks");
+      if (new_nranks < 1) {
+        std::cout << "### WARNING in " << __FILE__ << " at line " << __LINE__
+                  << std::endl << "Ignoring invalid rescale_nranks request" << std::endl;
+      }
+    }
+  }
+#if MPI_PARALLEL_ENABLED
+  MPI_Bcast(&new_nranks, 1, MPI_INT, 0, MPI_COMM_WORLD);
+#endif
+  if (new_nranks < 1) {return;}  // no (valid) request pending
+  new_nranks = std::min(new_nranks, global_variable::nranks);
+  if (new_nranks == pm->nranks_active) {return;}
+
+  if (global_variable::my_rank == 0) {
+    std::cout << "\nElastic rescale: redistributing " << pm->nmb_total << " MeshBlocks "
+              << "from " << pm->nranks_active << " to " << new_nranks
+              << " active ranks at cycle=" << pm->ncycle << std::endl;
+  }
+  pm->nranks_active = new_nranks;
+  // no tree changes; redistribution with nnew=ndel=0 just moves MeshBlocks to match the
+  // rank list computed by LoadBalance() for the new active-rank count
+  ApplyMeshUpdate(pdriver, pin, 0, 0);
   return;
 }
 
@@ -173,13 +269,14 @@ void MeshRefinement::CheckForRefinement(MeshBlockPack* pmbp) {
     refine_flag.h_view(m) = 0;
   }
   refine_flag.template modify<HostMemSpace>();
-  refine_flag.template sync<DevExeSpace>();
 
   // increment cycle counter for each MB
   for (int m=0; m<(pmy_mesh->nmb_total); ++m) {
     ncyc_since_ref(m) += 1;
   }
   if ((pmbp->pmesh->ncycle)%(ncyc_check_amr) != 0) {return;}  // not cycle to check
+  // device copy of flags is only read on check cycles, so it is synced only here
+  refine_flag.template sync<DevExeSpace>();
 
   // capture variables for kernels
   auto &multi_d = pmy_mesh->multi_d;
@@ -267,6 +364,28 @@ void MeshRefinement::CheckForRefinement(MeshBlockPack* pmbp) {
   if (pmy_mesh->pgen->user_ref_func != nullptr) {
     pmy_mesh->pgen->user_ref_func(pmbp);
   }
+
+  // Count flagged MeshBlocks on device, so that on the (common) check cycles where no
+  // block anywhere is flagged only this one scalar crosses the device-host boundary,
+  // instead of the full flag array plus an allgather over all ranks
+  int nflagged = 0;
+  Kokkos::parallel_reduce("CountRefineFlag",
+                          Kokkos::RangePolicy<>(DevExeSpace(), 0, nmb),
+  KOKKOS_LAMBDA(const int &m, int &count) {
+    if (refine_flag_.d_view(m+mbs) != 0) {count++;}
+  }, Kokkos::Sum<int>(nflagged));
+#if MPI_PARALLEL_ENABLED
+  MPI_Allreduce(MPI_IN_PLACE, &nflagged, 1, MPI_INT, MPI_SUM, MPI_COMM_WORLD);
+#endif
+  if (nflagged == 0) {
+    // nothing flagged on any rank; flags are still zero on both host and device, and no
+    // block is in a derefine streak, so reset the hysteresis counters and return
+    for (int m=0; m<(pmy_mesh->nmb_total); ++m) {
+      nderef_count(m) = 0;
+    }
+    return;
+  }
+
   // sync device array with host
   refine_flag.template modify<DevExeSpace>();
   refine_flag.template sync<HostMemSpace>();
@@ -291,6 +410,21 @@ void MeshRefinement::CheckForRefinement(MeshBlockPack* pmbp) {
                    MPI_INT, refine_flag.h_view.data(), pmy_mesh->nmb_eachrank,
                    pmy_mesh->gids_eachrank, MPI_INT, MPI_COMM_WORLD);
 #endif
+
+  // Check (on host) that derefine condition has held for N consecutive checks.  This
+  // hysteresis keeps MeshBlocks near a threshold from oscillating between refinement
+  // and derefinement every few cycles, which thrashes RedistAndRefineMeshBlocks.
+  // Applied to the globally gathered flags so counters remain identical on every rank
+  // even as MeshBlocks migrate during load balancing.
+  for (int m=0; m<(pmy_mesh->nmb_total); ++m) {
+    if (refine_flag.h_view(m) < 0) {
+      nderef_count(m) += 1;
+      if (nderef_count(m) < nchecks_derefine) {refine_flag.h_view(m) = 0;}
+    } else {
+      nderef_count(m) = 0;
+    }
+  }
+
   // sync host array with device
   refine_flag.template modify<HostMemSpace>();
   refine_flag.template sync<DevExeSpace>();
@@ -298,12 +432,84 @@ void MeshRefinement::CheckForRefinement(MeshBlockPack* pmbp) {
   return;
 }
 
+//----------------------------------------------------------------------------------------
+//! \fn void MeshRefinement::BalanceRefinementFlags()
+//! \brief Resolves the 2:1 balance constraint on the flat refine_flag array before the
+//! tree is touched.  Each sweep is a device kernel in which every local MeshBlock raises
+//! its own flag so its target level (level + flag) is no more than one below the target
+//! level of any neighbor read from the cached neighbor tables; sweeps repeat until a
+//! global fixed point, with one allgather per sweep to carry raises across rank
+//! boundaries.  This moves the refinement cascade (a fine block forcing coarser
+//! neighbors to refine, hop by hop) out of the serial recursive ripple inside
+//! MeshBlockTree::Refine(), which walks the tree from the host and dominates AMR event
+//! cost at large block counts; after this pass AddNode() finds the required nodes are
+//! (almost) all created by the main refinement loop itself.  Flags only ever increase
+//! here (a derefinement is cancelled by raising -1 to 0), so races between a block
+//! reading a neighbor flag and the neighbor raising it are benign: the raise is picked
+//! up on the next sweep.  Sibling-group conditions on derefinement are not resolved
+//! here; MeshBlockTree::Derefine() remains the final arbiter of those.
+
+void MeshRefinement::BalanceRefinementFlags() {
+  MeshBlockPack *pmbp = pmy_mesh->pmb_pack;
+  int nmb = pmbp->nmb_thispack;
+  int nnghbr = pmbp->pmb->nnghbr;
+  auto &nghbr = pmbp->pmb->nghbr;
+  auto &mblev = pmbp->pmb->mb_lev;
+  auto &refine_flag_ = refine_flag;
+  int mbs = pmy_mesh->gids_eachrank[global_variable::my_rank];
+
+  bool changed = true;
+  while (changed) {
+    int nchange = 0;
+    Kokkos::parallel_reduce("BalanceFlags",
+                            Kokkos::RangePolicy<>(DevExeSpace(), 0, nmb),
+    KOKKOS_LAMBDA(const int &m, int &count) {
+      int lev = mblev.d_view(m);
+      int newflag = refine_flag_.d_view(m+mbs);
+      for (int n=0; n<nnghbr; ++n) {
+        if (nghbr.d_view(m,n).gid < 0) {continue;}
+        int ntlev = nghbr.d_view(m,n).lev + refine_flag_.d_view(nghbr.d_view(m,n).gid);
+        // target level of each neighbor minus one bounds this block's target from below
+        if ((ntlev - 1 - lev) > newflag) {newflag = ntlev - 1 - lev;}
+      }
+      if (newflag > 1) {newflag = 1;}  // levels change by at most one per AMR event
+      if (newflag != refine_flag_.d_view(m+mbs)) {
+        refine_flag_.d_view(m+mbs) = newflag;
+        count++;
+      }
+    }, Kokkos::Sum<int>(nchange));
+#if MPI_PARALLEL_ENABLED
+    MPI_Allreduce(MPI_IN_PLACE, &nchange, 1, MPI_INT, MPI_SUM, MPI_COMM_WORLD);
+#endif
+    changed = (nchange > 0);
+    if (changed) {
+      // share raised flags with all ranks (and the host copy read by the tree update),
+      // so the next sweep can propagate them across rank boundaries
+      refine_flag.template modify<DevExeSpace>();
+      refine_flag.template sync<HostMemSpace>();
+#if MPI_PARALLEL_ENABLED
+      MPI_Allgatherv(MPI_IN_PLACE, pmy_mesh->nmb_eachrank[global_variable::my_rank],
+                     MPI_INT, refine_flag.h_view.data(), pmy_mesh->nmb_eachrank,
+                     pmy_mesh->gids_eachrank, MPI_INT, MPI_COMM_WORLD);
+      refine_flag.template modify<HostMemSpace>();
+      refine_flag.template sync<DevExeSpace>();
+#endif
+    }
+  }
+  return;
+}
+
 //----------------------------------------------------------------------------------------
 //! \fn void MeshRefinement::UpdateMeshBlockTree(int &nnew, int &ndel)
 //! \brief collect refinement flags and manipulate the MeshBlockTree with AMR
 //! Returns total number of MBs refined/derefined in arguments.
 
 void MeshRefinement::UpdateMeshBlockTree(int &nnew, int &ndel) {
+  // resolve the 2:1 balance constraint on the flat flag array first, so the serial
+  // recursive ripple inside MeshBlockTree::Refine() below (almost) never fires and the
+  // flag counts gathered next already include every cascade-refined block
+  BalanceRefinementFlags();
+
   // compute nleaf= number of leaf MeshBlocks per refined block
   int nleaf = 2;
   if (pmy_mesh->two_d) {nleaf = 4;}
@@ -461,6 +667,9 @@ void MeshRefinement::UpdateMeshBlockTree(int &nnew, int &ndel) {
 //! Boundary values and primitives are set in calling function: AdaptiveMeshRefinement()
 
 void MeshRefinement::RedistAndRefineMeshBlocks(ParameterInput *pin, int nnew, int ndel) {
+  // attribute allocations made while regridding (send/recv pools, resized MB arrays)
+  // to the AMR bucket of the memory accounting registry
+  memlog::ModuleGuard mguard("amr");
   Mesh* pm = pmy_mesh;
   int old_nmb = pm->nmb_total;
   int new_nmb = old_nmb + nnew - ndel;
@@ -505,15 +714,21 @@ void MeshRefinement::RedistAndRefineMeshBlocks(ParameterInput *pin, int nnew, in
   }
 
   // Step 3.
-  // Calculate new load balance. Initialize new cost array with the simplest estimate
-  // possible: all the blocks are equal
-  // TODO(@user): implement variable cost per MeshBlock as needed
+  // Calculate new load balance.  With automatic (timer-based) load balancing, carry the
+  // measured costs from the old tree to the new one: leaves created by refinement
+  // inherit the parent cost, while de-refined blocks inherit the cost of their first
+  // leaf.  Otherwise use the simplest estimate possible: all the blocks are equal
   new_cost_eachmb = new float[new_nmb];
   new_rank_eachmb = new int[new_nmb];
   new_gids_eachrank = new int[global_variable::nranks];
   new_nmb_eachrank = new int[global_variable::nranks];
 
-  for (int i=0; i<new_nmb; i++) {new_cost_eachmb[i] = 1.0;}
+  if (pm->lb_automatic) {
+    pm->SyncMeshBlockCosts();
+    for (int i=0; i<new_nmb; i++) {new_cost_eachmb[i] = pm->cost_eachmb[newtoold[i]];}
+  } else {
+    for (int i=0; i<new_nmb; i++) {new_cost_eachmb[i] = 1.0;}
+  }
   pm->LoadBalance(new_cost_eachmb, new_rank_eachmb, new_gids_eachrank, new_nmb_eachrank,
                   new_nmb_total);
   if (new_nmb_eachrank[global_variable::my_rank] > pm->nmb_maxperrank) {
@@ -544,6 +759,28 @@ void MeshRefinement::RedistAndRefineMeshBlocks(ParameterInput *pin, int nnew, in
   refine_flag.template modify<HostMemSpace>();
   refine_flag.template sync<DevExeSpace>();
 
+  hydro::Hydro* phydro = pm->pmb_pack->phydro;
+  mhd::MHD* pmhd = pm->pmb_pack->pmhd;
+  z4c::Z4c* pz4c = pm->pmb_pack->pz4c;
+
+  // During the time step restriction only fills coarse arrays in interface-adjacent
+  // cells, but de-refinement (both same-rank below and cross-rank packing in Step 4)
+  // reads coarse arrays over entire MeshBlocks.  So restrict CC variables over the full
+  // volume here, but only in the leaves flagged for de-refinement (refine_flag = -nleaf,
+  // set and synced to device above) since no other coarse data is consumed.  (Coarse
+  // face-centered fields are still restricted every stage.)
+  if (ndel > 0) {
+    if (phydro != nullptr) {
+      RestrictCC(phydro->u0, phydro->coarse_u0, false, true);
+    }
+    if (pmhd != nullptr) {
+      RestrictCC(pmhd->u0, pmhd->coarse_u0, false, true);
+    }
+    if (pz4c != nullptr) {
+      RestrictCC(pz4c->u0, pz4c->coarse_u0, true, true);
+    }
+  }
+
   // Step 4.
   // Allocate send/recv buffers for load balancing, post receives.
   // Pack send buffers for load blancing and send data
@@ -557,9 +794,6 @@ void MeshRefinement::RedistAndRefineMeshBlocks(ParameterInput *pin, int nnew, in
   // De-refine (restrict) evolved physics variables for MeshBlocks within this rank.
   // Simply copies data from coarse arrays in source MBs to appropriate octant of fine
   // array in target MB.
-  hydro::Hydro* phydro = pm->pmb_pack->phydro;
-  mhd::MHD* pmhd = pm->pmb_pack->pmhd;
-  z4c::Z4c* pz4c = pm->pmb_pack->pz4c;
   // derefine (if needed)
   if (ndel > 0) {
     if (phydro != nullptr) {
@@ -635,21 +869,34 @@ void MeshRefinement::RedistAndRefineMeshBlocks(ParameterInput *pin, int nnew, in
     }
   }
 
-  // Update new number of cycles since refinement
+  // Update new number of cycles since refinement and derefine hysteresis counters
   HostArray1D<int> new_ncyc_since_ref("nnref",new_nmb_total);
+  HostArray1D<int> new_nderef_count("nndcnt",new_nmb_total);
   for (int m=0; m<(new_nmb_total); ++m) {
     int oldm = newtoold[m];
     if (refine_flag.h_view(oldm) != 0) {
       new_ncyc_since_ref(m) = 0;
+      new_nderef_count(m) = 0;
     } else {
       new_ncyc_since_ref(m) = ncyc_since_ref(oldm);
+      new_nderef_count(m) = nderef_count(oldm);
     }
   }
   Kokkos::realloc(ncyc_since_ref, new_nmb_total);
   Kokkos::deep_copy(ncyc_since_ref, new_ncyc_since_ref);
+  Kokkos::realloc(nderef_count, new_nmb_total);
+  Kokkos::deep_copy(nderef_count, new_nderef_count);
 
   // Step 10.
   // Update data in Mesh/MeshBlockPack/MeshBlock classes with new grid properties
+  // First save old neighbor records and the extent of this rank's old slice of the gid
+  // space, so that neighbor information can be patched incrementally after the rebuild
+  int old_gids_thisrank = pm->gids_eachrank[global_variable::my_rank];
+  int old_nmb_thisrank  = pm->nmb_eachrank[global_variable::my_rank];
+  HostArray2D<NeighborBlock> old_nghbr("old_nghbr", old_nmb_thisrank,
+                                       pm->pmb_pack->pmb->nnghbr);
+  Kokkos::deep_copy(old_nghbr, pm->pmb_pack->pmb->nghbr.h_view);
+
   delete [] pm->lloc_eachmb;
   delete [] pm->rank_eachmb;
   delete [] pm->cost_eachmb;
@@ -671,7 +918,51 @@ void MeshRefinement::RedistAndRefineMeshBlocks(ParameterInput *pin, int nnew, in
   delete (pm->pmb_pack->pcoord);
   pm->pmb_pack->AddMeshBlocks(pin);
   pm->pmb_pack->AddCoordinates(pin);
-  pm->pmb_pack->pmb->SetNeighbors(pm->ptree, pm->rank_eachmb);
+  pm->pmb_pack->pmb->SetNeighborsIncremental(pm->ptree, pm->rank_eachmb, this,
+                                             old_nghbr, old_gids_thisrank,
+                                             old_nmb_thisrank);
+
+#if MPI_PARALLEL_ENABLED
+  // neighbor connectivity has changed, so persistent communication requests, coalescing
+  // tables, and flux-correction graph communicators must be rebuilt before boundary
+  // buffers are next exchanged
+  if (phydro != nullptr) {
+    phydro->pbval_u->comm_stale = true;
+    phydro->pbval_u->flux_comm_stale = true;
+  }
+  if (pmhd != nullptr) {
+    pmhd->pbval_u->comm_stale = true;
+    pmhd->pbval_u->flux_comm_stale = true;
+    pmhd->pbval_b->comm_stale = true;
+    pmhd->pbval_b->flux_comm_stale = true;
+  }
+  if (pz4c != nullptr) {
+    pz4c->pbval_u->comm_stale = true;
+    pz4c->pbval_weyl->comm_stale = true;
+  }
+#endif
+
+  // fine/coarse interfaces may also have changed, so cached prolongation interface
+  // lists and pack/unpack transfer tables must be rebuilt before boundary values are
+  // next exchanged
+  if (phydro != nullptr) {
+    phydro->pbval_u->prol_stale = true;
+    phydro->pbval_u->xfer_stale = true;
+    phydro->pbval_u->flux_faces_stale = true;
+  }
+  if (pmhd != nullptr) {
+    pmhd->pbval_u->prol_stale = true;
+    pmhd->pbval_u->xfer_stale = true;
+    pmhd->pbval_u->flux_faces_stale = true;
+    pmhd->pbval_b->prol_stale = true;
+    pmhd->pbval_b->xfer_stale = true;
+  }
+  if (pz4c != nullptr) {
+    pz4c->pbval_u->prol_stale = true;
+    pz4c->pbval_u->xfer_stale = true;
+    pz4c->pbval_weyl->prol_stale = true;
+    pz4c->pbval_weyl->xfer_stale = true;
+  }
 
   // clean-up and return
   delete [] newtoold;
@@ -1175,13 +1466,23 @@ void MeshRefinement::RefineFC(DualArray1D<int> &n2o, DvceFaceFld4D<Real> &b,
 
 //----------------------------------------------------------------------------------------
 //! \fn void MeshRefinement::RestrictCC
-//!  \brief Restricts cell-centered variables to coarse mesh
+//!  \brief Restricts cell-centered variables to coarse mesh.  With derefined_only=true
+//!  only MeshBlocks flagged for de-refinement are restricted; only their coarse arrays
+//!  are consumed (packed for sends or copied on-rank) during AMR redistribution, so the
+//!  remaining blocks on the rank can be skipped.  Requires refine_flag synced to device.
 
 void MeshRefinement::RestrictCC(DvceArray5D<Real> &u, DvceArray5D<Real> &cu,
-    bool is_z4c) {
+    bool is_z4c, bool derefined_only) {
   int nmb  = u.extent_int(0);  // TODO(@user): 1st index from L of in array must be NMB
   int nvar = u.extent_int(1);  // TODO(@user): 2nd index from L of in array must be NVAR
 
+  // local MB index -> global gid offset, for reading refine_flag inside kernels.  The
+  // arrays are over-allocated to nmb_maxperrank, so loop only over blocks that exist
+  bool only_deref = derefined_only;
+  auto &rflag = refine_flag;
+  int mbs = pmy_mesh->gids_eachrank[global_variable::my_rank];
+  if (only_deref) {nmb = pmy_mesh->pmb_pack->nmb_thispack;}
+
   MeshBlockPack* pmbp = pmy_mesh->pmb_pack;
   auto &indcs = pmy_mesh->mb_indcs;
   auto &cis = indcs.cis, &cie = indcs.cie;
@@ -1197,6 +1498,7 @@ void MeshRefinement::RestrictCC(DvceArray5D<Real> &u, DvceArray5D<Real> &cu,
   if (pmy_mesh->one_d) {
     par_for("restrictCC-1D",DevExeSpace(), 0,nmb-1, 0,nvar-1, cis,cie,
     KOKKOS_LAMBDA(const int m, const int n, const int i) {
+      if (only_deref && (rflag.d_view(m+mbs) >= -1)) {return;}
       int finei = 2*i - cis;  // correct when cis=is
       cu(m,n,cks,cjs,i) = 0.5*(u(m,n,cks,cjs,finei) + u(m,n,cks,cjs,finei+1));
     });
@@ -1204,6 +1506,7 @@ void MeshRefinement::RestrictCC(DvceArray5D<Real> &u, DvceArray5D<Real> &cu,
   } else if (pmy_mesh->two_d) {
     par_for("restrictCC-2D",DevExeSpace(), 0,nmb-1, 0,nvar-1, cjs,cje, cis,cie,
     KOKKOS_LAMBDA(const int m, const int n, const int j, const int i) {
+      if (only_deref && (rflag.d_view(m+mbs) >= -1)) {return;}
       int finei = 2*i - cis;  // correct when cis=is
       int finej = 2*j - cjs;  // correct when cjs=js
       cu(m,n,cks,j,i) = 0.25*(u(m,n,cks,finej  ,finei) + u(m,n,cks,finej  ,finei+1)
@@ -1214,6 +1517,7 @@ void MeshRefinement::RestrictCC(DvceArray5D<Real> &u, DvceArray5D<Real> &cu,
   } else {
     par_for("restrictCC-3D",DevExeSpace(), 0,nmb-1, 0,nvar-1, cks,cke, cjs,cje, cis,cie,
     KOKKOS_LAMBDA(const int m, const int n, const int k, const int j, const int i) {
+      if (only_deref && (rflag.d_view(m+mbs) >= -1)) {return;}
       int finei = 2*i - cis;  // correct when cis=is
       int finej = 2*j - cjs;  // correct when cjs=js
       int finek = 2*k - cks;  // correct when cks=ks
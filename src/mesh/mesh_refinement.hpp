@@ -49,11 +49,14 @@ class MeshRefinement {
   int nmb_sent_thisrank;     // # of MeshBlocks sent during load balancing on this rank
   int ncyc_check_amr;        // # of cycles between checking mesh for ref/derefinement
   int refinement_interval;   // # of cycles between allowing successive ref/derefinement
+  int nchecks_derefine;      // # of consecutive checks derefine condition must hold
   bool prolong_prims;        // flag to enable prolongation of primitive vars
+  bool pipelined;            // evaluate refinement one cycle ahead of redistribution
 
-  // following 2x Views are dimensioned [nmb_total]
+  // following 3x Views are dimensioned [nmb_total]
   DualArray1D<int> refine_flag;    // refinement flag for each MeshBlock
   HostArray1D<int> ncyc_since_ref; // # of cycles since MB last refined/derefined
+  HostArray1D<int> nderef_count;   // # of consecutive checks MB has flagged derefine
 
   // following 4x arrays allocated with length [nranks] only with AMR
   int *nref_eachrank;     // number of MBs refined per rank
@@ -88,13 +91,22 @@ class MeshRefinement {
   int nmb_send, nmb_recv;
   MPI_Comm amr_comm;                         // unique communicator for AMR
   DualArray1D<AMRBuffer> sendbuf, recvbuf; // send/recv buffers
-  MPI_Request *send_req, *recv_req;
+  MPI_Request *send_req = nullptr, *recv_req = nullptr;
   DvceArray1D<Real> send_data, recv_data;    // send/recv device data
+  // high-watermark capacities of pooled send/recv buffers above.  Buffers are only
+  // (re-)allocated when a refinement event needs more space than any previous one,
+  // growing geometrically and never shrinking, so that AMR events are allocation-free
+  // in steady state (device allocations also fence on some backends)
+  int sendbuf_cap = 0, recvbuf_cap = 0;      // capacity of sendbuf/send_req (recv same)
+  int send_data_cap = 0, recv_data_cap = 0;  // capacity of send_data/recv_data
 #endif
 
   // functions
   void CheckForRefinement(MeshBlockPack* pmbp);
   void AdaptiveMeshRefinement(Driver *pdrive, ParameterInput *pin);
+  void ApplyMeshUpdate(Driver *pdrive, ParameterInput *pin, int nnew, int ndel);
+  void CheckElasticRescale(Driver *pdrive, ParameterInput *pin);
+  void BalanceRefinementFlags();
   void UpdateMeshBlockTree(int &nnew, int &ndel);
   void RedistAndRefineMeshBlocks(ParameterInput *pin, int nnew, int ndel);
 
@@ -111,7 +123,8 @@ class MeshRefinement {
                 bool is_z4c=false);
   void RefineFC(DualArray1D<int> &n2o, DvceFaceFld4D<Real> &b, DvceFaceFld4D<Real> &cb);
 
-  void RestrictCC(DvceArray5D<Real> &a, DvceArray5D<Real> &ca, bool is_z4c=false);
+  void RestrictCC(DvceArray5D<Real> &a, DvceArray5D<Real> &ca, bool is_z4c=false,
+                  bool derefined_only=false);
   void RestrictFC(DvceFaceFld4D<Real> &b, DvceFaceFld4D<Real> &cb);
   void HighOrderRestrictCC(DvceArray5D<Real> &a, DvceArray5D<Real> &ca);
 
@@ -133,5 +146,6 @@ class MeshRefinement {
   Mesh *pmy_mesh;
   Real d_threshold_, dd_threshold_, dp_threshold_, dv_threshold_, chi_threshold_;
   bool check_cons_;
+  int nnew_pending_, ndel_pending_;  // tree update awaiting redistribution (pipelined)
 };
 #endif // MESH_MESH_REFINEMENT_HPP_
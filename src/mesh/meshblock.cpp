@@ -163,6 +163,27 @@ void MeshBlock::SetNeighbors(std::unique_ptr<MeshBlockTree> &ptree, int *ranklis
     }
   }
 
+  // Search MeshBlock tree and find neighbors
+  for (int b=0; b<nmb; ++b) {
+    SearchNeighbors(ptree, ranklist, b);
+  }
+
+  // For each DualArray: mark host views as modified, and then sync to device array
+  nghbr.template modify<HostMemSpace>();
+  nghbr.template sync<DevExeSpace>();
+
+  return;
+}
+
+//----------------------------------------------------------------------------------------
+// \!fn void MeshBlock::SearchNeighbors()
+// \brief searches the MeshBlockTree and fills the neighbor records of the single
+// MeshBlock with local index b.  Factored out of SetNeighbors() so the incremental
+// update path can redo the search only for MeshBlocks whose neighborhood changed.
+// Note host view of nghbr array is NOT synced to device here; caller must do so.
+
+void MeshBlock::SearchNeighbors(std::unique_ptr<MeshBlockTree> &ptree, int *ranklist,
+                                int b) {
   // set number of subblocks in x2- and x3-dirs
   int nfx = 1, nfy = 1, nfz = 1;
   if (pmy_pack->pmesh->multilevel) {
@@ -171,43 +192,75 @@ void MeshBlock::SetNeighbors(std::unique_ptr<MeshBlockTree> &ptree, int *ranklis
     if (pmy_pack->pmesh->three_d) nfz = 2;
   }
 
-  // Search MeshBlock tree and find neighbors
-  for (int b=0; b<nmb; ++b) {
-    LogicalLocation lloc = pmy_pack->pmesh->lloc_eachmb[mb_gid.h_view(b)];
-
-    // find location of this MeshBlock relative to XXXX
-    int myox1, myox2 = 0, myox3 = 0, myfx1, myfx2, myfx3;
-    myfx1 = ((lloc.lx1 & 1) == 1);
-    myfx2 = ((lloc.lx2 & 1) == 1);
-    myfx3 = ((lloc.lx3 & 1) == 1);
-    myox1 = ((lloc.lx1 & 1) == 1)*2 - 1;
-    if (pmy_pack->pmesh->multi_d) myox2 = ((lloc.lx2 & 1) == 1)*2 - 1;
-    if (pmy_pack->pmesh->three_d) myox3 = ((lloc.lx3 & 1) == 1)*2 - 1;
-
-    // neighbors on x1face
-    for (int n=-1; n<=1; n+=2) {
-      MeshBlockTree* nt = ptree->FindNeighbor(lloc, n, 0, 0);
+  LogicalLocation lloc = pmy_pack->pmesh->lloc_eachmb[mb_gid.h_view(b)];
+
+  // find location of this MeshBlock relative to XXXX
+  int myox1, myox2 = 0, myox3 = 0, myfx1, myfx2, myfx3;
+  myfx1 = ((lloc.lx1 & 1) == 1);
+  myfx2 = ((lloc.lx2 & 1) == 1);
+  myfx3 = ((lloc.lx3 & 1) == 1);
+  myox1 = ((lloc.lx1 & 1) == 1)*2 - 1;
+  if (pmy_pack->pmesh->multi_d) myox2 = ((lloc.lx2 & 1) == 1)*2 - 1;
+  if (pmy_pack->pmesh->three_d) myox3 = ((lloc.lx3 & 1) == 1)*2 - 1;
+
+  // neighbors on x1face
+  for (int n=-1; n<=1; n+=2) {
+    MeshBlockTree* nt = ptree->FindNeighbor(lloc, n, 0, 0);
+    if (nt != nullptr) {
+      if (nt->pleaf_ != nullptr) {  // neighbor at finer level -- requires subblocks
+        int ffx = 1 - (n + 1)/2; // 0 for BoundaryFace::outer_x1, 1 for inner_x1
+        for (int fz=0; fz<nfz; fz++) {
+          for (int fy = 0; fy<nfy; fy++) {
+            MeshBlockTree* nf = nt->GetLeaf(ffx, fy, fz);
+            int inghbr = NeighborIndex(n,0,0,fy,fz);
+            nghbr.h_view(b,inghbr).gid = nf->gid_;
+            nghbr.h_view(b,inghbr).lev = nf->lloc_.level;
+            nghbr.h_view(b,inghbr).rank = ranklist[nf->gid_];
+            nghbr.h_view(b,inghbr).dest = NeighborIndex(-n,0,0,fy,fz);
+          }
+        }
+      } else {   // neighbor at same or coarser level
+        int idest, inghbr;
+        if (nt->lloc_.level == lloc.level) { // neighbor at same level -- no subblocks
+          inghbr = NeighborIndex(n,0,0,0,0);
+          idest = NeighborIndex(-n,0,0,0,0);
+        } else { // neighbor at coarser level, set index/destn to appropriate subblock
+          inghbr = NeighborIndex(n,0,0,myfx2,myfx3);
+          idest = NeighborIndex(-n,0,0,myfx2,myfx3);
+        }
+        nghbr.h_view(b,inghbr).gid = nt->gid_;
+        nghbr.h_view(b,inghbr).lev = nt->lloc_.level;
+        nghbr.h_view(b,inghbr).rank = ranklist[nt->gid_];
+        nghbr.h_view(b,inghbr).dest = idest;
+      }
+    }
+  }
+
+  // neighbors on x2face
+  if (pmy_pack->pmesh->multi_d) {
+    for (int m=-1; m<=1; m+=2) {
+      MeshBlockTree* nt = ptree->FindNeighbor(lloc, 0, m, 0);
       if (nt != nullptr) {
         if (nt->pleaf_ != nullptr) {  // neighbor at finer level -- requires subblocks
-          int ffx = 1 - (n + 1)/2; // 0 for BoundaryFace::outer_x1, 1 for inner_x1
+          int ffy = 1 - (m + 1)/2; // 0 for BoundaryFace::outer_x2, 1 for inner_x2
           for (int fz=0; fz<nfz; fz++) {
-            for (int fy = 0; fy<nfy; fy++) {
-              MeshBlockTree* nf = nt->GetLeaf(ffx, fy, fz);
-              int inghbr = NeighborIndex(n,0,0,fy,fz);
+            for (int fx = 0; fx<nfx; fx++) {
+              MeshBlockTree* nf = nt->GetLeaf(fx, ffy, fz);
+              int inghbr = NeighborIndex(0,m,0,fx,fz);
               nghbr.h_view(b,inghbr).gid = nf->gid_;
               nghbr.h_view(b,inghbr).lev = nf->lloc_.level;
               nghbr.h_view(b,inghbr).rank = ranklist[nf->gid_];
-              nghbr.h_view(b,inghbr).dest = NeighborIndex(-n,0,0,fy,fz);
+              nghbr.h_view(b,inghbr).dest = NeighborIndex(0,-m,0,fx,fz);
             }
           }
         } else {   // neighbor at same or coarser level
-          int idest, inghbr;
+          int idest,inghbr;
           if (nt->lloc_.level == lloc.level) { // neighbor at same level -- no subblocks
-            inghbr = NeighborIndex(n,0,0,0,0);
-            idest = NeighborIndex(-n,0,0,0,0);
+            inghbr = NeighborIndex(0,m,0,0,0);
+            idest = NeighborIndex(0,-m,0,0,0);
           } else { // neighbor at coarser level, set index/destn to appropriate subblock
-            inghbr = NeighborIndex(n,0,0,myfx2,myfx3);
-            idest = NeighborIndex(-n,0,0,myfx2,myfx3);
+            inghbr = NeighborIndex(0,m,0,myfx1,myfx3);
+            idest = NeighborIndex(0,-m,0,myfx1,myfx3);
           }
           nghbr.h_view(b,inghbr).gid = nt->gid_;
           nghbr.h_view(b,inghbr).lev = nt->lloc_.level;
@@ -217,213 +270,247 @@ void MeshBlock::SetNeighbors(std::unique_ptr<MeshBlockTree> &ptree, int *ranklis
       }
     }
 
-    // neighbors on x2face
-    if (pmy_pack->pmesh->multi_d) {
-      for (int m=-1; m<=1; m+=2) {
-        MeshBlockTree* nt = ptree->FindNeighbor(lloc, 0, m, 0);
+    // neighbors on x1x2 edges
+    for (int m=-1; m<=1; m+=2) {
+      for (int n=-1; n<=1; n+=2) {
+        MeshBlockTree* nt = ptree->FindNeighbor(lloc, n, m, 0);
         if (nt != nullptr) {
           if (nt->pleaf_ != nullptr) {  // neighbor at finer level -- requires subblocks
+            int ffx = 1 - (n + 1)/2; // 0 for BoundaryFace::outer_x1, 1 for inner_x1
             int ffy = 1 - (m + 1)/2; // 0 for BoundaryFace::outer_x2, 1 for inner_x2
             for (int fz=0; fz<nfz; fz++) {
-              for (int fx = 0; fx<nfx; fx++) {
-                MeshBlockTree* nf = nt->GetLeaf(fx, ffy, fz);
-                int inghbr = NeighborIndex(0,m,0,fx,fz);
-                nghbr.h_view(b,inghbr).gid = nf->gid_;
-                nghbr.h_view(b,inghbr).lev = nf->lloc_.level;
-                nghbr.h_view(b,inghbr).rank = ranklist[nf->gid_];
-                nghbr.h_view(b,inghbr).dest = NeighborIndex(0,-m,0,fx,fz);
-              }
+              MeshBlockTree* nf = nt->GetLeaf(ffx, ffy, fz);
+              int inghbr = NeighborIndex(n,m,0,fz,0);
+              nghbr.h_view(b,inghbr).gid = nf->gid_;
+              nghbr.h_view(b,inghbr).lev = nf->lloc_.level;
+              nghbr.h_view(b,inghbr).rank = ranklist[nf->gid_];
+              nghbr.h_view(b,inghbr).dest = NeighborIndex(-n,-m,0,fz,0);
             }
           } else {   // neighbor at same or coarser level
             int idest,inghbr;
-            if (nt->lloc_.level == lloc.level) { // neighbor at same level -- no subblocks
-              inghbr = NeighborIndex(0,m,0,0,0);
-              idest = NeighborIndex(0,-m,0,0,0);
-            } else { // neighbor at coarser level, set index/destn to appropriate subblock
-              inghbr = NeighborIndex(0,m,0,myfx1,myfx3);
-              idest = NeighborIndex(0,-m,0,myfx1,myfx3);
+            if (nt->lloc_.level == lloc.level) { // same level -- no subblocks
+              inghbr = NeighborIndex(n,m,0,0,0);
+              idest = NeighborIndex(-n,-m,0,0,0);
+            } else { // neighbor at coarser level, set indx/dest to appropriate subblock
+              inghbr = NeighborIndex(n,m,0,myfx3,0);
+              idest = NeighborIndex(-n,-m,0,myfx3,0);
+            }
+            // only set neighbor for exterior edges of coarser face
+            if (nt->lloc_.level >= lloc.level || (myox1 == n && myox2 == m)) {
+              nghbr.h_view(b,inghbr).gid = nt->gid_;
+              nghbr.h_view(b,inghbr).lev = nt->lloc_.level;
+              nghbr.h_view(b,inghbr).rank = ranklist[nt->gid_];
+              nghbr.h_view(b,inghbr).dest = idest;
             }
-            nghbr.h_view(b,inghbr).gid = nt->gid_;
-            nghbr.h_view(b,inghbr).lev = nt->lloc_.level;
-            nghbr.h_view(b,inghbr).rank = ranklist[nt->gid_];
-            nghbr.h_view(b,inghbr).dest = idest;
           }
         }
       }
+    }
+  }
 
-      // neighbors on x1x2 edges
-      for (int m=-1; m<=1; m+=2) {
-        for (int n=-1; n<=1; n+=2) {
-          MeshBlockTree* nt = ptree->FindNeighbor(lloc, n, m, 0);
-          if (nt != nullptr) {
-            if (nt->pleaf_ != nullptr) {  // neighbor at finer level -- requires subblocks
-              int ffx = 1 - (n + 1)/2; // 0 for BoundaryFace::outer_x1, 1 for inner_x1
-              int ffy = 1 - (m + 1)/2; // 0 for BoundaryFace::outer_x2, 1 for inner_x2
-              for (int fz=0; fz<nfz; fz++) {
-                MeshBlockTree* nf = nt->GetLeaf(ffx, ffy, fz);
-                int inghbr = NeighborIndex(n,m,0,fz,0);
-                nghbr.h_view(b,inghbr).gid = nf->gid_;
-                nghbr.h_view(b,inghbr).lev = nf->lloc_.level;
-                nghbr.h_view(b,inghbr).rank = ranklist[nf->gid_];
-                nghbr.h_view(b,inghbr).dest = NeighborIndex(-n,-m,0,fz,0);
-              }
-            } else {   // neighbor at same or coarser level
-              int idest,inghbr;
-              if (nt->lloc_.level == lloc.level) { // same level -- no subblocks
-                inghbr = NeighborIndex(n,m,0,0,0);
-                idest = NeighborIndex(-n,-m,0,0,0);
-              } else { // neighbor at coarser level, set indx/dest to appropriate subblock
-                inghbr = NeighborIndex(n,m,0,myfx3,0);
-                idest = NeighborIndex(-n,-m,0,myfx3,0);
-              }
-              // only set neighbor for exterior edges of coarser face
-              if (nt->lloc_.level >= lloc.level || (myox1 == n && myox2 == m)) {
-                nghbr.h_view(b,inghbr).gid = nt->gid_;
-                nghbr.h_view(b,inghbr).lev = nt->lloc_.level;
-                nghbr.h_view(b,inghbr).rank = ranklist[nt->gid_];
-                nghbr.h_view(b,inghbr).dest = idest;
-              }
+  // neighbors on x3face
+  if (pmy_pack->pmesh->three_d) {
+    for (int l=-1; l<=1; l+=2) {
+      MeshBlockTree* nt = ptree->FindNeighbor(lloc, 0, 0, l);
+      if (nt != nullptr) {
+        if (nt->pleaf_ != nullptr) {  // neighbor at finer level -- requires subblocks
+          int ffz = 1 - (l + 1)/2; // 0 for BoundaryFace::outer_x3, 1 for inner_x3
+          for (int fy=0; fy<nfy; fy++) {
+            for (int fx = 0; fx<nfx; fx++) {
+              MeshBlockTree* nf = nt->GetLeaf(fx, fy, ffz);
+              int inghbr = NeighborIndex(0,0,l,fx,fy);
+              nghbr.h_view(b,inghbr).gid = nf->gid_;
+              nghbr.h_view(b,inghbr).lev = nf->lloc_.level;
+              nghbr.h_view(b,inghbr).rank = ranklist[nf->gid_];
+              nghbr.h_view(b,inghbr).dest = NeighborIndex(0,0,-l,fx,fy);
             }
           }
+        } else {   // neighbor at same or coarser level -- no subblocks
+          int idest,inghbr;
+          if (nt->lloc_.level == lloc.level) { // neighbor at same level
+            inghbr = NeighborIndex(0,0,l,0,0);
+            idest = NeighborIndex(0,0,-l,0,0);
+          } else { // neighbor at coarser level, set index/destn to appropriate subblock
+            inghbr = NeighborIndex(0,0,l,myfx1,myfx2);
+            idest = NeighborIndex(0,0,-l,myfx1,myfx2);
+          }
+          nghbr.h_view(b,inghbr).gid = nt->gid_;
+          nghbr.h_view(b,inghbr).lev = nt->lloc_.level;
+          nghbr.h_view(b,inghbr).rank = ranklist[nt->gid_];
+          nghbr.h_view(b,inghbr).dest = idest;
         }
       }
     }
 
-    // neighbors on x3face
-    if (pmy_pack->pmesh->three_d) {
-      for (int l=-1; l<=1; l+=2) {
-        MeshBlockTree* nt = ptree->FindNeighbor(lloc, 0, 0, l);
+    // neighbors on x3x1 edges
+    for (int l=-1; l<=1; l+=2) {
+      for (int n=-1; n<=1; n+=2) {
+        MeshBlockTree* nt = ptree->FindNeighbor(lloc, n, 0, l);
         if (nt != nullptr) {
           if (nt->pleaf_ != nullptr) {  // neighbor at finer level -- requires subblocks
+            int ffx = 1 - (n + 1)/2; // 0 for BoundaryFace::outer_x1, 1 for inner_x1
             int ffz = 1 - (l + 1)/2; // 0 for BoundaryFace::outer_x3, 1 for inner_x3
             for (int fy=0; fy<nfy; fy++) {
-              for (int fx = 0; fx<nfx; fx++) {
-                MeshBlockTree* nf = nt->GetLeaf(fx, fy, ffz);
-                int inghbr = NeighborIndex(0,0,l,fx,fy);
-                nghbr.h_view(b,inghbr).gid = nf->gid_;
-                nghbr.h_view(b,inghbr).lev = nf->lloc_.level;
-                nghbr.h_view(b,inghbr).rank = ranklist[nf->gid_];
-                nghbr.h_view(b,inghbr).dest = NeighborIndex(0,0,-l,fx,fy);
-              }
+              MeshBlockTree* nf = nt->GetLeaf(ffx, fy, ffz);
+              int inghbr = NeighborIndex(n,0,l,fy,0);
+              nghbr.h_view(b,inghbr).gid = nf->gid_;
+              nghbr.h_view(b,inghbr).lev = nf->lloc_.level;
+              nghbr.h_view(b,inghbr).rank = ranklist[nf->gid_];
+              nghbr.h_view(b,inghbr).dest = NeighborIndex(-n,0,-l,fy,0);
             }
           } else {   // neighbor at same or coarser level -- no subblocks
             int idest,inghbr;
             if (nt->lloc_.level == lloc.level) { // neighbor at same level
-              inghbr = NeighborIndex(0,0,l,0,0);
-              idest = NeighborIndex(0,0,-l,0,0);
-            } else { // neighbor at coarser level, set index/destn to appropriate subblock
-              inghbr = NeighborIndex(0,0,l,myfx1,myfx2);
-              idest = NeighborIndex(0,0,-l,myfx1,myfx2);
+              inghbr = NeighborIndex(n,0,l,0,0);
+              idest = NeighborIndex(-n,0,-l,0,0);
+            } else { // neighbor at coarser level, set indx/dest to appropriate subblock
+              inghbr = NeighborIndex(n,0,l,myfx2,0);
+              idest = NeighborIndex(-n,0,-l,myfx2,0);
+            }
+            // only set neighbor for exterior edges of coarser face
+            if (nt->lloc_.level >= lloc.level || (myox1 == n && myox3 == l)) {
+              nghbr.h_view(b,inghbr).gid = nt->gid_;
+              nghbr.h_view(b,inghbr).lev = nt->lloc_.level;
+              nghbr.h_view(b,inghbr).rank = ranklist[nt->gid_];
+              nghbr.h_view(b,inghbr).dest = idest;
             }
-            nghbr.h_view(b,inghbr).gid = nt->gid_;
-            nghbr.h_view(b,inghbr).lev = nt->lloc_.level;
-            nghbr.h_view(b,inghbr).rank = ranklist[nt->gid_];
-            nghbr.h_view(b,inghbr).dest = idest;
           }
         }
       }
+    }
 
-      // neighbors on x3x1 edges
-      for (int l=-1; l<=1; l+=2) {
-        for (int n=-1; n<=1; n+=2) {
-          MeshBlockTree* nt = ptree->FindNeighbor(lloc, n, 0, l);
-          if (nt != nullptr) {
-            if (nt->pleaf_ != nullptr) {  // neighbor at finer level -- requires subblocks
-              int ffx = 1 - (n + 1)/2; // 0 for BoundaryFace::outer_x1, 1 for inner_x1
-              int ffz = 1 - (l + 1)/2; // 0 for BoundaryFace::outer_x3, 1 for inner_x3
-              for (int fy=0; fy<nfy; fy++) {
-                MeshBlockTree* nf = nt->GetLeaf(ffx, fy, ffz);
-                int inghbr = NeighborIndex(n,0,l,fy,0);
-                nghbr.h_view(b,inghbr).gid = nf->gid_;
-                nghbr.h_view(b,inghbr).lev = nf->lloc_.level;
-                nghbr.h_view(b,inghbr).rank = ranklist[nf->gid_];
-                nghbr.h_view(b,inghbr).dest = NeighborIndex(-n,0,-l,fy,0);
-              }
-            } else {   // neighbor at same or coarser level -- no subblocks
-              int idest,inghbr;
-              if (nt->lloc_.level == lloc.level) { // neighbor at same level
-                inghbr = NeighborIndex(n,0,l,0,0);
-                idest = NeighborIndex(-n,0,-l,0,0);
-              } else { // neighbor at coarser level, set indx/dest to appropriate subblock
-                inghbr = NeighborIndex(n,0,l,myfx2,0);
-                idest = NeighborIndex(-n,0,-l,myfx2,0);
-              }
-              // only set neighbor for exterior edges of coarser face
-              if (nt->lloc_.level >= lloc.level || (myox1 == n && myox3 == l)) {
-                nghbr.h_view(b,inghbr).gid = nt->gid_;
-                nghbr.h_view(b,inghbr).lev = nt->lloc_.level;
-                nghbr.h_view(b,inghbr).rank = ranklist[nt->gid_];
-                nghbr.h_view(b,inghbr).dest = idest;
-              }
+    // neighbors on x2x3 edges
+    for (int l=-1; l<=1; l+=2) {
+      for (int m=-1; m<=1; m+=2) {
+        MeshBlockTree* nt = ptree->FindNeighbor(lloc, 0, m, l);
+        if (nt != nullptr) {
+          if (nt->pleaf_ != nullptr) {  // neighbor at finer level -- requires subblocks
+            int ffy = 1 - (m + 1)/2; // 0 for BoundaryFace::outer_x2, 1 for inner_x2
+            int ffz = 1 - (l + 1)/2; // 0 for BoundaryFace::outer_x3, 1 for inner_x3
+            for (int fx=0; fx<nfy; fx++) {
+              MeshBlockTree* nf = nt->GetLeaf(fx, ffy, ffz);
+              int inghbr = NeighborIndex(0,m,l,fx,0);
+              nghbr.h_view(b,inghbr).gid = nf->gid_;
+              nghbr.h_view(b,inghbr).lev = nf->lloc_.level;
+              nghbr.h_view(b,inghbr).rank = ranklist[nf->gid_];
+              nghbr.h_view(b,inghbr).dest = NeighborIndex(0,-m,-l,fx,0);
+            }
+          } else {   // neighbor at same or coarser level -- no subblocks
+            int idest,inghbr;
+            if (nt->lloc_.level == lloc.level) { // neighbor at same level
+              inghbr = NeighborIndex(0,m,l,0,0);
+              idest = NeighborIndex(0,-m,-l,0,0);
+            } else { // neighbor at coarser level, set indx/dest to appropriate subblock
+              inghbr = NeighborIndex(0,m,l,myfx1,0);
+              idest = NeighborIndex(0,-m,-l,myfx1,0);
+            }
+            // only set neighbor for exterior edges of coarser face
+            if (nt->lloc_.level >= lloc.level || (myox2 == m && myox3 == l)) {
+              nghbr.h_view(b,inghbr).gid = nt->gid_;
+              nghbr.h_view(b,inghbr).lev = nt->lloc_.level;
+              nghbr.h_view(b,inghbr).rank = ranklist[nt->gid_];
+              nghbr.h_view(b,inghbr).dest = idest;
             }
           }
         }
       }
+    }
 
-      // neighbors on x2x3 edges
-      for (int l=-1; l<=1; l+=2) {
-        for (int m=-1; m<=1; m+=2) {
-          MeshBlockTree* nt = ptree->FindNeighbor(lloc, 0, m, l);
+    // neighbors on corners
+    for (int l=-1; l<=1; l+=2) {
+      for (int m=-1; m<=1; m+=2) {
+        for (int n=-1; n<=1; n+=2) {
+          MeshBlockTree* nt = ptree->FindNeighbor(lloc, n, m, l);
           if (nt != nullptr) {
-            if (nt->pleaf_ != nullptr) {  // neighbor at finer level -- requires subblocks
+            if (nt->pleaf_ != nullptr) {  // neighbor at finer level
+              int ffx = 1 - (n + 1)/2; // 0 for BoundaryFace::outer_x1, 1 for inner_x1
               int ffy = 1 - (m + 1)/2; // 0 for BoundaryFace::outer_x2, 1 for inner_x2
               int ffz = 1 - (l + 1)/2; // 0 for BoundaryFace::outer_x3, 1 for inner_x3
-              for (int fx=0; fx<nfy; fx++) {
-                MeshBlockTree* nf = nt->GetLeaf(fx, ffy, ffz);
-                int inghbr = NeighborIndex(0,m,l,fx,0);
-                nghbr.h_view(b,inghbr).gid = nf->gid_;
-                nghbr.h_view(b,inghbr).lev = nf->lloc_.level;
-                nghbr.h_view(b,inghbr).rank = ranklist[nf->gid_];
-                nghbr.h_view(b,inghbr).dest = NeighborIndex(0,-m,-l,fx,0);
-              }
-            } else {   // neighbor at same or coarser level -- no subblocks
-              int idest,inghbr;
-              if (nt->lloc_.level == lloc.level) { // neighbor at same level
-                inghbr = NeighborIndex(0,m,l,0,0);
-                idest = NeighborIndex(0,-m,-l,0,0);
-              } else { // neighbor at coarser level, set indx/dest to appropriate subblock
-                inghbr = NeighborIndex(0,m,l,myfx1,0);
-                idest = NeighborIndex(0,-m,-l,myfx1,0);
-              }
-              // only set neighbor for exterior edges of coarser face
-              if (nt->lloc_.level >= lloc.level || (myox2 == m && myox3 == l)) {
-                nghbr.h_view(b,inghbr).gid = nt->gid_;
-                nghbr.h_view(b,inghbr).lev = nt->lloc_.level;
-                nghbr.h_view(b,inghbr).rank = ranklist[nt->gid_];
-                nghbr.h_view(b,inghbr).dest = idest;
-              }
+              nt = nt->GetLeaf(ffx, ffy, ffz);
+            }
+            int nlevel = nt->lloc_.level;
+            // only set neighbor for exterior corners of coarser face
+            if (nlevel >= lloc.level || (myox1 == n && myox2 == m && myox3 == l)) {
+              int inghbr = NeighborIndex(n,m,l,0,0);
+              nghbr.h_view(b,inghbr).gid = nt->gid_;
+              nghbr.h_view(b,inghbr).lev = nt->lloc_.level;
+              nghbr.h_view(b,inghbr).rank = ranklist[nt->gid_];
+              nghbr.h_view(b,inghbr).dest = NeighborIndex(-n,-m,-l,0,0);
             }
           }
         }
       }
+    }
+  }  // end loop over three_d
+  return;
+}
 
-      // neighbors on corners
-      for (int l=-1; l<=1; l+=2) {
-        for (int m=-1; m<=1; m+=2) {
-          for (int n=-1; n<=1; n+=2) {
-            MeshBlockTree* nt = ptree->FindNeighbor(lloc, n, m, l);
-            if (nt != nullptr) {
-              if (nt->pleaf_ != nullptr) {  // neighbor at finer level
-                int ffx = 1 - (n + 1)/2; // 0 for BoundaryFace::outer_x1, 1 for inner_x1
-                int ffy = 1 - (m + 1)/2; // 0 for BoundaryFace::outer_x2, 1 for inner_x2
-                int ffz = 1 - (l + 1)/2; // 0 for BoundaryFace::outer_x3, 1 for inner_x3
-                nt = nt->GetLeaf(ffx, ffy, ffz);
-              }
-              int nlevel = nt->lloc_.level;
-              // only set neighbor for exterior corners of coarser face
-              if (nlevel >= lloc.level || (myox1 == n && myox2 == m && myox3 == l)) {
-                int inghbr = NeighborIndex(n,m,l,0,0);
-                nghbr.h_view(b,inghbr).gid = nt->gid_;
-                nghbr.h_view(b,inghbr).lev = nt->lloc_.level;
-                nghbr.h_view(b,inghbr).rank = ranklist[nt->gid_];
-                nghbr.h_view(b,inghbr).dest = NeighborIndex(-n,-m,-l,0,0);
-              }
-            }
-          }
+//----------------------------------------------------------------------------------------
+// \!fn void MeshBlock::SetNeighborsIncremental()
+// \brief incremental variant of SetNeighbors() used after AMR redistribution.  For
+// MeshBlocks that stayed on this rank at the same level and whose old neighbors were
+// neither refined nor de-refined, the neighbor records are patched in place using the
+// old-to-new gid mapping, avoiding the O(56) tree searches per MeshBlock that dominate
+// the host-side rebuild cost at large block counts.  The full tree search is redone only
+// for MeshBlocks adjacent to created/destroyed leaves or newly arrived on this rank.
+// Arguments old_gids/old_nmb give the extent of this rank's slice of the OLD gid space.
+
+void MeshBlock::SetNeighborsIncremental(std::unique_ptr<MeshBlockTree> &ptree,
+                                        int *ranklist, MeshRefinement *pmr,
+                                        HostArray2D<NeighborBlock> &old_nghbr,
+                                        int old_gids, int old_nmb) {
+  // min number of array elements needed to store MeshBlock neighbors withe SMR/AMR
+  if (pmy_pack->pmesh->one_d) {nnghbr = 8;}
+  if (pmy_pack->pmesh->two_d) {nnghbr = 24;}
+  if (pmy_pack->pmesh->three_d) {nnghbr = 56;}
+
+  // allocate size of DualArrays
+  int nmb = pmy_pack->nmb_thispack;
+  Kokkos::realloc(nghbr, nmb, nnghbr);
+
+  // Initialize host view elements of DualViews
+  for (int n=0; n<nnghbr; ++n) {
+    for (int m=0; m<nmb; ++m) {
+      nghbr.h_view(m,n).gid   = -1;
+      nghbr.h_view(m,n).lev   = -1;
+      nghbr.h_view(m,n).rank  = -1;
+      nghbr.h_view(m,n).dest  = -1;
+    }
+  }
+
+  for (int b=0; b<nmb; ++b) {
+    int newm = mb_gid.h_view(b);
+    int oldm = pmr->newtoold[newm];
+    // patch old records only if this MB was on this rank at the same level before
+    // redistribution (refine_flag indexed by OLD gid; set for all MBs on all ranks)
+    bool patch = (oldm >= old_gids) && (oldm < (old_gids + old_nmb)) &&
+                 (pmr->refine_flag.h_view(oldm) == 0);
+    if (patch) {
+      int oldb = oldm - old_gids;
+      // neighborhood unchanged only if no old neighbor was refined or de-refined
+      for (int n=0; n<nnghbr; ++n) {
+        int ogid = old_nghbr(oldb,n).gid;
+        if (ogid >= 0 && pmr->refine_flag.h_view(ogid) != 0) {
+          patch = false;
+          break;
+        }
+      }
+      if (patch) {
+        for (int n=0; n<nnghbr; ++n) {
+          int ogid = old_nghbr(oldb,n).gid;
+          if (ogid < 0) continue;
+          int ngid = pmr->oldtonew[ogid];
+          nghbr.h_view(b,n).gid  = ngid;
+          nghbr.h_view(b,n).lev  = old_nghbr(oldb,n).lev;
+          nghbr.h_view(b,n).rank = ranklist[ngid];
+          nghbr.h_view(b,n).dest = old_nghbr(oldb,n).dest;
         }
       }
-    }  // end loop over three_d
-  }    // end loop over all MeshBlocks
+    }
+    if (!patch) {
+      SearchNeighbors(ptree, ranklist, b);
+    }
+  }
 
   // For each DualArray: mark host views as modified, and then sync to device array
   nghbr.template modify<HostMemSpace>();
@@ -17,6 +17,8 @@
 #include "bvals/bvals.hpp"
 #include "meshblock_pack.hpp"
 
+class MeshRefinement;
+
 //----------------------------------------------------------------------------------------
 //! \class MeshBlock
 //! \brief data/functions associated with each MeshBlock
@@ -42,8 +44,12 @@ class MeshBlock {
   DualArray2D<BoundaryFlag> mb_bcs;  // boundary conditions at 6 faces of each MeshBlock
   DualArray2D<NeighborBlock> nghbr;  // data on all (up to 56) neighbors for each MB
 
-  // function to set data describing neighbors
+  // functions to set data describing neighbors
   void SetNeighbors(std::unique_ptr<MeshBlockTree> &ptree, int *ranklist);
+  void SearchNeighbors(std::unique_ptr<MeshBlockTree> &ptree, int *ranklist, int b);
+  void SetNeighborsIncremental(std::unique_ptr<MeshBlockTree> &ptree, int *ranklist,
+                               MeshRefinement *pmr, HostArray2D<NeighborBlock> &old_nghbr,
+                               int old_gids, int old_nmb);
 
  private:
   // data
@@ -30,6 +30,7 @@
 #include "srcterms/turb_driver.hpp"
 #include "particles/particles.hpp"
 #include "units/units.hpp"
+#include "utils/memlog.hpp"
 #include "meshblock_pack.hpp"
 
 //----------------------------------------------------------------------------------------
@@ -46,6 +47,10 @@ MeshBlockPack::MeshBlockPack(Mesh *pm, int igids, int igide) :
   tl_map.insert(std::make_pair("before_stagen",std::make_shared<TaskList>()));
   tl_map.insert(std::make_pair("stagen",std::make_shared<TaskList>()));
   tl_map.insert(std::make_pair("after_stagen",std::make_shared<TaskList>()));
+  // task lists for operator-split super-time-stepping of diffusion terms
+  tl_map.insert(std::make_pair("sts_before_stagen",std::make_shared<TaskList>()));
+  tl_map.insert(std::make_pair("sts_stagen",std::make_shared<TaskList>()));
+  tl_map.insert(std::make_pair("sts_after_stagen",std::make_shared<TaskList>()));
 }
 
 //----------------------------------------------------------------------------------------
@@ -57,7 +62,9 @@ MeshBlockPack::~MeshBlockPack() {
   if (pmhd   != nullptr) {delete pmhd;}
   if (padm   != nullptr) {delete padm;}
   if (ptmunu != nullptr) {delete ptmunu;}
+#if RADIATION_ENABLED
   if (prad   != nullptr) {delete prad;}
+#endif
   if (pdyngr != nullptr) {delete pdyngr;}
   if (pnr    != nullptr) {delete pnr;}
   if (pturb  != nullptr) {delete pturb;}
@@ -80,6 +87,7 @@ MeshBlockPack::~MeshBlockPack() {
 //! Allows for passing of pointer to 'this' pack.
 
 void MeshBlockPack::AddMeshBlocks(ParameterInput *pin) {
+  memlog::ModuleGuard mguard("mesh");
   pmb = new MeshBlock(this, gids, nmb_thispack);
 }
 
@@ -90,6 +98,7 @@ void MeshBlockPack::AddMeshBlocks(ParameterInput *pin) {
 //! function, since latter uses data inside Coordinates class.
 
 void MeshBlockPack::AddCoordinates(ParameterInput *pin) {
+  memlog::ModuleGuard mguard("coords");
   pcoord = new Coordinates(pin, this);
 }
 
@@ -105,6 +114,7 @@ void MeshBlockPack::AddPhysics(ParameterInput *pin) {
   // (1) Units.  Create first so that they can be used in other physics constructors
   // Default units are simply code units
   if (pin->DoesBlockExist("units")) {
+    memlog::ModuleGuard mguard("units");
     punit = new units::Units(pin);
   } else {
     punit = nullptr;
@@ -114,6 +124,9 @@ void MeshBlockPack::AddPhysics(ParameterInput *pin) {
   // Create Hydro physics module.  Create TaskLists only for single-fluid hydro
   // (Note TaskLists stored in MeshBlockPack)
   if (pin->DoesBlockExist("hydro")) {
+    // scoped guard attributes View allocations (incl. boundary buffers built inside the
+    // constructor) to this module in the memory accounting registry
+    memlog::ModuleGuard mguard("hydro");
     phydro = new hydro::Hydro(this, pin);
     nphysics++;
     if (!(pin->DoesBlockExist("mhd")) && !(pin->DoesBlockExist("radiation")) &&
@@ -127,6 +140,7 @@ void MeshBlockPack::AddPhysics(ParameterInput *pin) {
   // (3) MHD
   // Create MHD physics module.  Create TaskLists only for single-fluid MHD
   if (pin->DoesBlockExist("mhd")) {
+    memlog::ModuleGuard mguard("mhd");
     pmhd = new mhd::MHD(this, pin);
     nphysics++;
     if (!(pin->DoesBlockExist("hydro")) && !(pin->DoesBlockExist("radiation")) &&
@@ -165,13 +179,24 @@ void MeshBlockPack::AddPhysics(ParameterInput *pin) {
 
   // (5) RADIATION
   // Create radiation physics module.  Create tasklist.
+#if RADIATION_ENABLED
   if (pin->DoesBlockExist("radiation")) {
+    memlog::ModuleGuard mguard("radiation");
     prad = new radiation::Radiation(this, pin);
     nphysics++;
     prad->AssembleRadTasks(tl_map);
   } else {
     prad = nullptr;
   }
+#else
+  if (pin->DoesBlockExist("radiation")) {
+    std::cout << "### FATAL ERROR in " << __FILE__ << " at line " << __LINE__
+              << std::endl << "<radiation> block detected in input file, but code was "
+              << "compiled with Athena_ENABLE_RADIATION=OFF" << std::endl;
+    std::exit(EXIT_FAILURE);
+  }
+  prad = nullptr;
+#endif
 
   // (6) TURBULENCE DRIVER
   // This is a special module to drive turbulence in hydro, MHD, or both. Cannot be
@@ -180,6 +205,7 @@ void MeshBlockPack::AddPhysics(ParameterInput *pin) {
   // force and adding force to fluid are included in operator_split and stage_run
   // task lists respectively.
   if (pin->DoesBlockExist("turb_driving")) {
+    memlog::ModuleGuard mguard("turb_driving");
     pturb = new TurbulenceDriver(this, pin);
     pturb->IncludeInitializeModesTask(tl_map["before_timeintegrator"], none);
     pturb->IncludeAddForcingTask(tl_map["stagen"], none);
@@ -190,6 +216,7 @@ void MeshBlockPack::AddPhysics(ParameterInput *pin) {
   // (7) Z4c and ADM
   // Create Z4c and ADM physics module.
   if (pin->DoesBlockExist("z4c")) {
+    memlog::ModuleGuard mguard("z4c");
     pz4c = new z4c::Z4c(this, pin);
     padm = new adm::ADM(this, pin);
     ptmunu = new Tmunu(this, pin);
@@ -222,6 +249,7 @@ void MeshBlockPack::AddPhysics(ParameterInput *pin) {
   }
   if ((pin->DoesBlockExist("z4c") || pin->DoesBlockExist("adm")) &&
       (pin->DoesBlockExist("mhd")) ) {
+    memlog::ModuleGuard mguard("dyn_grmhd");
     pdyngr = dyngr::BuildDynGRMHD(this, pin);
   }
 
@@ -233,6 +261,7 @@ void MeshBlockPack::AddPhysics(ParameterInput *pin) {
   // (8) PARTICLES
   // Create particles module.  Create tasklist.
   if (pin->DoesBlockExist("particles")) {
+    memlog::ModuleGuard mguard("particles");
     ppart = new particles::Particles(this, pin);
     ppart->AssembleTasks(tl_map);
     nphysics++;
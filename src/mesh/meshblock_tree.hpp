@@ -41,6 +41,7 @@ class MeshBlockTree {
   void CreateRootGrid();
   void AddNode(LogicalLocation rloc, int &nnew);
   void AddNodeWithoutRefinement(LogicalLocation rloc);
+  void AddZOrderedNodes(LogicalLocation *list, int nmb);
   void Refine(int &nnew);
   void Derefine(int &ndel);
   MeshBlockTree* FindMeshBlock(LogicalLocation tloc);
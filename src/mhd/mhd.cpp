@@ -20,6 +20,7 @@
 #include "srcterms/srcterms.hpp"
 #include "shearing_box/shearing_box.hpp"
 #include "bvals/bvals.hpp"
+#include "utils/numa_audit.hpp"
 #include "mhd/mhd.hpp"
 
 namespace mhd {
@@ -52,7 +53,11 @@ MHD::MHD(MeshBlockPack *ppack, ParameterInput *pin) :
     e3_cc("e3_cc",1,1,1,1),
     utest("utest",1,1,1,1,1),
     bcctest("bcctest",1,1,1,1,1),
-    fofc("fofc",1,1,1,1) {
+    fofc("fofc"),
+    u_sts("u_sts",1,1,1,1,1),
+    divf_sts("divf_sts",1,1,1,1,1),
+    b_sts("b_sts",1,1,1,1),
+    e_sts("e_sts",1,1,1,1) {
   // Total number of MeshBlocks on this rank to be used in array dimensioning
   int nmb = std::max((ppack->nmb_thispack), (ppack->pmesh->nmb_maxperrank));
 
@@ -128,14 +133,16 @@ MHD::MHD(MeshBlockPack *ppack, ParameterInput *pin) :
     int ncells1 = indcs.nx1 + 2*(indcs.ng);
     int ncells2 = (indcs.nx2 > 1)? (indcs.nx2 + 2*(indcs.ng)) : 1;
     int ncells3 = (indcs.nx3 > 1)? (indcs.nx3 + 2*(indcs.ng)) : 1;
-    Kokkos::realloc(u0,   nmb, (nmhd+nscalars), ncells3, ncells2, ncells1);
-    Kokkos::realloc(w0,   nmb, (nmhd+nscalars), ncells3, ncells2, ncells1);
+    // first-touch allocation places pages on the NUMA node of the thread that later
+    // iterates over them in the flux/update kernels (no-op on device builds)
+    realloc_first_touch(u0,   nmb, (nmhd+nscalars), ncells3, ncells2, ncells1);
+    realloc_first_touch(w0,   nmb, (nmhd+nscalars), ncells3, ncells2, ncells1);
 
     // allocate memory for face-centered and cell-centered magnetic fields
-    Kokkos::realloc(bcc0,   nmb, 3, ncells3, ncells2, ncells1);
-    Kokkos::realloc(b0.x1f, nmb, ncells3, ncells2, ncells1+1);
-    Kokkos::realloc(b0.x2f, nmb, ncells3, ncells2+1, ncells1);
-    Kokkos::realloc(b0.x3f, nmb, ncells3+1, ncells2, ncells1);
+    realloc_first_touch(bcc0,   nmb, 3, ncells3, ncells2, ncells1);
+    realloc_first_touch(b0.x1f, nmb, ncells3, ncells2, ncells1+1);
+    realloc_first_touch(b0.x2f, nmb, ncells3, ncells2+1, ncells1);
+    realloc_first_touch(b0.x3f, nmb, ncells3+1, ncells2, ncells1);
   }
 
   // allocate memory for conserved variables on coarse mesh
@@ -145,14 +152,34 @@ MHD::MHD(MeshBlockPack *ppack, ParameterInput *pin) :
     int n_ccells2 = (indcs.cnx2 > 1)? (indcs.cnx2 + 2*(indcs.ng)) : 1;
     int n_ccells3 = (indcs.cnx3 > 1)? (indcs.cnx3 + 2*(indcs.ng)) : 1;
     Kokkos::realloc(coarse_u0, nmb, (nmhd+nscalars), n_ccells3, n_ccells2, n_ccells1);
-    Kokkos::realloc(coarse_w0, nmb, (nmhd+nscalars), n_ccells3, n_ccells2, n_ccells1);
+    // coarse primitives are only touched when prolongating primitive variables, so do
+    // not spend device memory on them otherwise
+    if (ppack->pmesh->pmr->prolong_prims) {
+      Kokkos::realloc(coarse_w0, nmb, (nmhd+nscalars), n_ccells3, n_ccells2, n_ccells1);
+    }
     Kokkos::realloc(coarse_b0.x1f, nmb, n_ccells3, n_ccells2, n_ccells1+1);
     Kokkos::realloc(coarse_b0.x2f, nmb, n_ccells3, n_ccells2+1, n_ccells1);
     Kokkos::realloc(coarse_b0.x3f, nmb, n_ccells3+1, n_ccells2, n_ccells1);
   }
 
-  // allocate boundary buffers for conserved (cell-centered) and face-centered variables
-  pbval_u = new MeshBoundaryValuesCC(ppack, pin, false);
+  // allocate boundary buffers for conserved (cell-centered) and face-centered variables.
+  // Cell-centered exchanges carry only the ghost layers the reconstruction stencil reads
+  // (+1 with FOFC) instead of the global nghost, which mixed-physics runs must set for
+  // the deepest stencil present (e.g. the z4c FD stencil in merger runs); checks that
+  // nghost itself is deep enough are made where the method is selected below.  The
+  // face-centered field exchange keeps the full depth, as do ion-neutral runs, which
+  // exchange both fluids through these buffers
+  int ng_exch = -1;
+  if (evolution_t.compare("stationary") != 0 && !(pin->DoesBlockExist("ion-neutral"))) {
+    std::string xorder = pin->GetOrAddString("mhd","reconstruct","plm");
+    ng_exch = (xorder.compare("dc") == 0)? 1 : ((xorder.compare("plm") == 0)? 2 : 3);
+    if (pin->GetOrAddBoolean("mhd","fofc",false)) {ng_exch += 1;}
+    // diffusive fluxes read transverse gradients one cell beyond the flux face
+    if ((pvisc != nullptr) || (pcond != nullptr) || (presist != nullptr)) {
+      ng_exch = std::max(ng_exch,2);
+    }
+  }
+  pbval_u = new MeshBoundaryValuesCC(ppack, pin, false, ng_exch);
   pbval_u->InitializeBuffers((nmhd+nscalars));
   pbval_b = new MeshBoundaryValuesFC(ppack, pin);
   pbval_b->InitializeBuffers(3);
@@ -175,6 +202,31 @@ MHD::MHD(MeshBlockPack *ppack, ParameterInput *pin) :
     // determine if FOFC is enabled
     use_fofc = pin->GetOrAddBoolean("mhd","fofc",false);
 
+    // determine if diffusion terms are advanced with RKL2 super-time-stepping
+    use_sts = pin->GetOrAddBoolean("time","sts",false);
+    if (use_sts) {
+      if ((pvisc == nullptr) && (presist == nullptr) && (pcond == nullptr)) {
+        std::cout << "### FATAL ERROR in " << __FILE__ << " at line " << __LINE__
+                  << std::endl << "<time> sts=true requires viscosity, resistivity, "
+                  << "and/or conductivity in <mhd> block" << std::endl;
+        std::exit(EXIT_FAILURE);
+      }
+      if (psrc->shearing_box) {
+        std::cout << "### FATAL ERROR in " << __FILE__ << " at line " << __LINE__
+                  << std::endl << "<time> sts=true not implemented for shearing box"
+                  << std::endl;
+        std::exit(EXIT_FAILURE);
+      }
+      // STS task lists are only assembled for single-fluid (M)HD
+      if (pin->DoesBlockExist("radiation") || pin->DoesBlockExist("adm") ||
+          pin->DoesBlockExist("z4c") || pin->DoesBlockExist("ion-neutral")) {
+        std::cout << "### FATAL ERROR in " << __FILE__ << " at line " << __LINE__
+                  << std::endl << "<time> sts=true only implemented for single-fluid "
+                  << "hydro and MHD" << std::endl;
+        std::exit(EXIT_FAILURE);
+      }
+    }
+
     // select reconstruction method (default PLM)
     std::string xorder = pin->GetOrAddString("mhd","reconstruct","plm");
     if (xorder.compare("dc") == 0) {
@@ -191,7 +243,8 @@ MHD::MHD(MeshBlockPack *ppack, ParameterInput *pin) :
       }
     } else if (xorder.compare("ppm4") == 0 ||
                xorder.compare("ppmx") == 0 ||
-               xorder.compare("wenoz") == 0) {
+               xorder.compare("wenoz") == 0 ||
+               xorder.compare("wenoza") == 0) {
       // check that nghost > 2
       auto &indcs = pmy_pack->pmesh->mb_indcs;
       if (indcs.ng < 3) {
@@ -213,6 +266,8 @@ MHD::MHD(MeshBlockPack *ppack, ParameterInput *pin) :
         recon_method = ReconstructionMethod::ppmx;
       } else if (xorder.compare("wenoz") == 0) {
         recon_method = ReconstructionMethod::wenoz;
+      } else if (xorder.compare("wenoza") == 0) {
+        recon_method = ReconstructionMethod::wenoza;
       }
     } else {
       std::cout << "### FATAL ERROR in " << __FILE__ << " at line " << __LINE__
@@ -304,18 +359,29 @@ MHD::MHD(MeshBlockPack *ppack, ParameterInput *pin) :
       int ncells1 = indcs.nx1 + 2*(indcs.ng);
       int ncells2 = (indcs.nx2 > 1)? (indcs.nx2 + 2*(indcs.ng)) : 1;
       int ncells3 = (indcs.nx3 > 1)? (indcs.nx3 + 2*(indcs.ng)) : 1;
-      Kokkos::realloc(u1,     nmb, (nmhd+nscalars), ncells3, ncells2, ncells1);
-      Kokkos::realloc(b1.x1f, nmb, ncells3, ncells2, ncells1+1);
-      Kokkos::realloc(b1.x2f, nmb, ncells3, ncells2+1, ncells1);
-      Kokkos::realloc(b1.x3f, nmb, ncells3+1, ncells2, ncells1);
+      // first-touch allocations, as for u0/w0 above
+      realloc_first_touch(u1,     nmb, (nmhd+nscalars), ncells3, ncells2, ncells1);
+      realloc_first_touch(b1.x1f, nmb, ncells3, ncells2, ncells1+1);
+      realloc_first_touch(b1.x2f, nmb, ncells3, ncells2+1, ncells1);
+      realloc_first_touch(b1.x3f, nmb, ncells3+1, ncells2, ncells1);
 
       // allocate fluxes, electric fields
-      Kokkos::realloc(uflx.x1f, nmb, (nmhd+nscalars), ncells3, ncells2, ncells1+1);
-      Kokkos::realloc(uflx.x2f, nmb, (nmhd+nscalars), ncells3, ncells2+1, ncells1);
-      Kokkos::realloc(uflx.x3f, nmb, (nmhd+nscalars), ncells3+1, ncells2, ncells1);
-      Kokkos::realloc(efld.x1e, nmb, ncells3+1, ncells2+1, ncells1);
-      Kokkos::realloc(efld.x2e, nmb, ncells3+1, ncells2, ncells1+1);
-      Kokkos::realloc(efld.x3e, nmb, ncells3, ncells2+1, ncells1+1);
+      realloc_first_touch(uflx.x1f, nmb, (nmhd+nscalars), ncells3, ncells2, ncells1+1);
+      realloc_first_touch(uflx.x2f, nmb, (nmhd+nscalars), ncells3, ncells2+1, ncells1);
+      realloc_first_touch(uflx.x3f, nmb, (nmhd+nscalars), ncells3+1, ncells2, ncells1);
+      realloc_first_touch(efld.x1e, nmb, ncells3+1, ncells2+1, ncells1);
+      realloc_first_touch(efld.x2e, nmb, ncells3+1, ncells2, ncells1+1);
+      realloc_first_touch(efld.x3e, nmb, ncells3, ncells2+1, ncells1+1);
+
+      // optionally report NUMA page placement of the largest pack-level arrays
+      if (pin->GetOrAddBoolean("mesh", "numa_audit", false) &&
+          global_variable::my_rank == 0) {
+        numa::AuditPages("mhd u0", u0.data(), u0.span()*sizeof(Real));
+        numa::AuditPages("mhd w0", w0.data(), w0.span()*sizeof(Real));
+        numa::AuditPages("mhd b0.x1f", b0.x1f.data(), b0.x1f.span()*sizeof(Real));
+        numa::AuditPages("mhd uflx.x1f", uflx.x1f.data(),
+                         uflx.x1f.span()*sizeof(Real));
+      }
 
       // allocate scratch arrays for face- and cell-centered E used in CornerE
       Kokkos::realloc(e3x1, nmb, ncells3, ncells2, ncells1);
@@ -324,17 +390,44 @@ MHD::MHD(MeshBlockPack *ppack, ParameterInput *pin) :
       Kokkos::realloc(e3x2, nmb, ncells3, ncells2, ncells1);
       Kokkos::realloc(e2x3, nmb, ncells3, ncells2, ncells1);
       Kokkos::realloc(e1x3, nmb, ncells3, ncells2, ncells1);
-      Kokkos::realloc(e1_cc, nmb, ncells3, ncells2, ncells1);
-      Kokkos::realloc(e2_cc, nmb, ncells3, ncells2, ncells1);
-      Kokkos::realloc(e3_cc, nmb, ncells3, ncells2, ncells1);
+      // cell-centered E only stored in global arrays in relativistic MHD; in Newtonian
+      // MHD it is computed in scratch in a fused corner-EMF kernel (see MHD::CornerE)
+      if ((pmy_pack->pcoord->is_general_relativistic) ||
+          (pmy_pack->pcoord->is_special_relativistic) ||
+          (pmy_pack->pcoord->is_dynamical_relativistic)) {
+        Kokkos::realloc(e1_cc, nmb, ncells3, ncells2, ncells1);
+        Kokkos::realloc(e2_cc, nmb, ncells3, ncells2, ncells1);
+        Kokkos::realloc(e3_cc, nmb, ncells3, ncells2, ncells1);
+      }
 
       // allocate array of flags used with FOFC
       if (use_fofc) {
         int nvars = (pmy_pack->pcoord->is_dynamical_relativistic) ? nmhd+nscalars : nmhd;
-        Kokkos::realloc(fofc,    nmb, ncells3, ncells2, ncells1);
+        fofc.Realloc(nmb, ncells3, ncells2, ncells1);
         Kokkos::realloc(utest,   nmb, nvars, ncells3, ncells2, ncells1);
         Kokkos::realloc(bcctest, nmb, 3,    ncells3, ncells2, ncells1);
-        Kokkos::deep_copy(fofc, false);
+      }
+
+      // allocate compacted list of flagged cells used with FOFC and/or excision
+      if (use_fofc || (pmy_pack->pcoord->is_general_relativistic &&
+                       pmy_pack->pcoord->coord_data.bh_excise)) {
+        Kokkos::realloc(fofc_list, nmb*ncells3*ncells2*ncells1);
+        Kokkos::realloc(nfofc, 1);
+      }
+
+      // allocate registers used by RKL2 super-time-stepping of diffusion terms
+      if (use_sts) {
+        Kokkos::realloc(u_sts,    nmb, (nmhd+nscalars), ncells3, ncells2, ncells1);
+        Kokkos::realloc(divf_sts, nmb, (nmhd+nscalars), ncells3, ncells2, ncells1);
+        // face-centered B and resistive E-field at Y_0, only needed with resistivity
+        if (presist != nullptr) {
+          Kokkos::realloc(b_sts.x1f, nmb, ncells3, ncells2, ncells1+1);
+          Kokkos::realloc(b_sts.x2f, nmb, ncells3, ncells2+1, ncells1);
+          Kokkos::realloc(b_sts.x3f, nmb, ncells3+1, ncells2, ncells1);
+          Kokkos::realloc(e_sts.x1e, nmb, ncells3+1, ncells2+1, ncells1);
+          Kokkos::realloc(e_sts.x2e, nmb, ncells3+1, ncells2, ncells1+1);
+          Kokkos::realloc(e_sts.x3e, nmb, ncells3, ncells2+1, ncells1+1);
+        }
       }
     }
   }
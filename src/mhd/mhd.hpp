@@ -46,6 +46,7 @@ enum class MHD_RSolver {advect, llf, hlle, hlld, roe,   // non-relativistic
 
 struct MHDTaskIDs {
   TaskID savest;
+  TaskID coolsub;
   TaskID irecv;
   TaskID copyu;
   TaskID flux;
@@ -70,6 +71,7 @@ struct MHDTaskIDs {
   TaskID restb;
   TaskID sendb;
   TaskID recvb;
+  TaskID c2p_int;
   TaskID sendb_shr;
   TaskID recvb_shr;
   TaskID bcs;
@@ -78,6 +80,26 @@ struct MHDTaskIDs {
   TaskID newdt;
   TaskID csend;
   TaskID crecv;
+  TaskID sts_irecv;
+  TaskID sts_flux;
+  TaskID sts_sendf;
+  TaskID sts_recvf;
+  TaskID sts_rkupdt;
+  TaskID sts_efld;
+  TaskID sts_sende;
+  TaskID sts_recve;
+  TaskID sts_ct;
+  TaskID sts_restu;
+  TaskID sts_sendu;
+  TaskID sts_recvu;
+  TaskID sts_restb;
+  TaskID sts_sendb;
+  TaskID sts_recvb;
+  TaskID sts_bcs;
+  TaskID sts_prol;
+  TaskID sts_c2p;
+  TaskID sts_csend;
+  TaskID sts_crecv;
 };
 
 namespace mhd {
@@ -140,8 +162,17 @@ class MHD {
   DvceArray5D<Real> bccsaved;
 
   // following used for FOFC algorithm
-  DvceArray4D<bool> fofc;  // flag for each cell to indicate if FOFC is needed
+  DvceBitFlag4D fofc;  // per-cell flag (bit-packed) to indicate if FOFC is needed
   bool use_fofc = false;   // flag to enable FOFC
+  DvceArray1D<int> fofc_list;  // compacted list of flagged cells (encoded indices)
+  DvceArray1D<int> nfofc;      // number of cells in fofc_list (single element)
+
+  // following used for RKL2 super-time-stepping of diffusion terms
+  bool use_sts = false;        // flag to advance diffusion with operator-split RKL2 STS
+  DvceArray5D<Real> u_sts;     // conserved variables at start of STS update (Y_0)
+  DvceArray5D<Real> divf_sts;  // diffusive flux divergence at Y_0
+  DvceFaceFld4D<Real> b_sts;   // face-centered B at Y_0 (only with resistivity)
+  DvceEdgeFld4D<Real> e_sts;   // resistive E-field at Y_0 (only with resistivity)
 
   // container to hold names of TaskIDs
   MHDTaskIDs id;
@@ -151,6 +182,8 @@ class MHD {
   void AssembleMHDTasks(std::map<std::string, std::shared_ptr<TaskList>> tl);
   // ...in "before_timeintegrator" task list
   TaskStatus SaveMHDState(Driver *d, int stage);
+  // ...in "after_timeintegrator" task list
+  TaskStatus CoolingSubcycle(Driver *d, int stage);
   // ...in "before_stagen_tl" task list
   TaskStatus InitRecv(Driver *d, int stage);
   // ...in "stagen_tl" task list
@@ -159,6 +192,10 @@ class MHD {
   TaskStatus SendFlux(Driver *d, int stage);
   TaskStatus RecvFlux(Driver *d, int stage);
   TaskStatus RKUpdate(Driver *d, int stage);
+  // RKUpdate kernel templated over dimensionality; RKUpdate() dispatches to the
+  // specialization for this problem so 1D/2D runs compile out the transverse terms
+  template <bool MULTI_D, bool THREE_D>
+  TaskStatus RKUpdateDim(Driver *d, int stage);
   TaskStatus MHDSrcTerms(Driver *d, int stage);
   TaskStatus SendU_OA(Driver *d, int stage);
   TaskStatus RecvU_OA(Driver *d, int stage);
@@ -182,12 +219,27 @@ class MHD {
   TaskStatus ApplyPhysicalBCs(Driver* pdrive, int stage);
   TaskStatus Prolongate(Driver* pdrive, int stage);
   TaskStatus ConToPrim(Driver *d, int stage);
+  TaskStatus ConToPrimInterior(Driver *d, int stage);
+  TaskStatus ConToPrimGhosts(Driver *d, int stage);
   TaskStatus NewTimeStep(Driver *d, int stage);
   // ...in "after_stagen_tl" task list
   TaskStatus ClearSend(Driver *d, int stage);
   TaskStatus ClearRecv(Driver *d, int stage);  // also in Driver::Initialize
+  // ...in "sts_*" task lists (RKL2 super-time-stepping of diffusion terms)
+  TaskStatus STSInitRecv(Driver *d, int stage);
+  TaskStatus STSFluxes(Driver *d, int stage);
+  TaskStatus STSRKUpdate(Driver *d, int stage);
+  TaskStatus STSCornerE(Driver *d, int stage);
+  TaskStatus STSCT(Driver *d, int stage);
+  TaskStatus STSClearSend(Driver *d, int stage);
+  TaskStatus STSClearRecv(Driver *d, int stage);
 
-  // CalculateFluxes function templated over Riemann Solvers
+  // CalculateFluxes function templated over Riemann Solvers and inline diffusive flux
+  // hook (viscous momentum/energy and Ohmic energy fluxes)
+  template <MHD_RSolver T, bool add_diff>
+  void CalculateFluxes(Driver *d, int stage);
+  // dispatch function templated over Riemann Solver only; enables the diffusive hook at
+  // compile time when those terms are active (and not advanced with operator-split STS)
   template <MHD_RSolver T>
   void CalculateFluxes(Driver *d, int stage);
 
@@ -33,6 +33,14 @@ TaskStatus MHD::CornerE(Driver *pdriver, int stage) {
   auto &flat = pmy_pack->pcoord->coord_data.is_minkowski;
   auto &spin = pmy_pack->pcoord->coord_data.bh_spin;
 
+  // In relativistic MHD cell-centered EMFs are stored in global arrays, since computing
+  // them requires the metric.  In Newtonian MHD they are cheap enough to compute in
+  // scratch memory inside a fused corner-EMF kernel, which eliminates the global memory
+  // round-trip through the e1_cc/e2_cc/e3_cc arrays.
+  bool relativistic = (pmy_pack->padm != nullptr) ||
+                      (pmy_pack->pcoord->is_general_relativistic) ||
+                      (pmy_pack->pcoord->is_special_relativistic);
+
   //---- 1-D problem:
   //  copy face-centered E-fields to edges and return.
   //  Note e2[is:ie+1,js:je,  ks:ke+1]
@@ -142,14 +150,6 @@ TaskStatus MHD::CornerE(Driver *pdriver, int stage) {
         Real u0 = sqrt(1.0 + SQR(u1) + SQR(u2) + SQR(u3));
         e3cc_(m,ks,j,i) = (u2 * bcc_(m,IBX,ks,j,i) - u1 * bcc_(m,IBY,ks,j,i)) / u0;
       });
-
-    // compute cell-centered EMF in Newtonian MHD
-    } else {
-      par_for("e_cc_2d", DevExeSpace(), 0, nmb1, js-1, je+1, is-1, ie+1,
-      KOKKOS_LAMBDA(int m, int j, int i) {
-        e3cc_(m,ks,j,i) = w0_(m,IVY,ks,j,i)*bcc_(m,IBX,ks,j,i) -
-                          w0_(m,IVX,ks,j,i)*bcc_(m,IBY,ks,j,i);
-      });
     }
 
     // capture class variables for the kernels
@@ -167,37 +167,92 @@ TaskStatus MHD::CornerE(Driver *pdriver, int stage) {
     //  Note e1[is:ie,  js:je+1,ks:ke+1]
     //       e2[is:ie+1,js:je,  ks:ke+1]
     //       e3[is:ie+1,js:je+1,ks:ke  ]
-    par_for("emf2", DevExeSpace(), 0, nmb1, js, je+1, is, ie+1,
-    KOKKOS_LAMBDA(const int m, const int j, const int i) {
-      e2(m,ks  ,j,i) = e2x1_(m,ks,j,i);
-      e2(m,ke+1,j,i) = e2x1_(m,ks,j,i);
-      e1(m,ks  ,j,i) = e1x2_(m,ks,j,i);
-      e1(m,ke+1,j,i) = e1x2_(m,ks,j,i);
-
-      Real e3_l2, e3_r2, e3_l1, e3_r1;
-      if (flx1(m,IDN,ks,j-1,i) >= 0.0) {
-        e3_l2 = e3x2_(m,ks,j,i-1) - e3cc_(m,ks,j-1,i-1);
-      } else {
-        e3_l2 = e3x2_(m,ks,j,i  ) - e3cc_(m,ks,j-1,i  );
-      }
-      if (flx1(m,IDN,ks,j,i) >= 0.0) {
-        e3_r2 = e3x2_(m,ks,j,i-1) - e3cc_(m,ks,j  ,i-1);
-      } else {
-        e3_r2 = e3x2_(m,ks,j,i  ) - e3cc_(m,ks,j  ,i  );
-      }
-      if (flx2(m,IDN,ks,j,i-1) >= 0.0) {
-        e3_l1 = e3x1_(m,ks,j-1,i) - e3cc_(m,ks,j-1,i-1);
-      } else {
-        e3_l1 = e3x1_(m,ks,j  ,i) - e3cc_(m,ks,j  ,i-1);
-      }
-      if (flx2(m,IDN,ks,j,i) >= 0.0) {
-        e3_r1 = e3x1_(m,ks,j-1,i) - e3cc_(m,ks,j-1,i  );
-      } else {
-        e3_r1 = e3x1_(m,ks,j  ,i) - e3cc_(m,ks,j  ,i  );
-      }
-      e3(m,ks,j,i) = 0.25*(e3_l1 + e3_r1 + e3_l2 + e3_r2 +
-             e3x2_(m,ks,j,i-1) + e3x2_(m,ks,j,i) + e3x1_(m,ks,j-1,i) + e3x1_(m,ks,j,i));
-    });
+    if (relativistic) {
+      par_for("emf2", DevExeSpace(), 0, nmb1, js, je+1, is, ie+1,
+      KOKKOS_LAMBDA(const int m, const int j, const int i) {
+        e2(m,ks  ,j,i) = e2x1_(m,ks,j,i);
+        e2(m,ke+1,j,i) = e2x1_(m,ks,j,i);
+        e1(m,ks  ,j,i) = e1x2_(m,ks,j,i);
+        e1(m,ke+1,j,i) = e1x2_(m,ks,j,i);
+
+        Real e3_l2, e3_r2, e3_l1, e3_r1;
+        if (flx1(m,IDN,ks,j-1,i) >= 0.0) {
+          e3_l2 = e3x2_(m,ks,j,i-1) - e3cc_(m,ks,j-1,i-1);
+        } else {
+          e3_l2 = e3x2_(m,ks,j,i  ) - e3cc_(m,ks,j-1,i  );
+        }
+        if (flx1(m,IDN,ks,j,i) >= 0.0) {
+          e3_r2 = e3x2_(m,ks,j,i-1) - e3cc_(m,ks,j  ,i-1);
+        } else {
+          e3_r2 = e3x2_(m,ks,j,i  ) - e3cc_(m,ks,j  ,i  );
+        }
+        if (flx2(m,IDN,ks,j,i-1) >= 0.0) {
+          e3_l1 = e3x1_(m,ks,j-1,i) - e3cc_(m,ks,j-1,i-1);
+        } else {
+          e3_l1 = e3x1_(m,ks,j  ,i) - e3cc_(m,ks,j  ,i-1);
+        }
+        if (flx2(m,IDN,ks,j,i) >= 0.0) {
+          e3_r1 = e3x1_(m,ks,j-1,i) - e3cc_(m,ks,j-1,i  );
+        } else {
+          e3_r1 = e3x1_(m,ks,j  ,i) - e3cc_(m,ks,j  ,i  );
+        }
+        e3(m,ks,j,i) = 0.25*(e3_l1 + e3_r1 + e3_l2 + e3_r2 +
+               e3x2_(m,ks,j,i-1) + e3x2_(m,ks,j,i) + e3x1_(m,ks,j-1,i) + e3x1_(m,ks,j,i));
+      });
+
+    // In Newtonian MHD, fuse computation of cell-centered E3 (held in scratch memory)
+    // with the integration to corners
+    } else {
+      int ncells1 = indcs.nx1 + 2*(indcs.ng);
+      int scr_level = 0;
+      size_t scr_size = ScrArray1D<Real>::shmem_size(ncells1)*2;
+
+      par_for_outer("emf2", DevExeSpace(), scr_size, scr_level, 0, nmb1, js, je+1,
+      KOKKOS_LAMBDA(TeamMember_t member, const int m, const int j) {
+        ScrArray1D<Real> e3cc_jm1(member.team_scratch(scr_level), ncells1);
+        ScrArray1D<Real> e3cc_j(member.team_scratch(scr_level), ncells1);
+
+        // compute cell-centered E3 = -(v X B) = VyBx-VxBy in rows j-1 and j
+        par_for_inner(member, is-1, ie+1, [&](const int i) {
+          e3cc_jm1(i) = w0_(m,IVY,ks,j-1,i)*bcc_(m,IBX,ks,j-1,i) -
+                        w0_(m,IVX,ks,j-1,i)*bcc_(m,IBY,ks,j-1,i);
+          e3cc_j(i)   = w0_(m,IVY,ks,j  ,i)*bcc_(m,IBX,ks,j  ,i) -
+                        w0_(m,IVX,ks,j  ,i)*bcc_(m,IBY,ks,j  ,i);
+        });
+        member.team_barrier();
+
+        par_for_inner(member, is, ie+1, [&](const int i) {
+          e2(m,ks  ,j,i) = e2x1_(m,ks,j,i);
+          e2(m,ke+1,j,i) = e2x1_(m,ks,j,i);
+          e1(m,ks  ,j,i) = e1x2_(m,ks,j,i);
+          e1(m,ke+1,j,i) = e1x2_(m,ks,j,i);
+
+          Real e3_l2, e3_r2, e3_l1, e3_r1;
+          if (flx1(m,IDN,ks,j-1,i) >= 0.0) {
+            e3_l2 = e3x2_(m,ks,j,i-1) - e3cc_jm1(i-1);
+          } else {
+            e3_l2 = e3x2_(m,ks,j,i  ) - e3cc_jm1(i  );
+          }
+          if (flx1(m,IDN,ks,j,i) >= 0.0) {
+            e3_r2 = e3x2_(m,ks,j,i-1) - e3cc_j(i-1);
+          } else {
+            e3_r2 = e3x2_(m,ks,j,i  ) - e3cc_j(i  );
+          }
+          if (flx2(m,IDN,ks,j,i-1) >= 0.0) {
+            e3_l1 = e3x1_(m,ks,j-1,i) - e3cc_jm1(i-1);
+          } else {
+            e3_l1 = e3x1_(m,ks,j  ,i) - e3cc_j(i-1);
+          }
+          if (flx2(m,IDN,ks,j,i) >= 0.0) {
+            e3_r1 = e3x1_(m,ks,j-1,i) - e3cc_jm1(i);
+          } else {
+            e3_r1 = e3x1_(m,ks,j  ,i) - e3cc_j(i);
+          }
+          e3(m,ks,j,i) = 0.25*(e3_l1 + e3_r1 + e3_l2 + e3_r2 +
+               e3x2_(m,ks,j,i-1) + e3x2_(m,ks,j,i) + e3x1_(m,ks,j-1,i) + e3x1_(m,ks,j,i));
+        });
+      });
+    }
   }
 
   //---- 3-D problem:
@@ -303,18 +358,6 @@ TaskStatus MHD::CornerE(Driver *pdriver, int stage) {
         e2cc_(m,k,j,i) = (u1 * bcc_(m,IBZ,k,j,i) - u3 * bcc_(m,IBX,k,j,i)) / u0;
         e3cc_(m,k,j,i) = (u2 * bcc_(m,IBX,k,j,i) - u1 * bcc_(m,IBY,k,j,i)) / u0;
       });
-
-    // compute cell-centered EMFs in Newtonian MHD
-    } else {
-      par_for("e_cc_3d", DevExeSpace(), 0, nmb1, ks-1, ke+1, js-1, je+1, is-1, ie+1,
-      KOKKOS_LAMBDA(int m, int k, int j, int i) {
-        e1cc_(m,k,j,i) = w0_(m,IVZ,k,j,i)*bcc_(m,IBY,k,j,i) -
-                         w0_(m,IVY,k,j,i)*bcc_(m,IBZ,k,j,i);
-        e2cc_(m,k,j,i) = w0_(m,IVX,k,j,i)*bcc_(m,IBZ,k,j,i) -
-                         w0_(m,IVZ,k,j,i)*bcc_(m,IBX,k,j,i);
-        e3cc_(m,k,j,i) = w0_(m,IVY,k,j,i)*bcc_(m,IBX,k,j,i) -
-                         w0_(m,IVX,k,j,i)*bcc_(m,IBY,k,j,i);
-      });
     }
 
     // capture class variables for the kernels
@@ -335,87 +378,212 @@ TaskStatus MHD::CornerE(Driver *pdriver, int stage) {
     //  Note e1[is:ie,  js:je+1,ks:ke+1]
     //       e2[is:ie+1,js:je,  ks:ke+1]
     //       e3[is:ie+1,js:je+1,ks:ke  ]
-    par_for("emf3", DevExeSpace(), 0, nmb1, ks, ke+1, js, je+1, is, ie+1,
-    KOKKOS_LAMBDA(const int m, const int k, const int j, const int i) {
-      // integrate E1 to corner using SG07
-      Real e1_l3, e1_r3, e1_l2, e1_r2;
-      if (flx2(m,IDN,k-1,j,i) >= 0.0) {
-        e1_l3 = e1x3_(m,k,j-1,i) - e1cc_(m,k-1,j-1,i);
-      } else {
-        e1_l3 = e1x3_(m,k,j  ,i) - e1cc_(m,k-1,j  ,i);
-      }
-      if (flx2(m,IDN,k,j,i) >= 0.0) {
-        e1_r3 = e1x3_(m,k,j-1,i) - e1cc_(m,k  ,j-1,i);
-      } else {
-        e1_r3 = e1x3_(m,k,j  ,i) - e1cc_(m,k  ,j  ,i);
-      }
-      if (flx3(m,IDN,k,j-1,i) >= 0.0) {
-        e1_l2 = e1x2_(m,k-1,j,i) - e1cc_(m,k-1,j-1,i);
-      } else {
-        e1_l2 = e1x2_(m,k  ,j,i) - e1cc_(m,k  ,j-1,i);
-      }
-      if (flx3(m,IDN,k,j,i) >= 0.0) {
-        e1_r2 = e1x2_(m,k-1,j,i) - e1cc_(m,k-1,j  ,i);
-      } else {
-        e1_r2 = e1x2_(m,k  ,j,i) - e1cc_(m,k  ,j  ,i);
-      }
-      e1(m,k,j,i) = 0.25*(e1_l3 + e1_r3 + e1_l2 + e1_r2 +
-                e1x2_(m,k-1,j,i) + e1x2_(m,k,j,i) + e1x3_(m,k,j-1,i) + e1x3_(m,k,j,i));
-
-      // integrate E2 to corner using SG07
-      Real e2_l3, e2_r3, e2_l1, e2_r1;
-      if (flx1(m,IDN,k-1,j,i) >= 0.0) {
-        e2_l3 = e2x3_(m,k,j,i-1) - e2cc_(m,k-1,j,i-1);
-      } else {
-        e2_l3 = e2x3_(m,k,j,i  ) - e2cc_(m,k-1,j,i  );
-      }
-      if (flx1(m,IDN,k,j,i) >= 0.0) {
-        e2_r3 = e2x3_(m,k,j,i-1) - e2cc_(m,k  ,j,i-1);
-      } else {
-        e2_r3 = e2x3_(m,k,j,i  ) - e2cc_(m,k  ,j,i  );
-      }
-      if (flx3(m,IDN,k,j,i-1) >= 0.0) {
-        e2_l1 = e2x1_(m,k-1,j,i) - e2cc_(m,k-1,j,i-1);
-      } else {
-        e2_l1 = e2x1_(m,k  ,j,i) - e2cc_(m,k  ,j,i-1);
-      }
-      if (flx3(m,IDN,k,j,i) >= 0.0) {
-        e2_r1 = e2x1_(m,k-1,j,i) - e2cc_(m,k-1,j,i  );
-      } else {
-        e2_r1 = e2x1_(m,k  ,j,i) - e2cc_(m,k  ,j,i  );
-      }
-      e2(m,k,j,i) = 0.25*(e2_l3 + e2_r3 + e2_l1 + e2_r1 +
-                e2x3_(m,k,j,i-1) + e2x3_(m,k,j,i) + e2x1_(m,k-1,j,i) + e2x1_(m,k,j,i));
-
-      // integrate E3 to corner using SG07
-      Real e3_l2, e3_r2, e3_l1, e3_r1;
-      if (flx1(m,IDN,k,j-1,i) >= 0.0) {
-        e3_l2 = e3x2_(m,k,j,i-1) - e3cc_(m,k,j-1,i-1);
-      } else {
-        e3_l2 = e3x2_(m,k,j,i  ) - e3cc_(m,k,j-1,i  );
-      }
-      if (flx1(m,IDN,k,j,i) >= 0.0) {
-        e3_r2 = e3x2_(m,k,j,i-1) - e3cc_(m,k,j  ,i-1);
-      } else {
-        e3_r2 = e3x2_(m,k,j,i  ) - e3cc_(m,k,j  ,i  );
-      }
-      if (flx2(m,IDN,k,j,i-1) >= 0.0) {
-        e3_l1 = e3x1_(m,k,j-1,i) - e3cc_(m,k,j-1,i-1);
-      } else {
-        e3_l1 = e3x1_(m,k,j  ,i) - e3cc_(m,k,j  ,i-1);
-      }
-      if (flx2(m,IDN,k,j,i) >= 0.0) {
-        e3_r1 = e3x1_(m,k,j-1,i) - e3cc_(m,k,j-1,i  );
-      } else {
-        e3_r1 = e3x1_(m,k,j  ,i) - e3cc_(m,k,j  ,i  );
-      }
-      e3(m,k,j,i) = 0.25*(e3_l1 + e3_r1 + e3_l2 + e3_r2 +
-                e3x2_(m,k,j,i-1) + e3x2_(m,k,j,i) + e3x1_(m,k,j-1,i) + e3x1_(m,k,j,i));
-    });
+    if (relativistic) {
+      par_for("emf3", DevExeSpace(), 0, nmb1, ks, ke+1, js, je+1, is, ie+1,
+      KOKKOS_LAMBDA(const int m, const int k, const int j, const int i) {
+        // integrate E1 to corner using SG07
+        Real e1_l3, e1_r3, e1_l2, e1_r2;
+        if (flx2(m,IDN,k-1,j,i) >= 0.0) {
+          e1_l3 = e1x3_(m,k,j-1,i) - e1cc_(m,k-1,j-1,i);
+        } else {
+          e1_l3 = e1x3_(m,k,j  ,i) - e1cc_(m,k-1,j  ,i);
+        }
+        if (flx2(m,IDN,k,j,i) >= 0.0) {
+          e1_r3 = e1x3_(m,k,j-1,i) - e1cc_(m,k  ,j-1,i);
+        } else {
+          e1_r3 = e1x3_(m,k,j  ,i) - e1cc_(m,k  ,j  ,i);
+        }
+        if (flx3(m,IDN,k,j-1,i) >= 0.0) {
+          e1_l2 = e1x2_(m,k-1,j,i) - e1cc_(m,k-1,j-1,i);
+        } else {
+          e1_l2 = e1x2_(m,k  ,j,i) - e1cc_(m,k  ,j-1,i);
+        }
+        if (flx3(m,IDN,k,j,i) >= 0.0) {
+          e1_r2 = e1x2_(m,k-1,j,i) - e1cc_(m,k-1,j  ,i);
+        } else {
+          e1_r2 = e1x2_(m,k  ,j,i) - e1cc_(m,k  ,j  ,i);
+        }
+        e1(m,k,j,i) = 0.25*(e1_l3 + e1_r3 + e1_l2 + e1_r2 +
+                  e1x2_(m,k-1,j,i) + e1x2_(m,k,j,i) + e1x3_(m,k,j-1,i) + e1x3_(m,k,j,i));
+
+        // integrate E2 to corner using SG07
+        Real e2_l3, e2_r3, e2_l1, e2_r1;
+        if (flx1(m,IDN,k-1,j,i) >= 0.0) {
+          e2_l3 = e2x3_(m,k,j,i-1) - e2cc_(m,k-1,j,i-1);
+        } else {
+          e2_l3 = e2x3_(m,k,j,i  ) - e2cc_(m,k-1,j,i  );
+        }
+        if (flx1(m,IDN,k,j,i) >= 0.0) {
+          e2_r3 = e2x3_(m,k,j,i-1) - e2cc_(m,k  ,j,i-1);
+        } else {
+          e2_r3 = e2x3_(m,k,j,i  ) - e2cc_(m,k  ,j,i  );
+        }
+        if (flx3(m,IDN,k,j,i-1) >= 0.0) {
+          e2_l1 = e2x1_(m,k-1,j,i) - e2cc_(m,k-1,j,i-1);
+        } else {
+          e2_l1 = e2x1_(m,k  ,j,i) - e2cc_(m,k  ,j,i-1);
+        }
+        if (flx3(m,IDN,k,j,i) >= 0.0) {
+          e2_r1 = e2x1_(m,k-1,j,i) - e2cc_(m,k-1,j,i  );
+        } else {
+          e2_r1 = e2x1_(m,k  ,j,i) - e2cc_(m,k  ,j,i  );
+        }
+        e2(m,k,j,i) = 0.25*(e2_l3 + e2_r3 + e2_l1 + e2_r1 +
+                  e2x3_(m,k,j,i-1) + e2x3_(m,k,j,i) + e2x1_(m,k-1,j,i) + e2x1_(m,k,j,i));
+
+        // integrate E3 to corner using SG07
+        Real e3_l2, e3_r2, e3_l1, e3_r1;
+        if (flx1(m,IDN,k,j-1,i) >= 0.0) {
+          e3_l2 = e3x2_(m,k,j,i-1) - e3cc_(m,k,j-1,i-1);
+        } else {
+          e3_l2 = e3x2_(m,k,j,i  ) - e3cc_(m,k,j-1,i  );
+        }
+        if (flx1(m,IDN,k,j,i) >= 0.0) {
+          e3_r2 = e3x2_(m,k,j,i-1) - e3cc_(m,k,j  ,i-1);
+        } else {
+          e3_r2 = e3x2_(m,k,j,i  ) - e3cc_(m,k,j  ,i  );
+        }
+        if (flx2(m,IDN,k,j,i-1) >= 0.0) {
+          e3_l1 = e3x1_(m,k,j-1,i) - e3cc_(m,k,j-1,i-1);
+        } else {
+          e3_l1 = e3x1_(m,k,j  ,i) - e3cc_(m,k,j  ,i-1);
+        }
+        if (flx2(m,IDN,k,j,i) >= 0.0) {
+          e3_r1 = e3x1_(m,k,j-1,i) - e3cc_(m,k,j-1,i  );
+        } else {
+          e3_r1 = e3x1_(m,k,j  ,i) - e3cc_(m,k,j  ,i  );
+        }
+        e3(m,k,j,i) = 0.25*(e3_l1 + e3_r1 + e3_l2 + e3_r2 +
+                  e3x2_(m,k,j,i-1) + e3x2_(m,k,j,i) + e3x1_(m,k,j-1,i) + e3x1_(m,k,j,i));
+      });
+
+    // In Newtonian MHD, fuse computation of cell-centered EMFs (held in scratch memory)
+    // with the integration to corners.  Only the rows of E1cc/E2cc/E3cc referenced by
+    // corners in row (k,j) are computed by each team.
+    } else {
+      int ncells1 = indcs.nx1 + 2*(indcs.ng);
+      int scr_level = 0;
+      size_t scr_size = ScrArray1D<Real>::shmem_size(ncells1)*8;
+
+      par_for_outer("emf3", DevExeSpace(), scr_size, scr_level, 0, nmb1, ks, ke+1,
+                    js, je+1,
+      KOKKOS_LAMBDA(TeamMember_t member, const int m, const int k, const int j) {
+        ScrArray1D<Real> e1cc_km1_jm1(member.team_scratch(scr_level), ncells1);
+        ScrArray1D<Real> e1cc_km1_j(member.team_scratch(scr_level), ncells1);
+        ScrArray1D<Real> e1cc_k_jm1(member.team_scratch(scr_level), ncells1);
+        ScrArray1D<Real> e1cc_k_j(member.team_scratch(scr_level), ncells1);
+        ScrArray1D<Real> e2cc_km1(member.team_scratch(scr_level), ncells1);
+        ScrArray1D<Real> e2cc_k(member.team_scratch(scr_level), ncells1);
+        ScrArray1D<Real> e3cc_jm1(member.team_scratch(scr_level), ncells1);
+        ScrArray1D<Real> e3cc_j(member.team_scratch(scr_level), ncells1);
+
+        // compute cell-centered EMFs:
+        // E1=-(v X B)=VzBy-VyBz in rows (k-1,j-1),(k-1,j),(k,j-1),(k,j)
+        // E2=-(v X B)=VxBz-VzBx in rows (k-1,j),(k,j)
+        // E3=-(v X B)=VyBx-VxBy in rows (k,j-1),(k,j)
+        par_for_inner(member, is-1, ie+1, [&](const int i) {
+          e1cc_km1_jm1(i) = w0_(m,IVZ,k-1,j-1,i)*bcc_(m,IBY,k-1,j-1,i) -
+                            w0_(m,IVY,k-1,j-1,i)*bcc_(m,IBZ,k-1,j-1,i);
+          e1cc_km1_j(i)   = w0_(m,IVZ,k-1,j  ,i)*bcc_(m,IBY,k-1,j  ,i) -
+                            w0_(m,IVY,k-1,j  ,i)*bcc_(m,IBZ,k-1,j  ,i);
+          e1cc_k_jm1(i)   = w0_(m,IVZ,k  ,j-1,i)*bcc_(m,IBY,k  ,j-1,i) -
+                            w0_(m,IVY,k  ,j-1,i)*bcc_(m,IBZ,k  ,j-1,i);
+          e1cc_k_j(i)     = w0_(m,IVZ,k  ,j  ,i)*bcc_(m,IBY,k  ,j  ,i) -
+                            w0_(m,IVY,k  ,j  ,i)*bcc_(m,IBZ,k  ,j  ,i);
+          e2cc_km1(i)     = w0_(m,IVX,k-1,j  ,i)*bcc_(m,IBZ,k-1,j  ,i) -
+                            w0_(m,IVZ,k-1,j  ,i)*bcc_(m,IBX,k-1,j  ,i);
+          e2cc_k(i)       = w0_(m,IVX,k  ,j  ,i)*bcc_(m,IBZ,k  ,j  ,i) -
+                            w0_(m,IVZ,k  ,j  ,i)*bcc_(m,IBX,k  ,j  ,i);
+          e3cc_jm1(i)     = w0_(m,IVY,k  ,j-1,i)*bcc_(m,IBX,k  ,j-1,i) -
+                            w0_(m,IVX,k  ,j-1,i)*bcc_(m,IBY,k  ,j-1,i);
+          e3cc_j(i)       = w0_(m,IVY,k  ,j  ,i)*bcc_(m,IBX,k  ,j  ,i) -
+                            w0_(m,IVX,k  ,j  ,i)*bcc_(m,IBY,k  ,j  ,i);
+        });
+        member.team_barrier();
+
+        par_for_inner(member, is, ie+1, [&](const int i) {
+          // integrate E1 to corner using SG07
+          Real e1_l3, e1_r3, e1_l2, e1_r2;
+          if (flx2(m,IDN,k-1,j,i) >= 0.0) {
+            e1_l3 = e1x3_(m,k,j-1,i) - e1cc_km1_jm1(i);
+          } else {
+            e1_l3 = e1x3_(m,k,j  ,i) - e1cc_km1_j(i);
+          }
+          if (flx2(m,IDN,k,j,i) >= 0.0) {
+            e1_r3 = e1x3_(m,k,j-1,i) - e1cc_k_jm1(i);
+          } else {
+            e1_r3 = e1x3_(m,k,j  ,i) - e1cc_k_j(i);
+          }
+          if (flx3(m,IDN,k,j-1,i) >= 0.0) {
+            e1_l2 = e1x2_(m,k-1,j,i) - e1cc_km1_jm1(i);
+          } else {
+            e1_l2 = e1x2_(m,k  ,j,i) - e1cc_k_jm1(i);
+          }
+          if (flx3(m,IDN,k,j,i) >= 0.0) {
+            e1_r2 = e1x2_(m,k-1,j,i) - e1cc_km1_j(i);
+          } else {
+            e1_r2 = e1x2_(m,k  ,j,i) - e1cc_k_j(i);
+          }
+          e1(m,k,j,i) = 0.25*(e1_l3 + e1_r3 + e1_l2 + e1_r2 +
+                  e1x2_(m,k-1,j,i) + e1x2_(m,k,j,i) + e1x3_(m,k,j-1,i) + e1x3_(m,k,j,i));
+
+          // integrate E2 to corner using SG07
+          Real e2_l3, e2_r3, e2_l1, e2_r1;
+          if (flx1(m,IDN,k-1,j,i) >= 0.0) {
+            e2_l3 = e2x3_(m,k,j,i-1) - e2cc_km1(i-1);
+          } else {
+            e2_l3 = e2x3_(m,k,j,i  ) - e2cc_km1(i  );
+          }
+          if (flx1(m,IDN,k,j,i) >= 0.0) {
+            e2_r3 = e2x3_(m,k,j,i-1) - e2cc_k(i-1);
+          } else {
+            e2_r3 = e2x3_(m,k,j,i  ) - e2cc_k(i  );
+          }
+          if (flx3(m,IDN,k,j,i-1) >= 0.0) {
+            e2_l1 = e2x1_(m,k-1,j,i) - e2cc_km1(i-1);
+          } else {
+            e2_l1 = e2x1_(m,k  ,j,i) - e2cc_k(i-1);
+          }
+          if (flx3(m,IDN,k,j,i) >= 0.0) {
+            e2_r1 = e2x1_(m,k-1,j,i) - e2cc_km1(i);
+          } else {
+            e2_r1 = e2x1_(m,k  ,j,i) - e2cc_k(i);
+          }
+          e2(m,k,j,i) = 0.25*(e2_l3 + e2_r3 + e2_l1 + e2_r1 +
+                  e2x3_(m,k,j,i-1) + e2x3_(m,k,j,i) + e2x1_(m,k-1,j,i) + e2x1_(m,k,j,i));
+
+          // integrate E3 to corner using SG07
+          Real e3_l2, e3_r2, e3_l1, e3_r1;
+          if (flx1(m,IDN,k,j-1,i) >= 0.0) {
+            e3_l2 = e3x2_(m,k,j,i-1) - e3cc_jm1(i-1);
+          } else {
+            e3_l2 = e3x2_(m,k,j,i  ) - e3cc_jm1(i  );
+          }
+          if (flx1(m,IDN,k,j,i) >= 0.0) {
+            e3_r2 = e3x2_(m,k,j,i-1) - e3cc_j(i-1);
+          } else {
+            e3_r2 = e3x2_(m,k,j,i  ) - e3cc_j(i  );
+          }
+          if (flx2(m,IDN,k,j,i-1) >= 0.0) {
+            e3_l1 = e3x1_(m,k,j-1,i) - e3cc_jm1(i-1);
+          } else {
+            e3_l1 = e3x1_(m,k,j  ,i) - e3cc_j(i-1);
+          }
+          if (flx2(m,IDN,k,j,i) >= 0.0) {
+            e3_r1 = e3x1_(m,k,j-1,i) - e3cc_jm1(i);
+          } else {
+            e3_r1 = e3x1_(m,k,j  ,i) - e3cc_j(i);
+          }
+          e3(m,k,j,i) = 0.25*(e3_l1 + e3_r1 + e3_l2 + e3_r2 +
+                  e3x2_(m,k,j,i-1) + e3x2_(m,k,j,i) + e3x1_(m,k,j-1,i) + e3x1_(m,k,j,i));
+        });
+      });
+    }
   }
 
-  // Add resistive electric field (if needed)
-  if (presist != nullptr) {
+  // Add resistive electric field (if needed, and unless advanced with operator-split
+  // STS in which case it is computed in STSCornerE)
+  if ((presist != nullptr) && (!use_sts)) {
     if (presist->eta_ohm > 0.0) {
       presist->OhmicEField(b0, efld);
     }
@@ -12,7 +12,10 @@
 #include <iostream>
 
 #include "athena.hpp"
+#include "driver/driver.hpp"
 #include "mesh/mesh.hpp"
+#include "diffusion/viscosity.hpp"
+#include "diffusion/resistivity.hpp"
 #include "mhd.hpp"
 #include "eos/eos.hpp"
 #include "reconstruct/dc.hpp"
@@ -34,9 +37,14 @@ namespace mhd {
 //! \fn void MHD::CalculateFlux
 //! \brief Calculate fluxes of conserved variables, and face-centered area-averaged EMFs
 //! for evolution of magnetic field
-//! Note this function is templated over RS for better performance on GPUs.
-
-template <MHD_RSolver rsolver_method_>
+//! Note this function is templated over the RS and the inline diffusive flux hook for
+//! better performance on GPUs.  With add_diff_ enabled, viscous momentum/energy fluxes
+//! and the Ohmic energy flux are added inside these kernels while the flux at each face
+//! is still resident, instead of separate full passes over the flux arrays per stage
+//! (the standalone kernels in diffusion/ remain for the STS integrator; the resistive
+//! EMF itself enters through the corner-E update, not these fluxes).
+
+template <MHD_RSolver rsolver_method_, bool add_diff_>
 void MHD::CalculateFluxes(Driver *pdriver, int stage) {
   RegionIndcs &indcs_ = pmy_pack->pmesh->mb_indcs;
   int is = indcs_.is, ie = indcs_.ie;
@@ -58,12 +66,25 @@ void MHD::CalculateFluxes(Driver *pdriver, int stage) {
   auto &coord_ = pmy_pack->pcoord->coord_data;
   auto &w0_ = w0;
   auto &b0_ = bcc0;
+  bool multi_d_ = pmy_pack->pmesh->multi_d;
+  bool three_d_ = pmy_pack->pmesh->three_d;
+  // face-centered fields and coefficients for the inline diffusive flux hook
+  auto &bf1_ = b0.x1f;
+  auto &bf2_ = b0.x2f;
+  auto &bf3_ = b0.x3f;
+  const bool visc_ = (pvisc != nullptr);
+  const bool ohmic_ = (presist != nullptr) && (peos->eos_data.is_ideal);
+  Real nu_ = (visc_)? pvisc->nu : 0.0;
+  Real qa_ = (ohmic_)? 0.25*(presist->eta_ohm) : 0.0;
+  // stream this task was launched on (default instance unless task flagged async)
+  DevExeSpace exec = pdriver->ExecSpace();
 
   //--------------------------------------------------------------------------------------
   // i-direction
 
   size_t scr_size = (ScrArray2D<Real>::shmem_size(nvars, ncells1) +
-                     ScrArray2D<Real>::shmem_size(3, ncells1)) * 2;
+                     ScrArray2D<Real>::shmem_size(3, ncells1)) * 2 +
+                     ScrArray1D<Real>::shmem_size(ncells1);
   int scr_level = 0;
   auto &flx1_ = uflx.x1f;
   auto &e31_ = e3x1;
@@ -82,7 +103,7 @@ void MHD::CalculateFluxes(Driver *pdriver, int stage) {
   int il = is, iu = ie+1;
   if (use_fofc) { il = is-1, iu = ie+2; }
 
-  par_for_outer("mhd_flux1",DevExeSpace(), scr_size, scr_level, 0, nmb1, kl, ku, jl, ju,
+  par_for_outer("mhd_flux1",exec, scr_size, scr_level, 0, nmb1, kl, ku, jl, ju,
   KOKKOS_LAMBDA(TeamMember_t member, const int m, const int k, const int j) {
     ScrArray2D<Real> wl(member.team_scratch(scr_level), nvars, ncells1);
     ScrArray2D<Real> wr(member.team_scratch(scr_level), nvars, ncells1);
@@ -96,18 +117,29 @@ void MHD::CalculateFluxes(Driver *pdriver, int stage) {
         DonorCellX1(member, m, k, j, il-1, iu, b0_, bl, br);
         break;
       case ReconstructionMethod::plm:
-        PiecewiseLinearX1(member, m, k, j, il-1, iu, w0_, wl, wr);
+        PiecewiseLinearX1(member, eos_, m, k, j, il-1, iu, w0_, wl, wr);
         PiecewiseLinearX1(member, m, k, j, il-1, iu, b0_, bl, br);
         break;
       case ReconstructionMethod::ppm4:
-      case ReconstructionMethod::ppmx:
-        PiecewiseParabolicX1(member,eos_,extrema,true,  m, k, j, il-1, iu, w0_, wl, wr);
-        PiecewiseParabolicX1(member,eos_,extrema,false, m, k, j, il-1, iu, b0_, bl, br);
+      case ReconstructionMethod::ppmx: {
+        // scratch pencil shared by both calls (barriers inside wrapper protect reuse)
+        ScrArray1D<Real> qs(member.team_scratch(scr_level), ncells1);
+        PiecewiseParabolicX1(member,eos_,extrema,true,  m,k,j, il-1, iu, w0_, qs, wl, wr);
+        PiecewiseParabolicX1(member,eos_,extrema,false, m,k,j, il-1, iu, b0_, qs, bl, br);
         break;
-      case ReconstructionMethod::wenoz:
-        WENOZX1(member, eos_, true,  m, k, j, il-1, iu, w0_, wl, wr);
-        WENOZX1(member, eos_, false, m, k, j, il-1, iu, b0_, bl, br);
+      }
+      case ReconstructionMethod::wenoz: {
+        ScrArray1D<Real> qs(member.team_scratch(scr_level), ncells1);
+        WENOZX1(member, eos_, true,  m, k, j, il-1, iu, w0_, qs, wl, wr);
+        WENOZX1(member, eos_, false, m, k, j, il-1, iu, b0_, qs, bl, br);
+        break;
+      }
+      case ReconstructionMethod::wenoza: {
+        ScrArray1D<Real> qs(member.team_scratch(scr_level), ncells1);
+        WENOZAX1(member, eos_, true,  m, k, j, il-1, iu, w0_, qs, wl, wr);
+        WENOZAX1(member, eos_, false, m, k, j, il-1, iu, b0_, qs, bl, br);
         break;
+      }
       default:
         break;
     }
@@ -157,6 +189,71 @@ void MHD::CalculateFluxes(Driver *pdriver, int stage) {
         });
       }
     }
+
+    // add diffusive fluxes over the same faces covered by the standalone kernels
+    if constexpr (add_diff_) {
+      if ((j >= js) && (j <= je) && (k >= ks) && (k <= ke)) {
+        const Real dx1 = size_.d_view(m).dx1;
+        const Real dx2 = size_.d_view(m).dx2;
+        const Real dx3 = size_.d_view(m).dx3;
+        if (visc_) {
+          par_for_inner(member, is, ie+1, [&](const int i) {
+            // [2(dVx/dx)-(2/3)dVx/dx, dVy/dx, dVz/dx]
+            Real fvx = 4.0*(w0_(m,IVX,k,j,i) - w0_(m,IVX,k,j,i-1))/(3.0*dx1);
+            Real fvy =     (w0_(m,IVY,k,j,i) - w0_(m,IVY,k,j,i-1))/dx1;
+            Real fvz =     (w0_(m,IVZ,k,j,i) - w0_(m,IVZ,k,j,i-1))/dx1;
+            // in 2D/3D add [(-2/3)dVy/dy, dVx/dy, 0]
+            if (multi_d_) {
+              fvx -= ((w0_(m,IVY,k,j+1,i) + w0_(m,IVY,k,j+1,i-1)) -
+                      (w0_(m,IVY,k,j-1,i) + w0_(m,IVY,k,j-1,i-1)))/(6.0*dx2);
+              fvy += ((w0_(m,IVX,k,j+1,i) + w0_(m,IVX,k,j+1,i-1)) -
+                      (w0_(m,IVX,k,j-1,i) + w0_(m,IVX,k,j-1,i-1)))/(4.0*dx2);
+            }
+            // in 3D add [(-2/3)dVz/dz, 0,  dVx/dz]
+            if (three_d_) {
+              fvx -= ((w0_(m,IVZ,k+1,j,i) + w0_(m,IVZ,k+1,j,i-1)) -
+                      (w0_(m,IVZ,k-1,j,i) + w0_(m,IVZ,k-1,j,i-1)))/(6.0*dx3);
+              fvz += ((w0_(m,IVX,k+1,j,i) + w0_(m,IVX,k+1,j,i-1)) -
+                      (w0_(m,IVX,k-1,j,i) + w0_(m,IVX,k-1,j,i-1)))/(4.0*dx3);
+            }
+            Real nud = 0.5*nu_*(w0_(m,IDN,k,j,i) + w0_(m,IDN,k,j,i-1));
+            flx1_(m,IVX,k,j,i) -= nud*fvx;
+            flx1_(m,IVY,k,j,i) -= nud*fvy;
+            flx1_(m,IVZ,k,j,i) -= nud*fvz;
+            if (eos_.is_ideal) {
+              flx1_(m,IEN,k,j,i) -=
+                  0.5*nud*((w0_(m,IVX,k,j,i-1) + w0_(m,IVX,k,j,i))*fvx +
+                           (w0_(m,IVY,k,j,i-1) + w0_(m,IVY,k,j,i))*fvy +
+                           (w0_(m,IVZ,k,j,i-1) + w0_(m,IVZ,k,j,i))*fvz);
+            }
+          });
+        }
+        if (ohmic_) {
+          par_for_inner(member, is, ie+1, [&](const int i) {
+            Real j2k   = -(bf3_(m,k  ,j,i) - bf3_(m,k  ,j,i-1))/dx1;
+            Real j2kp1 = -(bf3_(m,k+1,j,i) - bf3_(m,k+1,j,i-1))/dx1;
+
+            Real j3j   = (bf2_(m,k,j  ,i) - bf2_(m,k,j  ,i-1))/dx1;
+            Real j3jp1 = (bf2_(m,k,j+1,i) - bf2_(m,k,j+1,i-1))/dx1;
+
+            if (multi_d_) {
+              j3j   -= (bf1_(m,k,j  ,i) - bf1_(m,k,j-1,i))/dx2;
+              j3jp1 -= (bf1_(m,k,j+1,i) - bf1_(m,k,j  ,i))/dx2;
+            }
+            if (three_d_) {
+              j2k   += (bf1_(m,k  ,j,i) - bf1_(m,k-1,j,i))/dx3;
+              j2kp1 += (bf1_(m,k+1,j,i) - bf1_(m,k  ,j,i))/dx3;
+            }
+
+            // flx1 = (E X B)_{1} =  ((\eta J) X B)_{1} = \eta (J2*B3 - J3*B2)
+            flx1_(m,IEN,k,j,i) += qa_*(j2k  *(bf3_(m,k  ,j  ,i) + bf3_(m,k  ,j  ,i-1)) +
+                                       j2kp1*(bf3_(m,k+1,j  ,i) + bf3_(m,k+1,j  ,i-1)) -
+                                       j3j  *(bf2_(m,k  ,j  ,i) + bf2_(m,k  ,j  ,i-1)) -
+                                       j3jp1*(bf2_(m,k  ,j+1,i) + bf2_(m,k  ,j+1,i-1)));
+          });
+        }
+      }
+    }
   });
 
   //--------------------------------------------------------------------------------------
@@ -179,7 +276,7 @@ void MHD::CalculateFluxes(Driver *pdriver, int stage) {
     jl = js-1, ju = je+1;
     if (use_fofc) { jl = js-2, ju = je+2; }
 
-    par_for_outer("mhd_flux2",DevExeSpace(),scr_size,scr_level,0,nmb1, kl, ku,
+    par_for_outer("mhd_flux2",exec,scr_size,scr_level,0,nmb1, kl, ku,
     KOKKOS_LAMBDA(TeamMember_t member, const int m, const int k) {
       ScrArray2D<Real> scr1(member.team_scratch(scr_level), nvars, ncells1);
       ScrArray2D<Real> scr2(member.team_scratch(scr_level), nvars, ncells1);
@@ -210,7 +307,7 @@ void MHD::CalculateFluxes(Driver *pdriver, int stage) {
             DonorCellX2(member, m, k, j, is-1, ie+1, b0_, bl_jp1, br);
             break;
           case ReconstructionMethod::plm:
-            PiecewiseLinearX2(member, m, k, j, is-1, ie+1, w0_, wl_jp1, wr);
+            PiecewiseLinearX2(member, eos_, m, k, j, is-1, ie+1, w0_, wl_jp1, wr);
             PiecewiseLinearX2(member, m, k, j, is-1, ie+1, b0_, bl_jp1, br);
             break;
           case ReconstructionMethod::ppm4:
@@ -222,6 +319,10 @@ void MHD::CalculateFluxes(Driver *pdriver, int stage) {
             WENOZX2(member, eos_, true,  m, k, j, is-1, ie+1, w0_, wl_jp1, wr);
             WENOZX2(member, eos_, false, m, k, j, is-1, ie+1, b0_, bl_jp1, br);
             break;
+          case ReconstructionMethod::wenoza:
+            WENOZAX2(member, eos_, true,  m, k, j, is-1, ie+1, w0_, wl_jp1, wr);
+            WENOZAX2(member, eos_, false, m, k, j, is-1, ie+1, b0_, bl_jp1, br);
+            break;
           default:
             break;
         }
@@ -280,6 +381,67 @@ void MHD::CalculateFluxes(Driver *pdriver, int stage) {
             });
           }
         }
+
+        // add diffusive fluxes over the same faces covered by the standalone kernels
+        if constexpr (add_diff_) {
+          if ((j >= js) && (j <= je+1) && (k >= ks) && (k <= ke)) {
+            const Real dx1 = size_.d_view(m).dx1;
+            const Real dx2 = size_.d_view(m).dx2;
+            const Real dx3 = size_.d_view(m).dx3;
+            if (visc_) {
+              par_for_inner(member, is, ie, [&](const int i) {
+                // [(dVx/dy+dVy/dx), 2(dVy/dy)-(2/3)(dVx/dx+dVy/dy), dVz/dy]
+                Real fvx = (w0_(m,IVX,k,j,i  ) - w0_(m,IVX,k,j-1,i  ))/dx2 +
+                          ((w0_(m,IVY,k,j,i+1) + w0_(m,IVY,k,j-1,i+1)) -
+                           (w0_(m,IVY,k,j,i-1) + w0_(m,IVY,k,j-1,i-1)))/(4.0*dx1);
+                Real fvy = (w0_(m,IVY,k,j,i) - w0_(m,IVY,k,j-1,i))*4.0/(3.0*dx2) -
+                          ((w0_(m,IVX,k,j,i+1) + w0_(m,IVX,k,j-1,i+1)) -
+                           (w0_(m,IVX,k,j,i-1) + w0_(m,IVX,k,j-1,i-1)))/(6.0*dx1);
+                Real fvz = (w0_(m,IVZ,k,j,i  ) - w0_(m,IVZ,k,j-1,i  ))/dx2;
+                // in 3D add [0, (-2/3)dVz/dz, dVy/dz]
+                if (three_d_) {
+                  fvy -= ((w0_(m,IVZ,k+1,j,i) + w0_(m,IVZ,k+1,j-1,i)) -
+                          (w0_(m,IVZ,k-1,j,i) + w0_(m,IVZ,k-1,j-1,i)))/(6.0*dx3);
+                  fvz += ((w0_(m,IVY,k+1,j,i) + w0_(m,IVY,k+1,j-1,i)) -
+                          (w0_(m,IVY,k-1,j,i) + w0_(m,IVY,k-1,j-1,i)))/(4.0*dx3);
+                }
+                Real nud = 0.5*nu_*(w0_(m,IDN,k,j,i) + w0_(m,IDN,k,j-1,i));
+                flx2_(m,IVX,k,j,i) -= nud*fvx;
+                flx2_(m,IVY,k,j,i) -= nud*fvy;
+                flx2_(m,IVZ,k,j,i) -= nud*fvz;
+                if (eos_.is_ideal) {
+                  flx2_(m,IEN,k,j,i) -=
+                      0.5*nud*((w0_(m,IVX,k,j-1,i) + w0_(m,IVX,k,j,i))*fvx +
+                               (w0_(m,IVY,k,j-1,i) + w0_(m,IVY,k,j,i))*fvy +
+                               (w0_(m,IVZ,k,j-1,i) + w0_(m,IVZ,k,j,i))*fvz);
+                }
+              });
+            }
+            if (ohmic_) {
+              par_for_inner(member, is, ie, [&](const int i) {
+                Real j1k   = (bf3_(m,k  ,j,i) - bf3_(m,k  ,j-1,i))/dx2;
+                Real j1kp1 = (bf3_(m,k+1,j,i) - bf3_(m,k+1,j-1,i))/dx2;
+
+                Real j3i   = (bf2_(m,k,j,i  ) - bf2_(m,k,j  ,i-1))/dx1
+                           - (bf1_(m,k,j,i  ) - bf1_(m,k,j-1,i  ))/dx2;
+                Real j3ip1 = (bf2_(m,k,j,i+1) - bf2_(m,k,j  ,i  ))/dx1
+                           - (bf1_(m,k,j,i+1) - bf1_(m,k,j-1,i+1))/dx2;
+
+                if (three_d_) {
+                  j1k   -= (bf2_(m,k  ,j,i) - bf2_(m,k-1,j,i))/dx3;
+                  j1kp1 -= (bf2_(m,k+1,j,i) - bf2_(m,k  ,j,i))/dx3;
+                }
+
+                // E2 = \eta (J X B)_{2} = \eta (J3*B1 - J1*B3)
+                flx2_(m,IEN,k,j,i) +=
+                    qa_*(j3i  *(bf1_(m,k  ,j,i  ) + bf1_(m,k  ,j-1,i  )) +
+                         j3ip1*(bf1_(m,k  ,j,i+1) + bf1_(m,k  ,j-1,i+1)) -
+                         j1k  *(bf3_(m,k  ,j,i  ) + bf3_(m,k  ,j-1,i  )) -
+                         j1kp1*(bf3_(m,k+1,j,i  ) + bf3_(m,k+1,j-1,i  )));
+              });
+            }
+          }
+        }
       } // end of loop over j
     });
   }
@@ -289,7 +451,7 @@ void MHD::CalculateFluxes(Driver *pdriver, int stage) {
 
   if (pmy_pack->pmesh->three_d) {
     scr_size = (ScrArray2D<Real>::shmem_size(nvars, ncells1) +
-                ScrArray2D<Real>::shmem_size(3, ncells1)) * 3;
+                ScrArray2D<Real>::shmem_size(3, ncells1)) * (2*flux_tile_x3 + 1);
     auto &flx3_ = uflx.x3f;
     auto &bz_ = b0.x3f;
     auto &e23_ = e2x3;
@@ -299,28 +461,40 @@ void MHD::CalculateFluxes(Driver *pdriver, int stage) {
     kl = ks-1, ku = ke+1;
     if (use_fofc) { kl = ks-2, ku = ke+2; }
 
-    par_for_outer("mhd_flux3",DevExeSpace(), scr_size, scr_level, 0, nmb1, js-1, je+1,
-    KOKKOS_LAMBDA(TeamMember_t member, const int m, const int j) {
-      ScrArray2D<Real> scr1(member.team_scratch(scr_level), nvars, ncells1);
-      ScrArray2D<Real> scr2(member.team_scratch(scr_level), nvars, ncells1);
+    // each team advances a tile of (up to) flux_tile_x3 adjacent pencils through k
+    // together so that stencil planes are read contiguously (see athena.hpp)
+    int jtll = js-1, jtuu = je+1;
+    int njtile = (jtuu - jtll + flux_tile_x3)/flux_tile_x3;
+
+    par_for_outer("mhd_flux3",exec, scr_size, scr_level, 0, nmb1, 0, njtile-1,
+    KOKKOS_LAMBDA(TeamMember_t member, const int m, const int jt) {
+      const int jtl = jtll + jt*flux_tile_x3;
+      const int jtu = (jtl + flux_tile_x3 - 1 < jtuu)? (jtl + flux_tile_x3 - 1) : jtuu;
+      ScrArray2D<Real> scr1[flux_tile_x3], scr2[flux_tile_x3];
+      ScrArray2D<Real> scr4[flux_tile_x3], scr5[flux_tile_x3];
+      for (int jj=0; jj<=(jtu-jtl); ++jj) {
+        scr1[jj] = ScrArray2D<Real>(member.team_scratch(scr_level), nvars, ncells1);
+        scr2[jj] = ScrArray2D<Real>(member.team_scratch(scr_level), nvars, ncells1);
+        scr4[jj] = ScrArray2D<Real>(member.team_scratch(scr_level), 3, ncells1);
+        scr5[jj] = ScrArray2D<Real>(member.team_scratch(scr_level), 3, ncells1);
+      }
       ScrArray2D<Real> scr3(member.team_scratch(scr_level), nvars, ncells1);
-      ScrArray2D<Real> scr4(member.team_scratch(scr_level), 3, ncells1);
-      ScrArray2D<Real> scr5(member.team_scratch(scr_level), 3, ncells1);
       ScrArray2D<Real> scr6(member.team_scratch(scr_level), 3, ncells1);
 
       for (int k=kl; k<=ku; ++k) {
+      for (int j=jtl; j<=jtu; ++j) {
         // Permute scratch arrays.
-        auto wl     = scr1;
-        auto wl_kp1 = scr2;
+        auto wl     = scr1[j-jtl];
+        auto wl_kp1 = scr2[j-jtl];
         auto wr     = scr3;
-        auto bl     = scr4;
-        auto bl_kp1 = scr5;
+        auto bl     = scr4[j-jtl];
+        auto bl_kp1 = scr5[j-jtl];
         auto br     = scr6;
         if ((k%2) == 0) {
-          wl     = scr2;
-          wl_kp1 = scr1;
-          bl     = scr5;
-          bl_kp1 = scr4;
+          wl     = scr2[j-jtl];
+          wl_kp1 = scr1[j-jtl];
+          bl     = scr5[j-jtl];
+          bl_kp1 = scr4[j-jtl];
         }
 
         // Reconstruct qR[k] and qL[k+1], for both W and Bcc
@@ -330,7 +504,7 @@ void MHD::CalculateFluxes(Driver *pdriver, int stage) {
             DonorCellX3(member, m, k, j, is-1, ie+1, b0_, bl_kp1, br);
             break;
           case ReconstructionMethod::plm:
-            PiecewiseLinearX3(member, m, k, j, is-1, ie+1, w0_, wl_kp1, wr);
+            PiecewiseLinearX3(member, eos_, m, k, j, is-1, ie+1, w0_, wl_kp1, wr);
             PiecewiseLinearX3(member, m, k, j, is-1, ie+1, b0_, bl_kp1, br);
             break;
           case ReconstructionMethod::ppm4:
@@ -342,6 +516,10 @@ void MHD::CalculateFluxes(Driver *pdriver, int stage) {
             WENOZX3(member, eos_, true,  m, k, j, is-1, ie+1, w0_, wl_kp1, wr);
             WENOZX3(member, eos_, false, m, k, j, is-1, ie+1, b0_, bl_kp1, br);
             break;
+          case ReconstructionMethod::wenoza:
+            WENOZAX3(member, eos_, true,  m, k, j, is-1, ie+1, w0_, wl_kp1, wr);
+            WENOZAX3(member, eos_, false, m, k, j, is-1, ie+1, b0_, bl_kp1, br);
+            break;
           default:
             break;
         }
@@ -400,6 +578,62 @@ void MHD::CalculateFluxes(Driver *pdriver, int stage) {
             });
           }
         }
+
+        // add diffusive fluxes over the same faces covered by the standalone kernels
+        if constexpr (add_diff_) {
+          if ((k >= ks) && (k <= ke+1) && (j >= js) && (j <= je)) {
+            const Real dx1 = size_.d_view(m).dx1;
+            const Real dx2 = size_.d_view(m).dx2;
+            const Real dx3 = size_.d_view(m).dx3;
+            if (visc_) {
+              par_for_inner(member, is, ie, [&](const int i) {
+                // [(dVx/dz+dVz/dx),(dVy/dz+dVz/dy),2(dVz/dz)-(2/3)(dVx/dx+dVy/dy+dVz/dz)]
+                Real fvx = (w0_(m,IVX,k,j,i  ) - w0_(m,IVX,k-1,j,i  ))/dx3 +
+                          ((w0_(m,IVZ,k,j,i+1) + w0_(m,IVZ,k-1,j,i+1)) -
+                           (w0_(m,IVZ,k,j,i-1) + w0_(m,IVZ,k-1,j,i-1)))/(4.0*dx1);
+                Real fvy = (w0_(m,IVY,k,j,i  ) - w0_(m,IVY,k-1,j,i  ))/dx3 +
+                          ((w0_(m,IVZ,k,j+1,i) + w0_(m,IVZ,k-1,j+1,i)) -
+                           (w0_(m,IVZ,k,j-1,i) + w0_(m,IVZ,k-1,j-1,i)))/(4.0*dx2);
+                Real fvz = (w0_(m,IVZ,k,j,i) - w0_(m,IVZ,k-1,j,i))*4.0/(3.0*dx3) -
+                          ((w0_(m,IVX,k,j,i+1) + w0_(m,IVX,k-1,j,i+1)) -
+                           (w0_(m,IVX,k,j,i-1) + w0_(m,IVX,k-1,j,i-1)))/(6.0*dx1) -
+                          ((w0_(m,IVY,k,j+1,i) + w0_(m,IVY,k-1,j+1,i)) -
+                           (w0_(m,IVY,k,j-1,i) + w0_(m,IVY,k-1,j-1,i)))/(6.0*dx2);
+                Real nud = 0.5*nu_*(w0_(m,IDN,k,j,i) + w0_(m,IDN,k-1,j,i));
+                flx3_(m,IVX,k,j,i) -= nud*fvx;
+                flx3_(m,IVY,k,j,i) -= nud*fvy;
+                flx3_(m,IVZ,k,j,i) -= nud*fvz;
+                if (eos_.is_ideal) {
+                  flx3_(m,IEN,k,j,i) -=
+                      0.5*nud*((w0_(m,IVX,k-1,j,i) + w0_(m,IVX,k,j,i))*fvx +
+                               (w0_(m,IVY,k-1,j,i) + w0_(m,IVY,k,j,i))*fvy +
+                               (w0_(m,IVZ,k-1,j,i) + w0_(m,IVZ,k,j,i))*fvz);
+                }
+              });
+            }
+            if (ohmic_) {
+              par_for_inner(member, is, ie, [&](const int i) {
+                Real j1j   = (bf3_(m,k,j  ,i) - bf3_(m,k  ,j-1,i))/dx2
+                           - (bf2_(m,k,j  ,i) - bf2_(m,k-1,j  ,i))/dx3;
+                Real j1jp1 = (bf3_(m,k,j+1,i) - bf3_(m,k  ,j  ,i))/dx2
+                           - (bf2_(m,k,j+1,i) - bf2_(m,k-1,j+1,i))/dx3;
+
+                Real j2i   = -(bf3_(m,k,j,i  ) - bf3_(m,k  ,j,i-1))/dx1
+                            + (bf1_(m,k,j,i  ) - bf1_(m,k-1,j,i  ))/dx3;
+                Real j2ip1 = -(bf3_(m,k,j,i+1) - bf3_(m,k  ,j,i  ))/dx1
+                            + (bf1_(m,k,j,i+1) - bf1_(m,k-1,j,i+1))/dx3;
+
+                // E2 = \eta (J X B)_{2} = \eta (J1*B2 - J2*B1)
+                flx3_(m,IEN,k,j,i) +=
+                    qa_*(j1j  *(bf2_(m,k,j  ,i  ) + bf2_(m,k-1,j  ,i  )) +
+                         j1jp1*(bf2_(m,k,j+1,i  ) + bf2_(m,k-1,j+1,i  )) -
+                         j2i  *(bf1_(m,k,j  ,i  ) + bf1_(m,k-1,j  ,i  )) -
+                         j2ip1*(bf1_(m,k,j  ,i+1) + bf1_(m,k-1,j  ,i+1)));
+              });
+            }
+          }
+        }
+      } // end loop over j tile
       } // end loop over k
     });
   }
@@ -407,7 +641,26 @@ void MHD::CalculateFluxes(Driver *pdriver, int stage) {
   return;
 }
 
-// function definitions for each template parameter
+//----------------------------------------------------------------------------------------
+//! \fn void MHD::CalculateFluxes
+//! \brief Dispatch function templated over the RS only.  Enables the inline diffusive
+//! flux hook when viscosity and/or Ohmic heating are active and not advanced with the
+//! operator-split STS integrator (which applies the standalone kernels in diffusion/).
+
+template <MHD_RSolver rsolver_method_>
+void MHD::CalculateFluxes(Driver *pdriver, int stage) {
+  bool add_diff = (pvisc != nullptr) ||
+                  ((presist != nullptr) && (peos->eos_data.is_ideal));
+  if (add_diff && (!use_sts)) {
+    CalculateFluxes<rsolver_method_, true>(pdriver, stage);
+  } else {
+    CalculateFluxes<rsolver_method_, false>(pdriver, stage);
+  }
+  return;
+}
+
+// function definitions for each template parameter.  Each dispatch function implicitly
+// instantiates the specialized kernels for both hook settings.
 template void MHD::CalculateFluxes<MHD_RSolver::advect>(Driver *pdriver, int stage);
 template void MHD::CalculateFluxes<MHD_RSolver::llf>(Driver *pdriver, int stage);
 template void MHD::CalculateFluxes<MHD_RSolver::hlle>(Driver *pdriver, int stage);
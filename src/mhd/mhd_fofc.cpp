@@ -120,6 +120,8 @@ void MHD::FOFC(Driver *pdriver, int stage) {
   auto fofc_ = fofc;
   auto &use_excise_ = pmy_pack->pcoord->coord_data.bh_excise;
   auto &excision_flux_ = pmy_pack->pcoord->excision_flux;
+  auto &mb_excised_ = pmy_pack->pcoord->mb_excised;
+  auto &mb_all_excised_ = pmy_pack->pcoord->mb_all_excised;
   auto &w0_ = w0;
   auto &b0_ = b0;
 
@@ -128,22 +130,70 @@ void MHD::FOFC(Driver *pdriver, int stage) {
   if (multi_d) { jl = js-1, ju = je+1; }
   if (three_d) { kl = ks-1, ku = ke+1; }
 
-  // Replace fluxes with first-order LLF fluxes at i,j,k faces for any cell where FOFC
-  // and/or excision is used (if GR+excising)
-  par_for("FOFC-flx", DevExeSpace(), 0, nmb-1, kl, ku, jl, ju, il, iu,
+  // Pack-level early-out: in smooth flows no cell is ever flagged, so a cheap scan of
+  // the packed flag words (64 cells per word) avoids building the list at all.  Not
+  // applicable when excision can flag cells independently of the FOFC bits.
+  if (use_fofc && !(is_gr && use_excise_)) {
+    if (!fofc.AnySet()) { return; }
+  }
+
+  // Build compacted list of cells where FOFC and/or excision is used (if GR+excising),
+  // so that the flux-replacement kernels below only do work proportional to the number
+  // of flagged cells (usually a small fraction of the grid)
+  int ncells1 = nx1 + 2*(indcs.ng);
+  int ncells2 = (nx2 > 1)? (nx2 + 2*(indcs.ng)) : 1;
+  int ncells3 = (nx3 > 1)? (nx3 + 2*(indcs.ng)) : 1;
+  auto &flist_ = fofc_list;
+  auto &nflist_ = nfofc;
+  Kokkos::deep_copy(nflist_, 0);
+  par_for("FOFC-list", DevExeSpace(), 0, nmb-1, kl, ku, jl, ju, il, iu,
   KOKKOS_LAMBDA(const int m, const int k, const int j, const int i) {
     // Check for FOFC flag
     bool fofc_flag = false;
-    if (use_fofc_) { fofc_flag = fofc_(m,k,j,i); }
+    if (use_fofc_) { fofc_flag = fofc_.Test(m,k,j,i); }
 
     // Check for GR + excision
     bool fofc_excision = false;
     if (is_gr) {
-      if (use_excise_) { fofc_excision = excision_flux_(m,k,j,i); }
+      if (use_excise_ && mb_excised_(m)) {
+        fofc_excision = mb_all_excised_(m) || excision_flux_(m,k,j,i);
+      }
     }
 
-    // Apply FOFC
     if (fofc_flag || fofc_excision) {
+      int indx = Kokkos::atomic_fetch_add(&nflist_(0), 1);
+      flist_(indx) = i + ncells1*(j + ncells2*(k + ncells3*m));
+    }
+  });
+
+  // copy number of flagged cells to host; if no cells flagged there is no work to do
+  HostArray1D<int> nflist_h("nfofc_h", 1);
+  Kokkos::deep_copy(nflist_h, nflist_);
+  int nflagged = nflist_h(0);
+  if (nflagged == 0) { return; }
+
+  // Replace fluxes with first-order LLF fluxes at i,j,k faces of all flagged cells.
+  // Flagged cells are processed in batches, one batch per team with one cell per vector
+  // lane, and each direction in its own inner loop so every lane executes the same
+  // straight-line single-state solver body.  On CPU backends the TeamVectorRange inner
+  // loops emit simd loops the compiler can auto-vectorize across interfaces; on GPU the
+  // mapping to threads is unchanged.
+  const int fofc_batch = 32;
+  const int nbatch = (nflagged + fofc_batch - 1)/fofc_batch;
+  par_for_outer("FOFC-flx", DevExeSpace(), 0, 0, 0, nbatch-1,
+  KOKKOS_LAMBDA(TeamMember_t tmember, const int b) {
+    const int nlane = (fofc_batch < (nflagged - b*fofc_batch))?
+                       fofc_batch : (nflagged - b*fofc_batch);
+
+    // replace x1-flux at i-face
+    par_for_inner(tmember, 0, nlane-1, [&](const int l) {
+      // decode (m,k,j,i) indices of flagged cell
+      int cell = flist_(b*fofc_batch + l);
+      const int i = cell%ncells1;
+      const int j = (cell/ncells1)%ncells2;
+      const int k = (cell/(ncells1*ncells2))%ncells3;
+      const int m = cell/(ncells1*ncells2*ncells3);
+
       // load W_{i-1} state
       MHDPrim1D wim1;
       wim1.d  = w0_(m,IDN,k,j,i-1);
@@ -196,8 +246,17 @@ void MHD::FOFC(Driver *pdriver, int stage) {
         e3x1_(m,k,j,i) = flux.by;
         e2x1_(m,k,j,i) = flux.bz;
       }
+    });
+
+    // replace x2-flux at j-face
+    if (multi_d) {
+      par_for_inner(tmember, 0, nlane-1, [&](const int l) {
+        int cell = flist_(b*fofc_batch + l);
+        const int i = cell%ncells1;
+        const int j = (cell/ncells1)%ncells2;
+        const int k = (cell/(ncells1*ncells2))%ncells3;
+        const int m = cell/(ncells1*ncells2*ncells3);
 
-      if (multi_d) {
         // load W_{j-1} state, permutting components of vectors
         MHDPrim1D wjm1;
         wjm1.d  = w0_(m,IDN,k,j-1,i);
@@ -248,9 +307,18 @@ void MHD::FOFC(Driver *pdriver, int stage) {
         if (eos.is_ideal) {flx2(m,IEN,k,j,i) = flux.e;}
         e1x2_(m,k,j,i) = flux.by;
         e3x2_(m,k,j,i) = flux.bz;
-      }
+      });
+    }
+
+    // replace x3-flux at k-face
+    if (three_d) {
+      par_for_inner(tmember, 0, nlane-1, [&](const int l) {
+        int cell = flist_(b*fofc_batch + l);
+        const int i = cell%ncells1;
+        const int j = (cell/ncells1)%ncells2;
+        const int k = (cell/(ncells1*ncells2))%ncells3;
+        const int m = cell/(ncells1*ncells2*ncells3);
 
-      if (three_d) {
         // load W_{k-1} state, permutting components of vectors
         MHDPrim1D wkm1;
         wkm1.d  = w0_(m,IDN,k-1,j,i);
@@ -301,26 +369,26 @@ void MHD::FOFC(Driver *pdriver, int stage) {
         if (eos.is_ideal) {flx3(m,IEN,k,j,i) = flux.e;}
         e2x3_(m,k,j,i) = flux.by;
         e1x3_(m,k,j,i) = flux.bz;
-      }
+      });
     }
   });
 
-  // Replace fluxes with first-order LLF fluxes at i+1,j+1,k+1 faces for any cell where
-  // FOFC and/or excision is used (if GR+excising)
-  par_for("FOFC-flx", DevExeSpace(), 0, nmb-1, kl, ku, jl, ju, il, iu,
-  KOKKOS_LAMBDA(const int m, const int k, const int j, const int i) {
-    // Check for FOFC flag
-    bool fofc_flag = false;
-    if (use_fofc_) { fofc_flag = fofc_(m,k,j,i); }
+  // Replace fluxes with first-order LLF fluxes at i+1,j+1,k+1 faces of all flagged
+  // cells
+  par_for_outer("FOFC-flx", DevExeSpace(), 0, 0, 0, nbatch-1,
+  KOKKOS_LAMBDA(TeamMember_t tmember, const int b) {
+    const int nlane = (fofc_batch < (nflagged - b*fofc_batch))?
+                       fofc_batch : (nflagged - b*fofc_batch);
+
+    // replace x1-flux at (i+1)-face
+    par_for_inner(tmember, 0, nlane-1, [&](const int l) {
+      // decode (m,k,j,i) indices of flagged cell
+      int cell = flist_(b*fofc_batch + l);
+      const int i = cell%ncells1;
+      const int j = (cell/ncells1)%ncells2;
+      const int k = (cell/(ncells1*ncells2))%ncells3;
+      const int m = cell/(ncells1*ncells2*ncells3);
 
-    // Check for GR + excision
-    bool fofc_excision = false;
-    if (is_gr) {
-      if (use_excise_) { fofc_excision = excision_flux_(m,k,j,i); }
-    }
-
-    // Apply FOFC
-    if (fofc_flag || fofc_excision) {
       // load W_{i} state
       MHDPrim1D wi;
       wi.d  = w0_(m,IDN,k,j,i);
@@ -374,7 +442,19 @@ void MHD::FOFC(Driver *pdriver, int stage) {
         e2x1_(m,k,j,i+1) = flux.bz;
       }
 
-      if (multi_d) {
+      // reset FOFC flag (do not reset excision flag)
+      if (use_fofc_) { fofc_.Clear(m,k,j,i); }
+    });
+
+    // replace x2-flux at (j+1)-face
+    if (multi_d) {
+      par_for_inner(tmember, 0, nlane-1, [&](const int l) {
+        int cell = flist_(b*fofc_batch + l);
+        const int i = cell%ncells1;
+        const int j = (cell/ncells1)%ncells2;
+        const int k = (cell/(ncells1*ncells2))%ncells3;
+        const int m = cell/(ncells1*ncells2*ncells3);
+
         // load W_{j} state, permutting components of vectors
         MHDPrim1D wj;
         wj.d  = w0_(m,IDN,k,j,i);
@@ -425,9 +505,18 @@ void MHD::FOFC(Driver *pdriver, int stage) {
         if (eos.is_ideal) {flx2(m,IEN,k,j+1,i) = flux.e;}
         e1x2_(m,k,j+1,i) = flux.by;
         e3x2_(m,k,j+1,i) = flux.bz;
-      }
+      });
+    }
+
+    // replace x3-flux at (k+1)-face
+    if (three_d) {
+      par_for_inner(tmember, 0, nlane-1, [&](const int l) {
+        int cell = flist_(b*fofc_batch + l);
+        const int i = cell%ncells1;
+        const int j = (cell/ncells1)%ncells2;
+        const int k = (cell/(ncells1*ncells2))%ncells3;
+        const int m = cell/(ncells1*ncells2*ncells3);
 
-      if (three_d) {
         // load W_{k} state, permutting components of vectors
         MHDPrim1D wk;
         wk.d  = w0_(m,IDN,k,j,i);
@@ -478,15 +567,10 @@ void MHD::FOFC(Driver *pdriver, int stage) {
         if (eos.is_ideal) {flx3(m,IEN,k+1,j,i) = flux.e;}
         e2x3_(m,k+1,j,i) = flux.by;
         e1x3_(m,k+1,j,i) = flux.bz;
-      }
+      });
     }
   });
 
-  // reset FOFC flag (do not reset excision flag)
-  if (use_fofc_) {
-    Kokkos::deep_copy(fofc, false);
-  }
-
   return;
 }
 
@@ -31,6 +31,17 @@ TaskStatus MHD::NewTimeStep(Driver *pdriver, int stage) {
     return TaskStatus::complete; // only execute last stage
   }
 
+  // adaptive dt-evaluation cadence: when the Mesh reports dt is quasi-steady, skip the
+  // per-cell reductions this cycle and keep dtnew from the last full evaluation.  The
+  // wavespeed monitor fused into ConsToPrim (when active) has already refreshed dt1/2/3
+  // at no cost, so fall through and consume it; it guards against signal-speed jumps
+  const bool full_eval = pmy_pack->pmesh->dt_full_eval;
+  const bool fused = (peos->fused_newdt) &&
+                     (pdriver->time_evolution != TimeEvolution::kinematic);
+  if (!full_eval && !fused) {
+    return TaskStatus::complete;
+  }
+
   auto &indcs = pmy_pack->pmesh->mb_indcs;
   int is = indcs.is, nx1 = indcs.nx1;
   int js = indcs.js, nx2 = indcs.nx2;
@@ -67,6 +78,22 @@ TaskStatus MHD::NewTimeStep(Driver *pdriver, int stage) {
       min_dt2 = fmin((mbsize.d_view(m).dx2/fabs(w0_(m,IVY,k,j,i))), min_dt2);
       min_dt3 = fmin((mbsize.d_view(m).dx3/fabs(w0_(m,IVZ,k,j,i))), min_dt3);
     }, Kokkos::Min<Real>(dt1), Kokkos::Min<Real>(dt2),Kokkos::Min<Real>(dt3));
+  } else if (peos->fused_newdt) {
+    // min(dx/(v + Cf)) was already accumulated inside the ConsToPrim kernel for
+    // nonrelativistic EOS classes; consume it instead of re-reading the primitives
+    dt1 = peos->dt1_fused;
+    dt2 = peos->dt2_fused;
+    dt3 = peos->dt3_fused;
+  } else if (is_general_relativistic_ || is_dynamical_relativistic_) {
+    // in GR the signal speed is bounded by the speed of light everywhere, so the
+    // timestep depends only on the MeshBlock sizes; reduce over blocks, not cells
+    const int nmb = pmy_pack->nmb_thispack;
+    Kokkos::parallel_reduce("MHDNudtGR",Kokkos::RangePolicy<>(DevExeSpace(), 0, nmb),
+    KOKKOS_LAMBDA(const int &m, Real &min_dt1, Real &min_dt2, Real &min_dt3) {
+      min_dt1 = fmin((mbsize.d_view(m).dx1), min_dt1);
+      min_dt2 = fmin((mbsize.d_view(m).dx2), min_dt2);
+      min_dt3 = fmin((mbsize.d_view(m).dx3), min_dt3);
+    }, Kokkos::Min<Real>(dt1), Kokkos::Min<Real>(dt2),Kokkos::Min<Real>(dt3));
   } else {
     // find smallest dx/(v +/- Cf) in each direction for mhd problems
     auto &bcc0_ = bcc0;
@@ -82,13 +109,8 @@ TaskStatus MHD::NewTimeStep(Driver *pdriver, int stage) {
       j += js;
       Real max_dv1 = 0.0, max_dv2 = 0.0, max_dv3 = 0.0;
 
-      // timestep in GR MHD
-      if (is_general_relativistic_ || is_dynamical_relativistic_) {
-        max_dv1 = 1.0;
-        max_dv2 = 1.0;
-        max_dv3 = 1.0;
       // timestep in SR MHD
-      } else if (is_special_relativistic_) {
+      if (is_special_relativistic_) {
         Real &wd = w0_(m,IDN,k,j,i);
         Real &ux = w0_(m,IVX,k,j,i);
         Real &uy = w0_(m,IVY,k,j,i);
@@ -159,11 +181,13 @@ TaskStatus MHD::NewTimeStep(Driver *pdriver, int stage) {
   if (pmy_pack->pmesh->three_d) { dtnew = std::min(dtnew, dt3); }
 
   // compute timestep for diffusion
-  if (pcond != nullptr) {
+  if ((pcond != nullptr) && full_eval) {
     pcond->NewTimeStep(w0, peos->eos_data);
   }
   // compute source terms timestep
-  psrc->NewTimeStep(w0, peos->eos_data);
+  if (full_eval) {
+    psrc->NewTimeStep(w0, peos->eos_data);
+  }
 
   return TaskStatus::complete;
 }
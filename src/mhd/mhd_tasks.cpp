@@ -38,47 +38,175 @@ void MHD::AssembleMHDTasks(std::map<std::string, std::shared_ptr<TaskList>> tl)
   TaskID none(0);
 
   // assemble "before_timeintegrator" task list
-  id.savest = tl["before_timeintegrator"]->AddTask(&MHD::SaveMHDState, this, none);
+  id.savest = tl["before_timeintegrator"]->AddTask(&MHD::SaveMHDState, this, none,
+                                                   "MHD::SaveMHDState");
+
+  // assemble "after_timeintegrator" task list
+  // subcycled cooling is operator-split from the integrator, applied once per cycle
+  if (psrc->ism_cooling && psrc->ism_cool_subcycle) {
+    id.coolsub = tl["after_timeintegrator"]->AddTask(&MHD::CoolingSubcycle, this, none,
+                                                     "MHD::CoolingSubcycle");
+  }
 
   // assemble "before_stagen" task list
-  id.irecv = tl["before_stagen"]->AddTask(&MHD::InitRecv, this, none);
+  id.irecv = tl["before_stagen"]->AddTask(&MHD::InitRecv, this, none, "MHD::InitRecv");
 
   // assemble "stagen" task list
-  id.copyu     = tl["stagen"]->AddTask(&MHD::CopyCons, this, none);
-  id.flux      = tl["stagen"]->AddTask(&MHD::Fluxes, this, id.copyu);
-  id.sendf     = tl["stagen"]->AddTask(&MHD::SendFlux, this, id.flux);
-  id.recvf     = tl["stagen"]->AddTask(&MHD::RecvFlux, this, id.sendf);
-  id.rkupdt    = tl["stagen"]->AddTask(&MHD::RKUpdate, this, id.recvf);
-  id.srctrms   = tl["stagen"]->AddTask(&MHD::MHDSrcTerms, this, id.rkupdt);
-  id.sendu_oa  = tl["stagen"]->AddTask(&MHD::SendU_OA, this, id.srctrms);
-  id.recvu_oa  = tl["stagen"]->AddTask(&MHD::RecvU_OA, this, id.sendu_oa);
-  id.restu     = tl["stagen"]->AddTask(&MHD::RestrictU, this, id.recvu_oa);
-  id.sendu     = tl["stagen"]->AddTask(&MHD::SendU, this, id.restu);
-  id.recvu     = tl["stagen"]->AddTask(&MHD::RecvU, this, id.sendu);
-  id.sendu_shr = tl["stagen"]->AddTask(&MHD::SendU_Shr, this, id.recvu);
-  id.recvu_shr = tl["stagen"]->AddTask(&MHD::RecvU_Shr, this, id.sendu_shr);
-  id.efld      = tl["stagen"]->AddTask(&MHD::CornerE, this, id.recvu_shr);
-  id.efldsrc   = tl["stagen"]->AddTask(&MHD::EFieldSrc, this, id.efld);
-  id.sende     = tl["stagen"]->AddTask(&MHD::SendE, this, id.efldsrc);
-  id.recve     = tl["stagen"]->AddTask(&MHD::RecvE, this, id.sende);
-  id.ct        = tl["stagen"]->AddTask(&MHD::CT, this, id.recve);
-  id.sendb_oa  = tl["stagen"]->AddTask(&MHD::SendB_OA, this, id.ct);
-  id.recvb_oa  = tl["stagen"]->AddTask(&MHD::RecvB_OA, this, id.sendb_oa);
-  id.restb     = tl["stagen"]->AddTask(&MHD::RestrictB, this, id.recvb_oa);
-  id.sendb     = tl["stagen"]->AddTask(&MHD::SendB, this, id.restb);
-  id.recvb     = tl["stagen"]->AddTask(&MHD::RecvB, this, id.sendb);
-  id.sendb_shr = tl["stagen"]->AddTask(&MHD::SendB_Shr, this, id.recvb);
-  id.recvb_shr = tl["stagen"]->AddTask(&MHD::RecvB_Shr, this, id.sendb_shr);
-  id.bcs       = tl["stagen"]->AddTask(&MHD::ApplyPhysicalBCs, this, id.recvb_shr);
-  id.prol      = tl["stagen"]->AddTask(&MHD::Prolongate, this, id.bcs);
-  id.c2p       = tl["stagen"]->AddTask(&MHD::ConToPrim, this, id.prol);
-  id.newdt     = tl["stagen"]->AddTask(&MHD::NewTimeStep, this, id.c2p);
+  // As in Hydro, the Fluxes and RKUpdate tasks route their kernels through
+  // Driver::ExecSpace() and may run on a non-default stream when '<time> nstreams > 1'.
+  // Flag them asynchronous only when no diffusion/FOFC/excision kernels (which still
+  // launch on the default instance) execute inside these tasks.
+  bool async = (pvisc == nullptr) && (presist == nullptr) && (pcond == nullptr) &&
+               (!use_fofc) && (!(pmy_pack->pcoord->is_general_relativistic));
+  id.copyu     = tl["stagen"]->AddTask(&MHD::CopyCons, this, none, "MHD::CopyCons");
+  id.flux      = tl["stagen"]->AddTask(&MHD::Fluxes, this, id.copyu,
+                                       "MHD::Fluxes", async);
+  // flux-correction tasks for u are only inserted with SMR/AMR; on uniform grids they
+  // would be no-ops cycled by the scheduler every stage (EMF tasks below are different,
+  // since EMFs are averaged between same-level neighbors as well)
+  if (pmy_pack->pmesh->multilevel) {
+    id.sendf   = tl["stagen"]->AddTask(&MHD::SendFlux, this, id.flux, "MHD::SendFlux");
+    id.recvf   = tl["stagen"]->AddTask(&MHD::RecvFlux, this, id.sendf, "MHD::RecvFlux");
+  } else {
+    id.sendf = id.flux;
+    id.recvf = id.flux;
+  }
+  id.rkupdt    = tl["stagen"]->AddTask(&MHD::RKUpdate, this, id.recvf,
+                                       "MHD::RKUpdate", async);
+  id.srctrms   = tl["stagen"]->AddTask(&MHD::MHDSrcTerms, this, id.rkupdt,
+                                       "MHD::MHDSrcTerms");
+  id.sendu_oa  = tl["stagen"]->AddTask(&MHD::SendU_OA, this, id.srctrms, "MHD::SendU_OA");
+  id.recvu_oa  = tl["stagen"]->AddTask(&MHD::RecvU_OA, this, id.sendu_oa,
+                                       "MHD::RecvU_OA");
+  // restriction/prolongation tasks are likewise only inserted with SMR/AMR; on uniform
+  // grids they would be no-ops cycled by the scheduler every stage
+  if (pmy_pack->pmesh->multilevel) {
+    id.restu   = tl["stagen"]->AddTask(&MHD::RestrictU, this, id.recvu_oa,
+                                       "MHD::RestrictU");
+  } else {
+    id.restu = id.recvu_oa;
+  }
+  id.sendu     = tl["stagen"]->AddTask(&MHD::SendU, this, id.restu, "MHD::SendU");
+  id.recvu     = tl["stagen"]->AddTask(&MHD::RecvU, this, id.sendu, "MHD::RecvU");
+  id.sendu_shr = tl["stagen"]->AddTask(&MHD::SendU_Shr, this, id.recvu, "MHD::SendU_Shr");
+  id.recvu_shr = tl["stagen"]->AddTask(&MHD::RecvU_Shr, this, id.sendu_shr,
+                                       "MHD::RecvU_Shr");
+  id.efld      = tl["stagen"]->AddTask(&MHD::CornerE, this, id.recvu_shr, "MHD::CornerE");
+  id.efldsrc   = tl["stagen"]->AddTask(&MHD::EFieldSrc, this, id.efld, "MHD::EFieldSrc");
+  id.sende     = tl["stagen"]->AddTask(&MHD::SendE, this, id.efldsrc, "MHD::SendE");
+  id.recve     = tl["stagen"]->AddTask(&MHD::RecvE, this, id.sende, "MHD::RecvE");
+  id.ct        = tl["stagen"]->AddTask(&MHD::CT, this, id.recve, "MHD::CT");
+  id.sendb_oa  = tl["stagen"]->AddTask(&MHD::SendB_OA, this, id.ct, "MHD::SendB_OA");
+  id.recvb_oa  = tl["stagen"]->AddTask(&MHD::RecvB_OA, this, id.sendb_oa,
+                                       "MHD::RecvB_OA");
+  if (pmy_pack->pmesh->multilevel) {
+    id.restb   = tl["stagen"]->AddTask(&MHD::RestrictB, this, id.recvb_oa,
+                                       "MHD::RestrictB");
+  } else {
+    id.restb = id.recvb_oa;
+  }
+  id.sendb     = tl["stagen"]->AddTask(&MHD::SendB, this, id.restb, "MHD::SendB");
+  // interior cells are converted while boundary messages for B are in flight (u0 and
+  // interior b0 are final once CT and the OA/restriction steps above complete); ghost
+  // zones are converted separately once receives and prolongation have completed
+  id.c2p_int   = tl["stagen"]->AddTask(&MHD::ConToPrimInterior, this, id.sendb,
+                                       "MHD::ConToPrimInterior");
+  id.recvb     = tl["stagen"]->AddTask(&MHD::RecvB, this, id.sendb, "MHD::RecvB");
+  id.sendb_shr = tl["stagen"]->AddTask(&MHD::SendB_Shr, this, id.recvb, "MHD::SendB_Shr");
+  id.recvb_shr = tl["stagen"]->AddTask(&MHD::RecvB_Shr, this, id.sendb_shr,
+                                       "MHD::RecvB_Shr");
+  id.bcs       = tl["stagen"]->AddTask(&MHD::ApplyPhysicalBCs, this, id.recvb_shr,
+                                       "MHD::ApplyPhysicalBCs");
+  if (pmy_pack->pmesh->multilevel) {
+    id.prol    = tl["stagen"]->AddTask(&MHD::Prolongate, this, id.bcs, "MHD::Prolongate");
+  } else {
+    id.prol = id.bcs;
+  }
+  TaskID c2p_dep = (id.prol | id.c2p_int);
+  id.c2p       = tl["stagen"]->AddTask(&MHD::ConToPrimGhosts, this, c2p_dep,
+                                       "MHD::ConToPrimGhosts");
+  id.newdt     = tl["stagen"]->AddTask(&MHD::NewTimeStep, this, id.c2p,
+                                       "MHD::NewTimeStep");
 
   // assemble "after_stagen" task list
-  id.csend = tl["after_stagen"]->AddTask(&MHD::ClearSend, this, none);
+  id.csend = tl["after_stagen"]->AddTask(&MHD::ClearSend, this, none, "MHD::ClearSend");
   // although RecvFlux/U/E/B functions check that all recvs complete, add ClearRecv to
   // task list anyways to catch potential bugs in MPI communication logic
-  id.crecv = tl["after_stagen"]->AddTask(&MHD::ClearRecv, this, id.csend);
+  id.crecv = tl["after_stagen"]->AddTask(&MHD::ClearRecv, this, id.csend,
+                                         "MHD::ClearRecv");
+
+  // assemble "sts_*" task lists, used to advance diffusion terms with RKL2
+  // super-time-stepping, operator-split from the main integrator.  The E-field/CT
+  // tasks that diffuse the face-centered B are only needed with resistivity.
+  if (use_sts) {
+    id.sts_irecv  = tl["sts_before_stagen"]->AddTask(&MHD::STSInitRecv, this, none,
+                                                     "MHD::STSInitRecv");
+
+    id.sts_flux   = tl["sts_stagen"]->AddTask(&MHD::STSFluxes, this, none,
+                                              "MHD::STSFluxes");
+    if (pmy_pack->pmesh->multilevel) {
+      id.sts_sendf = tl["sts_stagen"]->AddTask(&MHD::SendFlux, this, id.sts_flux,
+                                               "MHD::SendFlux");
+      id.sts_recvf = tl["sts_stagen"]->AddTask(&MHD::RecvFlux, this, id.sts_sendf,
+                                               "MHD::RecvFlux");
+    } else {
+      id.sts_sendf = id.sts_flux;
+      id.sts_recvf = id.sts_flux;
+    }
+    id.sts_rkupdt = tl["sts_stagen"]->AddTask(&MHD::STSRKUpdate, this, id.sts_recvf,
+                                              "MHD::STSRKUpdate");
+    TaskID dep = id.sts_rkupdt;
+    if (presist != nullptr) {
+      id.sts_efld  = tl["sts_stagen"]->AddTask(&MHD::STSCornerE, this, id.sts_rkupdt,
+                                               "MHD::STSCornerE");
+      id.sts_sende = tl["sts_stagen"]->AddTask(&MHD::SendE, this, id.sts_efld,
+                                               "MHD::SendE");
+      id.sts_recve = tl["sts_stagen"]->AddTask(&MHD::RecvE, this, id.sts_sende,
+                                               "MHD::RecvE");
+      id.sts_ct    = tl["sts_stagen"]->AddTask(&MHD::STSCT, this, id.sts_recve,
+                                               "MHD::STSCT");
+      dep = id.sts_ct;
+    }
+    if (pmy_pack->pmesh->multilevel) {
+      id.sts_restu = tl["sts_stagen"]->AddTask(&MHD::RestrictU, this, dep,
+                                               "MHD::RestrictU");
+    } else {
+      id.sts_restu = dep;
+    }
+    id.sts_sendu  = tl["sts_stagen"]->AddTask(&MHD::SendU, this, id.sts_restu,
+                                              "MHD::SendU");
+    id.sts_recvu  = tl["sts_stagen"]->AddTask(&MHD::RecvU, this, id.sts_sendu,
+                                              "MHD::RecvU");
+    dep = id.sts_recvu;
+    if (presist != nullptr) {
+      if (pmy_pack->pmesh->multilevel) {
+        id.sts_restb = tl["sts_stagen"]->AddTask(&MHD::RestrictB, this, id.sts_recvu,
+                                                 "MHD::RestrictB");
+      } else {
+        id.sts_restb = id.sts_recvu;
+      }
+      id.sts_sendb = tl["sts_stagen"]->AddTask(&MHD::SendB, this, id.sts_restb,
+                                               "MHD::SendB");
+      id.sts_recvb = tl["sts_stagen"]->AddTask(&MHD::RecvB, this, id.sts_sendb,
+                                               "MHD::RecvB");
+      dep = id.sts_recvb;
+    }
+    id.sts_bcs    = tl["sts_stagen"]->AddTask(&MHD::ApplyPhysicalBCs, this, dep,
+                                              "MHD::ApplyPhysicalBCs");
+    if (pmy_pack->pmesh->multilevel) {
+      id.sts_prol = tl["sts_stagen"]->AddTask(&MHD::Prolongate, this, id.sts_bcs,
+                                              "MHD::Prolongate");
+    } else {
+      id.sts_prol = id.sts_bcs;
+    }
+    id.sts_c2p    = tl["sts_stagen"]->AddTask(&MHD::ConToPrim, this, id.sts_prol,
+                                              "MHD::ConToPrim");
+
+    id.sts_csend  = tl["sts_after_stagen"]->AddTask(&MHD::STSClearSend, this, none,
+                                                    "MHD::STSClearSend");
+    id.sts_crecv  = tl["sts_after_stagen"]->AddTask(&MHD::STSClearRecv, this,
+                                                    id.sts_csend, "MHD::STSClearRecv");
+  }
 
   return;
 }
@@ -96,6 +224,16 @@ TaskStatus MHD::SaveMHDState(Driver *pdrive, int stage) {
   return TaskStatus::complete;
 }
 
+//----------------------------------------------------------------------------------------
+//! \fn TaskStatus MHD::CoolingSubcycle
+//! \brief Wrapper task list function for operator-split subcycled cooling, applied once
+//! per cycle over the full timestep after the main integrator stages complete.
+
+TaskStatus MHD::CoolingSubcycle(Driver *pdrive, int stage) {
+  psrc->ISMCoolingSubcycled(w0, peos->eos_data, pmy_pack->pmesh->dt, u0);
+  return TaskStatus::complete;
+}
+
 //----------------------------------------------------------------------------------------
 //! \fn TaskStatus MHD::InitRecv
 //! \brief Wrapper task list function to post non-blocking receives (with MPI), and
@@ -191,15 +329,13 @@ TaskStatus MHD::Fluxes(Driver *pdrive, int stage) {
     CalculateFluxes<MHD_RSolver::hlle_gr>(pdrive, stage);
   }
 
-  // Add viscous, resistive, heat-flux, etc fluxes
-  if (pvisc != nullptr) {
-    pvisc->IsotropicViscousFlux(w0, pvisc->nu, peos->eos_data, uflx);
-  }
-  if ((presist != nullptr) && (peos->eos_data.is_ideal)) {
-    presist->OhmicEnergyFlux(b0, uflx);
-  }
-  if (pcond != nullptr) {
-    pcond->AddHeatFlux(w0, peos->eos_data, uflx);
+  // Add heat fluxes (unless advanced with operator-split STS).  Viscous and Ohmic
+  // energy fluxes are added inline by the CalculateFluxes kernels themselves (see
+  // mhd_fluxes.cpp); the resistive EMF is added in the corner-E update.
+  if (!use_sts) {
+    if (pcond != nullptr) {
+      pcond->AddHeatFlux(w0, peos->eos_data, uflx);
+    }
   }
 
   // call FOFC if necessary
@@ -234,11 +370,13 @@ TaskStatus MHD::SendFlux(Driver *pdrive, int stage) {
 //! conserved variables at fine/coarse boundaries
 
 TaskStatus MHD::RecvFlux(Driver *pdrive, int stage) {
+  profiler::WaitTimer wtimer("mhd_recv_flux", stage);
   TaskStatus tstat = TaskStatus::complete;
   // Only execute BoundaryValues function with SMR/SMR
   if (pmy_pack->pmesh->multilevel) {
     tstat = pbval_u->RecvAndUnpackFluxCC(uflx);
   }
+  if (tstat == TaskStatus::complete) {wtimer.Completed();}
   return tstat;
 }
 
@@ -253,7 +391,9 @@ TaskStatus MHD::MHDSrcTerms(Driver *pdrive, int stage) {
 
   // Add source terms for various physics
   if (psrc->const_accel)  psrc->ConstantAccel(w0, peos->eos_data, beta_dt, u0);
-  if (psrc->ism_cooling)  psrc->ISMCooling(w0, peos->eos_data, beta_dt, u0);
+  if (psrc->ism_cooling && !psrc->ism_cool_subcycle) {
+    psrc->ISMCooling(w0, peos->eos_data, beta_dt, u0);
+  }
   if (psrc->rel_cooling)  psrc->RelCooling(w0, peos->eos_data, beta_dt, u0);
   if (psrc->shearing_box) psrc->ShearingBox(w0, bcc0, peos->eos_data, beta_dt, u0);
 
@@ -308,8 +448,11 @@ TaskStatus MHD::RecvU_OA(Driver *pdrive, int stage) {
 
 TaskStatus MHD::RestrictU(Driver *pdrive, int stage) {
   // Only execute Mesh function with SMR/AMR
+  // Restriction is limited to interface-adjacent cells; coarse data is only consumed by
+  // sends to coarser neighbors and prolongation stencils.  AMR events restrict the full
+  // volume themselves before de-refining.
   if (pmy_pack->pmesh->multilevel) {
-    pmy_pack->pmesh->pmr->RestrictCC(u0, coarse_u0);
+    pbval_u->RestrictInterfaceCC(u0, coarse_u0);
   }
   return TaskStatus::complete;
 }
@@ -328,7 +471,9 @@ TaskStatus MHD::SendU(Driver *pdrive, int stage) {
 //! \brief Wrapper task list function to receive/unpack cell-centered conserved variables
 
 TaskStatus MHD::RecvU(Driver *pdrive, int stage) {
+  profiler::WaitTimer wtimer("mhd_recv_u", stage);
   TaskStatus tstat = pbval_u->RecvAndUnpackCC(u0, coarse_u0);
+  if (tstat == TaskStatus::complete) {wtimer.Completed();}
   return tstat;
 }
 
@@ -390,8 +535,10 @@ TaskStatus MHD::SendE(Driver *pdrive, int stage) {
 //! (i.e. edge-centered electric field E) at MeshBlock boundaries
 
 TaskStatus MHD::RecvE(Driver *pdrive, int stage) {
+  profiler::WaitTimer wtimer("mhd_recv_e", stage);
   TaskStatus tstat = TaskStatus::complete;
   tstat = pbval_b->RecvAndUnpackFluxFC(efld);
+  if (tstat == TaskStatus::complete) {wtimer.Completed();}
   return tstat;
 }
 
@@ -438,7 +585,9 @@ TaskStatus MHD::SendB(Driver *pdrive, int stage) {
 //! \brief Wrapper task list function to recv/unpack face-centered magnetic fields
 
 TaskStatus MHD::RecvB(Driver *pdrive, int stage) {
+  profiler::WaitTimer wtimer("mhd_recv_b", stage);
   TaskStatus tstat = pbval_b->RecvAndUnpackFC(b0, coarse_b0);
+  if (tstat == TaskStatus::complete) {wtimer.Completed();}
   return tstat;
 }
 
@@ -525,6 +674,48 @@ TaskStatus MHD::ConToPrim(Driver *pdrive, int stage) {
   return TaskStatus::complete;
 }
 
+//----------------------------------------------------------------------------------------
+//! \fn TaskStatus MHD::ConToPrimInterior
+//! \brief Wrapper task list function to call ConsToPrim over interior cells only.
+//! Scheduled before the boundary receive tasks so the conversion overlaps with messages
+//! in flight; ghost zones are converted afterwards by ConToPrimGhosts.
+
+TaskStatus MHD::ConToPrimInterior(Driver *pdrive, int stage) {
+  auto &indcs = pmy_pack->pmesh->mb_indcs;
+  peos->ConsToPrim(u0, b0, w0, bcc0, false, indcs.is, indcs.ie, indcs.js, indcs.je,
+                   indcs.ks, indcs.ke);
+  return TaskStatus::complete;
+}
+
+//----------------------------------------------------------------------------------------
+//! \fn TaskStatus MHD::ConToPrimGhosts
+//! \brief Wrapper task list function to call ConsToPrim over ghost zones only, after
+//! boundary receives and prolongation complete.  The strips tile the ghost shell exactly
+//! once: x1-faces span the full x2/x3 extents, x2-faces span only the x1 interior, and
+//! x3-faces span only the x1/x2 interior.
+
+TaskStatus MHD::ConToPrimGhosts(Driver *pdrive, int stage) {
+  auto &indcs = pmy_pack->pmesh->mb_indcs;
+  int &ng = indcs.ng;
+  int n1m1 = indcs.nx1 + 2*ng - 1;
+  int n2m1 = (indcs.nx2 > 1)? (indcs.nx2 + 2*ng - 1) : 0;
+  int n3m1 = (indcs.nx3 > 1)? (indcs.nx3 + 2*ng - 1) : 0;
+  peos->ConsToPrim(u0, b0, w0, bcc0, false, 0, (ng-1), 0, n2m1, 0, n3m1);
+  peos->ConsToPrim(u0, b0, w0, bcc0, false, (n1m1-ng+1), n1m1, 0, n2m1, 0, n3m1);
+  if (pmy_pack->pmesh->multi_d) {
+    peos->ConsToPrim(u0, b0, w0, bcc0, false, ng, (n1m1-ng), 0, (ng-1), 0, n3m1);
+    peos->ConsToPrim(u0, b0, w0, bcc0, false, ng, (n1m1-ng), (n2m1-ng+1), n2m1,
+                     0, n3m1);
+  }
+  if (pmy_pack->pmesh->three_d) {
+    peos->ConsToPrim(u0, b0, w0, bcc0, false, ng, (n1m1-ng), ng, (n2m1-ng),
+                     0, (ng-1));
+    peos->ConsToPrim(u0, b0, w0, bcc0, false, ng, (n1m1-ng), ng, (n2m1-ng),
+                     (n3m1-ng+1), n3m1);
+  }
+  return TaskStatus::complete;
+}
+
 //----------------------------------------------------------------------------------------
 //! \fn TaskStatus MHD::ClearSend
 //! \brief Wrapper task list function that checks all MPI sends have completed. Used in
@@ -642,8 +833,13 @@ TaskStatus MHD::ClearRecv(Driver *pdrive, int stage) {
 //! \brief Wrapper function that restricts face-centered variables (magnetic field)
 
 TaskStatus MHD::RestrictB(Driver *pdrive, int stage) {
-  // Only execute Mesh function with SMR/AMR
+  // Only execute Mesh function with SMR/AMR, and only when this pack actually contains
+  // fine/coarse interfaces (census cached in pbval_b, rebuilt after any remesh).  The
+  // coarse field is only consumed by sends to coarser neighbors and prolongation
+  // stencils; AMR events restrict the full volume themselves before de-refining.
   if (pmy_pack->pmesh->multilevel) {
+    if (pbval_b->prol_stale) {pbval_b->InitProlongationInterfaces();}
+    if (pbval_b->nprol == 0) {return TaskStatus::complete;}
     pmy_pack->pmesh->pmr->RestrictFC(b0, coarse_b0);
   }
   return TaskStatus::complete;
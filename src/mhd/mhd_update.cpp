@@ -19,16 +19,30 @@
 namespace mhd {
 //----------------------------------------------------------------------------------------
 //! \fn  void MHD::Update
-//  \brief Explicit RK update including flux divergence terms
+//  \brief Explicit RK update including flux divergence terms.  Dispatches to the kernel
+//  specialized for this problem's dimensionality, so 1D/2D runs compile out the
+//  transverse flux-divergence terms instead of branching on them per cell
 
 TaskStatus MHD::RKUpdate(Driver *pdriver, int stage) {
+  if (pmy_pack->pmesh->three_d) {
+    return RKUpdateDim<true,true>(pdriver, stage);
+  } else if (pmy_pack->pmesh->multi_d) {
+    return RKUpdateDim<true,false>(pdriver, stage);
+  }
+  return RKUpdateDim<false,false>(pdriver, stage);
+}
+
+//----------------------------------------------------------------------------------------
+//! \fn  void MHD::RKUpdateDim
+//  \brief RK update kernel with dimensionality lifted to compile time
+
+template <bool MULTI_D, bool THREE_D>
+TaskStatus MHD::RKUpdateDim(Driver *pdriver, int stage) {
   auto &indcs = pmy_pack->pmesh->mb_indcs;
   int is = indcs.is, ie = indcs.ie;
   int js = indcs.js, je = indcs.je;
   int ks = indcs.ks, ke = indcs.ke;
   int ncells1 = indcs.nx1 + 2*(indcs.ng);
-  bool &multi_d = pmy_pack->pmesh->multi_d;
-  bool &three_d = pmy_pack->pmesh->three_d;
 
   Real &gam0 = pdriver->gam0[stage-1];
   Real &gam1 = pdriver->gam1[stage-1];
@@ -41,6 +55,8 @@ TaskStatus MHD::RKUpdate(Driver *pdriver, int stage) {
   auto flx2 = uflx.x2f;
   auto flx3 = uflx.x3f;
   auto &mbsize = pmy_pack->pmb->mb_size;
+  // stream this task was launched on (default instance unless task flagged async)
+  DevExeSpace exec = pdriver->ExecSpace();
 
   // hierarchical parallel loop that updates conserved variables to intermediate step
   // using weights and fractional time step appropriate to stages of time-integrator used
@@ -48,7 +64,7 @@ TaskStatus MHD::RKUpdate(Driver *pdriver, int stage) {
   int scr_level = 0;
   size_t scr_size = ScrArray1D<Real>::shmem_size(ncells1);
 
-  par_for_outer("mhd_update",DevExeSpace(),scr_size,scr_level,0,nmb1,0,nv1,ks,ke,js,je,
+  par_for_outer("mhd_update",exec,scr_size,scr_level,0,nmb1,0,nv1,ks,ke,js,je,
   KOKKOS_LAMBDA(TeamMember_t member, const int m, const int n, const int k, const int j) {
     ScrArray1D<Real> divf(member.team_scratch(scr_level), ncells1);
 
@@ -60,7 +76,7 @@ TaskStatus MHD::RKUpdate(Driver *pdriver, int stage) {
 
     // Add dF2/dx2
     // Fluxes must be summed in pairs to symmetrize round-off error in each dir
-    if (multi_d) {
+    if (MULTI_D) {
       par_for_inner(member, is, ie, [&](const int i) {
         divf(i) += (flx2(m,n,k,j+1,i) - flx2(m,n,k,j,i))/mbsize.d_view(m).dx2;
       });
@@ -69,7 +85,7 @@ TaskStatus MHD::RKUpdate(Driver *pdriver, int stage) {
 
     // Add dF3/dx3
     // Fluxes must be summed in pairs to symmetrize round-off error in each dir
-    if (three_d) {
+    if (THREE_D) {
       par_for_inner(member, is, ie, [&](const int i) {
         divf(i) += (flx3(m,n,k+1,j,i) - flx3(m,n,k,j,i))/mbsize.d_view(m).dx3;
       });
@@ -82,4 +98,8 @@ TaskStatus MHD::RKUpdate(Driver *pdriver, int stage) {
   });
   return TaskStatus::complete;
 }
+
+template TaskStatus MHD::RKUpdateDim<false,false>(Driver *pdriver, int stage);
+template TaskStatus MHD::RKUpdateDim<true,false>(Driver *pdriver, int stage);
+template TaskStatus MHD::RKUpdateDim<true,true>(Driver *pdriver, int stage);
 } // namespace mhd
@@ -34,8 +34,8 @@ void HLLD(TeamMember_t const &member, const EOS_Data &eos,
 
   //------------------------ ADIABATIC HLLD solver ---------------------------------------
   if (eos.is_ideal) {
-    Real gm1 = eos.gamma - 1.0;
-    Real igm1 = 1.0/gm1;
+    Real gm1 = eos.gm1;
+    Real igm1 = eos.igm1;
     par_for_inner(member, il, iu, [&](const int i) {
       //--- Step 1.  Create local references for L/R states (helps compiler vectorize)
 
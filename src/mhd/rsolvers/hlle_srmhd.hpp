@@ -27,8 +27,8 @@ void HLLE_SR(TeamMember_t const &member, const EOS_Data &eos,
   int ivz = IVX + ((ivx-IVX) + 2)%3;
   int iby = ((ivx-IVX) + 1)%3;
   int ibz = ((ivx-IVX) + 2)%3;
-  const Real gm1 = (eos.gamma - 1.0);
-  const Real gamma_prime = eos.gamma/gm1;
+  const Real gm1 = eos.gm1;
+  const Real gamma_prime = eos.gamma*eos.igm1;
 
   par_for_inner(member, il, iu, [&](const int i) {
     // Extract left primitives
@@ -41,6 +41,7 @@ BaseTypeOutput::BaseTypeOutput(ParameterInput *pin, Mesh *pm, OutputParameters o
     derived_var("derived-var",1,1,1,1,1),
     outarray("cc_outvar",1,1,1,1,1),
     outfield("fc_outvar",1,1,1,1),
+    tavg_var("tavg-var",1,1,1,1,1),
     out_params(opar) {
   // exit for history, restart, or event log files
   if (out_params.file_type.compare("hst") == 0 ||
@@ -48,9 +49,78 @@ BaseTypeOutput::BaseTypeOutput(ParameterInput *pin, Mesh *pm, OutputParameters o
       out_params.file_type.compare("log") == 0 ||
       out_params.file_type.compare("trk") == 0) {return;}
 
+#if MPI_PARALLEL_ENABLED
+  // With 'async=true' file writes are performed by a background host thread (see
+  // MeshBinaryOutput and MeshVTKOutput), so MPI must support MPI_THREAD_MULTIPLE and
+  // the writer thread needs its own communicator for MPI-IO (collective file operations
+  // on MPI_COMM_WORLD could otherwise interfere with collectives posted by the main
+  // thread while the next cycles are integrated).
+  if (out_params.async) {
+    int mpiprv;
+    MPI_Query_thread(&mpiprv);
+    if (mpiprv != MPI_THREAD_MULTIPLE) {
+      std::cout << "### FATAL ERROR in " << __FILE__ << " at line " << __LINE__
+                << std::endl << "async output requested in block '"
+                << out_params.block_name << "' but MPI does not provide "
+                << "MPI_THREAD_MULTIPLE" << std::endl;
+      exit(EXIT_FAILURE);
+    }
+    MPI_Comm_dup(MPI_COMM_WORLD, &io_comm_);
+  }
+#endif
+
   // initialize vector containing number of output MBs per rank
   noutmbs.assign(global_variable::nranks, 0);
 
+  // Fused derived variables: 'variable' may also be a comma-separated list of the
+  // stencil quantities in fused_derived_choice[] (outputs.hpp), all of which are then
+  // computed by a single kernel in ComputeDerivedFused() instead of one full-grid pass
+  // per quantity.  Handled here as a special case since the list is not a valid single
+  // variable name
+  if (out_params.variable.find(',') != std::string::npos) {
+    std::stringstream vstream(out_params.variable);
+    std::string token;
+    bool any_hydro = false, any_mhd = false;
+    while (std::getline(vstream, token, ',')) {
+      bool valid = false;
+      for (int i=0; i<(NFUSED_DERIVED_CHOICES); ++i) {
+        if (token.compare(fused_derived_choice[i]) == 0) {valid = true;}
+      }
+      if (!valid) {
+        std::cout << "### FATAL ERROR in " << __FILE__ << " at line " << __LINE__
+           << std::endl << "Variable '" << token << "' in list in block '"
+           << out_params.block_name << "' in input file cannot be fused" << std::endl;
+        std::exit(EXIT_FAILURE);
+      }
+      any_hydro = any_hydro || (token.compare(0, 6, "hydro_") == 0);
+      any_mhd = any_mhd || (token.compare(0, 4, "mhd_") == 0);
+      out_params.contains_derived = true;
+      out_params.n_derived += 1;
+      outvars.emplace_back(token, out_params.n_derived-1, &(derived_var));
+    }
+    if (any_hydro && any_mhd) {
+      std::cout << "### FATAL ERROR in " << __FILE__ << " at line " << __LINE__
+         << std::endl << "Fused variable list in block '" << out_params.block_name
+         << "' mixes hydro_* and mhd_* quantities" << std::endl;
+      std::exit(EXIT_FAILURE);
+    }
+    if (any_hydro && (pm->pmb_pack->phydro == nullptr)) {
+      std::cout << "### FATAL ERROR in " << __FILE__ << " at line " << __LINE__
+         << std::endl << "Output of Hydro variable requested in <output> block '"
+         << out_params.block_name << "' but no Hydro object has been constructed."
+         << std::endl << "Input file is likely missing a <hydro> block" << std::endl;
+      exit(EXIT_FAILURE);
+    }
+    if (any_mhd && (pm->pmb_pack->pmhd == nullptr)) {
+      std::cout << "### FATAL ERROR in " << __FILE__ << " at line " << __LINE__
+         << std::endl << "Output of MHD variable requested in <output> block '"
+         << out_params.block_name << "' but no MHD object has been constructed."
+         << std::endl << "Input file is likely missing a <mhd> block" << std::endl;
+      exit(EXIT_FAILURE);
+    }
+    return;
+  }
+
   // check for valid choice of variables
   int ivar = -1;
   for (int i=0; i<(NOUTPUT_CHOICES); ++i) {
@@ -684,6 +754,27 @@ BaseTypeOutput::BaseTypeOutput(ParameterInput *pin, Mesh *pm, OutputParameters o
   noutmbs.assign(global_variable::nranks, 0);
 }
 
+//----------------------------------------------------------------------------------------
+// BaseTypeOutput base class destructor
+// Joins background writer thread (if any) so program cannot exit with a write in flight
+
+BaseTypeOutput::~BaseTypeOutput() {
+  FenceAsyncWrite();
+#if MPI_PARALLEL_ENABLED
+  if (io_comm_ != MPI_COMM_NULL) {MPI_Comm_free(&io_comm_);}
+#endif
+}
+
+//----------------------------------------------------------------------------------------
+//! \fn void BaseTypeOutput::FenceAsyncWrite()
+//! \brief Blocks until the background thread writing the previous dump (if any) has
+//! finished.  Called at the start of each WriteOutputFile() so the buffers and file
+//! counters it captured can be safely reused, and by the destructor.
+
+void BaseTypeOutput::FenceAsyncWrite() {
+  if (iothread_.joinable()) {iothread_.join();}
+}
+
 //----------------------------------------------------------------------------------------
 // BaseTypeOutput::LoadOutputData()
 // create std::vector of HostArray3Ds containing data specified in <output> block for
@@ -707,6 +798,29 @@ void BaseTypeOutput::LoadOutputData(Mesh *pm) {
     // skip if MeshBlock ID is specified and not equal to this ID
     if (out_params.gid >= 0 && (m+gids) != out_params.gid) { continue; }
 
+    // skip if MeshBlock does not intersect region-of-interest (if specified).  Test is
+    // repeated against current MeshBlock sizes every dump, so with AMR the output set
+    // follows the region as blocks are created and destroyed
+    if (out_params.roi) {
+      if (out_params.roi_sphere) {
+        // compute distance from region center to nearest point in this MeshBlock
+        Real d1 = fmax(size.h_view(m).x1min - out_params.roi_x1c,
+                  fmax(out_params.roi_x1c - size.h_view(m).x1max, 0.0));
+        Real d2 = fmax(size.h_view(m).x2min - out_params.roi_x2c,
+                  fmax(out_params.roi_x2c - size.h_view(m).x2max, 0.0));
+        Real d3 = fmax(size.h_view(m).x3min - out_params.roi_x3c,
+                  fmax(out_params.roi_x3c - size.h_view(m).x3max, 0.0));
+        if ((SQR(d1) + SQR(d2) + SQR(d3)) > SQR(out_params.roi_rad)) { continue; }
+      } else {
+        if (size.h_view(m).x1max <= out_params.roi_x1min ||
+            size.h_view(m).x1min >= out_params.roi_x1max ||
+            size.h_view(m).x2max <= out_params.roi_x2min ||
+            size.h_view(m).x2min >= out_params.roi_x2max ||
+            size.h_view(m).x3max <= out_params.roi_x3min ||
+            size.h_view(m).x3min >= out_params.roi_x3max) { continue; }
+      }
+    }
+
     int ois,oie,ojs,oje,oks,oke;
 
     if (out_params.include_gzs) {
@@ -791,35 +905,69 @@ void BaseTypeOutput::LoadOutputData(Mesh *pm) {
     Kokkos::realloc(outarray, nout_vars, nout_mbs, nout3, nout2, nout1);
   }
 
-  // Calculate derived variables, if required
-  if (out_params.contains_derived) {
+  // Calculate derived variables, if required.  With windowed time averaging they have
+  // already been accumulated every cycle, and with the shared-snapshot service they
+  // were computed just before the snapshot was taken, so recomputing is not needed
+  if (out_params.contains_derived && !(out_params.time_average) && snap_srcs.empty()) {
     ComputeDerivedVariable(out_params.variable, pm);
   }
 
-  // Now copy data to host (outarray) over all variables and MeshBlocks
-  for (int n=0; n<nout_vars; ++n) {
-    for (int m=0; m<nout_mbs; ++m) {
-      int mbi = pm->FindMeshBlockIndex(outmbs[m].mb_gid);
-      std::pair<int,int> irange = std::make_pair(outmbs[m].ois, outmbs[m].oie+1);
-      std::pair<int,int> jrange = std::make_pair(outmbs[m].ojs, outmbs[m].oje+1);
-      std::pair<int,int> krange = std::make_pair(outmbs[m].oks, outmbs[m].oke+1);
-      int nout1 = (outmbs[0].oie - outmbs[0].ois + 1);
-      int nout2 = (outmbs[0].oje - outmbs[0].ojs + 1);
-      int nout3 = (outmbs[0].oke - outmbs[0].oks + 1);
-
-      // copy output variable to new device View
-      DvceArray3D<Real> d_output_var("d_out_var",nout3,nout2,nout1);
-      auto d_slice = Kokkos::subview(*(outvars[n].data_ptr), mbi, outvars[n].data_index,
-                                     krange,jrange,irange);
-      Kokkos::deep_copy(d_output_var,d_slice);
-
-      // copy new device View to host mirror View
-      DvceArray3D<Real>::HostMirror h_output_var = Kokkos::create_mirror(d_output_var);
-      Kokkos::deep_copy(h_output_var,d_output_var);
-
-      // copy host mirror to 5D host View containing all output variables
-      auto h_slice = Kokkos::subview(outarray,n,m,Kokkos::ALL,Kokkos::ALL,Kokkos::ALL);
-      Kokkos::deep_copy(h_slice,h_output_var);
+  // windowed time average: convert the accumulated weighted sums into the average over
+  // the window ending now; the copy loop below then reads them through outvars.  If
+  // nothing has been accumulated since the last dump (e.g. the initial dump, or a final
+  // dump immediately following an output cycle), fall back to a snapshot
+  if (out_params.time_average) {
+    if (tavg_time <= 0.0) {AccumulateTimeAverage(pm, 1.0);}
+    const Real norm = 1.0/tavg_time;
+    Real *pdata = tavg_var.data();
+    const int ntot = static_cast<int>(tavg_var.span());
+    Kokkos::parallel_for("tavg_norm", Kokkos::RangePolicy<>(DevExeSpace(), 0, ntot),
+    KOKKOS_LAMBDA(const int &idx) {
+      pdata[idx] *= norm;
+    });
+    // reset window; the buffer is zeroed again on the next accumulation
+    tavg_time = 0.0;
+  }
+
+  // Now copy data to host (outarray) over all variables and MeshBlocks.  Since outarray
+  // lives in pinned host memory, each block is copied straight from a persistent device
+  // staging buffer into its final slot at full DMA bandwidth.  Two staging buffers bound
+  // to separate execution space instances are alternated, so the pack of one block
+  // overlaps the transfer of the previous one; in-order execution on each instance
+  // protects a buffer from being re-packed before its transfer has drained.
+  if (nout_vars > 0 && nout_mbs > 0) {
+    int nout1 = (outmbs[0].oie - outmbs[0].ois + 1);
+    int nout2 = (outmbs[0].oje - outmbs[0].ojs + 1);
+    int nout3 = (outmbs[0].oke - outmbs[0].oks + 1);
+    if (stage_stream_.empty()) {
+      std::vector<int> weights(2, 1);
+      auto insts = Kokkos::Experimental::partition_space(DevExeSpace(), weights);
+      for (auto &es : insts) {stage_stream_.push_back(es);}
+    }
+    for (int b=0; b<2; ++b) {
+      if (stage_dev_[b].extent_int(0) != nout3 || stage_dev_[b].extent_int(1) != nout2 ||
+          stage_dev_[b].extent_int(2) != nout1) {
+        Kokkos::realloc(stage_dev_[b], nout3, nout2, nout1);
+      }
+    }
+    for (int n=0; n<nout_vars; ++n) {
+      for (int m=0; m<nout_mbs; ++m) {
+        int mbi = pm->FindMeshBlockIndex(outmbs[m].mb_gid);
+        std::pair<int,int> irange = std::make_pair(outmbs[m].ois, outmbs[m].oie+1);
+        std::pair<int,int> jrange = std::make_pair(outmbs[m].ojs, outmbs[m].oje+1);
+        std::pair<int,int> krange = std::make_pair(outmbs[m].oks, outmbs[m].oke+1);
+        int b = (n*nout_mbs + m) % 2;
+
+        // pack output variable into contiguous device staging buffer
+        auto d_slice = Kokkos::subview(*(outvars[n].data_ptr), mbi,
+                                       outvars[n].data_index, krange,jrange,irange);
+        Kokkos::deep_copy(stage_stream_[b], stage_dev_[b], d_slice);
+
+        // append asynchronous copy into the pinned 5D host View on the same instance
+        auto h_slice = Kokkos::subview(outarray,n,m,Kokkos::ALL,Kokkos::ALL,Kokkos::ALL);
+        Kokkos::deep_copy(stage_stream_[b], h_slice, stage_dev_[b]);
+      }
     }
+    for (auto &es : stage_stream_) {es.fence();}
   }
 }
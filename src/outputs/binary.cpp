@@ -16,6 +16,7 @@
 #include <numeric>
 #include <sstream>
 #include <string>
+#include <thread>
 #include <vector>
 #include <algorithm> // min
 
@@ -24,6 +25,7 @@
 #include "coordinates/cell_locations.hpp"
 #include "mesh/mesh.hpp"
 #include "outputs.hpp"
+#include "utils/hugepage.hpp"
 
 //----------------------------------------------------------------------------------------
 // Constructor: also calls BaseTypeOutput base class constructor
@@ -43,6 +45,10 @@ MeshBinaryOutput::MeshBinaryOutput(ParameterInput *pin, Mesh *pm, OutputParamete
 //   All MeshBlocks are written to the same file.
 
 void MeshBinaryOutput::WriteOutputFile(Mesh *pm, ParameterInput *pin) {
+  // With 'async=true' writes of the previous dump may still be in flight on the
+  // background thread; wait for them to finish before starting a new dump
+  FenceAsyncWrite();
+
   // check if slicing
   bool bin_slice = (out_params.slice1 || out_params.slice2 || out_params.slice3);
 
@@ -60,15 +66,15 @@ void MeshBinaryOutput::WriteOutputFile(Mesh *pm, ParameterInput *pin) {
   fname.append(number);
   fname.append(".bin");
 
-  IOWrapper binfile;
-  std::size_t header_offset=0;
-  binfile.Open(fname.c_str(), IOWrapper::FileMode::write);
-
   // Basic parts of the format:
   // 1. Size of the header
   // 2. Current time
   // 3. List of variables in the file
   // 4. Header (input file information)
+  // Header is assembled into strings here; the actual writes are performed in the write
+  // phase below, which may run on a background thread
+  std::size_t header_offset=0;
+  std::string pre_header, par_header;
   {
     std::stringstream msg;
     msg << "Athena binary output version=1.1" << std::endl
@@ -84,10 +90,8 @@ void MeshBinaryOutput::WriteOutputFile(Mesh *pm, ParameterInput *pin) {
       msg << outvars[n].label.c_str() << "  ";
     }
     msg << std::endl;
-    if (global_variable::my_rank == 0) {
-      binfile.Write_any_type(msg.str().c_str(),msg.str().size(),"byte");
-    }
-    header_offset += msg.str().size();
+    pre_header = msg.str();
+    header_offset += pre_header.size();
   }
   {
     std::stringstream msg;
@@ -96,12 +100,8 @@ void MeshBinaryOutput::WriteOutputFile(Mesh *pm, ParameterInput *pin) {
     pin->ParameterDump(ost);
     std::string sbuf=ost.str();
     msg << "  header offset=" << sbuf.size()*sizeof(char)  << std::endl;
-    if (global_variable::my_rank == 0) {
-      binfile.Write_any_type(msg.str().c_str(),msg.str().size(),"byte");
-      binfile.Write_any_type(sbuf.c_str(),sbuf.size(),"byte");
-    }
-    header_offset += sbuf.size()*sizeof(char);
-    header_offset += msg.str().size();
+    par_header = msg.str() + sbuf;
+    header_offset += par_header.size();
   }
 
   //  5. Data.  An arbitrary number of scalars and vectors can be written (every element
@@ -126,7 +126,9 @@ void MeshBinaryOutput::WriteOutputFile(Mesh *pm, ParameterInput *pin) {
   int nb_mbs = pm->nmb_eachrank[global_variable::my_rank];
 
   // allocate 1D vector of floats used to convert and output data
-  char *data = new char[nb_mbs*data_size];
+  // staging buffer for the whole rank; 2MB-aligned and huge-page backed since it
+  // can reach many GB on large runs
+  char *data = hugepage::Alloc(nb_mbs*data_size);
   float *single_data = new float[cells];
 
   // Loop over MeshBlocks
@@ -213,63 +215,97 @@ void MeshBinaryOutput::WriteOutputFile(Mesh *pm, ParameterInput *pin) {
       pdata+=cells*sizeof(float);
     }
   }
+  delete [] single_data;
 
-  // now write binary data
-  if (bin_slice) {
-    std::vector<int> rank_offset(global_variable::nranks, 0);
-    std::partial_sum(noutmbs.begin(),std::prev(noutmbs.end()),
-                     std::next(rank_offset.begin()));
-    std::size_t myoffset=header_offset+data_size*rank_offset[global_variable::my_rank];
-    if (noutmbs_min > 0) {
-      binfile.Write_any_type_at_all(data,(data_size*nout_mbs),myoffset,"byte");
-    } else {
-      if (nout_mbs > 0) {
-        binfile.Write_any_type_at(data,(data_size*nout_mbs),myoffset,"byte");
-      }
+  // Copy everything the write phase reads from the Mesh or from this class into local
+  // variables.  With 'async=true' both can be updated by the main thread (e.g. by
+  // LoadOutputData() at the next dump, or by AMR) before the writes below complete.
+  bool async_write = out_params.async;
+  int nmbs_min = noutmbs_min;
+  int nmbs_max = noutmbs_max;
+  if (!(bin_slice) && (data_size*nb_mbs > 2147483648)) {
+    // calculate max/min number of MeshBlocks across all ranks
+    nmbs_max = pm->nmb_eachrank[0];
+    nmbs_min = pm->nmb_eachrank[0];
+    for (int i=0; i<(global_variable::nranks); ++i) {
+      nmbs_max = std::max(nmbs_max,pm->nmb_eachrank[i]);
+      nmbs_min = std::min(nmbs_min,pm->nmb_eachrank[i]);
     }
-  } else {
-    // check if elements larger than 2^31
-    if (data_size*nb_mbs<=2147483648) {
-      // now write binary data in parallel
-      std::size_t myoffset=header_offset+data_size*ns_mbs;
-      binfile.Write_any_type_at_all(data,(data_size*nb_mbs),myoffset,"byte");
-    } else {
-      // write data over each MeshBlock sequentially and in parallel
-      // calculate max/min number of MeshBlocks across all ranks
-      noutmbs_max = pm->nmb_eachrank[0];
-      noutmbs_min = pm->nmb_eachrank[0];
-      for (int i=0; i<(global_variable::nranks); ++i) {
-        noutmbs_max = std::max(noutmbs_max,pm->nmb_eachrank[i]);
-        noutmbs_min = std::min(noutmbs_min,pm->nmb_eachrank[i]);
+  }
+  int nmb_thisrank = pm->nmb_thisrank;
+  std::vector<int> rank_offset(global_variable::nranks, 0);
+  std::partial_sum(noutmbs.begin(),std::prev(noutmbs.end()),
+                   std::next(rank_offset.begin()));
+#if MPI_PARALLEL_ENABLED
+  MPI_Comm write_comm = io_comm_;
+#endif
+
+  // Write phase: opens file, writes header and data, closes file, and frees the data
+  // buffer.  Runs on the background thread when 'async=true'.
+  auto write_and_close = [=]() {
+    IOWrapper binfile;
+#if MPI_PARALLEL_ENABLED
+    if (async_write) {binfile.SetCommunicator(write_comm);}
+#endif
+    binfile.Open(fname.c_str(), IOWrapper::FileMode::write);
+    if (global_variable::my_rank == 0) {
+      binfile.Write_any_type(pre_header.c_str(),pre_header.size(),"byte");
+      binfile.Write_any_type(par_header.c_str(),par_header.size(),"byte");
+    }
+
+    // now write binary data
+    if (bin_slice) {
+      std::size_t myoffset=header_offset+data_size*rank_offset[global_variable::my_rank];
+      if (nmbs_min > 0) {
+        binfile.Write_any_type_at_all(data,(data_size*nout_mbs),myoffset,"byte");
+      } else {
+        if (nout_mbs > 0) {
+          binfile.Write_any_type_at(data,(data_size*nout_mbs),myoffset,"byte");
+        }
       }
-      for (int m=0;  m<noutmbs_max; ++m) {
-        char *pdata=&(data[m*data_size]);
-        std::size_t myoffset=header_offset+data_size*ns_mbs+data_size*m;
-        // every rank has a MB to write, so write collectively
-        if (m < noutmbs_min) {
-          if (binfile.Write_any_type_at_all(pdata,(data_size),myoffset,"byte") != 1) {
-            std::cout << "### FATAL ERROR in " << __FILE__ << " at line " << __LINE__
-                << std::endl << "binary data not written correctly to binary file, "
-                << "binary file is broken." << std::endl;
-            exit(EXIT_FAILURE);
-          }
-        // some ranks are finished writing, so use non-collective write
-        } else if (m < pm->nmb_thisrank) {
-          if (binfile.Write_any_type_at(pdata,(data_size),myoffset,"byte") != 1) {
-            std::cout << "### FATAL ERROR in " << __FILE__ << " at line " << __LINE__
-                 << std::endl << "binary data not written correctly to binary file, "
-                 << "binary file is broken." << std::endl;
-            exit(EXIT_FAILURE);
+    } else {
+      // check if elements larger than 2^31
+      if (data_size*nb_mbs<=2147483648) {
+        // now write binary data in parallel
+        std::size_t myoffset=header_offset+data_size*ns_mbs;
+        binfile.Write_any_type_at_all(data,(data_size*nb_mbs),myoffset,"byte");
+      } else {
+        // write data over each MeshBlock sequentially and in parallel
+        for (int m=0;  m<nmbs_max; ++m) {
+          char *pdata=&(data[m*data_size]);
+          std::size_t myoffset=header_offset+data_size*ns_mbs+data_size*m;
+          // every rank has a MB to write, so write collectively
+          if (m < nmbs_min) {
+            if (binfile.Write_any_type_at_all(pdata,(data_size),myoffset,"byte") != 1) {
+              std::cout << "### FATAL ERROR in " << __FILE__ << " at line " << __LINE__
+                  << std::endl << "binary data not written correctly to binary file, "
+                  << "binary file is broken." << std::endl;
+              exit(EXIT_FAILURE);
+            }
+          // some ranks are finished writing, so use non-collective write
+          } else if (m < nmb_thisrank) {
+            if (binfile.Write_any_type_at(pdata,(data_size),myoffset,"byte") != 1) {
+              std::cout << "### FATAL ERROR in " << __FILE__ << " at line " << __LINE__
+                   << std::endl << "binary data not written correctly to binary file, "
+                   << "binary file is broken." << std::endl;
+              exit(EXIT_FAILURE);
+            }
           }
         }
       }
     }
-  }
 
-  // close the output file and clean up ptrs to data
-  binfile.Close();
-  delete [] data;
-  delete [] single_data;
+    // close the output file and clean up ptr to data
+    binfile.Close();
+    hugepage::Free(data);
+  };
+
+  // write in background thread (overlapping with subsequent cycles) or synchronously
+  if (async_write) {
+    iothread_ = std::thread(write_and_close);
+  } else {
+    write_and_close();
+  }
 
   // increment counters
   out_params.file_number++;
@@ -0,0 +1,329 @@
+//========================================================================================
+// AthenaXXX astrophysical plasma code
+// Copyright(C) 2020 James M. Stone <jmstone@ias.edu> and the Athena code team
+// Licensed under the 3-clause BSD License (the "LICENSE")
+//========================================================================================
+//! \file clumps.cpp
+//! \brief implements ClumpFinderOutput, an in-situ connected-component clump finder.
+//! Cells where the output variable exceeds a threshold are seeded with globally unique
+//! labels (their global cell index).  Labels are then iteratively replaced on device by
+//! the minimum over face-connected clump cells, and merged across MeshBlock (and rank)
+//! boundaries by exchanging the label field through the standard cell-centered boundary
+//! communication machinery.  On convergence every clump carries the label of its
+//! minimum member cell, and a compact catalog (cell count, mass, volume, center of
+//! mass, peak value) is appended to a single text file, replacing offline
+//! post-processing of full grid dumps.
+
+#include <cstdint>
+#include <cstdio>
+#include <cstdlib>
+#include <iostream>
+#include <map>
+#include <string>
+#include <utility>
+#include <vector>
+
+#include "athena.hpp"
+#include "globals.hpp"
+#include "coordinates/cell_locations.hpp"
+#include "mesh/mesh.hpp"
+#include "bvals/bvals.hpp"
+#include "outputs.hpp"
+
+//----------------------------------------------------------------------------------------
+// ctor: also calls BaseTypeOutput base class constructor
+
+ClumpFinderOutput::ClumpFinderOutput(ParameterInput *pin, Mesh *pm,
+                                     OutputParameters op) :
+    BaseTypeOutput(pin, pm, op) {
+  // labels are stored and exchanged as cell-centered Reals holding integer cell ids,
+  // which are only exact in double precision
+#if SINGLE_PRECISION_ENABLED
+  std::cout << "### FATAL ERROR in " << __FILE__ << " at line " << __LINE__
+            << std::endl << "clump outputs require a double precision build"
+            << std::endl;
+  std::exit(EXIT_FAILURE);
+#endif
+  // restriction/prolongation of labels across fine/coarse boundaries is not meaningful,
+  // so clump finding requires a uniform mesh
+  if (pm->multilevel) {
+    std::cout << "### FATAL ERROR in " << __FILE__ << " at line " << __LINE__
+              << std::endl << "clump outputs do not work with SMR/AMR" << std::endl;
+    std::exit(EXIT_FAILURE);
+  }
+  threshold = pin->GetReal(op.block_name, "threshold");
+
+  // label field with ghost zones for a single variable, exchanged through its own
+  // boundary-values object
+  auto &indcs = pm->mb_indcs;
+  int nmb = pm->pmb_pack->nmb_thispack;
+  int ncells1 = indcs.nx1 + 2*(indcs.ng);
+  int ncells2 = (indcs.nx2 > 1)? (indcs.nx2 + 2*(indcs.ng)) : 1;
+  int ncells3 = (indcs.nx3 > 1)? (indcs.nx3 + 2*(indcs.ng)) : 1;
+  Kokkos::realloc(labels, nmb, 1, ncells3, ncells2, ncells1);
+  pbval_lbl = new MeshBoundaryValuesCC(pm->pmb_pack, pin, false);
+  pbval_lbl->InitializeBuffers(1);
+}
+
+//----------------------------------------------------------------------------------------
+// destructor
+
+ClumpFinderOutput::~ClumpFinderOutput() {
+  delete pbval_lbl;
+}
+
+//----------------------------------------------------------------------------------------
+//! \fn void ClumpFinderOutput::LoadOutputData()
+//  \brief Labels connected components of cells above threshold and accumulates the
+//  partial clump catalog found on this rank.  Catalogs are merged and written in
+//  WriteOutputFile().
+
+void ClumpFinderOutput::LoadOutputData(Mesh *pm) {
+  // calculate derived variable, if required
+  if (out_params.contains_derived) {
+    ComputeDerivedVariable(out_params.variable, pm);
+  }
+
+  auto &indcs = pm->mb_indcs;
+  int is = indcs.is; int ie = indcs.ie;
+  int js = indcs.js; int je = indcs.je;
+  int ks = indcs.ks; int ke = indcs.ke;
+  int nx1 = indcs.nx1, nx2 = indcs.nx2, nx3 = indcs.nx3;
+  int nmb = pm->pmb_pack->nmb_thispack;
+  bool &multi_d = pm->multi_d;
+  bool &three_d = pm->three_d;
+  auto gids = pm->pmb_pack->gids;
+
+  // quantity used for thresholding and mass weighting (single variable selected with
+  // 'variable' in the input block, cf. PDF outputs)
+  auto dvar = Kokkos::subview(*(outvars[0].data_ptr), Kokkos::ALL,
+                              outvars[0].data_index, Kokkos::ALL, Kokkos::ALL,
+                              Kokkos::ALL);
+
+  // seed: every cell above threshold gets a globally unique label equal to its global
+  // cell index; all other cells (and all ghosts) get -1.  Labels are computed in Real
+  // arithmetic since cell counts can overflow 32-bit ints
+  auto &lbl = labels;
+  Real thresh = threshold;
+  Kokkos::deep_copy(labels, -1.0);
+  par_for("clump_seed",DevExeSpace(),0,nmb-1,ks,ke,js,je,is,ie,
+  KOKKOS_LAMBDA(int m, int k, int j, int i) {
+    if (dvar(m,k,j,i) > thresh) {
+      lbl(m,0,k,j,i) = ((static_cast<Real>(gids+m)*nx3 + (k-ks))*nx2
+                        + (j-js))*nx1 + (i-is);
+    }
+  });
+
+  // Iterate: propagate minimum labels within this pack until settled, exchange labels
+  // with neighboring MeshBlocks, and repeat until no label changes on any rank.  The
+  // sweeps update labels in place; races between cells only delay propagation since
+  // any value read is a valid label of a connected cell, so convergence does not
+  // depend on ordering.
+  DvceArray1D<int> chg("clump_chg", 1);
+  auto chg_h = Kokkos::create_mirror_view(chg);
+  int glob_changed = 1;
+  while (glob_changed != 0) {
+    // propagate minimum labels over face-connected cells within this pack
+    int local_changed = 1;
+    while (local_changed != 0) {
+      Kokkos::deep_copy(chg, 0);
+      par_for("clump_sweep",DevExeSpace(),0,nmb-1,ks,ke,js,je,is,ie,
+      KOKKOS_LAMBDA(int m, int k, int j, int i) {
+        Real l = lbl(m,0,k,j,i);
+        if (l < 0.0) {return;}
+        Real lmin = l;
+        Real ln;
+        ln = lbl(m,0,k,j,i-1); if ((ln >= 0.0) && (ln < lmin)) {lmin = ln;}
+        ln = lbl(m,0,k,j,i+1); if ((ln >= 0.0) && (ln < lmin)) {lmin = ln;}
+        if (multi_d) {
+          ln = lbl(m,0,k,j-1,i); if ((ln >= 0.0) && (ln < lmin)) {lmin = ln;}
+          ln = lbl(m,0,k,j+1,i); if ((ln >= 0.0) && (ln < lmin)) {lmin = ln;}
+        }
+        if (three_d) {
+          ln = lbl(m,0,k-1,j,i); if ((ln >= 0.0) && (ln < lmin)) {lmin = ln;}
+          ln = lbl(m,0,k+1,j,i); if ((ln >= 0.0) && (ln < lmin)) {lmin = ln;}
+        }
+        if (lmin < l) {
+          lbl(m,0,k,j,i) = lmin;
+          chg(0) = 1;  // benign write race: all writers store the same value
+        }
+      });
+      Kokkos::deep_copy(chg_h, chg);
+      local_changed = chg_h(0);
+    }
+
+    // exchange boundary labels with neighboring MeshBlocks (including other ranks)
+    (void) pbval_lbl->InitRecv(1);
+    (void) pbval_lbl->PackAndSendCC(labels, coarse_labels);
+    TaskStatus tstat = TaskStatus::incomplete;
+    while (tstat != TaskStatus::complete) {
+      tstat = pbval_lbl->RecvAndUnpackCC(labels, coarse_labels);
+    }
+    (void) pbval_lbl->ClearSend();
+    (void) pbval_lbl->ClearRecv();
+
+    // fold received ghost labels in with one more sweep; if that changes nothing on
+    // any rank, labels are final
+    Kokkos::deep_copy(chg, 0);
+    par_for("clump_fold",DevExeSpace(),0,nmb-1,ks,ke,js,je,is,ie,
+    KOKKOS_LAMBDA(int m, int k, int j, int i) {
+      Real l = lbl(m,0,k,j,i);
+      if (l < 0.0) {return;}
+      Real lmin = l;
+      Real ln;
+      ln = lbl(m,0,k,j,i-1); if ((ln >= 0.0) && (ln < lmin)) {lmin = ln;}
+      ln = lbl(m,0,k,j,i+1); if ((ln >= 0.0) && (ln < lmin)) {lmin = ln;}
+      if (multi_d) {
+        ln = lbl(m,0,k,j-1,i); if ((ln >= 0.0) && (ln < lmin)) {lmin = ln;}
+        ln = lbl(m,0,k,j+1,i); if ((ln >= 0.0) && (ln < lmin)) {lmin = ln;}
+      }
+      if (three_d) {
+        ln = lbl(m,0,k-1,j,i); if ((ln >= 0.0) && (ln < lmin)) {lmin = ln;}
+        ln = lbl(m,0,k+1,j,i); if ((ln >= 0.0) && (ln < lmin)) {lmin = ln;}
+      }
+      if (lmin < l) {
+        lbl(m,0,k,j,i) = lmin;
+        chg(0) = 1;  // benign write race: all writers store the same value
+      }
+    });
+    Kokkos::deep_copy(chg_h, chg);
+    glob_changed = chg_h(0);
+#if MPI_PARALLEL_ENABLED
+    MPI_Allreduce(MPI_IN_PLACE, &glob_changed, 1, MPI_INT, MPI_MAX, MPI_COMM_WORLD);
+#endif
+  }
+
+  // accumulate partial clump properties over cells on this rank, keyed by label.
+  // Clump cells are sparse, so a host map over flagged cells is cheap compared to
+  // writing and post-processing a full grid dump
+  auto lbl_h = Kokkos::create_mirror_view(labels);
+  Kokkos::deep_copy(lbl_h, labels);
+  auto dvar_h = Kokkos::create_mirror_view(dvar);
+  Kokkos::deep_copy(dvar_h, dvar);
+  auto &size = pm->pmb_pack->pmb->mb_size;
+
+  catalog.clear();
+  for (int m=0; m<nmb; ++m) {
+    Real &x1min = size.h_view(m).x1min, &x1max = size.h_view(m).x1max;
+    Real &x2min = size.h_view(m).x2min, &x2max = size.h_view(m).x2max;
+    Real &x3min = size.h_view(m).x3min, &x3max = size.h_view(m).x3max;
+    Real vol = (size.h_view(m).dx1)*(size.h_view(m).dx2)*(size.h_view(m).dx3);
+    for (int k=ks; k<=ke; ++k) {
+      for (int j=js; j<=je; ++j) {
+        for (int i=is; i<=ie; ++i) {
+          Real l = lbl_h(m,0,k,j,i);
+          if (l < 0.0) {continue;}
+          ClumpData &c = catalog[static_cast<std::int64_t>(l)];
+          Real d = dvar_h(m,k,j,i);
+          c.ncells += 1;
+          c.mass += d*vol;
+          c.vol += vol;
+          c.x1 += d*vol*CellCenterX(i-is, nx1, x1min, x1max);
+          c.x2 += d*vol*CellCenterX(j-js, nx2, x2min, x2max);
+          c.x3 += d*vol*CellCenterX(k-ks, nx3, x3min, x3max);
+          if (d > c.dmax) {c.dmax = d;}
+        }
+      }
+    }
+  }
+  return;
+}
+
+//----------------------------------------------------------------------------------------
+//! \fn void ClumpFinderOutput::WriteOutputFile()
+//  \brief Merges partial catalogs across ranks and appends the clump catalog for this
+//  analysis time to a single text file.  Clumps spanning rank boundaries appear in
+//  several partial catalogs with the same label and are summed here.
+
+void ClumpFinderOutput::WriteOutputFile(Mesh *pm, ParameterInput *pin) {
+  std::map<std::int64_t, ClumpData> merged;
+
+#if MPI_PARALLEL_ENABLED
+  // pack partial catalog into flat records and gather on master rank
+  const int nfld = 8;  // fields per catalog record
+  std::vector<Real> sendrec;
+  for (auto &c : catalog) {
+    sendrec.push_back(static_cast<Real>(c.first));
+    sendrec.push_back(static_cast<Real>(c.second.ncells));
+    sendrec.push_back(c.second.mass);
+    sendrec.push_back(c.second.vol);
+    sendrec.push_back(c.second.x1);
+    sendrec.push_back(c.second.x2);
+    sendrec.push_back(c.second.x3);
+    sendrec.push_back(c.second.dmax);
+  }
+  int nsend = static_cast<int>(sendrec.size());
+  int nranks = global_variable::nranks;
+  std::vector<int> counts(nranks, 0), displs(nranks, 0);
+  MPI_Gather(&nsend, 1, MPI_INT, counts.data(), 1, MPI_INT, 0, MPI_COMM_WORLD);
+  int ntotal = 0;
+  if (global_variable::my_rank == 0) {
+    for (int r=0; r<nranks; ++r) {
+      displs[r] = ntotal;
+      ntotal += counts[r];
+    }
+  }
+  std::vector<Real> recvrec(ntotal);
+  MPI_Gatherv(sendrec.data(), nsend, MPI_ATHENA_REAL, recvrec.data(), counts.data(),
+              displs.data(), MPI_ATHENA_REAL, 0, MPI_COMM_WORLD);
+
+  if (global_variable::my_rank == 0) {
+    for (int n=0; n<ntotal; n+=nfld) {
+      ClumpData &c = merged[static_cast<std::int64_t>(recvrec[n])];
+      c.ncells += static_cast<int>(recvrec[n+1]);
+      c.mass += recvrec[n+2];
+      c.vol += recvrec[n+3];
+      c.x1 += recvrec[n+4];
+      c.x2 += recvrec[n+5];
+      c.x3 += recvrec[n+6];
+      if (recvrec[n+7] > c.dmax) {c.dmax = recvrec[n+7];}
+    }
+  }
+#else
+  merged = catalog;
+#endif
+
+  // only the master rank writes the catalog file
+  if (global_variable::my_rank == 0) {
+    // create filename: "file_basename" + "." + "file_id" + ".clump"
+    // There is only one clump catalog file; records are appended per analysis time
+    std::string fname;
+    fname.assign(out_params.file_basename);
+    fname.append(".");
+    fname.append(out_params.file_id);
+    fname.append(".clump");
+
+    FILE *pfile;
+    if ((pfile = std::fopen(fname.c_str(),"a")) == nullptr) {
+      std::cout << "### FATAL ERROR in " << __FILE__ << " at line " << __LINE__
+        << std::endl << "Output file '" << fname << "' could not be opened" <<std::endl;
+      exit(EXIT_FAILURE);
+    }
+
+    std::fprintf(pfile, "# time=");
+    std::fprintf(pfile, out_params.data_format.c_str(), pm->time);
+    std::fprintf(pfile, "  nclump= %d\n", static_cast<int>(merged.size()));
+    std::fprintf(pfile, "# [1]=label [2]=ncells [3]=mass [4]=volume [5]=x1com "
+                        "[6]=x2com [7]=x3com [8]=max\n");
+    for (auto &c : merged) {
+      std::fprintf(pfile, " %ld %d", static_cast<long>(c.first), c.second.ncells);
+      std::fprintf(pfile, out_params.data_format.c_str(), c.second.mass);
+      std::fprintf(pfile, out_params.data_format.c_str(), c.second.vol);
+      std::fprintf(pfile, out_params.data_format.c_str(), c.second.x1/c.second.mass);
+      std::fprintf(pfile, out_params.data_format.c_str(), c.second.x2/c.second.mass);
+      std::fprintf(pfile, out_params.data_format.c_str(), c.second.x3/c.second.mass);
+      std::fprintf(pfile, out_params.data_format.c_str(), c.second.dmax);
+      std::fprintf(pfile, "\n");
+    }
+    std::fclose(pfile);
+  }
+
+  // increment counters
+  if (out_params.last_time < 0.0) {
+    out_params.last_time = pm->time;
+  } else {
+    out_params.last_time += out_params.dt;
+  }
+  pin->SetReal(out_params.block_name, "last_time", out_params.last_time);
+  return;
+}
@@ -16,15 +16,18 @@
 #include <numeric>
 #include <sstream>
 #include <string>
+#include <thread>
 #include <vector>
-#include <utility>
 #include <algorithm>
 
 #include "athena.hpp"
 #include "globals.hpp"
 #include "coordinates/cell_locations.hpp"
 #include "mesh/mesh.hpp"
+#include "hydro/hydro.hpp"
+#include "mhd/mhd.hpp"
 #include "outputs.hpp"
+#include "utils/hugepage.hpp"
 
 //----------------------------------------------------------------------------------------
 // Constructor: also calls BaseTypeOutput base class constructor
@@ -42,6 +45,31 @@ CoarsenedBinaryOutput::CoarsenedBinaryOutput(ParameterInput *pin, Mesh *pm,
   dir_name.append("_");
   dir_name.append(std::to_string(out_params.coarsen_factor));
   mkdir(dir_name.c_str(),0775);
+
+  // preview mode reads the SMR/AMR coarse arrays in place of averaging the fine grid,
+  // so it is tied to the 2x coarsening of those arrays and needs them to be allocated
+  if (out_params.preview) {
+    if (out_params.coarsen_factor != 2) {
+      std::cout << "### FATAL ERROR in " << __FILE__ << " at line " << __LINE__
+                << std::endl << "preview=true requires coarsen_factor=2 in output "
+                << "block '" << out_params.block_name << "'" << std::endl;
+      exit(EXIT_FAILURE);
+    }
+    if (!(pm->multilevel)) {
+      std::cout << "### FATAL ERROR in " << __FILE__ << " at line " << __LINE__
+                << std::endl << "preview=true requires a multilevel (SMR/AMR) mesh "
+                << "in output block '" << out_params.block_name << "'" << std::endl;
+      exit(EXIT_FAILURE);
+    }
+    if (out_params.compute_moments || out_params.include_gzs ||
+        out_params.slice1 || out_params.slice2 || out_params.slice3) {
+      std::cout << "### FATAL ERROR in " << __FILE__ << " at line " << __LINE__
+                << std::endl << "preview=true cannot be combined with moments, "
+                << "ghost zones, or slicing in output block '"
+                << out_params.block_name << "'" << std::endl;
+      exit(EXIT_FAILURE);
+    }
+  }
 }
 
 //----------------------------------------------------------------------------------------
@@ -156,128 +184,134 @@ void CoarsenedBinaryOutput::LoadOutputData(Mesh *pm) {
     Kokkos::realloc(outarray, nout_vars_with_moments, nout_mbs, nout3, nout2, nout1);
   }
 
-  // Calculate derived variables, if required
-  if (out_params.contains_derived) {
+  // Calculate derived variables, if required (already done if the shared-snapshot
+  // service has redirected outvars at its shadow buffer)
+  if (out_params.contains_derived && snap_srcs.empty()) {
     ComputeDerivedVariable(out_params.variable, pm);
   }
 
-  // Now copy data to host (outarray) over all variables and MeshBlocks
-  for (int n=0; n<nout_vars; ++n) {
+  // Now coarsen data on device and copy to host (outarray) over all variables and
+  // MeshBlocks.  Each (coarsen_factor)^3 block of fine cells is volume-averaged into one
+  // coarse cell in a single pass directly from the output variable arrays, so only the
+  // reduced data (smaller by coarsen_factor^3) is ever transferred off the device
+  if (nout_mbs > 0) {
+    int cf = out_params.coarsen_factor;
+    int nout1 = (outmbs[0].oie - outmbs[0].ois + 1);
+    int nout2 = (outmbs[0].oje - outmbs[0].ojs + 1);
+    int nout3 = (outmbs[0].oke - outmbs[0].oks + 1);
+    if (nout1 % cf != 0 || nout2 % cf != 0 || nout3 % cf != 0) {
+      std::cout << "### FATAL ERROR in " << __FILE__ << " at line " << __LINE__
+                << std::endl << "Output MeshBlock dimensions must be evenly divisible "
+                << "by coarsening factor" << std::endl;
+      std::exit(EXIT_FAILURE);
+    }
+    int cnout1 = nout1/cf;
+    int cnout2 = nout2/cf;
+    int cnout3 = nout3/cf;
+
+    // build device-visible table of pack index and starting indices of each output MB
+    DualArray2D<int> outmb_idcs("outmb_idcs", nout_mbs, 4);
     for (int m=0; m<nout_mbs; ++m) {
-      int mbi = pm->FindMeshBlockIndex(outmbs[m].mb_gid);
-      std::pair<int,int> irange = std::make_pair(outmbs[m].ois, outmbs[m].oie+1);
-      std::pair<int,int> jrange = std::make_pair(outmbs[m].ojs, outmbs[m].oje+1);
-      std::pair<int,int> krange = std::make_pair(outmbs[m].oks, outmbs[m].oke+1);
-      std::pair<int,int> moment_range;
-      if (out_params.compute_moments) {
-        moment_range = std::make_pair(n*4, n*4+4);
-      } else {
-        moment_range = std::make_pair(n, n+1);
-      }
-      int nout1 = (outmbs[0].oie - outmbs[0].ois + 1);
-      int nout2 = (outmbs[0].oje - outmbs[0].ojs + 1);
-      int nout3 = (outmbs[0].oke - outmbs[0].oks + 1);
-      int coarsened_nout1 = nout1/out_params.coarsen_factor;
-      int coarsened_nout2 = nout2/out_params.coarsen_factor;
-      int coarsened_nout3 = nout3/out_params.coarsen_factor;
-
-      // copy output variable to new device View
-      DvceArray3D<Real> d_output_var("d_out_var",nout3,nout2,nout1);
-      auto d_slice = Kokkos::subview(*(outvars[n].data_ptr), mbi, outvars[n].data_index,
-                                     krange,jrange,irange);
-      Kokkos::deep_copy(d_output_var,d_slice);
-      Kokkos::fence(); // Ensure complete copy
-
-
-      int number_of_moments = 1;
-      if (out_params.compute_moments) {
-        number_of_moments = 4;
-      }
-      DvceArray4D<Real> d_output_var_coarsened("d_output_var_coarsened",
-        number_of_moments, coarsened_nout3, coarsened_nout2, coarsened_nout1);
-
-      // Coarsen the d_slice and store the result in d_output_var
-      // CoarsenVariable(d_output_var, d_output_var_coarsened, out_params.coarsen_factor);
-      int coarsen_factor = out_params.coarsen_factor;
-      int coarsen_factor_cubed = coarsen_factor * coarsen_factor * coarsen_factor;
-
-      if (nout1 % coarsen_factor != 0 || nout2 % coarsen_factor != 0
-                                      || nout3 % coarsen_factor != 0) {
-          std::cout << "Error: Full data dimensions are not divisible by coarsen_factor"
-          << std::endl;
+      outmb_idcs.h_view(m,0) = pm->FindMeshBlockIndex(outmbs[m].mb_gid);
+      outmb_idcs.h_view(m,1) = outmbs[m].ois;
+      outmb_idcs.h_view(m,2) = outmbs[m].ojs;
+      outmb_idcs.h_view(m,3) = outmbs[m].oks;
+    }
+    outmb_idcs.template modify<HostMemSpace>();
+    outmb_idcs.template sync<DevExeSpace>();
+
+    // device View holding coarsened data (and moments) for all variables and MBs
+    DvceArray5D<Real> coarse_data("coarse_data", nout_vars_with_moments, nout_mbs,
+                                  cnout3, cnout2, cnout1);
+
+    bool compute_moments = out_params.compute_moments;
+    Real cf_cubed_inv = 1.0/(static_cast<Real>(cf*cf*cf));
+    if (out_params.preview) {
+      // preview mode: read the SMR/AMR coarse arrays directly instead of averaging the
+      // fine grid.  Boundary comms only restrict interface regions each stage, so the
+      // interiors are refreshed with the full-volume restriction first; only the
+      // 8x-reduced data is then formed and copied off the device.  Overwriting the
+      // coarse arrays here is safe since every region consumed by prolongation is
+      // refilled by the boundary communication tasks before its next use
+      hydro::Hydro *phyd = pm->pmb_pack->phydro;
+      mhd::MHD *pmhd = pm->pmb_pack->pmhd;
+      MeshRefinement *pmr = pm->pmr;
+      int cis = indcs.cis, cjs = indcs.cjs, cks = indcs.cks;
+      bool fresh_hyd_u=false, fresh_hyd_w=false, fresh_mhd_u=false, fresh_mhd_w=false;
+      for (int n=0; n<nout_vars; ++n) {
+        DvceArray5D<Real> *pcvar = nullptr;
+        if ((phyd != nullptr) && (outvars[n].data_ptr == &(phyd->u0))) {
+          if (!fresh_hyd_u) {pmr->RestrictCC(phyd->u0, phyd->coarse_u0, false, false);}
+          fresh_hyd_u = true;
+          pcvar = &(phyd->coarse_u0);
+        } else if ((phyd != nullptr) && (outvars[n].data_ptr == &(phyd->w0))) {
+          if (!fresh_hyd_w) {pmr->RestrictCC(phyd->w0, phyd->coarse_w0, false, false);}
+          fresh_hyd_w = true;
+          pcvar = &(phyd->coarse_w0);
+        } else if ((pmhd != nullptr) && (outvars[n].data_ptr == &(pmhd->u0))) {
+          if (!fresh_mhd_u) {pmr->RestrictCC(pmhd->u0, pmhd->coarse_u0, false, false);}
+          fresh_mhd_u = true;
+          pcvar = &(pmhd->coarse_u0);
+        } else if ((pmhd != nullptr) && (outvars[n].data_ptr == &(pmhd->w0))) {
+          if (!fresh_mhd_w) {pmr->RestrictCC(pmhd->w0, pmhd->coarse_w0, false, false);}
+          fresh_mhd_w = true;
+          pcvar = &(pmhd->coarse_w0);
+        } else {
+          std::cout << "### FATAL ERROR in " << __FILE__ << " at line " << __LINE__
+                    << std::endl << "preview=true only supports cell-centered "
+                    << "hydro/mhd conserved and primitive variables" << std::endl;
           exit(EXIT_FAILURE);
+        }
+        auto &cvar = *pcvar;
+        int vidx = outvars[n].data_index;
+        par_for("cbin_preview", DevExeSpace(), 0, nout_mbs-1, 0, cnout3-1,
+                                                0, cnout2-1, 0, cnout1-1,
+        KOKKOS_LAMBDA(int m, int ck, int cj, int ci) {
+          int mbi = outmb_idcs.d_view(m,0);
+          coarse_data(n,m,ck,cj,ci) = cvar(mbi, vidx, cks+ck, cjs+cj, cis+ci);
+        });
       }
-
-      int total_iterations = coarsened_nout3
-        * coarsened_nout2 * coarsened_nout1 * coarsen_factor_cubed;
-
-      bool compute_moments = out_params.compute_moments;
-      Kokkos::parallel_for("coarsen_variable",
-       Kokkos::RangePolicy<DevExeSpace>(0, total_iterations),
-      KOKKOS_LAMBDA(const int idx) {
-        // Calculate the 3D indices for the coarsened data
-        int total_coarsened_elements = coarsened_nout1*coarsened_nout2*coarsened_nout3;
-        int k_c = (idx / (coarsened_nout2 * coarsened_nout1)) % coarsened_nout3;
-        int j_c = (idx / coarsened_nout1) % coarsened_nout2;
-        int i_c = idx % coarsened_nout1;
-
-        // Calculate the offset within the coarsen_factor_cubed cube
-        int offset = idx / total_coarsened_elements;
-        int kk = offset / (coarsen_factor * coarsen_factor);
-        int jj = (offset / coarsen_factor) % coarsen_factor;
-        int ii = offset % coarsen_factor;
-
-        // Calculate the corresponding indices in the full data
-        int k = k_c * coarsen_factor + kk;
-        int j = j_c * coarsen_factor + jj;
-        int i = i_c * coarsen_factor + ii;
-
-        // Perform the coarsening operation
-        if(k < nout3 && j < nout2 && i < nout1) {
-          Kokkos::atomic_add(&d_output_var_coarsened(0, k_c, j_c, i_c),
-            d_output_var(k, j, i));
+    } else {
+      for (int n=0; n<nout_vars; ++n) {
+        auto &var = *(outvars[n].data_ptr);
+        int vidx = outvars[n].data_index;
+        int nc = (compute_moments)? 4*n : n;
+        // accumulate sums over the fine cells under each coarse cell in thread-private
+        // registers and normalize, with no atomics and no intermediate full-res copies
+        par_for("cbin_coarsen", DevExeSpace(), 0, nout_mbs-1, 0, cnout3-1,
+                                                0, cnout2-1, 0, cnout1-1,
+        KOKKOS_LAMBDA(int m, int ck, int cj, int ci) {
+          int mbi = outmb_idcs.d_view(m,0);
+          int fi = outmb_idcs.d_view(m,1) + ci*cf;
+          int fj = outmb_idcs.d_view(m,2) + cj*cf;
+          int fk = outmb_idcs.d_view(m,3) + ck*cf;
+          Real s1=0.0, s2=0.0, s3=0.0, s4=0.0;
+          for (int kk=0; kk<cf; ++kk) {
+            for (int jj=0; jj<cf; ++jj) {
+              for (int ii=0; ii<cf; ++ii) {
+                Real val = var(mbi, vidx, fk+kk, fj+jj, fi+ii);
+                s1 += val;
+                if (compute_moments) {
+                  s2 += val*val;
+                  s3 += val*val*val;
+                  s4 += val*val*val*val;
+                }
+              }
+            }
+          }
+          coarse_data(nc,m,ck,cj,ci) = s1*cf_cubed_inv;
           if (compute_moments) {
-            Kokkos::atomic_add(&d_output_var_coarsened(1, k_c, j_c, i_c),
-              d_output_var(k, j, i)*d_output_var(k, j, i));
-            Kokkos::atomic_add(&d_output_var_coarsened(2, k_c, j_c, i_c),
-              d_output_var(k, j, i)*d_output_var(k, j, i)*d_output_var(k, j, i));
-            Kokkos::atomic_add(&d_output_var_coarsened(3, k_c, j_c, i_c),
-               d_output_var(k, j, i)*d_output_var(k, j, i)
-              *d_output_var(k, j, i)*d_output_var(k, j, i));
+            coarse_data(nc+1,m,ck,cj,ci) = s2*cf_cubed_inv;
+            coarse_data(nc+2,m,ck,cj,ci) = s3*cf_cubed_inv;
+            coarse_data(nc+3,m,ck,cj,ci) = s4*cf_cubed_inv;
           }
-        }
-      });
-      // Normalize the coarsened data
-      int normalize_iterations = number_of_moments * coarsened_nout3
-                                * coarsened_nout2 * coarsened_nout1;
-      Kokkos::parallel_for("normalize_coarsened_variable",
-        Kokkos::RangePolicy<DevExeSpace>(0, normalize_iterations),
-      KOKKOS_LAMBDA(const int idx) {
-        int moment_idx = idx / (coarsened_nout3 * coarsened_nout2 * coarsened_nout1);
-        int k = (idx / (coarsened_nout2 * coarsened_nout1)) % coarsened_nout3;
-        int j = (idx / coarsened_nout1) % coarsened_nout2;
-        int i = idx % coarsened_nout1;
-
-        d_output_var_coarsened(moment_idx, k, j, i) /= coarsen_factor_cubed;
-      });
-
-
-      // Now, create a host mirror for the coarsened data.
-      DvceArray4D<Real>::HostMirror h_output_var = Kokkos::create_mirror(
-        d_output_var_coarsened
-      );
-
-      // Copy the coarsened data to the host mirror.
-      Kokkos::deep_copy(h_output_var, d_output_var_coarsened);
-      Kokkos::fence(); // Ensure complete copy before using h_output_var on the host
-
-      // copy host mirror to 5D host View containing all output variables
-      // if (out_params.compute_moments) {
-      auto h_slice = Kokkos::subview(outarray,
-        moment_range,m,Kokkos::ALL,Kokkos::ALL,Kokkos::ALL
-      );
-      Kokkos::deep_copy(h_slice,h_output_var);
+        });
+      }
     }
+
+    // single device-to-host copy of the coarsened data only
+    Kokkos::deep_copy(outarray, coarse_data);
+    Kokkos::fence(); // Ensure complete copy
   }
 }
 
@@ -287,8 +321,9 @@ void CoarsenedBinaryOutput::LoadOutputData(Mesh *pm) {
 //   All MeshBlocks are written to the same file.
 
 void CoarsenedBinaryOutput::WriteOutputFile(Mesh *pm, ParameterInput *pin) {
-  // check if slicing
-  bool bin_slice = (out_params.slice1 || out_params.slice2 || out_params.slice3);
+  // With 'async=true' writes of the previous dump may still be in flight on the
+  // background thread; wait for them to finish before starting a new dump
+  FenceAsyncWrite();
 
   // create filename: "cbin_"+"file_id"+"_"+"coarsening_factor"+"/file_basename"
   // + "." + "file_id" + "." + XXXXX + ".cbin"
@@ -309,10 +344,6 @@ void CoarsenedBinaryOutput::WriteOutputFile(Mesh *pm, ParameterInput *pin) {
   fname.append(number);
   fname.append(".cbin");
 
-  IOWrapper cbinfile;
-  std::size_t header_offset=0;
-  cbinfile.Open(fname.c_str(), IOWrapper::FileMode::write);
-
   int number_of_moments = 1;
   if (out_params.compute_moments) {
     number_of_moments = 4;
@@ -323,48 +354,50 @@ void CoarsenedBinaryOutput::WriteOutputFile(Mesh *pm, ParameterInput *pin) {
   // 2. Current time
   // 3. List of variables in the file
   // 4. Header (input file information)
-  {std::stringstream msg;
-  msg << "Athena binary output version=1.1" << std::endl
-      // preheader size includes "size of preheader" line up to "number of variables"
-      << "  size of preheader=7" << std::endl
-      << "  time=" << pm->time << std::endl
-      << "  cycle=" << pm->ncycle << std::endl
-      << "  number of moments=" << number_of_moments << std::endl
-      << "  coarsening factor=" << out_params.coarsen_factor << std::endl
-      << "  size of location=" << sizeof(Real) << std::endl
-      << "  size of variable=" << sizeof(float) << std::endl
-      << "  number of variables=" << outvars.size()*number_of_moments << std::endl
-      << "  variables:  ";
-  if (out_params.compute_moments) {
-    // need to write the label for each of the 4 moments
-    for (int n=0; n<outvars.size(); n++) {
-      msg << outvars[n].label.c_str() << "_1st  ";
-      msg << outvars[n].label.c_str() << "_2nd  ";
-      msg << outvars[n].label.c_str() << "_3rd  ";
-      msg << outvars[n].label.c_str() << "_4th  ";
-    }
-  } else {
-    for (int n=0; n<outvars.size(); n++) {
-      msg << outvars[n].label.c_str() << "  ";
+  // Header is assembled into strings here; the actual writes are performed in the write
+  // phase below, which may run on a background thread
+  std::size_t header_offset=0;
+  std::string pre_header, par_header;
+  {
+    std::stringstream msg;
+    msg << "Athena binary output version=1.1" << std::endl
+        // preheader size includes "size of preheader" line up to "number of variables"
+        << "  size of preheader=7" << std::endl
+        << "  time=" << pm->time << std::endl
+        << "  cycle=" << pm->ncycle << std::endl
+        << "  number of moments=" << number_of_moments << std::endl
+        << "  coarsening factor=" << out_params.coarsen_factor << std::endl
+        << "  size of location=" << sizeof(Real) << std::endl
+        << "  size of variable=" << sizeof(float) << std::endl
+        << "  number of variables=" << outvars.size()*number_of_moments << std::endl
+        << "  variables:  ";
+    if (out_params.compute_moments) {
+      // need to write the label for each of the 4 moments
+      for (int n=0; n<outvars.size(); n++) {
+        msg << outvars[n].label.c_str() << "_1st  ";
+        msg << outvars[n].label.c_str() << "_2nd  ";
+        msg << outvars[n].label.c_str() << "_3rd  ";
+        msg << outvars[n].label.c_str() << "_4th  ";
+      }
+    } else {
+      for (int n=0; n<outvars.size(); n++) {
+        msg << outvars[n].label.c_str() << "  ";
+      }
     }
+    msg << std::endl;
+    pre_header = msg.str();
+    header_offset += pre_header.size();
   }
-  msg << std::endl;
-  if (global_variable::my_rank == 0) {
-    cbinfile.Write_any_type(msg.str().c_str(),msg.str().size(), "byte");
+  {
+    std::stringstream msg;
+    // prepare the input parameters
+    std::stringstream ost;
+    pin->ParameterDump(ost);
+    std::string sbuf=ost.str();
+    msg << "  header offset=" << sbuf.size()*sizeof(char)  << std::endl;
+    par_header = msg.str() + sbuf;
+    header_offset += par_header.size();
   }
-  header_offset += msg.str().size();}
-  {std::stringstream msg;
-  // prepare the input parameters
-  std::stringstream ost;
-  pin->ParameterDump(ost);
-  std::string sbuf=ost.str();
-  msg << "  header offset=" << sbuf.size()*sizeof(char)  << std::endl;
-  if (global_variable::my_rank == 0) {
-    cbinfile.Write_any_type(msg.str().c_str(),msg.str().size(), "byte");
-    cbinfile.Write_any_type(sbuf.c_str(),sbuf.size(), "byte");
-  }
-  header_offset += sbuf.size()*sizeof(char);
-  header_offset += msg.str().size();}
 
   //  5. Data.  An arbitrary number of scalars and vectors can be written (every node
   //  in the OutputData doubly linked lists), all in binary floats format
@@ -374,10 +407,14 @@ void CoarsenedBinaryOutput::WriteOutputFile(Mesh *pm, ParameterInput *pin) {
     nout_vars *= 4;
   }
   int nout_mbs = outmbs.size();
-  int nout1 = ((outmbs[0].oie - outmbs[0].ois + 1)/out_params.coarsen_factor);
-  int nout2 = ((outmbs[0].oje - outmbs[0].ojs + 1)/out_params.coarsen_factor);
-  int nout3 = ((outmbs[0].oke - outmbs[0].oks + 1)/out_params.coarsen_factor);
-  int cells = nout1*nout2*nout3;
+  int nout1 = 0, nout2 = 0, nout3 = 0;
+  int cells = 0;
+  if (nout_mbs > 0) {
+    nout1 = ((outmbs[0].oie - outmbs[0].ois + 1)/out_params.coarsen_factor);
+    nout2 = ((outmbs[0].oje - outmbs[0].ojs + 1)/out_params.coarsen_factor);
+    nout3 = ((outmbs[0].oke - outmbs[0].oks + 1)/out_params.coarsen_factor);
+    cells = nout1*nout2*nout3;
+  }
 
 
   // ois, oie, ojs, oje, oks, oke + il1, il2, il3, level +
@@ -389,7 +426,9 @@ void CoarsenedBinaryOutput::WriteOutputFile(Mesh *pm, ParameterInput *pin) {
   int nb_mbs = pm->nmb_eachrank[global_variable::my_rank];
 
   // allocate 1D vector of floats used to convert and output data
-  char *data = new char[nb_mbs*data_size];
+  // staging buffer for the whole rank; 2MB-aligned and huge-page backed since it
+  // can reach many GB on large runs
+  char *data = hugepage::Alloc(nb_mbs*data_size);
   float *single_data = new float[cells];
 
   // Loop over MeshBlocks
@@ -481,33 +520,54 @@ void CoarsenedBinaryOutput::WriteOutputFile(Mesh *pm, ParameterInput *pin) {
       pdata+=cells*sizeof(float);
     }
   }
+  delete [] single_data;
 
-  // now write Coarsenedbinary data
-  // check if elements larger than 2^31
-  if (data_size*nb_mbs<=2147483648) {
-    // now write Coarsenedbinary data in parallel
-    std::size_t myoffset=header_offset+data_size*ns_mbs;
-    cbinfile.Write_any_type_at_all(data,(data_size*nb_mbs),myoffset,"byte");
-  } else {
+  // Copy everything the write phase reads from the Mesh or from this class into local
+  // variables.  With 'async=true' both can be updated by the main thread (e.g. by
+  // LoadOutputData() at the next dump, or by AMR) before the writes below complete.
+  bool async_write = out_params.async;
+  int nmbs_min = noutmbs_min;
+  int nmbs_max = noutmbs_max;
+  if (data_size*nb_mbs > 2147483648) {
+    // calculate max/min number of MeshBlocks across all ranks
+    nmbs_max = pm->nmb_eachrank[0];
+    nmbs_min = pm->nmb_eachrank[0];
+    for (int i=0; i<(global_variable::nranks); ++i) {
+      nmbs_max = std::max(nmbs_max,pm->nmb_eachrank[i]);
+      nmbs_min = std::min(nmbs_min,pm->nmb_eachrank[i]);
+    }
+  }
+  int nmb_thisrank = pm->nmb_thisrank;
+#if MPI_PARALLEL_ENABLED
+  MPI_Comm write_comm = io_comm_;
+#endif
+
+  // Write phase: opens file, writes header and data, closes file, and frees the data
+  // buffer.  Runs on the background thread when 'async=true'.
+  auto write_and_close = [=]() {
+    IOWrapper cbinfile;
+#if MPI_PARALLEL_ENABLED
+    if (async_write) {cbinfile.SetCommunicator(write_comm);}
+#endif
+    cbinfile.Open(fname.c_str(), IOWrapper::FileMode::write);
+    if (global_variable::my_rank == 0) {
+      cbinfile.Write_any_type(pre_header.c_str(),pre_header.size(),"byte");
+      cbinfile.Write_any_type(par_header.c_str(),par_header.size(),"byte");
+    }
+
+    // now write coarsened binary data
     // check if elements larger than 2^31
     if (data_size*nb_mbs<=2147483648) {
-      // now write binary data in parallel
+      // now write coarsened binary data in parallel
       std::size_t myoffset=header_offset+data_size*ns_mbs;
       cbinfile.Write_any_type_at_all(data,(data_size*nb_mbs),myoffset,"byte");
     } else {
       // write data over each MeshBlock sequentially and in parallel
-      // calculate max/min number of MeshBlocks across all ranks
-      noutmbs_max = pm->nmb_eachrank[0];
-      noutmbs_min = pm->nmb_eachrank[0];
-      for (int i=0; i<(global_variable::nranks); ++i) {
-        noutmbs_max = std::max(noutmbs_max,pm->nmb_eachrank[i]);
-        noutmbs_min = std::min(noutmbs_min,pm->nmb_eachrank[i]);
-      }
-      for (int m=0;  m<noutmbs_max; ++m) {
+      for (int m=0;  m<nmbs_max; ++m) {
         char *pdata=&(data[m*data_size]);
         std::size_t myoffset=header_offset+data_size*ns_mbs+data_size*m;
         // every rank has a MB to write, so write collectively
-        if (m < noutmbs_min) {
+        if (m < nmbs_min) {
           if (cbinfile.Write_any_type_at_all(pdata,(data_size),myoffset,"byte") != 1) {
             std::cout << "### FATAL ERROR in " << __FILE__ << " at line " << __LINE__
                 << std::endl << "binary data not written correctly to binary file, "
@@ -515,7 +575,7 @@ void CoarsenedBinaryOutput::WriteOutputFile(Mesh *pm, ParameterInput *pin) {
             exit(EXIT_FAILURE);
           }
         // some ranks are finished writing, so use non-collective write
-        } else if (m < pm->nmb_thisrank) {
+        } else if (m < nmb_thisrank) {
           if (cbinfile.Write_any_type_at(pdata,(data_size),myoffset,"byte") != 1) {
             std::cout << "### FATAL ERROR in " << __FILE__ << " at line " << __LINE__
                  << std::endl << "binary data not written correctly to binary file, "
@@ -525,12 +585,18 @@ void CoarsenedBinaryOutput::WriteOutputFile(Mesh *pm, ParameterInput *pin) {
         }
       }
     }
-  }
 
-  // close the output file and clean up ptrs to data
-  cbinfile.Close();
-  delete [] data;
-  delete [] single_data;
+    // close the output file and clean up ptr to data
+    cbinfile.Close();
+    hugepage::Free(data);
+  };
+
+  // write in background thread (overlapping with subsequent cycles) or synchronously
+  if (async_write) {
+    iothread_ = std::thread(write_and_close);
+  } else {
+    write_and_close();
+  }
 
   // increment counters
   out_params.file_number++;
@@ -0,0 +1,275 @@
+//========================================================================================
+// AthenaXXX astrophysical plasma code
+// Copyright(C) 2020 James M. Stone <jmstone@ias.edu> and the Athena code team
+// Licensed under the 3-clause BSD License (the "LICENSE")
+//========================================================================================
+//! \file compressed_binary.cpp
+//! \brief writes output data in chunk-compressed binary ('zbin') format.  The layout
+//! follows the 'bin' format, except that each MeshBlock record stores, after the usual
+//! index/location metadata, one compressed chunk per variable prefixed by its size in
+//! bytes (uint32).  Chunks are byte-shuffled then compressed into the LZ4 block format
+//! (see utils/compression.cpp), optionally after fixed-precision mantissa truncation
+//! ('mantissa_bits' in the <output> block).  Since record lengths vary, each rank
+//! writes its records contiguously at an offset obtained from an exclusive scan of the
+//! per-rank compressed stream sizes.  Files are read by read_compressed_binary() in
+//! vis/python/bin_convert.py.
+
+#include <sys/stat.h>  // mkdir
+
+#include <cstdint>
+#include <cstdio>
+#include <cstdlib>
+#include <cstring>
+#include <iomanip>
+#include <iostream>
+#include <sstream>
+#include <string>
+#include <thread>
+#include <utility>
+#include <vector>
+
+#include "athena.hpp"
+#include "globals.hpp"
+#include "coordinates/cell_locations.hpp"
+#include "mesh/mesh.hpp"
+#include "utils/compression.hpp"
+#include "outputs.hpp"
+
+//----------------------------------------------------------------------------------------
+// Constructor: also calls BaseTypeOutput base class constructor
+
+MeshCompressedBinaryOutput::MeshCompressedBinaryOutput(ParameterInput *pin, Mesh *pm,
+  OutputParameters op) : BaseTypeOutput(pin, pm, op) {
+  // create directory for outputs. Comments in binary.cpp constructor explain why
+  mkdir("zbin",0775);
+}
+
+//----------------------------------------------------------------------------------------
+//! \fn void MeshCompressedBinaryOutput:::WriteOutputFile(Mesh *pm)
+//  \brief Cycles over all MeshBlocks and writes OutputData in compressed binary format
+//   All MeshBlocks are written to the same file.
+
+void MeshCompressedBinaryOutput::WriteOutputFile(Mesh *pm, ParameterInput *pin) {
+  // With 'async=true' writes of the previous dump may still be in flight on the
+  // background thread; wait for them to finish before starting a new dump
+  FenceAsyncWrite();
+
+  // create filename: "zbin/file_basename" + "." + "file_id" + "." + XXXXX + ".zbin"
+  // where XXXXX = 5-digit file_number
+  std::string fname;
+  char number[6];
+  std::snprintf(number, sizeof(number), "%05d", out_params.file_number);
+
+  fname.assign("zbin/");
+  fname.append(out_params.file_basename);
+  fname.append(".");
+  fname.append(out_params.file_id);
+  fname.append(".");
+  fname.append(number);
+  fname.append(".zbin");
+
+  // Header layout follows the 'bin' format, with an extra "mantissa bits" preheader
+  // line recording the precision kept by truncation (23 = lossless)
+  std::size_t header_offset=0;
+  std::string pre_header, par_header;
+  {
+    std::stringstream msg;
+    msg << "Athena compressed binary output version=1.1" << std::endl
+        // preheader size includes "size of preheader" line up to "number of variables"
+        << "  size of preheader=6" << std::endl
+        << "  time=" << pm->time << std::endl
+        << "  cycle=" << pm->ncycle << std::endl
+        << "  size of location=" << sizeof(Real) << std::endl
+        << "  size of variable=" << sizeof(float) << std::endl
+        << "  mantissa bits=" << out_params.mantissa_bits << std::endl
+        << "  number of variables=" << outvars.size() << std::endl
+        << "  variables:  ";
+    for (int n=0; n<outvars.size(); n++) {
+      msg << outvars[n].label.c_str() << "  ";
+    }
+    msg << std::endl;
+    pre_header = msg.str();
+    header_offset += pre_header.size();
+  }
+  {
+    std::stringstream msg;
+    // prepare the input parameters
+    std::stringstream ost;
+    pin->ParameterDump(ost);
+    std::string sbuf=ost.str();
+    msg << "  header offset=" << sbuf.size()*sizeof(char)  << std::endl;
+    par_header = msg.str() + sbuf;
+    header_offset += par_header.size();
+  }
+
+  int nout_vars = outvars.size();
+  int nout_mbs = outmbs.size();
+  std::size_t cells = 0;
+  if (nout_mbs > 0) {
+    int nout1 = outmbs[0].oie - outmbs[0].ois + 1;
+    int nout2 = outmbs[0].oje - outmbs[0].ojs + 1;
+    int nout3 = outmbs[0].oke - outmbs[0].oks + 1;
+    cells = nout1*nout2*nout3;
+  }
+
+  // Assemble phase: snapshot per-MB metadata and (truncated) float data, so the write
+  // phase below reads nothing from outarray or the Mesh (both may be updated by the
+  // main thread before background writes complete when 'async=true')
+  std::size_t meta_size = 10*sizeof(int32_t) + 6*sizeof(Real);
+  std::vector<char> meta(nout_mbs*meta_size);
+  std::vector<float> raw(static_cast<std::size_t>(nout_mbs)*nout_vars*cells);
+
+  // Loop over MeshBlocks
+  for (int m=0; m<nout_mbs; ++m) {
+    char *pdata=&(meta[m*meta_size]);
+    LogicalLocation loc = pm->lloc_eachmb[outmbs[m].mb_gid];
+    int &ois = outmbs[m].ois;
+    int &oie = outmbs[m].oie;
+    int &ojs = outmbs[m].ojs;
+    int &oje = outmbs[m].oje;
+    int &oks = outmbs[m].oks;
+    int &oke = outmbs[m].oke;
+
+    // output indexing for MB
+    int32_t nx = (int32_t)(ois);
+    memcpy(pdata,&(nx),sizeof(nx));
+    pdata+=sizeof(nx);
+    nx = (int32_t)(oie);
+    memcpy(pdata,&(nx),sizeof(nx));
+    pdata+=sizeof(nx);
+    nx = (int32_t)(ojs);
+    memcpy(pdata,&(nx),sizeof(nx));
+    pdata+=sizeof(nx);
+    nx = (int32_t)(oje);
+    memcpy(pdata,&(nx),sizeof(nx));
+    pdata+=sizeof(nx);
+    nx = (int32_t)(oks);
+    memcpy(pdata,&(nx),sizeof(nx));
+    pdata+=sizeof(nx);
+    nx = (int32_t)(oke);
+    memcpy(pdata,&(nx),sizeof(nx));
+    pdata+=sizeof(nx);
+
+    // logical location lx1, lx2, lx3
+    nx = (int32_t)(loc.lx1);
+    memcpy(pdata,&(nx),sizeof(nx));
+    pdata+=sizeof(nx);
+    nx = (int32_t)(loc.lx2);
+    memcpy(pdata,&(nx),sizeof(nx));
+    pdata+=sizeof(nx);
+    nx = (int32_t)(loc.lx3);
+    memcpy(pdata,&(nx),sizeof(nx));
+    pdata+=sizeof(nx);
+
+    // physical refinement level
+    nx = (int32_t)(loc.level-pm->root_level);
+    memcpy(pdata,&(nx),sizeof(nx));
+    pdata+=sizeof(nx);
+
+    // coordinate location
+    Real xv = outmbs[m].x1min;
+    memcpy(pdata,&(xv),sizeof(xv));
+    pdata+=sizeof(xv);
+    xv = outmbs[m].x1max;
+    memcpy(pdata,&(xv),sizeof(xv));
+    pdata+=sizeof(xv);
+    xv = outmbs[m].x2min;
+    memcpy(pdata,&(xv),sizeof(xv));
+    pdata+=sizeof(xv);
+    xv = outmbs[m].x2max;
+    memcpy(pdata,&(xv),sizeof(xv));
+    pdata+=sizeof(xv);
+    xv = outmbs[m].x3min;
+    memcpy(pdata,&(xv),sizeof(xv));
+    pdata+=sizeof(xv);
+    xv = outmbs[m].x3max;
+    memcpy(pdata,&(xv),sizeof(xv));
+    pdata+=sizeof(xv);
+
+    // output variables
+    for (int n=0; n<nout_vars; n++) {
+      std::size_t cnt = (static_cast<std::size_t>(m)*nout_vars + n)*cells;
+      for (int k=oks; k<=oke; k++) {
+        for (int j=ojs; j<=oje; j++) {
+          for (int i=ois; i<=oie; i++) {
+            raw[cnt] = static_cast<float>(outarray(n,m,k-oks,j-ojs,i-ois));
+            cnt++;
+          }
+        }
+      }
+    }
+  }
+  // optional fixed-precision truncation (no-op when mantissa_bits=23)
+  compression::TruncateMantissa(raw.data(), raw.size(), out_params.mantissa_bits);
+
+  bool async_write = out_params.async;
+#if MPI_PARALLEL_ENABLED
+  MPI_Comm write_comm = (async_write)? io_comm_ : MPI_COMM_WORLD;
+#endif
+
+  // Write phase: compresses chunks, opens file, writes header and records, and closes
+  // file.  Runs on the background thread when 'async=true', so that compression as
+  // well as the writes overlap with subsequent cycles.
+  auto write_and_close = [=, meta = std::move(meta), raw = std::move(raw)]() {
+    std::vector<std::uint8_t> stream;
+    stream.reserve(meta.size() + raw.size()*sizeof(float)/2);
+    std::vector<std::uint8_t> shuffled(cells*sizeof(float));
+    for (int m=0; m<nout_mbs; ++m) {
+      const std::uint8_t *pmeta =
+          reinterpret_cast<const std::uint8_t*>(&(meta[m*meta_size]));
+      stream.insert(stream.end(), pmeta, pmeta + meta_size);
+      for (int n=0; n<nout_vars; ++n) {
+        const float *vraw = &(raw[(static_cast<std::size_t>(m)*nout_vars + n)*cells]);
+        compression::ByteShuffle(reinterpret_cast<const std::uint8_t*>(vraw),
+                                 shuffled.data(), cells, sizeof(float));
+        // chunk is prefixed by its compressed size, filled in after compressing
+        std::size_t lenpos = stream.size();
+        stream.resize(lenpos + sizeof(std::uint32_t));
+        std::uint32_t csize = static_cast<std::uint32_t>(
+            compression::CompressLZ4(shuffled.data(), shuffled.size(), stream));
+        std::memcpy(&(stream[lenpos]), &csize, sizeof(csize));
+      }
+    }
+
+    // records are variable-length, so offset of this rank's stream comes from an
+    // exclusive prefix sum of the per-rank stream sizes
+    std::uint64_t my_bytes = stream.size();
+    std::uint64_t my_offset = 0;
+#if MPI_PARALLEL_ENABLED
+    MPI_Exscan(&my_bytes, &my_offset, 1, MPI_UINT64_T, MPI_SUM, write_comm);
+    if (global_variable::my_rank == 0) {my_offset = 0;}
+#endif
+
+    IOWrapper zfile;
+#if MPI_PARALLEL_ENABLED
+    if (async_write) {zfile.SetCommunicator(write_comm);}
+#endif
+    zfile.Open(fname.c_str(), IOWrapper::FileMode::write);
+    if (global_variable::my_rank == 0) {
+      zfile.Write_any_type(pre_header.c_str(),pre_header.size(),"byte");
+      zfile.Write_any_type(par_header.c_str(),par_header.size(),"byte");
+    }
+    // collective write; ranks without output MBs still participate with zero bytes
+    zfile.Write_any_type_at_all(stream.data(),my_bytes,header_offset+my_offset,"byte");
+    zfile.Close();
+  };
+
+  // write in background thread (overlapping with subsequent cycles) or synchronously
+  if (async_write) {
+    iothread_ = std::thread(write_and_close);
+  } else {
+    write_and_close();
+  }
+
+  // increment counters
+  out_params.file_number++;
+  if (out_params.last_time < 0.0) {
+    out_params.last_time = pm->time;
+  } else {
+    out_params.last_time += out_params.dt;
+  }
+  pin->SetInteger(out_params.block_name, "file_number", out_params.file_number);
+  pin->SetReal(out_params.block_name, "last_time", out_params.last_time);
+
+  return;
+}
@@ -11,11 +11,17 @@
 //!   - magnitude of vorticity Curl(v)^2  [non-relativistic]
 //!   - z-component of current density Jz  [non-relativistic]
 //!   - magnitude of current density J^2  [non-relativistic]
+//! A comma-separated list of the quantities in fused_derived_choice[] (outputs.hpp) is
+//! computed by a single fused kernel (ComputeDerivedFused below) that reads each input
+//! stencil once per cell, instead of one full-grid pass per quantity.
 
+#include <algorithm>  // min, max
 #include <iostream>
 #include <sstream>
 #include <string>   // std::string, to_string()
 
+#include <vector>
+
 #include "athena.hpp"
 #include "parameter_input.hpp"
 #include "coordinates/cartesian_ks.hpp"
@@ -31,6 +37,9 @@
 #include "outputs.hpp"
 #include "utils/current.hpp"
 
+// quantity ids used by the fused derived-variable kernel (see ComputeDerivedFused)
+enum FusedDerived {FWZ=0, FW2, FJZ, FJ2, FCURV, FCURVALT, FKJXB, FCURVPERP, FBMAG};
+
 //----------------------------------------------------------------------------------------
 // BaseTypeOutput::ComputeDerivedVariable()
 
@@ -49,6 +58,54 @@ void BaseTypeOutput::ComputeDerivedVariable(std::string name, Mesh *pm) {
   auto &multi_d = pm->multi_d;
   auto &three_d = pm->three_d;
 
+  // Restrict evaluation to the output subvolume.  With slicing enabled only the plane(s)
+  // actually loaded by LoadOutputData() are computed, so e.g. 2D-slice dumps do not pay
+  // for full-3D derived kernels.  The cell index of a slice can differ between
+  // MeshBlocks (at different positions or refinement levels), so the bounds used below
+  // are the union over all MeshBlocks on this rank that contain the slice.
+  int il = is, iu = ie, jl = js, ju = je, kl = ks, ku = ke;
+  if (out_params.slice1) {
+    il = ie+1; iu = is-1;
+    for (int m=0; m<nmb; ++m) {
+      if (out_params.slice_x1 <  size.h_view(m).x1min ||
+          out_params.slice_x1 >= size.h_view(m).x1max) { continue; }
+      int islc = CellCenterIndex(out_params.slice_x1, indcs.nx1,
+                                 size.h_view(m).x1min, size.h_view(m).x1max) + is;
+      il = std::min(il, islc);
+      iu = std::max(iu, islc);
+    }
+  }
+  if (out_params.slice2) {
+    jl = je+1; ju = js-1;
+    for (int m=0; m<nmb; ++m) {
+      if (out_params.slice_x2 <  size.h_view(m).x2min ||
+          out_params.slice_x2 >= size.h_view(m).x2max) { continue; }
+      int jslc = CellCenterIndex(out_params.slice_x2, indcs.nx2,
+                                 size.h_view(m).x2min, size.h_view(m).x2max) + js;
+      jl = std::min(jl, jslc);
+      ju = std::max(ju, jslc);
+    }
+  }
+  if (out_params.slice3) {
+    kl = ke+1; ku = ks-1;
+    for (int m=0; m<nmb; ++m) {
+      if (out_params.slice_x3 <  size.h_view(m).x3min ||
+          out_params.slice_x3 >= size.h_view(m).x3max) { continue; }
+      int kslc = CellCenterIndex(out_params.slice_x3, indcs.nx3,
+                                 size.h_view(m).x3min, size.h_view(m).x3max) + ks;
+      kl = std::min(kl, kslc);
+      ku = std::max(ku, kslc);
+    }
+  }
+  // no MeshBlock on this rank contains the slice(s); nothing to compute
+  if ((il > iu) || (jl > ju) || (kl > ku)) { return; }
+
+  // comma-separated list of quantities: compute them all with a single fused kernel
+  if (name.find(',') != std::string::npos) {
+    ComputeDerivedFused(name, pm, il, iu, jl, ju, kl, ku);
+    return;
+  }
+
   // derived variable index
   int &i_dv = out_params.i_derived;
   int &n_dv = out_params.n_derived;
@@ -60,7 +117,7 @@ void BaseTypeOutput::ComputeDerivedVariable(std::string name, Mesh *pm) {
     auto dv = derived_var;
     auto &w0_ = (name.compare("hydro_wz") == 0)?
       pm->pmb_pack->phydro->w0 : pm->pmb_pack->pmhd->w0;
-    par_for("temperature", DevExeSpace(), 0, (nmb-1), ks, ke, js, je, is, ie,
+    par_for("temperature", DevExeSpace(), 0, (nmb-1), kl, ku, jl, ju, il, iu,
     KOKKOS_LAMBDA(int m, int k, int j, int i) {
       dv(m,i_dv,k,j,i) = (w0_(m,IEN,k,j,i+1) / w0_(m,IDN,k,j,i-1));
     });
@@ -76,7 +133,7 @@ void BaseTypeOutput::ComputeDerivedVariable(std::string name, Mesh *pm) {
     auto dv = derived_var;
     auto &w0_ = (name.compare("hydro_wz") == 0)?
       pm->pmb_pack->phydro->w0 : pm->pmb_pack->pmhd->w0;
-    par_for("vorz", DevExeSpace(), 0, (nmb-1), ks, ke, js, je, is, ie,
+    par_for("vorz", DevExeSpace(), 0, (nmb-1), kl, ku, jl, ju, il, iu,
     KOKKOS_LAMBDA(int m, int k, int j, int i) {
       dv(m,i_dv,k,j,i) = (w0_(m,IVY,k,j,i+1) - w0_(m,IVY,k,j,i-1))/size.d_view(m).dx1;
       if (multi_d) {
@@ -95,7 +152,7 @@ void BaseTypeOutput::ComputeDerivedVariable(std::string name, Mesh *pm) {
     auto dv = derived_var;
     auto &w0_ = (name.compare("hydro_w2") == 0)?
       pm->pmb_pack->phydro->w0 : pm->pmb_pack->pmhd->w0;
-    par_for("vor2", DevExeSpace(), 0, (nmb-1), ks, ke, js, je, is, ie,
+    par_for("vor2", DevExeSpace(), 0, (nmb-1), kl, ku, jl, ju, il, iu,
     KOKKOS_LAMBDA(int m, int k, int j, int i) {
       Real w1 = 0.0;
       Real w2 = -(w0_(m,IVZ,k,j,i+1) - w0_(m,IVZ,k,j,i-1))/size.d_view(m).dx1;
@@ -121,7 +178,7 @@ void BaseTypeOutput::ComputeDerivedVariable(std::string name, Mesh *pm) {
       Kokkos::realloc(derived_var, nmb, n_dv, n3, n2, n1);
     auto dv = derived_var;
     auto &bcc = pm->pmb_pack->pmhd->bcc0;
-    par_for("jz", DevExeSpace(), 0, (nmb-1), ks, ke, js, je, is, ie,
+    par_for("jz", DevExeSpace(), 0, (nmb-1), kl, ku, jl, ju, il, iu,
     KOKKOS_LAMBDA(int m, int k, int j, int i) {
       dv(m,i_dv,k,j,i) = (bcc(m,IBY,k,j,i+1) - bcc(m,IBY,k,j,i-1))/size.d_view(m).dx1;
       if (multi_d) {
@@ -138,7 +195,7 @@ void BaseTypeOutput::ComputeDerivedVariable(std::string name, Mesh *pm) {
       Kokkos::realloc(derived_var, nmb, n_dv, n3, n2, n1);
     auto dv = derived_var;
     auto &bcc = pm->pmb_pack->pmhd->bcc0;
-    par_for("j2", DevExeSpace(), 0, (nmb-1), ks, ke, js, je, is, ie,
+    par_for("j2", DevExeSpace(), 0, (nmb-1), kl, ku, jl, ju, il, iu,
     KOKKOS_LAMBDA(int m, int k, int j, int i) {
       Real j1 = 0.0;
       Real j2 = -(bcc(m,IBZ,k,j,i+1) - bcc(m,IBZ,k,j,i-1))/size.d_view(m).dx1;
@@ -165,7 +222,7 @@ void BaseTypeOutput::ComputeDerivedVariable(std::string name, Mesh *pm) {
       Kokkos::realloc(derived_var, nmb, n_dv, n3, n2, n1);
     auto dv = derived_var;
     auto &bcc = pm->pmb_pack->pmhd->bcc0;
-    par_for("curv", DevExeSpace(), 0, (nmb-1), ks, ke, js, je, is, ie,
+    par_for("curv", DevExeSpace(), 0, (nmb-1), kl, ku, jl, ju, il, iu,
     KOKKOS_LAMBDA(int m, int k, int j, int i) {
       // Calculate |B|
       Real &Bx = bcc(m,IBX,k,j,i);
@@ -233,7 +290,7 @@ void BaseTypeOutput::ComputeDerivedVariable(std::string name, Mesh *pm) {
       Kokkos::realloc(derived_var, nmb, n_dv, n3, n2, n1);
     auto dv = derived_var;
     auto &bcc = pm->pmb_pack->pmhd->bcc0;
-    par_for("curv_alt", DevExeSpace(), 0, (nmb-1), ks, ke, js, je, is, ie,
+    par_for("curv_alt", DevExeSpace(), 0, (nmb-1), kl, ku, jl, ju, il, iu,
     KOKKOS_LAMBDA(int m, int k, int j, int i) {
       // Calculate |B|
       Real B_mag = sqrt( bcc(m,IBX,k,j,i)*bcc(m,IBX,k,j,i)
@@ -335,7 +392,7 @@ void BaseTypeOutput::ComputeDerivedVariable(std::string name, Mesh *pm) {
       std::exit(EXIT_FAILURE);
     }
 
-    par_for("jcon", DevExeSpace(), 0, (nmb-1), ks, ke, js, je, is, ie,
+    par_for("jcon", DevExeSpace(), 0, (nmb-1), kl, ku, jl, ju, il, iu,
     KOKKOS_LAMBDA(int m, int k, int j, int i) {
       Real &x1min = size.d_view(m).x1min;
       Real &x1max = size.d_view(m).x1max;
@@ -462,7 +519,7 @@ void BaseTypeOutput::ComputeDerivedVariable(std::string name, Mesh *pm) {
     auto dv = derived_var;
     auto u0_ = pm->pmb_pack->pmhd->u0;
     auto &bcc = pm->pmb_pack->pmhd->bcc0;
-    par_for("mhd_sgs", DevExeSpace(), 0, (nmb-1), ks, ke, js, je, is, ie,
+    par_for("mhd_sgs", DevExeSpace(), 0, (nmb-1), kl, ku, jl, ju, il, iu,
     KOKKOS_LAMBDA(int m, int k, int j, int i) {
       Real rho = u0_(m,IDN,k,j,i);
       Real mx = u0_(m,IVX,k,j,i);
@@ -548,7 +605,7 @@ void BaseTypeOutput::ComputeDerivedVariable(std::string name, Mesh *pm) {
     Kokkos::realloc(derived_var, nmb, n_sgs, n3, n2, n1);
     auto dv = derived_var;
     auto u0_ = pm->pmb_pack->phydro->u0;
-    par_for("hydro_sgs", DevExeSpace(), 0, (nmb-1), ks, ke, js, je, is, ie,
+    par_for("hydro_sgs", DevExeSpace(), 0, (nmb-1), kl, ku, jl, ju, il, iu,
     KOKKOS_LAMBDA(int m, int k, int j, int i) {
       Real rho = u0_(m,IDN,k,j,i);
       Real mx = u0_(m,IVX,k,j,i);
@@ -592,7 +649,7 @@ void BaseTypeOutput::ComputeDerivedVariable(std::string name, Mesh *pm) {
     auto dv = derived_var;
     auto &w0_ = pm->pmb_pack->pmhd->w0;
     auto &bcc = pm->pmb_pack->pmhd->bcc0;
-    par_for("mhd_v_B_moments", DevExeSpace(), 0, (nmb-1), ks, ke, js, je, is, ie,
+    par_for("mhd_v_B_moments", DevExeSpace(), 0, (nmb-1), kl, ku, jl, ju, il, iu,
     KOKKOS_LAMBDA(int m, int k, int j, int i) {
       Real v = sqrt(w0_(m,IVX,k,j,i)*w0_(m,IVX,k,j,i)
                   + w0_(m,IVY,k,j,i)*w0_(m,IVY,k,j,i)
@@ -620,7 +677,7 @@ void BaseTypeOutput::ComputeDerivedVariable(std::string name, Mesh *pm) {
     auto dv = derived_var;
     auto &w0_ = pm->pmb_pack->pmhd->w0;
     auto &bcc = pm->pmb_pack->pmhd->bcc0;
-    par_for("mhd_vi_Bi_moments", DevExeSpace(), 0, (nmb-1), ks, ke, js, je, is, ie,
+    par_for("mhd_vi_Bi_moments", DevExeSpace(), 0, (nmb-1), kl, ku, jl, ju, il, iu,
     KOKKOS_LAMBDA(int m, int k, int j, int i) {
       Real vx = w0_(m,IVX,k,j,i);
       Real vy = w0_(m,IVY,k,j,i);
@@ -663,7 +720,7 @@ void BaseTypeOutput::ComputeDerivedVariable(std::string name, Mesh *pm) {
     Kokkos::realloc(derived_var, n_moments, 1, n3, n2, n1);
     auto dv = derived_var;
     auto &w0_ = pm->pmb_pack->phydro->w0;
-    par_for("hydro_v_moments", DevExeSpace(), 0, (nmb-1), ks, ke, js, je, is, ie,
+    par_for("hydro_v_moments", DevExeSpace(), 0, (nmb-1), kl, ku, jl, ju, il, iu,
     KOKKOS_LAMBDA(int m, int k, int j, int i) {
       Real v = sqrt(w0_(m,IVX,k,j,i)*w0_(m,IVX,k,j,i)
                   + w0_(m,IVY,k,j,i)*w0_(m,IVY,k,j,i)
@@ -682,7 +739,7 @@ void BaseTypeOutput::ComputeDerivedVariable(std::string name, Mesh *pm) {
     Kokkos::realloc(derived_var, n_moments, 1, n3, n2, n1);
     auto dv = derived_var;
     auto &w0_ = pm->pmb_pack->phydro->w0;
-    par_for("hydro_moments", DevExeSpace(), 0, (nmb-1), ks, ke, js, je, is, ie,
+    par_for("hydro_moments", DevExeSpace(), 0, (nmb-1), kl, ku, jl, ju, il, iu,
     KOKKOS_LAMBDA(int m, int k, int j, int i) {
       Real vx = w0_(m,IVX,k,j,i);
       Real vy = w0_(m,IVY,k,j,i);
@@ -713,7 +770,7 @@ void BaseTypeOutput::ComputeDerivedVariable(std::string name, Mesh *pm) {
       Kokkos::realloc(derived_var, nmb, n_dv, n3, n2, n1);
     auto dv = derived_var;
     auto &bcc = pm->pmb_pack->pmhd->bcc0;
-    par_for("mhd_k_jxb", DevExeSpace(), 0, (nmb-1), ks, ke, js, je, is, ie,
+    par_for("mhd_k_jxb", DevExeSpace(), 0, (nmb-1), kl, ku, jl, ju, il, iu,
     KOKKOS_LAMBDA(int m, int k, int j, int i) {
       // calculate j
       Real j1 = 0.0;
@@ -750,7 +807,7 @@ void BaseTypeOutput::ComputeDerivedVariable(std::string name, Mesh *pm) {
       Kokkos::realloc(derived_var, nmb, n_dv, n3, n2, n1);
     auto dv = derived_var;
     auto &bcc = pm->pmb_pack->pmhd->bcc0;
-    par_for("curv_perp", DevExeSpace(), 0, (nmb-1), ks, ke, js, je, is, ie,
+    par_for("curv_perp", DevExeSpace(), 0, (nmb-1), kl, ku, jl, ju, il, iu,
     KOKKOS_LAMBDA(int m, int k, int j, int i) {
       // calculate j
       Real j1 = 0.0;
@@ -860,7 +917,7 @@ void BaseTypeOutput::ComputeDerivedVariable(std::string name, Mesh *pm) {
       Kokkos::realloc(derived_var, nmb, n_dv, n3, n2, n1);
     auto dv = derived_var;
     auto &bcc = pm->pmb_pack->pmhd->bcc0;
-    par_for("bmag", DevExeSpace(), 0, (nmb-1), ks, ke, js, je, is, ie,
+    par_for("bmag", DevExeSpace(), 0, (nmb-1), kl, ku, jl, ju, il, iu,
     KOKKOS_LAMBDA(int m, int k, int j, int i) {
       dv(m,i_dv,k,j,i) = sqrt( bcc(m,IBX,k,j,i)*bcc(m,IBX,k,j,i)
                           + bcc(m,IBY,k,j,i)*bcc(m,IBY,k,j,i)
@@ -885,7 +942,7 @@ void BaseTypeOutput::ComputeDerivedVariable(std::string name, Mesh *pm) {
     auto &bcc = pm->pmb_pack->pmhd->bcc0;
     auto &b = pm->pmb_pack->pmhd->b0;
     auto &w0_ = pm->pmb_pack->pmhd->w0;
-    par_for("bmag", DevExeSpace(), 0, (nmb-1), ks, ke, js, je, is, ie,
+    par_for("bmag", DevExeSpace(), 0, (nmb-1), kl, ku, jl, ju, il, iu,
     KOKKOS_LAMBDA(int m, int k, int j, int i) {
       Real dx_squared = size.d_view(m).dx1 * size.d_view(m).dx1;
       // 0 = < B^4 >
@@ -976,17 +1033,17 @@ void BaseTypeOutput::ComputeDerivedVariable(std::string name, Mesh *pm) {
     if (derived_var.extent(4) <= 1)
       Kokkos::realloc(derived_var, nmb, n_dv, n3, n2, n1);
 
-    // set the loop limits for 1D/2D/3D problems
-    int jl = js, ju = je, kl = ks, ku = ke;
+    // set the ghost-extended loop limits for 1D/2D/3D problems
+    int jlg = js, jug = je, klg = ks, kug = ke;
     if (multi_d) {
-      jl = js-ng, ju = je+ng;
+      jlg = js-ng, jug = je+ng;
     } else if (three_d) {
-      jl = js-ng, ju = je+ng, kl = ks-ng, ku = ke+ng;
+      jlg = js-ng, jug = je+ng, klg = ks-ng, kug = ke+ng;
     }
 
     auto dv = derived_var;
     auto b0 = pm->pmb_pack->pmhd->b0;
-    par_for("divb", DevExeSpace(), 0, (nmb-1), kl, ku, jl, ju, (is-ng), (ie+ng),
+    par_for("divb", DevExeSpace(), 0, (nmb-1), klg, kug, jlg, jug, (is-ng), (ie+ng),
     KOKKOS_LAMBDA(int m, int k, int j, int i) {
       Real divb = (b0.x1f(m,k,j,i+1) - b0.x1f(m,k,j,i))/size.d_view(m).dx1;
       if (multi_d) {
@@ -1190,7 +1247,7 @@ void BaseTypeOutput::ComputeDerivedVariable(std::string name, Mesh *pm) {
     int &npart = pm->nprtcl_thisrank;
     int gids = pm->pmb_pack->gids;
 
-    par_for("pdens0", DevExeSpace(), 0, (nmb-1), ks, ke, js, je, is, ie,
+    par_for("pdens0", DevExeSpace(), 0, (nmb-1), kl, ku, jl, ju, il, iu,
     KOKKOS_LAMBDA(int m, int k, int j, int i) {
       pdens(m,0,k,j,i) = 0.0;
     });
@@ -1209,3 +1266,253 @@ void BaseTypeOutput::ComputeDerivedVariable(std::string name, Mesh *pm) {
   }
   i_dv = i_dv % n_dv; // reset derived variable index
 }
+
+//----------------------------------------------------------------------------------------
+// BaseTypeOutput::ComputeDerivedFused()
+// Computes every quantity in a comma-separated 'variable' list with a single kernel.
+// Each w0/bcc0 stencil value is loaded once per cell and shared by all requested
+// quantities, instead of once per quantity as with the one-kernel-per-name path above,
+// so e.g. a dump of ten MHD stencil diagnostics makes one full-grid pass rather than
+// ten.  Quantities that may appear in the list are those in fused_derived_choice[]
+// (outputs.hpp); the slot of each in derived_var is its position in the list.
+
+void BaseTypeOutput::ComputeDerivedFused(std::string name, Mesh *pm,
+                                         int il, int iu, int jl, int ju,
+                                         int kl, int ku) {
+  int nmb = pm->pmb_pack->nmb_thispack;
+  auto &indcs = pm->mb_indcs;
+  int &ng = indcs.ng;
+  int n1 = indcs.nx1 + 2*ng;
+  int n2 = (indcs.nx2 > 1)? (indcs.nx2 + 2*ng) : 1;
+  int n3 = (indcs.nx3 > 1)? (indcs.nx3 + 2*ng) : 1;
+  auto &size = pm->pmb_pack->pmb->mb_size;
+  auto &multi_d = pm->multi_d;
+  auto &three_d = pm->three_d;
+
+  // map each name in the list to a quantity id; slot in derived_var is list position
+  std::vector<int> ids;
+  std::stringstream vstream(name);
+  std::string token;
+  bool hydro_w = false;
+  while (std::getline(vstream, token, ',')) {
+    if (token.compare("hydro_wz") == 0 || token.compare("mhd_wz") == 0) {
+      ids.push_back(FWZ);
+    } else if (token.compare("hydro_w2") == 0 || token.compare("mhd_w2") == 0) {
+      ids.push_back(FW2);
+    } else if (token.compare("mhd_jz") == 0) {
+      ids.push_back(FJZ);
+    } else if (token.compare("mhd_j2") == 0) {
+      ids.push_back(FJ2);
+    } else if (token.compare("mhd_curv") == 0) {
+      ids.push_back(FCURV);
+    } else if (token.compare("mhd_curv_alt") == 0) {
+      ids.push_back(FCURVALT);
+    } else if (token.compare("mhd_k_jxb") == 0) {
+      ids.push_back(FKJXB);
+    } else if (token.compare("mhd_curv_perp") == 0) {
+      ids.push_back(FCURVPERP);
+    } else if (token.compare("mhd_bmag") == 0) {
+      ids.push_back(FBMAG);
+    } else {
+      std::cout << "### FATAL ERROR in " << __FILE__ << " at line " << __LINE__
+                << std::endl << "Variable '" << token << "' cannot be fused" << std::endl;
+      std::exit(EXIT_FAILURE);
+    }
+    hydro_w = hydro_w || (token.compare(0, 6, "hydro_") == 0);
+  }
+  int nq = static_cast<int>(ids.size());
+
+  // flags gating which shared intermediates the kernel must evaluate
+  DualArray1D<int> qid("fused-qid", nq);
+  bool need_vort = false, need_curr = false, need_b = false;
+  bool need_gradb = false, need_bhat = false, need_jxb = false;
+  for (int q=0; q<nq; ++q) {
+    qid.h_view(q) = ids[q];
+    need_vort  = need_vort  || (ids[q] == FWZ) || (ids[q] == FW2);
+    need_curr  = need_curr  || (ids[q] == FJZ) || (ids[q] == FJ2) ||
+                 (ids[q] == FKJXB) || (ids[q] == FCURVPERP);
+    need_b     = need_b     || (ids[q] == FCURV) || (ids[q] == FCURVALT) ||
+                 (ids[q] == FKJXB) || (ids[q] == FCURVPERP) || (ids[q] == FBMAG);
+    need_gradb = need_gradb || (ids[q] == FCURV);
+    need_bhat  = need_bhat  || (ids[q] == FCURVALT) || (ids[q] == FCURVPERP);
+    need_jxb   = need_jxb   || (ids[q] == FKJXB) || (ids[q] == FCURVPERP);
+  }
+  qid.template modify<HostMemSpace>();
+  qid.template sync<DevExeSpace>();
+
+  // only views actually read below are assigned (hydro lists never touch bcc0)
+  DvceArray5D<Real> w0_;
+  if (need_vort) {
+    w0_ = (hydro_w) ? pm->pmb_pack->phydro->w0 : pm->pmb_pack->pmhd->w0;
+  }
+  DvceArray5D<Real> bcc;
+  if (need_curr || need_b) {
+    bcc = pm->pmb_pack->pmhd->bcc0;
+  }
+
+  if (derived_var.extent(4) <= 1) {
+    Kokkos::realloc(derived_var, nmb, nq, n3, n2, n1);
+  }
+  auto dv = derived_var;
+  par_for("derived_fused", DevExeSpace(), 0, (nmb-1), kl, ku, jl, ju, il, iu,
+  KOKKOS_LAMBDA(int m, int k, int j, int i) {
+    // vorticity components (the w0 stencil is read once for both wz and w2)
+    Real w1 = 0.0, w2 = 0.0, w3 = 0.0;
+    if (need_vort) {
+      w2 = -(w0_(m,IVZ,k,j,i+1) - w0_(m,IVZ,k,j,i-1))/size.d_view(m).dx1;
+      w3 =  (w0_(m,IVY,k,j,i+1) - w0_(m,IVY,k,j,i-1))/size.d_view(m).dx1;
+      if (multi_d) {
+        w1 += (w0_(m,IVZ,k,j+1,i) - w0_(m,IVZ,k,j-1,i))/size.d_view(m).dx2;
+        w3 -= (w0_(m,IVX,k,j+1,i) - w0_(m,IVX,k,j-1,i))/size.d_view(m).dx2;
+      }
+      if (three_d) {
+        w1 -= (w0_(m,IVY,k+1,j,i) - w0_(m,IVY,k-1,j,i))/size.d_view(m).dx3;
+        w2 += (w0_(m,IVX,k+1,j,i) - w0_(m,IVX,k-1,j,i))/size.d_view(m).dx3;
+      }
+    }
+    // current density components (the bcc stencil is read once for jz/j2/k_jxb/...)
+    Real j1 = 0.0, j2 = 0.0, j3 = 0.0;
+    if (need_curr) {
+      j2 = -(bcc(m,IBZ,k,j,i+1) - bcc(m,IBZ,k,j,i-1))/size.d_view(m).dx1;
+      j3 =  (bcc(m,IBY,k,j,i+1) - bcc(m,IBY,k,j,i-1))/size.d_view(m).dx1;
+      if (multi_d) {
+        j1 += (bcc(m,IBZ,k,j+1,i) - bcc(m,IBZ,k,j-1,i))/size.d_view(m).dx2;
+        j3 -= (bcc(m,IBX,k,j+1,i) - bcc(m,IBX,k,j-1,i))/size.d_view(m).dx2;
+      }
+      if (three_d) {
+        j1 -= (bcc(m,IBY,k+1,j,i) - bcc(m,IBY,k-1,j,i))/size.d_view(m).dx3;
+        j2 += (bcc(m,IBX,k+1,j,i) - bcc(m,IBX,k-1,j,i))/size.d_view(m).dx3;
+      }
+    }
+    // cell-centered field and |B|^2
+    Real Bx = 0.0, By = 0.0, Bz = 0.0, bsq = 0.0;
+    if (need_b) {
+      Bx = bcc(m,IBX,k,j,i);
+      By = bcc(m,IBY,k,j,i);
+      Bz = bcc(m,IBZ,k,j,i);
+      bsq = Bx*Bx + By*By + Bz*Bz;
+    }
+    // j x B (for k_jxb and curv_perp)
+    Real jxB1 = 0.0, jxB2 = 0.0, jxB3 = 0.0;
+    if (need_jxb) {
+      jxB1 = j2*Bz - j3*By;
+      jxB2 = j3*Bx - j1*Bz;
+      jxB3 = j1*By - j2*Bx;
+    }
+    // curvature from the gradB tensor, |(B.gradB).(I - bhat bhat)|/B^2 (mhd_curv)
+    Real curvb = 0.0;
+    if (need_gradb) {
+      Real dBx_dx = (bcc(m,IBX,k,j,i+1) - bcc(m,IBX,k,j,i-1))/(2.0*size.d_view(m).dx1);
+      Real dBx_dy = (bcc(m,IBX,k,j+1,i) - bcc(m,IBX,k,j-1,i))/(2.0*size.d_view(m).dx2);
+      Real dBx_dz = (bcc(m,IBX,k+1,j,i) - bcc(m,IBX,k-1,j,i))/(2.0*size.d_view(m).dx3);
+
+      Real dBy_dx = (bcc(m,IBY,k,j,i+1) - bcc(m,IBY,k,j,i-1))/(2.0*size.d_view(m).dx1);
+      Real dBy_dy = (bcc(m,IBY,k,j+1,i) - bcc(m,IBY,k,j-1,i))/(2.0*size.d_view(m).dx2);
+      Real dBy_dz = (bcc(m,IBY,k+1,j,i) - bcc(m,IBY,k-1,j,i))/(2.0*size.d_view(m).dx3);
+
+      Real dBz_dx = (bcc(m,IBZ,k,j,i+1) - bcc(m,IBZ,k,j,i-1))/(2.0*size.d_view(m).dx1);
+      Real dBz_dy = (bcc(m,IBZ,k,j+1,i) - bcc(m,IBZ,k,j-1,i))/(2.0*size.d_view(m).dx2);
+      Real dBz_dz = (bcc(m,IBZ,k+1,j,i) - bcc(m,IBZ,k-1,j,i))/(2.0*size.d_view(m).dx3);
+
+      Real BdotGradB_x = (Bx*dBx_dx + By*dBx_dy + Bz*dBx_dz);
+      Real BdotGradB_y = (Bx*dBy_dx + By*dBy_dy + Bz*dBy_dz);
+      Real BdotGradB_z = (Bx*dBz_dx + By*dBz_dy + Bz*dBz_dz);
+
+      // contracting with (I - bhat bhat) removes the component along bhat
+      Real bdc = (BdotGradB_x*Bx + BdotGradB_y*By + BdotGradB_z*Bz)/bsq;
+      Real curv1 = BdotGradB_x - bdc*Bx;
+      Real curv2 = BdotGradB_y - bdc*By;
+      Real curv3 = BdotGradB_z - bdc*Bz;
+      curvb = sqrt(curv1*curv1 + curv2*curv2 + curv3*curv3)/bsq;
+    }
+    // curvature from the b_hat stencil, b_hat dot nabla b_hat (curv_alt/curv_perp)
+    Real ca1 = 0.0, ca2 = 0.0, ca3 = 0.0;
+    if (need_bhat) {
+      Real B_mag = sqrt(bsq);
+      Real b1 = Bx/B_mag;
+      Real b2 = By/B_mag;
+      Real b3 = Bz/B_mag;
+
+      // calculate b_hat vector at i +/- 1
+      Real B_mag_ip1 = sqrt( bcc(m,IBX,k,j,i+1)*bcc(m,IBX,k,j,i+1)
+                           + bcc(m,IBY,k,j,i+1)*bcc(m,IBY,k,j,i+1)
+                           + bcc(m,IBZ,k,j,i+1)*bcc(m,IBZ,k,j,i+1));
+      Real b1_ip1 = bcc(m,IBX,k,j,i+1)/B_mag_ip1;
+      Real b2_ip1 = bcc(m,IBY,k,j,i+1)/B_mag_ip1;
+      Real b3_ip1 = bcc(m,IBZ,k,j,i+1)/B_mag_ip1;
+
+      Real B_mag_im1 = sqrt( bcc(m,IBX,k,j,i-1)*bcc(m,IBX,k,j,i-1)
+                           + bcc(m,IBY,k,j,i-1)*bcc(m,IBY,k,j,i-1)
+                           + bcc(m,IBZ,k,j,i-1)*bcc(m,IBZ,k,j,i-1));
+      Real b1_im1 = bcc(m,IBX,k,j,i-1)/B_mag_im1;
+      Real b2_im1 = bcc(m,IBY,k,j,i-1)/B_mag_im1;
+      Real b3_im1 = bcc(m,IBZ,k,j,i-1)/B_mag_im1;
+
+      // calculate b_hat vector at j +/- 1
+      Real B_mag_jp1 = sqrt( bcc(m,IBX,k,j+1,i)*bcc(m,IBX,k,j+1,i)
+                           + bcc(m,IBY,k,j+1,i)*bcc(m,IBY,k,j+1,i)
+                           + bcc(m,IBZ,k,j+1,i)*bcc(m,IBZ,k,j+1,i));
+      Real b1_jp1 = bcc(m,IBX,k,j+1,i)/B_mag_jp1;
+      Real b2_jp1 = bcc(m,IBY,k,j+1,i)/B_mag_jp1;
+      Real b3_jp1 = bcc(m,IBZ,k,j+1,i)/B_mag_jp1;
+
+      Real B_mag_jm1 = sqrt( bcc(m,IBX,k,j-1,i)*bcc(m,IBX,k,j-1,i)
+                           + bcc(m,IBY,k,j-1,i)*bcc(m,IBY,k,j-1,i)
+                           + bcc(m,IBZ,k,j-1,i)*bcc(m,IBZ,k,j-1,i));
+      Real b1_jm1 = bcc(m,IBX,k,j-1,i)/B_mag_jm1;
+      Real b2_jm1 = bcc(m,IBY,k,j-1,i)/B_mag_jm1;
+      Real b3_jm1 = bcc(m,IBZ,k,j-1,i)/B_mag_jm1;
+
+      // calculate b_hat vector at k +/- 1
+      Real B_mag_kp1 = sqrt( bcc(m,IBX,k+1,j,i)*bcc(m,IBX,k+1,j,i)
+                           + bcc(m,IBY,k+1,j,i)*bcc(m,IBY,k+1,j,i)
+                           + bcc(m,IBZ,k+1,j,i)*bcc(m,IBZ,k+1,j,i));
+      Real b1_kp1 = bcc(m,IBX,k+1,j,i)/B_mag_kp1;
+      Real b2_kp1 = bcc(m,IBY,k+1,j,i)/B_mag_kp1;
+      Real b3_kp1 = bcc(m,IBZ,k+1,j,i)/B_mag_kp1;
+
+      Real B_mag_km1 = sqrt( bcc(m,IBX,k-1,j,i)*bcc(m,IBX,k-1,j,i)
+                           + bcc(m,IBY,k-1,j,i)*bcc(m,IBY,k-1,j,i)
+                           + bcc(m,IBZ,k-1,j,i)*bcc(m,IBZ,k-1,j,i));
+      Real b1_km1 = bcc(m,IBX,k-1,j,i)/B_mag_km1;
+      Real b2_km1 = bcc(m,IBY,k-1,j,i)/B_mag_km1;
+      Real b3_km1 = bcc(m,IBZ,k-1,j,i)/B_mag_km1;
+
+      // Central differencing of b_hat vector
+      Real db1_dx1 = (b1_ip1 - b1_im1)/(2.0*size.d_view(m).dx1);
+      Real db2_dx1 = (b2_ip1 - b2_im1)/(2.0*size.d_view(m).dx1);
+      Real db3_dx1 = (b3_ip1 - b3_im1)/(2.0*size.d_view(m).dx1);
+
+      Real db1_dx2 = (b1_jp1 - b1_jm1)/(2.0*size.d_view(m).dx2);
+      Real db2_dx2 = (b2_jp1 - b2_jm1)/(2.0*size.d_view(m).dx2);
+      Real db3_dx2 = (b3_jp1 - b3_jm1)/(2.0*size.d_view(m).dx2);
+
+      Real db1_dx3 = (b1_kp1 - b1_km1)/(2.0*size.d_view(m).dx3);
+      Real db2_dx3 = (b2_kp1 - b2_km1)/(2.0*size.d_view(m).dx3);
+      Real db3_dx3 = (b3_kp1 - b3_km1)/(2.0*size.d_view(m).dx3);
+
+      ca1 = b1*db1_dx1 + b2*db1_dx2 + b3*db1_dx3;
+      ca2 = b1*db2_dx1 + b2*db2_dx2 + b3*db2_dx3;
+      ca3 = b1*db3_dx1 + b2*db3_dx2 + b3*db3_dx3;
+    }
+    for (int q=0; q<nq; ++q) {
+      Real val = 0.0;
+      switch (qid.d_view(q)) {
+        case FWZ:       val = w3; break;
+        case FW2:       val = w1*w1 + w2*w2 + w3*w3; break;
+        case FJZ:       val = j3; break;
+        case FJ2:       val = j1*j1 + j2*j2 + j3*j3; break;
+        case FCURV:     val = curvb; break;
+        case FCURVALT:  val = sqrt(ca1*ca1 + ca2*ca2 + ca3*ca3); break;
+        case FKJXB:     val = sqrt(jxB1*jxB1 + jxB2*jxB2 + jxB3*jxB3)/bsq; break;
+        case FCURVPERP: val = sqrt((jxB1/bsq - ca1)*(jxB1/bsq - ca1)
+                                 + (jxB2/bsq - ca2)*(jxB2/bsq - ca2)
+                                 + (jxB3/bsq - ca3)*(jxB3/bsq - ca3)); break;
+        case FBMAG:     val = sqrt(bsq); break;
+        default: break;
+      }
+      dv(m,q,k,j,i) = val;
+    }
+  });
+  return;
+}
@@ -19,6 +19,7 @@
 #include "globals.hpp"
 #include "mesh/mesh.hpp"
 #include "outputs.hpp"
+#include "text_appender.hpp"
 
 //----------------------------------------------------------------------------------------
 // ctor: also calls BaseTypeOutput base class constructor
@@ -30,43 +31,61 @@ EventLogOutput::EventLogOutput(ParameterInput *pin, Mesh *pm, OutputParameters o
 
 //----------------------------------------------------------------------------------------
 //! \fn void EventLogOutput::LoadOutputData()
-//! \brief sums event counter data across MPI ranks
+//! \brief harvests event counters and starts their aggregation across MPI ranks with
+//! nonblocking collectives.  The aggregation started at the previous check is completed
+//! first; since it has been in flight for a full check interval it effectively never
+//! waits, keeping the collective communication off the critical path.
 
 void EventLogOutput::LoadOutputData(Mesh *pm) {
+  // complete aggregation started at the previous check and promote it to a ready row
+  if (agg_pending) {
 #if MPI_PARALLEL_ENABLED
-  // perform in-place sum or max over all MPI ranks, depending on counter
-  int* pdfloor = &(pm->ecounter.neos_dfloor);
-  int* pefloor = &(pm->ecounter.neos_efloor);
-  int* ptfloor = &(pm->ecounter.neos_tfloor);
-  int* pvceil  = &(pm->ecounter.neos_vceil);
-  int* pfail   = &(pm->ecounter.neos_fail);
-  int* pmaxit  = &(pm->ecounter.maxit_c2p);
-  int* pfofc   = &(pm->ecounter.nfofc);
-  MPI_Allreduce(MPI_IN_PLACE, pdfloor, 1, MPI_INT, MPI_SUM, MPI_COMM_WORLD);
-  MPI_Allreduce(MPI_IN_PLACE, pefloor, 1, MPI_INT, MPI_SUM, MPI_COMM_WORLD);
-  MPI_Allreduce(MPI_IN_PLACE, ptfloor, 1, MPI_INT, MPI_SUM, MPI_COMM_WORLD);
-  MPI_Allreduce(MPI_IN_PLACE, pvceil,  1, MPI_INT, MPI_SUM, MPI_COMM_WORLD);
-  MPI_Allreduce(MPI_IN_PLACE, pfail,   1, MPI_INT, MPI_SUM, MPI_COMM_WORLD);
-  MPI_Allreduce(MPI_IN_PLACE, pmaxit,  1, MPI_INT, MPI_MAX, MPI_COMM_WORLD);
-  MPI_Allreduce(MPI_IN_PLACE, pfofc,   1, MPI_INT, MPI_SUM, MPI_COMM_WORLD);
+    MPI_Waitall(2, agg_req, MPI_STATUSES_IGNORE);
 #endif
+    for (int n=0; n<nsums; ++n) {row_data[n] = agg_data[n];}
+    row_maxit = agg_maxit;
+    row_cycle = agg_cycle;
+    row_valid = true;
+    agg_pending = false;
+  }
+
+  // harvest and reset live counters, then start nonblocking aggregation over all ranks
+  EventCounters &ec = pm->ecounter;
+  agg_data[0] = ec.neos_dfloor;  ec.neos_dfloor = 0;
+  agg_data[1] = ec.neos_efloor;  ec.neos_efloor = 0;
+  agg_data[2] = ec.neos_tfloor;  ec.neos_tfloor = 0;
+  agg_data[3] = ec.neos_vceil;   ec.neos_vceil  = 0;
+  agg_data[4] = ec.neos_fail;    ec.neos_fail   = 0;
+  agg_data[5] = ec.nfofc;        ec.nfofc       = 0;
+  for (int n=0; n<(EventCounters::nhist_c2p); ++n) {
+    agg_data[6+n] = ec.nc2p_iter[n];
+    ec.nc2p_iter[n] = 0;
+  }
+  agg_maxit = ec.maxit_c2p;
+  ec.maxit_c2p = 0;
+  agg_cycle = pm->ncycle;
+#if MPI_PARALLEL_ENABLED
+  MPI_Iallreduce(MPI_IN_PLACE, agg_data, nsums, MPI_INT, MPI_SUM, MPI_COMM_WORLD,
+                 &(agg_req[0]));
+  MPI_Iallreduce(MPI_IN_PLACE, &agg_maxit, 1, MPI_INT, MPI_MAX, MPI_COMM_WORLD,
+                 &(agg_req[1]));
+#endif
+  agg_pending = true;
 
   // check if there is any data to be written
   no_output = true;
-  if (pm->ecounter.neos_dfloor > 0 ||
-      pm->ecounter.neos_efloor > 0 ||
-      pm->ecounter.neos_tfloor > 0 ||
-      pm->ecounter.neos_vceil  > 0 ||
-      pm->ecounter.neos_fail   > 0 ||
-      pm->ecounter.nfofc > 0 ||
-      pm->ecounter.maxit_c2p > 0) {
-    no_output=false;
+  if (row_valid) {
+    for (int n=0; n<nsums; ++n) {
+      if (row_data[n] > 0) {no_output = false;}
+    }
+    if (row_maxit > 0) {no_output = false;}
   }
 }
 
 //----------------------------------------------------------------------------------------
 //! \fn void EventLogOutput::WriteOutputFile()
-//! \brief writes event counter data to log file
+//! \brief writes event counter data to log file.  The record is formatted in memory and
+//! handed to the background text appender, so slow appends never stall the time step
 
 void EventLogOutput::WriteOutputFile(Mesh *pm, ParameterInput *pin) {
   if (header_written && no_output) return;
@@ -79,46 +98,44 @@ void EventLogOutput::WriteOutputFile(Mesh *pm, ParameterInput *pin) {
     fname.assign(out_params.file_basename);
     fname.append(".log");
 
-    // open file for output
-    FILE *pfile;
-    if ((pfile = std::fopen(fname.c_str(),"a")) == nullptr) {
-      std::cout << "### FATAL ERROR in " << __FILE__ << " at line " << __LINE__
-          << std::endl << "Output file '" << fname << "' could not be opened" <<std::endl;
-      exit(EXIT_FAILURE);
-    }
+    std::string record;
+    char buf[32];
 
     // Write header, if it has not been written already
     if (!(header_written)) {
-      std::fprintf(pfile,"# Athena event counter data\n");
-      std::fprintf(pfile,"#  cycle eos_dfloor eos_efloor eos_tfloor eos_vceil");
-      std::fprintf(pfile," eos_fail c2p_it fofc");
-      std::fprintf(pfile,"\n");  // terminate line
+      record.append("# Athena event counter data\n");
+      record.append("#  cycle eos_dfloor eos_efloor eos_tfloor eos_vceil");
+      record.append(" eos_fail c2p_it fofc");
+      for (int n=0; n<(EventCounters::nhist_c2p); ++n) {
+        std::snprintf(buf, sizeof(buf), " it_hist%d", n);
+        record.append(buf);
+      }
+      record.append("\n");  // terminate line
       header_written = true;
     }
 
-    // write event counters
+    // write event counters (aggregated one check interval earlier, labelled with the
+    // cycle at which they were harvested)
     if (!(no_output)) {
-      std::fprintf(pfile, "%8d", pm->ncycle);
-      std::fprintf(pfile, " %8d", pm->ecounter.neos_dfloor);
-      std::fprintf(pfile, " %8d", pm->ecounter.neos_efloor);
-      std::fprintf(pfile, " %8d", pm->ecounter.neos_tfloor);
-      std::fprintf(pfile, " %8d", pm->ecounter.neos_vceil);
-      std::fprintf(pfile, " %8d", pm->ecounter.neos_fail);
-      std::fprintf(pfile, " %6d", pm->ecounter.maxit_c2p);
-      std::fprintf(pfile, " %8d", pm->ecounter.nfofc);
-      std::fprintf(pfile,"\n"); // terminate line
+      std::snprintf(buf, sizeof(buf), "%8d", row_cycle);
+      record.append(buf);
+      for (int n=0; n<5; ++n) {
+        std::snprintf(buf, sizeof(buf), " %8d", row_data[n]);
+        record.append(buf);
+      }
+      std::snprintf(buf, sizeof(buf), " %6d", row_maxit);
+      record.append(buf);
+      std::snprintf(buf, sizeof(buf), " %8d", row_data[5]);
+      record.append(buf);
+      for (int n=0; n<(EventCounters::nhist_c2p); ++n) {
+        std::snprintf(buf, sizeof(buf), " %8d", row_data[6+n]);
+        record.append(buf);
+      }
+      record.append("\n"); // terminate line
     }
-    std::fclose(pfile);
+    appender::Append(fname, record);
   }
-
-  // reset counters
-  pm->ecounter.neos_dfloor = 0;
-  pm->ecounter.neos_efloor = 0;
-  pm->ecounter.neos_tfloor = 0;
-  pm->ecounter.neos_vceil = 0;
-  pm->ecounter.neos_fail = 0;
-  pm->ecounter.maxit_c2p = 0;
-  pm->ecounter.nfofc = 0;
+  row_valid = false;
 
   // increment output time, clean up
   if (out_params.last_time < 0.0) {
@@ -13,6 +13,7 @@
 #include <iostream>
 #include <sstream>
 #include <string>
+#include <vector>
 
 #include "athena.hpp"
 #include "globals.hpp"
@@ -22,12 +23,17 @@
 #include "mhd/mhd.hpp"
 #include "z4c/z4c.hpp"
 #include "outputs.hpp"
+#include "text_appender.hpp"
 
 //----------------------------------------------------------------------------------------
 // Constructor: also calls BaseTypeOutput base class constructor
 
 HistoryOutput::HistoryOutput(ParameterInput *pin, Mesh *pm, OutputParameters op) :
   BaseTypeOutput(pin, pm, op) {
+  // opt-in deterministic reductions, for validating runs against reference outputs made
+  // with a different rank count (sums are then bitwise identical, see functions below)
+  deterministic = pin->GetOrAddBoolean("time", "deterministic_reductions", false);
+
   // cycle through physics modules and add HistoryData struct for each
   hist_data.clear();
 
@@ -50,6 +56,15 @@ HistoryOutput::HistoryOutput(ParameterInput *pin, Mesh *pm, OutputParameters op)
   }
 }
 
+//----------------------------------------------------------------------------------------
+// Destructor: waits for and appends any history records whose global sums are in flight
+
+HistoryOutput::~HistoryOutput() {
+#if MPI_PARALLEL_ENABLED
+  FlushPendingHistory(true);
+#endif
+}
+
 //----------------------------------------------------------------------------------------
 //! \fn void HistoryOutput::LoadOutputData()
 //  \brief Wrapper function that cycles through hist_data vector and calls
@@ -69,6 +84,62 @@ void HistoryOutput::LoadOutputData(Mesh *pm) {
   }
 }
 
+//----------------------------------------------------------------------------------------
+//! \fn void SumHistoryDataFixedOrder()
+//  \brief Sums per-cell history contributions in a fixed tree order, for the
+//  deterministic reductions mode.  One thread per (m,k,j) pencil accumulates cells
+//  sequentially in i, and the pencil partials are then added on the host in index order,
+//  so the shape of the sum never depends on backend concurrency or launch configuration.
+//  Per-MeshBlock partial sums are also stored in pdata->hdata_mb so WriteOutputFile()
+//  can combine them across ranks in global gid order.  Input functor computes the
+//  volume-weighted contributions of one cell, exactly as in the reduction kernels below.
+
+template <typename Functor>
+static void SumHistoryDataFixedOrder(HistoryData *pdata, Mesh *pm, Functor hvars_func) {
+  auto &indcs = pm->pmb_pack->pmesh->mb_indcs;
+  int is = indcs.is; int nx1 = indcs.nx1;
+  int js = indcs.js; int nx2 = indcs.nx2;
+  int ks = indcs.ks; int nx3 = indcs.nx3;
+  const int nmb = pm->pmb_pack->nmb_thispack;
+  const int nrows = nmb*nx3*nx2;
+  const int nkj = nx3*nx2;
+  int nhist_ = pdata->nhist;
+
+  DvceArray2D<Real> psum("hst_psum", nrows, NHISTORY_VARIABLES);
+  par_for("HistSumsDet", DevExeSpace(), 0, nrows-1, KOKKOS_LAMBDA(const int row) {
+    // compute m,k,j indices of pencil
+    int m = (row)/nkj;
+    int k = (row - m*nkj)/nx2;
+    int j = (row - m*nkj - k*nx2) + js;
+    k += ks;
+
+    array_sum::GlobalSum pencil;
+    for (int i=is; i<(is+nx1); ++i) {
+      array_sum::GlobalSum hvars;
+      hvars_func(m, k, j, i, hvars);
+      for (int n=0; n<nhist_; ++n) {pencil.the_array[n] += hvars.the_array[n];}
+    }
+    for (int n=0; n<NHISTORY_VARIABLES; ++n) {psum(row,n) = pencil.the_array[n];}
+  });
+
+  // add pencil partials on the host in index order (deep_copy fences the device)
+  HostArray2D<Real> hsum("hst_hsum", nrows, NHISTORY_VARIABLES);
+  Kokkos::deep_copy(hsum, psum);
+  pdata->hdata_mb.assign(nmb*nhist_, 0.0);
+  for (int row=0; row<nrows; ++row) {
+    int m = row/nkj;
+    for (int n=0; n<nhist_; ++n) {
+      pdata->hdata_mb[m*nhist_ + n] += hsum(row,n);
+    }
+  }
+  for (int n=0; n<nhist_; ++n) {
+    Real tot = 0.0;
+    for (int m=0; m<nmb; ++m) {tot += pdata->hdata_mb[m*nhist_ + n];}
+    pdata->hdata[n] = tot;
+  }
+  return;
+}
+
 //----------------------------------------------------------------------------------------
 //! \fn void HistoryOutput::LoadHydroHistoryData()
 //  \brief Compute and store history data over all MeshBlocks on this rank
@@ -100,6 +171,27 @@ void HistoryOutput::LoadHydroHistoryData(HistoryData *pdata, Mesh *pm) {
   auto &size = pm->pmb_pack->pmb->mb_size;
   int &nhist_ = pdata->nhist;
 
+  // in deterministic reductions mode, sum the same per-cell contributions in a fixed
+  // tree order instead of with an unordered parallel reduction (see above)
+  if (deterministic) {
+    SumHistoryDataFixedOrder(pdata, pm,
+    KOKKOS_LAMBDA(const int m, const int k, const int j, const int i,
+                  array_sum::GlobalSum &hvars) {
+      Real vol = size.d_view(m).dx1*size.d_view(m).dx2*size.d_view(m).dx3;
+      hvars.the_array[IDN] = vol*u0_(m,IDN,k,j,i);
+      hvars.the_array[IM1] = vol*u0_(m,IM1,k,j,i);
+      hvars.the_array[IM2] = vol*u0_(m,IM2,k,j,i);
+      hvars.the_array[IM3] = vol*u0_(m,IM3,k,j,i);
+      if (eos_data.is_ideal) {
+        hvars.the_array[IEN] = vol*u0_(m,IEN,k,j,i);
+      }
+      hvars.the_array[nhydro_  ] = vol*0.5*SQR(u0_(m,IM1,k,j,i))/u0_(m,IDN,k,j,i);
+      hvars.the_array[nhydro_+1] = vol*0.5*SQR(u0_(m,IM2,k,j,i))/u0_(m,IDN,k,j,i);
+      hvars.the_array[nhydro_+2] = vol*0.5*SQR(u0_(m,IM3,k,j,i))/u0_(m,IDN,k,j,i);
+    });
+    return;
+  }
+
   // loop over all MeshBlocks in this pack
   auto &indcs = pm->pmb_pack->pmesh->mb_indcs;
   int is = indcs.is; int nx1 = indcs.nx1;
@@ -178,6 +270,25 @@ void HistoryOutput::LoadZ4cHistoryData(HistoryData *pdata, Mesh *pm) {
   auto &size = pm->pmb_pack->pmb->mb_size;
   int &nhist_ = pdata->nhist;
 
+  // in deterministic reductions mode, sum the same per-cell contributions in a fixed
+  // tree order instead of with an unordered parallel reduction (see above)
+  if (deterministic) {
+    SumHistoryDataFixedOrder(pdata, pm,
+    KOKKOS_LAMBDA(const int m, const int k, const int j, const int i,
+                  array_sum::GlobalSum &hvars) {
+      Real vol = size.d_view(m).dx1*size.d_view(m).dx2*size.d_view(m).dx3;
+      hvars.the_array[0] = vol*SQR(u_con_(m,0,k,j,i)); // ||H||^2
+      hvars.the_array[1] = vol*u_con_(m,1,k,j,i);      // ||M||^2 (comes already squared)
+      hvars.the_array[2] = vol*SQR(u_con_(m,2,k,j,i)); // ||Mx||^2
+      hvars.the_array[3] = vol*SQR(u_con_(m,3,k,j,i)); // ||My||^2
+      hvars.the_array[4] = vol*u_con_(m,4,k,j,i);      // ||Mz||^2
+      hvars.the_array[5] = vol*u_con_(m,5,k,j,i);      // ||Z||^2 (comes already squared)
+      hvars.the_array[6] = vol*SQR(u0_(m,I_Z4c_Theta_,k,j,i)); // ||Theta||^2
+      hvars.the_array[7] = vol*u_con_(m,6,k,j,i);      // ||C||^2 (comes already squared)
+    });
+    return;
+  }
+
   // loop over all MeshBlocks in this pack
   auto &indcs = pm->pmb_pack->pmesh->mb_indcs;
   int is = indcs.is; int nx1 = indcs.nx1;
@@ -264,6 +375,30 @@ void HistoryOutput::LoadMHDHistoryData(HistoryData *pdata, Mesh *pm) {
   auto &size = pm->pmb_pack->pmb->mb_size;
   int &nhist_ = pdata->nhist;
 
+  // in deterministic reductions mode, sum the same per-cell contributions in a fixed
+  // tree order instead of with an unordered parallel reduction (see above)
+  if (deterministic) {
+    SumHistoryDataFixedOrder(pdata, pm,
+    KOKKOS_LAMBDA(const int m, const int k, const int j, const int i,
+                  array_sum::GlobalSum &hvars) {
+      Real vol = size.d_view(m).dx1*size.d_view(m).dx2*size.d_view(m).dx3;
+      hvars.the_array[IDN] = vol*u0_(m,IDN,k,j,i);
+      hvars.the_array[IM1] = vol*u0_(m,IM1,k,j,i);
+      hvars.the_array[IM2] = vol*u0_(m,IM2,k,j,i);
+      hvars.the_array[IM3] = vol*u0_(m,IM3,k,j,i);
+      if (eos_data.is_ideal) {
+        hvars.the_array[IEN] = vol*u0_(m,IEN,k,j,i);
+      }
+      hvars.the_array[nmhd_  ] = vol*0.5*SQR(u0_(m,IM1,k,j,i))/u0_(m,IDN,k,j,i);
+      hvars.the_array[nmhd_+1] = vol*0.5*SQR(u0_(m,IM2,k,j,i))/u0_(m,IDN,k,j,i);
+      hvars.the_array[nmhd_+2] = vol*0.5*SQR(u0_(m,IM3,k,j,i))/u0_(m,IDN,k,j,i);
+      hvars.the_array[nmhd_+3] = vol*0.25*(SQR(bx1f(m,k,j,i+1)) + SQR(bx1f(m,k,j,i)));
+      hvars.the_array[nmhd_+4] = vol*0.25*(SQR(bx2f(m,k,j+1,i)) + SQR(bx2f(m,k,j,i)));
+      hvars.the_array[nmhd_+5] = vol*0.25*(SQR(bx3f(m,k+1,j,i)) + SQR(bx3f(m,k,j,i)));
+    });
+    return;
+  }
+
   // loop over all MeshBlocks in this pack
   auto &indcs = pm->pmb_pack->pmesh->mb_indcs;
   int is = indcs.is; int nx1 = indcs.nx1;
@@ -325,74 +460,104 @@ void HistoryOutput::LoadMHDHistoryData(HistoryData *pdata, Mesh *pm) {
 
 //----------------------------------------------------------------------------------------
 //! \fn void HistoryOutput::WriteOutputFile()
-//  \brief Cycles through hist_data vector and writes history file for each component
+//  \brief Cycles through hist_data vector and writes history file for each component.
+//  With MPI, the global sums are posted with non-blocking collectives and the file
+//  appends are deferred until the results arrive (usually on a later call), so output
+//  cadence does not synchronize ranks on the critical path.  In deterministic
+//  reductions mode the sums are instead combined blocking and in global gid order.
 
 void HistoryOutput::WriteOutputFile(Mesh *pm, ParameterInput *pin) {
-  for (auto &data : hist_data) {
-    // first, perform in-place sum over all MPI ranks
 #if MPI_PARALLEL_ENABLED
-    if (global_variable::my_rank == 0) {
-      MPI_Reduce(MPI_IN_PLACE, &(data.hdata[0]), data.nhist, MPI_ATHENA_REAL,
-         MPI_SUM, 0, MPI_COMM_WORLD);
-    } else {
-      MPI_Reduce(&(data.hdata[0]), &(data.hdata[0]), data.nhist,
-         MPI_ATHENA_REAL, MPI_SUM, 0, MPI_COMM_WORLD);
-    }
-#endif
-
-    // only the master rank writes the file
-    if (global_variable::my_rank == 0) {
-      // create filename: "file_basename" + ".physics" + ".hst"
-      // There is no file number or id in history output filenames.
-      std::string fname;
-      fname.assign(out_params.file_basename);
-      switch (data.physics) {
-        case PhysicsModule::HydroDynamics:
-          fname.append(".hydro");
-          break;
-        case PhysicsModule::MagnetoHydroDynamics:
-          fname.append(".mhd");
-          break;
-        case PhysicsModule::SpaceTimeDynamics:
-          fname.append(".z4c");
-        case PhysicsModule::UserDefined:
-          fname.append(".user");
-          break;
-        default:
-          break;
-      }
-      fname.append(".hst");
-
-      // open file for output
-      FILE *pfile;
-      if ((pfile = std::fopen(fname.c_str(),"a")) == nullptr) {
-        std::cout << "### FATAL ERROR in " << __FILE__ << " at line " << __LINE__
-          << std::endl << "Output file '" << fname << "' could not be opened" <<std::endl;
-        exit(EXIT_FAILURE);
-      }
-
-      // Write header, if it has not been written already
-      if (!(data.header_written)) {
-        int iout = 1;
-        std::fprintf(pfile,"# Athena++ history data\n");
-        std::fprintf(pfile,"#  [%d]=time      ", iout++);
-        std::fprintf(pfile,"[%d]=dt       ", iout++);
-        for (int n=0; n<data.nhist; ++n) {
-          std::fprintf(pfile,"[%d]=%.10s    ", iout++, data.label[n].c_str());
+  if (deterministic) {
+    // deterministic reductions mode: gather per-MeshBlock partial sums onto the master
+    // rank and add them in global gid order, so the result is bitwise identical for any
+    // rank count.  This collective blocks at output cadence, which is acceptable in the
+    // validation runs this mode is meant for
+    for (auto &data : hist_data) {
+      Real gsum[NHISTORY_VARIABLES] = {0.0};
+      int nmb = pm->pmb_pack->nmb_thispack;
+      if (static_cast<int>(data.hdata_mb.size()) == nmb*data.nhist) {
+        // per-rank MeshBlock lists are contiguous in gid, so gathering in rank order
+        // yields the per-block partials in global gid order
+        std::vector<int> counts(global_variable::nranks);
+        std::vector<int> disps(global_variable::nranks);
+        for (int r=0; r<(global_variable::nranks); ++r) {
+          counts[r] = (pm->nmb_eachrank[r])*data.nhist;
+          disps[r] = (pm->gids_eachrank[r])*data.nhist;
+        }
+        std::vector<Real> mbsums;
+        if (global_variable::my_rank == 0) {mbsums.resize((pm->nmb_total)*data.nhist);}
+        int ierr = MPI_Gatherv(data.hdata_mb.data(), counts[global_variable::my_rank],
+           MPI_ATHENA_REAL, mbsums.data(), counts.data(), disps.data(), MPI_ATHENA_REAL,
+           0, MPI_COMM_WORLD);
+        // Quit if MPI error detected
+        if (ierr != MPI_SUCCESS) {
+          std::cout << "### FATAL ERROR in " << __FILE__ << " at line " << __LINE__
+                    << std::endl << "MPI error in gathering history partial sums"
+                    << std::endl;
+          std::exit(EXIT_FAILURE);
+        }
+        if (global_variable::my_rank == 0) {
+          for (int m=0; m<(pm->nmb_total); ++m) {
+            for (int n=0; n<data.nhist; ++n) {gsum[n] += mbsums[m*data.nhist + n];}
+          }
+        }
+      } else {
+        // user-defined history provides only rank-local totals, so fall back to a
+        // standard (unordered) blocking sum for this component
+        for (int n=0; n<data.nhist; ++n) {gsum[n] = data.hdata[n];}
+        int ierr = MPI_Allreduce(MPI_IN_PLACE, gsum, data.nhist, MPI_ATHENA_REAL,
+                                 MPI_SUM, MPI_COMM_WORLD);
+        // Quit if MPI error detected
+        if (ierr != MPI_SUCCESS) {
+          std::cout << "### FATAL ERROR in " << __FILE__ << " at line " << __LINE__
+                    << std::endl << "MPI error in blocking reduction"
+                    << std::endl;
+          std::exit(EXIT_FAILURE);
         }
-        std::fprintf(pfile,"\n");                              // terminate line
-        data.header_written = true;
       }
+      WriteHistoryRecord(data, pm->time, pm->dt, gsum);
+    }
+
+    // increment counters, clean up
+    if (out_params.last_time < 0.0) {
+      out_params.last_time = pm->time;
+    } else {
+      out_params.last_time += out_params.dt;
+    }
+    pin->SetReal(out_params.block_name, "last_time", out_params.last_time);
+    return;
+  }
 
-      // write history variables
-      std::fprintf(pfile, out_params.data_format.c_str(), pm->time);
-      std::fprintf(pfile, out_params.data_format.c_str(), pm->dt);
-      for (int n=0; n<data.nhist; ++n)
-        std::fprintf(pfile, out_params.data_format.c_str(), data.hdata[n]);
-      std::fprintf(pfile,"\n"); // terminate line
-      std::fclose(pfile);
+  // post non-blocking in-place sum over all MPI ranks for each component, and queue
+  // record for deferred append.  Per-rank sums in hdata are copied into the pending
+  // record so hist_data can be safely overwritten on the next output time.
+  int indx = 0;
+  for (auto &data : hist_data) {
+    pending_hist.emplace_back();
+    PendingHistory &precord = pending_hist.back();
+    precord.indx = indx++;
+    precord.time = pm->time;
+    precord.dt = pm->dt;
+    for (int n=0; n<data.nhist; ++n) {precord.hdata[n] = data.hdata[n];}
+    int ierr = MPI_Iallreduce(MPI_IN_PLACE, &(precord.hdata[0]), data.nhist,
+       MPI_ATHENA_REAL, MPI_SUM, MPI_COMM_WORLD, &(precord.req));
+    // Quit if MPI error detected
+    if (ierr != MPI_SUCCESS) {
+      std::cout << "### FATAL ERROR in " << __FILE__ << " at line " << __LINE__
+                << std::endl << "MPI error in posting non-blocking reduction"
+                << std::endl;
+      std::exit(EXIT_FAILURE);
     }
-  } // End loop over hist_data vector
+  }
+
+  // append any queued records whose reductions have since completed
+  FlushPendingHistory(false);
+#else
+  for (auto &data : hist_data) {
+    WriteHistoryRecord(data, pm->time, pm->dt, &(data.hdata[0]));
+  }
+#endif
 
   // increment counters, clean up
   if (out_params.last_time < 0.0) {
@@ -403,3 +568,105 @@ void HistoryOutput::WriteOutputFile(Mesh *pm, ParameterInput *pin) {
   pin->SetReal(out_params.block_name, "last_time", out_params.last_time);
   return;
 }
+
+#if MPI_PARALLEL_ENABLED
+//----------------------------------------------------------------------------------------
+//! \fn void HistoryOutput::FlushPendingHistory()
+//  \brief Appends queued history records whose global sums have completed.  Records are
+//  appended strictly in the order posted so files remain time-ordered; testing stops at
+//  the first record still in flight.  When block=true, waits for every pending record
+//  (used by the destructor so no records are lost at the end of a run).
+
+void HistoryOutput::FlushPendingHistory(bool block) {
+  while (!(pending_hist.empty())) {
+    PendingHistory &precord = pending_hist.front();
+    int test;
+    int ierr;
+    if (block) {
+      ierr = MPI_Wait(&(precord.req), MPI_STATUS_IGNORE);
+      test = 1;
+    } else {
+      ierr = MPI_Test(&(precord.req), &test, MPI_STATUS_IGNORE);
+    }
+    // Quit if MPI error detected
+    if (ierr != MPI_SUCCESS) {
+      std::cout << "### FATAL ERROR in " << __FILE__ << " at line " << __LINE__
+                << std::endl << "MPI error in testing non-blocking reduction"
+                << std::endl;
+      std::exit(EXIT_FAILURE);
+    }
+    if (!(static_cast<bool>(test))) {return;}
+    WriteHistoryRecord(hist_data[precord.indx], precord.time, precord.dt,
+                       &(precord.hdata[0]));
+    pending_hist.pop_front();
+  }
+  return;
+}
+#endif
+
+//----------------------------------------------------------------------------------------
+//! \fn void HistoryOutput::WriteHistoryRecord()
+//  \brief Appends one line of globally-summed history data to the file for the given
+//  physics component (only the master rank writes).  The line is formatted in memory
+//  and handed to the background text appender, so a slow filesystem never stalls the
+//  time-step loop.
+
+void HistoryOutput::WriteHistoryRecord(HistoryData &data, Real time, Real dt,
+                                       const Real *hdata) {
+  // only the master rank writes the file
+  if (global_variable::my_rank == 0) {
+    // create filename: "file_basename" + ".physics" + ".hst"
+    // There is no file number or id in history output filenames.
+    std::string fname;
+    fname.assign(out_params.file_basename);
+    switch (data.physics) {
+      case PhysicsModule::HydroDynamics:
+        fname.append(".hydro");
+        break;
+      case PhysicsModule::MagnetoHydroDynamics:
+        fname.append(".mhd");
+        break;
+      case PhysicsModule::SpaceTimeDynamics:
+        fname.append(".z4c");
+      case PhysicsModule::UserDefined:
+        fname.append(".user");
+        break;
+      default:
+        break;
+    }
+    fname.append(".hst");
+
+    // format record in memory; actual append is done by the background writer thread
+    std::string record;
+    char buf[64];
+
+    // Write header, if it has not been written already
+    if (!(data.header_written)) {
+      int iout = 1;
+      record.append("# Athena++ history data\n");
+      std::snprintf(buf, sizeof(buf), "#  [%d]=time      ", iout++);
+      record.append(buf);
+      std::snprintf(buf, sizeof(buf), "[%d]=dt       ", iout++);
+      record.append(buf);
+      for (int n=0; n<data.nhist; ++n) {
+        std::snprintf(buf, sizeof(buf), "[%d]=%.10s    ", iout++, data.label[n].c_str());
+        record.append(buf);
+      }
+      record.append("\n");                                   // terminate line
+      data.header_written = true;
+    }
+
+    // write history variables
+    std::snprintf(buf, sizeof(buf), out_params.data_format.c_str(), time);
+    record.append(buf);
+    std::snprintf(buf, sizeof(buf), out_params.data_format.c_str(), dt);
+    record.append(buf);
+    for (int n=0; n<data.nhist; ++n) {
+      std::snprintf(buf, sizeof(buf), out_params.data_format.c_str(), hdata[n]);
+      record.append(buf);
+    }
+    record.append("\n"); // terminate line
+    appender::Append(fname, record);
+  }
+  return;
+}
@@ -6,13 +6,16 @@
 //! \file io_wrapper.cpp
 //! \brief functions that provide wrapper for MPI-IO versus serial input/output
 
+#include <algorithm>
 #include <cstdio>
 #include <cstdlib>
+#include <cstring>
 #include <iomanip>
 #include <iostream>
 #include <sstream>
 #include <stdexcept>
 #include <string>
+#include <vector>
 
 #include "athena.hpp"
 #include "io_wrapper.hpp"
@@ -450,6 +453,89 @@ std::size_t IOWrapper::Write_any_type_at_all(const void *buf, IOWrapperSizeT cnt
 #endif
 }
 
+//----------------------------------------------------------------------------------------
+//! \fn std::size_t IOWrapper::Write_bytes_aggregated()
+//! \brief two-phase collective write of one contiguous block of bytes per rank.  A
+//! subset of naggr aggregator ranks (the first rank of each group of consecutive ranks)
+//! gather the payloads of their group over MPI into windows aligned to 'stripe' bytes,
+//! and issue one large write per window.  Intended for files where the regions of
+//! consecutive ranks form a non-overlapping ascending sequence (as in restart files,
+//! where each rank writes its MeshBlocks contiguously).  Must be called by every rank
+//! in the communicator.  Without MPI this reduces to a seek+write.  Returns number of
+//! bytes from this rank written (on non-aggregator ranks, number of bytes sent).
+
+std::size_t IOWrapper::Write_bytes_aggregated(const void *buf, IOWrapperSizeT cnt,
+                                              IOWrapperSizeT offset, int naggr,
+                                              IOWrapperSizeT stripe) {
+#if MPI_PARALLEL_ENABLED
+  int nranks, my_rank;
+  MPI_Comm_size(comm_, &nranks);
+  MPI_Comm_rank(comm_, &my_rank);
+  naggr = std::max(1, std::min(naggr, nranks));
+  if (stripe == 0) {stripe = 4194304;}  // default 4 MiB aggregation windows
+  stripe = std::min(stripe, static_cast<IOWrapperSizeT>(1073741824));
+
+  // gather (offset, count) of every rank so group extents are known everywhere
+  IOWrapperSizeT myreg[2] = {offset, cnt};
+  std::vector<IOWrapperSizeT> regions(2*nranks);
+  MPI_Allgather(myreg, 2, MPI_UINT64_T, regions.data(), 2, MPI_UINT64_T, comm_);
+
+  // consecutive ranks are grouped; first rank in each group is its aggregator
+  int group = (my_rank*naggr)/nranks;
+  int agg_rank  = (group*nranks + naggr - 1)/naggr;      // first rank in this group
+  int next_rank = ((group+1)*nranks + naggr - 1)/naggr;  // first rank in next group
+
+  // file extent spanned by this group
+  IOWrapperSizeT gbeg = regions[2*agg_rank];
+  IOWrapperSizeT gend = regions[2*(next_rank-1)] + regions[2*(next_rank-1)+1];
+
+  // Iterate over stripe-aligned windows spanning the group extent.  Every rank in the
+  // group loops over the same windows, so sends and receives stay matched.
+  std::size_t nwritten = 0;
+  std::vector<char> wbuf;
+  if (my_rank == agg_rank) {wbuf.resize(stripe);}
+  for (IOWrapperSizeT w0 = (gbeg/stripe)*stripe; w0 < gend; w0 += stripe) {
+    IOWrapperSizeT w1 = std::min(w0 + stripe, gend);
+    // overlap of this rank's region with the window
+    IOWrapperSizeT mybeg = std::max(w0, offset);
+    IOWrapperSizeT myend = std::min(w1, offset + cnt);
+    if (my_rank == agg_rank) {
+      // phase 1: gather overlapping pieces from all ranks in group (self by memcpy)
+      for (int r=agg_rank; r<next_rank; ++r) {
+        IOWrapperSizeT rbeg = std::max(w0, regions[2*r]);
+        IOWrapperSizeT rend = std::min(w1, regions[2*r] + regions[2*r+1]);
+        if (rend <= rbeg) {continue;}
+        if (r == my_rank) {
+          std::memcpy(&(wbuf[rbeg-w0]),
+                      static_cast<const char*>(buf) + (mybeg-offset), rend-rbeg);
+        } else {
+          MPI_Recv(&(wbuf[rbeg-w0]), static_cast<int>(rend-rbeg), MPI_BYTE, r, 0,
+                   comm_, MPI_STATUS_IGNORE);
+        }
+      }
+      // phase 2: one large aligned write per window (only valid file bytes)
+      IOWrapperSizeT obeg = std::max(w0, gbeg);
+      if (Write_any_type_at(&(wbuf[obeg-w0]), (w1-obeg), obeg, "byte") != (w1-obeg)) {
+        return nwritten;
+      }
+      nwritten += (myend > mybeg)? (myend-mybeg) : 0;
+    } else {
+      // phase 1 on non-aggregator ranks: send overlapping piece to aggregator
+      if (myend > mybeg) {
+        MPI_Send(static_cast<const char*>(buf) + (mybeg-offset),
+                 static_cast<int>(myend-mybeg), MPI_BYTE, agg_rank, 0, comm_);
+        nwritten += (myend-mybeg);
+      }
+    }
+  }
+  return nwritten;
+#else
+  // without MPI aggregation is meaningless; just seek and write
+  std::fseek(fh_, offset, SEEK_SET);
+  return std::fwrite(buf,sizeof(char),cnt,fh_);
+#endif
+}
+
 //----------------------------------------------------------------------------------------
 //! \fn void IOWrapper::Close()
 //  \brief wrapper for {MPI_File_close} versus {std::fclose}
@@ -45,6 +45,9 @@ class IOWrapper {
                                 IOWrapperSizeT offset, std::string type);
   std::size_t Write_any_type_at_all(const void *buf, IOWrapperSizeT count,
                                     IOWrapperSizeT offset, std::string type);
+  std::size_t Write_bytes_aggregated(const void *buf, IOWrapperSizeT count,
+                                     IOWrapperSizeT offset, int naggr,
+                                     IOWrapperSizeT stripe);
   std::size_t Read_Reals(void *buf, IOWrapperSizeT count);
   std::size_t Read_Reals_at(void *buf, IOWrapperSizeT count, IOWrapperSizeT offset);
   std::size_t Read_Reals_at_all(void *buf, IOWrapperSizeT count, IOWrapperSizeT offset);
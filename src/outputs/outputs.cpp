@@ -39,6 +39,7 @@
 //! comment text: 'NEW_OUTPUT_TYPES'.
 //========================================================================================
 
+#include <algorithm>  // find
 #include <cstdio>
 #include <cstdlib>
 #include <cstring>    // strcmp
@@ -46,11 +47,14 @@
 #include <iostream>
 #include <sstream>
 #include <string>   // std::string, to_string()
+#include <utility>  // pair, make_pair
+#include <vector>
 
 #include "athena.hpp"
 #include "parameter_input.hpp"
 #include "mesh/mesh.hpp"
 #include "outputs.hpp"
+#include "text_appender.hpp"
 
 //----------------------------------------------------------------------------------------
 // Outputs constructor
@@ -59,7 +63,7 @@ Outputs::Outputs(ParameterInput *pin, Mesh *pm) {
   // loop over input block names.  Find those that start with "output", read parameters,
   // and add to linked list of BaseTypeOutputs.
 
-  int num_hst=0, num_rst=0, num_log=0; // count # of hst,rst,log outputs
+  int num_hst=0, num_rst=0, num_log=0, num_shdw=0; // count # of hst,rst,log,shadow
   for (auto it = pin->block.begin(); it != pin->block.end(); ++it) {
     if (it->block_name.compare(0, 6, "output") == 0) {
       OutputParameters opar;  // define temporary OutputParameters struct
@@ -161,6 +165,48 @@ Outputs::Outputs(ParameterInput *pin, Mesh *pm) {
         opar.slice3 = false;
       }
 
+      // read region-of-interest options.  Only MeshBlocks intersecting the region are
+      // output.  A spherical region is specified with 'roi_radius' about
+      // ('roi_x1c','roi_x2c','roi_x3c'); a box with 'roi_x1min'/'roi_x1max' (etc.),
+      // with unspecified directions spanning the whole mesh
+      if (pin->DoesParameterExist(opar.block_name,"roi_radius")) {
+        opar.roi = true;
+        opar.roi_sphere = true;
+        opar.roi_rad = pin->GetReal(opar.block_name,"roi_radius");
+        opar.roi_x1c = pin->GetOrAddReal(opar.block_name,"roi_x1c",0.0);
+        opar.roi_x2c = pin->GetOrAddReal(opar.block_name,"roi_x2c",0.0);
+        opar.roi_x3c = pin->GetOrAddReal(opar.block_name,"roi_x3c",0.0);
+        if (opar.roi_rad <= 0.0) {
+          std::cout << "### FATAL ERROR in " << __FILE__ << " at line " << __LINE__
+              << std::endl << "roi_radius=" << opar.roi_rad << " in output block '"
+              << opar.block_name << "' must be positive" << std::endl;
+          exit(EXIT_FAILURE);
+        }
+      } else if (pin->DoesParameterExist(opar.block_name,"roi_x1min") ||
+                 pin->DoesParameterExist(opar.block_name,"roi_x2min") ||
+                 pin->DoesParameterExist(opar.block_name,"roi_x3min")) {
+        opar.roi = true;
+        opar.roi_x1min = pin->GetOrAddReal(opar.block_name,"roi_x1min",
+                                           pm->mesh_size.x1min);
+        opar.roi_x1max = pin->GetOrAddReal(opar.block_name,"roi_x1max",
+                                           pm->mesh_size.x1max);
+        opar.roi_x2min = pin->GetOrAddReal(opar.block_name,"roi_x2min",
+                                           pm->mesh_size.x2min);
+        opar.roi_x2max = pin->GetOrAddReal(opar.block_name,"roi_x2max",
+                                           pm->mesh_size.x2max);
+        opar.roi_x3min = pin->GetOrAddReal(opar.block_name,"roi_x3min",
+                                           pm->mesh_size.x3min);
+        opar.roi_x3max = pin->GetOrAddReal(opar.block_name,"roi_x3max",
+                                           pm->mesh_size.x3max);
+        if ((opar.roi_x1min >= opar.roi_x1max) || (opar.roi_x2min >= opar.roi_x2max) ||
+            (opar.roi_x3min >= opar.roi_x3max)) {
+          std::cout << "### FATAL ERROR in " << __FILE__ << " at line " << __LINE__
+              << std::endl << "Region-of-interest box in output block '"
+              << opar.block_name << "' is empty (min >= max)" << std::endl;
+          exit(EXIT_FAILURE);
+        }
+      }
+
       // read ghost cell option
       opar.include_gzs = pin->GetOrAddBoolean(opar.block_name, "ghost_zones", false);
 
@@ -214,6 +260,44 @@ Outputs::Outputs(ParameterInput *pin, Mesh *pm) {
         }
       }
 
+      // read asynchronous write option.  Only used by 'bin' and 'vtk' outputs, which
+      // can perform file writes from a background host thread
+      opar.async = pin->GetOrAddBoolean(opar.block_name, "async", false);
+
+      // read windowed time-average option: output variables are accumulated on the
+      // device every cycle and only the average over the window since the previous
+      // dump is written.  Only grid outputs load data through the base LoadOutputData,
+      // so reject output types with their own loading path
+      opar.time_average = pin->GetOrAddBoolean(opar.block_name, "time_average", false);
+      if (opar.time_average &&
+          (opar.file_type.compare("hst") == 0 || opar.file_type.compare("rst") == 0 ||
+           opar.file_type.compare("log") == 0 || opar.file_type.compare("trk") == 0 ||
+           opar.file_type.compare("shadow_rst") == 0 ||
+           opar.file_type.compare("pvtk") == 0)) {
+        std::cout << "### FATAL ERROR in " << __FILE__ << " at line " << __LINE__
+            << std::endl << "time_average=true in output block '" << opar.block_name
+            << "' is not supported for file_type='" << opar.file_type << "'" <<std::endl;
+        exit(EXIT_FAILURE);
+      }
+
+      // read temporal interpolation option: dumps are synthesized at the exact
+      // requested output times from the two bracketing states instead of carrying the
+      // (overshooting) state of the first cycle past them.  Same restrictions as
+      // time_average, which shares the buffer-redirect machinery and conflicts with it
+      opar.time_interp = pin->GetOrAddBoolean(opar.block_name, "time_interp", false);
+      if (opar.time_interp &&
+          (opar.time_average || opar.dt <= 0.0 ||
+           opar.file_type.compare("hst") == 0 || opar.file_type.compare("rst") == 0 ||
+           opar.file_type.compare("log") == 0 || opar.file_type.compare("trk") == 0 ||
+           opar.file_type.compare("shadow_rst") == 0 ||
+           opar.file_type.compare("pvtk") == 0)) {
+        std::cout << "### FATAL ERROR in " << __FILE__ << " at line " << __LINE__
+            << std::endl << "time_interp=true in output block '" << opar.block_name
+            << "' requires 'dt' > 0 and is not supported for file_type='"
+            << opar.file_type << "' or combined with time_average" << std::endl;
+        exit(EXIT_FAILURE);
+      }
+
       // set optional data format string used in formatted writes
       opar.data_format = pin->GetOrAddString(opar.block_name, "data_format", "%12.5e");
       opar.data_format.insert(0, " "); // prepend with blank to separate columns
@@ -239,12 +323,20 @@ Outputs::Outputs(ParameterInput *pin, Mesh *pm) {
         pnode = new ParticleVTKOutput(pin,pm,opar);
         pout_list.insert(pout_list.begin(),pnode);
       } else if (opar.file_type.compare("trk") == 0) {
+        opar.trk_flush_every = pin->GetOrAddInteger(opar.block_name,"flush_every",16);
+        if (opar.trk_flush_every <= 0) {
+          std::cout << "### FATAL ERROR in " << __FILE__ << " at line " << __LINE__
+             << std::endl << "flush_every must be > 0 in output block '"
+             << opar.block_name << "'" << std::endl;
+          exit(EXIT_FAILURE);
+        }
         pnode = new TrackedParticleOutput(pin,pm,opar);
         pout_list.insert(pout_list.begin(),pnode);
       } else if (opar.file_type.compare("cbin") == 0) {
         opar.coarsen_factor = pin->GetInteger(opar.block_name,"coarsen_factor");
         opar.compute_moments = pin->GetOrAddBoolean(opar.block_name,
           "compute_moments", false);
+        opar.preview = pin->GetOrAddBoolean(opar.block_name,"preview",false);
         pnode = new CoarsenedBinaryOutput(pin,pm,opar);
         pout_list.insert(pout_list.begin(),pnode);
       } else if (opar.file_type.compare("pdf") == 0) {
@@ -269,15 +361,78 @@ Outputs::Outputs(ParameterInput *pin, Mesh *pm) {
         }
         pnode = new PDFOutput(pin,pm,opar);
         pout_list.insert(pout_list.begin(),pnode);
+      } else if (opar.file_type.compare("clump") == 0) {
+        pnode = new ClumpFinderOutput(pin,pm,opar);
+        pout_list.insert(pout_list.begin(),pnode);
+      } else if (opar.file_type.compare("img") == 0) {
+        opar.img_axis = pin->GetOrAddInteger(opar.block_name,"axis",3);
+        opar.img_res1 = pin->GetOrAddInteger(opar.block_name,"res1",0);
+        opar.img_res2 = pin->GetOrAddInteger(opar.block_name,"res2",0);
+        opar.img_logscale = pin->GetOrAddBoolean(opar.block_name,"logscale",true);
+        if (pin->DoesParameterExist(opar.block_name,"img_min")) {
+          opar.img_min = pin->GetReal(opar.block_name,"img_min");
+          opar.img_max = pin->GetReal(opar.block_name,"img_max");
+          opar.img_fixed_scale = true;
+        }
+        pnode = new RenderOutput(pin,pm,opar);
+        pout_list.insert(pout_list.begin(),pnode);
       } else if (opar.file_type.compare("bin") == 0) {
         pnode = new MeshBinaryOutput(pin,pm,opar);
         pout_list.insert(pout_list.begin(),pnode);
+      } else if (opar.file_type.compare("zbin") == 0) {
+        // number of float mantissa bits kept before compression (23 = lossless)
+        opar.mantissa_bits = pin->GetOrAddInteger(opar.block_name,"mantissa_bits",23);
+        if (opar.mantissa_bits < 0 || opar.mantissa_bits > 23) {
+          std::cout << "### FATAL ERROR in " << __FILE__ << " at line " << __LINE__
+              << std::endl << "mantissa_bits=" << opar.mantissa_bits << " in output "
+              << "block '" << opar.block_name << "' must be in range [0,23]" <<std::endl;
+          exit(EXIT_FAILURE);
+        }
+        pnode = new MeshCompressedBinaryOutput(pin,pm,opar);
+        pout_list.insert(pout_list.begin(),pnode);
+      } else if (opar.file_type.compare("strm") == 0) {
+        // streaming output to a concurrently-running analysis consumer; frames carry
+        // the same records as 'bin' outputs and spill to files under backpressure
+        opar.stream_host = pin->GetOrAddString(opar.block_name,"stream_host",
+                                               "127.0.0.1");
+        opar.stream_port = pin->GetInteger(opar.block_name,"stream_port");
+        opar.stall_ms = pin->GetOrAddInteger(opar.block_name,"stall_ms",250);
+        if (opar.stream_port <= 0 || opar.stall_ms < 0) {
+          std::cout << "### FATAL ERROR in " << __FILE__ << " at line " << __LINE__
+             << std::endl << "stream_port must be > 0 and stall_ms must be >= 0 in "
+             << "output block '" << opar.block_name << "'" << std::endl;
+          exit(EXIT_FAILURE);
+        }
+        pnode = new MeshStreamOutput(pin,pm,opar);
+        pout_list.insert(pout_list.begin(),pnode);
       } else if (opar.file_type.compare("rst") == 0) {
       // Add restarts to the tail end of BaseTypeOutput list, so file counters for other
       // output types are up-to-date in restart file
+        opar.naggr = pin->GetOrAddInteger(opar.block_name,"naggr",0);
+        opar.stripe_size = pin->GetOrAddInteger(opar.block_name,"stripe_size",4194304);
+        opar.full_every = pin->GetOrAddInteger(opar.block_name,"full_every",0);
+        opar.checksum = pin->GetOrAddBoolean(opar.block_name,"checksum",true);
+        if (opar.naggr < 0 || opar.stripe_size <= 0 || opar.full_every < 0) {
+          std::cout << "### FATAL ERROR in " << __FILE__ << " at line " << __LINE__
+             << std::endl << "naggr and full_every must be >= 0 and stripe_size must "
+             << "be > 0 in output block '" << opar.block_name << "'" << std::endl;
+          exit(EXIT_FAILURE);
+        }
         pnode = new RestartOutput(pin,pm,opar);
         pout_list.push_back(pnode);
         num_rst++;
+      } else if (opar.file_type.compare("shadow_rst") == 0) {
+      // In-memory shadow checkpoints refreshed every 'dcycle' cycles; no files written
+      // except on SIGTERM.  Added to tail of list for same reason as restarts above
+        if (opar.dcycle <= 0) {
+          std::cout << "### FATAL ERROR in " << __FILE__ << " at line " << __LINE__
+             << std::endl << "shadow_rst outputs require 'dcycle' > 0 in output block '"
+             << opar.block_name << "'" << std::endl;
+          exit(EXIT_FAILURE);
+        }
+        pnode = new ShadowRestartOutput(pin,pm,opar);
+        pout_list.push_back(pnode);
+        num_shdw++;
       } else {
         std::cout << "### FATAL ERROR in " << __FILE__ << " at line " << __LINE__
             << std::endl << "Unrecognized file format = '" << opar.file_type
@@ -287,11 +442,12 @@ Outputs::Outputs(ParameterInput *pin, Mesh *pm) {
     }
   }
 
-  // check there were no more than one history, event log, or restart files requested
-  if (num_hst > 1 || num_rst > 1 || num_log > 1) {
+  // check there were no more than one history, event log, restart, or shadow restart
+  // files requested
+  if (num_hst > 1 || num_rst > 1 || num_log > 1 || num_shdw > 1) {
     std::cout << "### FATAL ERROR in " << __FILE__ << " at line " << __LINE__ << std::endl
-              << "More than one history, event log, or restart output block found in "
-              << "input file" << std::endl;
+              << "More than one history, event log, restart, or shadow restart output "
+              << "block found in input file" << std::endl;
     exit(EXIT_FAILURE);
   }
 }
@@ -305,4 +461,112 @@ Outputs::~Outputs() {
     delete pnode;
   }
   pout_list.clear();
+  // drain any text appends queued by the destructors above (e.g. final history records)
+  // and join the background writer thread
+  appender::Quit();
+}
+
+//----------------------------------------------------------------------------------------
+//! \fn void Outputs::SnapshotOutputData()
+//! \brief copies the union of device variables registered by the grid outputs in
+//! outs_due into the shared shadow buffer, then redirects each of their outvars at the
+//! shadow.  A variable registered by several outputs (e.g. 'bin' and 'vtk' dumps of the
+//! same primitives) is copied once.  Derived variables are computed from the live
+//! arrays first, so the shadow holds a complete, consistent snapshot and the load/write
+//! phase that follows never touches evolution data.  Output types with their own
+//! loading path (hst, rst, pdf, ...) and those already reading a private stable buffer
+//! (time_average, time_interp) are left alone and handled as before.
+
+void Outputs::SnapshotOutputData(Mesh *pm, std::vector<BaseTypeOutput *> &outs_due) {
+  // select due grid outputs whose outvars reference live evolution arrays
+  snap_outs.clear();
+  for (auto &out : outs_due) {
+    auto &op = out->out_params;
+    if (op.time_average || op.time_interp) continue;
+    if (op.file_type.compare("hst") == 0 || op.file_type.compare("rst") == 0 ||
+        op.file_type.compare("log") == 0 || op.file_type.compare("trk") == 0 ||
+        op.file_type.compare("shadow_rst") == 0 ||
+        op.file_type.compare("pvtk") == 0 ||
+        op.file_type.compare("pdf") == 0 ||
+        op.file_type.compare("img") == 0 ||
+        op.file_type.compare("clump") == 0) continue;
+    if (out->outvars.empty()) continue;
+    snap_outs.push_back(out);
+  }
+  if (snap_outs.empty()) return;
+
+  // derived variables are computed from the live arrays, so fill each output's
+  // derived_var buffer before the snapshot is taken (the load phase then skips the
+  // recomputation, see BaseTypeOutput::LoadOutputData())
+  for (auto &out : snap_outs) {
+    if (out->out_params.contains_derived) {
+      out->ComputeDerivedVariable(out->out_params.variable, pm);
+    }
+  }
+
+  // build union of distinct (device array, variable index) sources across outputs
+  std::vector<std::pair<DvceArray5D<Real> *, int>> srcs;
+  for (auto &out : snap_outs) {
+    for (auto &v : out->outvars) {
+      std::pair<DvceArray5D<Real> *, int> src(v.data_ptr, v.data_index);
+      if (std::find(srcs.begin(), srcs.end(), src) == srcs.end()) {
+        srcs.push_back(src);
+      }
+    }
+  }
+
+  // (re-)allocate shadow; dims change only with AMR or a different set of due outputs
+  auto &indcs = pm->mb_indcs;
+  int nmb = pm->pmb_pack->nmb_thispack;
+  int nslots = static_cast<int>(srcs.size());
+  int ncells1 = indcs.nx1 + 2*(indcs.ng);
+  int ncells2 = (indcs.nx2 > 1)? (indcs.nx2 + 2*(indcs.ng)) : 1;
+  int ncells3 = (indcs.nx3 > 1)? (indcs.nx3 + 2*(indcs.ng)) : 1;
+  if (snap_var.extent_int(0) != nmb     || snap_var.extent_int(1) != nslots ||
+      snap_var.extent_int(2) != ncells3 || snap_var.extent_int(3) != ncells2 ||
+      snap_var.extent_int(4) != ncells1) {
+    Kokkos::realloc(snap_var, nmb, nslots, ncells3, ncells2, ncells1);
+  }
+
+  // one asynchronous device-side copy per distinct variable; the single fence below is
+  // the only point where the output path synchronizes against the evolution arrays
+  auto mrange = std::make_pair(0, nmb);
+  auto krange = std::make_pair(0, ncells3);
+  auto jrange = std::make_pair(0, ncells2);
+  auto irange = std::make_pair(0, ncells1);
+  for (int s=0; s<nslots; ++s) {
+    auto src = Kokkos::subview(*(srcs[s].first), mrange, srcs[s].second,
+                               krange, jrange, irange);
+    auto dst = Kokkos::subview(snap_var, mrange, s, krange, jrange, irange);
+    Kokkos::deep_copy(DevExeSpace(), dst, src);
+  }
+  Kokkos::fence();
+
+  // redirect each output's outvars at the shadow, saving the original sources
+  for (auto &out : snap_outs) {
+    out->snap_srcs = out->outvars;
+    for (auto &v : out->outvars) {
+      std::pair<DvceArray5D<Real> *, int> src(v.data_ptr, v.data_index);
+      int s = static_cast<int>(std::find(srcs.begin(), srcs.end(), src)-srcs.begin());
+      v.data_index = s;
+      v.data_ptr = &snap_var;
+    }
+  }
+  return;
+}
+
+//----------------------------------------------------------------------------------------
+//! \fn void Outputs::RestoreOutputData()
+//! \brief points outvars of every output redirected by SnapshotOutputData() back at the
+//! live device arrays.  Called once the load/write phase of the cycle has consumed the
+//! snapshot; asynchronous writers capture host buffers, so writes still in flight are
+//! unaffected
+
+void Outputs::RestoreOutputData() {
+  for (auto &out : snap_outs) {
+    out->outvars = out->snap_srcs;
+    out->snap_srcs.clear();
+  }
+  snap_outs.clear();
+  return;
 }
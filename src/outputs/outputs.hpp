@@ -8,13 +8,20 @@
 //! \file outputs.hpp
 //  \brief provides classes to handle ALL types of data output
 
+#include <array>
+#include <cstdint>
+#include <list>
+#include <map>
 #include <string>
+#include <thread>
+#include <utility>
 #include <vector>
 
 #include "Kokkos_ScatterView.hpp"
 
 #include "athena.hpp"
 #include "io_wrapper.hpp"
+#include "mesh/mesh.hpp"
 
 #define NHISTORY_VARIABLES 12
 #if NHISTORY_VARIABLES > NREDUCTION_VARIABLES
@@ -99,9 +106,21 @@ static const char *var_choice[NOUTPUT_CHOICES] = {
   "prtcl_all", "prtcl_d"
 };
 
+#define NFUSED_DERIVED_CHOICES 11
+// derived quantities that may be combined into a comma-separated list in the 'variable'
+// parameter (e.g. 'mhd_wz,mhd_j2,mhd_bmag').  Every quantity in such a list is computed
+// by one fused kernel that reads the w0/bcc0 stencils once per cell, instead of one
+// full-grid pass per quantity (see ComputeDerivedFused in derived_variables.cpp)
+static const char *fused_derived_choice[NFUSED_DERIVED_CHOICES] = {
+  "hydro_wz", "hydro_w2",
+  "mhd_wz",   "mhd_w2",        "mhd_jz",   "mhd_j2", "mhd_curv", "mhd_curv_alt",
+  "mhd_k_jxb", "mhd_curv_perp", "mhd_bmag"
+};
+
 
 // forward declarations
 class Mesh;
+class MeshBoundaryValuesCC;
 class ParameterInput;
 
 //----------------------------------------------------------------------------------------
@@ -123,13 +142,57 @@ struct OutputParameters {
   int gid;
   bool slice1, slice2, slice3;
   Real slice_x1, slice_x2, slice_x3;
+  // region-of-interest parameters: when 'roi' is true only MeshBlocks intersecting a
+  // box (roi_sphere=false) or sphere (roi_sphere=true) given in physical coordinates
+  // are output.  The intersecting set is recomputed every dump, so it tracks the
+  // region across AMR regridding
+  bool roi=false;
+  bool roi_sphere=false;
+  Real roi_x1min, roi_x1max, roi_x2min, roi_x2max, roi_x3min, roi_x3max;
+  Real roi_rad, roi_x1c, roi_x2c, roi_x3c;
   bool user_hist_only;
+  bool async;                 // write bin/vtk files from a background host thread
   std::string data_format;
   bool contains_derived=false;
+  // windowed time averaging: accumulate the output variables (including derived ones
+  // like stresses) into a device buffer every cycle and write only the average over
+  // the window since the previous dump
+  bool time_average=false;
+  // temporal interpolation: synthesize each dump at the exact requested output time by
+  // linearly combining the two states bracketing it, so the timestep never needs to be
+  // adjusted to land a cycle on an output time
+  bool time_interp=false;
   // DBF parameters for coarsened binary:
   // cannot be less than 2 and must be a power of 2 and
   // cannot be greater than shortest meshblock dimension
   int coarsen_factor;
+  // preview mode for 'cbin': dump the SMR/AMR coarse arrays (coarse_u0/coarse_w0)
+  // directly instead of volume-averaging the fine arrays, for cheap high-cadence
+  // monitoring dumps; requires coarsen_factor=2 and a multilevel mesh
+  bool preview=false;
+  // parameters for two-phase aggregated restart ('rst') writes:
+  // number of aggregator ranks (0 = standard collective writes) and size in bytes of
+  // the aligned aggregation windows (set to a multiple of the Lustre stripe size)
+  int naggr=0;
+  int stripe_size=4194304;
+  // number of checkpoints between full restart dumps; in between, incremental delta
+  // dumps (.drst files) are written instead (0 = every dump is a full restart file)
+  int full_every=0;
+  // append per-MeshBlock payload checksums to full restart dumps, verified on restart
+  // (see utils/restart_checksum.hpp)
+  bool checksum=true;
+  // parameter for tracked particle ('trk') outputs: number of output cadences buffered
+  // in host memory before each flush to this rank's binary log
+  int trk_flush_every=16;
+  // parameters for compressed binary ('zbin') outputs:
+  // number of float mantissa bits kept before compression (23 = lossless)
+  int mantissa_bits=23;
+  // parameters for streaming ('strm') outputs: TCP endpoint of the analysis consumer
+  // and the per-dump backpressure budget in milliseconds before the frame is spilled
+  // to a file instead of stalling the simulation
+  std::string stream_host;
+  int stream_port=0;
+  int stall_ms=250;
   bool compute_moments; // if true then will compute
   // <q>, <q^2>, <q^3>, <q^4> for each variable q
   // DBF parameters for PDF:
@@ -141,6 +204,14 @@ struct OutputParameters {
   int nbin=0, nbin2=0;
   bool logscale=true, logscale2=true;
   bool mass_weighted=false;
+  // parameters for rendered image ('img') outputs: axis along which rays are
+  // integrated, image resolution (0 = root grid), and color scale (fixed range via
+  // img_min/img_max, otherwise auto-scaled each frame)
+  int img_axis=3;
+  int img_res1=0, img_res2=0;
+  Real img_min=0.0, img_max=1.0;
+  bool img_fixed_scale=false;
+  bool img_logscale=true;
 };
 
 //----------------------------------------------------------------------------------------
@@ -182,6 +253,9 @@ struct HistoryData {
   PhysicsModule physics;
   std::string label[NHISTORY_VARIABLES];
   Real hdata[NHISTORY_VARIABLES];
+  // per-MeshBlock partial sums, length [nmb*nhist], filled only in deterministic
+  // reductions mode so the cross-rank combine can be done in global gid order
+  std::vector<Real> hdata_mb;
   bool header_written;
   // constructor
   explicit HistoryData(PhysicsModule name) : physics(name), header_written(false) {}
@@ -202,9 +276,13 @@ struct TrackedParticleData {
 //        std::list of BaseTypeOutput created & stored in the Outputs class
 
 class BaseTypeOutput {
+  // Outputs implements the shared-snapshot service, which redirects outvars below at
+  // its shadow buffer for the load/write phase of each output cycle
+  friend class Outputs;
+
  public:
   BaseTypeOutput(ParameterInput *pin, Mesh *pm, OutputParameters oparams);
-  virtual ~BaseTypeOutput() = default;
+  virtual ~BaseTypeOutput();
   // copy constructor and assignment operator
   BaseTypeOutput(const BaseTypeOutput& copy_other) = default;
   BaseTypeOutput& operator=(const BaseTypeOutput& copy_other) = default;
@@ -218,11 +296,28 @@ class BaseTypeOutput {
 
   // function which computes derived output variables like vorticity and current density
   void ComputeDerivedVariable(std::string name, Mesh *pm);
+  // computes a comma-separated list of derived quantities with a single fused kernel
+  void ComputeDerivedFused(std::string name, Mesh *pm,
+                           int il, int iu, int jl, int ju, int kl, int ku);
+
+  // accumulates weighted sums of the output variables into the device buffer below;
+  // called every cycle by the Driver when 'time_average=true' in the <output> block
+  void AccumulateTimeAverage(Mesh *pm, Real weight);
+
+  // snapshot/blend of the output variables for 'time_interp=true': the Driver snapshots
+  // the state each cycle near an output time, and blends it with the current state to
+  // synthesize the dump at the exact requested time (returned for the file stamp)
+  void SnapshotTimeInterp(Mesh *pm);
+  Real InterpolateToOutputTime(Mesh *pm);
 
   // virtual functions may be over-ridden in derived classes
   virtual void LoadOutputData(Mesh *pm);
   virtual void WriteOutputFile(Mesh *pm, ParameterInput *pin) = 0;
 
+  // blocks until background thread writing previous dump (if any) has finished.  Must
+  // be called before any data captured by the write phase is reused or destroyed.
+  void FenceAsyncWrite();
+
   // Functions to detect big endian machine, and to byte-swap 32-bit words.  The vtk
   // legacy format requires data to be stored as big-endian.
   int IsBigEndian() {
@@ -238,11 +333,19 @@ class BaseTypeOutput {
 
  protected:
   // CC output data on host with dims (n,m,k,j,i) except
-  // for restarts, where dims are (m,n,k,j,i)
-  HostArray5D<Real> outarray;
-  HostArray5D<Real> outarray_hyd, outarray_mhd, outarray_rad,
+  // for restarts, where dims are (m,n,k,j,i).  All host output arrays live in pinned
+  // (page-locked) memory so the device->host copies filling them run at full DMA
+  // bandwidth instead of the (much slower) pageable-memory path
+  HpinArray5D<Real> outarray;
+  HpinArray5D<Real> outarray_hyd, outarray_mhd, outarray_rad,
                     outarray_force, outarray_z4c, outarray_adm;
-  HostFaceFld4D<Real> outfield;  // FC output field on host
+  HpinFaceFld4D<Real> outfield;  // FC output field on host
+
+  // persistent device-side staging buffers for LoadOutputData; two are kept, bound to
+  // separate execution space instances, so packing one MeshBlock overlaps the transfer
+  // of the previous one
+  DvceArray3D<Real> stage_dev_[2];
+  std::vector<DevExeSpace> stage_stream_;
   std::vector<int> noutmbs;   // with MPI, number of output MBs across all ranks
   int noutmbs_min;            // with MPI, minimum number of output MBs across all ranks
   int noutmbs_max;            // with MPI, maximum number of output MBs across all ranks
@@ -253,6 +356,35 @@ class BaseTypeOutput {
 
   // Following vector will be of length (# output variables)
   std::vector<OutputVariableInfo> outvars;
+
+  // windowed time averaging ('time_average=true'): device buffer of weighted sums with
+  // one slot per output variable, total weight accumulated in the current window, and
+  // the original data sources saved when outvars is redirected at the buffer (so the
+  // load/write machinery above emits the averages without modification)
+  DvceArray5D<Real> tavg_var;
+  Real tavg_time = 0.0;
+  std::vector<OutputVariableInfo> tavg_srcs;
+
+  // temporal interpolation ('time_interp=true'): device snapshot of the output
+  // variables at the previous cycle, the time it was taken (< 0 = no valid snapshot),
+  // and the original data sources saved when outvars is redirected at the buffer
+  DvceArray5D<Real> tint_var;
+  Real tint_time = -1.0;
+  std::vector<OutputVariableInfo> tint_srcs;
+
+  // shared-snapshot service (see Outputs::SnapshotOutputData()): the original data
+  // sources saved while outvars is redirected at the shadow buffer owned by Outputs.
+  // Non-empty exactly while the redirection is active
+  std::vector<OutputVariableInfo> snap_srcs;
+
+  // background thread performing file writes with 'async=true' in <output> block
+  std::thread iothread_;
+#if MPI_PARALLEL_ENABLED
+  // duplicate of MPI_COMM_WORLD used for MPI-IO from the writer thread, so its
+  // collective file operations cannot interfere with collectives posted by the main
+  // thread while the next cycles are integrated
+  MPI_Comm io_comm_ = MPI_COMM_NULL;
+#endif
 };
 
 
@@ -273,15 +405,37 @@ class FormattedTableOutput : public BaseTypeOutput {
 class HistoryOutput : public BaseTypeOutput {
  public:
   HistoryOutput(ParameterInput *pin, Mesh *pm, OutputParameters oparams);
+  ~HistoryOutput() override;
 
   // vector of length [# of physics modules] containing hdata arrays
   std::vector<HistoryData> hist_data;
 
+  // with '<time> deterministic_reductions = true', history sums are accumulated in a
+  // fixed tree order on device and combined across ranks in global gid order, so output
+  // is bitwise identical for any rank count (at some cost in speed)
+  bool deterministic;
+
+#if MPI_PARALLEL_ENABLED
+  //! \struct PendingHistory
+  //! \brief history record whose global sum (posted with MPI_Iallreduce) is still in
+  //! flight.  The file append is deferred until the reduction completes on a later call
+  //! to WriteOutputFile, so no rank blocks on the collective at output cadence.
+  struct PendingHistory {
+    int indx;                        // index of physics module in hist_data vector
+    Real time, dt;                   // values of time/dt when record was made
+    Real hdata[NHISTORY_VARIABLES];  // global sum performed in-place on this array
+    MPI_Request req;
+  };
+  std::list<PendingHistory> pending_hist;  // records posted but not yet written
+  void FlushPendingHistory(bool block);
+#endif
+
   void LoadOutputData(Mesh *pm) override;
   void LoadHydroHistoryData(HistoryData *pdata, Mesh *pm);
   void LoadMHDHistoryData(HistoryData *pdata, Mesh *pm);
   void LoadZ4cHistoryData(HistoryData *pdata, Mesh *pm);
   void WriteOutputFile(Mesh *pm, ParameterInput *pin) override;
+  void WriteHistoryRecord(HistoryData &data, Real time, Real dt, const Real *hdata);
 };
 
 //----------------------------------------------------------------------------------------
@@ -331,11 +485,99 @@ struct PDFData {
 class PDFOutput : public BaseTypeOutput {
  public:
   PDFOutput(ParameterInput *pin, Mesh *pm, OutputParameters oparams);
+  ~PDFOutput() override;
 
   PDFData pdf_data;
 
+#if MPI_PARALLEL_ENABLED
+  //! \struct PendingPDF
+  //! \brief histogram whose global sum (posted with MPI_Ireduce) is still in flight.
+  //! The file write is deferred until the reduction completes on a later call to
+  //! WriteOutputFile, so no rank blocks on the collective at output cadence.
+  struct PendingPDF {
+    Real time;                 // value of time when histogram was made
+    int file_number;           // file number reserved for this histogram
+    HostArray2D<Real> result;  // global sum performed in-place on this array (root)
+    MPI_Request req;
+  };
+  std::list<PendingPDF> pending_pdf;  // histograms posted but not yet written
+  void FlushPendingPDF(bool block);
+#endif
+
+  void LoadOutputData(Mesh *pm) override;
+  void WriteOutputFile(Mesh *pm, ParameterInput *pin) override;
+  void WritePDFRecord(Real tm, int fnum, const HostArray2D<Real> &result_host);
+};
+
+//----------------------------------------------------------------------------------------
+//! \struct ClumpData
+//  \brief properties of one clump (connected component) found by ClumpFinderOutput
+
+struct ClumpData {
+  Real mass=0.0, vol=0.0;       // total mass and volume
+  Real x1=0.0, x2=0.0, x3=0.0;  // mass-weighted position sums (normalized on write)
+  Real dmax=0.0;                // peak value of thresholded variable
+  int ncells=0;                 // number of member cells
+};
+
+//----------------------------------------------------------------------------------------
+//! \class ClumpFinderOutput
+//  \brief derived BaseTypeOutput class implementing an in-situ connected-component
+//  clump finder.  Cells of the output variable above a threshold are labeled on device
+//  and merged across MeshBlock/rank boundaries through the standard cell-centered
+//  boundary communication machinery; a compact catalog is appended to a text file.
+
+class ClumpFinderOutput : public BaseTypeOutput {
+ public:
+  ClumpFinderOutput(ParameterInput *pin, Mesh *pm, OutputParameters oparams);
+  ~ClumpFinderOutput() override;
+
+  Real threshold;                   // value of output variable defining clump cells
+  DvceArray5D<Real> labels;         // clump label of each cell (-1 outside clumps)
+  DvceArray5D<Real> coarse_labels;  // never allocated (uniform mesh is enforced)
+  std::map<std::int64_t, ClumpData> catalog;  // partial catalog found on this rank
+
+  void LoadOutputData(Mesh *pm) override;
+  void WriteOutputFile(Mesh *pm, ParameterInput *pin) override;
+
+ private:
+  MeshBoundaryValuesCC *pbval_lbl;  // boundary communications for label field
+};
+
+//----------------------------------------------------------------------------------------
+//! \class RenderOutput
+//  \brief derived BaseTypeOutput class implementing in-situ volume rendering for run
+//  monitoring.  One output variable is ray-integrated along a grid axis on the device
+//  into a global image-plane buffer, composited across ranks with a non-blocking sum,
+//  and written as a portable graymap (PGM) image at the output cadence
+
+class RenderOutput : public BaseTypeOutput {
+ public:
+  RenderOutput(ParameterInput *pin, Mesh *pm, OutputParameters oparams);
+  ~RenderOutput() override;
+
+  int res1, res2;            // image dimensions in pixels
+  DvceArray2D<Real> img_dev; // image-plane accumulation buffer, indexed (row, column)
+  Kokkos::Experimental::ScatterView<Real **, LayoutWrapper> img_scatter;
+
+#if MPI_PARALLEL_ENABLED
+  //! \struct PendingImage
+  //! \brief image whose global composite (posted with MPI_Ireduce) is still in flight.
+  //! The file write is deferred until the sum completes on a later call to
+  //! WriteOutputFile, so no rank blocks on the collective at output cadence.
+  struct PendingImage {
+    Real time;              // value of time when image was rendered
+    int file_number;        // file number reserved for this image
+    HostArray2D<Real> img;  // global sum performed in-place on this array (root)
+    MPI_Request req;
+  };
+  std::list<PendingImage> pending_img;  // images posted but not yet written
+  void FlushPendingImages(bool block);
+#endif
+
   void LoadOutputData(Mesh *pm) override;
   void WriteOutputFile(Mesh *pm, ParameterInput *pin) override;
+  void WriteImageFile(Real tm, int fnum, const HostArray2D<Real> &img_host);
 };
 
 //----------------------------------------------------------------------------------------
@@ -373,6 +615,43 @@ class MeshBinaryOutput : public BaseTypeOutput {
   void WriteOutputFile(Mesh *pm, ParameterInput *pin) override;
 };
 
+//----------------------------------------------------------------------------------------
+//! \class MeshCompressedBinaryOutput
+//  \brief derived BaseTypeOutput class for chunk-compressed binary mesh data.  Format
+//  follows MeshBinaryOutput, with per-MeshBlock per-variable chunks byte-shuffled and
+//  LZ4 compressed, optionally after fixed-precision mantissa truncation
+
+class MeshCompressedBinaryOutput : public BaseTypeOutput {
+ public:
+  MeshCompressedBinaryOutput(ParameterInput *pin, Mesh *pm, OutputParameters oparams);
+  void WriteOutputFile(Mesh *pm, ParameterInput *pin) override;
+};
+
+//----------------------------------------------------------------------------------------
+//! \class MeshStreamOutput
+//  \brief derived BaseTypeOutput class that publishes binary mesh data over a TCP
+//  connection to a concurrently-running analysis consumer instead of (re)writing files.
+//  Each rank sends one self-describing frame per dump carrying the same header and
+//  per-MeshBlock records as MeshBinaryOutput, so existing readers of the 'bin' format
+//  can be pointed at the stream.  Sends run against a backpressure budget ('stall_ms');
+//  if the consumer cannot keep up or the connection drops, the frame is spilled to a
+//  per-rank file in bin/ and streaming resumes at the next dump, so a slow or dead
+//  consumer never stalls the simulation
+
+class MeshStreamOutput : public BaseTypeOutput {
+ public:
+  MeshStreamOutput(ParameterInput *pin, Mesh *pm, OutputParameters oparams);
+  ~MeshStreamOutput() override;
+  void WriteOutputFile(Mesh *pm, ParameterInput *pin) override;
+
+ private:
+  bool Connect();  // (re)establish non-blocking connection to the consumer
+  // sends nbytes within the backpressure budget; false on timeout or socket error
+  bool SendAll(const char *buf, std::size_t nbytes);
+  int sock_fd_ = -1;           // connected socket (-1 = not connected)
+  bool warned_ = false;        // warn only once per connection loss
+};
+
 //----------------------------------------------------------------------------------------
 //! \class RestartOutput
 //  \brief derived BaseTypeOutput class for restarts
@@ -382,6 +661,57 @@ class RestartOutput : public BaseTypeOutput {
   RestartOutput(ParameterInput *pin, Mesh *pm, OutputParameters oparams);
   void LoadOutputData(Mesh *pm) override;
   void WriteOutputFile(Mesh *pm, ParameterInput *pin) override;
+
+ protected:
+  // packs all physics data of MeshBlock m into buffer in restart file record order
+  // (also used by the in-memory shadow checkpoints of ShadowRestartOutput)
+  void PackMeshBlockData(Mesh *pm, int m, char *pb);
+
+ private:
+  // computes per-MeshBlock payload checksums from the staging arrays (see
+  // utils/restart_checksum.hpp); written as a footer after the MeshBlock records
+  void ComputeMeshBlockChecksums(Mesh *pm, std::vector<std::uint64_t> &cks);
+  void WriteChecksumFooter(Mesh *pm, IOWrapper &resfile, IOWrapperSizeT data_size,
+                           IOWrapperSizeT header_size);
+  void TakeReferenceSnapshot(Mesh *pm, IOWrapperSizeT data_size,
+                             IOWrapperSizeT header_size, int file_number);
+  void WriteDeltaRecords(Mesh *pm, IOWrapper &resfile, IOWrapperSizeT data_size,
+                         IOWrapperSizeT header_size);
+  // reference snapshot of last full dump used to XOR-delta subsequent dumps, keyed by
+  // logical location; value = (record index in that dump, packed MeshBlock payload)
+  std::map<std::array<std::int32_t,4>, std::pair<int,std::vector<char>>> ref_blocks_;
+  int last_full_fn_ = -1;                     // file number of last full dump
+  IOWrapperSizeT last_full_payload_off_ = 0;  // offset of MeshBlock data in that file
+};
+
+//----------------------------------------------------------------------------------------
+//! \class ShadowRestartOutput
+//  \brief derived BaseTypeOutput class for in-memory shadow checkpoints ('shadow_rst').
+//  Instead of writing a file, each "output" refreshes an LZ4-compressed image of this
+//  rank's restart payload (same serialization as RestartOutput) and exchanges it with a
+//  buddy rank, so every rank's last image is held in two ranks' host memory.  Enabled
+//  with a <output> block with file_type = shadow_rst and 'dcycle' set, it gives
+//  checkpoint granularity of a few cycles at memory/interconnect speed with no file
+//  system traffic.  When the batch system signals the job (SIGTERM, e.g. after a node
+//  failure kills a peer), surviving ranks flush the images they hold to rst/*.bshd
+//  files; vis/python/shadow_reconstruct.py merges them into a standard .rst file since
+//  every payload survives the loss of any single rank (own copy or buddy copy).
+
+class ShadowRestartOutput : public RestartOutput {
+ public:
+  ShadowRestartOutput(ParameterInput *pin, Mesh *pm, OutputParameters oparams);
+  ~ShadowRestartOutput() override;
+  void WriteOutputFile(Mesh *pm, ParameterInput *pin) override;
+  // write held shadow images to rst/*.bshd files; called from the SIGTERM handler, so
+  // restricted to async-signal-safe POSIX I/O on buffers prepared during the refresh
+  void FlushShadows();
+
+ private:
+  // complete file images (preamble + restart header + compressed MeshBlock records) of
+  // this rank's payload and of the buddy rank's payload, and the filenames they are
+  // flushed to; refreshed every 'dcycle' cycles by WriteOutputFile
+  std::vector<char> own_image_, buddy_image_;
+  std::string own_fname_, buddy_fname_;
 };
 
 //----------------------------------------------------------------------------------------
@@ -396,6 +726,20 @@ class EventLogOutput : public BaseTypeOutput {
   bool header_written=false;
   bool no_output=true;
 
+  // Counters are aggregated across ranks with nonblocking collectives started when the
+  // counters are harvested and completed at the next output check, so the reductions
+  // stay off the critical path.  Each completed row is written one check interval late,
+  // labelled with the cycle at which its counters were harvested.
+  static const int nsums = 6 + EventCounters::nhist_c2p;  // # of sum-reduced counters
+  bool agg_pending=false;       // aggregation of agg_* data is in flight
+  bool row_valid=false;         // row_* data are aggregated and ready to be written
+  int agg_cycle=0, row_cycle=0;
+  int agg_data[nsums], row_data[nsums];
+  int agg_maxit=0, row_maxit=0;
+#if MPI_PARALLEL_ENABLED
+  MPI_Request agg_req[2] = {MPI_REQUEST_NULL, MPI_REQUEST_NULL};
+#endif
+
   void LoadOutputData(Mesh *pm) override;
   void WriteOutputFile(Mesh *pm, ParameterInput *pin) override;
 };
@@ -407,6 +751,7 @@ class EventLogOutput : public BaseTypeOutput {
 class TrackedParticleOutput : public BaseTypeOutput {
  public:
   TrackedParticleOutput(ParameterInput *pin, Mesh *pm, OutputParameters oparams);
+  ~TrackedParticleOutput() override;
   void LoadOutputData(Mesh *pm) override;
   void WriteOutputFile(Mesh *pm, ParameterInput *pin) override;
  protected:
@@ -414,8 +759,16 @@ class TrackedParticleOutput : public BaseTypeOutput {
   int ntrack_thisrank;  // number of tracked particles this rank (guess)
   int npout;            // number of tracked particles to be written this rank
   bool header_written;
-  std::vector<int> npout_eachrank;
   HostArray1D<TrackedParticleData> outpart;
+
+  // Records accumulate in host memory over 'trk_flush_every' cadences and are flushed
+  // as one large tag-sorted segment appended to this rank's binary log, with one line
+  // per segment appended to a companion index file (see FlushTrackSegment).  Per-rank
+  // logs are merged offline with vis/python/trk_merge.py
+  struct TrackedCadence {Real time; int cycle; int npout;};
+  std::vector<TrackedCadence> trk_cadences;     // (time,cycle,count) of buffered dumps
+  std::vector<TrackedParticleData> trk_records; // buffered records, tag-sorted/cadence
+  void FlushTrackSegment();
 };
 
 //----------------------------------------------------------------------------------------
@@ -430,6 +783,21 @@ class Outputs {
 
   // use vector of pointers to BaseTypeOutputs since it is an abstract base class
   std::vector<BaseTypeOutput*> pout_list;
+
+  // shared-snapshot service: copies the union of device variables registered by the
+  // grid outputs due this cycle into the shadow buffer below, then redirects each
+  // output's outvars at the shadow.  All writers due in the same cycle then consume
+  // one consistent snapshot, variables shared between dumps are copied only once, and
+  // the output path synchronizes against the evolution arrays at a single point per
+  // output cycle instead of once per output type
+  void SnapshotOutputData(Mesh *pm, std::vector<BaseTypeOutput *> &outs_due);
+  void RestoreOutputData();
+
+ private:
+  // shadow buffer with dims (m,slot,k,j,i), allocated at the first snapshot and reused
+  // across output types and cycles (resized only by AMR or a changed variable set)
+  DvceArray5D<Real> snap_var;
+  std::vector<BaseTypeOutput *> snap_outs;  // outputs whose outvars are redirected
 };
 
 #endif // OUTPUTS_OUTPUTS_HPP_
@@ -291,24 +291,28 @@ void PDFOutput::LoadOutputData(Mesh *pm) {
   // Kokkos::Experimental::contribute(result.KokkosView(), scatter);
   Kokkos::fence(); // May not be required
 
-  // Now reduce over ranks
+  // reduction over ranks is posted as a non-blocking collective in WriteOutputFile, so
+  // evolution is not stalled while the global histogram is summed
+}
+
+//----------------------------------------------------------------------------------------
+// Destructor: waits for and writes any histograms whose global sums are in flight
+
+PDFOutput::~PDFOutput() {
 #if MPI_PARALLEL_ENABLED
-  if (global_variable::my_rank == 0) {
-    MPI_Reduce(MPI_IN_PLACE, result.data(), result.size(),
-                                   MPI_ATHENA_REAL, MPI_SUM, 0, MPI_COMM_WORLD);
-  } else {
-    MPI_Reduce(result.data(), result.data(), result.size(),
-                                   MPI_ATHENA_REAL, MPI_SUM, 0, MPI_COMM_WORLD);
-  }
+  FlushPendingPDF(true);
 #endif
 }
 
 //----------------------------------------------------------------------------------------
 //! \fn void PDFOutput::WriteOutputFile()
-//  \brief Cycles through hist_data vector and writes history file for each component
+//  \brief Writes histogram to file.  With MPI, the global sum is posted with a
+//  non-blocking collective and the file write is deferred until the result arrives
+//  (usually on a later call), so output cadence does not synchronize ranks on the
+//  critical path.
 
 void PDFOutput::WriteOutputFile(Mesh *pm, ParameterInput *pin) {
-  // only the master rank writes the file
+  // only the master rank writes the bins header file
   if (global_variable::my_rank == 0) {
     // Write header, if it has not been written already
     if (!(pdf_data.bins_written)) {
@@ -361,53 +365,48 @@ void PDFOutput::WriteOutputFile(Mesh *pm, ParameterInput *pin) {
       std::fclose(pfile);
       pdf_data.bins_written = true;
     }
+  }
 
-    // create filename: "pdf_"+"file_id"/file_basename" + "." + XXXXX + ".pdf"
-    // where XXXXX = 5-digit file_number
-    std::string fname;
-    char number[6];
-    std::snprintf(number, sizeof(number), "%05d", out_params.file_number);
-    fname.assign("pdf_");
-    fname.append(out_params.file_id);
-    if (pdf_data.pdf_dimension == 2) {
-      fname.append("_");
-      fname.append(out_params.variable_2);
-    }
-    fname.append("/");
-    fname.append(out_params.file_basename);
-    fname.append(".");
-    fname.append(number);
-    fname.append(".pdf");
-
-    // open file for output
-    FILE *pfile;
-    if ((pfile = std::fopen(fname.c_str(),"a")) == nullptr) {
-      std::cout << "### FATAL ERROR in " << __FILE__ << " at line " << __LINE__
-        << std::endl << "Output file '" << fname << "' could not be opened" <<std::endl;
-      exit(EXIT_FAILURE);
-    }
-
-    // Create a host mirror of the pdf_data.result_ array
-    auto result_host = Kokkos::create_mirror_view(pdf_data.result_);
-
-    // Copy the data from the device to the host
-    Kokkos::deep_copy(result_host, pdf_data.result_);
-
-    // write history variables
-    std::fprintf(pfile, "# time= ");
-    std::fprintf(pfile, out_params.data_format.c_str(), pm->time);
-    std::fprintf(pfile, "\n");
-    int number_n2_bins = pdf_data.pdf_dimension == 2 ? pdf_data.nbin2+2 : 1;
-    for (int n2=0; n2<number_n2_bins; ++n2) {
-      for (int n=0; n<pdf_data.nbin+2; ++n) {
-        std::fprintf(pfile, out_params.data_format.c_str(), result_host(n2, n));
-      }
-      std::fprintf(pfile,"\n"); // terminate line
-    }
-    std::fprintf(pfile,"\n"); // terminate line
-    std::fclose(pfile);
+#if MPI_PARALLEL_ENABLED
+  // copy local histogram into a pending record and post non-blocking in-place sum over
+  // all MPI ranks.  The histogram in pdf_data.result_ can then be safely overwritten
+  // on the next output time.
+  pending_pdf.emplace_back();
+  PendingPDF &precord = pending_pdf.back();
+  precord.time = pm->time;
+  precord.file_number = out_params.file_number;
+  precord.result = HostArray2D<Real>("pdf_pending", pdf_data.result_.extent(0),
+                                     pdf_data.result_.extent(1));
+  Kokkos::deep_copy(precord.result, pdf_data.result_);
+  Kokkos::fence();
+  int ierr;
+  if (global_variable::my_rank == 0) {
+    ierr = MPI_Ireduce(MPI_IN_PLACE, precord.result.data(), precord.result.size(),
+                       MPI_ATHENA_REAL, MPI_SUM, 0, MPI_COMM_WORLD, &(precord.req));
+  } else {
+    ierr = MPI_Ireduce(precord.result.data(), precord.result.data(),
+                       precord.result.size(), MPI_ATHENA_REAL, MPI_SUM, 0,
+                       MPI_COMM_WORLD, &(precord.req));
+  }
+  // Quit if MPI error detected
+  if (ierr != MPI_SUCCESS) {
+    std::cout << "### FATAL ERROR in " << __FILE__ << " at line " << __LINE__
+              << std::endl << "MPI error in posting non-blocking reduction"
+              << std::endl;
+    std::exit(EXIT_FAILURE);
   }
 
+  // write any queued histograms whose reductions have since completed
+  FlushPendingPDF(false);
+#else
+  // Copy histogram from the device to the host and write it immediately
+  HostArray2D<Real> result_host("pdf_result", pdf_data.result_.extent(0),
+                                pdf_data.result_.extent(1));
+  Kokkos::deep_copy(result_host, pdf_data.result_);
+  Kokkos::fence();
+  WritePDFRecord(pm->time, out_params.file_number, result_host);
+#endif
+
   // increment counters
   out_params.file_number++; // By doing this I make a new file for each time.
   // I could alternatively have a single file that is appended to each time.
@@ -420,3 +419,87 @@ void PDFOutput::WriteOutputFile(Mesh *pm, ParameterInput *pin) {
   pin->SetReal(out_params.block_name, "last_time", out_params.last_time);
   return;
 }
+
+#if MPI_PARALLEL_ENABLED
+//----------------------------------------------------------------------------------------
+//! \fn void PDFOutput::FlushPendingPDF()
+//  \brief Writes queued histograms whose global sums have completed.  Records are
+//  written strictly in the order posted so file numbers remain time-ordered; testing
+//  stops at the first record still in flight.  When block=true, waits for every pending
+//  record (used by the destructor so no records are lost at the end of a run).
+
+void PDFOutput::FlushPendingPDF(bool block) {
+  while (!(pending_pdf.empty())) {
+    PendingPDF &precord = pending_pdf.front();
+    int test;
+    int ierr;
+    if (block) {
+      ierr = MPI_Wait(&(precord.req), MPI_STATUS_IGNORE);
+      test = 1;
+    } else {
+      ierr = MPI_Test(&(precord.req), &test, MPI_STATUS_IGNORE);
+    }
+    // Quit if MPI error detected
+    if (ierr != MPI_SUCCESS) {
+      std::cout << "### FATAL ERROR in " << __FILE__ << " at line " << __LINE__
+                << std::endl << "MPI error in testing non-blocking reduction"
+                << std::endl;
+      std::exit(EXIT_FAILURE);
+    }
+    if (!(static_cast<bool>(test))) {return;}
+    WritePDFRecord(precord.time, precord.file_number, precord.result);
+    pending_pdf.pop_front();
+  }
+  return;
+}
+#endif
+
+//----------------------------------------------------------------------------------------
+//! \fn void PDFOutput::WritePDFRecord()
+//  \brief Writes one (globally summed) histogram to its own numbered file.  Only the
+//  master rank writes; called with the reserved file number since out_params.file_number
+//  may have advanced while the record's reduction was in flight.
+
+void PDFOutput::WritePDFRecord(Real tm, int fnum, const HostArray2D<Real> &result_host) {
+  if (global_variable::my_rank != 0) {return;}
+
+  // create filename: "pdf_"+"file_id"/file_basename" + "." + XXXXX + ".pdf"
+  // where XXXXX = 5-digit file_number
+  std::string fname;
+  char number[6];
+  std::snprintf(number, sizeof(number), "%05d", fnum);
+  fname.assign("pdf_");
+  fname.append(out_params.file_id);
+  if (pdf_data.pdf_dimension == 2) {
+    fname.append("_");
+    fname.append(out_params.variable_2);
+  }
+  fname.append("/");
+  fname.append(out_params.file_basename);
+  fname.append(".");
+  fname.append(number);
+  fname.append(".pdf");
+
+  // open file for output
+  FILE *pfile;
+  if ((pfile = std::fopen(fname.c_str(),"a")) == nullptr) {
+    std::cout << "### FATAL ERROR in " << __FILE__ << " at line " << __LINE__
+      << std::endl << "Output file '" << fname << "' could not be opened" <<std::endl;
+    exit(EXIT_FAILURE);
+  }
+
+  // write history variables
+  std::fprintf(pfile, "# time= ");
+  std::fprintf(pfile, out_params.data_format.c_str(), tm);
+  std::fprintf(pfile, "\n");
+  int number_n2_bins = pdf_data.pdf_dimension == 2 ? pdf_data.nbin2+2 : 1;
+  for (int n2=0; n2<number_n2_bins; ++n2) {
+    for (int n=0; n<pdf_data.nbin+2; ++n) {
+      std::fprintf(pfile, out_params.data_format.c_str(), result_host(n2, n));
+    }
+    std::fprintf(pfile,"\n"); // terminate line
+  }
+  std::fprintf(pfile,"\n"); // terminate line
+  std::fclose(pfile);
+  return;
+}
@@ -0,0 +1,363 @@
+//========================================================================================
+// AthenaXXX astrophysical plasma code
+// Copyright(C) 2020 James M. Stone <jmstone@ias.edu> and the Athena code team
+// Licensed under the 3-clause BSD License (the "LICENSE")
+//========================================================================================
+//! \file render.cpp
+//  \brief writes rendered image ('img') output data for in-situ run monitoring.
+//  One output variable is integrated along rays parallel to a grid axis on the device,
+//  with each cell depositing (value)*(path length)*(footprint overlap) into the pixels
+//  of a global image plane spanning the root domain.  Partial images are composited
+//  across ranks by a non-blocking sum and the root rank writes a binary PGM file per
+//  frame, so a run can be watched with any image viewer for the cost of one full-grid
+//  pass per frame and no separate visualization pipeline.
+
+#include <sys/stat.h>  // mkdir
+
+#include <algorithm>
+#include <cmath>
+#include <cstdio>
+#include <cstdlib>
+#include <iostream>
+#include <limits>
+#include <string>
+#include <vector>
+
+#include "athena.hpp"
+#include "globals.hpp"
+#include "coordinates/cell_locations.hpp"
+#include "mesh/mesh.hpp"
+#include "outputs.hpp"
+
+// ScatterView is not part of Kokkos core interface
+#include "Kokkos_ScatterView.hpp"
+
+//----------------------------------------------------------------------------------------
+// Constructor: also calls BaseTypeOutput base class constructor
+
+RenderOutput::RenderOutput(ParameterInput *pin, Mesh *pm, OutputParameters op) :
+  BaseTypeOutput(pin, pm, op) {
+  // create directory for images.  Comments in binary.cpp constructor explain why
+  mkdir("img",0775);
+
+  if ((op.img_axis < 1) || (op.img_axis > 3)) {
+    std::cout << "### FATAL ERROR in " << __FILE__ << " at line " << __LINE__
+       << std::endl << "axis=" << op.img_axis << " in output block '" << op.block_name
+       << "' must be 1, 2, or 3" << std::endl;
+    exit(EXIT_FAILURE);
+  }
+
+  // image must render a single variable, not a variable group
+  if (outvars.size() != 1) {
+    std::cout << "### FATAL ERROR in " << __FILE__ << " at line " << __LINE__
+       << std::endl << "Image output block '" << op.block_name << "' requires a single "
+       << "variable, but variable '" << op.variable << "' is a group" << std::endl;
+    exit(EXIT_FAILURE);
+  }
+
+  // default image resolution is the root grid resolution perpendicular to the rays
+  auto &indcs = pm->mesh_indcs;
+  if (op.img_axis == 1) {
+    res1 = (op.img_res1 > 0)? op.img_res1 : indcs.nx2;
+    res2 = (op.img_res2 > 0)? op.img_res2 : indcs.nx3;
+  } else if (op.img_axis == 2) {
+    res1 = (op.img_res1 > 0)? op.img_res1 : indcs.nx1;
+    res2 = (op.img_res2 > 0)? op.img_res2 : indcs.nx3;
+  } else {
+    res1 = (op.img_res1 > 0)? op.img_res1 : indcs.nx1;
+    res2 = (op.img_res2 > 0)? op.img_res2 : indcs.nx2;
+  }
+
+  img_dev = DvceArray2D<Real>("img_dev", res2, res1);
+  img_scatter = Kokkos::Experimental::ScatterView<Real **, LayoutWrapper>(img_dev);
+}
+
+//----------------------------------------------------------------------------------------
+// Destructor: waits for and writes any images whose global composites are in flight
+
+RenderOutput::~RenderOutput() {
+#if MPI_PARALLEL_ENABLED
+  FlushPendingImages(true);
+#endif
+}
+
+//----------------------------------------------------------------------------------------
+//! \fn void RenderOutput::LoadOutputData()
+//  \brief Renders the output variable into the image-plane buffer on the device.  Each
+//  cell deposits q*dl spread over the pixels its footprint covers, weighted by the
+//  fractional overlap, so pixels hold the footprint-averaged column integral of the
+//  variable regardless of refinement level
+
+void RenderOutput::LoadOutputData(Mesh *pm) {
+  // Calculate derived variable, if required
+  if (out_params.contains_derived) {
+    ComputeDerivedVariable(out_params.variable, pm);
+  }
+
+  auto &vdata = *(outvars[0].data_ptr);
+  int vidx = outvars[0].data_index;
+
+  // capture class variables for kernel
+  auto &indcs = pm->mb_indcs;
+  int &is = indcs.is, &ie = indcs.ie, nx1 = indcs.nx1;
+  int &js = indcs.js, &je = indcs.je, nx2 = indcs.nx2;
+  int &ks = indcs.ks, &ke = indcs.ke, nx3 = indcs.nx3;
+  auto &size = pm->pmb_pack->pmb->mb_size;
+  int nmb = pm->pmb_pack->nmb_thispack;
+  int axis = out_params.img_axis;
+
+  // image plane spans the root domain perpendicular to the rays
+  Real imgx_min, imgy_min;
+  Real pdx, pdy;  // pixel sizes
+  if (axis == 1) {
+    imgx_min = pm->mesh_size.x2min;
+    imgy_min = pm->mesh_size.x3min;
+    pdx = (pm->mesh_size.x2max - imgx_min)/static_cast<Real>(res1);
+    pdy = (pm->mesh_size.x3max - imgy_min)/static_cast<Real>(res2);
+  } else if (axis == 2) {
+    imgx_min = pm->mesh_size.x1min;
+    imgy_min = pm->mesh_size.x3min;
+    pdx = (pm->mesh_size.x1max - imgx_min)/static_cast<Real>(res1);
+    pdy = (pm->mesh_size.x3max - imgy_min)/static_cast<Real>(res2);
+  } else {
+    imgx_min = pm->mesh_size.x1min;
+    imgy_min = pm->mesh_size.x2min;
+    pdx = (pm->mesh_size.x1max - imgx_min)/static_cast<Real>(res1);
+    pdy = (pm->mesh_size.x2max - imgy_min)/static_cast<Real>(res2);
+  }
+  Real ipix_area = 1.0/(pdx*pdy);
+  int res1_ = res1, res2_ = res2;
+
+  // Reset ScatterView and image from previous frame (see comments in pdf.cpp)
+  img_scatter.reset();
+  Kokkos::deep_copy(img_dev, 0);
+  Kokkos::fence();
+  auto scatter = img_scatter;
+
+  par_for("img_render", DevExeSpace(),0,nmb-1,ks,ke,js,je,is,ie,
+  KOKKOS_LAMBDA(int m, int k, int j, int i) {
+    Real q = vdata(m,vidx,k,j,i);
+
+    // cell footprint on the image plane and path length along the ray
+    Real xl, yl, dx, dy, dl;
+    if (axis == 1) {
+      xl = LeftEdgeX(j-js, nx2, size.d_view(m).x2min, size.d_view(m).x2max);
+      yl = LeftEdgeX(k-ks, nx3, size.d_view(m).x3min, size.d_view(m).x3max);
+      dx = size.d_view(m).dx2;
+      dy = size.d_view(m).dx3;
+      dl = size.d_view(m).dx1;
+    } else if (axis == 2) {
+      xl = LeftEdgeX(i-is, nx1, size.d_view(m).x1min, size.d_view(m).x1max);
+      yl = LeftEdgeX(k-ks, nx3, size.d_view(m).x3min, size.d_view(m).x3max);
+      dx = size.d_view(m).dx1;
+      dy = size.d_view(m).dx3;
+      dl = size.d_view(m).dx2;
+    } else {
+      xl = LeftEdgeX(i-is, nx1, size.d_view(m).x1min, size.d_view(m).x1max);
+      yl = LeftEdgeX(j-js, nx2, size.d_view(m).x2min, size.d_view(m).x2max);
+      dx = size.d_view(m).dx1;
+      dy = size.d_view(m).dx2;
+      dl = size.d_view(m).dx3;
+    }
+
+    // range of pixels overlapped by the footprint, clamped to the image
+    int pil = static_cast<int>((xl - imgx_min)/pdx);
+    int piu = static_cast<int>((xl + dx - imgx_min)/pdx);
+    int pjl = static_cast<int>((yl - imgy_min)/pdy);
+    int pju = static_cast<int>((yl + dy - imgy_min)/pdy);
+    pil = (pil > 0)? pil : 0;
+    pjl = (pjl > 0)? pjl : 0;
+    piu = (piu < (res1_-1))? piu : (res1_-1);
+    pju = (pju < (res2_-1))? pju : (res2_-1);
+
+    auto img = scatter.access();
+    for (int pj=pjl; pj<=pju; ++pj) {
+      Real oy = fmin(yl+dy, imgy_min+(pj+1)*pdy) - fmax(yl, imgy_min+pj*pdy);
+      for (int pi=pil; pi<=piu; ++pi) {
+        Real ox = fmin(xl+dx, imgx_min+(pi+1)*pdx) - fmax(xl, imgx_min+pi*pdx);
+        img(pj,pi) += q*dl*fmax(ox,0.0)*fmax(oy,0.0)*ipix_area;
+      }
+    }
+  });
+
+  // "reduce" results from scatter view to original view.
+  // May be a no-op depending on backend.
+  Kokkos::Experimental::contribute(img_dev, img_scatter);
+  Kokkos::fence();
+
+  // compositing over ranks is posted as a non-blocking collective in WriteOutputFile,
+  // so evolution is not stalled while the global image is summed
+}
+
+//----------------------------------------------------------------------------------------
+//! \fn void RenderOutput::WriteOutputFile()
+//  \brief Writes rendered image to file.  With MPI, the global composite is posted with
+//  a non-blocking sum and the file write is deferred until the result arrives (usually
+//  on a later call), so output cadence does not synchronize ranks on the critical path.
+
+void RenderOutput::WriteOutputFile(Mesh *pm, ParameterInput *pin) {
+#if MPI_PARALLEL_ENABLED
+  // copy local image into a pending record and post non-blocking in-place sum over all
+  // MPI ranks.  The image in img_dev can then be safely overwritten on the next frame.
+  pending_img.emplace_back();
+  PendingImage &precord = pending_img.back();
+  precord.time = pm->time;
+  precord.file_number = out_params.file_number;
+  precord.img = HostArray2D<Real>("img_pending", res2, res1);
+  Kokkos::deep_copy(precord.img, img_dev);
+  Kokkos::fence();
+  int ierr;
+  if (global_variable::my_rank == 0) {
+    ierr = MPI_Ireduce(MPI_IN_PLACE, precord.img.data(), precord.img.size(),
+                       MPI_ATHENA_REAL, MPI_SUM, 0, MPI_COMM_WORLD, &(precord.req));
+  } else {
+    ierr = MPI_Ireduce(precord.img.data(), precord.img.data(), precord.img.size(),
+                       MPI_ATHENA_REAL, MPI_SUM, 0, MPI_COMM_WORLD, &(precord.req));
+  }
+  // Quit if MPI error detected
+  if (ierr != MPI_SUCCESS) {
+    std::cout << "### FATAL ERROR in " << __FILE__ << " at line " << __LINE__
+              << std::endl << "MPI error in posting non-blocking reduction"
+              << std::endl;
+    std::exit(EXIT_FAILURE);
+  }
+
+  // write any queued images whose composites have since completed
+  FlushPendingImages(false);
+#else
+  // Copy image from the device to the host and write it immediately
+  HostArray2D<Real> img_host("img_host", res2, res1);
+  Kokkos::deep_copy(img_host, img_dev);
+  Kokkos::fence();
+  WriteImageFile(pm->time, out_params.file_number, img_host);
+#endif
+
+  // increment counters
+  out_params.file_number++;
+  if (out_params.last_time < 0.0) {
+    out_params.last_time = pm->time;
+  } else {
+    out_params.last_time += out_params.dt;
+  }
+  pin->SetInteger(out_params.block_name, "file_number", out_params.file_number);
+  pin->SetReal(out_params.block_name, "last_time", out_params.last_time);
+  return;
+}
+
+#if MPI_PARALLEL_ENABLED
+//----------------------------------------------------------------------------------------
+//! \fn void RenderOutput::FlushPendingImages()
+//  \brief Writes queued images whose global composites have completed.  Records are
+//  written strictly in the order posted so file numbers remain time-ordered; testing
+//  stops at the first record still in flight.  When block=true, waits for every pending
+//  record (used by the destructor so no frames are lost at the end of a run).
+
+void RenderOutput::FlushPendingImages(bool block) {
+  while (!(pending_img.empty())) {
+    PendingImage &precord = pending_img.front();
+    int test;
+    int ierr;
+    if (block) {
+      ierr = MPI_Wait(&(precord.req), MPI_STATUS_IGNORE);
+      test = 1;
+    } else {
+      ierr = MPI_Test(&(precord.req), &test, MPI_STATUS_IGNORE);
+    }
+    // Quit if MPI error detected
+    if (ierr != MPI_SUCCESS) {
+      std::cout << "### FATAL ERROR in " << __FILE__ << " at line " << __LINE__
+                << std::endl << "MPI error in testing non-blocking reduction"
+                << std::endl;
+      std::exit(EXIT_FAILURE);
+    }
+    if (!(static_cast<bool>(test))) {return;}
+    WriteImageFile(precord.time, precord.file_number, precord.img);
+    pending_img.pop_front();
+  }
+  return;
+}
+#endif
+
+//----------------------------------------------------------------------------------------
+//! \fn void RenderOutput::WriteImageFile()
+//  \brief Writes one (globally composited) image as a binary PGM file.  Pixel values
+//  are mapped to 8-bit grayscale over a fixed range (img_min/img_max) or the per-frame
+//  range, in log10 when logscale=true.  Only the master rank writes; called with the
+//  reserved file number since out_params.file_number may have advanced while the
+//  record's composite was in flight.
+
+void RenderOutput::WriteImageFile(Real tm, int fnum, const HostArray2D<Real> &img_host) {
+  if (global_variable::my_rank != 0) {return;}
+
+  bool logscale = out_params.img_logscale;
+
+  // find range of (log) pixel values for per-frame auto-scaling.  With logscale,
+  // empty/negative pixels are excluded and map to the bottom of the scale
+  Real vmin, vmax;
+  if (out_params.img_fixed_scale) {
+    vmin = (logscale)? std::log10(out_params.img_min) : out_params.img_min;
+    vmax = (logscale)? std::log10(out_params.img_max) : out_params.img_max;
+  } else {
+    vmin = std::numeric_limits<Real>::max();
+    vmax = -std::numeric_limits<Real>::max();
+    for (int pj=0; pj<res2; ++pj) {
+      for (int pi=0; pi<res1; ++pi) {
+        Real v = img_host(pj,pi);
+        if (logscale) {
+          if (v <= 0.0) {continue;}
+          v = std::log10(v);
+        }
+        vmin = std::min(vmin, v);
+        vmax = std::max(vmax, v);
+      }
+    }
+    if (vmin > vmax) {vmin = 0.0; vmax = 1.0;}  // no valid pixels
+  }
+  Real iscale = (vmax > vmin)? 255.0/(vmax - vmin) : 0.0;
+
+  // create filename: "img/file_basename" + "." + file_id + "." + XXXXX + ".pgm"
+  // where XXXXX = 5-digit file_number
+  std::string fname;
+  char number[6];
+  std::snprintf(number, sizeof(number), "%05d", fnum);
+  fname.assign("img/");
+  fname.append(out_params.file_basename);
+  fname.append(".");
+  fname.append(out_params.file_id);
+  fname.append(".");
+  fname.append(number);
+  fname.append(".pgm");
+
+  // open file for output
+  FILE *pfile;
+  if ((pfile = std::fopen(fname.c_str(),"wb")) == nullptr) {
+    std::cout << "### FATAL ERROR in " << __FILE__ << " at line " << __LINE__
+      << std::endl << "Output file '" << fname << "' could not be opened" <<std::endl;
+    exit(EXIT_FAILURE);
+  }
+
+  // PGM header; comment lines carry metadata for quicklook tooling
+  std::fprintf(pfile, "P5\n");
+  std::fprintf(pfile, "# time= %.8e  variable= %s\n", tm, outvars[0].label.c_str());
+  std::fprintf(pfile, "# scale= [%.8e, %.8e]%s\n", vmin, vmax,
+               (logscale)? " (log10)" : "");
+  std::fprintf(pfile, "%d %d\n255\n", res1, res2);
+
+  // write rows top-to-bottom so the second image axis increases upwards in the image
+  std::vector<unsigned char> row(res1);
+  for (int pj=res2-1; pj>=0; --pj) {
+    for (int pi=0; pi<res1; ++pi) {
+      Real v = img_host(pj,pi);
+      if (logscale) {
+        v = (v > 0.0)? std::log10(v) : vmin;
+      }
+      Real s = (v - vmin)*iscale;
+      if (s < 0.0) {s = 0.0;}
+      if (s > 255.0) {s = 255.0;}
+      row[pi] = static_cast<unsigned char>(s);
+    }
+    std::fwrite(row.data(), sizeof(unsigned char), row.size(), pfile);
+  }
+  std::fclose(pfile);
+  return;
+}
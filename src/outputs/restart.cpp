@@ -9,13 +9,16 @@
 #include <sys/stat.h>  // mkdir
 
 #include <algorithm>
+#include <array>
 #include <cstdio>      // fwrite(), fclose(), fopen(), fnprintf(), snprintf()
 #include <cstdlib>
+#include <cstring>     // memcpy()
 #include <iomanip>
 #include <iostream>
 #include <sstream>
 #include <string>
 #include <utility> // make_pair
+#include <vector>
 
 #include "athena.hpp"
 #include "coordinates/cell_locations.hpp"
@@ -28,6 +31,9 @@
 #include "z4c/z4c.hpp"
 #include "radiation/radiation.hpp"
 #include "srcterms/turb_driver.hpp"
+#include "utils/compression.hpp"
+#include "utils/hugepage.hpp"
+#include "utils/restart_checksum.hpp"
 //#include "outputs.hpp"
 
 //----------------------------------------------------------------------------------------
@@ -42,14 +48,21 @@ RestartOutput::RestartOutput(ParameterInput *pin, Mesh *pm, OutputParameters op)
 //----------------------------------------------------------------------------------------
 // RestartOutput::LoadOutputData()
 // overload of standard load data function specific to restarts.  Loads dependent
-// variables, including ghost zones.
+// variables, interior zones only: ghost zones are regenerated by the boundary exchange
+// in Driver::InitBoundaryValuesAndPrimitives() on restart, so checkpointing them only
+// inflates the files (by ~35% for typical MeshBlock and ghost sizes).  The one
+// exception is the ADM array of a non-evolved spacetime, which has no boundary
+// communication to refill its ghosts and is therefore dumped in full.
 
 void RestartOutput::LoadOutputData(Mesh *pm) {
-  // get spatial dimensions of arrays, including ghost zones
+  // get spatial dimensions of arrays, interior (ghost-free) zones only
   auto &indcs = pm->pmb_pack->pmesh->mb_indcs;
-  int nout1 = indcs.nx1 + 2*(indcs.ng);
-  int nout2 = (indcs.nx2 > 1)? (indcs.nx2 + 2*(indcs.ng)) : 1;
-  int nout3 = (indcs.nx3 > 1)? (indcs.nx3 + 2*(indcs.ng)) : 1;
+  int nout1 = indcs.nx1;
+  int nout2 = indcs.nx2;
+  int nout3 = indcs.nx3;
+  auto irange = std::make_pair(indcs.is, indcs.ie+1);
+  auto jrange = std::make_pair(indcs.js, indcs.je+1);
+  auto krange = std::make_pair(indcs.ks, indcs.ke+1);
   int nmb = pm->pmb_pack->nmb_thispack;
 
   // calculate total number of CC variables
@@ -80,38 +93,42 @@ void RestartOutput::LoadOutputData(Mesh *pm) {
   if (phydro != nullptr) {
     Kokkos::realloc(outarray_hyd, nmb, nhydro, nout3, nout2, nout1);
     Kokkos::deep_copy(outarray_hyd, Kokkos::subview(phydro->u0, std::make_pair(0,nmb),
-                      Kokkos::ALL, Kokkos::ALL, Kokkos::ALL, Kokkos::ALL));
+                      Kokkos::ALL, krange, jrange, irange));
   }
   if (pmhd != nullptr) {
     Kokkos::realloc(outarray_mhd, nmb, nmhd, nout3, nout2, nout1);
     Kokkos::deep_copy(outarray_mhd, Kokkos::subview(pmhd->u0, std::make_pair(0,nmb),
-                      Kokkos::ALL, Kokkos::ALL, Kokkos::ALL, Kokkos::ALL));
+                      Kokkos::ALL, krange, jrange, irange));
     Kokkos::realloc(outfield.x1f, nmb, nout3, nout2, nout1+1);
     Kokkos::deep_copy(outfield.x1f, Kokkos::subview(pmhd->b0.x1f, std::make_pair(0,nmb),
-                      Kokkos::ALL, Kokkos::ALL, Kokkos::ALL));
+                      krange, jrange, std::make_pair(indcs.is, indcs.ie+2)));
     Kokkos::realloc(outfield.x2f, nmb, nout3, nout2+1, nout1);
     Kokkos::deep_copy(outfield.x2f, Kokkos::subview(pmhd->b0.x2f, std::make_pair(0,nmb),
-                      Kokkos::ALL, Kokkos::ALL, Kokkos::ALL));
+                      krange, std::make_pair(indcs.js, indcs.je+2), irange));
     Kokkos::realloc(outfield.x3f, nmb, nout3+1, nout2, nout1);
     Kokkos::deep_copy(outfield.x3f, Kokkos::subview(pmhd->b0.x3f, std::make_pair(0,nmb),
-                      Kokkos::ALL, Kokkos::ALL, Kokkos::ALL));
+                      std::make_pair(indcs.ks, indcs.ke+2), jrange, irange));
   }
   if (prad != nullptr) {
     Kokkos::realloc(outarray_rad, nmb, nrad, nout3, nout2, nout1);
     Kokkos::deep_copy(outarray_rad, Kokkos::subview(prad->i0, std::make_pair(0,nmb),
-                      Kokkos::ALL, Kokkos::ALL, Kokkos::ALL, Kokkos::ALL));
+                      Kokkos::ALL, krange, jrange, irange));
   }
   if (pturb != nullptr) {
     Kokkos::realloc(outarray_force, nmb, nforce, nout3, nout2, nout1);
     Kokkos::deep_copy(outarray_force, Kokkos::subview(pturb->force, std::make_pair(0,nmb),
-                      Kokkos::ALL, Kokkos::ALL, Kokkos::ALL, Kokkos::ALL));
+                      Kokkos::ALL, krange, jrange, irange));
   }
   if (pz4c != nullptr) {
     Kokkos::realloc(outarray_z4c, nmb, nz4c, nout3, nout2, nout1);
     Kokkos::deep_copy(outarray_z4c, Kokkos::subview(pz4c->u0, std::make_pair(0,nmb),
-                      Kokkos::ALL, Kokkos::ALL, Kokkos::ALL, Kokkos::ALL));
+                      Kokkos::ALL, krange, jrange, irange));
   } else if (padm != nullptr) {
-    Kokkos::realloc(outarray_adm, nmb, nadm, nout3, nout2, nout1);
+    // non-evolved ADM data is dumped with ghost zones: no boundary exchange refills them
+    int aout1 = indcs.nx1 + 2*(indcs.ng);
+    int aout2 = (indcs.nx2 > 1)? (indcs.nx2 + 2*(indcs.ng)) : 1;
+    int aout3 = (indcs.nx3 > 1)? (indcs.nx3 + 2*(indcs.ng)) : 1;
+    Kokkos::realloc(outarray_adm, nmb, nadm, aout3, aout2, aout1);
     Kokkos::deep_copy(outarray_adm, Kokkos::subview(padm->u_adm, std::make_pair(0,nmb),
                       Kokkos::ALL, Kokkos::ALL, Kokkos::ALL, Kokkos::ALL));
   }
@@ -125,16 +142,274 @@ void RestartOutput::LoadOutputData(Mesh *pm) {
   }
 }
 
+//----------------------------------------------------------------------------------------
+//! \fn void RestartOutput::PackMeshBlockData()
+//  \brief packs all physics data of MeshBlock m into pb, in the same order as the
+//  per-MeshBlock records of a restart file (see WriteOutputFile below)
+
+void RestartOutput::PackMeshBlockData(Mesh *pm, int m, char *pb) {
+  hydro::Hydro* phydro = pm->pmb_pack->phydro;
+  mhd::MHD* pmhd = pm->pmb_pack->pmhd;
+  radiation::Radiation* prad = pm->pmb_pack->prad;
+  TurbulenceDriver* pturb = pm->pmb_pack->pturb;
+  z4c::Z4c* pz4c = pm->pmb_pack->pz4c;
+  adm::ADM* padm = pm->pmb_pack->padm;
+  if (phydro != nullptr) {
+    auto mbptr = Kokkos::subview(outarray_hyd, m, Kokkos::ALL, Kokkos::ALL,
+                                 Kokkos::ALL, Kokkos::ALL);
+    std::memcpy(pb, mbptr.data(), mbptr.size()*sizeof(Real));
+    pb += mbptr.size()*sizeof(Real);
+  }
+  if (pmhd != nullptr) {
+    auto mbptr = Kokkos::subview(outarray_mhd, m, Kokkos::ALL, Kokkos::ALL,
+                                 Kokkos::ALL, Kokkos::ALL);
+    std::memcpy(pb, mbptr.data(), mbptr.size()*sizeof(Real));
+    pb += mbptr.size()*sizeof(Real);
+    auto x1fptr = Kokkos::subview(outfield.x1f,m,Kokkos::ALL,Kokkos::ALL,Kokkos::ALL);
+    std::memcpy(pb, x1fptr.data(), x1fptr.size()*sizeof(Real));
+    pb += x1fptr.size()*sizeof(Real);
+    auto x2fptr = Kokkos::subview(outfield.x2f,m,Kokkos::ALL,Kokkos::ALL,Kokkos::ALL);
+    std::memcpy(pb, x2fptr.data(), x2fptr.size()*sizeof(Real));
+    pb += x2fptr.size()*sizeof(Real);
+    auto x3fptr = Kokkos::subview(outfield.x3f,m,Kokkos::ALL,Kokkos::ALL,Kokkos::ALL);
+    std::memcpy(pb, x3fptr.data(), x3fptr.size()*sizeof(Real));
+    pb += x3fptr.size()*sizeof(Real);
+  }
+  if (prad != nullptr) {
+    auto mbptr = Kokkos::subview(outarray_rad, m, Kokkos::ALL, Kokkos::ALL,
+                                 Kokkos::ALL, Kokkos::ALL);
+    std::memcpy(pb, mbptr.data(), mbptr.size()*sizeof(Real));
+    pb += mbptr.size()*sizeof(Real);
+  }
+  if (pturb != nullptr) {
+    auto mbptr = Kokkos::subview(outarray_force, m, Kokkos::ALL, Kokkos::ALL,
+                                 Kokkos::ALL, Kokkos::ALL);
+    std::memcpy(pb, mbptr.data(), mbptr.size()*sizeof(Real));
+    pb += mbptr.size()*sizeof(Real);
+  }
+  if (pz4c != nullptr) {
+    auto mbptr = Kokkos::subview(outarray_z4c, m, Kokkos::ALL, Kokkos::ALL,
+                                 Kokkos::ALL, Kokkos::ALL);
+    std::memcpy(pb, mbptr.data(), mbptr.size()*sizeof(Real));
+    pb += mbptr.size()*sizeof(Real);
+  } else if (padm != nullptr) {
+    auto mbptr = Kokkos::subview(outarray_adm, m, Kokkos::ALL, Kokkos::ALL,
+                                 Kokkos::ALL, Kokkos::ALL);
+    std::memcpy(pb, mbptr.data(), mbptr.size()*sizeof(Real));
+    pb += mbptr.size()*sizeof(Real);
+  }
+  return;
+}
+
+//----------------------------------------------------------------------------------------
+//! \fn void RestartOutput::ComputeMeshBlockChecksums()
+//  \brief computes the payload checksum of every MeshBlock on this rank from the
+//  staging arrays, folding in the physics-module slabs in the same order as
+//  PackMeshBlockData so the result matches a checksum of the packed record
+
+void RestartOutput::ComputeMeshBlockChecksums(Mesh *pm,
+                                              std::vector<std::uint64_t> &cks) {
+  hydro::Hydro* phydro = pm->pmb_pack->phydro;
+  mhd::MHD* pmhd = pm->pmb_pack->pmhd;
+  radiation::Radiation* prad = pm->pmb_pack->prad;
+  TurbulenceDriver* pturb = pm->pmb_pack->pturb;
+  z4c::Z4c* pz4c = pm->pmb_pack->pz4c;
+  adm::ADM* padm = pm->pmb_pack->padm;
+  int nmb = pm->nmb_thisrank;
+  cks.assign(nmb, 0);
+  for (int m=0; m<nmb; ++m) {
+    std::uint64_t base = 0;
+    if (phydro != nullptr) {
+      auto mbptr = Kokkos::subview(outarray_hyd, m, Kokkos::ALL, Kokkos::ALL,
+                                   Kokkos::ALL, Kokkos::ALL);
+      cks[m] += restart_checksum::SumReals(mbptr.data(), mbptr.size(), base);
+      base += mbptr.size();
+    }
+    if (pmhd != nullptr) {
+      auto mbptr = Kokkos::subview(outarray_mhd, m, Kokkos::ALL, Kokkos::ALL,
+                                   Kokkos::ALL, Kokkos::ALL);
+      cks[m] += restart_checksum::SumReals(mbptr.data(), mbptr.size(), base);
+      base += mbptr.size();
+      auto x1fptr = Kokkos::subview(outfield.x1f,m,Kokkos::ALL,Kokkos::ALL,Kokkos::ALL);
+      cks[m] += restart_checksum::SumReals(x1fptr.data(), x1fptr.size(), base);
+      base += x1fptr.size();
+      auto x2fptr = Kokkos::subview(outfield.x2f,m,Kokkos::ALL,Kokkos::ALL,Kokkos::ALL);
+      cks[m] += restart_checksum::SumReals(x2fptr.data(), x2fptr.size(), base);
+      base += x2fptr.size();
+      auto x3fptr = Kokkos::subview(outfield.x3f,m,Kokkos::ALL,Kokkos::ALL,Kokkos::ALL);
+      cks[m] += restart_checksum::SumReals(x3fptr.data(), x3fptr.size(), base);
+      base += x3fptr.size();
+    }
+    if (prad != nullptr) {
+      auto mbptr = Kokkos::subview(outarray_rad, m, Kokkos::ALL, Kokkos::ALL,
+                                   Kokkos::ALL, Kokkos::ALL);
+      cks[m] += restart_checksum::SumReals(mbptr.data(), mbptr.size(), base);
+      base += mbptr.size();
+    }
+    if (pturb != nullptr) {
+      auto mbptr = Kokkos::subview(outarray_force, m, Kokkos::ALL, Kokkos::ALL,
+                                   Kokkos::ALL, Kokkos::ALL);
+      cks[m] += restart_checksum::SumReals(mbptr.data(), mbptr.size(), base);
+      base += mbptr.size();
+    }
+    if (pz4c != nullptr) {
+      auto mbptr = Kokkos::subview(outarray_z4c, m, Kokkos::ALL, Kokkos::ALL,
+                                   Kokkos::ALL, Kokkos::ALL);
+      cks[m] += restart_checksum::SumReals(mbptr.data(), mbptr.size(), base);
+      base += mbptr.size();
+    } else if (padm != nullptr) {
+      auto mbptr = Kokkos::subview(outarray_adm, m, Kokkos::ALL, Kokkos::ALL,
+                                   Kokkos::ALL, Kokkos::ALL);
+      cks[m] += restart_checksum::SumReals(mbptr.data(), mbptr.size(), base);
+      base += mbptr.size();
+    }
+  }
+  return;
+}
+
+//----------------------------------------------------------------------------------------
+//! \fn void RestartOutput::WriteChecksumFooter()
+//  \brief appends the checksum footer (see utils/restart_checksum.hpp) after the
+//  MeshBlock records of a full dump; each rank writes the checksums of its own
+//  MeshBlocks in parallel.  Readers that predate the footer never seek past the
+//  records, so the extra bytes are ignored by them
+
+void RestartOutput::WriteChecksumFooter(Mesh *pm, IOWrapper &resfile,
+                                        IOWrapperSizeT data_size,
+                                        IOWrapperSizeT header_size) {
+  std::vector<std::uint64_t> cks;
+  ComputeMeshBlockChecksums(pm, cks);
+  IOWrapperSizeT footer_off = header_size + data_size*(pm->nmb_total);
+  bool no_errors=true;
+  if (global_variable::my_rank == 0) {
+    char hdr[restart_checksum::kFooterHdrSize];
+    std::memset(hdr, 0, sizeof(hdr));
+    std::memcpy(hdr, restart_checksum::kMagic, sizeof(restart_checksum::kMagic));
+    std::int32_t nmbt = pm->nmb_total;
+    std::memcpy(&(hdr[16]), &nmbt, sizeof(std::int32_t));
+    if (resfile.Write_any_type_at(hdr, sizeof(hdr), footer_off, "byte") != sizeof(hdr)) {
+      no_errors=false;
+    }
+  }
+  int mygids = pm->gids_eachrank[global_variable::my_rank];
+  IOWrapperSizeT myoff = footer_off + restart_checksum::kFooterHdrSize +
+                         mygids*sizeof(std::uint64_t);
+  IOWrapperSizeT nbytes = cks.size()*sizeof(std::uint64_t);
+  if (resfile.Write_any_type_at_all(cks.data(), nbytes, myoff, "byte") != nbytes) {
+    no_errors=false;
+  }
+  if (!(no_errors)) {
+    std::cout << "### FATAL ERROR in " << __FILE__ << " at line " << __LINE__
+              << std::endl << "checksum footer not written correctly to rst file, "
+              << "restart file is broken." << std::endl;
+    exit(EXIT_FAILURE);
+  }
+  return;
+}
+
+//----------------------------------------------------------------------------------------
+//! \fn void RestartOutput::TakeReferenceSnapshot()
+//  \brief stores packed payloads of all MeshBlocks on this rank in ref_blocks_, keyed
+//  by logical location, as the reference for subsequent XOR-delta dumps.  Called when a
+//  full dump is written with 'full_every' > 0.  Note this keeps one full copy of the
+//  restart payload in host memory between checkpoints.
+
+void RestartOutput::TakeReferenceSnapshot(Mesh *pm, IOWrapperSizeT data_size,
+                                          IOWrapperSizeT header_size, int file_number) {
+  int nmb = pm->nmb_thisrank;
+  int mygids = pm->gids_eachrank[global_variable::my_rank];
+  ref_blocks_.clear();
+  for (int m=0; m<nmb; ++m) {
+    std::vector<char> payload(data_size);
+    PackMeshBlockData(pm, m, payload.data());
+    LogicalLocation lloc = pm->lloc_eachmb[mygids + m];
+    std::array<std::int32_t,4> key = {lloc.lx1, lloc.lx2, lloc.lx3, lloc.level};
+    ref_blocks_[key] = std::make_pair(mygids + m, std::move(payload));
+  }
+  last_full_fn_ = file_number;
+  last_full_payload_off_ = header_size;
+  return;
+}
+
+//----------------------------------------------------------------------------------------
+//! \fn void RestartOutput::WriteDeltaRecords()
+//  \brief writes per-MeshBlock records of an incremental delta dump.  Each record holds
+//  [int32 gid][int32 base_idx][uint32 csize][csize bytes], where the payload is the
+//  LZ4-compressed byte-shuffle of either the XOR against the same block (by logical
+//  location) in the last full dump (base_idx >= 0 gives its record index there), or of
+//  the full payload when the block did not exist at the last full dump (base_idx = -1).
+//  Records are variable-length, so each rank packs one stream and file offsets are
+//  found by a scan over ranks.  Delta dumps are converted back into standard restart
+//  files with vis/python/rst_reconstruct.py; they cannot be restarted from directly.
+
+void RestartOutput::WriteDeltaRecords(Mesh *pm, IOWrapper &resfile,
+                                      IOWrapperSizeT data_size,
+                                      IOWrapperSizeT header_size) {
+  int nmb = pm->nmb_thisrank;
+  int mygids = pm->gids_eachrank[global_variable::my_rank];
+  std::size_t nelem = data_size/sizeof(Real);
+  std::vector<char> cur(data_size);
+  std::vector<std::uint8_t> shuf(data_size);
+  std::vector<std::uint8_t> stream;
+  for (int m=0; m<nmb; ++m) {
+    PackMeshBlockData(pm, m, cur.data());
+    LogicalLocation lloc = pm->lloc_eachmb[mygids + m];
+    std::array<std::int32_t,4> key = {lloc.lx1, lloc.lx2, lloc.lx3, lloc.level};
+    std::int32_t base_idx = -1;
+    auto it = ref_blocks_.find(key);
+    if (it != ref_blocks_.end()) {
+      // block existed at last full dump; encode XOR against its reference payload,
+      // which compresses extremely well in slowly-evolving regions
+      base_idx = it->second.first;
+      const char *ref = it->second.second.data();
+      for (IOWrapperSizeT i=0; i<data_size; ++i) {cur[i] ^= ref[i];}
+    }
+    compression::ByteShuffle(reinterpret_cast<std::uint8_t*>(cur.data()), shuf.data(),
+                             nelem, sizeof(Real));
+    std::int32_t gid = mygids + m;
+    std::size_t hpos = stream.size();
+    stream.resize(hpos + 2*sizeof(std::int32_t) + sizeof(std::uint32_t));
+    std::memcpy(&(stream[hpos]), &gid, sizeof(std::int32_t));
+    std::memcpy(&(stream[hpos+4]), &base_idx, sizeof(std::int32_t));
+    std::uint32_t csize = static_cast<std::uint32_t>(
+        compression::CompressLZ4(shuf.data(), data_size, stream));
+    std::memcpy(&(stream[hpos+8]), &csize, sizeof(std::uint32_t));
+  }
+
+  // records are variable-length, so this rank's file offset is the sum of the stream
+  // sizes over all previous ranks
+  std::uint64_t my_bytes = stream.size();
+  std::uint64_t my_offset = 0;
+#if MPI_PARALLEL_ENABLED
+  MPI_Exscan(&my_bytes, &my_offset, 1, MPI_UINT64_T, MPI_SUM, MPI_COMM_WORLD);
+  if (global_variable::my_rank == 0) {my_offset = 0;}  // undefined on rank 0
+#endif
+  IOWrapperSizeT preamble_size = 56;
+  if (resfile.Write_any_type_at_all(stream.data(), my_bytes,
+      preamble_size + header_size + my_offset, "byte") != my_bytes) {
+    std::cout << "### FATAL ERROR in " << __FILE__ << " at line " << __LINE__
+              << std::endl << "delta records not written correctly to drst file, "
+              << "delta restart file is broken." << std::endl;
+    exit(EXIT_FAILURE);
+  }
+  return;
+}
+
 //----------------------------------------------------------------------------------------
 //! \fn void RestartOutput:::WriteOutputFile(Mesh *pm)
 //  \brief Cycles over all MeshBlocks and writes everything to a single restart file
 
 void RestartOutput::WriteOutputFile(Mesh *pm, ParameterInput *pin) {
-  // get spatial dimensions of arrays, including ghost zones
+  // get spatial dimensions of arrays, interior zones only (ghost zones are regenerated
+  // on restart; see LoadOutputData above).  ADM data of a non-evolved spacetime is the
+  // exception and keeps its ghost zones
   auto &indcs = pm->pmb_pack->pmesh->mb_indcs;
-  int nout1 = indcs.nx1 + 2*(indcs.ng);
-  int nout2 = (indcs.nx2 > 1)? (indcs.nx2 + 2*(indcs.ng)) : 1;
-  int nout3 = (indcs.nx3 > 1)? (indcs.nx3 + 2*(indcs.ng)) : 1;
+  int nout1 = indcs.nx1;
+  int nout2 = indcs.nx2;
+  int nout3 = indcs.nx3;
+  int aout1 = indcs.nx1 + 2*(indcs.ng);
+  int aout2 = (indcs.nx2 > 1)? (indcs.nx2 + 2*(indcs.ng)) : 1;
+  int aout3 = (indcs.nx3 > 1)? (indcs.nx3 + 2*(indcs.ng)) : 1;
   hydro::Hydro* phydro = pm->pmb_pack->phydro;
   mhd::MHD* pmhd = pm->pmb_pack->pmhd;
   radiation::Radiation* prad = pm->pmb_pack->prad;
@@ -156,17 +431,25 @@ void RestartOutput::WriteOutputFile(Mesh *pm, ParameterInput *pin) {
   } else if (padm != nullptr) {
     nadm = padm->nadm;
   }
+  // decide whether this dump is a full checkpoint or an incremental delta dump (with
+  // 'full_every' parameter, every Nth dump is full and the rest are XOR-deltas against
+  // the last full dump).  Forced to full when no reference snapshot is held, e.g. for
+  // the first dump after a restart.
+  bool full_dump = (out_params.full_every <= 0) || (last_full_fn_ < 0) ||
+                   ((out_params.file_number % out_params.full_every) == 0);
+
   // create filename: "rst/file_basename" + "." + XXXXX + ".rst"
-  // where XXXXX = 5-digit file_number
+  // where XXXXX = 5-digit file_number ("drst" extension for incremental delta dumps)
   std::string fname;
   char number[6];
   std::snprintf(number, sizeof(number), "%05d", out_params.file_number);
+  int my_fn = out_params.file_number;
 
   fname.assign("rst/");
   fname.append(out_params.file_basename);
   fname.append(".");
   fname.append(number);
-  fname.append(".rst");
+  fname.append((full_dump)? ".rst" : ".drst");
 
   // increment counters now so values for *next* dump are stored in restart file
   out_params.file_number++;
@@ -183,6 +466,37 @@ void RestartOutput::WriteOutputFile(Mesh *pm, ParameterInput *pin) {
   pin->ParameterDump(ost);
   std::string sbuf = ost.str();
 
+  // total size of all cell-centered variables and face-centered fields to be written by
+  // this rank
+  IOWrapperSizeT data_size = 0;
+  if (phydro != nullptr) {
+    data_size += nout1*nout2*nout3*nhydro*sizeof(Real); // hydro u0
+  }
+  if (pmhd != nullptr) {
+    data_size += nout1*nout2*nout3*nmhd*sizeof(Real);   // mhd u0
+    data_size += (nout1+1)*nout2*nout3*sizeof(Real);    // mhd b0.x1f
+    data_size += nout1*(nout2+1)*nout3*sizeof(Real);    // mhd b0.x2f
+    data_size += nout1*nout2*(nout3+1)*sizeof(Real);    // mhd b0.x3f
+  }
+  if (prad != nullptr) {
+    data_size += nout1*nout2*nout3*nrad*sizeof(Real);   // radiation i0
+  }
+  if (pturb != nullptr) {
+    data_size += nout1*nout2*nout3*nforce*sizeof(Real); // forcing
+  }
+  if (pz4c != nullptr) {
+    data_size += nout1*nout2*nout3*nz4c*sizeof(Real);   // z4c u0
+  } else if (padm != nullptr) {
+    data_size += aout1*aout2*aout3*nadm*sizeof(Real);   // adm u_adm (with ghosts)
+  }
+
+  // calculate size of header data written in Steps 1-2 below
+  IOWrapperSizeT step1size = sbuf.size()*sizeof(char) + 3*sizeof(int) + 2*sizeof(Real) +
+                             sizeof(RegionSize) + 2*sizeof(RegionIndcs);
+  IOWrapperSizeT step2size = (pm->nmb_total)*(sizeof(LogicalLocation) + sizeof(float));
+  IOWrapperSizeT header_size = step1size + step2size + sizeof(IOWrapperSizeT);
+  if (pturb != nullptr) header_size += sizeof(RNG_State);
+
   //--- STEP 1.  Root process writes header data (input file, critical variables)
   // Input file data is read by ParameterInput on restart, and the remaining header
   // variables are read in Mesh::BuildTreeFromRestart()
@@ -190,6 +504,27 @@ void RestartOutput::WriteOutputFile(Mesh *pm, ParameterInput *pin) {
   // open file and  write the header; this part is serial
   IOWrapper resfile;
   resfile.Open(fname.c_str(), IOWrapper::FileMode::write);
+  if (!full_dump && (global_variable::my_rank == 0)) {
+    // delta dumps start with a 56 byte preamble identifying the file and the full dump
+    // it was encoded against, read by vis/python/rst_reconstruct.py; the standard
+    // restart header and the delta records follow it
+    char pre[56];
+    std::memset(pre, 0, sizeof(pre));
+    std::snprintf(pre, sizeof(pre), "athenak-drst-v1");
+    std::int32_t base_fn = last_full_fn_;
+    std::int32_t nmbt = pm->nmb_total;
+    std::int32_t rsz = sizeof(Real);
+    std::memcpy(&(pre[16]), &base_fn, sizeof(std::int32_t));
+    std::memcpy(&(pre[20]), &nmbt, sizeof(std::int32_t));
+    std::memcpy(&(pre[24]), &rsz, sizeof(std::int32_t));
+    std::uint64_t dsz = data_size;
+    std::uint64_t hsz = header_size;
+    std::uint64_t bpo = last_full_payload_off_;
+    std::memcpy(&(pre[32]), &dsz, sizeof(std::uint64_t));
+    std::memcpy(&(pre[40]), &hsz, sizeof(std::uint64_t));
+    std::memcpy(&(pre[48]), &bpo, sizeof(std::uint64_t));
+    resfile.Write_any_type(pre, sizeof(pre), "byte");
+  }
   if (global_variable::my_rank == 0) {
     // output the input parameters (input file)
     resfile.Write_any_type(sbuf.c_str(),sbuf.size(),"byte");
@@ -217,29 +552,6 @@ void RestartOutput::WriteOutputFile(Mesh *pm, ParameterInput *pin) {
   //--- STEP 3.  All ranks write data over all MeshBlocks (5D arrays) in parallel
   // This data read in ProblemGenerator constructor for restarts
 
-  // total size of all cell-centered variables and face-centered fields to be written by
-  // this rank
-  IOWrapperSizeT data_size = 0;
-  if (phydro != nullptr) {
-    data_size += nout1*nout2*nout3*nhydro*sizeof(Real); // hydro u0
-  }
-  if (pmhd != nullptr) {
-    data_size += nout1*nout2*nout3*nmhd*sizeof(Real);   // mhd u0
-    data_size += (nout1+1)*nout2*nout3*sizeof(Real);    // mhd b0.x1f
-    data_size += nout1*(nout2+1)*nout3*sizeof(Real);    // mhd b0.x2f
-    data_size += nout1*nout2*(nout3+1)*sizeof(Real);    // mhd b0.x3f
-  }
-  if (prad != nullptr) {
-    data_size += nout1*nout2*nout3*nrad*sizeof(Real);   // radiation i0
-  }
-  if (pturb != nullptr) {
-    data_size += nout1*nout2*nout3*nforce*sizeof(Real); // forcing
-  }
-  if (pz4c != nullptr) {
-    data_size += nout1*nout2*nout3*nz4c*sizeof(Real);   // z4c u0
-  } else if (padm != nullptr) {
-    data_size += nout1*nout2*nout3*nadm*sizeof(Real);   // adm u_adm
-  }
   if (global_variable::my_rank == 0) {
     resfile.Write_any_type(&(data_size), sizeof(IOWrapperSizeT), "byte");
     if (pturb != nullptr) {
@@ -247,17 +559,60 @@ void RestartOutput::WriteOutputFile(Mesh *pm, ParameterInput *pin) {
     }
   }
 
-  // calculate size of data written in Steps 1-2 above
-  IOWrapperSizeT step1size = sbuf.size()*sizeof(char) + 3*sizeof(int) + 2*sizeof(Real) +
-                             sizeof(RegionSize) + 2*sizeof(RegionIndcs);
-  IOWrapperSizeT step2size = (pm->nmb_total)*(sizeof(LogicalLocation) + sizeof(float));
+  // incremental delta dump: write compressed XOR-delta records against the reference
+  // snapshot of the last full dump and return (see WriteDeltaRecords above)
+  if (!full_dump) {
+    WriteDeltaRecords(pm, resfile, data_size, header_size);
+    resfile.Close();
+    return;
+  }
+
+  // full dump with delta dumps to follow: store the reference snapshot they need
+  if (out_params.full_every > 0) {
+    TakeReferenceSnapshot(pm, data_size, header_size, my_fn);
+  }
 
   // write cell-centered variables in parallel
-  IOWrapperSizeT offset_myrank  = step1size + step2size + sizeof(IOWrapperSizeT) +
+  IOWrapperSizeT offset_myrank  = header_size +
                                   data_size*(pm->gids_eachrank[global_variable::my_rank]);
-  if (pturb != nullptr) offset_myrank += sizeof(RNG_State);
   IOWrapperSizeT myoffset = offset_myrank;
 
+#if MPI_PARALLEL_ENABLED
+  // Two-phase aggregated writes (enabled with 'naggr' parameter in <output> block).
+  // Since the regions of consecutive ranks are contiguous in a restart file, this rank's
+  // entire payload (all its MeshBlocks) can be packed into a single host buffer and
+  // handed to IOWrapper::Write_bytes_aggregated(), which gathers payloads onto 'naggr'
+  // aggregator ranks that issue large writes aligned to 'stripe_size' byte windows.
+  // This avoids the collapse of collective per-MeshBlock writes at very large rank
+  // counts on parallel file systems.  The file format is identical to the default path.
+  if (out_params.naggr > 0) {
+    int nmb = pm->nmb_thisrank;
+    IOWrapperSizeT mysize = data_size*nmb;
+    char *payload = hugepage::Alloc(mysize);
+    for (int m=0; m<nmb; ++m) {
+      // pack physics modules in same order as default per-MeshBlock writes below
+      PackMeshBlockData(pm, m, &(payload[m*data_size]));
+    }
+    if (resfile.Write_bytes_aggregated(payload, mysize, offset_myrank, out_params.naggr,
+        static_cast<IOWrapperSizeT>(out_params.stripe_size)) != mysize) {
+      std::cout << "### FATAL ERROR in " << __FILE__ << " at line " << __LINE__
+                << std::endl << "MeshBlock data not written correctly to rst file, "
+                << "restart file is broken." << std::endl;
+      exit(EXIT_FAILURE);
+    }
+    hugepage::Free(payload);
+
+    // append per-MeshBlock checksum footer, verified by the restart constructor
+    if (out_params.checksum) {
+      WriteChecksumFooter(pm, resfile, data_size, header_size);
+    }
+
+    // close file, clean up
+    resfile.Close();
+    return;
+  }
+#endif
+
   // write cell-centered variables, one MeshBlock at a time (but parallelized over all
   // ranks). MeshBlocks are written seperately to reduce number of data elements per write
   // call, to avoid exceeding 2^31 limit for very large grids per MPI rank.
@@ -545,10 +900,15 @@ void RestartOutput::WriteOutputFile(Mesh *pm, ParameterInput *pin) {
         myoffset += data_size;
       }
     }
-    offset_myrank += nout1*nout2*nout3*nadm*sizeof(Real); // adm u_adm
+    offset_myrank += aout1*aout2*aout3*nadm*sizeof(Real); // adm u_adm (with ghosts)
     myoffset = offset_myrank;
   }
 
+  // append per-MeshBlock checksum footer, verified by the restart constructor
+  if (out_params.checksum) {
+    WriteChecksumFooter(pm, resfile, data_size, header_size);
+  }
+
   // close file, clean up
   resfile.Close();
 
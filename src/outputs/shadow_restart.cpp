@@ -0,0 +1,267 @@
+//========================================================================================
+// AthenaXXX astrophysical plasma code
+// Copyright(C) 2020 James M. Stone <jmstone@ias.edu> and the Athena code team
+// Licensed under the 3-clause BSD License (the "LICENSE")
+//========================================================================================
+//! \file shadow_restart.cpp
+//! \brief implements in-memory shadow checkpoints ('shadow_rst' output blocks).  Each
+//! refresh packs this rank's restart payload (identical serialization to restart.cpp),
+//! compresses it, and exchanges the image with a buddy rank so the last checkpoint of
+//! every rank is held in two ranks' host memory.  Nothing touches the file system until
+//! the job is signalled (SIGTERM), when surviving ranks flush the images they hold to
+//! rst/*.bshd files; vis/python/shadow_reconstruct.py merges these into a standard .rst
+
+#include <fcntl.h>     // open()
+#include <unistd.h>    // write(), close()
+
+#include <csignal>
+#include <cstdint>
+#include <cstring>     // memcpy()
+#include <iostream>
+#include <sstream>
+#include <string>
+#include <vector>
+
+#include "athena.hpp"
+#include "globals.hpp"
+#include "mesh/mesh.hpp"
+#include "hydro/hydro.hpp"
+#include "mhd/mhd.hpp"
+#include "coordinates/adm.hpp"
+#include "z4c/z4c.hpp"
+#include "radiation/radiation.hpp"
+#include "srcterms/turb_driver.hpp"
+#include "utils/compression.hpp"
+#include "outputs.hpp"
+
+#if MPI_PARALLEL_ENABLED
+#include <mpi.h>
+#endif
+
+namespace {
+
+// active instance the SIGTERM handler flushes; set when the first shadow output is
+// constructed.  Only one shadow_rst block is allowed (enforced in Outputs ctor)
+ShadowRestartOutput* active_shadow = nullptr;
+
+void ShadowTermHandler(int sig) {
+  if (active_shadow != nullptr) {active_shadow->FlushShadows();}
+  // re-raise with default disposition so the job still terminates normally
+  std::signal(sig, SIG_DFL);
+  std::raise(sig);
+}
+
+} // namespace
+
+//----------------------------------------------------------------------------------------
+// ctor: also calls RestartOutput base class constructor (which creates rst/ directory),
+// and installs the SIGTERM handler that flushes held shadow images before termination
+
+ShadowRestartOutput::ShadowRestartOutput(ParameterInput *pin, Mesh *pm,
+                                         OutputParameters op) :
+  RestartOutput(pin, pm, op) {
+  active_shadow = this;
+  std::signal(SIGTERM, ShadowTermHandler);
+}
+
+ShadowRestartOutput::~ShadowRestartOutput() {
+  if (active_shadow == this) {active_shadow = nullptr;}
+}
+
+//----------------------------------------------------------------------------------------
+//! \fn void ShadowRestartOutput::WriteOutputFile()
+//  \brief refreshes the in-memory shadow checkpoint.  Despite the (inherited) name no
+//  file is written here.  Builds a complete image of this rank's share of a restart
+//  file: a 64 byte preamble, the standard restart header (identical to restart.cpp, so
+//  reconstruction only concatenates), and one [int32 gid][uint32 csize][csize bytes]
+//  record per MeshBlock holding the LZ4-compressed byte-shuffle of its packed payload.
+//  The image is then exchanged with a buddy rank (ring pairing: sent to rank+1,
+//  received from rank-1) so it survives the loss of this rank.
+
+void ShadowRestartOutput::WriteOutputFile(Mesh *pm, ParameterInput *pin) {
+  // get spatial dimensions of arrays, including ghost zones
+  auto &indcs = pm->pmb_pack->pmesh->mb_indcs;
+  int nout1 = indcs.nx1 + 2*(indcs.ng);
+  int nout2 = (indcs.nx2 > 1)? (indcs.nx2 + 2*(indcs.ng)) : 1;
+  int nout3 = (indcs.nx3 > 1)? (indcs.nx3 + 2*(indcs.ng)) : 1;
+  hydro::Hydro* phydro = pm->pmb_pack->phydro;
+  mhd::MHD* pmhd = pm->pmb_pack->pmhd;
+  radiation::Radiation* prad = pm->pmb_pack->prad;
+  TurbulenceDriver* pturb = pm->pmb_pack->pturb;
+  z4c::Z4c* pz4c = pm->pmb_pack->pz4c;
+  adm::ADM* padm = pm->pmb_pack->padm;
+  int nhydro=0, nmhd=0, nrad=0, nforce=3, nz4c=0, nadm=0;
+  if (phydro != nullptr) {
+    nhydro = phydro->nhydro + phydro->nscalars;
+  }
+  if (pmhd != nullptr) {
+    nmhd = pmhd->nmhd + pmhd->nscalars;
+  }
+  if (prad != nullptr) {
+    nrad = prad->prgeo->nangles;
+  }
+  if (pz4c != nullptr) {
+    nz4c = pz4c->nz4c;
+  } else if (padm != nullptr) {
+    nadm = padm->nadm;
+  }
+
+  // total size of all cell-centered variables and face-centered fields of one MeshBlock
+  // (same accounting as RestartOutput::WriteOutputFile)
+  IOWrapperSizeT data_size = 0;
+  if (phydro != nullptr) {
+    data_size += nout1*nout2*nout3*nhydro*sizeof(Real); // hydro u0
+  }
+  if (pmhd != nullptr) {
+    data_size += nout1*nout2*nout3*nmhd*sizeof(Real);   // mhd u0
+    data_size += (nout1+1)*nout2*nout3*sizeof(Real);    // mhd b0.x1f
+    data_size += nout1*(nout2+1)*nout3*sizeof(Real);    // mhd b0.x2f
+    data_size += nout1*nout2*(nout3+1)*sizeof(Real);    // mhd b0.x3f
+  }
+  if (prad != nullptr) {
+    data_size += nout1*nout2*nout3*nrad*sizeof(Real);   // radiation i0
+  }
+  if (pturb != nullptr) {
+    data_size += nout1*nout2*nout3*nforce*sizeof(Real); // forcing
+  }
+  if (pz4c != nullptr) {
+    data_size += nout1*nout2*nout3*nz4c*sizeof(Real);   // z4c u0
+  } else if (padm != nullptr) {
+    data_size += nout1*nout2*nout3*nadm*sizeof(Real);   // adm u_adm
+  }
+
+  // build standard restart header, byte-identical to the one written by restart.cpp
+  // (input parameter dump, mesh data, logical locations/costs, data_size, RNG state)
+  std::stringstream ost;
+  pin->ParameterDump(ost);
+  std::string sbuf = ost.str();
+
+  std::vector<char> header;
+  auto append = [&](const void *src, std::size_t nbyte) {
+    std::size_t pos = header.size();
+    header.resize(pos + nbyte);
+    std::memcpy(&(header[pos]), src, nbyte);
+  };
+  append(sbuf.c_str(), sbuf.size());
+  append(&(pm->nmb_total), sizeof(int));
+  append(&(pm->root_level), sizeof(int));
+  append(&(pm->mesh_size), sizeof(RegionSize));
+  append(&(pm->mesh_indcs), sizeof(RegionIndcs));
+  append(&(pm->mb_indcs), sizeof(RegionIndcs));
+  append(&(pm->time), sizeof(Real));
+  append(&(pm->dt), sizeof(Real));
+  append(&(pm->ncycle), sizeof(int));
+  append(&(pm->lloc_eachmb[0]), (pm->nmb_total)*sizeof(LogicalLocation));
+  append(&(pm->cost_eachmb[0]), (pm->nmb_total)*sizeof(float));
+  append(&(data_size), sizeof(IOWrapperSizeT));
+  if (pturb != nullptr) {
+    append(&(pturb->rstate), sizeof(RNG_State));
+  }
+
+  // compress per-MeshBlock payloads into [int32 gid][uint32 csize][csize bytes] records
+  int nmb = pm->nmb_thisrank;
+  int mygids = pm->gids_eachrank[global_variable::my_rank];
+  std::size_t nelem = data_size/sizeof(Real);
+  std::vector<char> cur(data_size);
+  std::vector<std::uint8_t> shuf(data_size);
+  std::vector<std::uint8_t> stream;
+  for (int m=0; m<nmb; ++m) {
+    PackMeshBlockData(pm, m, cur.data());
+    compression::ByteShuffle(reinterpret_cast<std::uint8_t*>(cur.data()), shuf.data(),
+                             nelem, sizeof(Real));
+    std::int32_t gid = mygids + m;
+    std::size_t hpos = stream.size();
+    stream.resize(hpos + sizeof(std::int32_t) + sizeof(std::uint32_t));
+    std::memcpy(&(stream[hpos]), &gid, sizeof(std::int32_t));
+    std::uint32_t csize = static_cast<std::uint32_t>(
+        compression::CompressLZ4(shuf.data(), data_size, stream));
+    std::memcpy(&(stream[hpos+4]), &csize, sizeof(std::uint32_t));
+  }
+
+  // assemble complete image: 64 byte preamble + header + records.  The preamble
+  // identifies the origin rank of the payload and is read by shadow_reconstruct.py
+  char pre[64];
+  std::memset(pre, 0, sizeof(pre));
+  std::snprintf(pre, sizeof(pre), "athenak-bshd-v1");
+  std::int32_t rank = global_variable::my_rank;
+  std::int32_t nranks = global_variable::nranks;
+  std::int32_t nmb32 = nmb;
+  std::int32_t gids32 = mygids;
+  std::int32_t ncyc = pm->ncycle;
+  std::int32_t rsz = sizeof(Real);
+  std::int32_t nmbt = pm->nmb_total;
+  std::memcpy(&(pre[16]), &rank,   sizeof(std::int32_t));
+  std::memcpy(&(pre[20]), &nranks, sizeof(std::int32_t));
+  std::memcpy(&(pre[24]), &nmb32,  sizeof(std::int32_t));
+  std::memcpy(&(pre[28]), &gids32, sizeof(std::int32_t));
+  std::memcpy(&(pre[32]), &ncyc,   sizeof(std::int32_t));
+  std::memcpy(&(pre[36]), &rsz,    sizeof(std::int32_t));
+  std::memcpy(&(pre[40]), &nmbt,   sizeof(std::int32_t));
+  std::uint64_t dsz = data_size;
+  std::uint64_t hsz = header.size();
+  std::memcpy(&(pre[48]), &dsz, sizeof(std::uint64_t));
+  std::memcpy(&(pre[56]), &hsz, sizeof(std::uint64_t));
+
+  own_image_.resize(sizeof(pre) + header.size() + stream.size());
+  std::memcpy(own_image_.data(), pre, sizeof(pre));
+  std::memcpy(&(own_image_[sizeof(pre)]), header.data(), header.size());
+  std::memcpy(&(own_image_[sizeof(pre) + header.size()]), stream.data(), stream.size());
+
+#if MPI_PARALLEL_ENABLED
+  // exchange images around a ring so a buddy rank holds a copy of this rank's payload:
+  // send to rank+1, receive rank-1's image.  Any single rank's loss then leaves every
+  // payload alive either as an own copy or as a buddy copy on a surviving rank
+  if (nranks > 1) {
+    int sendto = (rank + 1)%nranks;
+    int recvfrom = (rank - 1 + nranks)%nranks;
+    std::uint64_t sendsz = own_image_.size();
+    std::uint64_t recvsz = 0;
+    MPI_Sendrecv(&sendsz, 1, MPI_UINT64_T, sendto, 0,
+                 &recvsz, 1, MPI_UINT64_T, recvfrom, 0,
+                 MPI_COMM_WORLD, MPI_STATUS_IGNORE);
+    buddy_image_.resize(recvsz);
+    MPI_Sendrecv(own_image_.data(), static_cast<int>(sendsz), MPI_BYTE, sendto, 1,
+                 buddy_image_.data(), static_cast<int>(recvsz), MPI_BYTE, recvfrom, 1,
+                 MPI_COMM_WORLD, MPI_STATUS_IGNORE);
+  }
+#endif
+
+  // precompute flush filenames here so the signal handler does no string handling
+  if (own_fname_.empty()) {
+    char rankstr[8];
+    std::snprintf(rankstr, sizeof(rankstr), "%06d", global_variable::my_rank);
+    own_fname_.assign("rst/");
+    own_fname_.append(out_params.file_basename);
+    own_fname_.append(".r");
+    own_fname_.append(rankstr);
+    buddy_fname_ = own_fname_;
+    own_fname_.append(".own.bshd");
+    buddy_fname_.append(".bdy.bshd");
+  }
+  return;
+}
+
+//----------------------------------------------------------------------------------------
+//! \fn void ShadowRestartOutput::FlushShadows()
+//  \brief writes the shadow images this rank holds (its own and its buddy's) to
+//  rst/*.bshd files.  Called from the SIGTERM handler when the batch system kills the
+//  job, so only async-signal-safe POSIX calls on already-prepared buffers are used; in
+//  particular no MPI and no stream I/O
+
+void ShadowRestartOutput::FlushShadows() {
+  if (!own_image_.empty() && !own_fname_.empty()) {
+    int fd = open(own_fname_.c_str(), O_WRONLY | O_CREAT | O_TRUNC, 0644);
+    if (fd >= 0) {
+      (void) write(fd, own_image_.data(), own_image_.size());
+      close(fd);
+    }
+  }
+  if (!buddy_image_.empty() && !buddy_fname_.empty()) {
+    int fd = open(buddy_fname_.c_str(), O_WRONLY | O_CREAT | O_TRUNC, 0644);
+    if (fd >= 0) {
+      (void) write(fd, buddy_image_.data(), buddy_image_.size());
+      close(fd);
+    }
+  }
+  return;
+}
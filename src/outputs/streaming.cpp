@@ -0,0 +1,371 @@
+//========================================================================================
+// AthenaXXX astrophysical plasma code
+// Copyright(C) 2020 James M. Stone <jmstone@ias.edu> and the Athena code team
+// Licensed under the 3-clause BSD License (the "LICENSE")
+//========================================================================================
+//! \file streaming.cpp
+//! \brief streams binary mesh data to a concurrently-running analysis consumer over a
+//! TCP connection, removing the write-then-reread filesystem round trip of file-based
+//! in-transit analysis.  Each rank sends one frame per dump:
+//!
+//!   char[16]  "athenak-strm-v1" (NUL padded)
+//!   int32     rank, nranks, nout_mbs, nout_vars
+//!   uint64    header_bytes, payload_bytes
+//!   char[]    header (same pre-header + parameter dump as MeshBinaryOutput)
+//!   char[]    payload (nout_mbs per-MeshBlock records, byte-identical to the records
+//!             this rank would write into a 'bin' file)
+//!
+//! Every rank's frame carries the full header so frames are self-describing; a consumer
+//! assembling a global snapshot can keep rank 0's copy and discard the rest.  Sends run
+//! against the 'stall_ms' backpressure budget; when it is exhausted, or on any socket
+//! error, the connection is closed (so the consumer sees EOF and discards the partial
+//! frame) and the complete frame is spilled to a per-rank file in bin/ instead.
+
+#include <arpa/inet.h>
+#include <fcntl.h>
+#include <netdb.h>
+#include <poll.h>
+#include <sys/socket.h>
+#include <sys/stat.h>  // mkdir
+#include <unistd.h>
+
+#include <cerrno>
+#include <chrono>
+#include <cstdio>      // fwrite(), fclose(), fopen(), snprintf()
+#include <cstring>     // memcpy(), memset()
+#include <iostream>
+#include <sstream>
+#include <string>
+#include <vector>
+
+#include "athena.hpp"
+#include "globals.hpp"
+#include "mesh/mesh.hpp"
+#include "outputs.hpp"
+
+//----------------------------------------------------------------------------------------
+// Constructor: also calls BaseTypeOutput base class constructor
+
+MeshStreamOutput::MeshStreamOutput(ParameterInput *pin, Mesh *pm, OutputParameters op) :
+  BaseTypeOutput(pin, pm, op) {
+  // create directory for spill files written when the consumer cannot keep up
+  mkdir("bin",0775);
+}
+
+//----------------------------------------------------------------------------------------
+// Destructor: close connection to consumer (EOF marks clean end of stream)
+
+MeshStreamOutput::~MeshStreamOutput() {
+  if (sock_fd_ >= 0) {
+    close(sock_fd_);
+    sock_fd_ = -1;
+  }
+}
+
+//----------------------------------------------------------------------------------------
+//! \fn bool MeshStreamOutput::Connect()
+//  \brief (re)establish connection to the consumer at stream_host:stream_port.  The
+//  socket is left non-blocking so subsequent sends can honor the backpressure budget.
+//  Returns false (without error) if the consumer is not accepting connections.
+
+bool MeshStreamOutput::Connect() {
+  if (sock_fd_ >= 0) {return true;}
+
+  char port[16];
+  std::snprintf(port, sizeof(port), "%d", out_params.stream_port);
+  struct addrinfo hints, *res = nullptr;
+  std::memset(&hints, 0, sizeof(hints));
+  hints.ai_family = AF_UNSPEC;
+  hints.ai_socktype = SOCK_STREAM;
+  if (getaddrinfo(out_params.stream_host.c_str(), port, &hints, &res) != 0) {
+    return false;
+  }
+
+  int fd = -1;
+  for (struct addrinfo *ai = res; ai != nullptr; ai = ai->ai_next) {
+    fd = socket(ai->ai_family, ai->ai_socktype, ai->ai_protocol);
+    if (fd < 0) {continue;}
+    fcntl(fd, F_SETFL, fcntl(fd, F_GETFL, 0) | O_NONBLOCK);
+    if (connect(fd, ai->ai_addr, ai->ai_addrlen) == 0) {break;}
+    if (errno == EINPROGRESS) {
+      // wait for the non-blocking connect within the backpressure budget
+      struct pollfd pfd = {fd, POLLOUT, 0};
+      int err = 0;
+      socklen_t len = sizeof(err);
+      if (poll(&pfd, 1, out_params.stall_ms) > 0 &&
+          getsockopt(fd, SOL_SOCKET, SO_ERROR, &err, &len) == 0 && err == 0) {
+        break;
+      }
+    }
+    close(fd);
+    fd = -1;
+  }
+  freeaddrinfo(res);
+
+  if (fd < 0) {return false;}
+  sock_fd_ = fd;
+  warned_ = false;
+  return true;
+}
+
+//----------------------------------------------------------------------------------------
+//! \fn bool MeshStreamOutput::SendAll()
+//  \brief send nbytes over the connected socket, blocking at most stall_ms total across
+//  all retries.  Returns false when the budget is exhausted or the socket fails; the
+//  caller then closes the connection and spills the frame to a file.
+
+bool MeshStreamOutput::SendAll(const char *buf, std::size_t nbytes) {
+  auto start = std::chrono::steady_clock::now();
+  std::size_t sent = 0;
+  while (sent < nbytes) {
+#if defined(MSG_NOSIGNAL)
+    ssize_t n = send(sock_fd_, buf+sent, nbytes-sent, MSG_NOSIGNAL);
+#else
+    ssize_t n = send(sock_fd_, buf+sent, nbytes-sent, 0);
+#endif
+    if (n > 0) {
+      sent += static_cast<std::size_t>(n);
+      continue;
+    }
+    if (n < 0 && (errno == EAGAIN || errno == EWOULDBLOCK || errno == EINTR)) {
+      auto now = std::chrono::steady_clock::now();
+      int elapsed = static_cast<int>(
+        std::chrono::duration_cast<std::chrono::milliseconds>(now - start).count());
+      int remain = out_params.stall_ms - elapsed;
+      if (remain <= 0) {return false;}  // backpressure budget exhausted
+      struct pollfd pfd = {sock_fd_, POLLOUT, 0};
+      if (poll(&pfd, 1, remain) < 0 && errno != EINTR) {return false;}
+      continue;
+    }
+    return false;  // connection reset or other socket error
+  }
+  return true;
+}
+
+//----------------------------------------------------------------------------------------
+//! \fn void MeshStreamOutput:::WriteOutputFile(Mesh *pm)
+//  \brief Cycles over all MeshBlocks, packs OutputData into one frame in the binary
+//  ('bin') record format, and streams it to the consumer (or spills it to a file)
+
+void MeshStreamOutput::WriteOutputFile(Mesh *pm, ParameterInput *pin) {
+  // Header assembled exactly as in MeshBinaryOutput, so stream consumers and spill
+  // files can reuse existing readers of the 'bin' format
+  std::string pre_header, par_header;
+  {
+    std::stringstream msg;
+    msg << "Athena binary output version=1.1" << std::endl
+        // preheader size includes "size of preheader" line up to "number of variables"
+        << "  size of preheader=5" << std::endl
+        << "  time=" << pm->time << std::endl
+        << "  cycle=" << pm->ncycle << std::endl
+        << "  size of location=" << sizeof(Real) << std::endl
+        << "  size of variable=" << sizeof(float) << std::endl
+        << "  number of variables=" << outvars.size() << std::endl
+        << "  variables:  ";
+    for (int n=0; n<outvars.size(); n++) {
+      msg << outvars[n].label.c_str() << "  ";
+    }
+    msg << std::endl;
+    pre_header = msg.str();
+  }
+  {
+    std::stringstream msg;
+    // prepare the input parameters
+    std::stringstream ost;
+    pin->ParameterDump(ost);
+    std::string sbuf=ost.str();
+    msg << "  header offset=" << sbuf.size()*sizeof(char)  << std::endl;
+    par_header = msg.str() + sbuf;
+  }
+
+  int nout_vars = outvars.size();
+  int nout_mbs = outmbs.size();
+  int cells = 0;
+  if (nout_mbs > 0) {
+    int nout1 = outmbs[0].oie - outmbs[0].ois + 1;
+    int nout2 = outmbs[0].oje - outmbs[0].ojs + 1;
+    int nout3 = outmbs[0].oke - outmbs[0].oks + 1;
+    cells = nout1*nout2*nout3;
+  }
+
+  // ois, oie, ojs, oje, oks, oke + il1, il2, il3, level +
+  // x1min, x1max, x2min, x2max, x3min, x3max + data
+  std::size_t data_size = 10*sizeof(int32_t) + 6*sizeof(Real)
+                        + (cells*nout_vars)*sizeof(float);
+  std::uint64_t header_bytes = pre_header.size() + par_header.size();
+  std::uint64_t payload_bytes = data_size*nout_mbs;
+
+  // assemble the complete frame (preamble + header + per-MeshBlock records) in host
+  // memory; on backpressure the same buffer is spilled to a file verbatim
+  std::size_t preamble_size = 16 + 4*sizeof(int32_t) + 2*sizeof(std::uint64_t);
+  std::vector<char> frame(preamble_size + header_bytes + payload_bytes);
+  {
+    char *pb = frame.data();
+    char magic[16] = "athenak-strm-v1";
+    memcpy(pb, magic, 16);
+    pb += 16;
+    int32_t nx = (int32_t)(global_variable::my_rank);
+    memcpy(pb,&(nx),sizeof(nx));
+    pb+=sizeof(nx);
+    nx = (int32_t)(global_variable::nranks);
+    memcpy(pb,&(nx),sizeof(nx));
+    pb+=sizeof(nx);
+    nx = (int32_t)(nout_mbs);
+    memcpy(pb,&(nx),sizeof(nx));
+    pb+=sizeof(nx);
+    nx = (int32_t)(nout_vars);
+    memcpy(pb,&(nx),sizeof(nx));
+    pb+=sizeof(nx);
+    memcpy(pb,&(header_bytes),sizeof(header_bytes));
+    pb+=sizeof(header_bytes);
+    memcpy(pb,&(payload_bytes),sizeof(payload_bytes));
+    pb+=sizeof(payload_bytes);
+    memcpy(pb, pre_header.data(), pre_header.size());
+    pb += pre_header.size();
+    memcpy(pb, par_header.data(), par_header.size());
+  }
+
+  // pack per-MeshBlock records, byte-identical to MeshBinaryOutput
+  char *data = frame.data() + preamble_size + header_bytes;
+  float *single_data = new float[cells];
+
+  // Loop over MeshBlocks
+  for (int m=0; m<nout_mbs; ++m) {
+    char *pdata=&(data[m*data_size]);
+    LogicalLocation loc = pm->lloc_eachmb[outmbs[m].mb_gid];
+    int &ois = outmbs[m].ois;
+    int &oie = outmbs[m].oie;
+    int &ojs = outmbs[m].ojs;
+    int &oje = outmbs[m].oje;
+    int &oks = outmbs[m].oks;
+    int &oke = outmbs[m].oke;
+
+    // output indexing for MB
+    int32_t nx = (int32_t)(ois);
+    memcpy(pdata,&(nx),sizeof(nx));
+    pdata+=sizeof(nx);
+    nx = (int32_t)(oie);
+    memcpy(pdata,&(nx),sizeof(nx));
+    pdata+=sizeof(nx);
+    nx = (int32_t)(ojs);
+    memcpy(pdata,&(nx),sizeof(nx));
+    pdata+=sizeof(nx);
+    nx = (int32_t)(oje);
+    memcpy(pdata,&(nx),sizeof(nx));
+    pdata+=sizeof(nx);
+    nx = (int32_t)(oks);
+    memcpy(pdata,&(nx),sizeof(nx));
+    pdata+=sizeof(nx);
+    nx = (int32_t)(oke);
+    memcpy(pdata,&(nx),sizeof(nx));
+    pdata+=sizeof(nx);
+
+    // logical location lx1, lx2, lx3
+    nx = (int32_t)(loc.lx1);
+    memcpy(pdata,&(nx),sizeof(nx));
+    pdata+=sizeof(nx);
+    nx = (int32_t)(loc.lx2);
+    memcpy(pdata,&(nx),sizeof(nx));
+    pdata+=sizeof(nx);
+    nx = (int32_t)(loc.lx3);
+    memcpy(pdata,&(nx),sizeof(nx));
+    pdata+=sizeof(nx);
+
+    // physical refinement level
+    nx = (int32_t)(loc.level-pm->root_level);
+    memcpy(pdata,&(nx),sizeof(nx));
+    pdata+=sizeof(nx);
+
+    // coordinate location
+    Real xv = outmbs[m].x1min;
+    memcpy(pdata,&(xv),sizeof(xv));
+    pdata+=sizeof(xv);
+    xv = outmbs[m].x1max;
+    memcpy(pdata,&(xv),sizeof(xv));
+    pdata+=sizeof(xv);
+    xv = outmbs[m].x2min;
+    memcpy(pdata,&(xv),sizeof(xv));
+    pdata+=sizeof(xv);
+    xv = outmbs[m].x2max;
+    memcpy(pdata,&(xv),sizeof(xv));
+    pdata+=sizeof(xv);
+    xv = outmbs[m].x3min;
+    memcpy(pdata,&(xv),sizeof(xv));
+    pdata+=sizeof(xv);
+    xv = outmbs[m].x3max;
+    memcpy(pdata,&(xv),sizeof(xv));
+    pdata+=sizeof(xv);
+
+    // output variables
+    float tmp_data;
+    for (int n=0; n<nout_vars; n++) {
+      int cnt=0;
+      for (int k=oks; k<=oke; k++) {
+        for (int j=ojs; j<=oje; j++) {
+          for (int i=ois; i<=oie; i++) {
+            tmp_data = static_cast<float>(outarray(n,m,k-oks,j-ojs,i-ois));
+            single_data[cnt] = tmp_data;
+            cnt++;
+          }
+        }
+      }
+      memcpy(pdata,single_data,cells*sizeof(float));
+      pdata+=cells*sizeof(float);
+    }
+  }
+  delete [] single_data;
+
+  // stream the frame; on backpressure or error close the connection (consumer sees EOF
+  // and discards the partial frame) and spill the complete frame to a file instead
+  bool streamed = false;
+  if (Connect()) {
+    streamed = SendAll(frame.data(), frame.size());
+    if (!streamed) {
+      close(sock_fd_);
+      sock_fd_ = -1;
+    }
+  }
+
+  if (!streamed) {
+    if (!warned_ && global_variable::my_rank == 0) {
+      std::cout << "### WARNING! in " << __FILE__ << " at line " << __LINE__
+         << std::endl << "streaming consumer at " << out_params.stream_host << ":"
+         << out_params.stream_port << " unavailable or stalled, spilling frames to "
+         << "files in bin/" << std::endl;
+      warned_ = true;
+    }
+    // create filename: "bin/file_basename.file_id.XXXXX.rankRRRRRR.strm"
+    std::string fname;
+    char number[32];
+    std::snprintf(number, sizeof(number), "%05d.rank%06d",
+                  out_params.file_number, global_variable::my_rank);
+    fname.assign("bin/");
+    fname.append(out_params.file_basename);
+    fname.append(".");
+    fname.append(out_params.file_id);
+    fname.append(".");
+    fname.append(number);
+    fname.append(".strm");
+
+    FILE *pfile = std::fopen(fname.c_str(), "wb");
+    if (pfile == nullptr) {
+      std::cout << "### FATAL ERROR in " << __FILE__ << " at line " << __LINE__
+         << std::endl << "Spill file '" << fname << "' could not be opened" <<std::endl;
+      exit(EXIT_FAILURE);
+    }
+    std::fwrite(frame.data(), sizeof(char), frame.size(), pfile);
+    std::fclose(pfile);
+  }
+
+  // increment counters
+  out_params.file_number++;
+  if (out_params.last_time < 0.0) {
+    out_params.last_time = pm->time;
+  } else {
+    out_params.last_time += out_params.dt;
+  }
+  pin->SetInteger(out_params.block_name, "file_number", out_params.file_number);
+  pin->SetReal(out_params.block_name, "last_time", out_params.last_time);
+
+  return;
+}
@@ -0,0 +1,149 @@
+//========================================================================================
+// AthenaXXX astrophysical plasma code
+// Copyright(C) 2020 James M. Stone <jmstone@ias.edu> and the Athena code team
+// Licensed under the 3-clause BSD License (the "LICENSE")
+//========================================================================================
+//! \file text_appender.cpp
+//! \brief implements background appender for small text outputs.  A bounded queue of
+//! (filename, text) pairs is drained by a dedicated writer thread: each wakeup grabs the
+//! whole queue, groups entries by filename (preserving order within each file), and does
+//! one fopen/append/fclose per file.  fsync is issued per file at a fixed wall-clock
+//! interval rather than per append, so slow filesystem metadata operations are absorbed
+//! by the thread instead of stalling the time-step loop.
+
+#include <unistd.h>
+
+#include <chrono>
+#include <condition_variable>
+#include <cstdio>
+#include <deque>
+#include <map>
+#include <mutex>
+#include <string>
+#include <thread>
+#include <utility>
+#include <vector>
+
+#include "text_appender.hpp"
+
+namespace appender {
+
+namespace {
+
+// maximum number of queued appends before Append() blocks.  History/event log lines are
+// at most a few KB, so this bounds buffered data to a few MB even on a hung filesystem.
+constexpr int max_queue = 4096;
+// minimum wall-clock seconds between fsync's of any one file
+constexpr double fsync_interval = 30.0;
+
+std::mutex qmutex;
+std::condition_variable cv_work;   // signals writer thread that queue is non-empty
+std::condition_variable cv_space;  // signals producers that queue has drained
+std::deque<std::pair<std::string, std::string>> queue;
+std::thread writer;
+bool started = false;
+bool quit = false;
+bool busy = false;  // writer thread is flushing a batch it already dequeued
+
+//----------------------------------------------------------------------------------------
+//! \fn void WriteBatch()
+//! \brief appends a dequeued batch to disk, one fopen per file.  Runs on writer thread
+//! with qmutex released.  On open failure retries once after a short sleep, then drops
+//! the batch for that file with a warning (losing a history line is preferable to
+//! blocking the queue forever on a dead filesystem).
+
+void WriteBatch(const std::deque<std::pair<std::string, std::string>> &batch,
+                std::map<std::string, std::chrono::steady_clock::time_point> &last_sync) {
+  // group by filename, preserving append order within each file
+  std::map<std::string, std::string> perfile;
+  for (const auto &item : batch) {
+    perfile[item.first].append(item.second);
+  }
+
+  for (const auto &item : perfile) {
+    FILE *pfile = std::fopen(item.first.c_str(), "a");
+    if (pfile == nullptr) {
+      std::this_thread::sleep_for(std::chrono::seconds(1));
+      pfile = std::fopen(item.first.c_str(), "a");
+    }
+    if (pfile == nullptr) {
+      std::fprintf(stderr, "### WARNING in %s at line %d\n"
+                   "Could not open file '%s' for appending, output dropped\n",
+                   __FILE__, __LINE__, item.first.c_str());
+      continue;
+    }
+    std::fputs(item.second.c_str(), pfile);
+    std::fflush(pfile);
+    // fsync at most every fsync_interval seconds per file, decoupled from the cadence
+    auto now = std::chrono::steady_clock::now();
+    auto it = last_sync.find(item.first);
+    if (it == last_sync.end() ||
+        std::chrono::duration<double>(now - it->second).count() > fsync_interval) {
+      fsync(fileno(pfile));
+      last_sync[item.first] = now;
+    }
+    std::fclose(pfile);
+  }
+}
+
+//----------------------------------------------------------------------------------------
+//! \fn void WriterLoop()
+//! \brief body of the dedicated writer thread
+
+void WriterLoop() {
+  std::map<std::string, std::chrono::steady_clock::time_point> last_sync;
+  std::unique_lock<std::mutex> lock(qmutex);
+  while (true) {
+    cv_work.wait(lock, [] { return (!queue.empty() || quit); });
+    if (queue.empty() && quit) break;
+    // grab entire queue and release lock while touching the filesystem
+    std::deque<std::pair<std::string, std::string>> batch;
+    batch.swap(queue);
+    busy = true;
+    lock.unlock();
+    cv_space.notify_all();
+    WriteBatch(batch, last_sync);
+    lock.lock();
+    busy = false;
+    cv_space.notify_all();
+  }
+}
+
+} // namespace
+
+//----------------------------------------------------------------------------------------
+//! \fn void Append(const std::string &fname, const std::string &text)
+//! \brief enqueues text for append to fname.  Returns immediately unless the queue is
+//! full, in which case it blocks until the writer thread drains it.  Starts the writer
+//! thread lazily on first call.  Only call on rank 0.
+
+void Append(const std::string &fname, const std::string &text) {
+  std::unique_lock<std::mutex> lock(qmutex);
+  if (!started) {
+    writer = std::thread(WriterLoop);
+    started = true;
+  }
+  cv_space.wait(lock, [] { return (static_cast<int>(queue.size()) < max_queue); });
+  queue.emplace_back(fname, text);
+  lock.unlock();
+  cv_work.notify_one();
+}
+
+//----------------------------------------------------------------------------------------
+//! \fn void Quit()
+//! \brief drains any queued appends and joins the writer thread.  Called once at the end
+//! of the run, after all outputs have been flushed.
+
+void Quit() {
+  {
+    std::unique_lock<std::mutex> lock(qmutex);
+    if (!started) return;
+    quit = true;
+  }
+  cv_work.notify_one();
+  writer.join();
+  started = false;
+  quit = false;
+}
+
+} // namespace appender
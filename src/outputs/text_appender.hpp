@@ -0,0 +1,26 @@
+#ifndef OUTPUTS_TEXT_APPENDER_HPP_
+#define OUTPUTS_TEXT_APPENDER_HPP_
+//========================================================================================
+// AthenaXXX astrophysical plasma code
+// Copyright(C) 2020 James M. Stone <jmstone@ias.edu> and the Athena code team
+// Licensed under the 3-clause BSD License (the "LICENSE")
+//========================================================================================
+//! \file text_appender.hpp
+//! \brief background appender for small text outputs (history files, event log).  These
+//! files are appended every output cadence by rank 0, and on flaky parallel filesystems
+//! a single fopen/append can take seconds, stalling all ranks at the next collective.
+//! Append() only copies the formatted line into a bounded in-memory queue; a dedicated
+//! writer thread (started lazily on the first call) drains the queue in batches,
+//! opening each file once per batch, so the simulation never blocks on the filesystem.
+//! Data is fsync'ed at a fixed wall-clock interval, decoupled from the output cadence.
+//! Only rank 0 should call Append(); Quit() drains the queue and joins the thread.
+
+#include <string>
+
+namespace appender {
+
+void Append(const std::string &fname, const std::string &text);
+void Quit();
+
+} // namespace appender
+#endif // OUTPUTS_TEXT_APPENDER_HPP_
@@ -0,0 +1,77 @@
+//========================================================================================
+// AthenaXXX astrophysical plasma code
+// Copyright(C) 2020 James M. Stone <jmstone@ias.edu> and the Athena code team
+// Licensed under the 3-clause BSD License (the "LICENSE")
+//========================================================================================
+//! \file time_average.cpp
+//! \brief implements windowed time averaging of output variables.  With
+//! 'time_average=true' in an <output> block the Driver calls AccumulateTimeAverage()
+//! every cycle, which folds the current output variables (including derived quantities
+//! like stresses, computed through the machinery in derived_variables.cpp) into a
+//! device buffer weighted by the timestep.  Only the average over the window since the
+//! previous dump is ever copied to the host and written, so averaged diagnostics that
+//! previously required dumping every few cycles and averaging offline cost one cheap
+//! device kernel per cycle plus I/O at the ordinary output cadence.
+
+#include <vector>
+
+#include "athena.hpp"
+#include "mesh/mesh.hpp"
+#include "outputs.hpp"
+
+//----------------------------------------------------------------------------------------
+//! \fn void BaseTypeOutput::AccumulateTimeAverage()
+//! \brief adds the current output variables, weighted by 'weight' (the timestep), into
+//! the time-average buffer.  On the first call the original data sources are saved and
+//! outvars is redirected at the buffer, so LoadOutputData() emits the averages without
+//! modification.  With AMR, MeshBlock data is redistributed on regridding, so the
+//! window restarts whenever the MeshBlock count on this rank changes.
+
+void BaseTypeOutput::AccumulateTimeAverage(Mesh *pm, Real weight) {
+  if (!(out_params.time_average)) {return;}
+  int nvar = static_cast<int>(outvars.size());
+  if (nvar == 0) {return;}
+
+  // on first call, save original data sources and redirect outvars at the buffer
+  if (tavg_srcs.empty()) {
+    tavg_srcs = outvars;
+    for (int n=0; n<nvar; ++n) {
+      outvars[n].data_index = n;
+      outvars[n].data_ptr = &(tavg_var);
+    }
+  }
+
+  // compute derived quantities (vorticity, stresses, ...) for this cycle
+  if (out_params.contains_derived) {
+    ComputeDerivedVariable(out_params.variable, pm);
+  }
+
+  // (re)size the accumulation buffer; a size change means MeshBlocks were
+  // created/destroyed by AMR, which invalidates the partial sums
+  auto &indcs = pm->mb_indcs;
+  const int nmb = pm->pmb_pack->nmb_thispack;
+  const int n1 = indcs.nx1 + 2*(indcs.ng);
+  const int n2 = (indcs.nx2 > 1)? (indcs.nx2 + 2*(indcs.ng)) : 1;
+  const int n3 = (indcs.nx3 > 1)? (indcs.nx3 + 2*(indcs.ng)) : 1;
+  if (tavg_var.extent_int(0) != nmb || tavg_var.extent_int(1) != nvar ||
+      tavg_var.extent_int(2) != n3 || tavg_var.extent_int(3) != n2 ||
+      tavg_var.extent_int(4) != n1) {
+    Kokkos::realloc(tavg_var, nmb, nvar, n3, n2, n1);
+    tavg_time = 0.0;
+  }
+  if (tavg_time == 0.0) {Kokkos::deep_copy(tavg_var, 0.0);}
+
+  // fold each output variable into its slot of the buffer
+  auto &tavg = tavg_var;
+  for (int n=0; n<nvar; ++n) {
+    auto &src = *(tavg_srcs[n].data_ptr);
+    const int vi = tavg_srcs[n].data_index;
+    const Real w = weight;
+    par_for("tavg_accum", DevExeSpace(), 0, nmb-1, 0, (n3-1), 0, (n2-1), 0, (n1-1),
+    KOKKOS_LAMBDA(const int m, const int k, const int j, const int i) {
+      tavg(m,n,k,j,i) += w*src(m,vi,k,j,i);
+    });
+  }
+  tavg_time += weight;
+  return;
+}
@@ -0,0 +1,141 @@
+//========================================================================================
+// AthenaXXX astrophysical plasma code
+// Copyright(C) 2020 James M. Stone <jmstone@ias.edu> and the Athena code team
+// Licensed under the 3-clause BSD License (the "LICENSE")
+//========================================================================================
+//! \file time_interp.cpp
+//! \brief implements temporal interpolation of output variables.  With
+//! 'time_interp=true' in an <output> block the Driver snapshots the output variables
+//! (including derived quantities) into a device buffer on cycles approaching an output
+//! time, and when the output time is crossed the snapshot is blended with the current
+//! state so the dump corresponds to the exact requested time.  Without it, dumps carry
+//! the state of the first cycle past each output time, which can overshoot by up to a
+//! full timestep; adjusting dt to land cycles on output times instead would clip steps
+//! below the CFL value at every cadence of every output block.
+
+#include <vector>
+
+#include "athena.hpp"
+#include "mesh/mesh.hpp"
+#include "outputs.hpp"
+
+//----------------------------------------------------------------------------------------
+//! \fn void BaseTypeOutput::SnapshotTimeInterp()
+//! \brief copies the current output variables into the snapshot buffer.  On the first
+//! call the original data sources are saved and outvars is redirected at the buffer, so
+//! LoadOutputData() emits the blended state without modification.  The snapshot is only
+//! consumed when the next cycle crosses the output time; since dt can grow by at most
+//! 2x per cycle, the copy is skipped while still far from it.
+
+void BaseTypeOutput::SnapshotTimeInterp(Mesh *pm) {
+  if (!(out_params.time_interp)) {return;}
+  int nvar = static_cast<int>(outvars.size());
+  if (nvar == 0) {return;}
+
+  // on first call, save original data sources and redirect outvars at the buffer
+  if (tint_srcs.empty()) {
+    tint_srcs = outvars;
+    for (int n=0; n<nvar; ++n) {
+      outvars[n].data_index = n;
+      outvars[n].data_ptr = &(tint_var);
+    }
+  }
+
+  // skip the copy (and invalidate any stale snapshot) while no output time can be
+  // crossed by the next cycle
+  if ((out_params.last_time >= 0.0) &&
+      (pm->time + 2.0*(pm->dt) < out_params.last_time + out_params.dt)) {
+    tint_time = -1.0;
+    return;
+  }
+
+  // compute derived quantities (vorticity, stresses, ...) for this cycle
+  if (out_params.contains_derived) {
+    ComputeDerivedVariable(out_params.variable, pm);
+  }
+
+  // (re)size the snapshot buffer; a size change means MeshBlocks were created or
+  // destroyed by AMR, which invalidates any snapshot held
+  auto &indcs = pm->mb_indcs;
+  const int nmb = pm->pmb_pack->nmb_thispack;
+  const int n1 = indcs.nx1 + 2*(indcs.ng);
+  const int n2 = (indcs.nx2 > 1)? (indcs.nx2 + 2*(indcs.ng)) : 1;
+  const int n3 = (indcs.nx3 > 1)? (indcs.nx3 + 2*(indcs.ng)) : 1;
+  if (tint_var.extent_int(0) != nmb || tint_var.extent_int(1) != nvar ||
+      tint_var.extent_int(2) != n3 || tint_var.extent_int(3) != n2 ||
+      tint_var.extent_int(4) != n1) {
+    Kokkos::realloc(tint_var, nmb, nvar, n3, n2, n1);
+  }
+
+  // copy each output variable into its slot of the buffer
+  auto &tint = tint_var;
+  for (int n=0; n<nvar; ++n) {
+    auto &src = *(tint_srcs[n].data_ptr);
+    const int vi = tint_srcs[n].data_index;
+    par_for("tint_snap", DevExeSpace(), 0, nmb-1, 0, (n3-1), 0, (n2-1), 0, (n1-1),
+    KOKKOS_LAMBDA(const int m, const int k, const int j, const int i) {
+      tint(m,n,k,j,i) = src(m,vi,k,j,i);
+    });
+  }
+  tint_time = pm->time;
+  return;
+}
+
+//----------------------------------------------------------------------------------------
+//! \fn Real BaseTypeOutput::InterpolateToOutputTime()
+//! \brief blends the snapshot with the current state so the buffer holds the output
+//! variables linearly interpolated to the requested output time, which is returned so
+//! the Driver can stamp the dump with it.  Falls back to the current state (returning
+//! the current time) when no valid bracketing snapshot is held, e.g. on the first dump
+//! after a restart or an AMR regridding.
+
+Real BaseTypeOutput::InterpolateToOutputTime(Mesh *pm) {
+  int nvar = static_cast<int>(outvars.size());
+  if (nvar == 0) {return pm->time;}
+
+  // ensure the buffer is allocated and redirected, and holds the current state as the
+  // fallback; a snapshot is invalid if taken this cycle, or if MeshBlocks were created
+  // or destroyed by AMR since it was taken (signalled by a buffer size change)
+  auto &indcs = pm->mb_indcs;
+  const int nmb = pm->pmb_pack->nmb_thispack;
+  const int n1 = indcs.nx1 + 2*(indcs.ng);
+  const int n2 = (indcs.nx2 > 1)? (indcs.nx2 + 2*(indcs.ng)) : 1;
+  const int n3 = (indcs.nx3 > 1)? (indcs.nx3 + 2*(indcs.ng)) : 1;
+  bool have_snap = (tint_time >= 0.0) && (tint_time < pm->time) &&
+                   (tint_var.extent_int(0) == nmb) && (tint_var.extent_int(2) == n3) &&
+                   (tint_var.extent_int(3) == n2) && (tint_var.extent_int(4) == n1);
+  if (!have_snap) {
+    Real save_time = tint_time;
+    tint_time = -1.0;
+    SnapshotTimeInterp(pm);
+    // restore staleness marker if the copy was skipped as far from an output time
+    if (tint_time < 0.0) {tint_time = save_time;}
+    return pm->time;
+  }
+
+  Real tout = out_params.last_time + out_params.dt;
+  if ((out_params.last_time < 0.0) || (out_params.dt <= 0.0) ||
+      (tout <= tint_time) || (tout > pm->time)) {
+    return pm->time;
+  }
+
+  // compute derived quantities for the current state before blending
+  if (out_params.contains_derived) {
+    ComputeDerivedVariable(out_params.variable, pm);
+  }
+
+  // blend in place: buffer holds the state at tint_time, and is overwritten by the
+  // next snapshot before it is consumed again
+  auto &tint = tint_var;
+  const Real w = (tout - tint_time)/(pm->time - tint_time);
+  for (int n=0; n<nvar; ++n) {
+    auto &src = *(tint_srcs[n].data_ptr);
+    const int vi = tint_srcs[n].data_index;
+    par_for("tint_blend", DevExeSpace(), 0, nmb-1, 0, (n3-1), 0, (n2-1), 0, (n1-1),
+    KOKKOS_LAMBDA(const int m, const int k, const int j, const int i) {
+      tint(m,n,k,j,i) += w*(src(m,vi,k,j,i) - tint(m,n,k,j,i));
+    });
+  }
+  tint_time = -1.0;
+  return tout;
+}
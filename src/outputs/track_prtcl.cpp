@@ -4,14 +4,21 @@
 // Licensed under the 3-clause BSD License (the "LICENSE")
 //========================================================================================
 //! \file track_prtcl.cpp
-//! \brief writes data for tracked particles in unformatted binary
+//! \brief writes data for tracked particles in unformatted binary.  Records are
+//! buffered in host memory over 'flush_every' output cadences and appended to a
+//! per-rank binary log as one large tag-sorted segment, so the file system sees a few
+//! large appends per rank instead of small strided writes to a shared file at every
+//! cadence.  Each segment is also recorded in a companion text index file, and the
+//! per-rank logs are merged into a single time series with vis/python/trk_merge.py
 
 #include <sys/stat.h>  // mkdir
 #include <vector>
 
 #include <algorithm>
+#include <cstdint>
 #include <cstdio>      // fwrite(), fclose(), fopen(), fnprintf(), snprintf()
 #include <cstdlib>
+#include <cstring>     // memcpy()
 #include <iomanip>
 #include <iostream>
 #include <sstream>
@@ -31,13 +38,18 @@ TrackedParticleOutput::TrackedParticleOutput(ParameterInput *pin, Mesh *pm,
   BaseTypeOutput(pin, pm, op) {
   // create new directory for this output. Comments in binary.cpp constructor explain why
   mkdir("trk",0775);
-  // allocate arrays
-  npout_eachrank.resize(global_variable::nranks);
   ntrack = pin->GetInteger(op.block_name,"nparticles");
   // TODO(@user) improve guess below?
   ntrack_thisrank = ntrack;
 }
 
+//----------------------------------------------------------------------------------------
+// dtor: flushes any records still buffered when the driver exits
+
+TrackedParticleOutput::~TrackedParticleOutput() {
+  FlushTrackSegment();
+}
+
 //----------------------------------------------------------------------------------------
 // TrackedParticleOutput::LoadOutputData()
 // Copies data for tracked particles on this rank to host outpart array
@@ -45,16 +57,20 @@ TrackedParticleOutput::TrackedParticleOutput(ParameterInput *pin, Mesh *pm,
 void TrackedParticleOutput::LoadOutputData(Mesh *pm) {
   particles::Particles *pp = pm->pmb_pack->ppart;
 
-  // Load data for tracked particles on this rank into new device array
+  // Search particle tags on device, loading data for tracked particles on this rank
+  // (those with tag < ntrack) into new device array
   DualArray1D<TrackedParticleData> tracked_prtcl("d_trked",ntrack_thisrank);
   int npart = pm->nprtcl_thisrank;
   auto &pr = pm->pmb_pack->ppart->prtcl_rdata;
   auto &pi = pm->pmb_pack->ppart->prtcl_idata;
-  int counter=0;
-  int *pcounter = &counter;
-  par_for("part_update",DevExeSpace(),0,(npart-1), KOKKOS_LAMBDA(const int p) {
-    if (pi(PTAG,p) < ntrack) {
-      int index = Kokkos::atomic_fetch_add(pcounter,1);
+  int &ntrack_ = ntrack;
+  DualArray1D<int> counter("ptrk_cnt",1);
+  counter.h_view(0) = 0;
+  counter.template modify<HostMemSpace>();
+  counter.template sync<DevExeSpace>();
+  par_for("part_track",DevExeSpace(),0,(npart-1), KOKKOS_LAMBDA(const int p) {
+    if (pi(PTAG,p) < ntrack_) {
+      int index = Kokkos::atomic_fetch_add(&(counter.d_view(0)),1);
       tracked_prtcl.d_view(index).tag = pi(PTAG,p);
       tracked_prtcl.d_view(index).x   = pr(IPX,p);
       tracked_prtcl.d_view(index).y   = pr(IPY,p);
@@ -64,12 +80,9 @@ void TrackedParticleOutput::LoadOutputData(Mesh *pm) {
       tracked_prtcl.d_view(index).vz  = pr(IPVZ,p);
     }
   });
-  npout = counter;
-  // share number of tracked particles to be output across all ranks
-  npout_eachrank[global_variable::my_rank] = npout;
-#if MPI_PARALLEL_ENABLED
-  MPI_Allgather(&npout, 1, MPI_INT, npout_eachrank.data(), 1, MPI_INT, MPI_COMM_WORLD);
-#endif
+  counter.template modify<DevExeSpace>();
+  counter.template sync<HostMemSpace>();
+  npout = counter.h_view(0);
   tracked_prtcl.resize(npout);
   // sync tracked particle device array with host
   tracked_prtcl.template modify<DevExeSpace>();
@@ -82,96 +95,121 @@ void TrackedParticleOutput::LoadOutputData(Mesh *pm) {
 
 //----------------------------------------------------------------------------------------
 //! \fn void TrackedParticleOutput:::WriteOutputFile(Mesh *pm)
-//! \brief Cycles over all tracked particles on this rank and writes ouput data
-//! With MPI, all particles are written to the same file.
+//! \brief Appends this cadence's records (sorted by tag) to the host-memory buffer, and
+//! flushes the buffer to this rank's binary log once 'flush_every' cadences have
+//! accumulated.  No inter-rank communication or shared-file writes are performed; each
+//! particle appears in the log of whichever rank owned it at each cadence, and the
+//! per-rank logs are merged offline.
 
 void TrackedParticleOutput::WriteOutputFile(Mesh *pm, ParameterInput *pin) {
-  int big_end = IsBigEndian(); // =1 on big endian machine
+  // append records sorted by tag, so segments can be merged with a simple k-way merge
+  std::size_t start = trk_records.size();
+  trk_records.resize(start + npout);
+  for (int p=0; p<npout; ++p) {
+    trk_records[start + p] = outpart(p);
+  }
+  std::sort(trk_records.begin() + start, trk_records.end(),
+            [](const TrackedParticleData &a, const TrackedParticleData &b) {
+              return a.tag < b.tag;
+            });
+  trk_cadences.push_back({pm->time, pm->ncycle, npout});
+
+  if (static_cast<int>(trk_cadences.size()) >= out_params.trk_flush_every) {
+    FlushTrackSegment();
+  }
+
+  // increment counters
+  if (out_params.last_time < 0.0) {
+    out_params.last_time = pm->time;
+  } else {
+    out_params.last_time += out_params.dt;
+  }
+  pin->SetReal(out_params.block_name, "last_time", out_params.last_time);
+  return;
+}
 
-  // create filename: "trk/file_basename".trk
+//----------------------------------------------------------------------------------------
+//! \fn void TrackedParticleOutput::FlushTrackSegment()
+//! \brief Appends all buffered cadences to this rank's binary log as one segment:
+//!   [int32 ncadence][int32 nrecord]
+//!   [ncadence x (double time, int32 cycle, int32 count)]
+//!   [nrecord x (int32 tag, 6 x float (x,y,z,vx,vy,vz))]
+//! where records of each cadence appear in cadence order, sorted by tag within each
+//! cadence.  One text line per segment (offset, counts, time range) is appended to the
+//! companion index file so merge tools can seek without parsing the whole log.
+
+void TrackedParticleOutput::FlushTrackSegment() {
+  if (trk_cadences.empty()) return;
+
+  // create filename: "trk/file_basename" + "." + rank + ".trk" (one log per rank, so
+  // appends never contend for the same file or inode across ranks)
   std::string fname;
+  char rank_num[7];
+  std::snprintf(rank_num, sizeof(rank_num), "%06d", global_variable::my_rank);
   fname.assign("trk/");
   fname.append(out_params.file_basename);
+  fname.append(".");
+  fname.append(rank_num);
   fname.append(".trk");
 
-  // Root process opens/creates file and appends string
-  if (global_variable::my_rank == 0) {
-    std::stringstream msg;
-    msg << std::endl << "# AthenaK tracked particle data at time= " << pm->time
-        << "  nranks= " << global_variable::nranks
-        << "  cycle=" << pm->ncycle
-        << "  ntracked_prtcls=" << ntrack << std::endl;
-    FILE *pfile;
-    if ((pfile = std::fopen(fname.c_str(),"a")) == nullptr) {
-      std::cout << "### FATAL ERROR in " << __FILE__ << " at line " << __LINE__
-        << std::endl << "Output file '" << fname << "' could not be opened" <<std::endl;
-      exit(EXIT_FAILURE);
-    }
-    std::fprintf(pfile,"%s \n",msg.str().c_str());
-    std::fclose(pfile);
+  FILE *pfile;
+  if ((pfile = std::fopen(fname.c_str(),"ab")) == nullptr) {
+    std::cout << "### FATAL ERROR in " << __FILE__ << " at line " << __LINE__
+      << std::endl << "Output file '" << fname << "' could not be opened" << std::endl;
+    exit(EXIT_FAILURE);
   }
-
-  // Now all ranks open file and append data
-  IOWrapper partfile;
-  partfile.Open(fname.c_str(), IOWrapper::FileMode::append);
-  std::size_t header_offset = partfile.GetPosition();
-//  std::size_t header_offset = 0;
-
-  // allocate 1D vector of floats used to convert and output particle data
-  float *data = new float[6*npout];
-  // Loop over particles, load positions into data[]
-  for (int p=0; p<npout; ++p) {
-    data[ 6*p   ] = static_cast<float>(outpart(p).x);
-    data[(6*p)+1] = static_cast<float>(outpart(p).y);
-    data[(6*p)+2] = static_cast<float>(outpart(p).z);
-    data[(6*p)+3] = static_cast<float>(outpart(p).vx);
-    data[(6*p)+4] = static_cast<float>(outpart(p).vy);
-    data[(6*p)+5] = static_cast<float>(outpart(p).vz);
-  }
-  // calculate local data offset
-  std::vector<int> rank_offset(global_variable::nranks, 0);
-  int npout_min = pm->nprtcl_eachrank[0];
-  for (int n=1; n<global_variable::nranks; ++n) {
-    rank_offset[n] = rank_offset[n-1] + npout_eachrank[n-1];
-    npout_min = std::min(npout_min, npout_eachrank[n]);
+  std::int64_t seg_offset = static_cast<std::int64_t>(std::ftell(pfile));
+
+  // segment header and per-cadence metadata
+  std::int32_t ncad = static_cast<std::int32_t>(trk_cadences.size());
+  std::int32_t nrec = static_cast<std::int32_t>(trk_records.size());
+  std::fwrite(&ncad, sizeof(std::int32_t), 1, pfile);
+  std::fwrite(&nrec, sizeof(std::int32_t), 1, pfile);
+  for (int n=0; n<ncad; ++n) {
+    double time = static_cast<double>(trk_cadences[n].time);
+    std::int32_t cycle = trk_cadences[n].cycle;
+    std::int32_t count = trk_cadences[n].npout;
+    std::fwrite(&time,  sizeof(double), 1, pfile);
+    std::fwrite(&cycle, sizeof(std::int32_t), 1, pfile);
+    std::fwrite(&count, sizeof(std::int32_t), 1, pfile);
   }
 
-  std::size_t datasize = sizeof(float);
-  // Write tracked particle data collectively over minimum shared number of prtcls
-  for (int p=0; p<npout_min; ++p) {
-    // offset computed assuming tags run 0...(ntrack-1) sequentially
-    std::size_t myoffset = header_offset + 6*outpart(p).tag;
-    // Write particle positions collectively for minimum number of particles across ranks
-    if (partfile.Write_any_type_at_all(&(data[0]),6,myoffset,"float") != 6) {
-      std::cout << "### FATAL ERROR in " << __FILE__ << " at line " << __LINE__
-          << std::endl << "particle data not written correctly to tracked particle file"
-          << std::endl;
-      exit(EXIT_FAILURE);
-    }
+  // convert buffered records to (int32 tag, 6 floats) and write in one large append
+  std::vector<char> data(nrec*(sizeof(std::int32_t) + 6*sizeof(float)));
+  char *pb = data.data();
+  for (int p=0; p<nrec; ++p) {
+    std::int32_t tag = trk_records[p].tag;
+    float pos[6] = {static_cast<float>(trk_records[p].x),
+                    static_cast<float>(trk_records[p].y),
+                    static_cast<float>(trk_records[p].z),
+                    static_cast<float>(trk_records[p].vx),
+                    static_cast<float>(trk_records[p].vy),
+                    static_cast<float>(trk_records[p].vz)};
+    std::memcpy(pb, &tag, sizeof(std::int32_t));
+    std::memcpy(pb + sizeof(std::int32_t), pos, 6*sizeof(float));
+    pb += sizeof(std::int32_t) + 6*sizeof(float);
   }
-  // Write particle positions individually for remaining particles on each rank
-  for (int p=npout_min; p<npout; ++p) {
-    // offset computed assuming tags run 0...(ntrack-1) sequentially
-    std::size_t myoffset = header_offset + 6*outpart(p).tag;
-    // Write particle positions collectively for minimum number of particles across ranks
-    if (partfile.Write_any_type_at(&(data[0]),6,myoffset,"float") != 6) {
-      std::cout << "### FATAL ERROR in " << __FILE__ << " at line " << __LINE__
-          << std::endl << "particle data not written correctly to tracked particle file"
-          << std::endl;
-      exit(EXIT_FAILURE);
-    }
+  if (std::fwrite(data.data(), 1, data.size(), pfile) != data.size()) {
+    std::cout << "### FATAL ERROR in " << __FILE__ << " at line " << __LINE__
+        << std::endl << "particle data not written correctly to tracked particle file"
+        << std::endl;
+    exit(EXIT_FAILURE);
   }
-
-  // close the output file and clean up
-  partfile.Close();
-  delete[] data;
-
-  // increment counters
-  if (out_params.last_time < 0.0) {
-    out_params.last_time = pm->time;
-  } else {
-    out_params.last_time += out_params.dt;
+  std::fclose(pfile);
+
+  // append one line per segment to companion index file
+  fname.append(".idx");
+  if ((pfile = std::fopen(fname.c_str(),"a")) == nullptr) {
+    std::cout << "### FATAL ERROR in " << __FILE__ << " at line " << __LINE__
+      << std::endl << "Output file '" << fname << "' could not be opened" << std::endl;
+    exit(EXIT_FAILURE);
   }
-  pin->SetReal(out_params.block_name, "last_time", out_params.last_time);
+  std::fprintf(pfile, "%lld %d %d %.16e %.16e\n", static_cast<long long>(seg_offset),
+               ncad, nrec, static_cast<double>(trk_cadences[0].time),
+               static_cast<double>(trk_cadences[ncad-1].time));
+  std::fclose(pfile);
+
+  trk_cadences.clear();
+  trk_records.clear();
   return;
 }
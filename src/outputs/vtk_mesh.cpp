@@ -21,6 +21,8 @@
 #include <iostream>
 #include <sstream>
 #include <string>
+#include <thread>
+#include <vector>
 #include <limits> // numeric_limits<>
 
 #include "athena.hpp"
@@ -53,6 +55,10 @@ MeshVTKOutput::MeshVTKOutput(ParameterInput *pin, Mesh *pm, OutputParameters op)
 //!  5. Data.  An arbitrary number of scalars and vectors can be written
 
 void MeshVTKOutput::WriteOutputFile(Mesh *pm, ParameterInput *pin) {
+  // With 'async=true' writes of the previous dump may still be in flight on the
+  // background thread; wait for them to finish before starting a new dump
+  FenceAsyncWrite();
+
   int big_end = IsBigEndian(); // =1 on big endian machine
   // create filename: "vtk/file_basename"."file_id"."gid"."XXXXX".vtk
   // where XXXXX = 5-digit file_number, and gid only added if specified
@@ -142,112 +148,151 @@ void MeshVTKOutput::WriteOutputFile(Mesh *pm, ParameterInput *pin) {
   // If GID is specified in input file so only one MB written, then file is written
   // using serial mode below
 
-  // open file and write file header
+  // assemble data, then open file and write header and data (possibly in background)
   if ((pm->nmb_total > 1) && (out_params.gid < 0)) {
-    MPI_File fh;
-    if (MPI_File_open(MPI_COMM_WORLD, fname.c_str(), MPI_MODE_CREATE | MPI_MODE_WRONLY,
-                      MPI_INFO_NULL, &fh) != MPI_SUCCESS) {
-      std::cout << "### FATAL ERROR in " << __FILE__ << " at line " << __LINE__
-        << std::endl << "Output file '" << fname << "' could not be opened" <<std::endl;
-        exit(EXIT_FAILURE);
-    }
-    if (global_variable::my_rank == 0) {
-      MPI_File_write(fh, msg.str().c_str(), msg.str().size(), MPI_BYTE,MPI_STATUS_IGNORE);
-    }
-    size_t header_size = msg.str().size();
-
-    // allocate 1D vector of floats used to convert and output entire 3D data
+    // dimensions of MeshBlocks
     int nx1 = outmbs[0].oie - outmbs[0].ois + 1;
     int nx2 = outmbs[0].oje - outmbs[0].ojs + 1;
     int nx3 = outmbs[0].oke - outmbs[0].oks + 1;
-    float *data = new float[nx1*nx2*nx3];
-
-    // create new datatype representing array of cells in MeshBlocks
-    MPI_Datatype block;
-    int bsize[3] = {nx3, nx2, nx1};      // total number of cells in MB
-    int bstrt[3] = {0, 0, 0};            // i/j/k starting index of this block
-    MPI_Type_create_subarray(3,bsize,bsize,bstrt,MPI_ORDER_C,MPI_FLOAT,&block);
-    MPI_Type_commit(&block);
-
-    // create new datatype representing grid of MeshBlocks
-    MPI_Datatype grid;
-    int gridsize[3] = {nout3, nout2, nout1};   // total number of cells over all MBs
-    int mbstrt[3] = {0, 0, 0};                 // i/j/k starting index of blocks
-    int mbsize[3] = {nx3, nx2, nx1};           // number of cells in blocks
-    MPI_Type_create_subarray(3,gridsize,mbsize,mbstrt,MPI_ORDER_C,MPI_FLOAT,&grid);
-    MPI_Type_commit(&grid);
-
-    // Loop over variables
+    std::size_t mbcells = nx1*nx2*nx3;
     int nout_vars = outvars.size();
+
+    // Assemble phase: convert all data to floats in big endian order in a single
+    // buffer, build the data header for each variable, and record the location of each
+    // MB in the 3D grid of MBs.  The write phase below then reads nothing from outarray
+    // or the Mesh, both of which may be updated by the main thread before background
+    // writes complete when 'async=true'.
+    float *data = new float[mbcells*nout_mbs*nout_vars];  // freed by write phase
+    std::vector<std::string> var_msgs(nout_vars);
     for (int n=0; n<nout_vars; ++n) {
-      // write header this variable (SCALARS or VECTORS, name, type, color table)
+      // header for this variable (SCALARS or VECTORS, name, type, color table)
       std::stringstream data_msg;
       data_msg << std::endl << "SCALARS " << outvars[n].label.c_str()
                << " float" << std::endl
                << "LOOKUP_TABLE default" << std::endl;
-      if (global_variable::my_rank == 0) {
-        MPI_File_write(fh, data_msg.str().c_str(), data_msg.str().size(),
-                          MPI_BYTE, MPI_STATUS_IGNORE);
-      }
-      header_size += data_msg.str().size();
-
-      // Loop over max number of MeshBlocks to be written on any rank
-      // This guarantees collective MPI functions are called by all ranks
-      MPI_Datatype mygrid;
-      for (int m=0; m<noutmbs_max; ++m) {
-        // if there is a MB to be written, set location in 3D grid of MBs in output file.
-        if (m < nout_mbs) {
-          LogicalLocation lloc = pm->lloc_eachmb[outmbs[m].mb_gid];
-          // calculate indices of this MeshBlock in 3D grid of MBs
-          int imb = (out_params.slice1 || (out_params.gid >= 0))? 0 : lloc.lx1;
-          int jmb = (out_params.slice2 || (out_params.gid >= 0))? 0 : lloc.lx2;
-          int kmb = (out_params.slice3 || (out_params.gid >= 0))? 0 : lloc.lx3;
-
-          // convert data to float and byte swap into big endian order
-          for (int k=0; k<nx3; ++k) {
-            for (int j=0; j<nx2; ++j) {
-              for (int i=0; i<nx1; ++i) {
-                int indx = i + j*indcs.nx1 + k*indcs.nx1*indcs.nx2;
-                data[indx] = static_cast<float>(outarray(n,m,k,j,i));
-              }
+      var_msgs[n] = data_msg.str();
+
+      // convert data to float and byte swap into big endian order
+      for (int m=0; m<nout_mbs; ++m) {
+        float *mbdata = &(data[(n*nout_mbs + m)*mbcells]);
+        for (int k=0; k<nx3; ++k) {
+          for (int j=0; j<nx2; ++j) {
+            for (int i=0; i<nx1; ++i) {
+              int indx = i + j*indcs.nx1 + k*indcs.nx1*indcs.nx2;
+              mbdata[indx] = static_cast<float>(outarray(n,m,k,j,i));
             }
           }
-          if (!big_end) {
-            for (int i=0; i<(nx1*nx2*nx3); ++i) {
-              Swap4Bytes(&data[i]);
-            }
+        }
+        if (!big_end) {
+          for (int i=0; i<(nx1*nx2*nx3); ++i) {
+            Swap4Bytes(&mbdata[i]);
           }
-          // create new datatype representing this block in grid of MBs, and set file view
-          int strt[3] = {kmb*nx3, jmb*nx2, imb*nx1};   // starting indices of this block
-          MPI_Type_create_subarray(3,gridsize,mbsize,strt,MPI_ORDER_C,MPI_FLOAT,&mygrid);
-          MPI_Type_commit(&mygrid);
-          MPI_File_set_view(fh, header_size, MPI_FLOAT, mygrid, "native", MPI_INFO_NULL);
-        } else {
-          // if no data to be written, set file view to default
-          // file view function is a collective operation, so must be called by all ranks
-          MPI_File_set_view(fh, header_size, MPI_FLOAT, grid, "native", MPI_INFO_NULL);
         }
+      }
+    }
+    // calculate indices of each MeshBlock in 3D grid of MBs
+    std::vector<int> imb(nout_mbs), jmb(nout_mbs), kmb(nout_mbs);
+    for (int m=0; m<nout_mbs; ++m) {
+      LogicalLocation lloc = pm->lloc_eachmb[outmbs[m].mb_gid];
+      imb[m] = (out_params.slice1 || (out_params.gid >= 0))? 0 : lloc.lx1;
+      jmb[m] = (out_params.slice2 || (out_params.gid >= 0))? 0 : lloc.lx2;
+      kmb[m] = (out_params.slice3 || (out_params.gid >= 0))? 0 : lloc.lx3;
+    }
+    // copy everything else the write phase reads from this class
+    bool async_write = out_params.async;
+    int nmbs_min = noutmbs_min;
+    int nmbs_max = noutmbs_max;
+    std::string header = msg.str();
+    MPI_Comm write_comm = (async_write)? io_comm_ : MPI_COMM_WORLD;
+
+    // Write phase: opens file, writes header and data, closes file, and frees the data
+    // buffer.  Runs on the background thread when 'async=true'.
+    auto write_and_close = [=]() {
+      MPI_File fh;
+      if (MPI_File_open(write_comm, fname.c_str(), MPI_MODE_CREATE | MPI_MODE_WRONLY,
+                        MPI_INFO_NULL, &fh) != MPI_SUCCESS) {
+        std::cout << "### FATAL ERROR in " << __FILE__ << " at line " << __LINE__
+          << std::endl << "Output file '" << fname << "' could not be opened" <<std::endl;
+          exit(EXIT_FAILURE);
+      }
+      if (global_variable::my_rank == 0) {
+        MPI_File_write(fh, header.c_str(), header.size(), MPI_BYTE, MPI_STATUS_IGNORE);
+      }
+      size_t header_size = header.size();
+
+      // create new datatype representing array of cells in MeshBlocks
+      MPI_Datatype block;
+      int bsize[3] = {nx3, nx2, nx1};      // total number of cells in MB
+      int bstrt[3] = {0, 0, 0};            // i/j/k starting index of this block
+      MPI_Type_create_subarray(3,bsize,bsize,bstrt,MPI_ORDER_C,MPI_FLOAT,&block);
+      MPI_Type_commit(&block);
 
-        // every rank has a MB to write, so write collectively
-        if (m < noutmbs_min) {
-          MPI_File_write_all(fh, &(data[0]), 1, block, MPI_STATUS_IGNORE);
-        // some ranks are finished writing, so use non-collective write
-        } else if (m < nout_mbs) {
-          MPI_File_write(fh, &(data[0]), 1, block, MPI_STATUS_IGNORE);
+      // create new datatype representing grid of MeshBlocks
+      MPI_Datatype grid;
+      int gridsize[3] = {nout3, nout2, nout1};   // total number of cells over all MBs
+      int mbstrt[3] = {0, 0, 0};                 // i/j/k starting index of blocks
+      int mbsize[3] = {nx3, nx2, nx1};           // number of cells in blocks
+      MPI_Type_create_subarray(3,gridsize,mbsize,mbstrt,MPI_ORDER_C,MPI_FLOAT,&grid);
+      MPI_Type_commit(&grid);
+
+      // Loop over variables
+      for (int n=0; n<nout_vars; ++n) {
+        // write header this variable (SCALARS or VECTORS, name, type, color table)
+        if (global_variable::my_rank == 0) {
+          MPI_File_write(fh, var_msgs[n].c_str(), var_msgs[n].size(),
+                            MPI_BYTE, MPI_STATUS_IGNORE);
         }
-      }  // end loop over MeshBlocks
-      MPI_Type_free(&mygrid);
-
-      // reset view to stream of bytes in preparation for adding next data header
-      header_size += nout1*nout2*nout3*sizeof(float);
-      MPI_File_set_view(fh, header_size, MPI_BYTE, MPI_BYTE, "native", MPI_INFO_NULL);
-    }  // end loop over variables
-
-    // close the output file and clean up
-    MPI_Type_free(&block);
-    MPI_Type_free(&grid);
-    MPI_File_close(&fh);
-    delete[] data;
+        header_size += var_msgs[n].size();
+
+        // Loop over max number of MeshBlocks to be written on any rank
+        // This guarantees collective MPI functions are called by all ranks
+        MPI_Datatype mygrid;
+        for (int m=0; m<nmbs_max; ++m) {
+          const float *mbdata = &(data[0]);
+          // if there is a MB to be written, set location in 3D grid of MBs in file.
+          if (m < nout_mbs) {
+            mbdata = &(data[(n*nout_mbs + m)*mbcells]);
+            // create new datatype representing this block in grid of MBs, set file view
+            int strt[3] = {kmb[m]*nx3, jmb[m]*nx2, imb[m]*nx1};  // start of this block
+            MPI_Type_create_subarray(3,gridsize,mbsize,strt,MPI_ORDER_C,MPI_FLOAT,
+                                     &mygrid);
+            MPI_Type_commit(&mygrid);
+            MPI_File_set_view(fh, header_size, MPI_FLOAT, mygrid, "native",
+                              MPI_INFO_NULL);
+          } else {
+            // if no data to be written, set file view to default
+            // file view function is a collective operation, so must be called by all
+            MPI_File_set_view(fh, header_size, MPI_FLOAT, grid, "native", MPI_INFO_NULL);
+          }
+
+          // every rank has a MB to write, so write collectively
+          if (m < nmbs_min) {
+            MPI_File_write_all(fh, mbdata, 1, block, MPI_STATUS_IGNORE);
+          // some ranks are finished writing, so use non-collective write
+          } else if (m < nout_mbs) {
+            MPI_File_write(fh, mbdata, 1, block, MPI_STATUS_IGNORE);
+          }
+        }  // end loop over MeshBlocks
+        MPI_Type_free(&mygrid);
+
+        // reset view to stream of bytes in preparation for adding next data header
+        header_size += nout1*nout2*nout3*sizeof(float);
+        MPI_File_set_view(fh, header_size, MPI_BYTE, MPI_BYTE, "native", MPI_INFO_NULL);
+      }  // end loop over variables
+
+      // close the output file and clean up
+      MPI_Type_free(&block);
+      MPI_Type_free(&grid);
+      MPI_File_close(&fh);
+      delete[] data;
+    };
+
+    // write in background thread (overlapping with subsequent cycles) or synchronously
+    if (async_write) {
+      iothread_ = std::thread(write_and_close);
+    } else {
+      write_and_close();
+    }
     parallel_write=true;
   }
 
@@ -255,28 +300,25 @@ void MeshVTKOutput::WriteOutputFile(Mesh *pm, ParameterInput *pin) {
   if (!(parallel_write)) {
     //----- WRITE SERIAL FILES: -----
     // For serial (non-mpi) runs, use standard Unix-I/O functions.
-    // open file and write header
-    FILE *pfile;
-    if ((pfile = std::fopen(fname.c_str(),"w")) == nullptr) {
-      std::cout << "### FATAL ERROR in " << __FILE__ << " at line " << __LINE__
-        << std::endl << "Output file '" << fname << "' could not be opened" <<std::endl;
-        exit(EXIT_FAILURE);
-    }
-    std::fprintf(pfile,"%s",msg.str().c_str());
-
-    // allocate 1D vector of floats used to convert and output entire 3D data
-    float *data = new float[nout1*nout2*nout3];
-    // Loop over variables
+    std::size_t gridcells = nout1*nout2*nout3;
     int nout_vars = outvars.size();
+
+    // Assemble phase: convert all data to floats in big endian order in a single
+    // buffer, and build the data header for each variable, so that the write phase
+    // below reads nothing from outarray (which may be updated by the main thread before
+    // background writes complete when 'async=true')
+    float *data = new float[gridcells*nout_vars];  // freed by write phase
+    std::vector<std::string> var_msgs(nout_vars);
     for (int n=0; n<nout_vars; ++n) {
-      // write data type (SCALARS or VECTORS) and name
+      // data type (SCALARS or VECTORS) and name
       std::stringstream data_msg;
       data_msg << std::endl << "SCALARS " << outvars[n].label.c_str()
                << " float" << std::endl
                << "LOOKUP_TABLE default" << std::endl;
-      std::fprintf(pfile,"%s",data_msg.str().c_str());
+      var_msgs[n] = data_msg.str();
 
       // Loop over MeshBlocks, insert variable into 3D array
+      float *vdata = &(data[n*gridcells]);
       for (int m=0; m<nout_mbs; ++m) {
         LogicalLocation lloc = pm->lloc_eachmb[outmbs[m].mb_gid];
         // calculate indices of this MeshBlock in 3D grid of MBs
@@ -296,7 +338,7 @@ void MeshVTKOutput::WriteOutputFile(Mesh *pm, ParameterInput *pin) {
               int indx = imb*indcs.nx1 + (i-ois) +
                         (jmb*indcs.nx2 + (j-ojs))*nout1 +
                         (kmb*indcs.nx3 + (k-oks))*nout1*nout2;
-              data[indx] = static_cast<float>(outarray(n,m,k-oks,j-ojs,i-ois));
+              vdata[indx] = static_cast<float>(outarray(n,m,k-oks,j-ojs,i-ois));
             }
           }
         }
@@ -304,14 +346,40 @@ void MeshVTKOutput::WriteOutputFile(Mesh *pm, ParameterInput *pin) {
 
       // swap data for this variable into big endian order
       if (!big_end) {
-        for (int i=0; i<(nout1*nout2*nout3); ++i) { Swap4Bytes(&data[i]); }
+        for (int i=0; i<(nout1*nout2*nout3); ++i) { Swap4Bytes(&vdata[i]); }
       }
-      // now write the data as unformatted binary
-      std::fwrite(&(data[0]), sizeof(float), nout1*nout2*nout3, pfile);
     }
-    // close the output file and clean up
-    std::fclose(pfile);
-    delete[] data;
+    std::string header = msg.str();
+    bool async_write = out_params.async;
+
+    // Write phase: opens file, writes header and data, closes file, and frees the data
+    // buffer.  Runs on the background thread when 'async=true'.
+    auto write_and_close = [=]() {
+      // open file and write header
+      FILE *pfile;
+      if ((pfile = std::fopen(fname.c_str(),"w")) == nullptr) {
+        std::cout << "### FATAL ERROR in " << __FILE__ << " at line " << __LINE__
+          << std::endl << "Output file '" << fname << "' could not be opened" <<std::endl;
+          exit(EXIT_FAILURE);
+      }
+      std::fprintf(pfile,"%s",header.c_str());
+
+      // Loop over variables, writing data header then data as unformatted binary
+      for (int n=0; n<nout_vars; ++n) {
+        std::fprintf(pfile,"%s",var_msgs[n].c_str());
+        std::fwrite(&(data[n*gridcells]), sizeof(float), gridcells, pfile);
+      }
+      // close the output file and clean up
+      std::fclose(pfile);
+      delete[] data;
+    };
+
+    // write in background thread (overlapping with subsequent cycles) or synchronously
+    if (async_write) {
+      iothread_ = std::thread(write_and_close);
+    } else {
+      write_and_close();
+    }
   }
 
   // increment counters
@@ -171,40 +171,48 @@ void ParameterInput::LoadFromStream(std::istream &is) {
 //  \brief Read the parameters from an input or restart file.
 
 void ParameterInput::LoadFromFile(IOWrapper &input) {
-  std::stringstream par;
-  constexpr int kBufSize = 4096;
-  char buf[kBufSize];
-  IOWrapperSizeT header = 0, ret, loc;
-
-  // search for <par_end> (reading from restart files) or EOF (reading from input file).
-  do {
-    if (global_variable::my_rank == 0) { // only the master process reads header from file
+  constexpr int kBufSize = 65536;
+  constexpr IOWrapperSizeT kMaxHeader = 16777216;
+  std::string partext;
+  IOWrapperSizeT header = 0;
+
+  // The master process reads the header, searching for <par_end> (reading from restart
+  // files) or EOF (reading from input file).  Only newly read data (plus a small
+  // overlap for a marker split across chunks) is searched on each iteration, and the
+  // assembled parameter text is broadcast once rather than chunk-by-chunk.
+  if (global_variable::my_rank == 0) {
+    char buf[kBufSize];
+    IOWrapperSizeT ret;
+    do {
       ret = input.Read_bytes(buf, sizeof(char), kBufSize);
-    }
+      std::size_t sstart = (partext.size() > 9)? (partext.size() - 9) : 0;
+      partext.append(buf, ret);
+      std::size_t loc = partext.find("<par_end>", sstart);
+      if (loc != std::string::npos) { // found <par_end>
+        partext.resize(loc + 10);     // trim to the header length
+        break;
+      }
+      if (partext.size() > kMaxHeader) {
+        std::cout << "### FATAL ERROR in " << __FILE__ << " at line " << __LINE__
+                  << std::endl << "<par_end> is not found in the first 16MBytes."
+                  << std::endl << "Probably the file is broken or the wrong file is "
+                  << "specified" << std::endl;
+        std::exit(EXIT_FAILURE);
+      }
+    } while (ret == kBufSize); // till EOF (or par_end is found)
+    header = partext.size();
+  }
+
 #if MPI_PARALLEL_ENABLED
-    // then broadcasts it
-    MPI_Bcast(&ret, sizeof(IOWrapperSizeT), MPI_BYTE, 0, MPI_COMM_WORLD);
-    MPI_Bcast(buf, ret, MPI_BYTE, 0, MPI_COMM_WORLD);
+  // broadcast length and parameter text in two messages
+  MPI_Bcast(&header, sizeof(IOWrapperSizeT), MPI_BYTE, 0, MPI_COMM_WORLD);
+  partext.resize(header);
+  MPI_Bcast(const_cast<char*>(partext.data()), header, MPI_BYTE, 0, MPI_COMM_WORLD);
 #endif
-    par.write(buf, ret); // add the buffer into the stream
-    header += ret;
-    std::string sbuf = par.str(); // create string for search
-    loc = sbuf.find("<par_end>", 0); // search from the top of the stream
-    if (loc != std::string::npos) { // found <par_end>
-      header = loc + 10; // store the header length
-      break;
-    }
-    if (header > kBufSize*10) {
-      std::cout << "### FATAL ERROR in " << __FILE__ << " at line " << __LINE__
-                << std::endl << "<par_end> is not found in the first 40KBytes."
-                << std::endl << "Probably the file is broken or the wrong file is "
-                << "specified" << std::endl;
-      std::exit(EXIT_FAILURE);
-    }
-  } while (ret == kBufSize); // till EOF (or par_end is found)
 
-  // Now par contains the parameter inputs + some additional including <par_end>
+  // Now partext contains the parameter inputs up to and including <par_end>
   // Read the stream and load the parameters
+  std::stringstream par(partext);
   LoadFromStream(par);
   // Seek the file to the end of the header
   input.Seek(header);
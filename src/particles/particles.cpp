@@ -33,6 +33,35 @@ Particles::Particles(MeshBlockPack *ppack, ParameterInput *pin) :
   // read number of particles per cell, and calculate number of particles this pack
   Real ppc = pin->GetOrAddReal("particles","ppc",1.0);
 
+  // read number of cycles between sort-by-cell passes that restore memory coherence
+  // of the particle arrays for the pusher (0 = never sort)
+  sort_ncycle = pin->GetOrAddInteger("particles","sort_ncycle",0);
+  if (sort_ncycle < 0) {
+    std::cout << "### FATAL ERROR in " << __FILE__ << " at line " << __LINE__ << std::endl
+              << "Parameter sort_ncycle in <particles> block must be >= 0" << std::endl;
+    std::exit(EXIT_FAILURE);
+  }
+
+  // read number of cycles between resampling passes that merge/split particles to keep
+  // per-cell populations within targets (0 = never resample)
+  resample_ncycle = pin->GetOrAddInteger("particles","resample_ncycle",0);
+  resample_min_ppc = pin->GetOrAddInteger("particles","resample_min_ppc",0);
+  resample_max_ppc = pin->GetOrAddInteger("particles","resample_max_ppc",0);
+  if (resample_ncycle < 0) {
+    std::cout << "### FATAL ERROR in " << __FILE__ << " at line " << __LINE__ << std::endl
+              << "Parameter resample_ncycle in <particles> block must be >= 0"
+              << std::endl;
+    std::exit(EXIT_FAILURE);
+  }
+  if ((resample_ncycle > 0) &&
+      ((resample_min_ppc < 0) || (resample_max_ppc < 1) ||
+       (resample_max_ppc < resample_min_ppc))) {
+    std::cout << "### FATAL ERROR in " << __FILE__ << " at line " << __LINE__ << std::endl
+              << "Resampling targets must satisfy 0 <= resample_min_ppc <= "
+              << "resample_max_ppc with resample_max_ppc >= 1" << std::endl;
+    std::exit(EXIT_FAILURE);
+  }
+
   // compute number of particles as real number, since ppc can be < 1
   auto &indcs = pmy_pack->pmesh->mb_indcs;
   int ncells = indcs.nx1*indcs.nx2*indcs.nx3;
@@ -84,9 +113,27 @@ Particles::Particles(MeshBlockPack *ppack, ParameterInput *pin) :
     default:
       break;
   }
+
+  // resampling merges/splits particles, so each must carry a statistical weight.  It is
+  // appended as an extra real property and initialized to one below
+  iwght = -1;
+  if (resample_ncycle > 0) {
+    iwght = nrdata;
+    nrdata += 1;
+  }
+
   Kokkos::realloc(prtcl_rdata, nrdata, nprtcl_thispack);
   Kokkos::realloc(prtcl_idata, nidata, nprtcl_thispack);
 
+  if (iwght >= 0) {
+    auto &pr = prtcl_rdata;
+    int iw = iwght;
+    par_for("pwght_init",DevExeSpace(),0,(nprtcl_thispack-1),
+    KOKKOS_LAMBDA(const int p) {
+      pr(iw,p) = 1.0;
+    });
+  }
+
   // allocate boundary object
   pbval_part = new ParticlesBoundaryValues(this, pin);
 }
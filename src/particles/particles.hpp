@@ -61,6 +61,11 @@ class Particles {
   DvceArray2D<Real> prtcl_rdata;   // real number properties each particle (x,v,etc.)
   DvceArray2D<int>  prtcl_idata;   // integer properties each particle (gid, tag, etc.)
   Real dtnew;
+  int sort_ncycle;                 // cycles between sort-by-cell passes (0 = never)
+  int resample_ncycle;             // cycles between resampling passes (0 = never)
+  int resample_min_ppc;            // occupied cells below this target are split
+  int resample_max_ppc;            // cells above this target are merged down to it
+  int iwght;                       // index of statistical weight in prtcl_rdata (or -1)
 
   ParticlesPusher pusher;
 
@@ -73,6 +78,8 @@ class Particles {
   // functions...
   void CreateParticleTags(ParameterInput *pin);
   void AssembleTasks(std::map<std::string, std::shared_ptr<TaskList>> tl);
+  void SortByCell();
+  void ResampleByCell();
   TaskStatus Push(Driver *pdriver, int stage);
   TaskStatus NewGID(Driver *pdriver, int stage);
   TaskStatus SendCnt(Driver *pdriver, int stage);
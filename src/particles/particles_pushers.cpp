@@ -17,6 +17,18 @@ namespace particles {
 //  \brief
 
 TaskStatus Particles::Push(Driver *pdriver, int stage) {
+  // periodically reorder particle arrays by (MeshBlock, cell) so that interpolation
+  // gathers below access field data coherently (see SortByCell in particles_sort.cpp)
+  if ((sort_ncycle > 0) && ((pmy_pack->pmesh->ncycle % sort_ncycle) == 0)) {
+    SortByCell();
+  }
+
+  // periodically merge/split particles to keep per-cell populations within targets
+  // (see ResampleByCell in particles_resample.cpp)
+  if ((resample_ncycle > 0) && ((pmy_pack->pmesh->ncycle % resample_ncycle) == 0)) {
+    ResampleByCell();
+  }
+
   auto &indcs = pmy_pack->pmesh->mb_indcs;
   int is = indcs.is;
   int js = indcs.js;
@@ -0,0 +1,175 @@
+//========================================================================================
+// AthenaXXX astrophysical plasma code
+// Copyright(C) 2020 James M. Stone <jmstone@ias.edu> and the Athena code team
+// Licensed under the 3-clause BSD License (the "LICENSE")
+//========================================================================================
+//! \file particles_resample.cpp
+//! \brief device-side Monte Carlo resampling that enforces per-cell population targets
+
+#include "athena.hpp"
+#include "mesh/mesh.hpp"
+#include "utils/random.hpp"
+#include "particles.hpp"
+
+namespace particles {
+//----------------------------------------------------------------------------------------
+//! \fn  void Particles::ResampleByCell
+//! \brief Merges and splits particles so that every occupied cell carries between
+//! resample_min_ppc and resample_max_ppc particles.  As the flow evolves, particles
+//! collect in converging regions, where some cells end up with far more samples than the
+//! science requires while diverging regions are starved; this pass keeps the particle
+//! count (and thus push/communication cost) proportional to the sampling actually
+//! needed.  Cells above the maximum target are thinned to it, with the statistical
+//! weight of every removed particle added to a surviving particle in the same cell so
+//! the total weight per cell is conserved exactly.  Occupied cells below the minimum
+//! target split each survivor at most once per pass into two half-weight copies, one of
+//! which is jittered within the cell by a deterministic per-particle RNG stream, so
+//! sparse cells approach the target geometrically over successive passes.  Binning,
+//! counting, and scatter reuse the (MeshBlock, cell) machinery of SortByCell.
+
+void Particles::ResampleByCell() {
+  auto &indcs = pmy_pack->pmesh->mb_indcs;
+  int nx1 = indcs.nx1;
+  int nx2 = indcs.nx2;
+  int nx3 = indcs.nx3;
+  bool &multi_d = pmy_pack->pmesh->multi_d;
+  bool &three_d = pmy_pack->pmesh->three_d;
+  auto &mbsize = pmy_pack->pmb->mb_size;
+  auto gids = pmy_pack->gids;
+  int ncells = nx1*nx2*nx3;
+  int nbins = (pmy_pack->nmb_thispack)*ncells;
+  int npart = nprtcl_thispack;
+  if (npart == 0) {return;}
+
+  auto &pi = prtcl_idata;
+  auto &pr = prtcl_rdata;
+
+  // compute (MeshBlock, cell) bin key of every particle.  Positions are clamped onto
+  // the interior of their MeshBlock for safety at the boundaries
+  DvceArray1D<int> keys("presamp_keys", npart);
+  par_for("presamp_keys",DevExeSpace(),0,(npart-1),
+  KOKKOS_LAMBDA(const int p) {
+    int m = pi(PGID,p) - gids;
+    int ip = static_cast<int>((pr(IPX,p) - mbsize.d_view(m).x1min)/mbsize.d_view(m).dx1);
+    ip = (ip < 0)? 0 : ((ip > nx1-1)? nx1-1 : ip);
+    int jp = 0;
+    if (multi_d) {
+      jp = static_cast<int>((pr(IPY,p) - mbsize.d_view(m).x2min)/mbsize.d_view(m).dx2);
+      jp = (jp < 0)? 0 : ((jp > nx2-1)? nx2-1 : jp);
+    }
+    int kp = 0;
+    if (three_d) {
+      kp = static_cast<int>((pr(IPZ,p) - mbsize.d_view(m).x3min)/mbsize.d_view(m).dx3);
+      kp = (kp < 0)? 0 : ((kp > nx3-1)? nx3-1 : kp);
+    }
+    keys(p) = ((m*nx3 + kp)*nx2 + jp)*nx1 + ip;
+  });
+
+  // count particles per bin
+  DvceArray1D<int> count("presamp_count", nbins);
+  Kokkos::deep_copy(count, 0);
+  par_for("presamp_count",DevExeSpace(),0,(npart-1),
+  KOKKOS_LAMBDA(const int p) {
+    Kokkos::atomic_fetch_add(&count(keys(p)), 1);
+  });
+
+  // per-bin survivor and child counts from the population targets
+  int min_ppc = resample_min_ppc;
+  int max_ppc = resample_max_ppc;
+  DvceArray1D<int> nkeep("presamp_nkeep", nbins);
+  DvceArray1D<int> nchld("presamp_nchld", nbins);
+  par_for("presamp_targets",DevExeSpace(),0,(nbins-1),
+  KOKKOS_LAMBDA(const int b) {
+    int c = count(b);
+    nkeep(b) = (c > max_ppc)? max_ppc : c;
+    int nc = 0;
+    if ((c > 0) && (c < min_ppc)) {
+      nc = ((min_ppc - c) < c)? (min_ppc - c) : c;  // each survivor splits at most once
+    }
+    nchld(b) = nc;
+  });
+
+  // exclusive-scan bin widths (survivors + children) into offsets of the new arrays
+  DvceArray1D<int> offset("presamp_offset", nbins);
+  int npart_new = 0;
+  Kokkos::parallel_scan("presamp_scan", Kokkos::RangePolicy<DevExeSpace>(0, nbins),
+  KOKKOS_LAMBDA(const int b, int &sum, const bool final_pass) {
+    int w = nkeep(b) + nchld(b);
+    if (final_pass) {offset(b) = sum;}
+    sum += w;
+  }, npart_new);
+
+  // scatter the first nkeep arrivals in each bin into the new arrays; every particle
+  // records its arrival rank so the merge pass below can find the excess ones
+  int nr = nrdata;
+  int ni = nidata;
+  int iw = iwght;
+  DvceArray2D<Real> rnew("prtcl_rdata", nr, npart_new);
+  DvceArray2D<int> inew("prtcl_idata", ni, npart_new);
+  DvceArray1D<int> rankp("presamp_rank", npart);
+  DvceArray1D<int> arrive("presamp_arrive", nbins);
+  Kokkos::deep_copy(arrive, 0);
+  par_for("presamp_scatter",DevExeSpace(),0,(npart-1),
+  KOKKOS_LAMBDA(const int p) {
+    int b = keys(p);
+    int rb = Kokkos::atomic_fetch_add(&arrive(b), 1);
+    rankp(p) = rb;
+    if (rb < nkeep(b)) {
+      int idx = offset(b) + rb;
+      for (int n=0; n<nr; ++n) {rnew(n,idx) = pr(n,p);}
+      for (int n=0; n<ni; ++n) {inew(n,idx) = pi(n,p);}
+    }
+  });
+
+  // merge: excess arrivals deposit their statistical weight onto a survivor in the same
+  // cell (round-robin), conserving the total weight per cell exactly.  Runs after the
+  // scatter kernel so the atomic adds cannot race with the survivor copies
+  par_for("presamp_merge",DevExeSpace(),0,(npart-1),
+  KOKKOS_LAMBDA(const int p) {
+    int b = keys(p);
+    int rb = rankp(p);
+    int nk = nkeep(b);
+    if (rb >= nk) {
+      Kokkos::atomic_add(&rnew(iw,offset(b) + (rb % nk)), pr(iw,p));
+    }
+  });
+
+  // split: child ci of bin b duplicates survivor ci with half its weight.  The child is
+  // jittered by up to a quarter cell per dimension using a deterministic RNG stream
+  // seeded from the parent tag and the cycle number, so reruns are bit-reproducible.
+  // Children inherit the parent tag: the two halves of a split sample continue a single
+  // tracked trajectory.  Bins touch disjoint index ranges, so no atomics are needed
+  int ncycle = pmy_pack->pmesh->ncycle;
+  par_for("presamp_split",DevExeSpace(),0,(nbins-1),
+  KOKKOS_LAMBDA(const int b) {
+    int nc = nchld(b);
+    for (int ci=0; ci<nc; ++ci) {
+      int pidx = offset(b) + ci;
+      int cidx = offset(b) + nkeep(b) + ci;
+      for (int n=0; n<nr; ++n) {rnew(n,cidx) = rnew(n,pidx);}
+      for (int n=0; n<ni; ++n) {inew(n,cidx) = inew(n,pidx);}
+      Real whalf = 0.5*rnew(iw,pidx);
+      rnew(iw,pidx) = whalf;
+      rnew(iw,cidx) = whalf;
+      RNG_State rstate;
+      rstate.idum = -(static_cast<int64_t>(inew(PTAG,pidx))*1000003 + ncycle + 1);
+      rstate.iset = 0;
+      int m = inew(PGID,cidx) - gids;
+      rnew(IPX,cidx) += (RanSt(&rstate) - 0.5)*0.5*mbsize.d_view(m).dx1;
+      if (multi_d) {
+        rnew(IPY,cidx) += (RanSt(&rstate) - 0.5)*0.5*mbsize.d_view(m).dx2;
+      }
+      if (three_d) {
+        rnew(IPZ,cidx) += (RanSt(&rstate) - 0.5)*0.5*mbsize.d_view(m).dx3;
+      }
+    }
+  });
+
+  // swap the resampled arrays into place.  Per-rank particle totals are re-gathered by
+  // the particle communication tasks later this cycle
+  prtcl_rdata = rnew;
+  prtcl_idata = inew;
+  nprtcl_thispack = npart_new;
+  return;
+}
+} // namespace particles
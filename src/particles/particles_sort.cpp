@@ -0,0 +1,94 @@
+//========================================================================================
+// AthenaXXX astrophysical plasma code
+// Copyright(C) 2020 James M. Stone <jmstone@ias.edu> and the Athena code team
+// Licensed under the 3-clause BSD License (the "LICENSE")
+//========================================================================================
+//! \file particles_sort.cpp
+//! \brief device-side counting sort that reorders particle arrays by (MeshBlock, cell)
+
+#include "athena.hpp"
+#include "mesh/mesh.hpp"
+#include "particles.hpp"
+
+namespace particles {
+//----------------------------------------------------------------------------------------
+//! \fn  void Particles::SortByCell
+//! \brief Reorders the particle arrays so that particles in the same cell (and same
+//! MeshBlock) are adjacent in memory.  After many crossing times the arrays become
+//! fully scrambled by particles moving between MeshBlocks, so field interpolation
+//! gathers in the pusher are random-access; sorting restores memory coherence.  Uses a
+//! counting sort over (MeshBlock, cell) bins run entirely on the device: bin counts,
+//! an exclusive scan into bin offsets, then a stable scatter into fresh arrays.  Whole
+//! columns of prtcl_rdata/prtcl_idata move together, so gids and tags stay consistent.
+
+void Particles::SortByCell() {
+  auto &indcs = pmy_pack->pmesh->mb_indcs;
+  int nx1 = indcs.nx1;
+  int nx2 = indcs.nx2;
+  int nx3 = indcs.nx3;
+  bool &multi_d = pmy_pack->pmesh->multi_d;
+  bool &three_d = pmy_pack->pmesh->three_d;
+  auto &mbsize = pmy_pack->pmb->mb_size;
+  auto gids = pmy_pack->gids;
+  int ncells = nx1*nx2*nx3;
+  int nbins = (pmy_pack->nmb_thispack)*ncells;
+  int npart = nprtcl_thispack;
+  if (npart == 0) {return;}
+
+  auto &pi = prtcl_idata;
+  auto &pr = prtcl_rdata;
+
+  // compute (MeshBlock, cell) bin key of every particle.  Positions are clamped onto
+  // the interior of their MeshBlock for safety at the boundaries
+  DvceArray1D<int> keys("psort_keys", npart);
+  par_for("psort_keys",DevExeSpace(),0,(npart-1),
+  KOKKOS_LAMBDA(const int p) {
+    int m = pi(PGID,p) - gids;
+    int ip = static_cast<int>((pr(IPX,p) - mbsize.d_view(m).x1min)/mbsize.d_view(m).dx1);
+    ip = (ip < 0)? 0 : ((ip > nx1-1)? nx1-1 : ip);
+    int jp = 0;
+    if (multi_d) {
+      jp = static_cast<int>((pr(IPY,p) - mbsize.d_view(m).x2min)/mbsize.d_view(m).dx2);
+      jp = (jp < 0)? 0 : ((jp > nx2-1)? nx2-1 : jp);
+    }
+    int kp = 0;
+    if (three_d) {
+      kp = static_cast<int>((pr(IPZ,p) - mbsize.d_view(m).x3min)/mbsize.d_view(m).dx3);
+      kp = (kp < 0)? 0 : ((kp > nx3-1)? nx3-1 : kp);
+    }
+    keys(p) = ((m*nx3 + kp)*nx2 + jp)*nx1 + ip;
+  });
+
+  // count particles per bin, then exclusive-scan the counts into bin offsets
+  DvceArray1D<int> offset("psort_offset", nbins);
+  Kokkos::deep_copy(offset, 0);
+  par_for("psort_count",DevExeSpace(),0,(npart-1),
+  KOKKOS_LAMBDA(const int p) {
+    Kokkos::atomic_fetch_add(&offset(keys(p)), 1);
+  });
+  Kokkos::parallel_scan("psort_scan", Kokkos::RangePolicy<DevExeSpace>(0, nbins),
+  KOKKOS_LAMBDA(const int b, int &sum, const bool final_pass) {
+    int cnt = offset(b);
+    if (final_pass) {offset(b) = sum;}
+    sum += cnt;
+  });
+
+  // scatter particles into new arrays in bin order; each column of real and integer
+  // data (including PGID and PTAG) moves as one unit
+  int nr = nrdata;
+  int ni = nidata;
+  DvceArray2D<Real> rsort("prtcl_rdata", nr, npart);
+  DvceArray2D<int> isort("prtcl_idata", ni, npart);
+  par_for("psort_scatter",DevExeSpace(),0,(npart-1),
+  KOKKOS_LAMBDA(const int p) {
+    int idx = Kokkos::atomic_fetch_add(&offset(keys(p)), 1);
+    for (int n=0; n<nr; ++n) {rsort(n,idx) = pr(n,p);}
+    for (int n=0; n<ni; ++n) {isort(n,idx) = pi(n,p);}
+  });
+
+  // swap the sorted arrays into place
+  prtcl_rdata = rsort;
+  prtcl_idata = isort;
+  return;
+}
+} // namespace particles
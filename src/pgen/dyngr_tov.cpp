@@ -31,6 +31,7 @@
 #include "mhd/mhd.hpp"
 #include "dyn_grmhd/dyn_grmhd.hpp"
 #include "utils/tr_table.hpp"
+#include "profile_ingest.hpp"
 
 #include <Kokkos_Random.hpp>
 
@@ -188,20 +189,23 @@ class TabulatedEOS {
   explicit TabulatedEOS(ParameterInput* pin) {
     fname = pin->GetString("problem", "table");
 
+    // only rank 0 touches the file; the parsed arrays are broadcast below so the
+    // filesystem sees a single reader instead of one per rank
     TableReader::Table table;
-
-    auto read_result = table.ReadTable(fname);
-    if (read_result.error != TableReader::ReadResult::SUCCESS) {
-      std::cout << "TOV EOS table could not be read.\n";
-      assert(false);
+    if (global_variable::my_rank == 0) {
+      auto read_result = table.ReadTable(fname);
+      if (read_result.error != TableReader::ReadResult::SUCCESS) {
+        std::cout << "TOV EOS table could not be read.\n";
+        assert(false);
+      }
+      // TODO(JMF) Check that table has right fields and dimensions
+      // Get table dimensions
+      auto& point_info = table.GetPointInfo();
+      m_nn = point_info[0].second;
     }
-    // TODO(JMF) Check that table has right fields and dimensions
-    auto& table_scalars = table.GetScalars();
-    Real mb = table_scalars.at("mn");
-
-    // Get table dimensions
-    auto& point_info = table.GetPointInfo();
-    m_nn = point_info[0].second;
+    int nn = static_cast<int>(m_nn);
+    pgen::BroadcastInts(&nn, 1);
+    m_nn = nn;
 
     // Allocate storage
     Kokkos::realloc(m_log_rho, m_nn);
@@ -209,39 +213,53 @@ class TabulatedEOS {
     Kokkos::realloc(m_log_e, m_nn);
     Kokkos::realloc(m_ye, m_nn);
 
-    // Read rho
-    Real * table_nb = table["nb"];
-    for (size_t in = 0; in < m_nn; in++) {
-      m_log_rho.h_view(in) = log(table_nb[in]*mb*ener_to_geo);
+    if (global_variable::my_rank == 0) {
+      auto& table_scalars = table.GetScalars();
+      Real mb = table_scalars.at("mn");
+
+      // Read rho
+      Real * table_nb = table["nb"];
+      for (size_t in = 0; in < m_nn; in++) {
+        m_log_rho.h_view(in) = log(table_nb[in]*mb*ener_to_geo);
+      }
+
+      // Read pressure
+      Real * table_Q1 = table["Q1"];
+      for (size_t in = 0; in < m_nn; in++) {
+        m_log_p.h_view(in) = log(table_Q1[in]*table_nb[in]*ener_to_geo);
+      }
+
+      // Read energy
+      Real * table_Q7 = table["Q7"];
+      for (size_t in = 0; in < m_nn; in++) {
+        m_log_e.h_view(in) = log(mb*(table_Q7[in] + 1.)*table_nb[in]*ener_to_geo);
+      }
+
+      // Read electron fraction
+      Real * table_ye = table["Y[e]"];
+      for (size_t in = 0; in < m_nn; in++) {
+        m_ye.h_view(in) = table_ye[in];
+      }
     }
+
+    // ship the parsed table to the other ranks, then derive bounds everywhere
+    pgen::BroadcastProfile(m_log_rho);
+    pgen::BroadcastProfile(m_log_p);
+    pgen::BroadcastProfile(m_log_e);
+    pgen::BroadcastProfile(m_ye);
     dlrho = m_log_rho.h_view(1)-m_log_rho.h_view(0);
     lrho_min = m_log_rho.h_view(0);
     lrho_max = m_log_rho.h_view(m_nn-1);
-
-    // Read pressure
-    Real * table_Q1 = table["Q1"];
-    for (size_t in = 0; in < m_nn; in++) {
-      m_log_p.h_view(in) = log(table_Q1[in]*table_nb[in]*ener_to_geo);
-    }
     lP_min = m_log_p.h_view(0);
     lP_max = m_log_p.h_view(m_nn-1);
 
-    // Read energy
-    Real * table_Q7 = table["Q7"];
-    for (size_t in = 0; in < m_nn; in++) {
-      m_log_e.h_view(in) = log(mb*(table_Q7[in] + 1.)*table_nb[in]*ener_to_geo);
-    }
-
-    // Read electron fraction
-    Real * table_ye = table["Y[e]"];
-    for (size_t in = 0; in < m_nn; in++) {
-      m_ye.h_view(in) = table_ye[in];
+    if (global_variable::my_rank == 0) {
+      std::cout << "Loaded table " << fname << std::endl
+                << "  rho = [" << exp(lrho_min) << ", " << exp(lrho_max) << "]"
+                << std::endl
+                << "  P = [" << exp(lP_min) << ", " << exp(lP_max) << "]" << std::endl;
     }
 
-    std::cout << "Loaded table " << fname << std::endl
-              << "  rho = [" << exp(lrho_min) << ", " << exp(lrho_max) << "]" << std::endl
-              << "  P = [" << exp(lP_min) << ", " << exp(lP_max) << "]" << std::endl;
-
     // Sync the views to the GPU
     m_log_rho.template modify<HostMemSpace>();
     m_log_p.template modify<HostMemSpace>();
@@ -815,6 +833,10 @@ static void ConstructTOV(tov_pgen& tov, TOVEOS& eos) {
   int npoints = tov.npoints;
   Real dr = tov.dr;
 
+  // Integrate on rank 0 only; the profile arrays and derived scalars are broadcast
+  // below, so the (potentially long, table-EOS) integration is not replicated on
+  // every rank and all ranks hold bitwise identical data
+  if (global_variable::my_rank == 0) {
   // Set initial data
   // FIXME: Assumes ideal gas for now!
   R(0) = 0.0;
@@ -903,15 +925,27 @@ static void ConstructTOV(tov_pgen& tov, TOVEOS& eos) {
   }
 
   // Print out details of the calculation
-  if (global_variable::my_rank == 0) {
-    std::cout << "\nTOV INITIAL DATA\n"
-              << "----------------\n";
-    std::cout << "Total points in buffer: " << tov.npoints << "\n";
-    std::cout << "Radial step: " << tov.dr << "\n";
-    std::cout << "Radius (Schwarzschild): " << tov.R_edge << "\n";
-    std::cout << "Radius (Isotropic): " << tov.R_edge_iso << "\n";
-    std::cout << "Mass: " << tov.M_edge << "\n\n";
-  }
+  std::cout << "\nTOV INITIAL DATA\n"
+            << "----------------\n";
+  std::cout << "Total points in buffer: " << tov.npoints << "\n";
+  std::cout << "Radial step: " << tov.dr << "\n";
+  std::cout << "Radius (Schwarzschild): " << tov.R_edge << "\n";
+  std::cout << "Radius (Isotropic): " << tov.R_edge_iso << "\n";
+  std::cout << "Mass: " << tov.M_edge << "\n\n";
+  }  // end rank-0 integration
+
+  // ship the profile and the derived scalars to the other ranks
+  pgen::BroadcastInts(&tov.n_r, 1);
+  Real edges[3] = {tov.R_edge, tov.R_edge_iso, tov.M_edge};
+  pgen::BroadcastReals(edges, 3);
+  tov.R_edge = edges[0];
+  tov.R_edge_iso = edges[1];
+  tov.M_edge = edges[2];
+  pgen::BroadcastProfile(tov.R);
+  pgen::BroadcastProfile(tov.R_iso);
+  pgen::BroadcastProfile(tov.M);
+  pgen::BroadcastProfile(tov.P);
+  pgen::BroadcastProfile(tov.alp);
 
   // Sync the views to the GPU
   tov.R.template modify<HostMemSpace>();
@@ -31,6 +31,55 @@
 
 void EllipticaHistory(HistoryData *pdata, Mesh *pm);
 
+// Fixed ordering of the interpolated fields inside packed buffers; matches the ifields
+// string passed to Elliptica below.
+enum {
+  F_ALPHA=0, F_BETAX, F_BETAY, F_BETAZ,
+  F_GXX, F_GXY, F_GXZ, F_GYY, F_GYZ, F_GZZ,
+  F_KXX, F_KXY, F_KXZ, F_KYY, F_KYZ, F_KZZ,
+  F_RHO, F_P, F_VX, F_VY, F_VZ,
+  NFIELD
+};
+
+//----------------------------------------------------------------------------------------
+//! \fn void EvaluateEllipticaFields()
+//! \brief Evaluate the Elliptica spectral data at npts points and pack the interpolated
+//! fields into fdata, with field f of point n stored at fdata[f*npts + n].
+
+static void EvaluateEllipticaFields(const std::string &fname, int npts,
+                                    Real *x, Real *y, Real *z, Real *fdata) {
+  // Initialize the data reader
+  Elliptica_ID_Reader_T *idr = elliptica_id_reader_init(fname.c_str(),"generic");
+
+  // Fields to interpolate
+  idr->ifields = "alpha,betax,betay,betaz,"
+                 "adm_gxx,adm_gxy,adm_gxz,adm_gyy,adm_gyz,adm_gzz,"
+                 "adm_Kxx,adm_Kxy,adm_Kxz,adm_Kyy,adm_Kyz,adm_Kzz,"
+                 "grhd_rho,grhd_p,grhd_vx,grhd_vy,grhd_vz";
+  idr->set_param("ADM_B1I_form","zero",idr);
+
+  // Interpolate the data; the whole point set is evaluated in a single call
+  idr->npoints  = npts;
+  idr->x_coords = x;
+  idr->y_coords = y;
+  idr->z_coords = z;
+  elliptica_id_reader_interpolate(idr);
+
+  const char *fnames[NFIELD] = {
+    "alpha","betax","betay","betaz",
+    "adm_gxx","adm_gxy","adm_gxz","adm_gyy","adm_gyz","adm_gzz",
+    "adm_Kxx","adm_Kxy","adm_Kxz","adm_Kyy","adm_Kyz","adm_Kzz",
+    "grhd_rho","grhd_p","grhd_vx","grhd_vy","grhd_vz"};
+  for (int f = 0; f < NFIELD; f++) {
+    const int fi = idr->indx(fnames[f]);
+    for (int n = 0; n < npts; n++) {
+      fdata[static_cast<size_t>(f)*npts + n] = idr->field[fi][n];
+    }
+  }
+
+  elliptica_id_reader_free(idr);
+}
+
 //----------------------------------------------------------------------------------------
 //! \fn ProblemGenerator::UserProblem_()
 //! \brief Problem Generator for BNS with Elliptica
@@ -56,15 +105,6 @@ void ProblemGenerator::UserProblem(ParameterInput *pin, const bool restart) {
 
   std::string fname = pin->GetString("problem", "initial_data_file");
 
-  // Initialize the data reader
-  Elliptica_ID_Reader_T *idr = elliptica_id_reader_init(fname.c_str(),"generic");
-
-  // Fields to interpolate
-  idr->ifields = "alpha,betax,betay,betaz,"
-                 "adm_gxx,adm_gxy,adm_gxz,adm_gyy,adm_gyz,adm_gzz,"
-                 "adm_Kxx,adm_Kxy,adm_Kxz,adm_Kyy,adm_Kyz,adm_Kzz,"
-                 "grhd_rho,grhd_p,grhd_vx,grhd_vy,grhd_vz";
-
   int ncells1 = indcs.nx1 + 2*(indcs.ng);
   int ncells2 = indcs.nx2 + 2*(indcs.ng);
   int ncells3 = indcs.nx3 + 2*(indcs.ng);
@@ -113,15 +153,94 @@ void ProblemGenerator::UserProblem(ParameterInput *pin, const bool restart) {
     }
   }
 
-  idr->set_param("ADM_B1I_form","zero",idr);
-
-  // Interpolate the data
-  idr->npoints  = width;
-  idr->x_coords = x_coords;
-  idr->y_coords = y_coords;
-  idr->z_coords = z_coords;
   std::cout << "Coordinates assigned." << std::endl;
-  elliptica_id_reader_interpolate(idr);
+
+  // Evaluate the spectral data.  By default every rank runs the (serial, CPU-only)
+  // Elliptica evaluation over its own points.  When <problem>/id_reader_ranks = N is
+  // set with 0 < N < nranks, only N reader ranks open the initial data file; the
+  // remaining ranks ship their point sets to a reader over MPI and receive the
+  // interpolated fields back.  This bounds the number of ranks simultaneously reading
+  // (and holding copies of) the spectral data, and feeds each reader one large batched
+  // point set.
+  Real *fdata = new Real[static_cast<size_t>(NFIELD)*width];
+#if MPI_PARALLEL_ENABLED
+  int nreaders = pin->GetOrAddInteger("problem","id_reader_ranks",0);
+  if (nreaders > 0 && nreaders < global_variable::nranks) {
+    // Split ranks into one group per reader; the reader is the smallest world rank in
+    // each group
+    MPI_Comm id_comm;
+    int color = global_variable::my_rank % nreaders;
+    MPI_Comm_split(MPI_COMM_WORLD, color, global_variable::my_rank, &id_comm);
+    int id_rank, id_size;
+    MPI_Comm_rank(id_comm, &id_rank);
+    MPI_Comm_size(id_comm, &id_size);
+
+    // Gather point counts, then coordinates, from every rank in the group
+    int *widths = nullptr, *displs = nullptr, *fcounts = nullptr, *fdispls = nullptr;
+    Real *all_x = nullptr, *all_y = nullptr, *all_z = nullptr, *all_f = nullptr;
+    int ntotal = 0;
+    if (id_rank == 0) {
+      widths  = new int[id_size];
+      displs  = new int[id_size];
+      fcounts = new int[id_size];
+      fdispls = new int[id_size];
+    }
+    MPI_Gather(&width, 1, MPI_INT, widths, 1, MPI_INT, 0, id_comm);
+    if (id_rank == 0) {
+      for (int p = 0; p < id_size; p++) {
+        displs[p]  = ntotal;
+        fcounts[p] = NFIELD*widths[p];
+        fdispls[p] = NFIELD*displs[p];
+        ntotal += widths[p];
+      }
+      all_x = new Real[ntotal];
+      all_y = new Real[ntotal];
+      all_z = new Real[ntotal];
+    }
+    MPI_Gatherv(x_coords, width, MPI_ATHENA_REAL,
+                all_x, widths, displs, MPI_ATHENA_REAL, 0, id_comm);
+    MPI_Gatherv(y_coords, width, MPI_ATHENA_REAL,
+                all_y, widths, displs, MPI_ATHENA_REAL, 0, id_comm);
+    MPI_Gatherv(z_coords, width, MPI_ATHENA_REAL,
+                all_z, widths, displs, MPI_ATHENA_REAL, 0, id_comm);
+
+    if (id_rank == 0) {
+      // Evaluate the whole batch in a single Elliptica call, then repack each rank's
+      // slab so it can be scattered as one contiguous chunk
+      Real *fall = new Real[static_cast<size_t>(NFIELD)*ntotal];
+      EvaluateEllipticaFields(fname, ntotal, all_x, all_y, all_z, fall);
+      all_f = new Real[static_cast<size_t>(NFIELD)*ntotal];
+      for (int p = 0; p < id_size; p++) {
+        for (int f = 0; f < NFIELD; f++) {
+          for (int n = 0; n < widths[p]; n++) {
+            all_f[fdispls[p] + static_cast<size_t>(f)*widths[p] + n] =
+                fall[static_cast<size_t>(f)*ntotal + displs[p] + n];
+          }
+        }
+      }
+      delete[] fall;
+      delete[] all_x;
+      delete[] all_y;
+      delete[] all_z;
+    }
+    MPI_Scatterv(all_f, fcounts, fdispls, MPI_ATHENA_REAL,
+                 fdata, NFIELD*width, MPI_ATHENA_REAL, 0, id_comm);
+    if (id_rank == 0) {
+      delete[] all_f;
+      delete[] widths;
+      delete[] displs;
+      delete[] fcounts;
+      delete[] fdispls;
+    }
+    MPI_Comm_free(&id_comm);
+  } else {
+    EvaluateEllipticaFields(fname, width, x_coords, y_coords, z_coords, fdata);
+  }
+#else
+  EvaluateEllipticaFields(fname, width, x_coords, y_coords, z_coords, fdata);
+#endif
+
+  std::cout << "Fields interpolated." << std::endl;
 
   // Free the coordinates, since we'll no longer need them.
   delete[] x_coords;
@@ -156,33 +275,33 @@ void ProblemGenerator::UserProblem(ParameterInput *pin, const bool restart) {
 
   std::cout << "Host mirrors created." << std::endl;
 
-  // Save Elliptica field indices for shorthand and a small optimization.
-  const int i_alpha = idr->indx("alpha");
-  const int i_betax = idr->indx("betax");
-  const int i_betay = idr->indx("betay");
-  const int i_betaz = idr->indx("betaz");
-
-  const int i_gxx   = idr->indx("adm_gxx");
-  const int i_gxy   = idr->indx("adm_gxy");
-  const int i_gxz   = idr->indx("adm_gxz");
-  const int i_gyy   = idr->indx("adm_gyy");
-  const int i_gyz   = idr->indx("adm_gyz");
-  const int i_gzz   = idr->indx("adm_gzz");
-
-  const int i_Kxx   = idr->indx("adm_Kxx");
-  const int i_Kxy   = idr->indx("adm_Kxy");
-  const int i_Kxz   = idr->indx("adm_Kxz");
-  const int i_Kyy   = idr->indx("adm_Kyy");
-  const int i_Kyz   = idr->indx("adm_Kyz");
-  const int i_Kzz   = idr->indx("adm_Kzz");
-
-  const int i_rho   = idr->indx("grhd_rho");
-  const int i_p     = idr->indx("grhd_p");
-  const int i_vx    = idr->indx("grhd_vx");
-  const int i_vy    = idr->indx("grhd_vy");
-  const int i_vz    = idr->indx("grhd_vz");
-
-  std::cout << "Label indices saved." << std::endl;
+  // Save pointers into the packed field buffer for shorthand.
+  const Real *f_alpha = &fdata[static_cast<size_t>(F_ALPHA)*width];
+  const Real *f_betax = &fdata[static_cast<size_t>(F_BETAX)*width];
+  const Real *f_betay = &fdata[static_cast<size_t>(F_BETAY)*width];
+  const Real *f_betaz = &fdata[static_cast<size_t>(F_BETAZ)*width];
+
+  const Real *f_gxx   = &fdata[static_cast<size_t>(F_GXX)*width];
+  const Real *f_gxy   = &fdata[static_cast<size_t>(F_GXY)*width];
+  const Real *f_gxz   = &fdata[static_cast<size_t>(F_GXZ)*width];
+  const Real *f_gyy   = &fdata[static_cast<size_t>(F_GYY)*width];
+  const Real *f_gyz   = &fdata[static_cast<size_t>(F_GYZ)*width];
+  const Real *f_gzz   = &fdata[static_cast<size_t>(F_GZZ)*width];
+
+  const Real *f_Kxx   = &fdata[static_cast<size_t>(F_KXX)*width];
+  const Real *f_Kxy   = &fdata[static_cast<size_t>(F_KXY)*width];
+  const Real *f_Kxz   = &fdata[static_cast<size_t>(F_KXZ)*width];
+  const Real *f_Kyy   = &fdata[static_cast<size_t>(F_KYY)*width];
+  const Real *f_Kyz   = &fdata[static_cast<size_t>(F_KYZ)*width];
+  const Real *f_Kzz   = &fdata[static_cast<size_t>(F_KZZ)*width];
+
+  const Real *f_rho   = &fdata[static_cast<size_t>(F_RHO)*width];
+  const Real *f_p     = &fdata[static_cast<size_t>(F_P)*width];
+  const Real *f_vx    = &fdata[static_cast<size_t>(F_VX)*width];
+  const Real *f_vy    = &fdata[static_cast<size_t>(F_VY)*width];
+  const Real *f_vz    = &fdata[static_cast<size_t>(F_VZ)*width];
+
+  std::cout << "Field pointers saved." << std::endl;
 
   // TODO(JMF): Replace with a Kokkos loop on Kokkos::DefaultHostExecutionSpace() to
   // improve performance.
@@ -192,32 +311,32 @@ void ProblemGenerator::UserProblem(ParameterInput *pin, const bool restart) {
       for (int j = 0; j < ncells2; j++) {
         for (int i = 0; i < ncells1; i++) {
           // Extract metric quantities
-          host_adm.alpha(m, k, j, i) = idr->field[i_alpha][idx];
-          host_adm.beta_u(m, 0, k, j, i) = idr->field[i_betax][idx];
-          host_adm.beta_u(m, 1, k, j, i) = idr->field[i_betay][idx];
-          host_adm.beta_u(m, 2, k, j, i) = idr->field[i_betaz][idx];
+          host_adm.alpha(m, k, j, i) = f_alpha[idx];
+          host_adm.beta_u(m, 0, k, j, i) = f_betax[idx];
+          host_adm.beta_u(m, 1, k, j, i) = f_betay[idx];
+          host_adm.beta_u(m, 2, k, j, i) = f_betaz[idx];
 
           Real g3d[NSPMETRIC];
-          host_adm.g_dd(m, 0, 0, k, j, i) = g3d[S11] = idr->field[i_gxx][idx];
-          host_adm.g_dd(m, 0, 1, k, j, i) = g3d[S12] = idr->field[i_gxy][idx];
-          host_adm.g_dd(m, 0, 2, k, j, i) = g3d[S13] = idr->field[i_gxz][idx];
-          host_adm.g_dd(m, 1, 1, k, j, i) = g3d[S22] = idr->field[i_gyy][idx];
-          host_adm.g_dd(m, 1, 2, k, j, i) = g3d[S23] = idr->field[i_gyz][idx];
-          host_adm.g_dd(m, 2, 2, k, j, i) = g3d[S33] = idr->field[i_gzz][idx];
-
-          host_adm.vK_dd(m, 0, 0, k, j, i) = idr->field[i_Kxx][idx];
-          host_adm.vK_dd(m, 0, 1, k, j, i) = idr->field[i_Kxy][idx];
-          host_adm.vK_dd(m, 0, 2, k, j, i) = idr->field[i_Kxz][idx];
-          host_adm.vK_dd(m, 1, 1, k, j, i) = idr->field[i_Kyy][idx];
-          host_adm.vK_dd(m, 1, 2, k, j, i) = idr->field[i_Kyz][idx];
-          host_adm.vK_dd(m, 2, 2, k, j, i) = idr->field[i_Kzz][idx];
+          host_adm.g_dd(m, 0, 0, k, j, i) = g3d[S11] = f_gxx[idx];
+          host_adm.g_dd(m, 0, 1, k, j, i) = g3d[S12] = f_gxy[idx];
+          host_adm.g_dd(m, 0, 2, k, j, i) = g3d[S13] = f_gxz[idx];
+          host_adm.g_dd(m, 1, 1, k, j, i) = g3d[S22] = f_gyy[idx];
+          host_adm.g_dd(m, 1, 2, k, j, i) = g3d[S23] = f_gyz[idx];
+          host_adm.g_dd(m, 2, 2, k, j, i) = g3d[S33] = f_gzz[idx];
+
+          host_adm.vK_dd(m, 0, 0, k, j, i) = f_Kxx[idx];
+          host_adm.vK_dd(m, 0, 1, k, j, i) = f_Kxy[idx];
+          host_adm.vK_dd(m, 0, 2, k, j, i) = f_Kxz[idx];
+          host_adm.vK_dd(m, 1, 1, k, j, i) = f_Kyy[idx];
+          host_adm.vK_dd(m, 1, 2, k, j, i) = f_Kyz[idx];
+          host_adm.vK_dd(m, 2, 2, k, j, i) = f_Kzz[idx];
 
           // Extract hydro quantities
-          host_w0(m, IDN, k, j, i) = idr->field[i_rho][idx];
-          host_w0(m, IPR, k, j, i) = idr->field[i_p][idx];
-          Real vu[3] = {idr->field[i_vx][idx],
-                        idr->field[i_vy][idx],
-                        idr->field[i_vz][idx]};
+          host_w0(m, IDN, k, j, i) = f_rho[idx];
+          host_w0(m, IPR, k, j, i) = f_p[idx];
+          Real vu[3] = {f_vx[idx],
+                        f_vy[idx],
+                        f_vz[idx]};
 
           // Before we store the velocity, we need to make sure it's physical and
           // calculate the Lorentz factor. If the velocity is superluminal, we make a
@@ -248,9 +367,9 @@ void ProblemGenerator::UserProblem(ParameterInput *pin, const bool restart) {
   std::cout << "Host mirrors filled." << std::endl;
 
   // Cleanup
-  elliptica_id_reader_free(idr);
+  delete[] fdata;
 
-  std::cout << "Elliptica freed." << std::endl;
+  std::cout << "Field buffer freed." << std::endl;
 
   // Copy the data to the GPU.
   Kokkos::deep_copy(u_adm, host_u_adm);
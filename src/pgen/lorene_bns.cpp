@@ -37,6 +37,39 @@
 // Prototype for user-defined history function
 void BNSHistory(HistoryData *pdata, Mesh *pm);
 
+// Fixed ordering of the interpolated fields inside packed buffers.
+enum {
+  F_ALPHA=0, F_BETAX, F_BETAY, F_BETAZ,
+  F_GXX, F_GXY, F_GXZ, F_GYY, F_GYZ, F_GZZ,
+  F_KXX, F_KXY, F_KXZ, F_KYY, F_KYZ, F_KZZ,
+  F_NBAR, F_ESPEC, F_VX, F_VY, F_VZ,
+  NFIELD
+};
+
+//----------------------------------------------------------------------------------------
+//! \fn void EvaluateLoreneFields()
+//! \brief Evaluate the LORENE spectral data at npts points and pack the interpolated
+//! fields into fdata, with field f of point n stored at fdata[f*npts + n].
+
+static void EvaluateLoreneFields(const std::string &fname, int npts,
+                                 Real *x, Real *y, Real *z, Real *fdata) {
+  // Interpolate the data; the whole point set is evaluated in a single call
+  Lorene::Bin_NS *bns = new Lorene::Bin_NS(npts, x, y, z, fname.c_str());
+
+  const double *farr[NFIELD] = {
+    bns->nnn, bns->beta_x, bns->beta_y, bns->beta_z,
+    bns->g_xx, bns->g_xy, bns->g_xz, bns->g_yy, bns->g_yz, bns->g_zz,
+    bns->k_xx, bns->k_xy, bns->k_xz, bns->k_yy, bns->k_yz, bns->k_zz,
+    bns->nbar, bns->ener_spec, bns->u_euler_x, bns->u_euler_y, bns->u_euler_z};
+  for (int f = 0; f < NFIELD; f++) {
+    for (int n = 0; n < npts; n++) {
+      fdata[static_cast<size_t>(f)*npts + n] = farr[f][n];
+    }
+  }
+
+  delete bns;
+}
+
 //----------------------------------------------------------------------------------------
 //! \fn ProblemGenerator::UserProblem_()
 //! \brief Problem Generator for BNS with LORENE
@@ -130,10 +163,119 @@ void ProblemGenerator::UserProblem(ParameterInput *pin, const bool restart) {
     }
   }
 
-  // Interpolate the data
   std::cout << "Coordinates assigned." << std::endl;
-  Lorene::Bin_NS *bns = new Lorene::Bin_NS(width, x_coords, y_coords, z_coords,
-                                          fname.c_str());
+
+  // Evaluate the spectral data.  By default every rank runs the (serial, CPU-only)
+  // LORENE evaluation over its own points.  When <problem>/id_reader_ranks = N is set
+  // with 0 < N < nranks, only N reader ranks open the initial data file; the remaining
+  // ranks ship their point sets to a reader over MPI and receive the interpolated
+  // fields back.  This bounds the number of ranks simultaneously reading (and holding
+  // copies of) the spectral data, and feeds each reader one large batched point set.
+  Real *fdata = new Real[static_cast<size_t>(NFIELD)*width];
+#if MPI_PARALLEL_ENABLED
+  int nreaders = pin->GetOrAddInteger("problem","id_reader_ranks",0);
+  if (nreaders > 0 && nreaders < global_variable::nranks) {
+    // Split ranks into one group per reader; the reader is the smallest world rank in
+    // each group
+    MPI_Comm id_comm;
+    int color = global_variable::my_rank % nreaders;
+    MPI_Comm_split(MPI_COMM_WORLD, color, global_variable::my_rank, &id_comm);
+    int id_rank, id_size;
+    MPI_Comm_rank(id_comm, &id_rank);
+    MPI_Comm_size(id_comm, &id_size);
+
+    // Gather point counts, then coordinates, from every rank in the group
+    int *widths = nullptr, *displs = nullptr, *fcounts = nullptr, *fdispls = nullptr;
+    Real *all_x = nullptr, *all_y = nullptr, *all_z = nullptr, *all_f = nullptr;
+    int ntotal = 0;
+    if (id_rank == 0) {
+      widths  = new int[id_size];
+      displs  = new int[id_size];
+      fcounts = new int[id_size];
+      fdispls = new int[id_size];
+    }
+    MPI_Gather(&width, 1, MPI_INT, widths, 1, MPI_INT, 0, id_comm);
+    if (id_rank == 0) {
+      for (int p = 0; p < id_size; p++) {
+        displs[p]  = ntotal;
+        fcounts[p] = NFIELD*widths[p];
+        fdispls[p] = NFIELD*displs[p];
+        ntotal += widths[p];
+      }
+      all_x = new Real[ntotal];
+      all_y = new Real[ntotal];
+      all_z = new Real[ntotal];
+    }
+    MPI_Gatherv(x_coords, width, MPI_ATHENA_REAL,
+                all_x, widths, displs, MPI_ATHENA_REAL, 0, id_comm);
+    MPI_Gatherv(y_coords, width, MPI_ATHENA_REAL,
+                all_y, widths, displs, MPI_ATHENA_REAL, 0, id_comm);
+    MPI_Gatherv(z_coords, width, MPI_ATHENA_REAL,
+                all_z, widths, displs, MPI_ATHENA_REAL, 0, id_comm);
+
+    if (id_rank == 0) {
+      // Evaluate the whole batch in a single LORENE call, then repack each rank's
+      // slab so it can be scattered as one contiguous chunk
+      Real *fall = new Real[static_cast<size_t>(NFIELD)*ntotal];
+      EvaluateLoreneFields(fname, ntotal, all_x, all_y, all_z, fall);
+      all_f = new Real[static_cast<size_t>(NFIELD)*ntotal];
+      for (int p = 0; p < id_size; p++) {
+        for (int f = 0; f < NFIELD; f++) {
+          for (int n = 0; n < widths[p]; n++) {
+            all_f[fdispls[p] + static_cast<size_t>(f)*widths[p] + n] =
+                fall[static_cast<size_t>(f)*ntotal + displs[p] + n];
+          }
+        }
+      }
+      delete[] fall;
+      delete[] all_x;
+      delete[] all_y;
+      delete[] all_z;
+    }
+    MPI_Scatterv(all_f, fcounts, fdispls, MPI_ATHENA_REAL,
+                 fdata, NFIELD*width, MPI_ATHENA_REAL, 0, id_comm);
+    if (id_rank == 0) {
+      delete[] all_f;
+      delete[] widths;
+      delete[] displs;
+      delete[] fcounts;
+      delete[] fdispls;
+    }
+    MPI_Comm_free(&id_comm);
+  } else {
+    EvaluateLoreneFields(fname, width, x_coords, y_coords, z_coords, fdata);
+  }
+#else
+  EvaluateLoreneFields(fname, width, x_coords, y_coords, z_coords, fdata);
+#endif
+
+  std::cout << "Fields interpolated." << std::endl;
+
+  // Save pointers into the packed field buffer for shorthand.
+  const Real *f_alpha = &fdata[static_cast<size_t>(F_ALPHA)*width];
+  const Real *f_betax = &fdata[static_cast<size_t>(F_BETAX)*width];
+  const Real *f_betay = &fdata[static_cast<size_t>(F_BETAY)*width];
+  const Real *f_betaz = &fdata[static_cast<size_t>(F_BETAZ)*width];
+
+  const Real *f_gxx   = &fdata[static_cast<size_t>(F_GXX)*width];
+  const Real *f_gxy   = &fdata[static_cast<size_t>(F_GXY)*width];
+  const Real *f_gxz   = &fdata[static_cast<size_t>(F_GXZ)*width];
+  const Real *f_gyy   = &fdata[static_cast<size_t>(F_GYY)*width];
+  const Real *f_gyz   = &fdata[static_cast<size_t>(F_GYZ)*width];
+  const Real *f_gzz   = &fdata[static_cast<size_t>(F_GZZ)*width];
+
+  const Real *f_Kxx   = &fdata[static_cast<size_t>(F_KXX)*width];
+  const Real *f_Kxy   = &fdata[static_cast<size_t>(F_KXY)*width];
+  const Real *f_Kxz   = &fdata[static_cast<size_t>(F_KXZ)*width];
+  const Real *f_Kyy   = &fdata[static_cast<size_t>(F_KYY)*width];
+  const Real *f_Kyz   = &fdata[static_cast<size_t>(F_KYZ)*width];
+  const Real *f_Kzz   = &fdata[static_cast<size_t>(F_KZZ)*width];
+
+  const Real *f_nbar  = &fdata[static_cast<size_t>(F_NBAR)*width];
+  const Real *f_espec = &fdata[static_cast<size_t>(F_ESPEC)*width];
+  const Real *f_vx    = &fdata[static_cast<size_t>(F_VX)*width];
+  const Real *f_vy    = &fdata[static_cast<size_t>(F_VY)*width];
+  const Real *f_vz    = &fdata[static_cast<size_t>(F_VZ)*width];
 
   // Free the coordinates, since we'll no longer need them.
   delete[] x_coords;
@@ -198,39 +340,39 @@ void ProblemGenerator::UserProblem(ParameterInput *pin, const bool restart) {
           int j = (idx - m*nkji - k*nji)/ni;
           int i = (idx - m*nkji - k*nji - j*ni);*/
           // Extract metric quantities
-          host_adm.alpha(m, k, j, i) = bns->nnn[idx];
-          host_adm.beta_u(m, 0, k, j, i) = bns->beta_x[idx];
-          host_adm.beta_u(m, 1, k, j, i) = bns->beta_y[idx];
-          host_adm.beta_u(m, 2, k, j, i) = bns->beta_z[idx];
+          host_adm.alpha(m, k, j, i) = f_alpha[idx];
+          host_adm.beta_u(m, 0, k, j, i) = f_betax[idx];
+          host_adm.beta_u(m, 1, k, j, i) = f_betay[idx];
+          host_adm.beta_u(m, 2, k, j, i) = f_betaz[idx];
 
           Real g3d[NSPMETRIC];
-          host_adm.g_dd(m, 0, 0, k, j, i) = g3d[S11] = bns->g_xx[idx];
-          host_adm.g_dd(m, 0, 1, k, j, i) = g3d[S12] = bns->g_xy[idx];
-          host_adm.g_dd(m, 0, 2, k, j, i) = g3d[S13] = bns->g_xz[idx];
-          host_adm.g_dd(m, 1, 1, k, j, i) = g3d[S22] = bns->g_yy[idx];
-          host_adm.g_dd(m, 1, 2, k, j, i) = g3d[S23] = bns->g_yz[idx];
-          host_adm.g_dd(m, 2, 2, k, j, i) = g3d[S33] = bns->g_zz[idx];
-
-          host_adm.vK_dd(m, 0, 0, k, j, i) = coord_unit * bns->k_xx[idx];
-          host_adm.vK_dd(m, 0, 1, k, j, i) = coord_unit * bns->k_xy[idx];
-          host_adm.vK_dd(m, 0, 2, k, j, i) = coord_unit * bns->k_xz[idx];
-          host_adm.vK_dd(m, 1, 1, k, j, i) = coord_unit * bns->k_yy[idx];
-          host_adm.vK_dd(m, 1, 2, k, j, i) = coord_unit * bns->k_yz[idx];
-          host_adm.vK_dd(m, 2, 2, k, j, i) = coord_unit * bns->k_zz[idx];
+          host_adm.g_dd(m, 0, 0, k, j, i) = g3d[S11] = f_gxx[idx];
+          host_adm.g_dd(m, 0, 1, k, j, i) = g3d[S12] = f_gxy[idx];
+          host_adm.g_dd(m, 0, 2, k, j, i) = g3d[S13] = f_gxz[idx];
+          host_adm.g_dd(m, 1, 1, k, j, i) = g3d[S22] = f_gyy[idx];
+          host_adm.g_dd(m, 1, 2, k, j, i) = g3d[S23] = f_gyz[idx];
+          host_adm.g_dd(m, 2, 2, k, j, i) = g3d[S33] = f_gzz[idx];
+
+          host_adm.vK_dd(m, 0, 0, k, j, i) = coord_unit * f_Kxx[idx];
+          host_adm.vK_dd(m, 0, 1, k, j, i) = coord_unit * f_Kxy[idx];
+          host_adm.vK_dd(m, 0, 2, k, j, i) = coord_unit * f_Kxz[idx];
+          host_adm.vK_dd(m, 1, 1, k, j, i) = coord_unit * f_Kyy[idx];
+          host_adm.vK_dd(m, 1, 2, k, j, i) = coord_unit * f_Kyz[idx];
+          host_adm.vK_dd(m, 2, 2, k, j, i) = coord_unit * f_Kzz[idx];
 
           // Extract hydro quantities
-          host_w0(m, IDN, k, j, i) = bns->nbar[idx] / rho_unit;
+          host_w0(m, IDN, k, j, i) = f_nbar[idx] / rho_unit;
           // Lorene only gives the specific internal energy, but PrimitiveSolver needs
           // pressure. Because PrimitiveSolver is templated, it's difficult to call it
           // directly. Thus, the easiest way is to save the internal energy density, IEN,
           // whose index overlaps the pressure, IPR, move the data to the GPU, then
           // make a call to a virtual DynGRMHD EOS function that will call the appropriate
           // template function.
-          Real egas = host_w0(m, IDN, k, j, i) * bns->ener_spec[idx] / ener_unit;
+          Real egas = host_w0(m, IDN, k, j, i) * f_espec[idx] / ener_unit;
           host_w0(m, IEN, k, j, i) = egas;
-          Real vu[3] = {bns->u_euler_x[idx] / vel_unit,
-                        bns->u_euler_y[idx] / vel_unit,
-                        bns->u_euler_z[idx] / vel_unit};
+          Real vu[3] = {f_vx[idx] / vel_unit,
+                        f_vy[idx] / vel_unit,
+                        f_vz[idx] / vel_unit};
 
           // Before we store the velocity, we need to make sure it's physical and
           // calculate the Lorentz factor. If the velocity is superluminal, we make a
@@ -262,9 +404,9 @@ void ProblemGenerator::UserProblem(ParameterInput *pin, const bool restart) {
   std::cout << "Host mirrors filled." << std::endl;
 
   // Cleanup
-  delete bns;
+  delete[] fdata;
 
-  std::cout << "Lorene freed." << std::endl;
+  std::cout << "Field buffer freed." << std::endl;
 
   // Copy the data to the GPU.
   Kokkos::deep_copy(u_adm, host_u_adm);
@@ -8,10 +8,16 @@
 //! Default constructor calls problem generator function, while  constructor for restarts
 //! reads data from restart file, as well as re-initializing problem-specific data.
 
+#include <algorithm>
+#include <condition_variable>
+#include <cstdint>
+#include <cstring>
 #include <iostream>
+#include <mutex>
 #include <string>
+#include <thread>
 #include <utility>
-#include <algorithm>
+#include <vector>
 
 #include "athena.hpp"
 #include "geodesic-grid/geodesic_grid.hpp"
@@ -24,6 +30,7 @@
 #include "z4c/z4c.hpp"
 #include "radiation/radiation.hpp"
 #include "srcterms/turb_driver.hpp"
+#include "utils/restart_checksum.hpp"
 #include "pgen.hpp"
 
 //----------------------------------------------------------------------------------------
@@ -44,6 +51,43 @@ ProblemGenerator::ProblemGenerator(ParameterInput *pin, Mesh *pm) :
   user_srcs = pin->GetOrAddBoolean("problem","user_srcs",false);
   user_hist = pin->GetOrAddBoolean("problem","user_hist",false);
 
+#if MPI_PARALLEL_ENABLED
+  // Post the receives for the first boundary exchange before any initial data is
+  // constructed.  Problem generation can be long and imbalanced across ranks (e.g.
+  // interpolation of external initial data in elliptica_bns), and the sends in
+  // Driver::InitBoundaryValuesAndPrimitives() are posted by each rank as soon as its
+  // own MeshBlocks are filled.  With receives already standing, messages from fast
+  // ranks drain while slow ranks are still generating data, so startup is bounded by
+  // the slowest rank rather than the sum of the generation and exchange phases.
+  {
+    MeshBlockPack *ppack = pm->pmb_pack;
+    // with ion-neutral (two-fluid) MHD both fluids are exchanged through the fused
+    // MHD boundary buffers, so standalone hydro receives would never be matched
+    if (ppack->phydro != nullptr && ppack->pionn == nullptr) {
+      int nvar = ppack->phydro->nhydro + ppack->phydro->nscalars;
+      (void) ppack->phydro->pbval_u->InitRecv(nvar);
+      ppack->phydro->pbval_u->init_recv_posted = true;
+    }
+    if (ppack->pmhd != nullptr) {
+      int nvar = ppack->pmhd->nmhd + ppack->pmhd->nscalars;
+      (void) ppack->pmhd->pbval_u->InitRecv(nvar);
+      ppack->pmhd->pbval_u->init_recv_posted = true;
+      (void) ppack->pmhd->pbval_b->InitRecv(3);
+      ppack->pmhd->pbval_b->init_recv_posted = true;
+    }
+    if (ppack->pz4c != nullptr) {
+      (void) ppack->pz4c->pbval_u->InitRecv(z4c::Z4c::nz4c);
+      ppack->pz4c->pbval_u->init_recv_posted = true;
+    }
+#if RADIATION_ENABLED
+    if (ppack->prad != nullptr) {
+      (void) ppack->prad->pbval_i->InitRecv(ppack->prad->prgeo->nangles);
+      ppack->prad->pbval_i->init_recv_posted = true;
+    }
+#endif
+  }
+#endif
+
 #if USER_PROBLEM_ENABLED
   // call user-defined problem generator
   UserProblem(pin, false);
@@ -57,10 +101,12 @@ ProblemGenerator::ProblemGenerator(ParameterInput *pin, Mesh *pm) :
     AlfvenWave(pin, false);
   } else if (pgen_fun_name.compare("gr_bondi") == 0) {
     BondiAccretion(pin, false);
+#if RADIATION_ENABLED
   } else if (pgen_fun_name.compare("tetrad") == 0) {
     CheckOrthonormalTetrad(pin, false);
   } else if (pgen_fun_name.compare("hohlraum") == 0) {
     Hohlraum(pin, false);
+#endif
   } else if (pgen_fun_name.compare("linear_wave") == 0) {
     LinearWave(pin, false);
   } else if (pgen_fun_name.compare("implode") == 0) {
@@ -69,8 +115,10 @@ ProblemGenerator::ProblemGenerator(ParameterInput *pin, Mesh *pm) :
     Monopole(pin, false);
   } else if (pgen_fun_name.compare("orszag_tang") == 0) {
     OrszagTang(pin, false);
+#if RADIATION_ENABLED
   } else if (pgen_fun_name.compare("rad_linear_wave") == 0) {
     RadiationLinearWave(pin, false);
+#endif
   } else if (pgen_fun_name.compare("shock_tube") == 0) {
     ShockTube(pin, false);
   } else if (pgen_fun_name.compare("z4c_linear_wave") == 0) {
@@ -119,6 +167,300 @@ ProblemGenerator::ProblemGenerator(ParameterInput *pin, Mesh *pm) :
   }
 }
 
+//----------------------------------------------------------------------------------------
+//! \fn void LoadRestartDataLazy()
+//! \brief reads this rank's contiguous region of MeshBlock data from the restart file
+//! through large sequential windowed reads issued by a background host thread, and
+//! copies each MeshBlock's payload into the physics arrays as soon as the window
+//! holding it lands.  This replaces one collective read call per MeshBlock per physics
+//! module with a few large independent requests, and overlaps file read-in with the
+//! host-to-device copies that follow, which dominate cold-start time on large restarts.
+//! When cks is not null, each MeshBlock's payload checksum is also recomputed here, so
+//! verification overlaps the background reads of later windows and adds no extra pass.
+
+namespace {
+
+void LoadRestartDataLazy(Mesh *pm, IOWrapper &resfile, IOWrapperSizeT offset_myrank,
+                         IOWrapperSizeT data_size, std::vector<std::uint64_t> *cks) {
+  // get spatial dimensions of arrays; restart files hold interior zones only, except
+  // the ADM data of a non-evolved spacetime which is stored with its ghost zones
+  auto &indcs = pm->pmb_pack->pmesh->mb_indcs;
+  int nout1 = indcs.nx1;
+  int nout2 = indcs.nx2;
+  int nout3 = indcs.nx3;
+  int aout1 = indcs.nx1 + 2*(indcs.ng);
+  int aout2 = (indcs.nx2 > 1)? (indcs.nx2 + 2*(indcs.ng)) : 1;
+  int aout3 = (indcs.nx3 > 1)? (indcs.nx3 + 2*(indcs.ng)) : 1;
+  int nmb = pm->pmb_pack->nmb_thispack;
+  hydro::Hydro* phydro = pm->pmb_pack->phydro;
+  mhd::MHD* pmhd = pm->pmb_pack->pmhd;
+  adm::ADM* padm = pm->pmb_pack->padm;
+  z4c::Z4c* pz4c = pm->pmb_pack->pz4c;
+  radiation::Radiation* prad = pm->pmb_pack->prad;
+  TurbulenceDriver* pturb = pm->pmb_pack->pturb;
+  int nhydro=0, nmhd=0, nrad=0, nforce=3, nadm=0, nz4c=0;
+  if (phydro != nullptr) {
+    nhydro = phydro->nhydro + phydro->nscalars;
+  }
+  if (pmhd != nullptr) {
+    nmhd = pmhd->nmhd + pmhd->nscalars;
+  }
+  if (prad != nullptr) {
+    nrad = prad->prgeo->nangles;
+  }
+  if (pz4c != nullptr) {
+    nz4c = pz4c->nz4c;
+  } else if (padm != nullptr) {
+    nadm = padm->nadm;
+  }
+
+  IOWrapperSizeT mysize = data_size*nmb;
+  char *payload = new char[mysize];
+
+  // stream the region through large sequential windows; the number of bytes landed so
+  // far is published under a mutex so MeshBlocks can be unpacked as windows complete
+  const IOWrapperSizeT window = 67108864;  // 64 MiB read requests
+  IOWrapperSizeT nready = 0;
+  bool rfailed = false;
+  std::mutex rmtx;
+  std::condition_variable rcv;
+  auto read_windows = [&]() {
+    IOWrapperSizeT pos = 0;
+    while (pos < mysize) {
+      IOWrapperSizeT len = std::min(window, mysize - pos);
+      bool ok = (resfile.Read_bytes_at(&(payload[pos]),1,len,offset_myrank+pos) == len);
+      {
+        std::lock_guard<std::mutex> lock(rmtx);
+        if (ok) {
+          nready += len;
+        } else {
+          rfailed = true;
+        }
+      }
+      rcv.notify_one();
+      if (!ok) {return;}
+      pos += len;
+    }
+  };
+
+  // read on a background host thread when MPI allows file access from other threads,
+  // else fall back to reading inline (still benefits from the large requests)
+  bool threaded = true;
+#if MPI_PARALLEL_ENABLED
+  int mpiprv;
+  MPI_Query_thread(&mpiprv);
+  threaded = (mpiprv == MPI_THREAD_MULTIPLE);
+#endif
+  std::thread rthread;
+  if (threaded) {
+    rthread = std::thread(read_windows);
+  } else {
+    read_windows();
+  }
+
+  // unpack each MeshBlock's payload once the window holding it has landed.  Payloads
+  // hold interior zones only, so each module's slab is staged to the device through an
+  // unmanaged host view and scattered into the interior of its physics array by a
+  // small kernel; copies of early MeshBlocks still overlap later reads.  Ghost zones
+  // are regenerated by the boundary exchange in InitBoundaryValuesAndPrimitives().
+  using HostSlab4D = Kokkos::View<Real****, Kokkos::LayoutRight, Kokkos::HostSpace,
+                                  Kokkos::MemoryTraits<Kokkos::Unmanaged>>;
+  using HostSlab3D = Kokkos::View<Real***, Kokkos::LayoutRight, Kokkos::HostSpace,
+                                  Kokkos::MemoryTraits<Kokkos::Unmanaged>>;
+  int is = indcs.is, js = indcs.js, ks = indcs.ks;
+  int nvmax = std::max(std::max(nhydro, nmhd),
+                       std::max(std::max(nrad, nforce), nz4c));
+  DvceArray4D<Real> dslab("rst-dslab", nvmax, nout3, nout2, nout1);
+  DvceArray3D<Real> dx1f("rst-dx1f",1,1,1);
+  DvceArray3D<Real> dx2f("rst-dx2f",1,1,1);
+  DvceArray3D<Real> dx3f("rst-dx3f",1,1,1);
+  if (pmhd != nullptr) {
+    Kokkos::realloc(dx1f, nout3, nout2, nout1+1);
+    Kokkos::realloc(dx2f, nout3, nout2+1, nout1);
+    Kokkos::realloc(dx3f, nout3+1, nout2, nout1);
+  }
+  for (int m=0; m<nmb; ++m) {
+    {
+      std::unique_lock<std::mutex> lock(rmtx);
+      IOWrapperSizeT need = data_size*(m+1);
+      rcv.wait(lock, [&]() {return ((nready >= need) || rfailed);});
+      if (rfailed) {
+        std::cout << "### FATAL ERROR in " << __FILE__ << " at line " << __LINE__
+                  << std::endl << "MeshBlock data not read correctly from rst file, "
+                  << "restart file is broken." << std::endl;
+        exit(EXIT_FAILURE);
+      }
+    }
+    char *pb = &(payload[m*data_size]);
+    if (cks != nullptr) {
+      (*cks)[m] = restart_checksum::SumReals(reinterpret_cast<const Real*>(pb),
+                                             data_size/sizeof(Real), 0);
+    }
+    // unpack physics modules in same order as they are written in restart files
+    if (phydro != nullptr) {
+      HostSlab4D hslab(reinterpret_cast<Real*>(pb), nhydro, nout3, nout2, nout1);
+      Kokkos::deep_copy(Kokkos::subview(dslab, std::make_pair(0,nhydro), Kokkos::ALL,
+                        Kokkos::ALL, Kokkos::ALL), hslab);
+      auto &u0 = phydro->u0;
+      par_for("rst-hyd",DevExeSpace(),0,nhydro-1,0,nout3-1,0,nout2-1,0,nout1-1,
+      KOKKOS_LAMBDA(int n, int k, int j, int i) {
+        u0(m,n,ks+k,js+j,is+i) = dslab(n,k,j,i);
+      });
+      pb += hslab.size()*sizeof(Real);
+    }
+    if (pmhd != nullptr) {
+      HostSlab4D hslab(reinterpret_cast<Real*>(pb), nmhd, nout3, nout2, nout1);
+      Kokkos::deep_copy(Kokkos::subview(dslab, std::make_pair(0,nmhd), Kokkos::ALL,
+                        Kokkos::ALL, Kokkos::ALL), hslab);
+      auto &u0 = pmhd->u0;
+      par_for("rst-mhd",DevExeSpace(),0,nmhd-1,0,nout3-1,0,nout2-1,0,nout1-1,
+      KOKKOS_LAMBDA(int n, int k, int j, int i) {
+        u0(m,n,ks+k,js+j,is+i) = dslab(n,k,j,i);
+      });
+      pb += hslab.size()*sizeof(Real);
+      HostSlab3D hx1f(reinterpret_cast<Real*>(pb), nout3, nout2, nout1+1);
+      Kokkos::deep_copy(dx1f, hx1f);
+      auto &x1f = pmhd->b0.x1f;
+      par_for("rst-b1",DevExeSpace(),0,nout3-1,0,nout2-1,0,nout1,
+      KOKKOS_LAMBDA(int k, int j, int i) {
+        x1f(m,ks+k,js+j,is+i) = dx1f(k,j,i);
+      });
+      pb += hx1f.size()*sizeof(Real);
+      HostSlab3D hx2f(reinterpret_cast<Real*>(pb), nout3, nout2+1, nout1);
+      Kokkos::deep_copy(dx2f, hx2f);
+      auto &x2f = pmhd->b0.x2f;
+      par_for("rst-b2",DevExeSpace(),0,nout3-1,0,nout2,0,nout1-1,
+      KOKKOS_LAMBDA(int k, int j, int i) {
+        x2f(m,ks+k,js+j,is+i) = dx2f(k,j,i);
+      });
+      pb += hx2f.size()*sizeof(Real);
+      HostSlab3D hx3f(reinterpret_cast<Real*>(pb), nout3+1, nout2, nout1);
+      Kokkos::deep_copy(dx3f, hx3f);
+      auto &x3f = pmhd->b0.x3f;
+      par_for("rst-b3",DevExeSpace(),0,nout3,0,nout2-1,0,nout1-1,
+      KOKKOS_LAMBDA(int k, int j, int i) {
+        x3f(m,ks+k,js+j,is+i) = dx3f(k,j,i);
+      });
+      pb += hx3f.size()*sizeof(Real);
+    }
+    if (prad != nullptr) {
+      HostSlab4D hslab(reinterpret_cast<Real*>(pb), nrad, nout3, nout2, nout1);
+      Kokkos::deep_copy(Kokkos::subview(dslab, std::make_pair(0,nrad), Kokkos::ALL,
+                        Kokkos::ALL, Kokkos::ALL), hslab);
+      auto &i0 = prad->i0;
+      par_for("rst-rad",DevExeSpace(),0,nrad-1,0,nout3-1,0,nout2-1,0,nout1-1,
+      KOKKOS_LAMBDA(int n, int k, int j, int i) {
+        i0(m,n,ks+k,js+j,is+i) = dslab(n,k,j,i);
+      });
+      pb += hslab.size()*sizeof(Real);
+    }
+    if (pturb != nullptr) {
+      HostSlab4D hslab(reinterpret_cast<Real*>(pb), nforce, nout3, nout2, nout1);
+      Kokkos::deep_copy(Kokkos::subview(dslab, std::make_pair(0,nforce), Kokkos::ALL,
+                        Kokkos::ALL, Kokkos::ALL), hslab);
+      auto &force = pturb->force;
+      par_for("rst-frc",DevExeSpace(),0,nforce-1,0,nout3-1,0,nout2-1,0,nout1-1,
+      KOKKOS_LAMBDA(int n, int k, int j, int i) {
+        force(m,n,ks+k,js+j,is+i) = dslab(n,k,j,i);
+      });
+      pb += hslab.size()*sizeof(Real);
+    }
+    if (pz4c != nullptr) {
+      HostSlab4D hslab(reinterpret_cast<Real*>(pb), nz4c, nout3, nout2, nout1);
+      Kokkos::deep_copy(Kokkos::subview(dslab, std::make_pair(0,nz4c), Kokkos::ALL,
+                        Kokkos::ALL, Kokkos::ALL), hslab);
+      auto &u0 = pz4c->u0;
+      par_for("rst-z4c",DevExeSpace(),0,nz4c-1,0,nout3-1,0,nout2-1,0,nout1-1,
+      KOKKOS_LAMBDA(int n, int k, int j, int i) {
+        u0(m,n,ks+k,js+j,is+i) = dslab(n,k,j,i);
+      });
+      pb += hslab.size()*sizeof(Real);
+    } else if (padm != nullptr) {
+      // ADM data of a non-evolved spacetime is stored with its ghost zones
+      HostSlab4D hslab(reinterpret_cast<Real*>(pb), nadm, aout3, aout2, aout1);
+      Kokkos::deep_copy(Kokkos::subview(padm->u_adm, m, Kokkos::ALL, Kokkos::ALL,
+                        Kokkos::ALL, Kokkos::ALL), hslab);
+      pb += hslab.size()*sizeof(Real);
+    }
+  }
+  if (rthread.joinable()) {rthread.join();}
+  delete [] payload;
+
+  // If the spacetime is evolved, we also need to reinitialize the ADM data.
+  if (pz4c != nullptr) {
+    pz4c->Z4cToADM(pm->pmb_pack);
+  }
+  return;
+}
+
+//----------------------------------------------------------------------------------------
+//! \fn bool ReadChecksumFooter()
+//! \brief probes the restart file for the checksum footer written after the MeshBlock
+//! records (see utils/restart_checksum.hpp); when present, each rank reads the expected
+//! checksums of its own MeshBlocks into cks and true is returned.  Files written
+//! without checksums lack the footer and are accepted unverified
+
+bool ReadChecksumFooter(Mesh *pm, IOWrapper &resfile, IOWrapperSizeT headeroffset,
+                        IOWrapperSizeT data_size, std::vector<std::uint64_t> &cks) {
+  IOWrapperSizeT footer_off = headeroffset + data_size*(pm->nmb_total);
+  int present = 0;
+  if (global_variable::my_rank == 0) {
+    char hdr[restart_checksum::kFooterHdrSize];
+    IOWrapperSizeT hsize = restart_checksum::kFooterHdrSize;
+    if (resfile.Read_bytes_at(hdr, 1, hsize, footer_off) == hsize) {
+      if (std::memcmp(hdr, restart_checksum::kMagic,
+                      sizeof(restart_checksum::kMagic)) == 0) {
+        std::int32_t nmbt;
+        std::memcpy(&nmbt, &(hdr[16]), sizeof(std::int32_t));
+        if (nmbt != pm->nmb_total) {
+          std::cout << "### FATAL ERROR in " << __FILE__ << " at line " << __LINE__
+                    << std::endl << "Checksum footer does not match number of MeshBlocks "
+                    << "in restart file, restart file is broken." << std::endl;
+          exit(EXIT_FAILURE);
+        }
+        present = 1;
+      }
+    }
+  }
+#if MPI_PARALLEL_ENABLED
+  MPI_Bcast(&present, 1, MPI_INT, 0, MPI_COMM_WORLD);
+#endif
+  if (present == 0) {return false;}
+
+  int nmb = pm->nmb_thisrank;
+  int mygids = pm->gids_eachrank[global_variable::my_rank];
+  cks.resize(nmb);
+  IOWrapperSizeT myoff = footer_off + restart_checksum::kFooterHdrSize +
+                         mygids*sizeof(std::uint64_t);
+  IOWrapperSizeT nbytes = nmb*sizeof(std::uint64_t);
+  if (resfile.Read_bytes_at(cks.data(), 1, nbytes, myoff) != nbytes) {
+    std::cout << "### FATAL ERROR in " << __FILE__ << " at line " << __LINE__
+              << std::endl << "Checksum footer not read correctly from rst file, "
+              << "restart file is broken." << std::endl;
+    exit(EXIT_FAILURE);
+  }
+  return true;
+}
+
+//----------------------------------------------------------------------------------------
+//! \fn void AccumulateChecksums()
+//! \brief folds one physics module's slab of every MeshBlock in a host staging array
+//! into the running per-MeshBlock checksums.  base tracks the slab's first Real-word
+//! index within the MeshBlock payload and is advanced past this module on return
+
+template <typename ViewType>
+void AccumulateChecksums(const ViewType &arr, int nmb, std::vector<std::uint64_t> &cks,
+                         std::uint64_t &base) {
+  std::size_t nwords = arr.size()/nmb;
+  for (int m=0; m<nmb; ++m) {
+    cks[m] += restart_checksum::SumReals(arr.data() + m*nwords, nwords, base);
+  }
+  base += nwords;
+  return;
+}
+
+}  // namespace
+
 //----------------------------------------------------------------------------------------
 // constructor for restarts
 // When called, data needed to rebuild mesh has been read from restart file by
@@ -141,11 +483,18 @@ ProblemGenerator::ProblemGenerator(ParameterInput *pin, Mesh *pm, IOWrapper resf
   user_srcs = pin->GetOrAddBoolean("problem","user_srcs",false);
   user_hist = pin->GetOrAddBoolean("problem","user_hist",false);
 
-  // get spatial dimensions of arrays, including ghost zones
+  // get spatial dimensions of arrays.  Restart files hold interior zones only; ghost
+  // zones are regenerated by the boundary exchange in InitBoundaryValuesAndPrimitives()
+  // after this constructor returns.  The ADM data of a non-evolved spacetime is the
+  // exception: it has no boundary communication, so it is stored with its ghost zones
   auto &indcs = pm->pmb_pack->pmesh->mb_indcs;
-  int nout1 = indcs.nx1 + 2*(indcs.ng);
-  int nout2 = (indcs.nx2 > 1)? (indcs.nx2 + 2*(indcs.ng)) : 1;
-  int nout3 = (indcs.nx3 > 1)? (indcs.nx3 + 2*(indcs.ng)) : 1;
+  int nout1 = indcs.nx1;
+  int nout2 = indcs.nx2;
+  int nout3 = indcs.nx3;
+  int aout1 = indcs.nx1 + 2*(indcs.ng);
+  int aout2 = (indcs.nx2 > 1)? (indcs.nx2 + 2*(indcs.ng)) : 1;
+  int aout3 = (indcs.nx3 > 1)? (indcs.nx3 + 2*(indcs.ng)) : 1;
+  int is = indcs.is, js = indcs.js, ks = indcs.ks;
   int nmb = pm->pmb_pack->nmb_thispack;
   // calculate total number of CC variables
   hydro::Hydro* phydro = pm->pmb_pack->phydro;
@@ -239,7 +588,7 @@ ProblemGenerator::ProblemGenerator(ParameterInput *pin, Mesh *pm, IOWrapper resf
   if (pz4c != nullptr) {
     data_size_ += nout1*nout2*nout3*nz4c*sizeof(Real);   // z4c u0
   } else if (padm != nullptr) {
-    data_size_ += nout1*nout2*nout3*nadm*sizeof(Real);   // adm u_adm
+    data_size_ += aout1*aout2*aout3*nadm*sizeof(Real);   // adm u_adm (with ghosts)
   }
 
   if (data_size_ != data_size) {
@@ -255,8 +604,33 @@ ProblemGenerator::ProblemGenerator(ParameterInput *pin, Mesh *pm, IOWrapper resf
   IOWrapperSizeT offset_myrank = headeroffset + data_size_*mygids;
   IOWrapperSizeT myoffset = offset_myrank;
 
+  // verify per-MeshBlock payload checksums when the dump carries the checksum footer
+  // (disabled with 'restart_verify' parameter in <problem> block); recomputation is
+  // folded into the unpack passes below so no extra sweep over the data is needed
+  bool verify = pin->GetOrAddBoolean("problem","restart_verify",true);
+  std::vector<std::uint64_t> cks_expect;
+  if (verify) {
+    verify = ReadChecksumFooter(pm, resfile, headeroffset, data_size, cks_expect);
+  }
+  std::vector<std::uint64_t> cks_actual(nmb, 0);
+  std::uint64_t ckbase = 0;
+
+  // Lazy windowed read path (enabled with 'lazy_restart_read' parameter in <problem>
+  // block): stream this rank's contiguous file region through large background reads
+  // and unpack MeshBlocks as their data arrives, instead of issuing one collective
+  // read per MeshBlock per physics module (see LoadRestartDataLazy above)
+  bool lazy_read = pin->GetOrAddBoolean("problem","lazy_restart_read",false);
+  if (lazy_read) {
+    LoadRestartDataLazy(pm, resfile, offset_myrank, data_size,
+                        (verify) ? &cks_actual : nullptr);
+  }
+
   HostArray5D<Real> ccin("rst-cc-in", 1, 1, 1, 1, 1);
   HostFaceFld4D<Real> fcin("rst-fc-in", 1, 1, 1, 1);
+  // device staging for the interior slabs read above; payloads are scattered from it
+  // into the interior of the physics arrays by small kernels
+  DvceArray5D<Real> dcin("rst-cc-d", 1, 1, 1, 1, 1);
+  DvceArray4D<Real> dfc("rst-fc-d", 1, 1, 1, 1);
 
   // calculate max/min number of MeshBlocks across all ranks
   int noutmbs_max = pm->nmb_eachrank[0];
@@ -266,7 +640,7 @@ ProblemGenerator::ProblemGenerator(ParameterInput *pin, Mesh *pm, IOWrapper resf
     noutmbs_min = std::min(noutmbs_min,pm->nmb_eachrank[i]);
   }
 
-  if (phydro != nullptr) {
+  if (!lazy_read && (phydro != nullptr)) {
     Kokkos::realloc(ccin, nmb, nhydro, nout3, nout2, nout1);
     for (int m=0;  m<noutmbs_max; ++m) {
       // every rank has a MB to read, so read collectively
@@ -298,13 +672,19 @@ ProblemGenerator::ProblemGenerator(ParameterInput *pin, Mesh *pm, IOWrapper resf
         myoffset += data_size;
       }
     }
-    Kokkos::deep_copy(Kokkos::subview(phydro->u0, std::make_pair(0,nmb), Kokkos::ALL,
-                      Kokkos::ALL, Kokkos::ALL, Kokkos::ALL), ccin);
+    if (verify) {AccumulateChecksums(ccin, nmb, cks_actual, ckbase);}
+    Kokkos::realloc(dcin, nmb, nhydro, nout3, nout2, nout1);
+    Kokkos::deep_copy(dcin, ccin);
+    auto &u0 = phydro->u0;
+    par_for("rst-hyd",DevExeSpace(),0,nmb-1,0,nhydro-1,0,nout3-1,0,nout2-1,0,nout1-1,
+    KOKKOS_LAMBDA(int m, int n, int k, int j, int i) {
+      u0(m,n,ks+k,js+j,is+i) = dcin(m,n,k,j,i);
+    });
     offset_myrank += nout1*nout2*nout3*nhydro*sizeof(Real); // hydro u0
     myoffset = offset_myrank;
   }
 
-  if (pmhd != nullptr) {
+  if (!lazy_read && (pmhd != nullptr)) {
     Kokkos::realloc(ccin, nmb, nmhd, nout3, nout2, nout1);
     for (int m=0;  m<noutmbs_max; ++m) {
       // every rank has a MB to read, so read collectively
@@ -335,8 +715,14 @@ ProblemGenerator::ProblemGenerator(ParameterInput *pin, Mesh *pm, IOWrapper resf
         myoffset += data_size;
       }
     }
-    Kokkos::deep_copy(Kokkos::subview(pmhd->u0, std::make_pair(0,nmb), Kokkos::ALL,
-                      Kokkos::ALL, Kokkos::ALL, Kokkos::ALL), ccin);
+    if (verify) {AccumulateChecksums(ccin, nmb, cks_actual, ckbase);}
+    Kokkos::realloc(dcin, nmb, nmhd, nout3, nout2, nout1);
+    Kokkos::deep_copy(dcin, ccin);
+    auto &u0 = pmhd->u0;
+    par_for("rst-mhd",DevExeSpace(),0,nmb-1,0,nmhd-1,0,nout3-1,0,nout2-1,0,nout1-1,
+    KOKKOS_LAMBDA(int m, int n, int k, int j, int i) {
+      u0(m,n,ks+k,js+j,is+i) = dcin(m,n,k,j,i);
+    });
     offset_myrank += nout1*nout2*nout3*nmhd*sizeof(Real);   // mhd u0
     myoffset = offset_myrank;
 
@@ -424,19 +810,37 @@ ProblemGenerator::ProblemGenerator(ParameterInput *pin, Mesh *pm, IOWrapper resf
         myoffset += data_size-(x1fptr.size()+x2fptr.size()+x3fptr.size())*sizeof(Real);
       }
     }
-    Kokkos::deep_copy(Kokkos::subview(pmhd->b0.x1f, std::make_pair(0,nmb), Kokkos::ALL,
-                      Kokkos::ALL, Kokkos::ALL), fcin.x1f);
-    Kokkos::deep_copy(Kokkos::subview(pmhd->b0.x2f, std::make_pair(0,nmb), Kokkos::ALL,
-                      Kokkos::ALL, Kokkos::ALL), fcin.x2f);
-    Kokkos::deep_copy(Kokkos::subview(pmhd->b0.x3f, std::make_pair(0,nmb), Kokkos::ALL,
-                      Kokkos::ALL, Kokkos::ALL), fcin.x3f);
+    if (verify) {
+      AccumulateChecksums(fcin.x1f, nmb, cks_actual, ckbase);
+      AccumulateChecksums(fcin.x2f, nmb, cks_actual, ckbase);
+      AccumulateChecksums(fcin.x3f, nmb, cks_actual, ckbase);
+    }
+    auto &b0 = pmhd->b0;
+    Kokkos::realloc(dfc, nmb, nout3, nout2, nout1+1);
+    Kokkos::deep_copy(dfc, fcin.x1f);
+    par_for("rst-b1",DevExeSpace(),0,nmb-1,0,nout3-1,0,nout2-1,0,nout1,
+    KOKKOS_LAMBDA(int m, int k, int j, int i) {
+      b0.x1f(m,ks+k,js+j,is+i) = dfc(m,k,j,i);
+    });
+    Kokkos::realloc(dfc, nmb, nout3, nout2+1, nout1);
+    Kokkos::deep_copy(dfc, fcin.x2f);
+    par_for("rst-b2",DevExeSpace(),0,nmb-1,0,nout3-1,0,nout2,0,nout1-1,
+    KOKKOS_LAMBDA(int m, int k, int j, int i) {
+      b0.x2f(m,ks+k,js+j,is+i) = dfc(m,k,j,i);
+    });
+    Kokkos::realloc(dfc, nmb, nout3+1, nout2, nout1);
+    Kokkos::deep_copy(dfc, fcin.x3f);
+    par_for("rst-b3",DevExeSpace(),0,nmb-1,0,nout3,0,nout2-1,0,nout1-1,
+    KOKKOS_LAMBDA(int m, int k, int j, int i) {
+      b0.x3f(m,ks+k,js+j,is+i) = dfc(m,k,j,i);
+    });
     offset_myrank += (nout1+1)*nout2*nout3*sizeof(Real);    // mhd b0.x1f
     offset_myrank += nout1*(nout2+1)*nout3*sizeof(Real);    // mhd b0.x2f
     offset_myrank += nout1*nout2*(nout3+1)*sizeof(Real);    // mhd b0.x3f
     myoffset = offset_myrank;
   }
 
-  if (prad != nullptr) {
+  if (!lazy_read && (prad != nullptr)) {
     Kokkos::realloc(ccin, nmb, nrad, nout3, nout2, nout1);
     for (int m=0;  m<noutmbs_max; ++m) {
       // every rank has a MB to read, so read collectively
@@ -468,13 +872,19 @@ ProblemGenerator::ProblemGenerator(ParameterInput *pin, Mesh *pm, IOWrapper resf
         myoffset += data_size;
       }
     }
-    Kokkos::deep_copy(Kokkos::subview(prad->i0, std::make_pair(0,nmb), Kokkos::ALL,
-                      Kokkos::ALL, Kokkos::ALL, Kokkos::ALL), ccin);
+    if (verify) {AccumulateChecksums(ccin, nmb, cks_actual, ckbase);}
+    Kokkos::realloc(dcin, nmb, nrad, nout3, nout2, nout1);
+    Kokkos::deep_copy(dcin, ccin);
+    auto &i0 = prad->i0;
+    par_for("rst-rad",DevExeSpace(),0,nmb-1,0,nrad-1,0,nout3-1,0,nout2-1,0,nout1-1,
+    KOKKOS_LAMBDA(int m, int n, int k, int j, int i) {
+      i0(m,n,ks+k,js+j,is+i) = dcin(m,n,k,j,i);
+    });
     offset_myrank += nout1*nout2*nout3*nrad*sizeof(Real);   // radiation i0
     myoffset = offset_myrank;
   }
 
-  if (pturb != nullptr) {
+  if (!lazy_read && (pturb != nullptr)) {
     Kokkos::realloc(ccin, nmb, nforce, nout3, nout2, nout1);
     for (int m=0;  m<noutmbs_max; ++m) {
       // every rank has a MB to read, so read collectively
@@ -506,13 +916,19 @@ ProblemGenerator::ProblemGenerator(ParameterInput *pin, Mesh *pm, IOWrapper resf
         myoffset += data_size;
       }
     }
-    Kokkos::deep_copy(Kokkos::subview(pturb->force, std::make_pair(0,nmb), Kokkos::ALL,
-                      Kokkos::ALL, Kokkos::ALL, Kokkos::ALL), ccin);
+    if (verify) {AccumulateChecksums(ccin, nmb, cks_actual, ckbase);}
+    Kokkos::realloc(dcin, nmb, nforce, nout3, nout2, nout1);
+    Kokkos::deep_copy(dcin, ccin);
+    auto &force = pturb->force;
+    par_for("rst-frc",DevExeSpace(),0,nmb-1,0,nforce-1,0,nout3-1,0,nout2-1,0,nout1-1,
+    KOKKOS_LAMBDA(int m, int n, int k, int j, int i) {
+      force(m,n,ks+k,js+j,is+i) = dcin(m,n,k,j,i);
+    });
     offset_myrank += nout1*nout2*nout3*nforce*sizeof(Real); // forcing
     myoffset = offset_myrank;
   }
 
-  if (pz4c != nullptr) {
+  if (!lazy_read && (pz4c != nullptr)) {
     Kokkos::realloc(ccin, nmb, nz4c, nout3, nout2, nout1);
     for (int m=0;  m<noutmbs_max; ++m) {
       // every rank has a MB to read, so read collectively
@@ -544,15 +960,21 @@ ProblemGenerator::ProblemGenerator(ParameterInput *pin, Mesh *pm, IOWrapper resf
         myoffset += data_size;
       }
     }
-    Kokkos::deep_copy(Kokkos::subview(pz4c->u0, std::make_pair(0,nmb), Kokkos::ALL,
-                      Kokkos::ALL, Kokkos::ALL, Kokkos::ALL), ccin);
+    if (verify) {AccumulateChecksums(ccin, nmb, cks_actual, ckbase);}
+    Kokkos::realloc(dcin, nmb, nz4c, nout3, nout2, nout1);
+    Kokkos::deep_copy(dcin, ccin);
+    auto &u0 = pz4c->u0;
+    par_for("rst-z4c",DevExeSpace(),0,nmb-1,0,nz4c-1,0,nout3-1,0,nout2-1,0,nout1-1,
+    KOKKOS_LAMBDA(int m, int n, int k, int j, int i) {
+      u0(m,n,ks+k,js+j,is+i) = dcin(m,n,k,j,i);
+    });
     offset_myrank += nout1*nout2*nout3*nz4c*sizeof(Real);   // z4c u0
     myoffset = offset_myrank;
 
     // We also need to reinitialize the ADM data.
     pz4c->Z4cToADM(pmy_mesh_->pmb_pack);
-  } else if (padm != nullptr) {
-    Kokkos::realloc(ccin, nmb, nadm, nout3, nout2, nout1);
+  } else if (!lazy_read && (padm != nullptr)) {
+    Kokkos::realloc(ccin, nmb, nadm, aout3, aout2, aout1);
     for (int m=0;  m<noutmbs_max; ++m) {
       // every rank has a MB to read, so read collectively
       if (m < noutmbs_min) {
@@ -583,12 +1005,25 @@ ProblemGenerator::ProblemGenerator(ParameterInput *pin, Mesh *pm, IOWrapper resf
         myoffset += data_size;
       }
     }
+    if (verify) {AccumulateChecksums(ccin, nmb, cks_actual, ckbase);}
     Kokkos::deep_copy(Kokkos::subview(padm->u_adm, std::make_pair(0,nmb), Kokkos::ALL,
                       Kokkos::ALL, Kokkos::ALL, Kokkos::ALL), ccin);
-    offset_myrank += nout1*nout2*nout3*nadm*sizeof(Real);   // adm u_adm
+    offset_myrank += aout1*aout2*aout3*nadm*sizeof(Real);   // adm u_adm (with ghosts)
     myoffset = offset_myrank;
   }
 
+  // compare recomputed checksums against the footer and abort on any mismatch
+  if (verify) {
+    for (int m=0; m<nmb; ++m) {
+      if (cks_actual[m] != cks_expect[m]) {
+        std::cout << "### FATAL ERROR in " << __FILE__ << " at line " << __LINE__
+                  << std::endl << "Restart checksum mismatch for MeshBlock gid = "
+                  << (mygids + m) << ", restart file is corrupted." << std::endl;
+        exit(EXIT_FAILURE);
+      }
+    }
+  }
+
   // call problem generator again to re-initialize data, fn ptrs, as needed
 #if USER_PROBLEM_ENABLED
   UserProblem(pin, true);
@@ -601,10 +1036,12 @@ ProblemGenerator::ProblemGenerator(ParameterInput *pin, Mesh *pm, IOWrapper resf
     AlfvenWave(pin, true);
   } else if (pgen_fun_name.compare("gr_bondi") == 0) {
     BondiAccretion(pin, true);
+#if RADIATION_ENABLED
   } else if (pgen_fun_name.compare("tetrad") == 0) {
     CheckOrthonormalTetrad(pin, true);
   } else if (pgen_fun_name.compare("hohlraum") == 0) {
     Hohlraum(pin, true);
+#endif
   } else if (pgen_fun_name.compare("linear_wave") == 0) {
     LinearWave(pin, true);
   } else if (pgen_fun_name.compare("implode") == 0) {
@@ -613,8 +1050,10 @@ ProblemGenerator::ProblemGenerator(ParameterInput *pin, Mesh *pm, IOWrapper resf
     Monopole(pin, true);
   } else if (pgen_fun_name.compare("orszag_tang") == 0) {
     OrszagTang(pin, true);
+#if RADIATION_ENABLED
   } else if (pgen_fun_name.compare("rad_linear_wave") == 0) {
     RadiationLinearWave(pin, true);
+#endif
   } else if (pgen_fun_name.compare("shock_tube") == 0) {
     ShockTube(pin, true);
   } else if (pgen_fun_name.compare("z4c_linear_wave") == 0) {
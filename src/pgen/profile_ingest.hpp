@@ -0,0 +1,65 @@
+#ifndef PGEN_PROFILE_INGEST_HPP_
+#define PGEN_PROFILE_INGEST_HPP_
+//========================================================================================
+// AthenaXXX astrophysical plasma code
+// Copyright(C) 2020 James M. Stone <jmstone@ias.edu> and the Athena code team
+// Licensed under the 3-clause BSD License (the "LICENSE")
+//========================================================================================
+//! \file profile_ingest.hpp
+//! \brief Shared helpers for problem generators that build 1D profiles or tables on the
+//! host at startup (TOV solutions, EOS tables, disk profiles, ...).  Rank 0 performs
+//! the file read or integration once and the result is broadcast, so startup cost does
+//! not grow with the number of ranks, the filesystem sees a single reader, and every
+//! rank is guaranteed bitwise identical data.  Without MPI the helpers are no-ops, so
+//! callers need no guards.  Typical use:
+//!
+//!     if (global_variable::my_rank == 0) { /* read file / integrate ODE into views */ }
+//!     pgen::BroadcastProfile(prof.rho);
+//!     pgen::BroadcastReals(&prof.r_edge, 1);
+//!
+//! followed by the usual modify/sync of the dual views to upload to the device.
+
+#include "athena.hpp"
+#include "globals.hpp"
+#if MPI_PARALLEL_ENABLED
+#include <mpi.h>
+#endif
+
+namespace pgen {
+
+//----------------------------------------------------------------------------------------
+//! \fn void BroadcastReals()
+//! \brief broadcast n Reals from rank 0 to all ranks
+
+inline void BroadcastReals(Real *vals, int n) {
+#if MPI_PARALLEL_ENABLED
+  MPI_Bcast(vals, n, MPI_ATHENA_REAL, 0, MPI_COMM_WORLD);
+#endif
+}
+
+//----------------------------------------------------------------------------------------
+//! \fn void BroadcastInts()
+//! \brief broadcast n ints from rank 0 to all ranks
+
+inline void BroadcastInts(int *vals, int n) {
+#if MPI_PARALLEL_ENABLED
+  MPI_Bcast(vals, n, MPI_INT, 0, MPI_COMM_WORLD);
+#endif
+}
+
+//----------------------------------------------------------------------------------------
+//! \fn void BroadcastProfile()
+//! \brief broadcast the host side of a 1D profile from rank 0 to all ranks.  The view
+//! must already be allocated with the same length everywhere; callers mark it modified
+//! and sync to the device afterwards (batched with their other profiles)
+
+inline void BroadcastProfile(DualArray1D<Real> &arr) {
+#if MPI_PARALLEL_ENABLED
+  MPI_Bcast(arr.h_view.data(), static_cast<int>(arr.h_view.extent(0)),
+            MPI_ATHENA_REAL, 0, MPI_COMM_WORLD);
+#endif
+}
+
+} // namespace pgen
+
+#endif // PGEN_PROFILE_INGEST_HPP_
@@ -15,6 +15,7 @@
 #include "hydro/hydro.hpp"
 #include "mhd/mhd.hpp"
 #include "pgen.hpp"
+#include "user_history.hpp"
 
 
 // User-defined history functions
@@ -177,66 +178,34 @@ void ProblemGenerator::UserProblem(ParameterInput *pin, const bool restart) {
 // 5 = < U^2 >
 // 6 = < (d_j U_i)(d_j U_i) >
 void TurbulentHistory(HistoryData *pdata, Mesh *pm) {
-  pdata->nhist = 11;
-  pdata->label[0] = "Bx";
-  pdata->label[1] = "By";
-  pdata->label[2] = "Bz";
-  pdata->label[3] = "B^2";
-  pdata->label[4] = "B^4";
-  pdata->label[5] = "dB^2";
-  pdata->label[6] = "BdB^2";
-  pdata->label[7] = "|BxJ|^2";
-  pdata->label[8] = "|B.J|^2";
-  pdata->label[9] = "U^2";
-  pdata->label[10] = "dU";
-
   // capture class variabels for kernel
   auto &bcc = pm->pmb_pack->pmhd->bcc0;
   auto &b = pm->pmb_pack->pmhd->b0;
   auto &w0_ = pm->pmb_pack->pmhd->w0;
   auto &size = pm->pmb_pack->pmb->mb_size;
-  int &nhist_ = pdata->nhist;
-
-  // loop over all MeshBlocks in this pack
-  auto &indcs = pm->pmb_pack->pmesh->mb_indcs;
-  int is = indcs.is; int nx1 = indcs.nx1;
-  int js = indcs.js; int nx2 = indcs.nx2;
-  int ks = indcs.ks; int nx3 = indcs.nx3;
-  const int nmkji = (pm->pmb_pack->nmb_thispack)*nx3*nx2*nx1;
-  const int nkji = nx3*nx2*nx1;
-  const int nji  = nx2*nx1;
-  array_sum::GlobalSum sum_this_mb;
-  Kokkos::parallel_reduce("HistSums",Kokkos::RangePolicy<>(DevExeSpace(), 0, nmkji),
-  KOKKOS_LAMBDA(const int &idx, array_sum::GlobalSum &mb_sum) {
-    // compute n,k,j,i indices of thread
-    int m = (idx)/nkji;
-    int k = (idx - m*nkji)/nji;
-    int j = (idx - m*nkji - k*nji)/nx1;
-    int i = (idx - m*nkji - k*nji - j*nx1) + is;
-    k += ks;
-    j += js;
 
+  // all columns are evaluated in one fused sweep; labels flow into the .hst header
+  pgen::SumUserHistory<11>(pdata, pm,
+    {"Bx","By","Bz","B^2","B^4","dB^2","BdB^2","|BxJ|^2","|B.J|^2","U^2","dU"},
+  KOKKOS_LAMBDA(int m, int k, int j, int i, Real *vals) {
     Real vol = size.d_view(m).dx1*size.d_view(m).dx2*size.d_view(m).dx3;
     Real dx_squared = size.d_view(m).dx1 * size.d_view(m).dx1;
 
-    // MHD conserved variables:
-    array_sum::GlobalSum hvars;
-
     // calculate mean B
-    hvars.the_array[0] = bcc(m,IBX,k,j,i);
-    hvars.the_array[1] = bcc(m,IBY,k,j,i);
-    hvars.the_array[2] = bcc(m,IBZ,k,j,i);
+    vals[0] = bcc(m,IBX,k,j,i);
+    vals[1] = bcc(m,IBY,k,j,i);
+    vals[2] = bcc(m,IBZ,k,j,i);
 
     // 0 = < B^2 >
     Real B_mag_sq = bcc(m,IBX,k,j,i)*bcc(m,IBX,k,j,i)
                   + bcc(m,IBY,k,j,i)*bcc(m,IBY,k,j,i)
                   + bcc(m,IBZ,k,j,i)*bcc(m,IBZ,k,j,i);
-    hvars.the_array[3] = B_mag_sq*vol;
+    vals[3] = B_mag_sq*vol;
     // 0 = < B^4 >
     Real B_fourth = B_mag_sq*B_mag_sq;
-    hvars.the_array[4] = B_fourth*vol;
+    vals[4] = B_fourth*vol;
     // 1 = < (d_j B_i)(d_j B_i) >
-    hvars.the_array[5] = (
+    vals[5] = (
       ((b.x1f(m,k,j,i+1)-b.x1f(m,k,j,i))*(b.x1f(m,k,j,i+1)-b.x1f(m,k,j,i))
      + (b.x2f(m,k,j+1,i)-b.x2f(m,k,j,i))*(b.x2f(m,k,j+1,i)-b.x2f(m,k,j,i))
      + (b.x3f(m,k+1,j,i)-b.x3f(m,k,j,i))*(b.x3f(m,k+1,j,i)-b.x3f(m,k,j,i))
@@ -263,7 +232,7 @@ void TurbulentHistory(HistoryData *pdata, Mesh *pm) {
     Real bdb3 = bcc(m,IBZ,k,j,i)*(b.x3f(m,k+1,j,i)-b.x3f(m,k,j,i))
                 +0.5*bcc(m,IBX,k,j,i)*(bcc(m,IBZ,k,j,i+1)-bcc(m,IBZ,k,j,i-1))
                 +0.5*bcc(m,IBY,k,j,i)*(bcc(m,IBZ,k,j+1,i)-bcc(m,IBZ,k,j-1,i));
-    hvars.the_array[6] = ((bdb1*bdb1 + bdb2*bdb2 + bdb3*bdb3) / dx_squared)*vol;
+    vals[6] = ((bdb1*bdb1 + bdb2*bdb2 + bdb3*bdb3) / dx_squared)*vol;
     // 3 = < |BxJ|^2 >
     Real Jx = 0.5*(bcc(m,IBZ,k,j+1,i)-bcc(m,IBZ,k,j-1,i))
              -0.5*(bcc(m,IBY,k+1,j,i)-bcc(m,IBY,k-1,j,i));
@@ -271,7 +240,7 @@ void TurbulentHistory(HistoryData *pdata, Mesh *pm) {
              -0.5*(bcc(m,IBZ,k,j,i+1)-bcc(m,IBZ,k,j,i-1));
     Real Jz = 0.5*(bcc(m,IBY,k,j,i+1)-bcc(m,IBY,k,j,i-1))
              -0.5*(bcc(m,IBX,k,j+1,i)-bcc(m,IBX,k,j-1,i));
-    hvars.the_array[7] =((
+    vals[7] =((
        (bcc(m,IBY,k,j,i)*Jz - bcc(m,IBZ,k,j,i)*Jy)
       *(bcc(m,IBY,k,j,i)*Jz - bcc(m,IBZ,k,j,i)*Jy)
       +(bcc(m,IBZ,k,j,i)*Jx - bcc(m,IBX,k,j,i)*Jz)
@@ -280,16 +249,16 @@ void TurbulentHistory(HistoryData *pdata, Mesh *pm) {
       *(bcc(m,IBX,k,j,i)*Jy - bcc(m,IBY,k,j,i)*Jx))
                     / dx_squared)*vol;
     // 4 = < |B.J|^2 >
-    hvars.the_array[8] = (
+    vals[8] = (
       ((bcc(m,IBX,k,j,i)*Jx + bcc(m,IBY,k,j,i)*Jy + bcc(m,IBZ,k,j,i)*Jz)
       *(bcc(m,IBX,k,j,i)*Jx + bcc(m,IBY,k,j,i)*Jy + bcc(m,IBZ,k,j,i)*Jz)
                           )/dx_squared)*vol;
     // 5 = < U^2 >
-    hvars.the_array[9] += ((w0_(m,IVX,k,j,i)*w0_(m,IVX,k,j,i))
+    vals[9] = ((w0_(m,IVX,k,j,i)*w0_(m,IVX,k,j,i))
                         + (w0_(m,IVY,k,j,i)*w0_(m,IVY,k,j,i))
                         + (w0_(m,IVZ,k,j,i)*w0_(m,IVZ,k,j,i)))*vol;
     // 6 = < (d_j U_i)(d_j U_i) >
-    hvars.the_array[10] +=
+    vals[10] =
     (((0.25*(w0_(m,IVX,k,j,i+1)-w0_(m,IVX,k,j,i-1))
            *(w0_(m,IVX,k,j,i+1)-w0_(m,IVX,k,j,i-1))
      + 0.25*(w0_(m,IVY,k,j+1,i)-w0_(m,IVY,k,j-1,i))
@@ -309,20 +278,6 @@ void TurbulentHistory(HistoryData *pdata, Mesh *pm) {
      + 0.25*(w0_(m,IVZ,k,j+1,i)-w0_(m,IVZ,k,j-1,i))
            *(w0_(m,IVZ,k,j+1,i)-w0_(m,IVZ,k,j-1,i))))
      / dx_squared)*vol;
-
-    // fill rest of the_array with zeros, if nhist < NHISTORY_VARIABLES
-    for (int n=nhist_; n<NHISTORY_VARIABLES; ++n) {
-      hvars.the_array[n] = 0.0;
-    }
-
-    // sum into parallel reduce
-    mb_sum += hvars;
-  }, Kokkos::Sum<array_sum::GlobalSum>(sum_this_mb));
-  Kokkos::fence();
-
-  // store data into hdata array
-  for (int n=0; n<pdata->nhist; ++n) {
-    pdata->hdata[n] = sum_this_mb.the_array[n];
-  }
+  });
   return;
 }
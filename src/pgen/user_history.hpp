@@ -0,0 +1,118 @@
+#ifndef PGEN_USER_HISTORY_HPP_
+#define PGEN_USER_HISTORY_HPP_
+//========================================================================================
+// AthenaXXX astrophysical plasma code
+// Copyright(C) 2020 James M. Stone <jmstone@ias.edu> and the Athena code team
+// Licensed under the 3-clause BSD License (the "LICENSE")
+//========================================================================================
+//! \file user_history.hpp
+//! \brief Helpers for user-defined history outputs.  Problem generators register their
+//! per-cell column functors here and all columns are evaluated in one fused
+//! multi-reduction sweep over the pack, exactly like the built-in
+//! LoadHydroHistoryData/LoadMHDHistoryData sweeps, so the memory traffic per history
+//! cadence is a single pass regardless of how many columns are requested.  Labels flow
+//! into the .hst header automatically.  Only volume-sum columns are supported; max/min
+//! style diagnostics still need a hand-written function since the cross-rank history
+//! reduction only performs sums.  Typical use inside a user_hist_func:
+//!
+//!     pgen::SumUserHistory<2>(pdata, pm, {"KE","ME"},
+//!       KOKKOS_LAMBDA(int m, int k, int j, int i, Real *vals) {
+//!         vals[0] = ...; vals[1] = ...;
+//!       });
+//!
+//! or, with one single-column functor per diagnostic:
+//!
+//!     pgen::SumUserHistory(pdata, pm, {"KE","ME"},
+//!       KOKKOS_LAMBDA(int m, int k, int j, int i) {return ...;},
+//!       KOKKOS_LAMBDA(int m, int k, int j, int i) {return ...;});
+
+#include <array>
+#include <string>
+
+#include "athena.hpp"
+#include "mesh/mesh.hpp"
+#include "outputs/outputs.hpp"
+
+namespace pgen {
+
+//----------------------------------------------------------------------------------------
+//! \fn void SumUserHistory()
+//! \brief evaluate N user history columns in one fused reduction over all cells of all
+//! MeshBlocks in this pack.  The functor is called once per cell and fills vals[0..N-1]
+//! with the per-cell contributions (including any volume weighting); shared
+//! subexpressions between columns are computed once.  Results and labels are stored in
+//! pdata for the history framework to sum across ranks and write out.
+
+template <int N, class F>
+void SumUserHistory(HistoryData *pdata, Mesh *pm,
+                    const std::array<std::string, N> &labels, F fill) {
+  static_assert(N <= NHISTORY_VARIABLES,
+                "too many user history columns; increase NHISTORY_VARIABLES");
+  pdata->nhist = N;
+  for (int n=0; n<N; ++n) {
+    pdata->label[n] = labels[n];
+  }
+
+  // loop over all MeshBlocks in this pack
+  auto &indcs = pm->pmb_pack->pmesh->mb_indcs;
+  int is = indcs.is; int nx1 = indcs.nx1;
+  int js = indcs.js; int nx2 = indcs.nx2;
+  int ks = indcs.ks; int nx3 = indcs.nx3;
+  const int nmkji = (pm->pmb_pack->nmb_thispack)*nx3*nx2*nx1;
+  const int nkji = nx3*nx2*nx1;
+  const int nji  = nx2*nx1;
+  array_sum::GlobalSum sum_this_mb;
+  Kokkos::parallel_reduce("UserHistSums",Kokkos::RangePolicy<>(DevExeSpace(), 0, nmkji),
+  KOKKOS_LAMBDA(const int &idx, array_sum::GlobalSum &mb_sum) {
+    // compute m,k,j,i indices of thread
+    int m = (idx)/nkji;
+    int k = (idx - m*nkji)/nji;
+    int j = (idx - m*nkji - k*nji)/nx1;
+    int i = (idx - m*nkji - k*nji - j*nx1) + is;
+    k += ks;
+    j += js;
+
+    // evaluate every registered column at this cell in one pass
+    Real vals[N];
+    fill(m,k,j,i,vals);
+    array_sum::GlobalSum hvars;
+    for (int n=0; n<N; ++n) {
+      hvars.the_array[n] = vals[n];
+    }
+    // fill rest of the_array with zeros, if N < NHISTORY_VARIABLES
+    for (int n=N; n<NHISTORY_VARIABLES; ++n) {
+      hvars.the_array[n] = 0.0;
+    }
+
+    // sum into parallel reduce
+    mb_sum += hvars;
+  }, Kokkos::Sum<array_sum::GlobalSum>(sum_this_mb));
+  Kokkos::fence();
+
+  // store data into hdata array
+  for (int n=0; n<N; ++n) {
+    pdata->hdata[n] = sum_this_mb.the_array[n];
+  }
+  return;
+}
+
+//----------------------------------------------------------------------------------------
+//! \fn void SumUserHistory()
+//! \brief convenience overload taking one single-column functor per diagnostic, each
+//! called as f(m,k,j,i) and returning the per-cell contribution of its column.  All
+//! functors are evaluated inside the same fused sweep
+
+template <class... Fs>
+void SumUserHistory(HistoryData *pdata, Mesh *pm,
+                    const std::array<std::string, sizeof...(Fs)> &labels, Fs... fs) {
+  SumUserHistory<static_cast<int>(sizeof...(Fs))>(pdata, pm, labels,
+    KOKKOS_LAMBDA(int m, int k, int j, int i, Real *vals) {
+      int n = 0;
+      ((vals[n++] = fs(m,k,j,i)), ...);
+    });
+  return;
+}
+
+} // namespace pgen
+
+#endif // PGEN_USER_HISTORY_HPP_
@@ -0,0 +1,278 @@
+#ifndef PGEN_VECTOR_POTENTIAL_HPP_
+#define PGEN_VECTOR_POTENTIAL_HPP_
+//========================================================================================
+// AthenaXXX astrophysical plasma code
+// Copyright(C) 2020 James M. Stone <jmstone@ias.edu> and the Athena code team
+// Licensed under the 3-clause BSD License (the "LICENSE")
+//========================================================================================
+//! \file vector_potential.hpp
+//! \brief Shared device-side engine to initialize the face-centered magnetic field from
+//! a user-supplied vector potential.  Problem generators define a device-callable
+//! functor returning the n-th component of A at a position,
+//!
+//!     struct MyAPot {
+//!       KOKKOS_INLINE_FUNCTION
+//!       Real operator()(int n, Real x1, Real x2, Real x3) const {...}
+//!     };
+//!
+//! and call InitFieldFromPotential(pmbp, MyAPot{...}), which evaluates A on cell edges
+//! and fills b0 via the standard curl stencil over all MeshBlocks in parallel, so B is
+//! divergence-free to machine precision.  With SMR/AMR, edge values on faces shared
+//! with finer MeshBlocks are averaged over the fine grid positions, guaranteeing the
+//! magnetic flux on shared fine/coarse faces is identical.  MaxDivB() below provides a
+//! check on the result.  Cell-centered fields are NOT set here since requirements vary
+//! between (non-)relativistic pgens; callers average b0 into bcc0 as needed.
+
+#include "athena.hpp"
+#include "mesh/mesh.hpp"
+#include "coordinates/cell_locations.hpp"
+
+namespace pgen {
+
+//----------------------------------------------------------------------------------------
+//! \fn void InitFieldFromPotential()
+//! \brief Computes face-centered fields b0 = curl(A) over all MeshBlocks in pack from
+//! device-callable functor apot(n,x1,x2,x3) returning components n=1,2,3 of the vector
+//! potential.  In 1D/2D the potential must not depend on the trailing coordinate(s).
+
+template <typename TAPot>
+void InitFieldFromPotential(MeshBlockPack *pmbp, TAPot apot, DvceFaceFld4D<Real> &b) {
+  auto &indcs = pmbp->pmesh->mb_indcs;
+  int &is = indcs.is; int &ie = indcs.ie;
+  int &js = indcs.js; int &je = indcs.je;
+  int &ks = indcs.ks; int &ke = indcs.ke;
+  int nmb = pmbp->nmb_thispack;
+  auto &size = pmbp->pmb->mb_size;
+  auto &nghbr = pmbp->pmb->nghbr;
+  auto &mblev = pmbp->pmb->mb_lev;
+  const bool multi_d = pmbp->pmesh->multi_d;
+  const bool three_d = pmbp->pmesh->three_d;
+
+  // compute edge-centered vector potential over all faces.  Scratch arrays are sized
+  // with ghost zones in every dimension so the (ie+1,je+1,ke+1) edges exist even when
+  // a dimension is not evolved
+  int ncells1 = indcs.nx1 + 2*(indcs.ng);
+  int ncells2 = indcs.nx2 + 2*(indcs.ng);
+  int ncells3 = indcs.nx3 + 2*(indcs.ng);
+  DvceArray4D<Real> a1, a2, a3;
+  Kokkos::realloc(a1, nmb,ncells3,ncells2,ncells1);
+  Kokkos::realloc(a2, nmb,ncells3,ncells2,ncells1);
+  Kokkos::realloc(a3, nmb,ncells3,ncells2,ncells1);
+
+  par_for("pgen_vector_potential", DevExeSpace(), 0,nmb-1,ks,ke+1,js,je+1,is,ie+1,
+  KOKKOS_LAMBDA(int m, int k, int j, int i) {
+    Real &x1min = size.d_view(m).x1min;
+    Real &x1max = size.d_view(m).x1max;
+    int nx1 = indcs.nx1;
+    Real x1v = CellCenterX(i-is, nx1, x1min, x1max);
+    Real x1f = LeftEdgeX  (i-is, nx1, x1min, x1max);
+
+    Real &x2min = size.d_view(m).x2min;
+    Real &x2max = size.d_view(m).x2max;
+    int nx2 = indcs.nx2;
+    Real x2v = CellCenterX(j-js, nx2, x2min, x2max);
+    Real x2f = LeftEdgeX  (j-js, nx2, x2min, x2max);
+
+    Real &x3min = size.d_view(m).x3min;
+    Real &x3max = size.d_view(m).x3max;
+    int nx3 = indcs.nx3;
+    Real x3v = CellCenterX(k-ks, nx3, x3min, x3max);
+    Real x3f = LeftEdgeX  (k-ks, nx3, x3min, x3max);
+
+    Real dx1 = size.d_view(m).dx1;
+    Real dx2 = size.d_view(m).dx2;
+    Real dx3 = size.d_view(m).dx3;
+
+    a1(m,k,j,i) = apot(1, x1v, x2f, x3f);
+    a2(m,k,j,i) = apot(2, x1f, x2v, x3f);
+    a3(m,k,j,i) = apot(3, x1f, x2f, x3v);
+
+    // When neighboring MeshBlock is at finer level, compute vector potential as sum of
+    // values at fine grid resolution.  This guarantees flux on shared fine/coarse
+    // faces is identical.  Neighbor lists only extend to the edges/faces present in
+    // each dimensionality, hence the multi_d/three_d guards.
+
+    // Correct A1 at x2-faces, x3-faces, and x2x3-edges
+    bool corr1 = false;
+    if (multi_d) {
+      corr1 = corr1 ||
+        (nghbr.d_view(m,8 ).lev > mblev.d_view(m) && j==js) ||
+        (nghbr.d_view(m,9 ).lev > mblev.d_view(m) && j==js) ||
+        (nghbr.d_view(m,10).lev > mblev.d_view(m) && j==js) ||
+        (nghbr.d_view(m,11).lev > mblev.d_view(m) && j==js) ||
+        (nghbr.d_view(m,12).lev > mblev.d_view(m) && j==je+1) ||
+        (nghbr.d_view(m,13).lev > mblev.d_view(m) && j==je+1) ||
+        (nghbr.d_view(m,14).lev > mblev.d_view(m) && j==je+1) ||
+        (nghbr.d_view(m,15).lev > mblev.d_view(m) && j==je+1);
+    }
+    if (three_d) {
+      corr1 = corr1 ||
+        (nghbr.d_view(m,24).lev > mblev.d_view(m) && k==ks) ||
+        (nghbr.d_view(m,25).lev > mblev.d_view(m) && k==ks) ||
+        (nghbr.d_view(m,26).lev > mblev.d_view(m) && k==ks) ||
+        (nghbr.d_view(m,27).lev > mblev.d_view(m) && k==ks) ||
+        (nghbr.d_view(m,28).lev > mblev.d_view(m) && k==ke+1) ||
+        (nghbr.d_view(m,29).lev > mblev.d_view(m) && k==ke+1) ||
+        (nghbr.d_view(m,30).lev > mblev.d_view(m) && k==ke+1) ||
+        (nghbr.d_view(m,31).lev > mblev.d_view(m) && k==ke+1) ||
+        (nghbr.d_view(m,40).lev > mblev.d_view(m) && j==js && k==ks) ||
+        (nghbr.d_view(m,41).lev > mblev.d_view(m) && j==js && k==ks) ||
+        (nghbr.d_view(m,42).lev > mblev.d_view(m) && j==je+1 && k==ks) ||
+        (nghbr.d_view(m,43).lev > mblev.d_view(m) && j==je+1 && k==ks) ||
+        (nghbr.d_view(m,44).lev > mblev.d_view(m) && j==js && k==ke+1) ||
+        (nghbr.d_view(m,45).lev > mblev.d_view(m) && j==js && k==ke+1) ||
+        (nghbr.d_view(m,46).lev > mblev.d_view(m) && j==je+1 && k==ke+1) ||
+        (nghbr.d_view(m,47).lev > mblev.d_view(m) && j==je+1 && k==ke+1);
+    }
+    if (corr1) {
+      Real xl = x1v + 0.25*dx1;
+      Real xr = x1v - 0.25*dx1;
+      a1(m,k,j,i) = 0.5*(apot(1, xl,x2f,x3f) + apot(1, xr,x2f,x3f));
+    }
+
+    // Correct A2 at x1-faces, x3-faces, and x1x3-edges
+    bool corr2 =
+      (nghbr.d_view(m,0 ).lev > mblev.d_view(m) && i==is) ||
+      (nghbr.d_view(m,1 ).lev > mblev.d_view(m) && i==is) ||
+      (nghbr.d_view(m,2 ).lev > mblev.d_view(m) && i==is) ||
+      (nghbr.d_view(m,3 ).lev > mblev.d_view(m) && i==is) ||
+      (nghbr.d_view(m,4 ).lev > mblev.d_view(m) && i==ie+1) ||
+      (nghbr.d_view(m,5 ).lev > mblev.d_view(m) && i==ie+1) ||
+      (nghbr.d_view(m,6 ).lev > mblev.d_view(m) && i==ie+1) ||
+      (nghbr.d_view(m,7 ).lev > mblev.d_view(m) && i==ie+1);
+    if (three_d) {
+      corr2 = corr2 ||
+        (nghbr.d_view(m,24).lev > mblev.d_view(m) && k==ks) ||
+        (nghbr.d_view(m,25).lev > mblev.d_view(m) && k==ks) ||
+        (nghbr.d_view(m,26).lev > mblev.d_view(m) && k==ks) ||
+        (nghbr.d_view(m,27).lev > mblev.d_view(m) && k==ks) ||
+        (nghbr.d_view(m,28).lev > mblev.d_view(m) && k==ke+1) ||
+        (nghbr.d_view(m,29).lev > mblev.d_view(m) && k==ke+1) ||
+        (nghbr.d_view(m,30).lev > mblev.d_view(m) && k==ke+1) ||
+        (nghbr.d_view(m,31).lev > mblev.d_view(m) && k==ke+1) ||
+        (nghbr.d_view(m,32).lev > mblev.d_view(m) && i==is && k==ks) ||
+        (nghbr.d_view(m,33).lev > mblev.d_view(m) && i==is && k==ks) ||
+        (nghbr.d_view(m,34).lev > mblev.d_view(m) && i==ie+1 && k==ks) ||
+        (nghbr.d_view(m,35).lev > mblev.d_view(m) && i==ie+1 && k==ks) ||
+        (nghbr.d_view(m,36).lev > mblev.d_view(m) && i==is && k==ke+1) ||
+        (nghbr.d_view(m,37).lev > mblev.d_view(m) && i==is && k==ke+1) ||
+        (nghbr.d_view(m,38).lev > mblev.d_view(m) && i==ie+1 && k==ke+1) ||
+        (nghbr.d_view(m,39).lev > mblev.d_view(m) && i==ie+1 && k==ke+1);
+    }
+    if (corr2) {
+      Real xl = x2v + 0.25*dx2;
+      Real xr = x2v - 0.25*dx2;
+      a2(m,k,j,i) = 0.5*(apot(2, x1f,xl,x3f) + apot(2, x1f,xr,x3f));
+    }
+
+    // Correct A3 at x1-faces, x2-faces, and x1x2-edges
+    bool corr3 =
+      (nghbr.d_view(m,0 ).lev > mblev.d_view(m) && i==is) ||
+      (nghbr.d_view(m,1 ).lev > mblev.d_view(m) && i==is) ||
+      (nghbr.d_view(m,2 ).lev > mblev.d_view(m) && i==is) ||
+      (nghbr.d_view(m,3 ).lev > mblev.d_view(m) && i==is) ||
+      (nghbr.d_view(m,4 ).lev > mblev.d_view(m) && i==ie+1) ||
+      (nghbr.d_view(m,5 ).lev > mblev.d_view(m) && i==ie+1) ||
+      (nghbr.d_view(m,6 ).lev > mblev.d_view(m) && i==ie+1) ||
+      (nghbr.d_view(m,7 ).lev > mblev.d_view(m) && i==ie+1);
+    if (multi_d) {
+      corr3 = corr3 ||
+        (nghbr.d_view(m,8 ).lev > mblev.d_view(m) && j==js) ||
+        (nghbr.d_view(m,9 ).lev > mblev.d_view(m) && j==js) ||
+        (nghbr.d_view(m,10).lev > mblev.d_view(m) && j==js) ||
+        (nghbr.d_view(m,11).lev > mblev.d_view(m) && j==js) ||
+        (nghbr.d_view(m,12).lev > mblev.d_view(m) && j==je+1) ||
+        (nghbr.d_view(m,13).lev > mblev.d_view(m) && j==je+1) ||
+        (nghbr.d_view(m,14).lev > mblev.d_view(m) && j==je+1) ||
+        (nghbr.d_view(m,15).lev > mblev.d_view(m) && j==je+1) ||
+        (nghbr.d_view(m,16).lev > mblev.d_view(m) && i==is && j==js) ||
+        (nghbr.d_view(m,17).lev > mblev.d_view(m) && i==is && j==js) ||
+        (nghbr.d_view(m,18).lev > mblev.d_view(m) && i==ie+1 && j==js) ||
+        (nghbr.d_view(m,19).lev > mblev.d_view(m) && i==ie+1 && j==js) ||
+        (nghbr.d_view(m,20).lev > mblev.d_view(m) && i==is && j==je+1) ||
+        (nghbr.d_view(m,21).lev > mblev.d_view(m) && i==is && j==je+1) ||
+        (nghbr.d_view(m,22).lev > mblev.d_view(m) && i==ie+1 && j==je+1) ||
+        (nghbr.d_view(m,23).lev > mblev.d_view(m) && i==ie+1 && j==je+1);
+    }
+    if (corr3) {
+      Real xl = x3v + 0.25*dx3;
+      Real xr = x3v - 0.25*dx3;
+      a3(m,k,j,i) = 0.5*(apot(3, x1f,x2f,xl) + apot(3, x1f,x2f,xr));
+    }
+  });
+
+  // compute face-centered fields from curl(A)
+  par_for("pgen_b0", DevExeSpace(), 0,nmb-1,ks,ke,js,je,is,ie,
+  KOKKOS_LAMBDA(int m, int k, int j, int i) {
+    Real dx1 = size.d_view(m).dx1;
+    Real dx2 = size.d_view(m).dx2;
+    Real dx3 = size.d_view(m).dx3;
+
+    b.x1f(m,k,j,i) = ((a3(m,k,j+1,i) - a3(m,k,j,i))/dx2 -
+                      (a2(m,k+1,j,i) - a2(m,k,j,i))/dx3);
+    b.x2f(m,k,j,i) = ((a1(m,k+1,j,i) - a1(m,k,j,i))/dx3 -
+                      (a3(m,k,j,i+1) - a3(m,k,j,i))/dx1);
+    b.x3f(m,k,j,i) = ((a2(m,k,j,i+1) - a2(m,k,j,i))/dx1 -
+                      (a1(m,k,j+1,i) - a1(m,k,j,i))/dx2);
+
+    // Include extra face-component at edge of block in each direction
+    if (i==ie) {
+      b.x1f(m,k,j,i+1) = ((a3(m,k,j+1,i+1) - a3(m,k,j,i+1))/dx2 -
+                          (a2(m,k+1,j,i+1) - a2(m,k,j,i+1))/dx3);
+    }
+    if (j==je) {
+      b.x2f(m,k,j+1,i) = ((a1(m,k+1,j+1,i) - a1(m,k,j+1,i))/dx3 -
+                          (a3(m,k,j+1,i+1) - a3(m,k,j+1,i))/dx1);
+    }
+    if (k==ke) {
+      b.x3f(m,k+1,j,i) = ((a2(m,k+1,j,i+1) - a2(m,k+1,j,i))/dx1 -
+                          (a1(m,k+1,j+1,i) - a1(m,k+1,j,i))/dx2);
+    }
+  });
+  return;
+}
+
+//----------------------------------------------------------------------------------------
+//! \fn Real MaxDivB()
+//! \brief Returns maximum |div(B)*dV| over all active cells in pack (local to this
+//! rank), as a diagnostic on field initialization.  Should be at round-off level for
+//! fields constructed with InitFieldFromPotential()
+
+inline Real MaxDivB(MeshBlockPack *pmbp, DvceFaceFld4D<Real> &b) {
+  auto &indcs = pmbp->pmesh->mb_indcs;
+  int is = indcs.is, nx1 = indcs.nx1;
+  int js = indcs.js, nx2 = indcs.nx2;
+  int ks = indcs.ks, nx3 = indcs.nx3;
+  auto &size = pmbp->pmb->mb_size;
+  const bool multi_d = pmbp->pmesh->multi_d;
+  const bool three_d = pmbp->pmesh->three_d;
+
+  const int nmkji = (pmbp->nmb_thispack)*nx3*nx2*nx1;
+  const int nkji = nx3*nx2*nx1;
+  const int nji  = nx2*nx1;
+  Real max_divb = 0.0;
+  Kokkos::parallel_reduce("pgen_divb", Kokkos::RangePolicy<>(DevExeSpace(), 0, nmkji),
+  KOKKOS_LAMBDA(const int &idx, Real &mdivb) {
+    // compute m,k,j,i indices of thread
+    int m = (idx)/nkji;
+    int k = (idx - m*nkji)/nji;
+    int j = (idx - m*nkji - k*nji)/nx1;
+    int i = (idx - m*nkji - k*nji - j*nx1) + is;
+    k += ks;
+    j += js;
+
+    Real dx1 = size.d_view(m).dx1;
+    Real dx2 = size.d_view(m).dx2;
+    Real dx3 = size.d_view(m).dx3;
+
+    Real divb = (b.x1f(m,k,j,i+1) - b.x1f(m,k,j,i))*dx2*dx3;
+    if (multi_d) {divb += (b.x2f(m,k,j+1,i) - b.x2f(m,k,j,i))*dx1*dx3;}
+    if (three_d) {divb += (b.x3f(m,k+1,j,i) - b.x3f(m,k,j,i))*dx1*dx2;}
+    mdivb = fmax(fabs(divb), mdivb);
+  }, Kokkos::Max<Real>(max_divb));
+  return max_divb;
+}
+
+} // namespace pgen
+
+#endif // PGEN_VECTOR_POTENTIAL_HPP_
@@ -40,7 +40,21 @@ Radiation::Radiation(MeshBlockPack *ppack, ParameterInput *pin) :
     tet_d2_x2f("tet_d2_x2f",1,1,1,1,1),
     tet_d3_x3f("tet_d3_x3f",1,1,1,1,1),
     na("na",1,1,1,1,1,1),
+    kv_r("kv_r",1,1,1,1,1),
+    kv_r0("kv_r0",1,1,1,1,1),
+    kv_p("kv_p",1,1,1,1,1),
+    kv_v("kv_v",1,1,1,1,1),
+    kv_t("kv_t",1,1,1,1,1),
     norm_to_tet("norm_to_tet",1,1,1,1,1,1),
+    n1_x1f("n1_x1f",1,1,1,1,1),
+    n2_x2f("n2_x2f",1,1,1,1,1),
+    n3_x3f("n3_x3f",1,1,1,1,1),
+    n_0_cc("n_0_cc",1,1,1,1,1),
+    gcov_cc("gcov_cc",1,1,1,1,1),
+    ang_leader("ang_leader",1),
+    ang_bin_wght("ang_bin_wght",1),
+    coarse_mb("coarse_mb",1),
+    rad_moments("rad_moments",1,1,1,1,1),
     beam_mask("beam_mask",1,1,1,1,1) {
   // Check for general relativity
   if (!(pmy_pack->pcoord->is_general_relativistic)) {
@@ -79,13 +93,28 @@ Radiation::Radiation(MeshBlockPack *ppack, ParameterInput *pin) :
 
   // Set radiation coupling parameters including scattering and absorption opacities,
   // radiation constant, and source term behavior.
+  table_opacity = false;
   if (rad_source) {
     kappa_s = pin->GetReal("radiation","kappa_s");
     power_opacity = pin->GetOrAddBoolean("radiation","power_opacity",false);
-    if (!(power_opacity)) {
+    table_opacity = pin->DoesParameterExist("radiation","opacity_table");
+    if (power_opacity && table_opacity) {
+      std::cout << "### FATAL ERROR in " << __FILE__ << " at line " << __LINE__
+        << std::endl << "Cannot enable both power_opacity and opacity_table" << std::endl;
+      std::exit(EXIT_FAILURE);
+    }
+    if (table_opacity && !(are_units_enabled)) {
+      std::cout << "### FATAL ERROR in " << __FILE__ << " at line " << __LINE__
+        << std::endl << "Tabulated opacities require enabling units" << std::endl;
+      std::exit(EXIT_FAILURE);
+    }
+    if (!(power_opacity) && !(table_opacity)) {
       kappa_a = pin->GetReal("radiation","kappa_a");
       kappa_p = pin->GetReal("radiation","kappa_p");
     }
+    if (table_opacity) {
+      LoadOpacityTable(pin);
+    }
     is_compton_enabled = pin->GetOrAddBoolean("radiation","compton",false);
     if (is_compton_enabled && !(are_units_enabled)) {
       std::cout << "### FATAL ERROR in " << __FILE__ << " at line " << __LINE__
@@ -136,6 +165,83 @@ Radiation::Radiation(MeshBlockPack *ppack, ParameterInput *pin) :
   }
   SetOrthonormalTetrad();
 
+  // Cached frame-transformation tables: tabulate the per-angle tetrad contractions and
+  // the cell-centered metric once at setup (the background is stationary, so they never
+  // change), trading ~4x the memory of i0 for the per-call recompute
+  frame_tables = pin->GetOrAddBoolean("radiation","frame_tables",false);
+  if (frame_tables) {
+    int ncells1 = indcs.nx1 + 2*(indcs.ng);
+    int ncells2 = (indcs.nx2 > 1)? (indcs.nx2 + 2*(indcs.ng)) : 1;
+    int ncells3 = (indcs.nx3 > 1)? (indcs.nx3 + 2*(indcs.ng)) : 1;
+    Kokkos::realloc(n1_x1f,nmb,prgeo->nangles,ncells3,ncells2,ncells1+1);
+    Kokkos::realloc(n2_x2f,nmb,prgeo->nangles,ncells3,ncells2+1,ncells1);
+    Kokkos::realloc(n3_x3f,nmb,prgeo->nangles,ncells3+1,ncells2,ncells1);
+    Kokkos::realloc(n_0_cc,nmb,prgeo->nangles,ncells3,ncells2,ncells1);
+    Kokkos::realloc(gcov_cc,nmb,7,ncells3,ncells2,ncells1);
+    ComputeFrameTables();
+  }
+
+  // Region-adaptive angular resolution: MeshBlocks that are optically thick in every
+  // cell are transported on a coarse subset of angles selected from a companion
+  // geodesic grid (see radiation_coarsen.cpp)
+  angular_coarsening = pin->GetOrAddBoolean("radiation","angular_coarsening",false);
+  if (angular_coarsening) {
+    if (!(rad_source)) {
+      std::cout << "### FATAL ERROR in " << __FILE__ << " at line " << __LINE__
+        << std::endl << "angular_coarsening requires the radiation source term, since "
+        << "the coarsening criterion is built from the opacities" << std::endl;
+      std::exit(EXIT_FAILURE);
+    }
+    if (ppack->pmesh->multilevel) {
+      std::cout << "### FATAL ERROR in " << __FILE__ << " at line " << __LINE__
+        << std::endl << "angular_coarsening does not yet work with SMR" << std::endl;
+      std::exit(EXIT_FAILURE);
+    }
+    int nlevel_coarse = pin->GetOrAddInteger("radiation","coarsen_nlevel",nlevel/2);
+    if ((nlevel_coarse < 1) || (nlevel_coarse >= nlevel)) {
+      std::cout << "### FATAL ERROR in " << __FILE__ << " at line " << __LINE__
+        << std::endl << "<radiation> coarsen_nlevel=" << nlevel_coarse << " must "
+        << "satisfy 0 < coarsen_nlevel < nlevel" << std::endl;
+      std::exit(EXIT_FAILURE);
+    }
+    coarsen_tau = pin->GetOrAddReal("radiation","coarsen_tau",10.0);
+    prgeo_coarse = new GeodesicGrid(nlevel_coarse, rotate_geo, false);
+    BuildAngularHierarchy();
+    Kokkos::realloc(coarse_mb, nmb);
+    Kokkos::deep_copy(coarse_mb, false);
+    // by default the untransported angles are refilled from a linear-in-angle
+    // reconstruction built from the first two angular moments of the bin leaders
+    // (see ProlongateAngles); the compact moment state lives alongside i0
+    coarsen_moments = pin->GetOrAddBoolean("radiation","coarsen_moments",true);
+    if (coarsen_moments) {
+      int ncells1 = indcs.nx1 + 2*(indcs.ng);
+      int ncells2 = (indcs.nx2 > 1)? (indcs.nx2 + 2*(indcs.ng)) : 1;
+      int ncells3 = (indcs.nx3 > 1)? (indcs.nx3 + 2*(indcs.ng)) : 1;
+      Kokkos::realloc(rad_moments,nmb,4,ncells3,ncells2,ncells1);
+    }
+  }
+
+  // Implicit spatial transport: backward Euler over the full dt solved with a
+  // per-MeshBlock matrix-free Krylov method (see radiation_implicit.cpp), removing the
+  // light-crossing limit from the timestep in optically-thick runs
+  implicit_transport = pin->GetOrAddBoolean("radiation","implicit_transport",false);
+  if (implicit_transport) {
+    if (angular_fluxes) {
+      std::cout << "### FATAL ERROR in " << __FILE__ << " at line " << __LINE__
+        << std::endl << "implicit_transport does not support angular fluxes; set "
+        << "<radiation> angular_fluxes = false" << std::endl;
+      std::exit(EXIT_FAILURE);
+    }
+    if (angular_coarsening) {
+      std::cout << "### FATAL ERROR in " << __FILE__ << " at line " << __LINE__
+        << std::endl << "implicit_transport does not work with angular_coarsening"
+        << std::endl;
+      std::exit(EXIT_FAILURE);
+    }
+    implicit_tol = pin->GetOrAddReal("radiation","implicit_tol",1.0e-6);
+    implicit_max_iter = pin->GetOrAddInteger("radiation","implicit_max_iter",100);
+  }
+
   // (3) read time-evolution option [already error checked in driver constructor]
   // Then initialize memory and algorithms for reconstruction and Riemann solvers
   std::string evolution_t = pin->GetString("time","evolution");
@@ -208,6 +314,15 @@ Radiation::Radiation(MeshBlockPack *ppack, ParameterInput *pin) :
     if (beam_source) {
       Kokkos::realloc(beam_mask,nmb,prgeo->nangles,ncells3,ncells2,ncells1);
     }
+    if (implicit_transport) {
+      // five Krylov work vectors (5x the memory of i0); ghost entries are kept at zero
+      // so operator applications see homogeneous off-block couplings
+      Kokkos::realloc(kv_r, nmb,prgeo->nangles,ncells3,ncells2,ncells1);
+      Kokkos::realloc(kv_r0,nmb,prgeo->nangles,ncells3,ncells2,ncells1);
+      Kokkos::realloc(kv_p, nmb,prgeo->nangles,ncells3,ncells2,ncells1);
+      Kokkos::realloc(kv_v, nmb,prgeo->nangles,ncells3,ncells2,ncells1);
+      Kokkos::realloc(kv_t, nmb,prgeo->nangles,ncells3,ncells2,ncells1);
+    }
   }
 }
 
@@ -217,6 +332,7 @@ Radiation::Radiation(MeshBlockPack *ppack, ParameterInput *pin) :
 Radiation::~Radiation() {
   delete pbval_i;
   delete prgeo;
+  if (prgeo_coarse != nullptr) {delete prgeo_coarse;}
   if (psrc != nullptr) {delete psrc;}
 }
 
@@ -16,6 +16,7 @@
 #include "parameter_input.hpp"
 #include "tasklist/task_list.hpp"
 #include "bvals/bvals.hpp"
+#include "radiation/radiation_opacities.hpp"
 
 // forward declarations
 class EquationOfState;
@@ -74,6 +75,7 @@ struct RadiationTaskIDs {
   TaskID rad_crecv;
   TaskID mhd_crecv;
   TaskID hyd_crecv;
+  TaskID rad_implicit;
 };
 
 namespace radiation {
@@ -100,6 +102,9 @@ class Radiation {
   Real kappa_s;             // constant scattering coefficient
   Real kappa_p;             // Planck - Rosseland mean coefficient
   bool power_opacity;       // flag to enable Kramer's law opacity for kappa_a
+  bool table_opacity;       // flag to enable tabulated Rosseland/Planck opacities
+  OpacityTable opacity_table;  // tabulated opacities (see radiation_opacities.hpp)
+  void LoadOpacityTable(ParameterInput *pin);
   bool is_compton_enabled;  // flag to enable/disable compton
 
   // Extra physics (i.e., other srcterms)
@@ -112,6 +117,19 @@ class Radiation {
   Real n_0_floor;                     // floor on n_0
   GeodesicGrid *prgeo = nullptr;      // pointer to radiation angular mesh
 
+  // Region-adaptive angular resolution
+  bool angular_coarsening;            // transport optically thick blocks w/ fewer angles
+  bool coarsen_moments;               // moment-preserving refill of untransported angles
+  Real coarsen_tau;                   // cell optical depth above which a block coarsens
+  GeodesicGrid *prgeo_coarse = nullptr;  // coarse companion angular mesh
+  DualArray1D<int> ang_leader;        // angle transported on behalf of each angle's bin
+  DualArray1D<Real> ang_bin_wght;     // total solid angle of each angle's bin
+  DvceArray1D<bool> coarse_mb;        // flags MeshBlocks currently using coarse angles
+  DvceArray5D<Real> rad_moments;      // zeroth/first angular moments on coarse blocks
+  void BuildAngularHierarchy();
+  void SetCoarseningMask();
+  void ProlongateAngles(DevExeSpace exec);
+
   // Tetrad arrays and functions
   DualArray2D<Real> nh_c;             // normal vector computed at face center
   DualArray3D<Real> nh_f;             // normal vector computed at face edges
@@ -124,6 +142,36 @@ class Radiation {
   DvceArray6D<Real> norm_to_tet;      // used in transform b/w normal frame and tet frame
   void SetOrthonormalTetrad();
 
+  // Cached frame-transformation tables.  On stationary backgrounds the per-angle
+  // contractions of the tetrad with nh_c (and the metric itself) never change, so they
+  // can be tabulated once at setup instead of recomputed in every flux/source call
+  bool frame_tables;                  // flag to enable the cached tables
+  DvceArray5D<Real> n1_x1f;           // n^1 at x1 faces for each angle
+  DvceArray5D<Real> n2_x2f;           // n^2 at x2 faces for each angle
+  DvceArray5D<Real> n3_x3f;           // n^3 at x3 faces for each angle
+  DvceArray5D<Real> n_0_cc;           // n_0 at cell centers for each angle
+  DvceArray5D<Real> gcov_cc;          // lapse and spatial metric at cell centers
+  void ComputeFrameTables();
+
+  // Implicit spatial transport: once per cycle the intensity update over the full dt is
+  // advanced with backward Euler, solved with a matrix-free Krylov method (BiCGStab)
+  // whose operator is the first-order upwind flux divergence built from the same
+  // face-normal components n^i as the explicit fluxes.  The operator is block-diagonal
+  // over MeshBlocks (ghost intensities are held at their last exchanged values, i.e.
+  // block-Jacobi coupling across MeshBlock boundaries), so the solves for all blocks
+  // batch into single device kernels and the light-crossing limit no longer applies to
+  // the timestep (see radiation_implicit.cpp)
+  bool implicit_transport;       // flag to replace explicit transport with the solve
+  Real implicit_tol;             // relative residual tolerance of the Krylov solve
+  int implicit_max_iter;         // maximum Krylov iterations per solve
+  DvceArray5D<Real> kv_r;        // Krylov work vectors (ghost entries always zero)
+  DvceArray5D<Real> kv_r0;
+  DvceArray5D<Real> kv_p;
+  DvceArray5D<Real> kv_v;
+  DvceArray5D<Real> kv_t;
+  void ImplicitOpApply(const DvceArray5D<Real> &x, const DvceArray5D<Real> &y, Real dt);
+  Real ImplicitDot(const DvceArray5D<Real> &x, const DvceArray5D<Real> &y);
+
   // intensity arrays
   DvceArray5D<Real> i0;         // intensities
   DvceArray5D<Real> coarse_i0;  // intensities on 2x coarser grid (for SMR/AMR)
@@ -164,6 +212,8 @@ class Radiation {
   // ...in "after_stagen_tl" task list
   TaskStatus ClearSend(Driver *d, int stage);
   TaskStatus ClearRecv(Driver *d, int stage);
+  // ...in "after_timeintegrator" task list
+  TaskStatus ImplicitTransportUpdate(Driver *d, int stage);
 
  private:
   MeshBlockPack* pmy_pack;  // ptr to MeshBlockPack containing this Radiation
@@ -0,0 +1,260 @@
+//========================================================================================
+// AthenaXXX astrophysical plasma code
+// Copyright(C) 2020 James M. Stone <jmstone@ias.edu> and the Athena code team
+// Licensed under the 3-clause BSD License (the "LICENSE")
+//========================================================================================
+//! \file radiation_coarsen.cpp
+//! \brief Implements region-adaptive angular resolution for radiation.  MeshBlocks that
+//! are optically thick in every cell carry a nearly isotropic radiation field, so they
+//! are transported on a coarse subset of angles ("bin leaders") selected from a
+//! companion geodesic grid; the remaining angles in each bin are refilled from their
+//! leader after each RK update.  Intensity storage stays at the fine angular resolution
+//! on every MeshBlock, so boundary communication is unchanged.
+
+#include <float.h>
+
+#include <vector>
+
+#include "athena.hpp"
+#include "mesh/mesh.hpp"
+#include "eos/eos.hpp"
+#include "hydro/hydro.hpp"
+#include "mhd/mhd.hpp"
+#include "units/units.hpp"
+#include "geodesic-grid/geodesic_grid.hpp"
+#include "radiation.hpp"
+#include "radiation/radiation_opacities.hpp"
+
+namespace radiation {
+//----------------------------------------------------------------------------------------
+//! \fn void Radiation::BuildAngularHierarchy()
+//! \brief Bins each angle of the fine geodesic grid with the nearest direction on the
+//! coarse companion grid, and selects the bin leader (the fine angle closest to the
+//! coarse direction) that is transported on behalf of the bin in coarsened MeshBlocks.
+//! Runs once on the host at setup.
+
+void Radiation::BuildAngularHierarchy() {
+  int naf = prgeo->nangles;
+  int nac = prgeo_coarse->nangles;
+  auto &posf = prgeo->cart_pos;
+  auto &posc = prgeo_coarse->cart_pos;
+
+  // bin each fine angle with the coarse direction of largest dot product (angle centers
+  // are unit vectors on both grids)
+  std::vector<int> parent(naf);
+  for (int n=0; n<naf; ++n) {
+    Real dot_max = -(FLT_MAX);
+    for (int c=0; c<nac; ++c) {
+      Real dot = posf.h_view(n,0)*posc.h_view(c,0) + posf.h_view(n,1)*posc.h_view(c,1)
+               + posf.h_view(n,2)*posc.h_view(c,2);
+      if (dot > dot_max) {
+        dot_max = dot;
+        parent[n] = c;
+      }
+    }
+  }
+
+  // within each bin, the leader is the fine angle closest to the coarse direction
+  std::vector<int> leader(nac, -1);
+  std::vector<Real> best(nac, -(FLT_MAX));
+  for (int n=0; n<naf; ++n) {
+    int c = parent[n];
+    Real dot = posf.h_view(n,0)*posc.h_view(c,0) + posf.h_view(n,1)*posc.h_view(c,1)
+             + posf.h_view(n,2)*posc.h_view(c,2);
+    if (dot > best[c]) {
+      best[c] = dot;
+      leader[c] = n;
+    }
+  }
+
+  // store the leader of each fine angle's bin (an angle is a leader iff it maps to
+  // itself)
+  Kokkos::realloc(ang_leader, naf);
+  for (int n=0; n<naf; ++n) {
+    ang_leader.h_view(n) = leader[parent[n]];
+  }
+  ang_leader.template modify<HostMemSpace>();
+  ang_leader.template sync<DevExeSpace>();
+
+  // total solid angle of each angle's bin, used to weight the bin leaders when
+  // computing angular moments of the coarse representation (see ProlongateAngles)
+  auto &solidf = prgeo->solid_angles;
+  std::vector<Real> binw(nac, 0.0);
+  for (int n=0; n<naf; ++n) {binw[parent[n]] += solidf.h_view(n);}
+  Kokkos::realloc(ang_bin_wght, naf);
+  for (int n=0; n<naf; ++n) {ang_bin_wght.h_view(n) = binw[parent[n]];}
+  ang_bin_wght.template modify<HostMemSpace>();
+  ang_bin_wght.template sync<DevExeSpace>();
+  return;
+}
+
+//----------------------------------------------------------------------------------------
+//! \fn void Radiation::SetCoarseningMask()
+//! \brief Flags MeshBlocks to be transported with coarse angles.  A block is coarsened
+//! only if the optical depth across every one of its active cells exceeds coarsen_tau,
+//! computed from the same opacities used by the radiation source term.
+
+void Radiation::SetCoarseningMask() {
+  auto &indcs = pmy_pack->pmesh->mb_indcs;
+  int &is = indcs.is, &ie = indcs.ie;
+  int &js = indcs.js, &je = indcs.je;
+  int &ks = indcs.ks, &ke = indcs.ke;
+  int nmb1 = pmy_pack->nmb_thispack - 1;
+  auto &size = pmy_pack->pmb->mb_size;
+  bool &multi_d = pmy_pack->pmesh->multi_d;
+  bool &three_d = pmy_pack->pmesh->three_d;
+
+  // Extract units (same conventions as AddRadiationSourceTerm)
+  Real density_scale_ = 1.0, temperature_scale_ = 1.0, length_scale_ = 1.0;
+  Real mean_mol_weight_ = 1.0;
+  Real rosseland_coef_ = 1.0, planck_minus_rosseland_coef_ = 0.0;
+  if (are_units_enabled) {
+    density_scale_ = pmy_pack->punit->density_cgs();
+    temperature_scale_ = pmy_pack->punit->temperature_cgs();
+    length_scale_ = pmy_pack->punit->length_cgs();
+    mean_mol_weight_ = pmy_pack->punit->mu();
+    rosseland_coef_ = pmy_pack->punit->rosseland_coef_cgs;
+    planck_minus_rosseland_coef_ = pmy_pack->punit->planck_minus_rosseland_coef_cgs;
+  }
+
+  // Extract adiabatic index and primitives
+  Real gm1;
+  DvceArray5D<Real> w0_;
+  if (is_hydro_enabled) {
+    gm1 = pmy_pack->phydro->peos->eos_data.gamma - 1.0;
+    w0_ = pmy_pack->phydro->w0;
+  } else {
+    gm1 = pmy_pack->pmhd->peos->eos_data.gamma - 1.0;
+    w0_ = pmy_pack->pmhd->w0;
+  }
+
+  // Extract opacity parameters
+  Real &kappa_a_ = kappa_a;
+  Real &kappa_s_ = kappa_s;
+  Real &kappa_p_ = kappa_p;
+  bool &power_opacity_ = power_opacity;
+  bool &table_opacity_ = table_opacity;
+  auto otab_ = opacity_table;
+  Real &coarsen_tau_ = coarsen_tau;
+
+  // flag blocks containing any optically thin cell.  Concurrent writers all store the
+  // same value, so plain stores are safe here
+  DvceArray1D<int> thin_flag("thin_flag", nmb1+1);
+  Kokkos::deep_copy(thin_flag, 0);
+  par_for("rcoarsen_tau",DevExeSpace(),0,nmb1,ks,ke,js,je,is,ie,
+  KOKKOS_LAMBDA(int m, int k, int j, int i) {
+    Real dens = w0_(m,IDN,k,j,i);
+    Real temp = gm1*w0_(m,IEN,k,j,i)/dens;
+    Real sigma_a, sigma_s, sigma_p;
+    if (table_opacity_) {
+      TableOpacityFunction(dens, density_scale_, temp, temperature_scale_,
+                           length_scale_, gm1, mean_mol_weight_, otab_, kappa_s_,
+                           sigma_a, sigma_s, sigma_p);
+    } else {
+      OpacityFunction(dens, density_scale_, temp, temperature_scale_,
+                      length_scale_, gm1, mean_mol_weight_, power_opacity_,
+                      rosseland_coef_, planck_minus_rosseland_coef_,
+                      kappa_a_, kappa_s_, kappa_p_, sigma_a, sigma_s, sigma_p);
+    }
+    Real dx = size.d_view(m).dx1;
+    if (multi_d) {dx = fmin(dx, size.d_view(m).dx2);}
+    if (three_d) {dx = fmin(dx, size.d_view(m).dx3);}
+    if ((sigma_a + sigma_s)*dx <= coarsen_tau_) {thin_flag(m) = 1;}
+  });
+
+  // a MeshBlock is transported with coarse angles only if all of its cells are thick
+  auto &coarse_mb_ = coarse_mb;
+  par_for("rcoarsen_mask",DevExeSpace(),0,nmb1,
+  KOKKOS_LAMBDA(int m) {
+    coarse_mb_(m) = (thin_flag(m) == 0);
+  });
+  return;
+}
+
+//----------------------------------------------------------------------------------------
+//! \fn void Radiation::ProlongateAngles()
+//! \brief Refills the angles not transported in coarsened MeshBlocks after an update.
+//! By default the zeroth and first angular moments of the bin leaders are computed into
+//! rad_moments, and siblings are set from the linear-in-angle reconstruction
+//! I(n) = I_lead + (3/4pi) F.(n - n_lead), so coarsened blocks preserve both the energy
+//! density and the flux of the radiation field; with coarsen_moments=false the refill
+//! is piecewise constant in angle and only the zeroth moment survives.
+
+void Radiation::ProlongateAngles(DevExeSpace exec) {
+  auto &indcs = pmy_pack->pmesh->mb_indcs;
+  int &is = indcs.is, &ie = indcs.ie;
+  int &js = indcs.js, &je = indcs.je;
+  int &ks = indcs.ks, &ke = indcs.ke;
+  int nang = prgeo->nangles;
+  int nang1 = nang - 1;
+  int nmb1 = pmy_pack->nmb_thispack - 1;
+  auto &i0_ = i0;
+  auto &coarse_mb_ = coarse_mb;
+  auto &lead_ = ang_leader;
+
+  // piecewise constant prolongation in angle
+  if (!(coarsen_moments)) {
+    par_for("r_prol_angle",exec,0,nmb1,0,nang1,ks,ke,js,je,is,ie,
+    KOKKOS_LAMBDA(int m, int n, int k, int j, int i) {
+      if (coarse_mb_(m) && (lead_.d_view(n) != n)) {
+        i0_(m,n,k,j,i) = i0_(m,lead_.d_view(n),k,j,i);
+      }
+    });
+    return;
+  }
+
+  auto &nh_c_ = nh_c;
+  auto &tt = tet_c;
+  auto &tc = tetcov_c;
+  bool &tables_ = frame_tables;
+  auto &n_0_cc_ = n_0_cc;
+  auto &binw_ = ang_bin_wght;
+  auto &mom_ = rad_moments;
+
+  // zeroth and first angular moments of the coarse representation, summing the bin
+  // leaders weighted by the total solid angle of their bin
+  par_for("r_coarse_mom",exec,0,nmb1,ks,ke,js,je,is,ie,
+  KOKKOS_LAMBDA(int m, int k, int j, int i) {
+    if (!(coarse_mb_(m))) {return;}
+    Real n0 = tt(m,0,0,k,j,i);
+    Real er = 0.0, f1 = 0.0, f2 = 0.0, f3 = 0.0;
+    for (int n=0; n<nang; ++n) {
+      if (lead_.d_view(n) != n) {continue;}
+      Real n_0 = (tables_)? n_0_cc_(m,n,k,j,i) :
+                 (tc(m,0,0,k,j,i)*nh_c_.d_view(n,0) + tc(m,1,0,k,j,i)*nh_c_.d_view(n,1) +
+                  tc(m,2,0,k,j,i)*nh_c_.d_view(n,2) + tc(m,3,0,k,j,i)*nh_c_.d_view(n,3));
+      Real wi = binw_.d_view(n)*(i0_(m,n,k,j,i)/(n0*n_0));
+      er += wi;
+      f1 += wi*nh_c_.d_view(n,1);
+      f2 += wi*nh_c_.d_view(n,2);
+      f3 += wi*nh_c_.d_view(n,3);
+    }
+    mom_(m,0,k,j,i) = er;
+    mom_(m,1,k,j,i) = f1;
+    mom_(m,2,k,j,i) = f2;
+    mom_(m,3,k,j,i) = f3;
+  });
+
+  // refill siblings from the linear-in-angle reconstruction anchored at their leader
+  par_for("r_prol_angle",exec,0,nmb1,0,nang1,ks,ke,js,je,is,ie,
+  KOKKOS_LAMBDA(int m, int n, int k, int j, int i) {
+    if (!(coarse_mb_(m)) || (lead_.d_view(n) == n)) {return;}
+    int nl = lead_.d_view(n);
+    Real n0 = tt(m,0,0,k,j,i);
+    Real n_0l = (tables_)? n_0_cc_(m,nl,k,j,i) :
+                (tc(m,0,0,k,j,i)*nh_c_.d_view(nl,0) + tc(m,1,0,k,j,i)*nh_c_.d_view(nl,1) +
+                 tc(m,2,0,k,j,i)*nh_c_.d_view(nl,2) + tc(m,3,0,k,j,i)*nh_c_.d_view(nl,3));
+    Real n_0n = (tables_)? n_0_cc_(m,n,k,j,i) :
+                (tc(m,0,0,k,j,i)*nh_c_.d_view(n,0) + tc(m,1,0,k,j,i)*nh_c_.d_view(n,1) +
+                 tc(m,2,0,k,j,i)*nh_c_.d_view(n,2) + tc(m,3,0,k,j,i)*nh_c_.d_view(n,3));
+    Real iil = i0_(m,nl,k,j,i)/(n0*n_0l);
+    Real corr = 3.0/(4.0*M_PI)*
+        (mom_(m,1,k,j,i)*(nh_c_.d_view(n,1) - nh_c_.d_view(nl,1)) +
+         mom_(m,2,k,j,i)*(nh_c_.d_view(n,2) - nh_c_.d_view(nl,2)) +
+         mom_(m,3,k,j,i)*(nh_c_.d_view(n,3) - nh_c_.d_view(nl,3)));
+    i0_(m,n,k,j,i) = n0*n_0n*fmax(iil + corr, 0.0);
+  });
+  return;
+}
+
+} // namespace radiation
@@ -25,6 +25,10 @@ namespace radiation {
 //! \brief Compute radiation fluxes
 
 TaskStatus Radiation::CalculateFluxes(Driver *pdriver, int stage) {
+  // with implicit transport, spatial fluxes are handled by the operator-split
+  // backward-Euler solve in ImplicitTransportUpdate
+  if (implicit_transport) {return TaskStatus::complete;}
+
   RegionIndcs &indcs = pmy_pack->pmesh->mb_indcs;
   int &is = indcs.is, &ie = indcs.ie;
   int &js = indcs.js, &je = indcs.je;
@@ -38,16 +42,39 @@ TaskStatus Radiation::CalculateFluxes(Driver *pdriver, int stage) {
   auto &nh_c_ = nh_c;
   auto &tet_c_ = tet_c;
 
+  // with angular coarsening, refresh the per-MeshBlock mask from the fluid state at
+  // the start of each cycle; only bin-leader angles are transported in blocks flagged
+  // optically thick (siblings are refilled from their leader after the RK update)
+  if (angular_coarsening && (stage == 1)) {
+    SetCoarseningMask();
+  }
+  bool &coarsen_ = angular_coarsening;
+  auto &coarse_mb_ = coarse_mb;
+  auto &lead_ = ang_leader;
+
+  // cached frame-transformation tables (see ComputeFrameTables)
+  bool &tables_ = frame_tables;
+  auto &n1_x1f_ = n1_x1f;
+  auto &n2_x2f_ = n2_x2f;
+  auto &n3_x3f_ = n3_x3f;
+
+  // stream this task was launched on (default instance unless task flagged async)
+  DevExeSpace exec = pdriver->ExecSpace();
+
   //--------------------------------------------------------------------------------------
   // i-direction
 
   auto &t1d1 = tet_d1_x1f;
   auto &flx1 = iflx.x1f;
-  par_for("rflux_x1",DevExeSpace(),0,nmb1,0,nang1,ks,ke,js,je,is,ie+1,
+  par_for("rflux_x1",exec,0,nmb1,0,nang1,ks,ke,js,je,is,ie+1,
   KOKKOS_LAMBDA(int m, int n, int k, int j, int i) {
+    // skip angles not transported in coarsened MeshBlocks
+    if (coarsen_ && coarse_mb_(m) && (lead_.d_view(n) != n)) {return;}
+
     // calculate n^1 (hence determining upwinding direction)
-    Real n1 = t1d1(m,0,k,j,i)*nh_c_.d_view(n,0) + t1d1(m,1,k,j,i)*nh_c_.d_view(n,1)
-            + t1d1(m,2,k,j,i)*nh_c_.d_view(n,2) + t1d1(m,3,k,j,i)*nh_c_.d_view(n,3);
+    Real n1 = (tables_)? n1_x1f_(m,n,k,j,i) :
+              (t1d1(m,0,k,j,i)*nh_c_.d_view(n,0) + t1d1(m,1,k,j,i)*nh_c_.d_view(n,1)
+             + t1d1(m,2,k,j,i)*nh_c_.d_view(n,2) + t1d1(m,3,k,j,i)*nh_c_.d_view(n,3));
 
     // convert to primitive n_0 I
     Real iim1, iicc, iim2, iip1, iim3, iip2;
@@ -99,11 +126,15 @@ TaskStatus Radiation::CalculateFluxes(Driver *pdriver, int stage) {
   if (pmy_pack->pmesh->multi_d) {
     auto &t2d2 = tet_d2_x2f;
     auto &flx2 = iflx.x2f;
-    par_for("rflux_x2",DevExeSpace(),0,nmb1,0,nang1,ks,ke,js,je+1,is,ie,
+    par_for("rflux_x2",exec,0,nmb1,0,nang1,ks,ke,js,je+1,is,ie,
     KOKKOS_LAMBDA(int m, int n, int k, int j, int i) {
+      // skip angles not transported in coarsened MeshBlocks
+      if (coarsen_ && coarse_mb_(m) && (lead_.d_view(n) != n)) {return;}
+
       // calculate n^2 (hence determining upwinding direction)
-      Real n2 = t2d2(m,0,k,j,i)*nh_c_.d_view(n,0) + t2d2(m,1,k,j,i)*nh_c_.d_view(n,1)
-              + t2d2(m,2,k,j,i)*nh_c_.d_view(n,2) + t2d2(m,3,k,j,i)*nh_c_.d_view(n,3);
+      Real n2 = (tables_)? n2_x2f_(m,n,k,j,i) :
+                (t2d2(m,0,k,j,i)*nh_c_.d_view(n,0) + t2d2(m,1,k,j,i)*nh_c_.d_view(n,1)
+               + t2d2(m,2,k,j,i)*nh_c_.d_view(n,2) + t2d2(m,3,k,j,i)*nh_c_.d_view(n,3));
 
       // convert to primitive n_0 I
       Real iim1, iicc, iim2, iip1, iim3, iip2;
@@ -156,11 +187,15 @@ TaskStatus Radiation::CalculateFluxes(Driver *pdriver, int stage) {
   if (pmy_pack->pmesh->three_d) {
     auto &t3d3 = tet_d3_x3f;
     auto &flx3 = iflx.x3f;
-    par_for("rflux_x3",DevExeSpace(),0,nmb1,0,nang1,ks,ke+1,js,je,is,ie,
+    par_for("rflux_x3",exec,0,nmb1,0,nang1,ks,ke+1,js,je,is,ie,
     KOKKOS_LAMBDA(int m, int n, int k, int j, int i) {
+      // skip angles not transported in coarsened MeshBlocks
+      if (coarsen_ && coarse_mb_(m) && (lead_.d_view(n) != n)) {return;}
+
       // calculate n^3 (hence determining upwinding direction)
-      Real n3 = t3d3(m,0,k,j,i)*nh_c_.d_view(n,0) + t3d3(m,1,k,j,i)*nh_c_.d_view(n,1)
-              + t3d3(m,2,k,j,i)*nh_c_.d_view(n,2) + t3d3(m,3,k,j,i)*nh_c_.d_view(n,3);
+      Real n3 = (tables_)? n3_x3f_(m,n,k,j,i) :
+                (t3d3(m,0,k,j,i)*nh_c_.d_view(n,0) + t3d3(m,1,k,j,i)*nh_c_.d_view(n,1)
+               + t3d3(m,2,k,j,i)*nh_c_.d_view(n,2) + t3d3(m,3,k,j,i)*nh_c_.d_view(n,3));
 
       // convert to primitive n_0 I
       Real iim1, iicc, iim2, iip1, iim3, iip2;
@@ -211,24 +246,29 @@ TaskStatus Radiation::CalculateFluxes(Driver *pdriver, int stage) {
   // Angular Fluxes
 
   if (angular_fluxes) {
-    auto &numn = prgeo->num_neighbors;
-    auto &indn = prgeo->ind_neighbors;
-    auto &arcl = prgeo->arc_lengths;
-    auto &solid_angles_ = prgeo->solid_angles;
+    // angular connectivity in CSR format, with (arc length)/(solid angle) edge weights
+    auto &nptr = prgeo->nghbr_ptr;
+    auto &nind = prgeo->nghbr_ind;
+    auto &nwght = prgeo->nghbr_wght;
 
     auto &na_ = na;
     auto &divfa_ = divfa;
 
-    par_for("rflux_angular",DevExeSpace(),0,nmb1,0,nang1,ks,ke,js,je,is,ie,
+    par_for("rflux_angular",exec,0,nmb1,0,nang1,ks,ke,js,je,is,ie,
     KOKKOS_LAMBDA(int m, int n, int k, int j, int i) {
-      divfa_(m,n,k,j,i) = 0.0;
-      for (int nb=0; nb<numn.d_view(n); ++nb) {
-        Real flx_edge = na_(m,n,k,j,i,nb) *
-                        ((na_(m,n,k,j,i,nb) < 0.0) ?
-                         i0_(m,indn.d_view(n,nb),k,j,i)/tet_c_(m,0,0,k,j,i) :
-                         i0_(m,n,k,j,i)/tet_c_(m,0,0,k,j,i));
-        divfa_(m,n,k,j,i) += (arcl.d_view(n,nb)*flx_edge/solid_angles_.d_view(n));
+      // skip angles not transported in coarsened MeshBlocks
+      if (coarsen_ && coarse_mb_(m) && (lead_.d_view(n) != n)) {return;}
+
+      const int es = nptr.d_view(n), ee = nptr.d_view(n+1);
+      const Real iicc = i0_(m,n,k,j,i);
+      Real divf = 0.0;
+      for (int e=es; e<ee; ++e) {
+        Real na_edge = na_(m,n,k,j,i,e-es);
+        divf += nwght.d_view(e)*na_edge*
+                ((na_edge < 0.0)? i0_(m,nind.d_view(e),k,j,i) : iicc);
       }
+      // single conversion to primitive n_0 I (same tetrad factor applies to all edges)
+      divfa_(m,n,k,j,i) = divf/tet_c_(m,0,0,k,j,i);
     });
   }
 
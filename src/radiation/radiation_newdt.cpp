@@ -31,6 +31,13 @@ namespace radiation {
 //        Only computed once at beginning of calculation.
 
 TaskStatus Radiation::NewTimeStep(Driver *pdriver, int stage) {
+  // with implicit transport the light-crossing limit does not apply; the timestep is
+  // then set by the fluid (or by the <time> block)
+  if (implicit_transport) {
+    dtnew = static_cast<Real>(std::numeric_limits<float>::max());
+    return TaskStatus::complete;
+  }
+
   auto &indcs = pmy_pack->pmesh->mb_indcs;
   int &is = indcs.is, &nx1 = indcs.nx1;
   int &js = indcs.js, &nx2 = indcs.nx2;
@@ -55,22 +62,35 @@ TaskStatus Radiation::NewTimeStep(Driver *pdriver, int stage) {
   auto &tet_c_ = tet_c;
   auto &excise = pmy_pack->pcoord->coord_data.bh_excise;
   auto &rad_mask_ = pmy_pack->pcoord->excision_floor;
+  auto &mb_excised_ = pmy_pack->pcoord->mb_excised;
   auto &numn = prgeo->num_neighbors;
   auto &indn = prgeo->ind_neighbors;
 
-  // find smallest (dx/c) and (dangle/na) in each direction for radiation problems
-  Kokkos::parallel_reduce("RadiationNudt",Kokkos::RangePolicy<>(DevExeSpace(), 0, nmkji),
-  KOKKOS_LAMBDA(const int &idx,Real &min_dt1,Real &min_dt2,Real &min_dt3,Real &min_dta) {
-    // compute m,k,j,i indices of thread and call function
-    int m = (idx)/nkji;
-    int k = (idx - m*nkji)/nji;
-    int j = (idx - m*nkji - k*nji)/nx1;
-    int i = (idx - m*nkji - k*nji - j*nx1) + is;
-    k += ks;
-    j += js;
+  if (!angular_fluxes_) {
+    // without angular fluxes the timestep depends only on the MeshBlock sizes, so
+    // reduce over blocks, not cells
+    const int nmb = pmy_pack->nmb_thispack;
+    Kokkos::parallel_reduce("RadiationNudt",Kokkos::RangePolicy<>(DevExeSpace(), 0, nmb),
+    KOKKOS_LAMBDA(const int &m, Real &min_dt1, Real &min_dt2, Real &min_dt3) {
+      min_dt1 = fmin((size.d_view(m).dx1), min_dt1);
+      min_dt2 = fmin((size.d_view(m).dx2), min_dt2);
+      min_dt3 = fmin((size.d_view(m).dx3), min_dt3);
+    }, Kokkos::Min<Real>(dt1),  Kokkos::Min<Real>(dt2), Kokkos::Min<Real>(dt3));
+  } else {
+    // find smallest (dx/c) and (dangle/na) in each direction for radiation problems
+    Kokkos::parallel_reduce("RadiationNudt",
+                            Kokkos::RangePolicy<>(DevExeSpace(), 0, nmkji),
+    KOKKOS_LAMBDA(const int &idx,Real &min_dt1,Real &min_dt2,Real &min_dt3,
+                  Real &min_dta) {
+      // compute m,k,j,i indices of thread and call function
+      int m = (idx)/nkji;
+      int k = (idx - m*nkji)/nji;
+      int j = (idx - m*nkji - k*nji)/nx1;
+      int i = (idx - m*nkji - k*nji - j*nx1) + is;
+      k += ks;
+      j += js;
 
-    Real tmp_min_dta = (FLT_MAX);
-    if (angular_fluxes_) {
+      Real tmp_min_dta = (FLT_MAX);
       for (int n=0; n<=nang1; ++n) {
         // find position at angle center
         Real x = nh_c_.d_view(n,1);
@@ -85,20 +105,20 @@ TaskStatus Radiation::NewTimeStep(Driver *pdriver, int stage) {
           Real n0 = tet_c_(m,0,0,k,j,i);
           Real adt = fmin(tmp_min_dta,(acos(x*xn+y*yn+z*zn)/fabs(na_(m,n,k,j,i,nb)/n0)));
           // set timestep limitation if not excising this cell
-          if (excise) {
+          if (excise && mb_excised_(m)) {
             if (!(rad_mask_(m,k,j,i))) { tmp_min_dta = adt; }
           } else {
             tmp_min_dta = adt;
           }
         }
       }
-    }
-    min_dt1 = fmin((size.d_view(m).dx1), min_dt1);
-    min_dt2 = fmin((size.d_view(m).dx2), min_dt2);
-    min_dt3 = fmin((size.d_view(m).dx3), min_dt3);
-    min_dta = fmin((tmp_min_dta),        min_dta);
-  }, Kokkos::Min<Real>(dt1),  Kokkos::Min<Real>(dt2), Kokkos::Min<Real>(dt3),
-     Kokkos::Min<Real>(dta));
+      min_dt1 = fmin((size.d_view(m).dx1), min_dt1);
+      min_dt2 = fmin((size.d_view(m).dx2), min_dt2);
+      min_dt3 = fmin((size.d_view(m).dx3), min_dt3);
+      min_dta = fmin((tmp_min_dta),        min_dta);
+    }, Kokkos::Min<Real>(dt1),  Kokkos::Min<Real>(dt2), Kokkos::Min<Real>(dt3),
+       Kokkos::Min<Real>(dta));
+  }
 
   // compute minimum of dt1/dt2/dt3 for 1D/2D/3D problems
   dtnew = dt1;
@@ -45,4 +45,61 @@ void OpacityFunction(// density and density scale
   return;
 }
 
+//----------------------------------------------------------------------------------------
+//! \struct OpacityTable
+//! \brief device-copyable container for tabulated Rosseland/Planck absorption opacities.
+//! Tables store log10(kappa [cm^2/g]) on a uniform (log10 rho, log10 T) grid in cgs
+//! units; the grid origin and inverse spacing allow direct index computation in kernels
+//! (no search).  Loaded from file at startup by Radiation::LoadOpacityTable().
+
+struct OpacityTable {
+  int nd=0, nt=0;          // number of density and temperature grid points
+  Real ld0=0.0, idld=0.0;  // log10(rho [g/cm^3]) of first point, inverse grid spacing
+  Real lt0=0.0, idlt=0.0;  // log10(T [K]) of first point, inverse grid spacing
+  DvceArray2D<Real> lkr;   // log10(Rosseland mean kappa), indexed (density,temperature)
+  DvceArray2D<Real> lkp;   // log10(Planck mean kappa), indexed (density,temperature)
+};
+
+//----------------------------------------------------------------------------------------
+//! \fn void TableOpacityFunction
+//! \brief sets sigma_a, sigma_s, sigma_p from tabulated opacities using clamped log-log
+//! bilinear interpolation.  Uses the same temperature convention as the power-law branch
+//! of OpacityFunction above; scattering remains the constant coefficient k_s.
+
+KOKKOS_INLINE_FUNCTION
+void TableOpacityFunction(// density and density scale
+                          const Real dens, const Real density_scale,
+                          // temperature and temperature scale
+                          const Real temp, const Real temperature_scale,
+                          // length scale, adiabatic index minus one, mean mol weight
+                          const Real length_scale, const Real gm1, const Real mu,
+                          // opacity table and constant scattering opacity
+                          const OpacityTable &tab, const Real k_s,
+                          // output sigma
+                          Real& sigma_a, Real& sigma_s, Real& sigma_p) {
+  // fractional grid coordinates, clamped to the table edges
+  Real xd = (log10(dens*density_scale) - tab.ld0)*tab.idld;
+  Real xt = (log10(temp*temperature_scale/(gm1*mu)) - tab.lt0)*tab.idlt;
+  xd = fmin(fmax(xd, 0.0), static_cast<Real>(tab.nd-1));
+  xt = fmin(fmax(xt, 0.0), static_cast<Real>(tab.nt-1));
+  int id = static_cast<int>(xd);
+  int it = static_cast<int>(xt);
+  if (id > (tab.nd-2)) {id = tab.nd-2;}
+  if (it > (tab.nt-2)) {it = tab.nt-2;}
+  Real fd = xd - static_cast<Real>(id);
+  Real ft = xt - static_cast<Real>(it);
+
+  // bilinear interpolation of log10(kappa)
+  Real lkr = (1.0-fd)*((1.0-ft)*tab.lkr(id  ,it) + ft*tab.lkr(id  ,it+1))
+           +      fd *((1.0-ft)*tab.lkr(id+1,it) + ft*tab.lkr(id+1,it+1));
+  Real lkp = (1.0-fd)*((1.0-ft)*tab.lkp(id  ,it) + ft*tab.lkp(id  ,it+1))
+           +      fd *((1.0-ft)*tab.lkp(id+1,it) + ft*tab.lkp(id+1,it+1));
+  Real k_a_r = pow(10.0, lkr);
+  Real k_a_p = pow(10.0, lkp) - k_a_r;  // sigma_p stores (Planck - Rosseland)
+  sigma_a = dens*k_a_r*density_scale*length_scale;
+  sigma_p = dens*k_a_p*density_scale*length_scale;
+  sigma_s = dens*k_s  *density_scale*length_scale;
+  return;
+}
+
 #endif // RADIATION_RADIATION_OPACITIES_HPP_
@@ -0,0 +1,129 @@
+//========================================================================================
+// AthenaXXX astrophysical plasma code
+// Copyright(C) 2020 James M. Stone <jmstone@ias.edu> and the Athena code team
+// Licensed under the 3-clause BSD License (the "LICENSE")
+//========================================================================================
+//! \file radiation_opacity_table.cpp
+//! \brief reads tabulated Rosseland/Planck mean opacities into device arrays at startup
+
+#include <math.h>
+
+#include <fstream>
+#include <iostream>
+#include <sstream>
+#include <string>
+#include <vector>
+
+#include "athena.hpp"
+#include "parameter_input.hpp"
+#include "mesh/mesh.hpp"
+#include "radiation/radiation.hpp"
+#include "radiation/radiation_opacities.hpp"
+
+namespace radiation {
+
+//----------------------------------------------------------------------------------------
+//! \fn void Radiation::LoadOpacityTable()
+//! \brief Reads the opacity table file named by <radiation>/opacity_table into the
+//! OpacityTable device arrays used by TableOpacityFunction().  The file is plain ASCII
+//! (lines starting with '#' are comments): first the grid dimensions "nd nt", then nd
+//! values of log10(rho [g/cm^3]), then nt values of log10(T [K]), then nd rows of nt
+//! values of log10(Rosseland mean kappa [cm^2/g]), then the same for the Planck mean.
+//! Both axes must be uniformly spaced and increasing so that kernels can locate the
+//! bracketing grid points by direct index computation rather than a search; standard
+//! OP/OPAL tables resampled onto such a grid satisfy this.
+
+void Radiation::LoadOpacityTable(ParameterInput *pin) {
+  std::string fname = pin->GetString("radiation","opacity_table");
+  std::ifstream file(fname);
+  if (!(file.is_open())) {
+    std::cout << "### FATAL ERROR in " << __FILE__ << " at line " << __LINE__
+      << std::endl << "Opacity table file '" << fname << "' cannot be opened"
+      << std::endl;
+    std::exit(EXIT_FAILURE);
+  }
+
+  // concatenate all non-comment lines so values can be extracted independent of layout
+  std::stringstream data;
+  std::string line;
+  while (std::getline(file, line)) {
+    if (!(line.empty()) && line[0] == '#') {continue;}
+    data << line << ' ';
+  }
+
+  int nd, nt;
+  if (!(data >> nd >> nt) || (nd < 2) || (nt < 2)) {
+    std::cout << "### FATAL ERROR in " << __FILE__ << " at line " << __LINE__
+      << std::endl << "Opacity table '" << fname << "' must begin with grid "
+      << "dimensions nd nt, both at least 2" << std::endl;
+    std::exit(EXIT_FAILURE);
+  }
+
+  // read both axes, and check each is uniformly spaced and increasing
+  std::vector<Real> ld(nd), lt(nt);
+  bool uniform = true;
+  for (int n=0; n<nd; ++n) {
+    if (!(data >> ld[n])) {uniform = false;}
+  }
+  for (int n=0; n<nt; ++n) {
+    if (!(data >> lt[n])) {uniform = false;}
+  }
+  Real dld = (uniform)? ((ld[nd-1] - ld[0])/static_cast<Real>(nd-1)) : 0.0;
+  Real dlt = (uniform)? ((lt[nt-1] - lt[0])/static_cast<Real>(nt-1)) : 0.0;
+  if ((dld <= 0.0) || (dlt <= 0.0)) {uniform = false;}
+  if (uniform) {
+    for (int n=0; n<nd; ++n) {
+      if (fabs(ld[n] - (ld[0] + static_cast<Real>(n)*dld)) > 1.0e-6*dld) {uniform=false;}
+    }
+    for (int n=0; n<nt; ++n) {
+      if (fabs(lt[n] - (lt[0] + static_cast<Real>(n)*dlt)) > 1.0e-6*dlt) {uniform=false;}
+    }
+  }
+  if (!(uniform)) {
+    std::cout << "### FATAL ERROR in " << __FILE__ << " at line " << __LINE__
+      << std::endl << "Axes of opacity table '" << fname << "' must be uniformly "
+      << "spaced in log10 and increasing" << std::endl;
+    std::exit(EXIT_FAILURE);
+  }
+
+  // read log10(kappa) tables on host, then copy to device
+  opacity_table.lkr = DvceArray2D<Real>("opac_lkr", nd, nt);
+  opacity_table.lkp = DvceArray2D<Real>("opac_lkp", nd, nt);
+  auto hlkr = Kokkos::create_mirror_view(opacity_table.lkr);
+  auto hlkp = Kokkos::create_mirror_view(opacity_table.lkp);
+  bool complete = true;
+  for (int d=0; d<nd; ++d) {
+    for (int t=0; t<nt; ++t) {
+      if (!(data >> hlkr(d,t))) {complete = false;}
+    }
+  }
+  for (int d=0; d<nd; ++d) {
+    for (int t=0; t<nt; ++t) {
+      if (!(data >> hlkp(d,t))) {complete = false;}
+    }
+  }
+  if (!(complete)) {
+    std::cout << "### FATAL ERROR in " << __FILE__ << " at line " << __LINE__
+      << std::endl << "Opacity table '" << fname << "' is truncated or malformed"
+      << std::endl;
+    std::exit(EXIT_FAILURE);
+  }
+  Kokkos::deep_copy(opacity_table.lkr, hlkr);
+  Kokkos::deep_copy(opacity_table.lkp, hlkp);
+
+  opacity_table.nd = nd;
+  opacity_table.nt = nt;
+  opacity_table.ld0 = ld[0];
+  opacity_table.idld = 1.0/dld;
+  opacity_table.lt0 = lt[0];
+  opacity_table.idlt = 1.0/dlt;
+
+  if (global_variable::my_rank == 0) {
+    std::cout << "Opacity table '" << fname << "' loaded: " << nd << " x " << nt
+      << " points, log10(rho) in [" << ld[0] << "," << ld[nd-1] << "], log10(T) in ["
+      << lt[0] << "," << lt[nt-1] << "]" << std::endl;
+  }
+  return;
+}
+
+} // namespace radiation
@@ -26,6 +26,40 @@ namespace radiation {
 KOKKOS_INLINE_FUNCTION
 bool FourthPolyRoot(const Real coef4, const Real tconst, Real &root);
 
+//----------------------------------------------------------------------------------------
+//! \struct AngularSums
+//! \brief accumulator for up to four weighted sums over angles, used as the value type
+//! of the team-parallel reductions in the implicit source term
+
+struct AngularSums {
+  Real s0, s1, s2, s3;
+  KOKKOS_INLINE_FUNCTION
+  AngularSums() : s0(0.0), s1(0.0), s2(0.0), s3(0.0) {}
+  KOKKOS_INLINE_FUNCTION
+  AngularSums& operator+=(const AngularSums &rhs) {
+    s0 += rhs.s0; s1 += rhs.s1; s2 += rhs.s2; s3 += rhs.s3;
+    return *this;
+  }
+  KOKKOS_INLINE_FUNCTION
+  void operator+=(const volatile AngularSums &rhs) volatile {
+    s0 += rhs.s0; s1 += rhs.s1; s2 += rhs.s2; s3 += rhs.s3;
+  }
+};
+
+} // namespace radiation
+
+// sum identity so AngularSums can be used with Kokkos::Sum in team reductions
+namespace Kokkos {
+template <>
+struct reduction_identity<radiation::AngularSums> {
+  KOKKOS_FORCEINLINE_FUNCTION static radiation::AngularSums sum() {
+    return radiation::AngularSums();
+  }
+};
+} // namespace Kokkos
+
+namespace radiation {
+
 //----------------------------------------------------------------------------------------
 //! \fn TaskStatus Radiation::AddRadiationSourceTerm(Driver *pdriver, int stage)
 // \brief Add implicit radiation source term.  Based off of @c-white and @yanfeij's gr_rad
@@ -58,6 +92,7 @@ TaskStatus Radiation::AddRadiationSourceTerm(Driver *pdriver, int stage) {
   Real &spin = coord.bh_spin;
   bool &excise = pmy_pack->pcoord->coord_data.bh_excise;
   auto &rad_mask_ = pmy_pack->pcoord->excision_floor;
+  auto &mb_excised_ = pmy_pack->pcoord->mb_excised;
   Real &n_0_floor_ = n_0_floor;
 
   // Extract radiation constant and units
@@ -90,12 +125,19 @@ TaskStatus Radiation::AddRadiationSourceTerm(Driver *pdriver, int stage) {
   Real &kappa_s_ = kappa_s;
   Real &kappa_p_ = kappa_p;
   bool &power_opacity_ = power_opacity;
+  bool &table_opacity_ = table_opacity;
+  auto otab_ = opacity_table;
   auto &nh_c_ = nh_c;
   auto &tt = tet_c;
   auto &tc = tetcov_c;
   auto &norm_to_tet_ = norm_to_tet;
   auto &solid_angles_ = prgeo->solid_angles;
 
+  // cached frame-transformation tables (see ComputeFrameTables)
+  bool &tables_ = frame_tables;
+  auto &n_0_cc_ = n_0_cc;
+  auto &gcov_cc_ = gcov_cc;
+
   // Extract hydro/mhd quantities
   DvceArray5D<Real> u0_, w0_;
   if (is_hydro_enabled_) {
@@ -120,219 +162,149 @@ TaskStatus Radiation::AddRadiationSourceTerm(Driver *pdriver, int stage) {
     }
   }
 
-  // compute implicit source term
-  par_for("radiation_source",DevExeSpace(),0,nmb1,ks,ke,js,je,is,ie,
-  KOKKOS_LAMBDA(int m, int k, int j, int i) {
-    Real &x1min = size.d_view(m).x1min;
-    Real &x1max = size.d_view(m).x1max;
-    Real x1v = CellCenterX(i-is, indcs.nx1, x1min, x1max);
-
-    Real &x2min = size.d_view(m).x2min;
-    Real &x2max = size.d_view(m).x2max;
-    Real x2v = CellCenterX(j-js, indcs.nx2, x2min, x2max);
-
-    Real &x3min = size.d_view(m).x3min;
-    Real &x3max = size.d_view(m).x3max;
-    Real x3v = CellCenterX(k-ks, indcs.nx3, x3min, x3max);
-
-    // compute metric and inverse
-    Real glower[4][4], gupper[4][4];
-    ComputeMetricAndInverse(x1v,x2v,x3v,flat,spin,glower,gupper);
-    Real alpha = sqrt(-1.0/gupper[0][0]);
-
-    // fluid state
-    Real &wdn = w0_(m,IDN,k,j,i);
-    Real &wvx = w0_(m,IVX,k,j,i);
-    Real &wvy = w0_(m,IVY,k,j,i);
-    Real &wvz = w0_(m,IVZ,k,j,i);
-    Real &wen = w0_(m,IEN,k,j,i);
-
-    // derived quantities
-    Real pgas = gm1*wen;
-    Real tgas = pgas/wdn;
-    Real q = glower[1][1]*wvx*wvx + 2.0*glower[1][2]*wvx*wvy + 2.0*glower[1][3]*wvx*wvz
-           + glower[2][2]*wvy*wvy + 2.0*glower[2][3]*wvy*wvz
-           + glower[3][3]*wvz*wvz;
-    Real gamma = sqrt(1.0 + q);
-    Real u0 = gamma/alpha;
-
-    // set opacities
-    Real sigma_a, sigma_s, sigma_p;
-    OpacityFunction(wdn, density_scale_,
-                    tgas, temperature_scale_,
-                    length_scale_, gm1, mean_mol_weight_,
-                    power_opacity_, rosseland_coef_, planck_minus_rosseland_coef_,
-                    kappa_a_, kappa_s_, kappa_p_,
-                    sigma_a, sigma_s, sigma_p);
-    Real dtcsiga = dt_*sigma_a;
-    Real dtcsigs = dt_*sigma_s;
-    Real dtcsigp = dt_*sigma_p;
-    Real dtaucsiga = dtcsiga/u0;
-    Real dtaucsigs = dtcsigs/u0;
-    Real dtaucsigp = dtcsigp/u0;
-
-    // compute fluid velocity in tetrad frame
-    Real u_tet[4];
-    u_tet[0] = (norm_to_tet_(m,0,0,k,j,i)*gamma + norm_to_tet_(m,0,1,k,j,i)*wvx +
-                norm_to_tet_(m,0,2,k,j,i)*wvy   + norm_to_tet_(m,0,3,k,j,i)*wvz);
-    u_tet[1] = (norm_to_tet_(m,1,0,k,j,i)*gamma + norm_to_tet_(m,1,1,k,j,i)*wvx +
-                norm_to_tet_(m,1,2,k,j,i)*wvy   + norm_to_tet_(m,1,3,k,j,i)*wvz);
-    u_tet[2] = (norm_to_tet_(m,2,0,k,j,i)*gamma + norm_to_tet_(m,2,1,k,j,i)*wvx +
-                norm_to_tet_(m,2,2,k,j,i)*wvy   + norm_to_tet_(m,2,3,k,j,i)*wvz);
-    u_tet[3] = (norm_to_tet_(m,3,0,k,j,i)*gamma + norm_to_tet_(m,3,1,k,j,i)*wvx +
-                norm_to_tet_(m,3,2,k,j,i)*wvy   + norm_to_tet_(m,3,3,k,j,i)*wvz);
-
-    // coordinate component n^0
-    Real n0 = tt(m,0,0,k,j,i);
-
-    // Calculate polynomial coefficients
-    Real wght_sum = 0.0;
-    Real suma1 = 0.0;
-    Real suma2 = 0.0;
-    for (int n=0; n<=nang1; ++n) {
-      Real n_0 = tc(m,0,0,k,j,i)*nh_c_.d_view(n,0) + tc(m,1,0,k,j,i)*nh_c_.d_view(n,1) +
-                 tc(m,2,0,k,j,i)*nh_c_.d_view(n,2) + tc(m,3,0,k,j,i)*nh_c_.d_view(n,3);
-      Real n0_cm = (u_tet[0]*nh_c_.d_view(n,0) - u_tet[1]*nh_c_.d_view(n,1) -
-                    u_tet[2]*nh_c_.d_view(n,2) - u_tet[3]*nh_c_.d_view(n,3));
-      Real omega_cm = solid_angles_.d_view(n)/SQR(n0_cm);
-      Real intensity_cm = 4.0*M_PI*(i0_(m,n,k,j,i)/(n0*n_0))*SQR(SQR(n0_cm));
-      Real vncsigma = 1.0/(n0 + (dtcsiga + dtcsigs)*n0_cm);
-      Real vncsigma2 = n0_cm*vncsigma;
-      Real ir_weight = intensity_cm*omega_cm;
-      wght_sum += omega_cm;
-      suma1 += omega_cm*vncsigma2;
-      suma2 += ir_weight*n0*vncsigma;
-    }
-    suma1 /= wght_sum;
-    suma2 /= wght_sum;
-    Real suma3 = suma1*(dtcsigs - dtcsigp);
-    suma1 *= (dtcsiga + dtcsigp);
-
-    // compute coefficients
-    Real coef[2];
-    coef[1] = (dtaucsiga+dtaucsigp-(dtaucsiga+dtaucsigp)*suma1/(1.0-suma3))*arad_*gm1/wdn;
-    coef[0] = -tgas-(dtaucsiga+dtaucsigp)*suma2*gm1/(wdn*(1.0-suma3));
-
-    // Calculate new gas temperature
-    Real tgasnew = tgas;
-    bool badcell = false;
-    if (fabs(coef[1]) > 1.0e-20) {
-      bool flag = FourthPolyRoot(coef[1], coef[0], tgasnew);
-      if (!(flag) || !(isfinite(tgasnew))) {
-        badcell = true;
-        tgasnew = tgas;
+  // compute implicit source term.  Cells are batched over thread teams: each team works
+  // through an i-pencil of cells, and within every cell the angular quadrature sums are
+  // computed as team-parallel reductions rather than serially within a single thread
+  par_for_outer("radiation_source",DevExeSpace(),0,0,0,nmb1,ks,ke,js,je,
+  KOKKOS_LAMBDA(TeamMember_t member, const int m, const int k, const int j) {
+    for (int i=is; i<=ie; ++i) {
+      // lapse and spatial metric: read cached tables or compute from coordinates
+      Real alpha, g11, g12, g13, g22, g23, g33;
+      if (tables_) {
+        alpha = gcov_cc_(m,0,k,j,i);
+        g11 = gcov_cc_(m,1,k,j,i); g12 = gcov_cc_(m,2,k,j,i); g13 = gcov_cc_(m,3,k,j,i);
+        g22 = gcov_cc_(m,4,k,j,i); g23 = gcov_cc_(m,5,k,j,i); g33 = gcov_cc_(m,6,k,j,i);
+      } else {
+        Real &x1min = size.d_view(m).x1min;
+        Real &x1max = size.d_view(m).x1max;
+        Real x1v = CellCenterX(i-is, indcs.nx1, x1min, x1max);
+
+        Real &x2min = size.d_view(m).x2min;
+        Real &x2max = size.d_view(m).x2max;
+        Real x2v = CellCenterX(j-js, indcs.nx2, x2min, x2max);
+
+        Real &x3min = size.d_view(m).x3min;
+        Real &x3max = size.d_view(m).x3max;
+        Real x3v = CellCenterX(k-ks, indcs.nx3, x3min, x3max);
+
+        // compute metric and inverse
+        Real glower[4][4], gupper[4][4];
+        ComputeMetricAndInverse(x1v,x2v,x3v,flat,spin,glower,gupper);
+        alpha = sqrt(-1.0/gupper[0][0]);
+        g11 = glower[1][1]; g12 = glower[1][2]; g13 = glower[1][3];
+        g22 = glower[2][2]; g23 = glower[2][3]; g33 = glower[3][3];
       }
-    } else {
-      tgasnew = -coef[0];
-    }
 
-    // Update the specific intensity
-    if (!(badcell)) {
-      // Calculate emission coefficient and updated jr_cm
-      Real emission = arad_*SQR(SQR(tgasnew));
-      Real jr_cm = (suma1*emission + suma2)/(1.0 - suma3);
-      Real m_old[4] = {0.0}; Real m_new[4] = {0.0};
-      for (int n=0; n<=nang1; ++n) {
-        // compute coordinate normal components
-        Real n_0 = tc(m,0,0,k,j,i)*nh_c_.d_view(n,0) + tc(m,1,0,k,j,i)*nh_c_.d_view(n,1)
-                 + tc(m,2,0,k,j,i)*nh_c_.d_view(n,2) + tc(m,3,0,k,j,i)*nh_c_.d_view(n,3);
-        Real n_1 = tc(m,0,1,k,j,i)*nh_c_.d_view(n,0) + tc(m,1,1,k,j,i)*nh_c_.d_view(n,1)
-                 + tc(m,2,1,k,j,i)*nh_c_.d_view(n,2) + tc(m,3,1,k,j,i)*nh_c_.d_view(n,3);
-        Real n_2 = tc(m,0,2,k,j,i)*nh_c_.d_view(n,0) + tc(m,1,2,k,j,i)*nh_c_.d_view(n,1)
-                 + tc(m,2,2,k,j,i)*nh_c_.d_view(n,2) + tc(m,3,2,k,j,i)*nh_c_.d_view(n,3);
-        Real n_3 = tc(m,0,3,k,j,i)*nh_c_.d_view(n,0) + tc(m,1,3,k,j,i)*nh_c_.d_view(n,1)
-                 + tc(m,2,3,k,j,i)*nh_c_.d_view(n,2) + tc(m,3,3,k,j,i)*nh_c_.d_view(n,3);
-
-        // compute moments before coupling
-        m_old[0] += (    i0_(m,n,k,j,i)    *solid_angles_.d_view(n));
-        m_old[1] += (n_1*i0_(m,n,k,j,i)/n_0*solid_angles_.d_view(n));
-        m_old[2] += (n_2*i0_(m,n,k,j,i)/n_0*solid_angles_.d_view(n));
-        m_old[3] += (n_3*i0_(m,n,k,j,i)/n_0*solid_angles_.d_view(n));
-
-        // update intensity
+      // fluid state
+      Real &wdn = w0_(m,IDN,k,j,i);
+      Real &wvx = w0_(m,IVX,k,j,i);
+      Real &wvy = w0_(m,IVY,k,j,i);
+      Real &wvz = w0_(m,IVZ,k,j,i);
+      Real &wen = w0_(m,IEN,k,j,i);
+
+      // derived quantities
+      Real pgas = gm1*wen;
+      Real tgas = pgas/wdn;
+      Real q = g11*wvx*wvx + 2.0*g12*wvx*wvy + 2.0*g13*wvx*wvz
+             + g22*wvy*wvy + 2.0*g23*wvy*wvz + g33*wvz*wvz;
+      Real gamma = sqrt(1.0 + q);
+      Real u0 = gamma/alpha;
+
+      // set opacities
+      Real sigma_a, sigma_s, sigma_p;
+      if (table_opacity_) {
+        TableOpacityFunction(wdn, density_scale_,
+                             tgas, temperature_scale_,
+                             length_scale_, gm1, mean_mol_weight_,
+                             otab_, kappa_s_,
+                             sigma_a, sigma_s, sigma_p);
+      } else {
+        OpacityFunction(wdn, density_scale_,
+                        tgas, temperature_scale_,
+                        length_scale_, gm1, mean_mol_weight_,
+                        power_opacity_, rosseland_coef_, planck_minus_rosseland_coef_,
+                        kappa_a_, kappa_s_, kappa_p_,
+                        sigma_a, sigma_s, sigma_p);
+      }
+      Real dtcsiga = dt_*sigma_a;
+      Real dtcsigs = dt_*sigma_s;
+      Real dtcsigp = dt_*sigma_p;
+      Real dtaucsiga = dtcsiga/u0;
+      Real dtaucsigs = dtcsigs/u0;
+      Real dtaucsigp = dtcsigp/u0;
+
+      // compute fluid velocity in tetrad frame
+      Real u_tet[4];
+      u_tet[0] = (norm_to_tet_(m,0,0,k,j,i)*gamma + norm_to_tet_(m,0,1,k,j,i)*wvx +
+                  norm_to_tet_(m,0,2,k,j,i)*wvy   + norm_to_tet_(m,0,3,k,j,i)*wvz);
+      u_tet[1] = (norm_to_tet_(m,1,0,k,j,i)*gamma + norm_to_tet_(m,1,1,k,j,i)*wvx +
+                  norm_to_tet_(m,1,2,k,j,i)*wvy   + norm_to_tet_(m,1,3,k,j,i)*wvz);
+      u_tet[2] = (norm_to_tet_(m,2,0,k,j,i)*gamma + norm_to_tet_(m,2,1,k,j,i)*wvx +
+                  norm_to_tet_(m,2,2,k,j,i)*wvy   + norm_to_tet_(m,2,3,k,j,i)*wvz);
+      u_tet[3] = (norm_to_tet_(m,3,0,k,j,i)*gamma + norm_to_tet_(m,3,1,k,j,i)*wvx +
+                  norm_to_tet_(m,3,2,k,j,i)*wvy   + norm_to_tet_(m,3,3,k,j,i)*wvz);
+
+      // coordinate component n^0
+      Real n0 = tt(m,0,0,k,j,i);
+
+      // Calculate polynomial coefficients (team reduction over angles; every thread
+      // receives the reduced sums)
+      AngularSums qsum;
+      Kokkos::parallel_reduce(Kokkos::TeamThreadRange(member, nang1+1),
+      [&](const int n, AngularSums &sum) {
+        Real n_0 = (tables_)? n_0_cc_(m,n,k,j,i) :
+                   (tc(m,0,0,k,j,i)*nh_c_.d_view(n,0)+tc(m,1,0,k,j,i)*nh_c_.d_view(n,1)
+                  + tc(m,2,0,k,j,i)*nh_c_.d_view(n,2)+tc(m,3,0,k,j,i)*nh_c_.d_view(n,3));
         Real n0_cm = (u_tet[0]*nh_c_.d_view(n,0) - u_tet[1]*nh_c_.d_view(n,1) -
                       u_tet[2]*nh_c_.d_view(n,2) - u_tet[3]*nh_c_.d_view(n,3));
+        Real omega_cm = solid_angles_.d_view(n)/SQR(n0_cm);
         Real intensity_cm = 4.0*M_PI*(i0_(m,n,k,j,i)/(n0*n_0))*SQR(SQR(n0_cm));
         Real vncsigma = 1.0/(n0 + (dtcsiga + dtcsigs)*n0_cm);
         Real vncsigma2 = n0_cm*vncsigma;
-        Real di_cm = ( ((dtcsigs-dtcsigp)*jr_cm
-                      + (dtcsiga+dtcsigp)*emission
-                      - (dtcsigs+dtcsiga)*intensity_cm)*vncsigma2 );
-        i0_(m,n,k,j,i) = n0*n_0*fmax(i0_(m,n,k,j,i)/(n0*n_0) +
-                                     di_cm/(4.0*M_PI*SQR(SQR(n0_cm))), 0.0);
-
-        // compute moments after coupling
-        m_new[0] += (    i0_(m,n,k,j,i)    *solid_angles_.d_view(n));
-        m_new[1] += (n_1*i0_(m,n,k,j,i)/n_0*solid_angles_.d_view(n));
-        m_new[2] += (n_2*i0_(m,n,k,j,i)/n_0*solid_angles_.d_view(n));
-        m_new[3] += (n_3*i0_(m,n,k,j,i)/n_0*solid_angles_.d_view(n));
-
-        // handle excision
-        // NOTE(@pdmullen): The below zeroes all intensities within rks <= r_excision and
-        // zeroes intensities within angles where n_0 is about zero. When Compton is
-        // enabled, we delay the n_0_floor excision so that intensites updated via
-        // absorption and scattering inform the Compton update
-        if (excise) {
-          bool apply_excision = (rad_mask_(m,k,j,i) ||
-                                 (!(is_compton_enabled_) && fabs(n_0) < n_0_floor_));
-          if (apply_excision) { i0_(m,n,k,j,i) = 0.0; }
-        }
-      }
-      // update conserved fluid variables
-      if (affect_fluid_) {
-        u0_(m,IEN,k,j,i) += (m_old[0] - m_new[0]);
-        u0_(m,IM1,k,j,i) += (m_old[1] - m_new[1]);
-        u0_(m,IM2,k,j,i) += (m_old[2] - m_new[2]);
-        u0_(m,IM3,k,j,i) += (m_old[3] - m_new[3]);
-      }
-    }
-
-    // compton scattering
-    if (is_compton_enabled_) {
-      // use partially updated gas temperature
-      tgas = tgasnew;
-
-      // compute polynomial coefficients using partially updated gas temp and intensity
-      suma1 = 0.0;
-      Real jr_cm = 0.0;
-      for (int n=0; n<=nang1; ++n) {
-        Real n_0 = tc(m,0,0,k,j,i)*nh_c_.d_view(n,0) + tc(m,1,0,k,j,i)*nh_c_.d_view(n,1) +
-                   tc(m,2,0,k,j,i)*nh_c_.d_view(n,2) + tc(m,3,0,k,j,i)*nh_c_.d_view(n,3);
-        Real n0_cm = (u_tet[0]*nh_c_.d_view(n,0) - u_tet[1]*nh_c_.d_view(n,1) -
-                      u_tet[2]*nh_c_.d_view(n,2) - u_tet[3]*nh_c_.d_view(n,3));
-        Real wght_cm = solid_angles_.d_view(n)/SQR(n0_cm)/wght_sum;
-        Real intensity_cm = 4.0*M_PI*(i0_(m,n,k,j,i)/(n0*n_0))*SQR(SQR(n0_cm));
-        Real ir_weight = intensity_cm*wght_cm;
-        jr_cm += ir_weight;
-        suma1 += (n0_cm/n0)*4.0*dtcsigs*inv_t_electron_*wght_cm;
-      }
-      suma2 = 4.0*dtaucsigs*inv_t_electron_*gm1/wdn;
-
-      // compute partially updated radiation temperature
-      Real trad = sqrt(sqrt(jr_cm/arad_));
-      const bool temp_equil = (fabs(trad - tgas) < 1.0e-12);
-
-      // Calculate new gas temperature due to Compton
-      Real tradnew = trad;
-      badcell = false;
-      if (!(temp_equil)) {
-        coef[1] = (1.0 + suma2*jr_cm)/(suma1*jr_cm)*arad_;
-        coef[0] = -(1.0 + suma2*jr_cm)/suma1 - tgas;
-        bool flag = FourthPolyRoot(coef[1], coef[0], tradnew);
-        if (!(flag) || !(isfinite(tradnew))) {
+        Real ir_weight = intensity_cm*omega_cm;
+        sum.s0 += omega_cm;
+        sum.s1 += omega_cm*vncsigma2;
+        sum.s2 += ir_weight*n0*vncsigma;
+      }, Kokkos::Sum<AngularSums>(qsum));
+      Real wght_sum = qsum.s0;
+      Real suma1 = qsum.s1/wght_sum;
+      Real suma2 = qsum.s2/wght_sum;
+      Real suma3 = suma1*(dtcsigs - dtcsigp);
+      suma1 *= (dtcsiga + dtcsigp);
+
+      // compute coefficients
+      Real coef[2];
+      coef[1] = (dtaucsiga+dtaucsigp
+                 -(dtaucsiga+dtaucsigp)*suma1/(1.0-suma3))*arad_*gm1/wdn;
+      coef[0] = -tgas-(dtaucsiga+dtaucsigp)*suma2*gm1/(wdn*(1.0-suma3));
+
+      // Calculate new gas temperature (redundantly on every thread in the team, so no
+      // broadcast is needed afterwards)
+      Real tgasnew = tgas;
+      bool badcell = false;
+      if (fabs(coef[1]) > 1.0e-20) {
+        bool flag = FourthPolyRoot(coef[1], coef[0], tgasnew);
+        if (!(flag) || !(isfinite(tgasnew))) {
           badcell = true;
+          tgasnew = tgas;
         }
+      } else {
+        tgasnew = -coef[0];
       }
 
-      // Update the specific intensity
-      if (!(badcell) && !(temp_equil)) {
-        // Compute updated gas temperature
-        tgasnew = (arad_*SQR(SQR(tradnew)) - jr_cm)/(suma1*jr_cm) + tradnew;
-        Real m_old[4] = {0.0}; Real m_new[4] = {0.0};
-        for (int n=0; n<=nang1; ++n) {
+      // Update the specific intensity.  Each angle is handled by one thread; the moment
+      // differences needed for the fluid feedback are accumulated in the same pass
+      if (!(badcell)) {
+        // Calculate emission coefficient and updated jr_cm
+        Real emission = arad_*SQR(SQR(tgasnew));
+        Real jr_cm = (suma1*emission + suma2)/(1.0 - suma3);
+        AngularSums msum;
+        Kokkos::parallel_reduce(Kokkos::TeamThreadRange(member, nang1+1),
+        [&](const int n, AngularSums &sum) {
           // compute coordinate normal components
-          Real n_0 = tc(m,0,0,k,j,i)*nh_c_.d_view(n,0)+tc(m,1,0,k,j,i)*nh_c_.d_view(n,1)
-                   + tc(m,2,0,k,j,i)*nh_c_.d_view(n,2)+tc(m,3,0,k,j,i)*nh_c_.d_view(n,3);
+          Real n_0 = (tables_)? n_0_cc_(m,n,k,j,i) :
+                   (tc(m,0,0,k,j,i)*nh_c_.d_view(n,0)+tc(m,1,0,k,j,i)*nh_c_.d_view(n,1)
+                  + tc(m,2,0,k,j,i)*nh_c_.d_view(n,2)+tc(m,3,0,k,j,i)*nh_c_.d_view(n,3));
           Real n_1 = tc(m,0,1,k,j,i)*nh_c_.d_view(n,0)+tc(m,1,1,k,j,i)*nh_c_.d_view(n,1)
                    + tc(m,2,1,k,j,i)*nh_c_.d_view(n,2)+tc(m,3,1,k,j,i)*nh_c_.d_view(n,3);
           Real n_2 = tc(m,0,2,k,j,i)*nh_c_.d_view(n,0)+tc(m,1,2,k,j,i)*nh_c_.d_view(n,1)
@@ -340,51 +312,167 @@ TaskStatus Radiation::AddRadiationSourceTerm(Driver *pdriver, int stage) {
           Real n_3 = tc(m,0,3,k,j,i)*nh_c_.d_view(n,0)+tc(m,1,3,k,j,i)*nh_c_.d_view(n,1)
                    + tc(m,2,3,k,j,i)*nh_c_.d_view(n,2)+tc(m,3,3,k,j,i)*nh_c_.d_view(n,3);
 
-          // compute moments before coupling
-          m_old[0] += (    i0_(m,n,k,j,i)    *solid_angles_.d_view(n));
-          m_old[1] += (n_1*i0_(m,n,k,j,i)/n_0*solid_angles_.d_view(n));
-          m_old[2] += (n_2*i0_(m,n,k,j,i)/n_0*solid_angles_.d_view(n));
-          m_old[3] += (n_3*i0_(m,n,k,j,i)/n_0*solid_angles_.d_view(n));
-
           // update intensity
+          Real ii_old = i0_(m,n,k,j,i);
           Real n0_cm = (u_tet[0]*nh_c_.d_view(n,0) - u_tet[1]*nh_c_.d_view(n,1) -
                         u_tet[2]*nh_c_.d_view(n,2) - u_tet[3]*nh_c_.d_view(n,3));
-          Real di_cm = (n0_cm/n0)*dtcsigs*4.0*jr_cm*inv_t_electron_*(tgasnew - tradnew);
-          i0_(m,n,k,j,i) = n0*n_0*fmax(i0_(m,n,k,j,i)/(n0*n_0) +
-                                       di_cm/(4.0*M_PI*SQR(SQR(n0_cm))), 0.0);
-
-          // compute moments after coupling
-          m_new[0] += (    i0_(m,n,k,j,i)    *solid_angles_.d_view(n));
-          m_new[1] += (n_1*i0_(m,n,k,j,i)/n_0*solid_angles_.d_view(n));
-          m_new[2] += (n_2*i0_(m,n,k,j,i)/n_0*solid_angles_.d_view(n));
-          m_new[3] += (n_3*i0_(m,n,k,j,i)/n_0*solid_angles_.d_view(n));
-
-          // handle excision (see notes above)
+          Real intensity_cm = 4.0*M_PI*(ii_old/(n0*n_0))*SQR(SQR(n0_cm));
+          Real vncsigma = 1.0/(n0 + (dtcsiga + dtcsigs)*n0_cm);
+          Real vncsigma2 = n0_cm*vncsigma;
+          Real di_cm = ( ((dtcsigs-dtcsigp)*jr_cm
+                        + (dtcsiga+dtcsigp)*emission
+                        - (dtcsigs+dtcsiga)*intensity_cm)*vncsigma2 );
+          Real ii_new = n0*n_0*fmax(ii_old/(n0*n_0) +
+                                    di_cm/(4.0*M_PI*SQR(SQR(n0_cm))), 0.0);
+          i0_(m,n,k,j,i) = ii_new;
+
+          // accumulate change in moments due to coupling
+          sum.s0 += (    (ii_old - ii_new)    *solid_angles_.d_view(n));
+          sum.s1 += (n_1*(ii_old - ii_new)/n_0*solid_angles_.d_view(n));
+          sum.s2 += (n_2*(ii_old - ii_new)/n_0*solid_angles_.d_view(n));
+          sum.s3 += (n_3*(ii_old - ii_new)/n_0*solid_angles_.d_view(n));
+
+          // handle excision
+          // NOTE(@pdmullen): The below zeroes all intensities within rks <= r_excision
+          // and zeroes intensities within angles where n_0 is about zero. When Compton
+          // is enabled, we delay the n_0_floor excision so that intensites updated via
+          // absorption and scattering inform the Compton update
           if (excise) {
-            if (rad_mask_(m,k,j,i) || fabs(n_0) < n_0_floor_) { i0_(m,n,k,j,i) = 0.0; }
+            bool apply_excision = ((mb_excised_(m) && rad_mask_(m,k,j,i)) ||
+                                   (!(is_compton_enabled_) && fabs(n_0) < n_0_floor_));
+            if (apply_excision) { i0_(m,n,k,j,i) = 0.0; }
           }
-        }
-
-        // feedback on fluid
+        }, Kokkos::Sum<AngularSums>(msum));
+        // update conserved fluid variables (from one thread only)
         if (affect_fluid_) {
-          u0_(m,IEN,k,j,i) += (m_old[0] - m_new[0]);
-          u0_(m,IM1,k,j,i) += (m_old[1] - m_new[1]);
-          u0_(m,IM2,k,j,i) += (m_old[2] - m_new[2]);
-          u0_(m,IM3,k,j,i) += (m_old[3] - m_new[3]);
+          Kokkos::single(Kokkos::PerTeam(member), [&]() {
+            u0_(m,IEN,k,j,i) += msum.s0;
+            u0_(m,IM1,k,j,i) += msum.s1;
+            u0_(m,IM2,k,j,i) += msum.s2;
+            u0_(m,IM3,k,j,i) += msum.s3;
+          });
         }
-      } else {
-        // NOTE(@pdmullen): At this point, it is possible that excision has not been
-        // entirely applied if Compton is enabled and a badcell or temperature equilibrium
-        // was encountered.. apply excision
-        if (excise) {
-          for (int n=0; n<=nang1; ++n) {
-            Real n_0 = tc(m,0,0,k,j,i)*nh_c_.d_view(n,0)+
-                       tc(m,1,0,k,j,i)*nh_c_.d_view(n,1)+
-                       tc(m,2,0,k,j,i)*nh_c_.d_view(n,2)+
-                       tc(m,3,0,k,j,i)*nh_c_.d_view(n,3);
-            if (rad_mask_(m,k,j,i) || fabs(n_0) < n_0_floor_) { i0_(m,n,k,j,i) = 0.0; }
+      }
+      member.team_barrier();
+
+      // compton scattering
+      if (is_compton_enabled_) {
+        // use partially updated gas temperature
+        tgas = tgasnew;
+
+        // compute polynomial coefficients using partially updated gas temp and intensity
+        AngularSums csum;
+        Kokkos::parallel_reduce(Kokkos::TeamThreadRange(member, nang1+1),
+        [&](const int n, AngularSums &sum) {
+          Real n_0 = (tables_)? n_0_cc_(m,n,k,j,i) :
+                   (tc(m,0,0,k,j,i)*nh_c_.d_view(n,0)+tc(m,1,0,k,j,i)*nh_c_.d_view(n,1)
+                  + tc(m,2,0,k,j,i)*nh_c_.d_view(n,2)+tc(m,3,0,k,j,i)*nh_c_.d_view(n,3));
+          Real n0_cm = (u_tet[0]*nh_c_.d_view(n,0) - u_tet[1]*nh_c_.d_view(n,1) -
+                        u_tet[2]*nh_c_.d_view(n,2) - u_tet[3]*nh_c_.d_view(n,3));
+          Real wght_cm = solid_angles_.d_view(n)/SQR(n0_cm)/wght_sum;
+          Real intensity_cm = 4.0*M_PI*(i0_(m,n,k,j,i)/(n0*n_0))*SQR(SQR(n0_cm));
+          Real ir_weight = intensity_cm*wght_cm;
+          sum.s0 += ir_weight;
+          sum.s1 += (n0_cm/n0)*4.0*dtcsigs*inv_t_electron_*wght_cm;
+        }, Kokkos::Sum<AngularSums>(csum));
+        Real jr_cm = csum.s0;
+        suma1 = csum.s1;
+        suma2 = 4.0*dtaucsigs*inv_t_electron_*gm1/wdn;
+
+        // compute partially updated radiation temperature
+        Real trad = sqrt(sqrt(jr_cm/arad_));
+        const bool temp_equil = (fabs(trad - tgas) < 1.0e-12);
+
+        // Calculate new gas temperature due to Compton
+        Real tradnew = trad;
+        badcell = false;
+        if (!(temp_equil)) {
+          coef[1] = (1.0 + suma2*jr_cm)/(suma1*jr_cm)*arad_;
+          coef[0] = -(1.0 + suma2*jr_cm)/suma1 - tgas;
+          bool flag = FourthPolyRoot(coef[1], coef[0], tradnew);
+          if (!(flag) || !(isfinite(tradnew))) {
+            badcell = true;
+          }
+        }
+
+        // Update the specific intensity
+        if (!(badcell) && !(temp_equil)) {
+          // Compute updated gas temperature
+          tgasnew = (arad_*SQR(SQR(tradnew)) - jr_cm)/(suma1*jr_cm) + tradnew;
+          AngularSums msum;
+          Kokkos::parallel_reduce(Kokkos::TeamThreadRange(member, nang1+1),
+          [&](const int n, AngularSums &sum) {
+            // compute coordinate normal components
+            Real n_0 = (tables_)? n_0_cc_(m,n,k,j,i) :
+                       (tc(m,0,0,k,j,i)*nh_c_.d_view(n,0)
+                      + tc(m,1,0,k,j,i)*nh_c_.d_view(n,1)
+                      + tc(m,2,0,k,j,i)*nh_c_.d_view(n,2)
+                      + tc(m,3,0,k,j,i)*nh_c_.d_view(n,3));
+            Real n_1 = tc(m,0,1,k,j,i)*nh_c_.d_view(n,0)
+                     + tc(m,1,1,k,j,i)*nh_c_.d_view(n,1)
+                     + tc(m,2,1,k,j,i)*nh_c_.d_view(n,2)
+                     + tc(m,3,1,k,j,i)*nh_c_.d_view(n,3);
+            Real n_2 = tc(m,0,2,k,j,i)*nh_c_.d_view(n,0)
+                     + tc(m,1,2,k,j,i)*nh_c_.d_view(n,1)
+                     + tc(m,2,2,k,j,i)*nh_c_.d_view(n,2)
+                     + tc(m,3,2,k,j,i)*nh_c_.d_view(n,3);
+            Real n_3 = tc(m,0,3,k,j,i)*nh_c_.d_view(n,0)
+                     + tc(m,1,3,k,j,i)*nh_c_.d_view(n,1)
+                     + tc(m,2,3,k,j,i)*nh_c_.d_view(n,2)
+                     + tc(m,3,3,k,j,i)*nh_c_.d_view(n,3);
+
+            // update intensity
+            Real ii_old = i0_(m,n,k,j,i);
+            Real n0_cm = (u_tet[0]*nh_c_.d_view(n,0) - u_tet[1]*nh_c_.d_view(n,1) -
+                          u_tet[2]*nh_c_.d_view(n,2) - u_tet[3]*nh_c_.d_view(n,3));
+            Real di_cm = (n0_cm/n0)*dtcsigs*4.0*jr_cm*inv_t_electron_
+                         *(tgasnew - tradnew);
+            Real ii_new = n0*n_0*fmax(ii_old/(n0*n_0) +
+                                      di_cm/(4.0*M_PI*SQR(SQR(n0_cm))), 0.0);
+            i0_(m,n,k,j,i) = ii_new;
+
+            // accumulate change in moments due to coupling
+            sum.s0 += (    (ii_old - ii_new)    *solid_angles_.d_view(n));
+            sum.s1 += (n_1*(ii_old - ii_new)/n_0*solid_angles_.d_view(n));
+            sum.s2 += (n_2*(ii_old - ii_new)/n_0*solid_angles_.d_view(n));
+            sum.s3 += (n_3*(ii_old - ii_new)/n_0*solid_angles_.d_view(n));
+
+            // handle excision (see notes above)
+            if (excise) {
+              if ((mb_excised_(m) && rad_mask_(m,k,j,i)) || fabs(n_0) < n_0_floor_) {
+                i0_(m,n,k,j,i) = 0.0;
+              }
+            }
+          }, Kokkos::Sum<AngularSums>(msum));
+
+          // feedback on fluid (from one thread only)
+          if (affect_fluid_) {
+            Kokkos::single(Kokkos::PerTeam(member), [&]() {
+              u0_(m,IEN,k,j,i) += msum.s0;
+              u0_(m,IM1,k,j,i) += msum.s1;
+              u0_(m,IM2,k,j,i) += msum.s2;
+              u0_(m,IM3,k,j,i) += msum.s3;
+            });
+          }
+        } else {
+          // NOTE(@pdmullen): At this point, it is possible that excision has not been
+          // entirely applied if Compton is enabled and a badcell or temperature
+          // equilibrium was encountered.. apply excision
+          if (excise) {
+            Kokkos::parallel_for(Kokkos::TeamThreadRange(member, nang1+1),
+            [&](const int n) {
+              Real n_0 = (tables_)? n_0_cc_(m,n,k,j,i) :
+                         (tc(m,0,0,k,j,i)*nh_c_.d_view(n,0)+
+                          tc(m,1,0,k,j,i)*nh_c_.d_view(n,1)+
+                          tc(m,2,0,k,j,i)*nh_c_.d_view(n,2)+
+                          tc(m,3,0,k,j,i)*nh_c_.d_view(n,3));
+              if ((mb_excised_(m) && rad_mask_(m,k,j,i)) || fabs(n_0) < n_0_floor_) {
+                i0_(m,n,k,j,i) = 0.0;
+              }
+            });
           }
         }
+        member.team_barrier();
       }
     }
   });
@@ -34,115 +34,208 @@ void Radiation::AssembleRadTasks(std::map<std::string, std::shared_ptr<TaskList>
   hydro::Hydro *phyd = pmy_pack->phydro;
   mhd::MHD *pmhd = pmy_pack->pmhd;
 
+  // radiation transport kernels can run on a pool stream, overlapped with the fluid
+  // flux/update chain, when no work is launched on the default instance mid-task
+  // (coarsening mask refresh, beam sources)
+  bool rad_async = (!angular_coarsening) && (!(psrc->beam));
+
   // construct task list depending on enabled physics modules and radiation parameters
   if (pmhd != nullptr && !(fixed_fluid)) {  // radiation magnetohydrodynamics
     // assemble "before_stagen" task list
-    id.rad_irecv = tl["before_stagen"]->AddTask(&Radiation::InitRecv, this, none);
-    id.mhd_irecv = tl["before_stagen"]->AddTask(&mhd::MHD::InitRecv, pmhd, none);
+    id.rad_irecv = tl["before_stagen"]->AddTask(&Radiation::InitRecv, this, none,
+                                                "Radiation::InitRecv");
+    id.mhd_irecv = tl["before_stagen"]->AddTask(&mhd::MHD::InitRecv, pmhd, none,
+                                                "MHD::InitRecv");
 
     // assemble "stagen" task list
-    id.copyu     = tl["stagen"]->AddTask(&Radiation::CopyCons, this, none);
-    id.rad_flux  = tl["stagen"]->AddTask(&Radiation::CalculateFluxes, this, id.copyu);
-    id.rad_sendf = tl["stagen"]->AddTask(&Radiation::SendFlux, this, id.rad_flux);
-    id.rad_recvf = tl["stagen"]->AddTask(&Radiation::RecvFlux, this, id.rad_sendf);
-    id.rad_rkupdt= tl["stagen"]->AddTask(&Radiation::RKUpdate, this, id.rad_recvf);
-    id.mhd_flux  = tl["stagen"]->AddTask(&mhd::MHD::Fluxes, pmhd, id.rad_rkupdt);
-    id.mhd_sendf = tl["stagen"]->AddTask(&mhd::MHD::SendFlux, pmhd, id.mhd_flux);
-    id.mhd_recvf = tl["stagen"]->AddTask(&mhd::MHD::RecvFlux, pmhd, id.mhd_sendf);
-    id.mhd_rkupdt= tl["stagen"]->AddTask(&mhd::MHD::RKUpdate, pmhd, id.mhd_recvf);
-    id.mhd_efld  = tl["stagen"]->AddTask(&mhd::MHD::CornerE, pmhd, id.mhd_rkupdt);
-    id.mhd_sende = tl["stagen"]->AddTask(&mhd::MHD::SendE, pmhd, id.mhd_efld);
-    id.mhd_recve = tl["stagen"]->AddTask(&mhd::MHD::RecvE, pmhd, id.mhd_sende);
-    id.mhd_ct    = tl["stagen"]->AddTask(&mhd::MHD::CT, pmhd, id.mhd_recve);
+    // CopyCons copies both radiation and MHD registers, so the MHD flux chain depends
+    // only on copyu; radiation transport runs concurrently on a pool stream until the
+    // two chains join at the (implicit) radiation source term
+    id.copyu     = tl["stagen"]->AddTask(&Radiation::CopyCons, this, none,
+                                         "Radiation::CopyCons");
+    id.rad_flux  = tl["stagen"]->AddTask(&Radiation::CalculateFluxes, this, id.copyu,
+                                         "Radiation::CalculateFluxes", rad_async);
+    id.rad_sendf = tl["stagen"]->AddTask(&Radiation::SendFlux, this, id.rad_flux,
+                                         "Radiation::SendFlux");
+    id.rad_recvf = tl["stagen"]->AddTask(&Radiation::RecvFlux, this, id.rad_sendf,
+                                         "Radiation::RecvFlux");
+    id.rad_rkupdt= tl["stagen"]->AddTask(&Radiation::RKUpdate, this, id.rad_recvf,
+                                         "Radiation::RKUpdate", rad_async);
+    id.mhd_flux  = tl["stagen"]->AddTask(&mhd::MHD::Fluxes, pmhd, id.copyu,
+                                         "MHD::Fluxes");
+    id.mhd_sendf = tl["stagen"]->AddTask(&mhd::MHD::SendFlux, pmhd, id.mhd_flux,
+                                         "MHD::SendFlux");
+    id.mhd_recvf = tl["stagen"]->AddTask(&mhd::MHD::RecvFlux, pmhd, id.mhd_sendf,
+                                         "MHD::RecvFlux");
+    id.mhd_rkupdt= tl["stagen"]->AddTask(&mhd::MHD::RKUpdate, pmhd, id.mhd_recvf,
+                                         "MHD::RKUpdate");
+    id.mhd_efld  = tl["stagen"]->AddTask(&mhd::MHD::CornerE, pmhd, id.mhd_rkupdt,
+                                         "MHD::CornerE");
+    id.mhd_sende = tl["stagen"]->AddTask(&mhd::MHD::SendE, pmhd, id.mhd_efld,
+                                         "MHD::SendE");
+    id.mhd_recve = tl["stagen"]->AddTask(&mhd::MHD::RecvE, pmhd, id.mhd_sende,
+                                         "MHD::RecvE");
+    id.mhd_ct    = tl["stagen"]->AddTask(&mhd::MHD::CT, pmhd, id.mhd_recve, "MHD::CT");
+    TaskID src_dep = (id.mhd_ct | id.rad_rkupdt);
     id.rad_src   = tl["stagen"]->AddTask(
-                                    &Radiation::AddRadiationSourceTerm,this,id.mhd_ct);
-    id.rad_resti = tl["stagen"]->AddTask(&Radiation::RestrictI, this, id.rad_src);
-    id.rad_sendi = tl["stagen"]->AddTask(&Radiation::SendI, this, id.rad_resti);
-    id.rad_recvi = tl["stagen"]->AddTask(&Radiation::RecvI, this, id.rad_sendi);
-    id.mhd_restu = tl["stagen"]->AddTask(&mhd::MHD::RestrictU, pmhd, id.rad_recvi);
-    id.mhd_sendu = tl["stagen"]->AddTask(&mhd::MHD::SendU, pmhd, id.mhd_restu);
-    id.mhd_recvu = tl["stagen"]->AddTask(&mhd::MHD::RecvU, pmhd, id.mhd_sendu);
-    id.mhd_restb = tl["stagen"]->AddTask(&mhd::MHD::RestrictB, pmhd, id.mhd_recvu);
-    id.mhd_sendb = tl["stagen"]->AddTask(&mhd::MHD::SendB, pmhd, id.mhd_restb);
-    id.mhd_recvb = tl["stagen"]->AddTask(&mhd::MHD::RecvB, pmhd, id.mhd_sendb);
+                                    &Radiation::AddRadiationSourceTerm,this,src_dep,
+                                        "Radiation::AddRadiationSourceTerm");
+    id.rad_resti = tl["stagen"]->AddTask(&Radiation::RestrictI, this, id.rad_src,
+                                         "Radiation::RestrictI");
+    id.rad_sendi = tl["stagen"]->AddTask(&Radiation::SendI, this, id.rad_resti,
+                                         "Radiation::SendI");
+    id.rad_recvi = tl["stagen"]->AddTask(&Radiation::RecvI, this, id.rad_sendi,
+                                         "Radiation::RecvI");
+    id.mhd_restu = tl["stagen"]->AddTask(&mhd::MHD::RestrictU, pmhd, id.rad_recvi,
+                                         "MHD::RestrictU");
+    id.mhd_sendu = tl["stagen"]->AddTask(&mhd::MHD::SendU, pmhd, id.mhd_restu,
+                                         "MHD::SendU");
+    id.mhd_recvu = tl["stagen"]->AddTask(&mhd::MHD::RecvU, pmhd, id.mhd_sendu,
+                                         "MHD::RecvU");
+    id.mhd_restb = tl["stagen"]->AddTask(&mhd::MHD::RestrictB, pmhd, id.mhd_recvu,
+                                         "MHD::RestrictB");
+    id.mhd_sendb = tl["stagen"]->AddTask(&mhd::MHD::SendB, pmhd, id.mhd_restb,
+                                         "MHD::SendB");
+    id.mhd_recvb = tl["stagen"]->AddTask(&mhd::MHD::RecvB, pmhd, id.mhd_sendb,
+                                         "MHD::RecvB");
     id.bcs       = tl["stagen"]->AddTask(
-                                    &Radiation::ApplyPhysicalBCs, this, id.mhd_recvb);
-    id.rad_prol  = tl["stagen"]->AddTask(&Radiation::Prolongate, this, id.bcs);
-    id.mhd_prol  = tl["stagen"]->AddTask(&mhd::MHD::Prolongate, pmhd, id.rad_prol);
-    id.mhd_c2p   = tl["stagen"]->AddTask(&mhd::MHD::ConToPrim, pmhd, id.mhd_prol);
+                                    &Radiation::ApplyPhysicalBCs, this, id.mhd_recvb,
+                                        "Radiation::ApplyPhysicalBCs");
+    id.rad_prol  = tl["stagen"]->AddTask(&Radiation::Prolongate, this, id.bcs,
+                                         "Radiation::Prolongate");
+    id.mhd_prol  = tl["stagen"]->AddTask(&mhd::MHD::Prolongate, pmhd, id.rad_prol,
+                                         "MHD::Prolongate");
+    id.mhd_c2p   = tl["stagen"]->AddTask(&mhd::MHD::ConToPrim, pmhd, id.mhd_prol,
+                                         "MHD::ConToPrim");
 
     // assemble "after_stagen" task list
-    id.rad_csend = tl["after_stagen"]->AddTask(&Radiation::ClearSend, this, none);
-    id.mhd_csend = tl["after_stagen"]->AddTask(&mhd::MHD::ClearSend, pmhd, none);
+    id.rad_csend = tl["after_stagen"]->AddTask(&Radiation::ClearSend, this, none,
+                                               "Radiation::ClearSend");
+    id.mhd_csend = tl["after_stagen"]->AddTask(&mhd::MHD::ClearSend, pmhd, none,
+                                               "MHD::ClearSend");
     // although RecvFlux/U/E/B functions check that all recvs complete, add ClearRecv to
     // task list anyways to catch potential bugs in MPI communication logic
-    id.rad_crecv = tl["after_stagen"]->AddTask(&Radiation::ClearRecv, this, id.rad_csend);
+    id.rad_crecv = tl["after_stagen"]->AddTask(&Radiation::ClearRecv, this, id.rad_csend,
+                                               "Radiation::ClearRecv");
     id.mhd_crecv = tl["after_stagen"]->AddTask(
-                                          &mhd::MHD::ClearRecv, pmhd, id.mhd_csend);
+                                          &mhd::MHD::ClearRecv, pmhd, id.mhd_csend,
+                                              "MHD::ClearRecv");
 
   } else if (phyd != nullptr && !(fixed_fluid)) {  // radiation hydrodynamics
     // assemble "before_stagen" task list
-    id.rad_irecv = tl["before_stagen"]->AddTask(&Radiation::InitRecv, this, none);
-    id.hyd_irecv = tl["before_stagen"]->AddTask(&hydro::Hydro::InitRecv, phyd, none);
+    id.rad_irecv = tl["before_stagen"]->AddTask(&Radiation::InitRecv, this, none,
+                                                "Radiation::InitRecv");
+    id.hyd_irecv = tl["before_stagen"]->AddTask(&hydro::Hydro::InitRecv, phyd, none,
+                                                "Hydro::InitRecv");
 
     // assemble "stagen" task list
-    id.copyu     = tl["stagen"]->AddTask(&Radiation::CopyCons, this, none);
-    id.rad_flux  = tl["stagen"]->AddTask(&Radiation::CalculateFluxes, this, id.copyu);
-    id.rad_sendf = tl["stagen"]->AddTask(&Radiation::SendFlux, this, id.rad_flux);
-    id.rad_recvf = tl["stagen"]->AddTask(&Radiation::RecvFlux, this, id.rad_sendf);
-    id.rad_rkupdt= tl["stagen"]->AddTask(&Radiation::RKUpdate, this, id.rad_recvf);
-    id.hyd_flux  = tl["stagen"]->AddTask(&hydro::Hydro::Fluxes, phyd, id.rad_rkupdt);
-    id.hyd_sendf = tl["stagen"]->AddTask(&hydro::Hydro::SendFlux, phyd, id.hyd_flux);
-    id.hyd_recvf = tl["stagen"]->AddTask(&hydro::Hydro::RecvFlux, phyd, id.hyd_sendf);
-    id.hyd_rkupdt= tl["stagen"]->AddTask(&hydro::Hydro::RKUpdate,phyd,id.hyd_recvf);
+    // as above, the hydro flux chain depends only on copyu so it overlaps with
+    // radiation transport; chains join at the (implicit) radiation source term
+    id.copyu     = tl["stagen"]->AddTask(&Radiation::CopyCons, this, none,
+                                         "Radiation::CopyCons");
+    id.rad_flux  = tl["stagen"]->AddTask(&Radiation::CalculateFluxes, this, id.copyu,
+                                         "Radiation::CalculateFluxes", rad_async);
+    id.rad_sendf = tl["stagen"]->AddTask(&Radiation::SendFlux, this, id.rad_flux,
+                                         "Radiation::SendFlux");
+    id.rad_recvf = tl["stagen"]->AddTask(&Radiation::RecvFlux, this, id.rad_sendf,
+                                         "Radiation::RecvFlux");
+    id.rad_rkupdt= tl["stagen"]->AddTask(&Radiation::RKUpdate, this, id.rad_recvf,
+                                         "Radiation::RKUpdate", rad_async);
+    id.hyd_flux  = tl["stagen"]->AddTask(&hydro::Hydro::Fluxes, phyd, id.copyu,
+                                         "Hydro::Fluxes");
+    id.hyd_sendf = tl["stagen"]->AddTask(&hydro::Hydro::SendFlux, phyd, id.hyd_flux,
+                                         "Hydro::SendFlux");
+    id.hyd_recvf = tl["stagen"]->AddTask(&hydro::Hydro::RecvFlux, phyd, id.hyd_sendf,
+                                         "Hydro::RecvFlux");
+    id.hyd_rkupdt= tl["stagen"]->AddTask(&hydro::Hydro::RKUpdate,phyd,id.hyd_recvf,
+                                         "Hydro::RKUpdate");
+    TaskID src_dep = (id.hyd_rkupdt | id.rad_rkupdt);
     id.rad_src   = tl["stagen"]->AddTask(
-                                   &Radiation::AddRadiationSourceTerm,this,id.hyd_rkupdt);
-    id.rad_resti = tl["stagen"]->AddTask(&Radiation::RestrictI, this, id.rad_src);
-    id.rad_sendi = tl["stagen"]->AddTask(&Radiation::SendI, this, id.rad_resti);
-    id.rad_recvi = tl["stagen"]->AddTask(&Radiation::RecvI, this, id.rad_sendi);
-    id.hyd_restu = tl["stagen"]->AddTask(&hydro::Hydro::RestrictU, phyd, id.rad_recvi);
-    id.hyd_sendu = tl["stagen"]->AddTask(&hydro::Hydro::SendU, phyd, id.hyd_restu);
-    id.hyd_recvu = tl["stagen"]->AddTask(&hydro::Hydro::RecvU, phyd, id.hyd_sendu);
+                                   &Radiation::AddRadiationSourceTerm,this,src_dep,
+                                       "Radiation::AddRadiationSourceTerm");
+    id.rad_resti = tl["stagen"]->AddTask(&Radiation::RestrictI, this, id.rad_src,
+                                         "Radiation::RestrictI");
+    id.rad_sendi = tl["stagen"]->AddTask(&Radiation::SendI, this, id.rad_resti,
+                                         "Radiation::SendI");
+    id.rad_recvi = tl["stagen"]->AddTask(&Radiation::RecvI, this, id.rad_sendi,
+                                         "Radiation::RecvI");
+    id.hyd_restu = tl["stagen"]->AddTask(&hydro::Hydro::RestrictU, phyd, id.rad_recvi,
+                                         "Hydro::RestrictU");
+    id.hyd_sendu = tl["stagen"]->AddTask(&hydro::Hydro::SendU, phyd, id.hyd_restu,
+                                         "Hydro::SendU");
+    id.hyd_recvu = tl["stagen"]->AddTask(&hydro::Hydro::RecvU, phyd, id.hyd_sendu,
+                                         "Hydro::RecvU");
     id.bcs       = tl["stagen"]->AddTask(
-                                    &Radiation::ApplyPhysicalBCs, this, id.hyd_recvu);
-    id.rad_prol  = tl["stagen"]->AddTask(&Radiation::Prolongate, this, id.bcs);
-    id.hyd_prol  = tl["stagen"]->AddTask(&hydro::Hydro::Prolongate, phyd, id.rad_prol);
-    id.hyd_c2p   = tl["stagen"]->AddTask(&hydro::Hydro::ConToPrim, phyd, id.hyd_prol);
+                                    &Radiation::ApplyPhysicalBCs, this, id.hyd_recvu,
+                                        "Radiation::ApplyPhysicalBCs");
+    id.rad_prol  = tl["stagen"]->AddTask(&Radiation::Prolongate, this, id.bcs,
+                                         "Radiation::Prolongate");
+    id.hyd_prol  = tl["stagen"]->AddTask(&hydro::Hydro::Prolongate, phyd, id.rad_prol,
+                                         "Hydro::Prolongate");
+    id.hyd_c2p   = tl["stagen"]->AddTask(&hydro::Hydro::ConToPrim, phyd, id.hyd_prol,
+                                         "Hydro::ConToPrim");
 
     // assemble "after_stagen" task list
     // assemble end task list
-    id.rad_csend = tl["after_stagen"]->AddTask(&Radiation::ClearSend, this, none);
-    id.hyd_csend = tl["after_stagen"]->AddTask(&hydro::Hydro::ClearSend, phyd, none);
+    id.rad_csend = tl["after_stagen"]->AddTask(&Radiation::ClearSend, this, none,
+                                               "Radiation::ClearSend");
+    id.hyd_csend = tl["after_stagen"]->AddTask(&hydro::Hydro::ClearSend, phyd, none,
+                                               "Hydro::ClearSend");
     // although RecvFlux/U/E/B functions check that all recvs complete, add ClearRecv to
     // task list anyways to catch potential bugs in MPI communication logic
-    id.rad_crecv = tl["after_stagen"]->AddTask(&Radiation::ClearRecv, this, id.rad_csend);
+    id.rad_crecv = tl["after_stagen"]->AddTask(&Radiation::ClearRecv, this, id.rad_csend,
+                                               "Radiation::ClearRecv");
     id.hyd_crecv = tl["after_stagen"]->AddTask(
-                                       &hydro::Hydro::ClearRecv, phyd, id.hyd_csend);
+                                       &hydro::Hydro::ClearRecv, phyd, id.hyd_csend,
+                                           "Hydro::ClearRecv");
 
   } else {  // radiation transport
     // assemble "before_stagen" task list
-    id.rad_irecv = tl["before_stagen"]->AddTask(&Radiation::InitRecv, this, none);
+    id.rad_irecv = tl["before_stagen"]->AddTask(&Radiation::InitRecv, this, none,
+                                                "Radiation::InitRecv");
 
     // assemble "stagen" task list
-    id.copyu     = tl["stagen"]->AddTask(&Radiation::CopyCons, this, none);
-    id.rad_flux  = tl["stagen"]->AddTask(&Radiation::CalculateFluxes, this, id.copyu);
-    id.rad_sendf = tl["stagen"]->AddTask(&Radiation::SendFlux, this, id.rad_flux);
-    id.rad_recvf = tl["stagen"]->AddTask(&Radiation::RecvFlux, this, id.rad_sendf);
-    id.rad_rkupdt= tl["stagen"]->AddTask(&Radiation::RKUpdate, this, id.rad_recvf);
+    id.copyu     = tl["stagen"]->AddTask(&Radiation::CopyCons, this, none,
+                                         "Radiation::CopyCons");
+    id.rad_flux  = tl["stagen"]->AddTask(&Radiation::CalculateFluxes, this, id.copyu,
+                                         "Radiation::CalculateFluxes");
+    id.rad_sendf = tl["stagen"]->AddTask(&Radiation::SendFlux, this, id.rad_flux,
+                                         "Radiation::SendFlux");
+    id.rad_recvf = tl["stagen"]->AddTask(&Radiation::RecvFlux, this, id.rad_sendf,
+                                         "Radiation::RecvFlux");
+    id.rad_rkupdt= tl["stagen"]->AddTask(&Radiation::RKUpdate, this, id.rad_recvf,
+                                         "Radiation::RKUpdate");
     id.rad_src   = tl["stagen"]->AddTask(
-                                   &Radiation::AddRadiationSourceTerm,this,id.rad_rkupdt);
-    id.rad_resti = tl["stagen"]->AddTask(&Radiation::RestrictI, this, id.rad_src);
-    id.rad_sendi = tl["stagen"]->AddTask(&Radiation::SendI, this, id.rad_resti);
-    id.rad_recvi = tl["stagen"]->AddTask(&Radiation::RecvI, this, id.rad_sendi);
+                                   &Radiation::AddRadiationSourceTerm,this,id.rad_rkupdt,
+                                       "Radiation::AddRadiationSourceTerm");
+    id.rad_resti = tl["stagen"]->AddTask(&Radiation::RestrictI, this, id.rad_src,
+                                         "Radiation::RestrictI");
+    id.rad_sendi = tl["stagen"]->AddTask(&Radiation::SendI, this, id.rad_resti,
+                                         "Radiation::SendI");
+    id.rad_recvi = tl["stagen"]->AddTask(&Radiation::RecvI, this, id.rad_sendi,
+                                         "Radiation::RecvI");
     id.bcs       = tl["stagen"]->AddTask(
-                                    &Radiation::ApplyPhysicalBCs, this, id.rad_recvi);
-    id.rad_prol  = tl["stagen"]->AddTask(&Radiation::Prolongate, this, id.bcs);
+                                    &Radiation::ApplyPhysicalBCs, this, id.rad_recvi,
+                                        "Radiation::ApplyPhysicalBCs");
+    id.rad_prol  = tl["stagen"]->AddTask(&Radiation::Prolongate, this, id.bcs,
+                                         "Radiation::Prolongate");
 
     // assemble "after_stagen" task list
-    id.rad_csend = tl["after_stagen"]->AddTask(&Radiation::ClearSend, this, none);
+    id.rad_csend = tl["after_stagen"]->AddTask(&Radiation::ClearSend, this, none,
+                                               "Radiation::ClearSend");
     // although RecvFlux/U/E/B functions check that all recvs complete, add ClearRecv to
     // task list anyways to catch potential bugs in MPI communication logic
-    id.rad_crecv = tl["after_stagen"]->AddTask(&Radiation::ClearRecv, this, id.rad_csend);
+    id.rad_crecv = tl["after_stagen"]->AddTask(&Radiation::ClearRecv, this, id.rad_csend,
+                                               "Radiation::ClearRecv");
+  }
+
+  // operator-split implicit transport solve, once per cycle over the full dt (the RK
+  // stages then carry only the source terms; ghost intensities exchanged during the
+  // stages provide the lagged block-Jacobi coupling)
+  if (implicit_transport) {
+    id.rad_implicit = tl["after_timeintegrator"]->AddTask(
+                                   &Radiation::ImplicitTransportUpdate, this, none,
+                                       "Radiation::ImplicitTransportUpdate");
   }
 
   return;
@@ -160,8 +253,8 @@ TaskStatus Radiation::InitRecv(Driver *pdrive, int stage) {
 
   // do not post receives for fluxes when stage < 0 (i.e. ICs)
   if (stage >= 0) {
-    // with SMR/AMR, post receives for fluxes of I
-    if (pmy_pack->pmesh->multilevel) {
+    // with SMR/AMR, post receives for fluxes of I (none sent w/ implicit transport)
+    if (pmy_pack->pmesh->multilevel && !(implicit_transport)) {
       tstat = pbval_i->InitFluxRecv(prgeo->nangles);
       if (tstat != TaskStatus::complete) return tstat;
     }
@@ -201,8 +294,9 @@ TaskStatus Radiation::CopyCons(Driver *pdrive, int stage) {
 
 TaskStatus Radiation::SendFlux(Driver *pdrive, int stage) {
   TaskStatus tstat = TaskStatus::complete;
-  // Only execute BoundaryValues function with SMR/SMR
-  if (pmy_pack->pmesh->multilevel)  {
+  // Only execute BoundaryValues function with SMR/SMR (no fluxes to correct when
+  // transport is implicit)
+  if (pmy_pack->pmesh->multilevel && !(implicit_transport))  {
     tstat = pbval_i->PackAndSendFluxCC(iflx);
   }
   return tstat;
@@ -214,11 +308,14 @@ TaskStatus Radiation::SendFlux(Driver *pdrive, int stage) {
 //! conserved variables at fine/coarse boundaries
 
 TaskStatus Radiation::RecvFlux(Driver *pdrive, int stage) {
+  profiler::WaitTimer wtimer("rad_recv_flux", stage);
   TaskStatus tstat = TaskStatus::complete;
-  // Only execute BoundaryValues function with SMR/SMR
-  if (pmy_pack->pmesh->multilevel) {
+  // Only execute BoundaryValues function with SMR/SMR (no fluxes to correct when
+  // transport is implicit)
+  if (pmy_pack->pmesh->multilevel && !(implicit_transport)) {
     tstat = pbval_i->RecvAndUnpackFluxCC(iflx);
   }
+  if (tstat == TaskStatus::complete) {wtimer.Completed();}
   return tstat;
 }
 
@@ -228,8 +325,10 @@ TaskStatus Radiation::RecvFlux(Driver *pdrive, int stage) {
 
 TaskStatus Radiation::RestrictI(Driver *pdrive, int stage) {
   // Only execute Mesh function with SMR/AMR
+  // Restriction is limited to interface-adjacent cells; coarse data is only consumed by
+  // sends to coarser neighbors and prolongation stencils.
   if (pmy_pack->pmesh->multilevel) {
-    pmy_pack->pmesh->pmr->RestrictCC(i0, coarse_i0);
+    pbval_i->RestrictInterfaceCC(i0, coarse_i0);
   }
   return TaskStatus::complete;
 }
@@ -248,7 +347,9 @@ TaskStatus Radiation::SendI(Driver *pdrive, int stage) {
 //! \brief Wrapper task list function to receive/unpack cell-centered conserved variables
 
 TaskStatus Radiation::RecvI(Driver *pdrive, int stage) {
+  profiler::WaitTimer wtimer("rad_recv_i", stage);
   TaskStatus tstat = pbval_i->RecvAndUnpackCC(i0, coarse_i0);
+  if (tstat == TaskStatus::complete) {wtimer.Completed();}
   return tstat;
 }
 
@@ -307,7 +408,7 @@ TaskStatus Radiation::ClearSend(Driver *pdrive, int stage) {
   // do not check flux send for ICs (stage < 0)
   if (stage >= 0) {
     // with SMR/AMR check sends of restricted fluxes of U complete
-    if (pmy_pack->pmesh->multilevel) {
+    if (pmy_pack->pmesh->multilevel && !(implicit_transport)) {
       tstat = pbval_i->ClearFluxSend();
       if (tstat != TaskStatus::complete) return tstat;
     }
@@ -329,7 +430,7 @@ TaskStatus Radiation::ClearRecv(Driver *pdrive, int stage) {
   // do not check flux receives when stage < 0 (i.e. ICs)
   if (stage >= 0) {
     // with SMR/AMR check receives of restricted fluxes of U complete
-    if (pmy_pack->pmesh->multilevel) {
+    if (pmy_pack->pmesh->multilevel && !(implicit_transport)) {
       tstat = pbval_i->ClearFluxRecv();
       if (tstat != TaskStatus::complete) return tstat;
     }
@@ -277,4 +277,102 @@ void Radiation::SetOrthonormalTetrad() {
   return;
 }
 
+//----------------------------------------------------------------------------------------
+//! \fn  void Radiation::ComputeFrameTables()
+//! \brief Tabulate the per-angle contractions of the (already cached) tetrad with nh_c
+//! at faces and cell centers, and the cell-centered lapse and spatial metric.  Computed
+//! once at setup and consumed by the flux, update, and source kernels when the
+//! frame_tables option is enabled.  Must be called after SetOrthonormalTetrad().
+
+void Radiation::ComputeFrameTables() {
+  auto &size = pmy_pack->pmb->mb_size;
+  auto &indcs = pmy_pack->pmesh->mb_indcs;
+  int &ng = indcs.ng;
+  int n1 = indcs.nx1 + 2*ng;
+  int n2 = (indcs.nx2 > 1)? (indcs.nx2 + 2*ng) : 1;
+  int n3 = (indcs.nx3 > 1)? (indcs.nx3 + 2*ng) : 1;
+  int &is = indcs.is;
+  int &js = indcs.js;
+  int &ks = indcs.ks;
+  int &nmb = pmy_pack->nmb_thispack;
+  int nang1 = prgeo->nangles - 1;
+  auto &nh_c_ = nh_c;
+
+  // n^1 at x1 faces
+  auto &t1d1 = tet_d1_x1f;
+  auto n1_x1f_ = n1_x1f;
+  par_for("n1_x1f",DevExeSpace(),0,(nmb-1),0,nang1,0,(n3-1),0,(n2-1),0,n1,
+  KOKKOS_LAMBDA(int m, int n, int k, int j, int i) {
+    n1_x1f_(m,n,k,j,i) = t1d1(m,0,k,j,i)*nh_c_.d_view(n,0)
+                       + t1d1(m,1,k,j,i)*nh_c_.d_view(n,1)
+                       + t1d1(m,2,k,j,i)*nh_c_.d_view(n,2)
+                       + t1d1(m,3,k,j,i)*nh_c_.d_view(n,3);
+  });
+
+  // n^2 at x2 faces
+  auto &t2d2 = tet_d2_x2f;
+  auto n2_x2f_ = n2_x2f;
+  par_for("n2_x2f",DevExeSpace(),0,(nmb-1),0,nang1,0,(n3-1),0,n2,0,(n1-1),
+  KOKKOS_LAMBDA(int m, int n, int k, int j, int i) {
+    n2_x2f_(m,n,k,j,i) = t2d2(m,0,k,j,i)*nh_c_.d_view(n,0)
+                       + t2d2(m,1,k,j,i)*nh_c_.d_view(n,1)
+                       + t2d2(m,2,k,j,i)*nh_c_.d_view(n,2)
+                       + t2d2(m,3,k,j,i)*nh_c_.d_view(n,3);
+  });
+
+  // n^3 at x3 faces
+  auto &t3d3 = tet_d3_x3f;
+  auto n3_x3f_ = n3_x3f;
+  par_for("n3_x3f",DevExeSpace(),0,(nmb-1),0,nang1,0,n3,0,(n2-1),0,(n1-1),
+  KOKKOS_LAMBDA(int m, int n, int k, int j, int i) {
+    n3_x3f_(m,n,k,j,i) = t3d3(m,0,k,j,i)*nh_c_.d_view(n,0)
+                       + t3d3(m,1,k,j,i)*nh_c_.d_view(n,1)
+                       + t3d3(m,2,k,j,i)*nh_c_.d_view(n,2)
+                       + t3d3(m,3,k,j,i)*nh_c_.d_view(n,3);
+  });
+
+  // n_0 at cell centers
+  auto &tc = tetcov_c;
+  auto n_0_cc_ = n_0_cc;
+  par_for("n_0_cc",DevExeSpace(),0,(nmb-1),0,nang1,0,(n3-1),0,(n2-1),0,(n1-1),
+  KOKKOS_LAMBDA(int m, int n, int k, int j, int i) {
+    n_0_cc_(m,n,k,j,i) = tc(m,0,0,k,j,i)*nh_c_.d_view(n,0)
+                       + tc(m,1,0,k,j,i)*nh_c_.d_view(n,1)
+                       + tc(m,2,0,k,j,i)*nh_c_.d_view(n,2)
+                       + tc(m,3,0,k,j,i)*nh_c_.d_view(n,3);
+  });
+
+  // lapse and spatial metric at cell centers (only pieces used by the source kernel)
+  auto &coord = pmy_pack->pcoord->coord_data;
+  bool &flat = coord.is_minkowski;
+  Real &spin = coord.bh_spin;
+  auto gcov_cc_ = gcov_cc;
+  par_for("gcov_cc",DevExeSpace(),0,(nmb-1),0,(n3-1),0,(n2-1),0,(n1-1),
+  KOKKOS_LAMBDA(int m, int k, int j, int i) {
+    Real &x1min = size.d_view(m).x1min;
+    Real &x1max = size.d_view(m).x1max;
+    Real x1v = CellCenterX(i-is, indcs.nx1, x1min, x1max);
+
+    Real &x2min = size.d_view(m).x2min;
+    Real &x2max = size.d_view(m).x2max;
+    Real x2v = CellCenterX(j-js, indcs.nx2, x2min, x2max);
+
+    Real &x3min = size.d_view(m).x3min;
+    Real &x3max = size.d_view(m).x3max;
+    Real x3v = CellCenterX(k-ks, indcs.nx3, x3min, x3max);
+
+    Real glower[4][4], gupper[4][4];
+    ComputeMetricAndInverse(x1v,x2v,x3v,flat,spin,glower,gupper);
+    gcov_cc_(m,0,k,j,i) = sqrt(-1.0/gupper[0][0]);
+    gcov_cc_(m,1,k,j,i) = glower[1][1];
+    gcov_cc_(m,2,k,j,i) = glower[1][2];
+    gcov_cc_(m,3,k,j,i) = glower[1][3];
+    gcov_cc_(m,4,k,j,i) = glower[2][2];
+    gcov_cc_(m,5,k,j,i) = glower[2][3];
+    gcov_cc_(m,6,k,j,i) = glower[3][3];
+  });
+
+  return;
+}
+
 } // namespace radiation
@@ -26,6 +26,17 @@ namespace radiation {
 //  \brief Explicit RK update of flux divergence and physical source terms
 
 TaskStatus Radiation::RKUpdate(Driver *pdriver, int stage) {
+  // with implicit transport the flux-divergence update is replaced by the operator-
+  // split backward-Euler solve in ImplicitTransportUpdate; only the beam source term
+  // (if any) is applied within the stages
+  if (implicit_transport) {
+    if (psrc->beam) {
+      Real beta_dt = (pdriver->beta[stage-1])*(pmy_pack->pmesh->dt);
+      psrc->BeamSource(i0, beta_dt);
+    }
+    return TaskStatus::complete;
+  }
+
   auto &indcs = pmy_pack->pmesh->mb_indcs;
   int &is = indcs.is, &ie = indcs.ie;
   int &js = indcs.js, &je = indcs.je;
@@ -57,10 +68,25 @@ TaskStatus Radiation::RKUpdate(Driver *pdriver, int stage) {
 
   auto &excise = pmy_pack->pcoord->coord_data.bh_excise;
   auto &rad_mask_ = pmy_pack->pcoord->excision_floor;
+  auto &mb_excised_ = pmy_pack->pcoord->mb_excised;
   Real &n_0_floor_ = n_0_floor;
 
-  par_for("r_update",DevExeSpace(),0,nmb1,0,nang1,ks,ke,js,je,is,ie,
+  bool &coarsen_ = angular_coarsening;
+  auto &coarse_mb_ = coarse_mb;
+  auto &lead_ = ang_leader;
+
+  // cached frame-transformation tables (see ComputeFrameTables)
+  bool &tables_ = frame_tables;
+  auto &n_0_cc_ = n_0_cc;
+
+  // stream this task was launched on (default instance unless task flagged async)
+  DevExeSpace exec = pdriver->ExecSpace();
+
+  par_for("r_update",exec,0,nmb1,0,nang1,ks,ke,js,je,is,ie,
   KOKKOS_LAMBDA(int m, int n, int k, int j, int i) {
+    // skip angles not transported in coarsened MeshBlocks (no fluxes were computed)
+    if (coarsen_ && coarse_mb_(m) && (lead_.d_view(n) != n)) {return;}
+
     // spatial fluxes
     Real divf_s = (flx1(m,n,k,j,i+1) - flx1(m,n,k,j,i))/mbsize.d_view(m).dx1;
     if (multi_d) {
@@ -76,8 +102,9 @@ TaskStatus Radiation::RKUpdate(Driver *pdriver, int stage) {
 
     // zero intensity if negative
     Real n0  = tt(m,0,0,k,j,i);
-    Real n_0 = tc(m,0,0,k,j,i)*nh_c_.d_view(n,0) + tc(m,1,0,k,j,i)*nh_c_.d_view(n,1) +
-               tc(m,2,0,k,j,i)*nh_c_.d_view(n,2) + tc(m,3,0,k,j,i)*nh_c_.d_view(n,3);
+    Real n_0 = (tables_)? n_0_cc_(m,n,k,j,i) :
+               (tc(m,0,0,k,j,i)*nh_c_.d_view(n,0) + tc(m,1,0,k,j,i)*nh_c_.d_view(n,1) +
+                tc(m,2,0,k,j,i)*nh_c_.d_view(n,2) + tc(m,3,0,k,j,i)*nh_c_.d_view(n,3));
     i0_(m,n,k,j,i) = n0*n_0*fmax((i0_(m,n,k,j,i)/(n0*n_0)), 0.0);
 
     // handle excision
@@ -85,13 +112,22 @@ TaskStatus Radiation::RKUpdate(Driver *pdriver, int stage) {
     // intensities within rks <= 1.0 and zeroes intensities within angles where n_0
     // is about zero.  This needs future attention.
     if (excise) {
-      if (rad_mask_(m,k,j,i) || fabs(n_0) < n_0_floor_) { i0_(m,n,k,j,i) = 0.0; }
+      // per-MB flag skips mask read on MBs with no excised cells
+      if ((mb_excised_(m) && rad_mask_(m,k,j,i)) || fabs(n_0) < n_0_floor_) {
+        i0_(m,n,k,j,i) = 0.0;
+      }
     }
   });
 
   // add beam source term, if any
   if (psrc->beam)  psrc->BeamSource(i0_, beta_dt);
 
+  // with angular coarsening, refill sibling angles in coarsened MeshBlocks from the
+  // coarse representation (moment-preserving by default, see ProlongateAngles)
+  if (coarsen_) {
+    ProlongateAngles(exec);
+  }
+
   return TaskStatus::complete;
 }
 
@@ -54,6 +54,38 @@ void PiecewiseLinearX1(TeamMember_t const &member, const int m, const int k, con
   return;
 }
 
+//----------------------------------------------------------------------------------------
+//! \fn PiecewiseLinearX1()
+//! \brief Overload taking the EOS data that applies the density/internal-energy floors
+//! directly to the reconstructed interface states ("floor on read", as in the PPM and
+//! WENOZ wrappers), so the Riemann solver never sees sub-floor inputs and FOFC is not
+//! tripped by floor/reconstruction inconsistencies.  Used for the fluid variables; the
+//! un-floored overload above remains for fields and other quantities without floors.
+
+KOKKOS_INLINE_FUNCTION
+void PiecewiseLinearX1(TeamMember_t const &member, const EOS_Data &eos,
+     const int m, const int k, const int j, const int il, const int iu,
+     const DvceArray5D<Real> &q, ScrArray2D<Real> &ql, ScrArray2D<Real> &qr) {
+  int nvar = q.extent_int(1);
+  const Real &dfloor_ = eos.dfloor;
+  // TODO(jmstone): ideal gas only for now
+  Real efloor_ = eos.pfloor*eos.igm1;
+  for (int n=0; n<nvar; ++n) {
+    par_for_inner(member, il, iu, [&](const int i) {
+      PLM(q(m,n,k,j,i-1), q(m,n,k,j,i), q(m,n,k,j,i+1), ql(n,i+1), qr(n,i));
+      if (n==IDN) {
+        ql(IDN,i+1) = fmax(ql(IDN,i+1), dfloor_);
+        qr(IDN,i  ) = fmax(qr(IDN,i  ), dfloor_);
+      }
+      if (eos.is_ideal && (n==IEN)) {
+        ql(IEN,i+1) = fmax(ql(IEN,i+1), efloor_);
+        qr(IEN,i  ) = fmax(qr(IEN,i  ), efloor_);
+      }
+    });
+  }
+  return;
+}
+
 //----------------------------------------------------------------------------------------
 //! \fn PiecewiseLinearX2()
 //! \brief Wrapper function for PLM reconstruction in x2-direction.
@@ -72,6 +104,34 @@ void PiecewiseLinearX2(TeamMember_t const &member, const int m, const int k, con
   return;
 }
 
+//----------------------------------------------------------------------------------------
+//! \fn PiecewiseLinearX2()
+//! \brief Overload applying floors to the reconstructed states (see X1 overload above)
+
+KOKKOS_INLINE_FUNCTION
+void PiecewiseLinearX2(TeamMember_t const &member, const EOS_Data &eos,
+     const int m, const int k, const int j, const int il, const int iu,
+     const DvceArray5D<Real> &q, ScrArray2D<Real> &ql_jp1, ScrArray2D<Real> &qr_j) {
+  int nvar = q.extent_int(1);
+  const Real &dfloor_ = eos.dfloor;
+  // TODO(jmstone): ideal gas only for now
+  Real efloor_ = eos.pfloor*eos.igm1;
+  for (int n=0; n<nvar; ++n) {
+    par_for_inner(member, il, iu, [&](const int i) {
+      PLM(q(m,n,k,j-1,i), q(m,n,k,j,i), q(m,n,k,j+1,i), ql_jp1(n,i), qr_j(n,i));
+      if (n==IDN) {
+        ql_jp1(IDN,i) = fmax(ql_jp1(IDN,i), dfloor_);
+        qr_j  (IDN,i) = fmax(qr_j  (IDN,i), dfloor_);
+      }
+      if (eos.is_ideal && (n==IEN)) {
+        ql_jp1(IEN,i) = fmax(ql_jp1(IEN,i), efloor_);
+        qr_j  (IEN,i) = fmax(qr_j  (IEN,i), efloor_);
+      }
+    });
+  }
+  return;
+}
+
 //----------------------------------------------------------------------------------------
 //! \fn PiecewiseLinearX3()
 //! \brief Wrapper function for PLM reconstruction in x3-direction.
@@ -89,4 +149,32 @@ void PiecewiseLinearX3(TeamMember_t const &member, const int m, const int k, con
   }
   return;
 }
+
+//----------------------------------------------------------------------------------------
+//! \fn PiecewiseLinearX3()
+//! \brief Overload applying floors to the reconstructed states (see X1 overload above)
+
+KOKKOS_INLINE_FUNCTION
+void PiecewiseLinearX3(TeamMember_t const &member, const EOS_Data &eos,
+     const int m, const int k, const int j, const int il, const int iu,
+     const DvceArray5D<Real> &q, ScrArray2D<Real> &ql_kp1, ScrArray2D<Real> &qr_k) {
+  int nvar = q.extent_int(1);
+  const Real &dfloor_ = eos.dfloor;
+  // TODO(jmstone): ideal gas only for now
+  Real efloor_ = eos.pfloor*eos.igm1;
+  for (int n=0; n<nvar; ++n) {
+    par_for_inner(member, il, iu, [&](const int i) {
+      PLM(q(m,n,k-1,j,i), q(m,n,k,j,i), q(m,n,k+1,j,i), ql_kp1(n,i), qr_k(n,i));
+      if (n==IDN) {
+        ql_kp1(IDN,i) = fmax(ql_kp1(IDN,i), dfloor_);
+        qr_k  (IDN,i) = fmax(qr_k  (IDN,i), dfloor_);
+      }
+      if (eos.is_ideal && (n==IEN)) {
+        ql_kp1(IEN,i) = fmax(ql_kp1(IEN,i), efloor_);
+        qr_k  (IEN,i) = fmax(qr_k  (IEN,i), efloor_);
+      }
+    });
+  }
+  return;
+}
 #endif // RECONSTRUCT_PLM_HPP_
@@ -185,26 +185,30 @@ void PPMX(const Real &q_im2, const Real &q_im1, const Real &q_i, const Real &q_i
 //----------------------------------------------------------------------------------------
 //! \fn PiecewiseParabolicX1()
 //! \brief Wrapper function for PPM reconstruction in x1-direction.
-//! This function should be called over [is-1,ie+1] to get BOTH L/R states over [is,ie]
+//! This function should be called over [is-1,ie+1] to get BOTH L/R states over [is,ie].
+//! The scratch pencil qs must hold at least (iu+3) elements; each variable's row of q is
+//! staged into it once, so the five-point stencils of the five faces touching each cell
+//! all read the staged copy and global memory reads of q are cut ~5x.
 
 KOKKOS_INLINE_FUNCTION
 void PiecewiseParabolicX1(TeamMember_t const &member,
      const EOS_Data &eos, const bool extremum_preserving, const bool apply_floors,
      const int m, const int k, const int j, const int il, const int iu,
-     const DvceArray5D<Real> &q, ScrArray2D<Real> &ql, ScrArray2D<Real> &qr) {
+     const DvceArray5D<Real> &q, ScrArray1D<Real> &qs,
+     ScrArray2D<Real> &ql, ScrArray2D<Real> &qr) {
   int nvar = q.extent_int(1);
   const Real &dfloor_ = eos.dfloor;
   // TODO(jmstone): ideal gas only for now
-  Real efloor_ = eos.pfloor/(eos.gamma - 1.0);
+  Real efloor_ = eos.pfloor*eos.igm1;
   for (int n=0; n<nvar; ++n) {
+    // stage pencil of this variable (including stencil ghosts) into scratch memory
+    par_for_inner(member, il-2, iu+2, [&](const int i) {
+      qs(i) = q(m,n,k,j,i);
+    });
+    member.team_barrier();
     if (extremum_preserving) {
       par_for_inner(member, il, iu, [&](const int i) {
-        Real &qim2 = q(m,n,k,j,i-2);
-        Real &qim1 = q(m,n,k,j,i-1);
-        Real &qi   = q(m,n,k,j,i  );
-        Real &qip1 = q(m,n,k,j,i+1);
-        Real &qip2 = q(m,n,k,j,i+2);
-        PPMX(qim2, qim1, qi, qip1, qip2, ql(n,i+1), qr(n,i));
+        PPMX(qs(i-2), qs(i-1), qs(i), qs(i+1), qs(i+2), ql(n,i+1), qr(n,i));
         if (apply_floors) {
           if (n==IDN) {
             ql(IDN,i+1) = fmax(ql(IDN,i+1), dfloor_);
@@ -218,14 +222,11 @@ void PiecewiseParabolicX1(TeamMember_t const &member,
       });
     } else {
       par_for_inner(member, il, iu, [&](const int i) {
-        Real &qim2 = q(m,n,k,j,i-2);
-        Real &qim1 = q(m,n,k,j,i-1);
-        Real &qi   = q(m,n,k,j,i  );
-        Real &qip1 = q(m,n,k,j,i+1);
-        Real &qip2 = q(m,n,k,j,i+2);
-        PPM4(qim2, qim1, qi, qip1, qip2, ql(n,i+1), qr(n,i));
+        PPM4(qs(i-2), qs(i-1), qs(i), qs(i+1), qs(i+2), ql(n,i+1), qr(n,i));
       });
     }
+    // guard against the next variable's staging overwriting qs while still in use
+    member.team_barrier();
   }
   return;
 }
@@ -243,7 +244,7 @@ void PiecewiseParabolicX2(TeamMember_t const &member,
   int nvar = q.extent_int(1);
   const Real &dfloor_ = eos.dfloor;
   // TODO(jmstone): ideal gas only for now
-  Real efloor_ = eos.pfloor/(eos.gamma - 1.0);
+  Real efloor_ = eos.pfloor*eos.igm1;
   for (int n=0; n<nvar; ++n) {
     if (extremum_preserving) {
       par_for_inner(member, il, iu, [&](const int i) {
@@ -291,7 +292,7 @@ void PiecewiseParabolicX3(TeamMember_t const &member,
   int nvar = q.extent_int(1);
   const Real &dfloor_ = eos.dfloor;
   // TODO(jmstone): ideal gas only for now
-  Real efloor_ = eos.pfloor/(eos.gamma - 1.0);
+  Real efloor_ = eos.pfloor*eos.igm1;
   for (int n=0; n<nvar; ++n) {
     if (extremum_preserving) {
       par_for_inner(member, il, iu, [&](const int i) {
@@ -7,9 +7,11 @@
 //! \brief constructor for OrbitalAdvection abstract base class.
 
 #include <algorithm>
+#include <array>
 #include <cstdlib>
 #include <iostream>
 #include <utility>
+#include <vector>
 
 #include "athena.hpp"
 #include "globals.hpp"
@@ -45,6 +47,10 @@ OrbitalAdvection::OrbitalAdvection(MeshBlockPack *ppack, ParameterInput *pin) :
   }
   // create unique communicators for shearing box
   MPI_Comm_dup(MPI_COMM_WORLD, &comm_orb_advect);
+
+  // aggregate all orbital advection buffers exchanged with each remote rank into a
+  // single message per rank pair.  Uses same input flag as MeshBoundaryValues.
+  coalesced_comm = pin->GetOrAddBoolean("mesh", "coalesced_bvals", false);
 #endif
 }
 
@@ -59,3 +65,194 @@ OrbitalAdvection::~OrbitalAdvection() {
   }
 #endif
 }
+
+#if MPI_PARALLEL_ENABLED
+//----------------------------------------------------------------------------------------
+//! \fn void OrbitalAdvection::InitCoalescedIndices()
+//! \brief Builds tables describing the layout of each MeshBlock buffer within the single
+//! aggregated message exchanged with each remote rank.  All buffers have the same size,
+//! so only the (m,n) indices of each buffer need be stored, in message order.  Send-side
+//! entries are ordered by (local ID, buffer index) of the receiving MeshBlock so both
+//! ends agree on the layout.  Must be called after derived class constructors have
+//! allocated the boundary buffers; connectivity is fixed since mesh refinement is not
+//! allowed in x2 with orbital advection.
+
+void OrbitalAdvection::InitCoalescedIndices() {
+  const int &nmb = pmy_pack->nmb_thispack;
+  auto &nghbr = pmy_pack->pmb->nghbr;
+  int my_rank = global_variable::my_rank;
+
+  // number of Reals in every (fixed size) MeshBlock buffer
+  coal_cnt = (sendbuf[0].vars.extent_int(1))*(sendbuf[0].vars.extent_int(2))*
+             (sendbuf[0].vars.extent_int(3))*(sendbuf[0].vars.extent_int(4));
+
+  // collect (sort key, m, n) of every buffer exchanged with a remote rank
+  std::vector<std::array<int,5>> slist, rlist;  // {rank, lid, dn, m, n}
+  for (int m=0; m<nmb; ++m) {
+    for (int n=0; n<2; ++n) {
+      // indices of x2-face buffers in nghbr view
+      int nnghbr;
+      if (n==0) {nnghbr=8;} else {nnghbr=12;}
+      if (nghbr.h_view(m,nnghbr).gid >= 0) {
+        int drank = nghbr.h_view(m,nnghbr).rank;
+        if (drank != my_rank) {
+          int lid = nghbr.h_view(m,nnghbr).gid - pmy_pack->pmesh->gids_eachrank[drank];
+          int dn = (n+1) % 2;
+          slist.push_back({drank, lid, dn, m, n});
+          rlist.push_back({drank, m, n, m, n});
+        }
+      }
+    }
+  }
+  std::sort(slist.begin(), slist.end());
+  std::sort(rlist.begin(), rlist.end());
+
+  // group entries into one message per remote rank
+  ncoal_send = 0;
+  coal_send_rank.clear();
+  coal_send_nbuf.clear();
+  int ntot_send = static_cast<int>(slist.size());
+  Kokkos::realloc(coal_send_mn, std::max(ntot_send,1), 2);
+  for (int p=0; p<ntot_send; ++p) {
+    if ((p==0) || (slist[p][0] != slist[p-1][0])) {
+      coal_send_rank.push_back(slist[p][0]);
+      coal_send_nbuf.push_back(0);
+      ncoal_send++;
+    }
+    coal_send_nbuf[ncoal_send-1]++;
+    coal_send_mn.h_view(p,0) = slist[p][3];
+    coal_send_mn.h_view(p,1) = slist[p][4];
+  }
+  coal_send_mn.template modify<HostMemSpace>();
+  coal_send_mn.template sync<DevExeSpace>();
+  coal_send_req.assign(ncoal_send, MPI_REQUEST_NULL);
+  Kokkos::realloc(coal_send_data, std::max(ntot_send,1)*coal_cnt);
+
+  ncoal_recv = 0;
+  coal_recv_rank.clear();
+  coal_recv_nbuf.clear();
+  int ntot_recv = static_cast<int>(rlist.size());
+  Kokkos::realloc(coal_recv_mn, std::max(ntot_recv,1), 2);
+  for (int p=0; p<ntot_recv; ++p) {
+    if ((p==0) || (rlist[p][0] != rlist[p-1][0])) {
+      coal_recv_rank.push_back(rlist[p][0]);
+      coal_recv_nbuf.push_back(0);
+      ncoal_recv++;
+    }
+    coal_recv_nbuf[ncoal_recv-1]++;
+    coal_recv_mn.h_view(p,0) = rlist[p][3];
+    coal_recv_mn.h_view(p,1) = rlist[p][4];
+  }
+  coal_recv_mn.template modify<HostMemSpace>();
+  coal_recv_mn.template sync<DevExeSpace>();
+  coal_recv_req.assign(ncoal_recv, MPI_REQUEST_NULL);
+  Kokkos::realloc(coal_recv_data, std::max(ntot_recv,1)*coal_cnt);
+}
+
+//----------------------------------------------------------------------------------------
+//! \fn void OrbitalAdvection::PackAndSendCoalesced()
+//! \brief Gathers all remote-bound boundary buffers into the send arena in message order
+//! and posts a single non-blocking send per remote rank.  Called by PackAndSendCC/FC in
+//! place of the per-MeshBlock sends when coalescing is enabled.
+
+void OrbitalAdvection::PackAndSendCoalesced() {
+  int ntot = 0;
+  for (int r=0; r<ncoal_send; ++r) {ntot += coal_send_nbuf[r];}
+
+  if (ntot > 0) {
+    auto &sbuf = sendbuf;
+    auto &mn = coal_send_mn;
+    auto &arena = coal_send_data;
+    int cnt = coal_cnt;
+    int n1 = sendbuf[0].vars.extent_int(4);
+    int n2 = sendbuf[0].vars.extent_int(3);
+    int n3 = sendbuf[0].vars.extent_int(2);
+    Kokkos::TeamPolicy<> policy(DevExeSpace(), ntot, Kokkos::AUTO);
+    Kokkos::parallel_for("oa-coal-pack", policy, KOKKOS_LAMBDA(TeamMember_t tmember) {
+      const int p = tmember.league_rank();
+      const int m = mn.d_view(p,0);
+      const int n = mn.d_view(p,1);
+      Kokkos::parallel_for(Kokkos::TeamThreadRange<>(tmember, cnt), [&](const int idx) {
+        int v = (idx)/(n3*n2*n1);
+        int z = (idx - v*n3*n2*n1)/(n2*n1);
+        int y = (idx - v*n3*n2*n1 - z*n2*n1)/n1;
+        int x = (idx - v*n3*n2*n1 - z*n2*n1 - y*n1);
+        arena(p*cnt + idx) = sbuf[n].vars(m,v,z,y,x);
+      });
+    });
+    Kokkos::fence();
+  }
+
+  // post one send per remote rank; messages are packed consecutively in the arena
+  bool no_errors=true;
+  int offset = 0;
+  for (int r=0; r<ncoal_send; ++r) {
+    int msg_cnt = coal_send_nbuf[r]*coal_cnt;
+    int ierr = MPI_Isend(coal_send_data.data()+offset, msg_cnt, MPI_ATHENA_REAL,
+                         coal_send_rank[r], 0, comm_orb_advect, &(coal_send_req[r]));
+    if (ierr != MPI_SUCCESS) {no_errors=false;}
+    offset += msg_cnt;
+  }
+  // Quit if MPI error detected
+  if (!(no_errors)) {
+    std::cout << "### FATAL ERROR in " << __FILE__ << " at line " << __LINE__
+       << std::endl << "MPI error in posting sends" << std::endl;
+    std::exit(EXIT_FAILURE);
+  }
+}
+
+//----------------------------------------------------------------------------------------
+//! \fn TaskStatus OrbitalAdvection::TestAndScatterCoalesced()
+//! \brief Tests whether the aggregated per-rank messages have all arrived, and if so
+//! scatters their contents back into the individual recv buffers so the unpack/remap
+//! kernels in RecvAndUnpackCC/FC can be used unchanged.
+
+TaskStatus OrbitalAdvection::TestAndScatterCoalesced() {
+  bool bflag = false;
+  bool no_errors=true;
+  for (int r=0; r<ncoal_recv; ++r) {
+    int test;
+    int ierr = MPI_Test(&(coal_recv_req[r]), &test, MPI_STATUS_IGNORE);
+    if (ierr != MPI_SUCCESS) {no_errors=false;}
+    if (!(static_cast<bool>(test))) {
+      bflag = true;
+    }
+  }
+  // Quit if MPI error detected
+  if (!(no_errors)) {
+    std::cout << "### FATAL ERROR in " << __FILE__ << " at line " << __LINE__
+              << std::endl << "MPI error in testing non-blocking receives"
+              << std::endl;
+    std::exit(EXIT_FAILURE);
+  }
+  // exit if recv boundary buffer communications have not completed
+  if (bflag) {return TaskStatus::incomplete;}
+
+  int ntot = 0;
+  for (int r=0; r<ncoal_recv; ++r) {ntot += coal_recv_nbuf[r];}
+
+  if (ntot > 0) {
+    auto &rbuf = recvbuf;
+    auto &mn = coal_recv_mn;
+    auto &arena = coal_recv_data;
+    int cnt = coal_cnt;
+    int n1 = recvbuf[0].vars.extent_int(4);
+    int n2 = recvbuf[0].vars.extent_int(3);
+    int n3 = recvbuf[0].vars.extent_int(2);
+    Kokkos::TeamPolicy<> policy(DevExeSpace(), ntot, Kokkos::AUTO);
+    Kokkos::parallel_for("oa-coal-unpk", policy, KOKKOS_LAMBDA(TeamMember_t tmember) {
+      const int p = tmember.league_rank();
+      const int m = mn.d_view(p,0);
+      const int n = mn.d_view(p,1);
+      Kokkos::parallel_for(Kokkos::TeamThreadRange<>(tmember, cnt), [&](const int idx) {
+        int v = (idx)/(n3*n2*n1);
+        int z = (idx - v*n3*n2*n1)/(n2*n1);
+        int y = (idx - v*n3*n2*n1 - z*n2*n1)/n1;
+        int x = (idx - v*n3*n2*n1 - z*n2*n1 - y*n1);
+        rbuf[n].vars(m,v,z,y,x) = arena(p*cnt + idx);
+      });
+    });
+  }
+  return TaskStatus::complete;
+}
+#endif
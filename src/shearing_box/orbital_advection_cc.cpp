@@ -127,6 +127,12 @@ TaskStatus OrbitalAdvectionCC::PackAndSendCC(DvceArray5D<Real> &a) {
   }); // end par_for_outer
 
 #if MPI_PARALLEL_ENABLED
+  // with coalesced comm, gather buffers into per-rank messages, one send per rank
+  if (coalesced_comm) {
+    PackAndSendCoalesced();
+    return TaskStatus::complete;
+  }
+
   // Send boundary buffer to neighboring MeshBlocks using MPI
   Kokkos::fence();
   bool no_errors=true;
@@ -181,34 +187,40 @@ TaskStatus OrbitalAdvectionCC::RecvAndUnpackCC(DvceArray5D<Real> &a,
   auto &nghbr = pmy_pack->pmb->nghbr;
   //----- STEP 1: check that recv boundary buffer communications have all completed
 
-  bool bflag = false;
-  bool no_errors=true;
-  for (int m=0; m<nmb; ++m) {
-    for (int n=0; n<2; ++n) {
-      // indices of x2-face buffers in nghbr view
-      int nnghbr;
-      if (n==0) {nnghbr=8;} else {nnghbr=12;}
-      if (nghbr.h_view(m,nnghbr).gid >= 0) { // neighbor exists and not a physical bndry
-        if (nghbr.h_view(m,nnghbr).rank != global_variable::my_rank) {
-          int test;
-          int ierr = MPI_Test(&(rbuf[n].vars_req[m]), &test, MPI_STATUS_IGNORE);
-          if (ierr != MPI_SUCCESS) {no_errors=false;}
-          if (!(static_cast<bool>(test))) {
-            bflag = true;
+  // with coalesced comm, test per-rank messages and scatter back into recv buffers
+  if (coalesced_comm) {
+    TaskStatus tstat = TestAndScatterCoalesced();
+    if (tstat == TaskStatus::incomplete) {return tstat;}
+  } else {
+    bool bflag = false;
+    bool no_errors=true;
+    for (int m=0; m<nmb; ++m) {
+      for (int n=0; n<2; ++n) {
+        // indices of x2-face buffers in nghbr view
+        int nnghbr;
+        if (n==0) {nnghbr=8;} else {nnghbr=12;}
+        if (nghbr.h_view(m,nnghbr).gid >= 0) { // neighbor exists, not a physical bndry
+          if (nghbr.h_view(m,nnghbr).rank != global_variable::my_rank) {
+            int test;
+            int ierr = MPI_Test(&(rbuf[n].vars_req[m]), &test, MPI_STATUS_IGNORE);
+            if (ierr != MPI_SUCCESS) {no_errors=false;}
+            if (!(static_cast<bool>(test))) {
+              bflag = true;
+            }
           }
         }
       }
     }
+    // Quit if MPI error detected
+    if (!(no_errors)) {
+      std::cout << "### FATAL ERROR in " << __FILE__ << " at line " << __LINE__
+                << std::endl << "MPI error in testing non-blocking receives"
+                << std::endl;
+      std::exit(EXIT_FAILURE);
+    }
+    // exit if recv boundary buffer communications have not completed
+    if (bflag) {return TaskStatus::incomplete;}
   }
-  // Quit if MPI error detected
-  if (!(no_errors)) {
-    std::cout << "### FATAL ERROR in " << __FILE__ << " at line " << __LINE__
-              << std::endl << "MPI error in testing non-blocking receives"
-              << std::endl;
-    std::exit(EXIT_FAILURE);
-  }
-  // exit if recv boundary buffer communications have not completed
-  if (bflag) {return TaskStatus::incomplete;}
 #endif
 
   //----- STEP 2: buffers have all completed, so unpack and apply shift
@@ -262,12 +274,15 @@ TaskStatus OrbitalAdvectionCC::RecvAndUnpackCC(DvceArray5D<Real> &a,
 
     // Compute "fluxes" at shifted cell faces
     Real epsi = fmod(yshear,(mbsize.d_view(m).dx2))/(mbsize.d_view(m).dx2);
+    Real wgti = 0.5*fabs(epsi)*(1.0 - fabs(epsi));
+    int jupi = (epsi > 0.0)? -1 : 0;
     switch (rcon) {
       case ReconstructionMethod::dc:
-        DCRemapFlx(member, (jfs-joffset), (jfe+1-joffset), epsi, a_, q1_, flx);
+        DCRemapFlx(member, (jfs-joffset), (jfe+1-joffset), epsi, jupi, a_, q1_, flx);
         break;
       case ReconstructionMethod::plm:
-        PLMRemapFlx(member, (jfs-joffset), (jfe+1-joffset), epsi, a_, q1_, flx);
+        PLMRemapFlx(member, (jfs-joffset), (jfe+1-joffset), epsi, wgti, jupi,
+                    a_, q1_, flx);
         break;
 //      case ReconstructionMethod::ppm4:
 //      case ReconstructionMethod::ppmx:
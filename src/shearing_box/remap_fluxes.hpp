@@ -13,30 +13,30 @@
 
 //----------------------------------------------------------------------------------------
 //! \fn DonorCellOrbAdvFlx()
+//! Upwind j-offset jup = ((eps > 0)? -1 : 0) is precomputed by the caller, reducing the
+//! loop to a pure gather-multiply.
 
 KOKKOS_INLINE_FUNCTION
 void DCRemapFlx(TeamMember_t const &tmember, const int jl, const int ju, const Real eps,
-                const ScrArray1D<Real> &u, ScrArray1D<Real> &q1, ScrArray1D<Real> &ust) {
-  if (eps > 0.0) {
-    par_for_inner(tmember, jl, ju, [&](const int j) {
-      ust(j) = eps*u(j-1);
-    });
-    tmember.team_barrier();
-  } else {
-    par_for_inner(tmember, jl, ju, [&](const int j) {
-      ust(j) = eps*u(j);
-    });
-    tmember.team_barrier();
-  }
+                const int jup, const ScrArray1D<Real> &u, ScrArray1D<Real> &q1,
+                ScrArray1D<Real> &ust) {
+  par_for_inner(tmember, jl, ju, [&](const int j) {
+    ust(j) = eps*u(j+jup);
+  });
+  tmember.team_barrier();
   return;
 }
 
 //----------------------------------------------------------------------------------------
 //! \fn PiecewiseLinearOrbAdvFlx()
+//! Slope weight wgt = 0.5*|eps|*(1 - |eps|) and upwind j-offset jup = ((eps > 0)? -1 : 0)
+//! are precomputed by the caller; this folds the upwind branch of the original function
+//! into a single gather-multiply-add.
 
 KOKKOS_INLINE_FUNCTION
 void PLMRemapFlx(TeamMember_t const &tmember, const int jl, const int ju, const Real eps,
-                 const ScrArray1D<Real> &u, ScrArray1D<Real> &q1, ScrArray1D<Real> &ust) {
+                 const Real wgt, const int jup, const ScrArray1D<Real> &u,
+                 ScrArray1D<Real> &q1, ScrArray1D<Real> &ust) {
   // compute limited slopes
   par_for_inner(tmember, jl-1, ju, [&](const int j) {
     Real dql = u(j  ) - u(j-1);
@@ -48,17 +48,10 @@ void PLMRemapFlx(TeamMember_t const &tmember, const int jl, const int ju, const
   });
   tmember.team_barrier();
   // compute upwind state (U_star)
-  if (eps > 0.0) {
-    par_for_inner(tmember, jl, ju, [&](const int j) {
-      ust(j) = eps*(u(j-1) + 0.5*(1.0 - eps)*q1(j-1));
-    });
-    tmember.team_barrier();
-  } else {
-    par_for_inner(tmember, jl, ju, [&](const int j) {
-      ust(j) = eps*(u(j) - 0.5*(1.0 + eps)*q1(j));
-    });
-    tmember.team_barrier();
-  }
+  par_for_inner(tmember, jl, ju, [&](const int j) {
+    ust(j) = eps*u(j+jup) + wgt*q1(j+jup);
+  });
+  tmember.team_barrier();
   return;
 }
 
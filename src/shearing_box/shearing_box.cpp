@@ -12,6 +12,7 @@
 #include <vector>
 
 #include "athena.hpp"
+#include "globals.hpp"
 #include "parameter_input.hpp"
 #include "mesh/mesh.hpp"
 #include "shearing_box.hpp"
@@ -110,3 +111,57 @@ void ShearingBoxBoundary::FindTargetMB(const int igid, const int jshift, int &gi
   rank = pm->rank_eachmb[gid];
   return;
 }
+
+//----------------------------------------------------------------------------------------
+//! \fn void ShearingBoxBoundary::UpdateShearImageMap()
+//! \brief Rebuilds cached (GID, rank, index) tables giving the shear image of every
+//! (boundary, MB, buffer) triple.  The mapping depends only on the integer-MB offset ji
+//! and on which jr interval (case 1/2/3) applies, so the tables are rebuilt only when
+//! that key changes and all per-step send/recv/clear loops index them directly.
+//! Called from InitRecv() after the offsets for this step have been computed.
+
+void ShearingBoxBoundary::UpdateShearImageMap() {
+  const auto &indcs = pmy_pack->pmesh->mb_indcs;
+  const int &ng = indcs.ng;
+  const int &nx2 = indcs.nx2;
+  int jcase = (jr < ng) ? 1 : ((jr < (nx2-ng)) ? 2 : 3);
+  if (smap_built && (ji == smap_ji) && (jcase == smap_case)) {return;}
+
+  for (int n=0; n<2; ++n) {
+    tmb_gid[n].assign(3*nmb_x1bndry(n), -1);
+    tmb_rank[n].assign(3*nmb_x1bndry(n), -1);
+    tmb_indx[n].assign(3*nmb_x1bndry(n), -1);
+    smb_rank[n].assign(3*nmb_x1bndry(n), -1);
+    for (int m=0; m<nmb_x1bndry(n); ++m) {
+      int gid = x1bndry_mbgid.h_view(n,m);
+      // case2 MBs overlap only two targets, case1/3 overlap three
+      int nl = (jcase == 2) ? 2 : 3;
+      for (int l=0; l<nl; ++l) {
+        // offset of target MB, same logic as the case1/2/3 branches of the comm loops
+        int jshift;
+        if (jcase == 1) {
+          if (n==0) {jshift = ji+l-1;} else {jshift = l-1-ji;}
+        } else if (jcase == 2) {
+          if (n==0) {jshift = ji+l;} else {jshift = l-1-ji;}
+        } else {
+          if (n==0) {jshift = ji+l;} else {jshift = l-2-ji;}
+        }
+        int tgid, trank;
+        FindTargetMB(gid, jshift, tgid, trank);
+        tmb_gid[n][3*m + l] = tgid;
+        tmb_rank[n][3*m + l] = trank;
+        if (trank == global_variable::my_rank) {
+          tmb_indx[n][3*m + l] = TargetIndex(n,tgid);
+        }
+        // offset of sender is (-jshift)
+        int sgid, srank;
+        FindTargetMB(gid, -jshift, sgid, srank);
+        smb_rank[n][3*m + l] = srank;
+      }
+    }
+  }
+  smap_built = true;
+  smap_ji = ji;
+  smap_case = jcase;
+  return;
+}
@@ -10,6 +10,8 @@
 //! Both OrbitalAdvection and ShearingBox are abstract base classes that are used to
 //! define derived classes for CC and FC variables.
 
+#include <vector>
+
 #include "athena.hpp"
 #include "parameter_input.hpp"
 #include "tasklist/task_list.hpp"
@@ -63,12 +65,31 @@ class OrbitalAdvection {
 #if MPI_PARALLEL_ENABLED
   // unique MPI communicator for orbital advection
   MPI_Comm comm_orb_advect;
+
+  // data for per-rank coalescing of orbital advection messages: all buffers exchanged
+  // with the same remote rank (both x2-faces) are concatenated into a single message per
+  // rank pair, mirroring the coalesced exchange in MeshBoundaryValues.  Entries within
+  // each message are ordered by (local ID, buffer index) of the receiving MeshBlock.
+  bool coalesced_comm;             // post one message per remote rank when true
+  bool coal_built = false;         // layout tables below have been initialized
+  int coal_cnt;                    // number of Reals in each MeshBlock buffer
+  int ncoal_send, ncoal_recv;      // number of remote ranks exchanged with
+  std::vector<int> coal_send_rank, coal_recv_rank;  // remote rank of each message
+  std::vector<int> coal_send_nbuf, coal_recv_nbuf;  // # of buffers in each message
+  std::vector<MPI_Request> coal_send_req, coal_recv_req;
+  DualArray2D<int> coal_send_mn, coal_recv_mn;  // (m,n) of each buffer, in order
+  DvceArray1D<Real> coal_send_data, coal_recv_data;  // message arenas on device
 #endif
 
   // functions
   TaskStatus InitRecv();
   TaskStatus ClearRecv();
   TaskStatus ClearSend();
+#if MPI_PARALLEL_ENABLED
+  void InitCoalescedIndices();
+  void PackAndSendCoalesced();
+  TaskStatus TestAndScatterCoalesced();
+#endif
 
  protected:
   // must use pointer to MBPack and not parent physics module since parent can be one of
@@ -113,6 +134,28 @@ class ShearingBoxBoundary {
   HostArray1D<int> nmb_x1bndry;    // number of MBs that touch x1 boundaries
   DualArray2D<int> x1bndry_mbgid;  // GIDs of MBs at x1 boundaries
   Real yshear;                     // x2-distance x1-boundaries have sheared
+  // integer offset and remap weights, precomputed once per step in InitRecv() since the
+  // shear offset evolves deterministically.  Remap kernels and the send/recv bookkeeping
+  // loops use these instead of recomputing them at every application.
+  int joffset;                     // integer (cell) offset of shear at x1-boundaries
+  int ji, jr;                      // offset in integer MBs, and remainder in cells
+  Real eps_remap[2];               // fractional cell offset at ix1/ox1 boundaries
+  Real wgt_remap[2];               // slope weight in remap fluxes at ix1/ox1 boundaries
+  int jup_remap[2];                // upwind j-offset in remap fluxes at ix1/ox1 bndries
+
+  // cached shear image mapping.  The (GID, rank, buffer index) of the target/source MB
+  // of each (boundary, MB, buffer) triple depends only on the integer-MB offset ji and
+  // on which jr interval (case 1/2/3) applies, both of which advance at predictable
+  // times as the shear grows.  UpdateShearImageMap() rebuilds the tables below only
+  // when that key changes, so the per-step send/recv/clear loops just index them
+  // instead of searching the block tree for every buffer every application.
+  bool smap_built = false;         // mapping tables below are valid for smap_ji/case
+  int smap_ji;                     // integer-MB offset the tables were built for
+  int smap_case;                   // jr interval (1,2,3) the tables were built for
+  std::vector<int> tmb_gid[2];     // GID of target MB of each send buffer
+  std::vector<int> tmb_rank[2];    // rank of target MB of each send buffer
+  std::vector<int> tmb_indx[2];    // x1bndry index of target MB (same-rank targets only)
+  std::vector<int> smb_rank[2];    // rank of source MB of each recv buffer
 
   // data buffers for shearing box BCs.  Only two x1-faces get sheared
   // Use seperate variables for ix1/ox1 since number of MBs on each face can be different
@@ -129,6 +172,8 @@ class ShearingBoxBoundary {
   TaskStatus ClearSend();
   // function to find target MB offset by shear.  Returns GID and rank
   void FindTargetMB(const int igid, const int jshift, int &gid, int &rank);
+  // function to rebuild cached shear image mapping when (ji, case) changes
+  void UpdateShearImageMap();
   // function to find index in x1bndry array of MB with input GID
   int TargetIndex(const int n, const int tgid) {
     for (int m=0; m<nmb_x1bndry(n); ++m) {
@@ -55,18 +55,20 @@ TaskStatus ShearingBoxBoundaryFC::PackAndSendFC(DvceFaceFld4D<Real> &b,
 
   // copy ghost zones at x1-faces into send buffer view
   // apply fractional cell offset to data in send buffers using conservative remap
-  const auto &mbsize = pmy_pack->pmb->mb_size;
   int kl=ks, ku=ke;
   if (pmy_pack->pmesh->three_d) {kl -= ng; ku += ng;}
   int nj = indcs.nx2 + 2*ng;
   const int &gids_ = pmy_pack->gids;
-  const Real &yshear_ = yshear;
   const auto &x1bndry_mbgid_ = x1bndry_mbgid;
   auto &sbuf = sendbuf;
   int scr_lvl=0;
   size_t scr_size = ScrArray1D<Real>::shmem_size(nj) * 3;
   for (int n=0; n<2; ++n) {
     int nmb1 = nmb_x1bndry(n) - 1;
+    // fractional offset and remap weights at this boundary, precomputed in InitRecv()
+    const Real eps = eps_remap[n];
+    const Real wgt = wgt_remap[n];
+    const int jup = jup_remap[n];
     par_for_outer("shrcc",DevExeSpace(),scr_size,scr_lvl,0,nmb1,0,2,kl,ku,0,(ng-1),
     KOKKOS_LAMBDA(TeamMember_t member,const int m,const int v,const int k,const int i) {
       ScrArray1D<Real> a_(member.team_scratch(scr_lvl), nj); // 1D slice of data
@@ -111,17 +113,13 @@ TaskStatus ShearingBoxBoundaryFC::PackAndSendFC(DvceFaceFld4D<Real> &b,
         }
       }
 
-      // compute fractional offset
-      Real eps = fmod(yshear_,(mbsize.d_view(mm).dx2))/(mbsize.d_view(mm).dx2);
-      if (n == 1) {eps *= -1.0;}
-
       // Compute "fluxes" at shifted cell faces
       switch (rcon) {
         case ReconstructionMethod::dc:
-          DCRemapFlx(member, js, (je+1), eps, a_, q1_, flx);
+          DCRemapFlx(member, js, (je+1), eps, jup, a_, q1_, flx);
           break;
         case ReconstructionMethod::plm:
-          PLMRemapFlx(member, js, (je+1), eps, a_, q1_, flx);
+          PLMRemapFlx(member, js, (je+1), eps, wgt, jup, a_, q1_, flx);
           break;
 //      case ReconstructionMethod::ppm4:
 //      case ReconstructionMethod::ppmx:
@@ -151,16 +149,9 @@ TaskStatus ShearingBoxBoundaryFC::PackAndSendFC(DvceFaceFld4D<Real> &b,
   bool no_errors=true;
   for (int n=0; n<2; ++n) {
     for (int m=0; m<nmb_x1bndry(n); ++m) {
-      int gid = x1bndry_mbgid.h_view(n,m);
-      int mm = gid - pmy_pack->gids;
-      // Find integer and fractional number of grids over which offset extends.
-      // This assumes every grid has same number of cells in x2-direction!
-      int joffset  = static_cast<int>(yshear/(mbsize.h_view(mm).dx2));
-      int ji = joffset/nx2;
-      int jr = joffset - ji*nx2;
+      // integer offset in MBs (ji) and remainder in cells (jr) computed in InitRecv()
 
       if (jr < ng) {               //--- CASE 1 (in my nomenclature)
-        int tgid, trank;
         std::pair<int,int> jsrc[3],jdst[3];
         if (n==0) {
           jsrc[0] = std::make_pair(js,js+ng-jr);
@@ -180,11 +171,10 @@ TaskStatus ShearingBoxBoundaryFC::PackAndSendFC(DvceFaceFld4D<Real> &b,
         // ix1 boundary: send to (target-1) through (target+1)
         // ox1 boundary: send to (target-1) through (target+1)
         for (int l=0; l<3; ++l) {
-          int jshift;
-          if (n==0) {jshift = ji+l-1;} else {jshift = l-1-ji;} // offset of target
-          FindTargetMB(gid,jshift,tgid,trank);
+          int tgid = tmb_gid[n][3*m + l];    // target MB from cached image map
+          int trank = tmb_rank[n][3*m + l];
           if (trank == global_variable::my_rank) {
-            int tm = TargetIndex(n,tgid);
+            int tm = tmb_indx[n][3*m + l];
             using Kokkos::ALL;
             auto src = subview(sendbuf[n].vars,m, jsrc[l],ALL,ALL,ALL);
             auto dst = subview(recvbuf[n].vars,tm,jdst[l],ALL,ALL,ALL);
@@ -203,7 +193,6 @@ TaskStatus ShearingBoxBoundaryFC::PackAndSendFC(DvceFaceFld4D<Real> &b,
           }
         }
       } else if (jr < (nx2-ng)) {  //--- CASE 2
-        int tgid, trank;
         std::pair<int,int> jsrc[2],jdst[2];
         if (n==0) {
           jsrc[0] = std::make_pair(js,je+ng-jr+1);
@@ -219,11 +208,10 @@ TaskStatus ShearingBoxBoundaryFC::PackAndSendFC(DvceFaceFld4D<Real> &b,
         // ix1 boundary: send to (target  ) through (target+1)
         // ox1 boundary: send to (target-1) through (target  )
         for (int l=0; l<2; ++l) {
-          int jshift;
-          if (n==0) {jshift = ji+l;} else {jshift = l-1-ji;}
-          FindTargetMB(gid,jshift,tgid,trank);
+          int tgid = tmb_gid[n][3*m + l];    // target MB from cached image map
+          int trank = tmb_rank[n][3*m + l];
           if (trank == global_variable::my_rank) {
-            int tm = TargetIndex(n,tgid);
+            int tm = tmb_indx[n][3*m + l];
             using Kokkos::ALL;
             auto src = subview(sendbuf[n].vars,m, jsrc[l],ALL,ALL,ALL);
             auto dst = subview(recvbuf[n].vars,tm,jdst[l],ALL,ALL,ALL);
@@ -242,7 +230,6 @@ TaskStatus ShearingBoxBoundaryFC::PackAndSendFC(DvceFaceFld4D<Real> &b,
           }
         }
       } else {                     //--- CASE 3
-        int tgid, trank;
         std::pair<int,int> jsrc[3],jdst[3];
         if (n==0) {
           jsrc[0] = std::make_pair(js,js+ng+(nx2-jr));
@@ -262,11 +249,10 @@ TaskStatus ShearingBoxBoundaryFC::PackAndSendFC(DvceFaceFld4D<Real> &b,
         // ix1 boundary: send to (target  ) through (target+2)
         // ox1 boundary: send to (target-2) through (target  )
         for (int l=0; l<3; ++l) {
-          int jshift;
-          if (n==0) {jshift = ji+l;} else {jshift = l-2-ji;}
-          FindTargetMB(gid,jshift,tgid,trank);
+          int tgid = tmb_gid[n][3*m + l];    // target MB from cached image map
+          int trank = tmb_rank[n][3*m + l];
           if (trank == global_variable::my_rank) {
-            int tm = TargetIndex(n,tgid);
+            int tm = tmb_indx[n][3*m + l];
             using Kokkos::ALL;
             auto src = subview(sendbuf[n].vars,m, jsrc[l],ALL,ALL,ALL);
             auto dst = subview(recvbuf[n].vars,tm,jdst[l],ALL,ALL,ALL);
@@ -311,22 +297,13 @@ TaskStatus ShearingBoxBoundaryFC::RecvAndUnpackFC(DvceFaceFld4D<Real> &b) {
   bool no_errors=true;
   for (int n=0; n<2; ++n) {
     for (int m=0; m<nmb_x1bndry(n); ++m) {
-      int gid = x1bndry_mbgid.h_view(n,m);
-      int mm = gid - pmy_pack->gids;
-      // Find integer and fractional number of grids over which offset extends.
-      // This assumes every grid has same number of cells in x2-direction!
-      int joffset  = static_cast<int>(yshear/(pmy_pack->pmb->mb_size.h_view(mm).dx2));
-      int ji = joffset/nx2;
-      int jr = joffset - ji*nx2;
+      // integer offset in MBs (ji) and remainder in cells (jr) computed in InitRecv()
 
       if (jr < ng) {               //--- CASE 1 (in my nomenclature)
         // ix1 boundary: receive from (target+1) through (target-1)
         // ox1 boundary: receive from (target+1) through (target-1)
         for (int l=0; l<3; ++l) {
-          int jshift;
-          if (n==0) {jshift = -(ji+l-1);} else {jshift = -(l-1-ji);} // offset of sender
-          int sgid, srank;
-          FindTargetMB(gid,jshift,sgid,srank);
+          int srank = smb_rank[n][3*m + l];  // rank of sender, from cached image map
           if (srank != global_variable::my_rank) {
             int test;
             int ierr = MPI_Test(&(recvbuf[n].vars_req[3*m + l]),&test,MPI_STATUS_IGNORE);
@@ -338,10 +315,7 @@ TaskStatus ShearingBoxBoundaryFC::RecvAndUnpackFC(DvceFaceFld4D<Real> &b) {
         // ix1 boundary: receive from (target  ) through (target-1)
         // ox1 boundary: receive from (target+1) through (target  )
         for (int l=0; l<2; ++l) {
-          int jshift;
-          if (n==0) {jshift = -(ji+l);} else {jshift = -(l-1-ji);} // offset of sender
-          int sgid, srank;
-          FindTargetMB(gid,jshift,sgid,srank);
+          int srank = smb_rank[n][3*m + l];  // rank of sender, from cached image map
           if (srank != global_variable::my_rank) {
             int test;
             int ierr = MPI_Test(&(recvbuf[n].vars_req[3*m + l]),&test,MPI_STATUS_IGNORE);
@@ -353,10 +327,7 @@ TaskStatus ShearingBoxBoundaryFC::RecvAndUnpackFC(DvceFaceFld4D<Real> &b) {
         // ix1 boundary: send to (target  ) through (target+2)
         // ox1 boundary: send to (target-2) through (target  )
         for (int l=0; l<3; ++l) {
-          int jshift;
-          if (n==0) {jshift = -(ji+l);} else {jshift = -(l-2-ji);} // offset of sender
-          int sgid, srank;
-          FindTargetMB(gid,jshift,sgid,srank);
+          int srank = smb_rank[n][3*m + l];  // rank of sender, from cached image map
           if (srank != global_variable::my_rank) {
             int test;
             int ierr = MPI_Test(&(recvbuf[n].vars_req[3*m + l]),&test,MPI_STATUS_IGNORE);
@@ -8,6 +8,7 @@
 //! orbital advection, shearing box, and flux correction steps with shearing box
 //! boundaries.
 
+#include <cmath>
 #include <cstdlib>
 #include <iostream>
 #include <utility>
@@ -28,6 +29,30 @@ TaskStatus OrbitalAdvection::InitRecv() {
   const int &nmb = pmy_pack->nmb_thispack;
   const auto &nghbr = pmy_pack->pmb->nghbr;
 
+  // with coalesced comm, post one receive per remote rank for aggregated messages
+  if (coalesced_comm) {
+    if (!(coal_built)) {
+      InitCoalescedIndices();
+      coal_built = true;
+    }
+    bool no_errors=true;
+    int offset = 0;
+    for (int r=0; r<ncoal_recv; ++r) {
+      int msg_cnt = coal_recv_nbuf[r]*coal_cnt;
+      int ierr = MPI_Irecv(coal_recv_data.data()+offset, msg_cnt, MPI_ATHENA_REAL,
+                           coal_recv_rank[r], 0, comm_orb_advect, &(coal_recv_req[r]));
+      if (ierr != MPI_SUCCESS) {no_errors=false;}
+      offset += msg_cnt;
+    }
+    // Quit if MPI error detected
+    if (!(no_errors)) {
+      std::cout << "### FATAL ERROR in " << __FILE__ << " at line " << __LINE__
+         << std::endl << "MPI error in posting non-blocking receives" << std::endl;
+      std::exit(EXIT_FAILURE);
+    }
+    return TaskStatus::complete;
+  }
+
   // Initialize communications of variables
   bool no_errors=true;
   for (int m=0; m<nmb; ++m) {
@@ -78,6 +103,21 @@ TaskStatus OrbitalAdvection::ClearRecv() {
   int &nmb = pmy_pack->nmb_thispack;
   auto &nghbr = pmy_pack->pmb->nghbr;
 
+  // with coalesced comm, wait on the aggregated per-rank messages instead
+  if (coalesced_comm) {
+    for (int r=0; r<ncoal_recv; ++r) {
+      int ierr = MPI_Wait(&(coal_recv_req[r]), MPI_STATUS_IGNORE);
+      if (ierr != MPI_SUCCESS) {no_errors=false;}
+    }
+    // Quit if MPI error detected
+    if (!(no_errors)) {
+      std::cout << "### FATAL ERROR in " << __FILE__ << " at line " << __LINE__
+         << std::endl << "MPI error in clearing receives" << std::endl;
+      std::exit(EXIT_FAILURE);
+    }
+    return TaskStatus::complete;
+  }
+
   // wait for all non-blocking receives for vars to finish before continuing
   for (int m=0; m<nmb; ++m) {
     for (int n=0; n<2; ++n) {
@@ -112,6 +152,21 @@ TaskStatus OrbitalAdvection::ClearSend() {
   int &nmb = pmy_pack->nmb_thispack;
   auto &nghbr = pmy_pack->pmb->nghbr;
 
+  // with coalesced comm, wait on the aggregated per-rank messages instead
+  if (coalesced_comm) {
+    for (int r=0; r<ncoal_send; ++r) {
+      int ierr = MPI_Wait(&(coal_send_req[r]), MPI_STATUS_IGNORE);
+      if (ierr != MPI_SUCCESS) {no_errors=false;}
+    }
+    // Quit if MPI error detected
+    if (!(no_errors)) {
+      std::cout << "### FATAL ERROR in " << __FILE__ << " at line " << __LINE__
+         << std::endl << "MPI error in clearing sends" << std::endl;
+      std::exit(EXIT_FAILURE);
+    }
+    return TaskStatus::complete;
+  }
+
   // wait for all non-blocking sends for vars to finish before continuing
   for (int m=0; m<nmb; ++m) {
     for (int n=0; n<2; ++n) {
@@ -146,6 +201,23 @@ TaskStatus ShearingBoxBoundary::InitRecv(Real qom, Real time) {
   Real lx = (mesh_size.x1max - mesh_size.x1min);
   yshear = qom*lx*time;
 
+  // Precompute integer and fractional offsets and the remap weights used by every
+  // pack/unpack/clear function this step.
+  // This assumes every grid has same number of cells in x2-direction!
+  Real dx2 = pmy_pack->pmb->mb_size.h_view(0).dx2;
+  joffset = static_cast<int>(yshear/dx2);
+  ji = joffset/(pmy_pack->pmesh->mb_indcs.nx2);
+  jr = joffset - ji*(pmy_pack->pmesh->mb_indcs.nx2);
+  for (int n=0; n<2; ++n) {
+    Real eps = fmod(yshear,dx2)/dx2;
+    if (n == 1) {eps *= -1.0;}
+    eps_remap[n] = eps;
+    wgt_remap[n] = 0.5*fabs(eps)*(1.0 - fabs(eps));
+    jup_remap[n] = (eps > 0.0)? -1 : 0;
+  }
+  // rebuild cached shear image mapping if integer-MB offset or jr interval has changed
+  UpdateShearImageMap();
+
 #if MPI_PARALLEL_ENABLED
   // post non-blocking receives
   bool no_errors=true;
@@ -156,12 +228,7 @@ TaskStatus ShearingBoxBoundary::InitRecv(Real qom, Real time) {
   for (int n=0; n<2; ++n) {
     for (int m=0; m<nmb_x1bndry(n); ++m) {
       int gid = x1bndry_mbgid.h_view(n,m);
-      int mm = gid - pmy_pack->gids;
-      // Find integer and fractional number of grids over which offset extends.
-      // This assumes every grid has same number of cells in x2-direction!
-      int joffset  = static_cast<int>(yshear/(pmy_pack->pmb->mb_size.h_view(mm).dx2));
-      int ji = joffset/nx2;
-      int jr = joffset - ji*nx2;
+      // integer offset in MBs (ji) and remainder in cells (jr) computed in InitRecv()
 
       if (jr < ng) {               //--- CASE 1 (in my nomenclature)
         std::pair<int,int> jdst[3];
@@ -177,10 +244,7 @@ TaskStatus ShearingBoxBoundary::InitRecv(Real qom, Real time) {
         // ix1 boundary: receive from (target+1) through (target-1)
         // ox1 boundary: receive from (target+1) through (target-1)
         for (int l=0; l<3; ++l) {
-          int jshift;
-          if (n==0) {jshift = -(ji+l-1);} else {jshift = -(l-1-ji);} // offset of sender
-          int sgid, srank;
-          FindTargetMB(gid,jshift,sgid,srank);
+          int srank = smb_rank[n][3*m + l];  // rank of sender, from cached image map
           if (srank != global_variable::my_rank) {
             // create tag using local ID of *receiving* MeshBlock
             int tag = CreateBvals_MPI_Tag(gid, ((n<<2) | l));
@@ -208,10 +272,7 @@ TaskStatus ShearingBoxBoundary::InitRecv(Real qom, Real time) {
         // ix1 boundary: receive from (target  ) through (target-1)
         // ox1 boundary: receive from (target+1) through (target  )
         for (int l=0; l<2; ++l) {
-          int jshift;
-          if (n==0) {jshift = -(ji+l);} else {jshift = -(l-1-ji);} // offset of sender
-          int sgid, srank;
-          FindTargetMB(gid,jshift,sgid,srank);
+          int srank = smb_rank[n][3*m + l];  // rank of sender, from cached image map
           if (srank != global_variable::my_rank) {
             // create tag using local ID of *receiving* MeshBlock
             int tag = CreateBvals_MPI_Tag(gid, ((n<<2) | l));
@@ -241,10 +302,7 @@ TaskStatus ShearingBoxBoundary::InitRecv(Real qom, Real time) {
         // ix1 boundary: send to (target  ) through (target+2)
         // ox1 boundary: send to (target-2) through (target  )
         for (int l=0; l<3; ++l) {
-          int jshift;
-          if (n==0) {jshift = -(ji+l);} else {jshift = -(l-2-ji);}
-          int sgid, srank;
-          FindTargetMB(gid,jshift,sgid,srank);
+          int srank = smb_rank[n][3*m + l];  // rank of sender, from cached image map
           if (srank != global_variable::my_rank) {
             // create tag using local ID of *receiving* MeshBlock
             int tag = CreateBvals_MPI_Tag(gid, ((n<<2) | l));
@@ -286,22 +344,13 @@ TaskStatus ShearingBoxBoundary::ClearRecv() {
   // wait for all non-blocking receives for vars to finish before continuing
   for (int n=0; n<2; ++n) {
     for (int m=0; m<nmb_x1bndry(n); ++m) {
-      int gid = x1bndry_mbgid.h_view(n,m);
-      int mm = gid - pmy_pack->gids;
-      // Find integer and fractional number of grids over which offset extends.
-      // This assumes every grid has same number of cells in x2-direction!
-      int joffset  = static_cast<int>(yshear/(pmy_pack->pmb->mb_size.h_view(mm).dx2));
-      int ji = joffset/nx2;
-      int jr = joffset - ji*nx2;
+      // integer offset in MBs (ji) and remainder in cells (jr) computed in InitRecv()
 
       if (jr < ng) {               //--- CASE 1 (in my nomenclature)
         // ix1 boundary: receive from (target+1) through (target-1)
         // ox1 boundary: receive from (target+1) through (target-1)
         for (int l=0; l<3; ++l) {
-          int jshift;
-          if (n==0) {jshift = -(ji+l-1);} else {jshift = -(l-1-ji);} // offset of sender
-          int sgid, srank;
-          FindTargetMB(gid,jshift,sgid,srank);
+          int srank = smb_rank[n][3*m + l];  // rank of sender, from cached image map
           if (srank != global_variable::my_rank) {
             int ierr = MPI_Wait(&(recvbuf[n].vars_req[3*m + l]), MPI_STATUS_IGNORE);
             if (ierr != MPI_SUCCESS) {no_errors=false;}
@@ -311,10 +360,7 @@ TaskStatus ShearingBoxBoundary::ClearRecv() {
         // ix1 boundary: receive from (target  ) through (target-1)
         // ox1 boundary: receive from (target+1) through (target  )
         for (int l=0; l<2; ++l) {
-          int jshift;
-          if (n==0) {jshift = -(ji+l);} else {jshift = -(l-1-ji);} // offset of sender
-          int sgid, srank;
-          FindTargetMB(gid,jshift,sgid,srank);
+          int srank = smb_rank[n][3*m + l];  // rank of sender, from cached image map
           if (srank != global_variable::my_rank) {
             int ierr = MPI_Wait(&(recvbuf[n].vars_req[3*m + l]), MPI_STATUS_IGNORE);
             if (ierr != MPI_SUCCESS) {no_errors=false;}
@@ -324,10 +370,7 @@ TaskStatus ShearingBoxBoundary::ClearRecv() {
         // ix1 boundary: send to (target  ) through (target+2)
         // ox1 boundary: send to (target-2) through (target  )
         for (int l=0; l<3; ++l) {
-          int jshift;
-          if (n==0) {jshift = -(ji+l);} else {jshift = -(l-2-ji);} // offset of sender
-          int sgid, srank;
-          FindTargetMB(gid,jshift,sgid,srank);
+          int srank = smb_rank[n][3*m + l];  // rank of sender, from cached image map
           if (srank != global_variable::my_rank) {
             int ierr = MPI_Wait(&(recvbuf[n].vars_req[3*m + l]), MPI_STATUS_IGNORE);
             if (ierr != MPI_SUCCESS) {no_errors=false;}
@@ -359,22 +402,13 @@ TaskStatus ShearingBoxBoundary::ClearSend() {
   // wait for all non-blocking sends for vars to finish before continuing
   for (int n=0; n<2; ++n) {
     for (int m=0; m<nmb_x1bndry(n); ++m) {
-      int gid = x1bndry_mbgid.h_view(n,m);
-      int mm = gid - pmy_pack->gids;
-      // Find integer and fractional number of grids over which offset extends.
-      // This assumes every grid has same number of cells in x2-direction!
-      int joffset  = static_cast<int>(yshear/(pmy_pack->pmb->mb_size.h_view(mm).dx2));
-      int ji = joffset/nx2;
-      int jr = joffset - ji*nx2;
+      // integer offset in MBs (ji) and remainder in cells (jr) computed in InitRecv()
 
       if (jr < ng) {               //--- CASE 1 (in my nomenclature)
         // ix1 boundary: send to (target-1) through (target+1)
         // ox1 boundary: send to (target-1) through (target+1)
         for (int l=0; l<3; ++l) {
-          int jshift;
-          if (n==0) {jshift = ji+l-1;} else {jshift = l-1-ji;} // offset of target
-          int tgid, trank;
-          FindTargetMB(gid,jshift,tgid,trank);
+          int trank = tmb_rank[n][3*m + l];  // rank of target, from cached image map
           if (trank != global_variable::my_rank) {
             int ierr = MPI_Wait(&(sendbuf[n].vars_req[3*m + l]), MPI_STATUS_IGNORE);
             if (ierr != MPI_SUCCESS) {no_errors=false;}
@@ -384,10 +418,7 @@ TaskStatus ShearingBoxBoundary::ClearSend() {
         // ix1 boundary: send to (target  ) through (target+1)
         // ox1 boundary: send to (target-1) through (target  )
         for (int l=0; l<2; ++l) {
-          int jshift;
-          if (n==0) {jshift = ji+l;} else {jshift = l-1-ji;}
-          int tgid, trank;
-          FindTargetMB(gid,jshift,tgid,trank);
+          int trank = tmb_rank[n][3*m + l];  // rank of target, from cached image map
           if (trank != global_variable::my_rank) {
             int ierr = MPI_Wait(&(sendbuf[n].vars_req[3*m + l]), MPI_STATUS_IGNORE);
             if (ierr != MPI_SUCCESS) {no_errors=false;}
@@ -397,10 +428,7 @@ TaskStatus ShearingBoxBoundary::ClearSend() {
         // ix1 boundary: send to (target  ) through (target+2)
         // ox1 boundary: send to (target-2) through (target  )
         for (int l=0; l<3; ++l) {
-          int jshift;
-          if (n==0) {jshift = ji+l;} else {jshift = l-2-ji;}
-          int tgid, trank;
-          FindTargetMB(gid,jshift,tgid,trank);
+          int trank = tmb_rank[n][3*m + l];  // rank of target, from cached image map
           if (trank != global_variable::my_rank) {
             int ierr = MPI_Wait(&(sendbuf[n].vars_req[3*m + l]), MPI_STATUS_IGNORE);
             if (ierr != MPI_SUCCESS) {no_errors=false;}
@@ -55,4 +55,25 @@ Real ISMCoolFn(Real temp) {
   Real logcool = (lhd[ipps+1]*dx - lhd[ipps]*(dx - 0.04))*25.0;
   return pow(10.0,logcool);
 }
+
+//----------------------------------------------------------------------------------------
+//! \fn Real ISMCoolTableFn()
+//! \brief cooling rate interpolated from a table of log10(Lambda) sampled from
+//! ISMCoolFn() at uniform log10(T) spacing (built in the SourceTerms constructor).
+//! Interpolation is linear in log-log space, and the end segments extrapolate: exact
+//! for the pure power-law CGOLS branch above the table, and negligible below it where
+//! the cooling rate is already vanishingly small.  Replaces the branchy three-regime
+//! evaluation (exp/sqrt calls and a 102-entry function-local array) with one fused
+//! gather per cell in the source-term kernels.
+
+KOKKOS_INLINE_FUNCTION
+Real ISMCoolTableFn(const Real temp, const DualArray1D<Real> &tab, const Real logtmin,
+                    const Real invdlogt, const int ntab) {
+  Real x = (log10(temp) - logtmin)*invdlogt;
+  int n = static_cast<int>(x);
+  n = (n < (ntab-2))? n : (ntab-2);
+  n = (n > 0)? n : 0;
+  Real dx = x - static_cast<Real>(n);
+  return pow(10.0, tab.d_view(n) + dx*(tab.d_view(n+1) - tab.d_view(n)));
+}
 #endif // SRCTERMS_ISMCOOLING_HPP_
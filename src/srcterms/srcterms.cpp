@@ -10,6 +10,8 @@
 
 #include "srcterms.hpp"
 
+#include <float.h>
+
 #include <iostream>
 #include <string> // string
 
@@ -33,7 +35,8 @@
 
 SourceTerms::SourceTerms(std::string block, MeshBlockPack *pp, ParameterInput *pin) :
   pmy_pack(pp),
-  shearing_box_r_phi(false) {
+  shearing_box_r_phi(false),
+  ism_cool_table("ism_cool_table",1) {
   // (1) (constant) gravitational acceleration
   const_accel = pin->GetOrAddBoolean(block, "const_accel", false);
   if (const_accel) {
@@ -48,8 +51,27 @@ SourceTerms::SourceTerms(std::string block, MeshBlockPack *pp, ParameterInput *p
 
   // (2) Optically thin (ISM) cooling
   ism_cooling = pin->GetOrAddBoolean(block, "ism_cooling", false);
+  ism_cool_subcycle = false;
   if (ism_cooling) {
     hrate = pin->GetReal(block, "hrate");
+    // with subcycling, cooling is removed from the global timestep and instead applied
+    // operator-split once per cycle with per-cell adaptive substeps (see
+    // ISMCoolingSubcycled), so short cooling times in dense gas do not throttle dt
+    ism_cool_subcycle = pin->GetOrAddBoolean(block, "ism_cooling_subcycle", false);
+    // tabulate the cooling curve at uniform log10(T) spacing spanning all three
+    // branches of ISMCoolFn(), so kernels do one fused lookup per cell instead of the
+    // branchy piecewise evaluation (see ISMCoolTableFn in ismcooling.hpp)
+    ism_ntab = 901;
+    ism_logtmin = 1.0;
+    Real dlogt = 0.01;
+    ism_invdlogt = 1.0/dlogt;
+    Kokkos::realloc(ism_cool_table, ism_ntab);
+    for (int n=0; n<ism_ntab; ++n) {
+      Real temp = pow(10.0, ism_logtmin + dlogt*static_cast<Real>(n));
+      ism_cool_table.h_view(n) = log10(ISMCoolFn(temp));
+    }
+    ism_cool_table.template modify<HostMemSpace>();
+    ism_cool_table.template sync<DevExeSpace>();
   }
 
   // (3) beam source (radiation)
@@ -129,6 +151,10 @@ void SourceTerms::ISMCooling(const DvceArray5D<Real> &w0, const EOS_Data &eos_da
   Real cooling_unit = pmy_pack->punit->pressure_cgs()/pmy_pack->punit->time_cgs()
                       /n_unit/n_unit;
   Real heating_unit = pmy_pack->punit->pressure_cgs()/pmy_pack->punit->time_cgs()/n_unit;
+  auto &ctab = ism_cool_table;
+  Real logtmin = ism_logtmin;
+  Real invdlogt = ism_invdlogt;
+  int ntab = ism_ntab;
 
   par_for("cooling", DevExeSpace(), 0, nmb1, ks, ke, js, je, is, ie,
   KOKKOS_LAMBDA(const int m, const int k, const int j, const int i) {
@@ -140,7 +166,8 @@ void SourceTerms::ISMCooling(const DvceArray5D<Real> &w0, const EOS_Data &eos_da
       temp = temp_unit*w0(m,ITM,k,j,i);
     }
 
-    Real lambda_cooling = ISMCoolFn(temp)/cooling_unit;
+    Real lambda_cooling = ISMCoolTableFn(temp, ctab, logtmin, invdlogt, ntab)
+                          /cooling_unit;
     Real gamma_heating = heating_rate/heating_unit;
 
     u0(m,IEN,k,j,i) -= bdt * w0(m,IDN,k,j,i) *
@@ -150,6 +177,76 @@ void SourceTerms::ISMCooling(const DvceArray5D<Real> &w0, const EOS_Data &eos_da
   return;
 }
 
+//----------------------------------------------------------------------------------------
+//! \fn void SourceTerms::ISMCoolingSubcycled()
+//! \brief Add ISM cooling and heating operator-split over the full timestep, with
+//! per-cell adaptive substeps limited to a fraction of the local cooling/heating time.
+//! Called once per cycle from the "after_timeintegrator" task list (not per stage) when
+//! <hydro>/ism_cooling_subcycle=true, in which case cooling is also removed from the
+//! global timestep computation in NewTimeStep().  Since the source term is cell-local,
+//! both the conserved and primitive energy are updated together so that no additional
+//! con-to-prim pass is needed before the next cycle.
+
+void SourceTerms::ISMCoolingSubcycled(DvceArray5D<Real> &w0, const EOS_Data &eos_data,
+                                      const Real dt, DvceArray5D<Real> &u0) {
+  auto &indcs = pmy_pack->pmesh->mb_indcs;
+  int n1 = indcs.nx1 + 2*(indcs.ng);
+  int n2 = (indcs.nx2 > 1)? (indcs.nx2 + 2*(indcs.ng)) : 1;
+  int n3 = (indcs.nx3 > 1)? (indcs.nx3 + 2*(indcs.ng)) : 1;
+  int nmb1 = pmy_pack->nmb_thispack - 1;
+  bool use_e = eos_data.use_e;
+  Real gm1 = eos_data.gamma - 1.0;
+  Real efloor = eos_data.pfloor/gm1;
+  Real heating_rate = hrate;
+  Real temp_unit = pmy_pack->punit->temperature_cgs();
+  Real n_unit = pmy_pack->punit->density_cgs()/pmy_pack->punit->mu()
+                /pmy_pack->punit->atomic_mass_unit_cgs;
+  Real cooling_unit = pmy_pack->punit->pressure_cgs()/pmy_pack->punit->time_cgs()
+                      /n_unit/n_unit;
+  Real heating_unit = pmy_pack->punit->pressure_cgs()/pmy_pack->punit->time_cgs()/n_unit;
+  auto &ctab = ism_cool_table;
+  Real logtmin = ism_logtmin;
+  Real invdlogt = ism_invdlogt;
+  int ntab = ism_ntab;
+  // substep is safety*min(t_cool, t_heat); cap on substep count guards against a
+  // pathological cell spinning forever (floored cells finish in a few substeps anyways)
+  const Real safety = 0.1;
+  const int max_nsub = 10000;
+
+  // loop includes ghost zones so that w0 there (filled by the final con-to-prim of this
+  // cycle) stays consistent with the interior cells of neighboring MeshBlocks
+  par_for("cooling_subcycle", DevExeSpace(), 0, nmb1, 0, (n3-1), 0, (n2-1), 0, (n1-1),
+  KOKKOS_LAMBDA(const int m, const int k, const int j, const int i) {
+    Real dens = w0(m,IDN,k,j,i);
+    Real eint = (use_e) ? w0(m,IEN,k,j,i) : w0(m,ITM,k,j,i)*dens/gm1;
+    Real e0 = eint;
+
+    // integrate de/dt = -n^2*Lambda(T) + n*Gamma over dt with adaptive substeps
+    Real tleft = dt;
+    int nsub = 0;
+    while (tleft > 0.0 && nsub < max_nsub) {
+      Real temp = temp_unit*gm1*eint/dens;
+      Real lambda_cooling = ISMCoolTableFn(temp, ctab, logtmin, invdlogt, ntab)
+                            /cooling_unit;
+      Real gamma_heating = heating_rate/heating_unit;
+      Real edot = dens*(dens*lambda_cooling - gamma_heating);
+      Real dtsub = fmin(tleft, safety*eint/(fabs(edot) + FLT_MIN));
+      eint = fmax(eint - dtsub*edot, efloor);
+      tleft -= dtsub;
+      nsub++;
+    }
+
+    u0(m,IEN,k,j,i) += (eint - e0);
+    if (use_e) {
+      w0(m,IEN,k,j,i) = eint;
+    } else {
+      w0(m,ITM,k,j,i) = gm1*eint/dens;
+    }
+  });
+
+  return;
+}
+
 //----------------------------------------------------------------------------------------
 //! \fn void SourceTerms::RelCooling()
 //! \brief Add explict relativistic cooling in the energy and momentum equations.
@@ -212,6 +309,7 @@ void SourceTerms::BeamSource(DvceArray5D<Real> &i0, const Real bdt) {
 
   auto &excise = pmy_pack->pcoord->coord_data.bh_excise;
   auto &rad_mask_ = pmy_pack->pcoord->excision_floor;
+  auto &mb_excised_ = pmy_pack->pcoord->mb_excised;
   Real &n_0_floor_ = pmy_pack->prad->n_0_floor;
 
   auto &beam_mask_ = pmy_pack->prad->beam_mask;
@@ -228,7 +326,9 @@ void SourceTerms::BeamSource(DvceArray5D<Real> &i0, const Real bdt) {
       // intensities within rks <= 1.0 and zeroes intensities within angles where n_0
       // is about zero.  This needs future attention.
       if (excise) {
-        if (rad_mask_(m,k,j,i) || fabs(n_0) < n_0_floor_) { i0(m,n,k,j,i) = 0.0; }
+        if ((mb_excised_(m) && rad_mask_(m,k,j,i)) || fabs(n_0) < n_0_floor_) {
+          i0(m,n,k,j,i) = 0.0;
+        }
       }
     }
   });
@@ -36,6 +36,7 @@ class SourceTerms {
   // flags for various source terms
   bool const_accel;
   bool ism_cooling;
+  bool ism_cool_subcycle;
   bool rel_cooling;
   bool beam;
   bool shearing_box, shearing_box_r_phi;
@@ -50,6 +51,12 @@ class SourceTerms {
   // heating rate used with ISM cooling
   Real hrate;
 
+  // tabulated ISM cooling curve: log10(Lambda) from ISMCoolFn() at uniform log10(T)
+  // spacing, built once in the constructor and read on device by ISMCoolTableFn()
+  DualArray1D<Real> ism_cool_table;
+  int ism_ntab;
+  Real ism_logtmin, ism_invdlogt;
+
   // cooling rate used with relativistic cooling
   Real crate_rel;
   Real cpower_rel;
@@ -65,6 +72,8 @@ class SourceTerms {
                      const Real dt, DvceArray5D<Real> &u0);
   void ISMCooling(const DvceArray5D<Real> &w0, const EOS_Data &eos,
                   const Real dt, DvceArray5D<Real> &u0);
+  void ISMCoolingSubcycled(DvceArray5D<Real> &w0, const EOS_Data &eos,
+                           const Real dt, DvceArray5D<Real> &u0);
   void RelCooling(const DvceArray5D<Real> &w0, const EOS_Data &eos,
                   const Real dt, DvceArray5D<Real> &u0);
   void BeamSource(DvceArray5D<Real> &i0, const Real dt);
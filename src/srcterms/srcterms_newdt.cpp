@@ -32,7 +32,9 @@ void SourceTerms::NewTimeStep(const DvceArray5D<Real> &w0, const EOS_Data &eos_d
   const int nji  = nx2*nx1;
   dtnew = static_cast<Real>(std::numeric_limits<float>::max());
 
-  if (ism_cooling) {
+  // with subcycling the cooling term is integrated with its own per-cell substeps in
+  // ISMCoolingSubcycled(), so it places no constraint on the global timestep
+  if (ism_cooling && !ism_cool_subcycle) {
     Real use_e = eos_data.use_e;
     Real gamma = eos_data.gamma;
     Real gm1 = gamma - 1.0;
@@ -44,6 +46,10 @@ void SourceTerms::NewTimeStep(const DvceArray5D<Real> &w0, const EOS_Data &eos_d
                         / n_unit/n_unit;
     Real heating_unit = pmy_pack->punit->pressure_cgs()/pmy_pack->punit->time_cgs()
                         / n_unit;
+    auto &ctab = ism_cool_table;
+    Real logtmin = ism_logtmin;
+    Real invdlogt = ism_invdlogt;
+    int ntab = ism_ntab;
 
     // find smallest (e/cooling_rate) in each cell
     Kokkos::parallel_reduce("srcterms_cooling_newdt",
@@ -68,7 +74,8 @@ void SourceTerms::NewTimeStep(const DvceArray5D<Real> &w0, const EOS_Data &eos_d
         eint = w0(m,ITM,k,j,i)*w0(m,IDN,k,j,i)/gm1;
       }
 
-      Real lambda_cooling = ISMCoolFn(temp)/cooling_unit;
+      Real lambda_cooling = ISMCoolTableFn(temp, ctab, logtmin, invdlogt, ntab)
+                            /cooling_unit;
       Real gamma_heating = heating_rate/heating_unit;
 
       // add a tiny number
@@ -39,8 +39,10 @@ TurbulenceDriver::TurbulenceDriver(MeshBlockPack *pp, ParameterInput *pin) :
   zccc("zccc",1),zccs("zccs",1),zcsc("zcsc",1),zcss("zcss",1),
   zscc("zscc",1),zscs("zscs",1),zssc("zssc",1),zsss("zsss",1),
   kx_mode("kx_mode",1),ky_mode("ky_mode",1),kz_mode("kz_mode",1),
+  mode_idx("mode_idx",1),
   xcos("xcos",1,1,1),xsin("xsin",1,1,1),ycos("ycos",1,1,1),
-  ysin("ysin",1,1,1),zcos("zcos",1,1,1),zsin("zsin",1,1,1) {
+  ysin("ysin",1,1,1),zcos("zcos",1,1,1),zsin("zsin",1,1,1),
+  amp_z("amp_z",1,1,1,1,1),amp_yz("amp_yz",1,1,1,1,1) {
   // allocate memory for force registers
   int nmb = pmy_pack->nmb_thispack;
   auto &indcs = pmy_pack->pmesh->mb_indcs;
@@ -70,11 +72,17 @@ TurbulenceDriver::TurbulenceDriver(MeshBlockPack *pp, ParameterInput *pin) :
 
   mode_count = 0;
 
+  // count driven modes and build map from integer wavenumbers to mode number, which is
+  // used to synthesize the force field one axis at a time (see InitializeModes)
+  int nw = nhigh + 1;
+  Kokkos::realloc(mode_idx, nw*nw*nw);
+
   int nkx, nky, nkz;
   Real nsqr;
   for (nkx = 0; nkx <= nhigh; nkx++) {
     for (nky = 0; nky <= nhigh; nky++) {
       for (nkz = 0; nkz <= nhigh; nkz++) {
+        mode_idx.h_view((nkx*nw + nky)*nw + nkz) = -1;
         if (nkx == 0 && nky == 0 && nkz == 0) continue;
         nsqr = 0.0;
         bool flag_prl = true;
@@ -90,11 +98,14 @@ TurbulenceDriver::TurbulenceDriver(MeshBlockPack *pp, ParameterInput *pin) :
           }
         }
         if (nsqr >= nlow_sqr && nsqr <= nhigh_sqr && flag_prl) {
+          mode_idx.h_view((nkx*nw + nky)*nw + nkz) = mode_count;
           mode_count++;
         }
       }
     }
   }
+  mode_idx.template modify<HostMemSpace>();
+  mode_idx.template sync<DevExeSpace>();
 
   Kokkos::realloc(xccc, mode_count);
   Kokkos::realloc(xccs, mode_count);
@@ -127,12 +138,19 @@ TurbulenceDriver::TurbulenceDriver(MeshBlockPack *pp, ParameterInput *pin) :
   Kokkos::realloc(ky_mode, mode_count);
   Kokkos::realloc(kz_mode, mode_count);
 
-  Kokkos::realloc(xcos, nmb, mode_count, ncells1);
-  Kokkos::realloc(xsin, nmb, mode_count, ncells1);
-  Kokkos::realloc(ycos, nmb, mode_count, ncells2);
-  Kokkos::realloc(ysin, nmb, mode_count, ncells2);
-  Kokkos::realloc(zcos, nmb, mode_count, ncells3);
-  Kokkos::realloc(zsin, nmb, mode_count, ncells3);
+  // trig tables are indexed by integer wavenumber (0...nhigh), not by mode, so modes
+  // sharing a wavenumber along one axis share a table row
+  Kokkos::realloc(xcos, nmb, nw, ncells1);
+  Kokkos::realloc(xsin, nmb, nw, ncells1);
+  Kokkos::realloc(ycos, nmb, nw, ncells2);
+  Kokkos::realloc(ysin, nmb, nw, ncells2);
+  Kokkos::realloc(zcos, nmb, nw, ncells3);
+  Kokkos::realloc(zsin, nmb, nw, ncells3);
+
+  // partial sums of mode amplitudes after contracting the z-axis (x- and y-axis) trig
+  // factors, for each force component and each remaining sin/cos combination
+  Kokkos::realloc(amp_z, nmb, 12, nw, nw, ncells3);
+  Kokkos::realloc(amp_yz, nmb, 6, nw, ncells2, ncells3);
 
   Initialize();
 }
@@ -168,7 +186,12 @@ void TurbulenceDriver::Initialize() {
     force_(m,n,k,j,i) = 0.0;
   });
 
+  // seed RNG; on restarts the full state (including the cached Box-Mueller deviate) is
+  // overwritten with the one stored in the restart file, so the deviate sequence
+  // continues exactly where the previous run left off
   rstate.idum = -1;
+  rstate.iset = 0;
+  rstate.gset = 0.0;
 
   auto kx_mode_ = kx_mode;
   auto ky_mode_ = ky_mode;
@@ -233,22 +256,23 @@ void TurbulenceDriver::Initialize() {
 
   auto &size = pmy_pack->pmb->mb_size;
 
-  par_for("xsin/xcos", DevExeSpace(),0,nmb-1,0,mode_count-1,is,ie,
+  // trig tables indexed by integer wavenumber along each axis
+  par_for("xsin/xcos", DevExeSpace(),0,nmb-1,0,nhigh,is,ie,
   KOKKOS_LAMBDA(int m, int n, int i) {
     Real &x1min = size.d_view(m).x1min;
     Real &x1max = size.d_view(m).x1max;
     Real x1v = CellCenterX(i-is, nx1, x1min, x1max);
-    Real k1v = kx_mode_.d_view(n);
+    Real k1v = dkx*n;
     xsin_(m,n,i) = sin(k1v*x1v);
     xcos_(m,n,i) = cos(k1v*x1v);
   });
 
-  par_for("ysin/ycos", DevExeSpace(),0,nmb-1,0,mode_count-1,js,je,
+  par_for("ysin/ycos", DevExeSpace(),0,nmb-1,0,nhigh,js,je,
   KOKKOS_LAMBDA(int m, int n, int j) {
     Real &x2min = size.d_view(m).x2min;
     Real &x2max = size.d_view(m).x2max;
     Real x2v = CellCenterX(j-js, nx2, x2min, x2max);
-    Real k2v = ky_mode_.d_view(n);
+    Real k2v = dky*n;
     ysin_(m,n,j) = sin(k2v*x2v);
     ycos_(m,n,j) = cos(k2v*x2v);
     if (ncells2-1 == 0) {
@@ -257,12 +281,12 @@ void TurbulenceDriver::Initialize() {
     }
   });
 
-  par_for("zsin/zcos", DevExeSpace(),0,nmb-1,0,mode_count-1,ks,ke,
+  par_for("zsin/zcos", DevExeSpace(),0,nmb-1,0,nhigh,ks,ke,
   KOKKOS_LAMBDA(int m, int n, int k) {
     Real &x3min = size.d_view(m).x3min;
     Real &x3max = size.d_view(m).x3max;
     Real x3v = CellCenterX(k-ks, nx3, x3min, x3max);
-    Real k3v = kz_mode_.d_view(n);
+    Real k3v = dkz*n;
     zsin_(m,n,k) = sin(k3v*x3v);
     zcos_(m,n,k) = cos(k3v*x3v);
     if (ncells3-1 == 0) {
@@ -282,8 +306,10 @@ void TurbulenceDriver::Initialize() {
 
 void TurbulenceDriver::IncludeInitializeModesTask(std::shared_ptr<TaskList> tl,
                                                   TaskID start) {
-  auto id_init = tl->AddTask(&TurbulenceDriver::InitializeModes, this, start);
-  auto id_add = tl->AddTask(&TurbulenceDriver::AddForcing, this, id_init);
+  auto id_init = tl->AddTask(&TurbulenceDriver::InitializeModes, this, start,
+                             "TurbulenceDriver::InitializeModes");
+  auto id_add = tl->AddTask(&TurbulenceDriver::AddForcing, this, id_init,
+                            "TurbulenceDriver::AddForcing");
   return;
 }
 
@@ -298,15 +324,18 @@ void TurbulenceDriver::IncludeAddForcingTask(std::shared_ptr<TaskList> tl, TaskI
   if (pmy_pack->pionn == nullptr) {
     if (pmy_pack->phydro != nullptr) {
       auto id = tl->InsertTask(&TurbulenceDriver::AddForcing, this,
-                              pmy_pack->phydro->id.flux, pmy_pack->phydro->id.rkupdt);
+                              pmy_pack->phydro->id.flux, pmy_pack->phydro->id.rkupdt,
+                              "TurbulenceDriver::AddForcing");
     }
     if (pmy_pack->pmhd != nullptr) {
       auto id = tl->InsertTask(&TurbulenceDriver::AddForcing, this,
-                              pmy_pack->pmhd->id.flux, pmy_pack->pmhd->id.rkupdt);
+                              pmy_pack->pmhd->id.flux, pmy_pack->pmhd->id.rkupdt,
+                              "TurbulenceDriver::AddForcing");
     }
   } else {
     auto id = tl->InsertTask(&TurbulenceDriver::AddForcing, this,
-                            pmy_pack->pionn->id.n_flux, pmy_pack->pionn->id.n_rkupdt);
+                            pmy_pack->pionn->id.n_flux, pmy_pack->pionn->id.n_rkupdt,
+                            "TurbulenceDriver::AddForcing");
   }
 
   return;
@@ -343,7 +372,6 @@ TaskStatus TurbulenceDriver::InitializeModes(Driver *pdrive, int stage) {
 
   int nlow_sqr = SQR(nlow);
   int nhigh_sqr = SQR(nhigh);
-  auto mode_count_ = mode_count;
 
   auto xccc_ = xccc;
   auto xccs_ = xccs;
@@ -667,37 +695,91 @@ TaskStatus TurbulenceDriver::InitializeModes(Driver *pdrive, int stage) {
   auto zcos_ = zcos;
   auto zsin_ = zsin;
 
-  for (int n=0; n<mode_count_; n++) {
-    par_for("force_compute", DevExeSpace(),0,nmb-1,ks,ke,js,je,is,ie,
-    KOKKOS_LAMBDA(int m, int k, int j, int i) {
-      force_tmp_(m,0,k,j,i) += xccc_.d_view(n)*xcos_(m,n,i)*ycos_(m,n,j)*zcos_(m,n,k);
-      force_tmp_(m,0,k,j,i) += xccs_.d_view(n)*xcos_(m,n,i)*ycos_(m,n,j)*zsin_(m,n,k);
-      force_tmp_(m,0,k,j,i) += xcsc_.d_view(n)*xcos_(m,n,i)*ysin_(m,n,j)*zcos_(m,n,k);
-      force_tmp_(m,0,k,j,i) += xcss_.d_view(n)*xcos_(m,n,i)*ysin_(m,n,j)*zsin_(m,n,k);
-      force_tmp_(m,0,k,j,i) += xscc_.d_view(n)*xsin_(m,n,i)*ycos_(m,n,j)*zcos_(m,n,k);
-      force_tmp_(m,0,k,j,i) += xscs_.d_view(n)*xsin_(m,n,i)*ycos_(m,n,j)*zsin_(m,n,k);
-      force_tmp_(m,0,k,j,i) += xssc_.d_view(n)*xsin_(m,n,i)*ysin_(m,n,j)*zcos_(m,n,k);
-      force_tmp_(m,0,k,j,i) += xsss_.d_view(n)*xsin_(m,n,i)*ysin_(m,n,j)*zsin_(m,n,k);
-
-      force_tmp_(m,1,k,j,i) += yccc_.d_view(n)*xcos_(m,n,i)*ycos_(m,n,j)*zcos_(m,n,k);
-      force_tmp_(m,1,k,j,i) += yccs_.d_view(n)*xcos_(m,n,i)*ycos_(m,n,j)*zsin_(m,n,k);
-      force_tmp_(m,1,k,j,i) += ycsc_.d_view(n)*xcos_(m,n,i)*ysin_(m,n,j)*zcos_(m,n,k);
-      force_tmp_(m,1,k,j,i) += ycss_.d_view(n)*xcos_(m,n,i)*ysin_(m,n,j)*zsin_(m,n,k);
-      force_tmp_(m,1,k,j,i) += yscc_.d_view(n)*xsin_(m,n,i)*ycos_(m,n,j)*zcos_(m,n,k);
-      force_tmp_(m,1,k,j,i) += yscs_.d_view(n)*xsin_(m,n,i)*ycos_(m,n,j)*zsin_(m,n,k);
-      force_tmp_(m,1,k,j,i) += yssc_.d_view(n)*xsin_(m,n,i)*ysin_(m,n,j)*zcos_(m,n,k);
-      force_tmp_(m,1,k,j,i) += ysss_.d_view(n)*xsin_(m,n,i)*ysin_(m,n,j)*zsin_(m,n,k);
-
-      force_tmp_(m,2,k,j,i) += zccc_.d_view(n)*xcos_(m,n,i)*ycos_(m,n,j)*zcos_(m,n,k);
-      force_tmp_(m,2,k,j,i) += zccs_.d_view(n)*xcos_(m,n,i)*ycos_(m,n,j)*zsin_(m,n,k);
-      force_tmp_(m,2,k,j,i) += zcsc_.d_view(n)*xcos_(m,n,i)*ysin_(m,n,j)*zcos_(m,n,k);
-      force_tmp_(m,2,k,j,i) += zcss_.d_view(n)*xcos_(m,n,i)*ysin_(m,n,j)*zsin_(m,n,k);
-      force_tmp_(m,2,k,j,i) += zscc_.d_view(n)*xsin_(m,n,i)*ycos_(m,n,j)*zcos_(m,n,k);
-      force_tmp_(m,2,k,j,i) += zscs_.d_view(n)*xsin_(m,n,i)*ycos_(m,n,j)*zsin_(m,n,k);
-      force_tmp_(m,2,k,j,i) += zssc_.d_view(n)*xsin_(m,n,i)*ysin_(m,n,j)*zcos_(m,n,k);
-      force_tmp_(m,2,k,j,i) += zsss_.d_view(n)*xsin_(m,n,i)*ysin_(m,n,j)*zsin_(m,n,k);
-    });
-  }
+  // Synthesize force from mode amplitudes by contracting the trig factors one axis at a
+  // time (separable transform, as in an FFT).  This replaces the per-mode sum over the
+  // whole grid, so per-cell work scales with nhigh rather than with mode_count.
+  auto mode_idx_ = mode_idx;
+  auto amp_z_ = amp_z;
+  auto amp_yz_ = amp_yz;
+  int nh = nhigh;
+  int nw = nhigh + 1;
+
+  // contract z-axis trig factors: for each force component and each x/y sin/cos
+  // combination, sum modes sharing (nkx,nky) over nkz
+  par_for("turb_fold_z", DevExeSpace(),0,nmb-1,0,nh,0,nh,ks,ke,
+  KOKKOS_LAMBDA(int m, int nkx, int nky, int k) {
+    Real fxcc=0.0, fxcs=0.0, fxsc=0.0, fxss=0.0;
+    Real fycc=0.0, fycs=0.0, fysc=0.0, fyss=0.0;
+    Real fzcc=0.0, fzcs=0.0, fzsc=0.0, fzss=0.0;
+    for (int nkz=0; nkz<=nh; ++nkz) {
+      int n = mode_idx_.d_view((nkx*nw + nky)*nw + nkz);
+      if (n < 0) continue;
+      Real zc = zcos_(m,nkz,k);
+      Real zs = zsin_(m,nkz,k);
+      fxcc += xccc_.d_view(n)*zc + xccs_.d_view(n)*zs;
+      fxcs += xcsc_.d_view(n)*zc + xcss_.d_view(n)*zs;
+      fxsc += xscc_.d_view(n)*zc + xscs_.d_view(n)*zs;
+      fxss += xssc_.d_view(n)*zc + xsss_.d_view(n)*zs;
+      fycc += yccc_.d_view(n)*zc + yccs_.d_view(n)*zs;
+      fycs += ycsc_.d_view(n)*zc + ycss_.d_view(n)*zs;
+      fysc += yscc_.d_view(n)*zc + yscs_.d_view(n)*zs;
+      fyss += yssc_.d_view(n)*zc + ysss_.d_view(n)*zs;
+      fzcc += zccc_.d_view(n)*zc + zccs_.d_view(n)*zs;
+      fzcs += zcsc_.d_view(n)*zc + zcss_.d_view(n)*zs;
+      fzsc += zscc_.d_view(n)*zc + zscs_.d_view(n)*zs;
+      fzss += zssc_.d_view(n)*zc + zsss_.d_view(n)*zs;
+    }
+    amp_z_(m,0, nkx,nky,k) = fxcc;
+    amp_z_(m,1, nkx,nky,k) = fxcs;
+    amp_z_(m,2, nkx,nky,k) = fxsc;
+    amp_z_(m,3, nkx,nky,k) = fxss;
+    amp_z_(m,4, nkx,nky,k) = fycc;
+    amp_z_(m,5, nkx,nky,k) = fycs;
+    amp_z_(m,6, nkx,nky,k) = fysc;
+    amp_z_(m,7, nkx,nky,k) = fyss;
+    amp_z_(m,8, nkx,nky,k) = fzcc;
+    amp_z_(m,9, nkx,nky,k) = fzcs;
+    amp_z_(m,10,nkx,nky,k) = fzsc;
+    amp_z_(m,11,nkx,nky,k) = fzss;
+  });
+
+  // contract y-axis trig factors over nky
+  par_for("turb_fold_y", DevExeSpace(),0,nmb-1,0,nh,ks,ke,js,je,
+  KOKKOS_LAMBDA(int m, int nkx, int k, int j) {
+    Real fxc=0.0, fxs=0.0, fyc=0.0, fys=0.0, fzc=0.0, fzs=0.0;
+    for (int nky=0; nky<=nh; ++nky) {
+      Real yc = ycos_(m,nky,j);
+      Real ys = ysin_(m,nky,j);
+      fxc += amp_z_(m,0, nkx,nky,k)*yc + amp_z_(m,1, nkx,nky,k)*ys;
+      fxs += amp_z_(m,2, nkx,nky,k)*yc + amp_z_(m,3, nkx,nky,k)*ys;
+      fyc += amp_z_(m,4, nkx,nky,k)*yc + amp_z_(m,5, nkx,nky,k)*ys;
+      fys += amp_z_(m,6, nkx,nky,k)*yc + amp_z_(m,7, nkx,nky,k)*ys;
+      fzc += amp_z_(m,8, nkx,nky,k)*yc + amp_z_(m,9, nkx,nky,k)*ys;
+      fzs += amp_z_(m,10,nkx,nky,k)*yc + amp_z_(m,11,nkx,nky,k)*ys;
+    }
+    amp_yz_(m,0,nkx,j,k) = fxc;
+    amp_yz_(m,1,nkx,j,k) = fxs;
+    amp_yz_(m,2,nkx,j,k) = fyc;
+    amp_yz_(m,3,nkx,j,k) = fys;
+    amp_yz_(m,4,nkx,j,k) = fzc;
+    amp_yz_(m,5,nkx,j,k) = fzs;
+  });
+
+  // contract x-axis trig factors over nkx to obtain the force in each cell
+  par_for("turb_fold_x", DevExeSpace(),0,nmb-1,ks,ke,js,je,is,ie,
+  KOKKOS_LAMBDA(int m, int k, int j, int i) {
+    Real f1=0.0, f2=0.0, f3=0.0;
+    for (int nkx=0; nkx<=nh; ++nkx) {
+      Real xc = xcos_(m,nkx,i);
+      Real xs = xsin_(m,nkx,i);
+      f1 += amp_yz_(m,0,nkx,j,k)*xc + amp_yz_(m,1,nkx,j,k)*xs;
+      f2 += amp_yz_(m,2,nkx,j,k)*xc + amp_yz_(m,3,nkx,j,k)*xs;
+      f3 += amp_yz_(m,4,nkx,j,k)*xc + amp_yz_(m,5,nkx,j,k)*xs;
+    }
+    force_tmp_(m,0,k,j,i) = f1;
+    force_tmp_(m,1,k,j,i) = f2;
+    force_tmp_(m,2,k,j,i) = f3;
+  });
 
   DvceArray5D<Real> u0, u0_;
   if (pmy_pack->phydro != nullptr) u0 = (pmy_pack->phydro->u0);
@@ -31,7 +31,9 @@ class TurbulenceDriver {
   DualArray1D<Real> yccc, yccs, ycsc, ycss, yscc, yscs, yssc, ysss;
   DualArray1D<Real> zccc, zccs, zcsc, zcss, zscc, zscs, zssc, zsss;
   DualArray1D<Real> kx_mode, ky_mode, kz_mode;
-  DvceArray3D<Real> xcos, xsin, ycos, ysin, zcos, zsin;
+  DualArray1D<int> mode_idx;           // (nkx,nky,nkz) -> mode number (-1 if not driven)
+  DvceArray3D<Real> xcos, xsin, ycos, ysin, zcos, zsin;  // trig per integer wavenumber
+  DvceArray5D<Real> amp_z, amp_yz;     // partial sums for separable force synthesis
 
   // parameters of driving
   int nlow, nhigh;
@@ -48,7 +50,6 @@ class TurbulenceDriver {
   void Initialize();
 
  private:
-  bool first_time = true;   // flag to enable initialization on first call
   MeshBlockPack *pmy_pack;  // ptr to MeshBlockPack containing this TurbulenceDriver
 };
 
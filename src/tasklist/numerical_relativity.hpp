@@ -61,6 +61,8 @@ enum TaskName {
   Z4c_CalcRHS,
   Z4c_SomBC,
   Z4c_ExplRK,
+  Z4c_ExplRKInt,
+  Z4c_AlgCInt,
   Z4c_SendU,
   Z4c_RestU,
   Z4c_RecvU,
@@ -82,6 +84,7 @@ enum TaskName {
   Z4c_ClearRW,
   Z4c_Wave,
   Z4c_PT,
+  Z4c_AHF,
   Z4c_NTASKS
 };
 
@@ -13,12 +13,16 @@
 // This version includes improvements due to Josh Dolence and the Parthenon dev team, and
 // extensions by J.M.Stone.
 
+#include <algorithm>
 #include <iostream>
 #include <bitset>
 #include <functional>
+#include <memory>
+#include <string>
+#include <utility>
 #include <vector>
-#include <list>
-#include <iterator>
+
+#include "athena.hpp"
 
 class Driver;
 
@@ -83,18 +87,33 @@ class TaskID {
 //! \class Task
 //  \brief data and function pointer for an individual Task
 //  NOTE: Task function must take arguments (Driver*, int)
+//  The callable is stored type-erased as a raw (function pointer, context pointer) pair
+//  compiled once at AddTask(); dispatch in DoAvailable() is then a single indirect call
+//  with no std::function machinery.  Context lifetime is managed by the owning TaskList.
 
 class Task {
  public:
-  Task(TaskID id, TaskID dep, std::function<TaskStatus(Driver*, int)> func) :
-  myid_(id), dep_(dep), func_(func) {}
+  using TaskFnPtr = TaskStatus (*)(void*, Driver*, int);
+  Task(TaskID id, TaskID dep, TaskFnPtr fn, void *ctx, std::string name) :
+  myid_(id), dep_(dep), fn_(fn), ctx_(ctx), name_(std::move(name)) {}
   // overloaded operator() calls task function
-  TaskStatus operator()(Driver *d, int s) {return func_(d,s);}
+  TaskStatus operator()(Driver *d, int s) {return fn_(ctx_,d,s);}
   TaskID GetID() {return myid_;}
   TaskID GetDependency() {return dep_;}
+  const std::string &GetName() {return name_;}
   void SetComplete() {complete_ = true;}
   void SetIncomplete() {complete_ = false;}
   bool IsComplete() {return complete_;}
+  // asynchronous tasks may be launched on a non-default execution space instance
+  // (stream), overlapping their kernels with those of independent tasks.  Only flag a
+  // task asynchronous if every kernel it launches uses Driver::ExecSpace()
+  void SetAsync() {async_ = true;}
+  bool IsAsync() {return async_;}
+  void SetStream(int strm) {strm_ = strm;}
+  int GetStream() {return strm_;}
+  // measured cost accumulated over every call; used to order the replay schedule
+  void AddCost(double c) {cost_ += c;}
+  double GetCost() {return cost_;}
   // If this Task depends on id, change that dependency to 'newdep'
   void ChangeDependency(TaskID id, TaskID newdep) {
     if ((dep_ & id) == id) {dep_ = ((dep_ ^ id) | newdep);}
@@ -105,12 +124,30 @@ class Task {
   TaskID dep_;     // encodes dependencies to other tasks in bitfld_
   // bool lb_time_;   // flag to include this task in timing for automatic load balancing
   bool complete_ = false;
-  std::function<TaskStatus(Driver*, int)> func_;  // ptr to Task function
+  bool async_ = false;  // task may be launched on a non-default stream
+  int strm_ = 0;        // index of stream (in Driver pool) task was launched on
+  double cost_ = 0.0;   // accumulated host time of every call to this task
+  TaskFnPtr fn_;        // raw dispatch function; invokes callable stored in ctx_
+  void *ctx_;           // type-erased callable, owned by the TaskList
+  std::string name_;    // short name given at AddTask(), used for profiling regions
 };
 
 //----------------------------------------------------------------------------------------
 //! \class TaskList
 //  \brief data and function definitions for task list class
+//  Tasks are stored in a contiguous array that is built once at assembly and reused
+//  verbatim every cycle; Reset() only clears completion flags and never allocates.
+//  Since the list structure is static after assembly, the order in which tasks complete
+//  during the first full cycle is recorded and replayed on every later cycle: steady
+//  state execution then sweeps the tasks in a known-good topological order behind a
+//  cursor that skips the completed prefix, instead of re-scanning the whole list (and
+//  re-checking dependencies of finished tasks) on every polling pass.  Dependencies are
+//  still checked before each launch, so tasks that wait on communication retain their
+//  usual polling semantics when messages arrive in a different order than recorded.
+//  The replayed order is further refined from measured per-task cost (see
+//  ReorderSchedule()): within each dependency level the most expensive task is visited
+//  first, so with a stream pool large kernels are launched at the head of each overlap
+//  window rather than leaving the device idle behind them at the tail.
 
 class TaskList {
  public:
@@ -119,13 +156,9 @@ class TaskList {
 
   // functions (all implemented here)
   bool IsComplete() {
-    // cycle through task list and check if each task completed
-    for (auto &it : task_list_) {
-      auto id = it.GetID();
-      if (!(tasks_completed_.CheckDependencies(id))) return false;
-    }
-    // everything is done
-    return true;
+    // all_ids_ is the union of every TaskID added, so a single bitfield compare tests
+    // whether every task in the list has completed
+    return tasks_completed_.CheckDependencies(all_ids_);
   }
   int Size() {return task_list_.size();}
   bool Empty() {return task_list_.empty();}
@@ -138,48 +171,165 @@ class TaskList {
   //
   void Reset() {
     tasks_completed_.Clear();  // TaskID Clear() fn
-    for (auto &it : task_list_) { it.SetIncomplete(); }
+    for (auto &it : task_list_) {
+      it.SetIncomplete();
+      it.SetStream(0);
+    }
+    // discard a partial recording from a cycle that did not run to completion
+    if (!schedule_valid_) {schedule_.clear();}
+    replay_head_ = 0;
   }
 
-  // cycle through task list once, do any tasks whose dependencies are clear
+  // call one task, wrapped in a Kokkos profiling region named by task and stage when
+  // region annotation is enabled, so external profilers see the kernel stream grouped
+  // by task.  With the built-in profiler also enabled the host time of every call is
+  // accumulated into its per-task registry ('task' rows in the dump)
+  TaskStatus RunTask(Task &task, Driver *d, int s) {
+    if (!(profiler::annotate_regions)) {
+      // host time of the call is always accumulated into the task itself; it is the
+      // cost estimate used to order the replay schedule (see ReorderSchedule())
+      Kokkos::Timer rtimer;
+      TaskStatus status = task(d,s);
+      task.AddCost(rtimer.seconds());
+      return status;
+    }
+    std::string rname = task.GetName() + "_stg" + std::to_string(s);
+    Kokkos::Profiling::pushRegion(rname);
+    Kokkos::Timer rtimer;
+    TaskStatus status = task(d,s);
+    Kokkos::Profiling::popRegion();
+    task.AddCost(rtimer.seconds());
+    if (profiler::enabled) {
+      profiler::Accumulate(profiler::task_stats, rname, rtimer.seconds());
+    }
+    return status;
+  }
+
+  // cycle through task list once, do any tasks whose dependencies are clear.  Tasks are
+  // visited in recorded first-cycle completion order once a schedule exists (see class
+  // header comment), otherwise in list order while the schedule is recorded
   TaskListStatus DoAvailable(Driver *d, int s) {
-    for (auto &task : task_list_) {
+    const bool replay = schedule_valid_;
+    const int ntask = static_cast<int>(replay ? schedule_.size() : task_list_.size());
+    for (int n = (replay ? replay_head_ : 0); n < ntask; ++n) {
+      Task &task = task_list_[replay ? schedule_[n] : n];
+      if (task.IsComplete()) {
+        // advance replay cursor past leading run of completed tasks
+        if (replay && (n == replay_head_)) {replay_head_++;}
+        continue;
+      }
+      auto dep = task.GetDependency();
+      if ( tasks_completed_.CheckDependencies(dep) ) {
+        TaskStatus status = RunTask(task,d,s);  // calls Task function
+        if (status == TaskStatus::complete) {
+          task.SetComplete();              // set bool flag in task
+          MarkTaskComplete(task.GetID());  // add TaskID to tasks_completed_
+          if (!replay) {schedule_.push_back(n);}  // record completion order
+        }
+      }
+    }
+    if (IsComplete()) {
+      schedule_valid_ = !schedule_.empty();
+      if (schedule_valid_) {ReorderSchedule();}
+      return TaskListStatus::complete;
+    }
+    return TaskListStatus::running;
+  }
+
+  // cycle through task list once, do any tasks whose dependencies are clear.  Same as
+  // DoAvailable() above, except tasks flagged asynchronous at AddTask() are launched on
+  // execution space instances (streams) from the input pool so that independent kernels
+  // can overlap on the device.  A task inherits the stream of a completed dependency
+  // when possible, so chains of dependent tasks execute in-order on one stream; any
+  // dependency that ran on a different stream is fenced before the task is launched.
+  // Tasks not flagged asynchronous always run on strms[0], the default instance.
+  // 'cstrm' (in practice Driver::current_stream) communicates the assigned stream to
+  // the executing task function, which reads it through Driver::ExecSpace().
+  TaskListStatus DoAvailable(Driver *d, int s, std::vector<DevExeSpace> &strms,
+                             int &cstrm) {
+    int nstrm = static_cast<int>(strms.size());
+    const bool replay = schedule_valid_;
+    const int ntask = static_cast<int>(replay ? schedule_.size() : task_list_.size());
+    for (int n = (replay ? replay_head_ : 0); n < ntask; ++n) {
+      Task &task = task_list_[replay ? schedule_[n] : n];
+      if (task.IsComplete()) {
+        // advance replay cursor past leading run of completed tasks
+        if (replay && (n == replay_head_)) {replay_head_++;}
+        continue;
+      }
       auto dep = task.GetDependency();
-      if ( tasks_completed_.CheckDependencies(dep) && !(task.IsComplete()) ) {
-        TaskStatus status = task(d,s);  // calls Task function using overloaded operator()
+      if ( tasks_completed_.CheckDependencies(dep) ) {
+        // select stream this task will be launched on
+        int strm = 0;
+        if (task.IsAsync() && (nstrm > 1)) {
+          for (auto &prev : task_list_) {
+            if (prev.IsComplete() && dep.CheckDependencies(prev.GetID()) &&
+                (prev.GetStream() != 0)) {
+              strm = prev.GetStream();
+              break;
+            }
+          }
+          if (strm == 0) {strm = 1 + (rr_strm_++)%(nstrm - 1);}
+        }
+        // fence any stream on which a dependency ran, if different from this task's
+        for (auto &prev : task_list_) {
+          if (prev.IsComplete() && dep.CheckDependencies(prev.GetID()) &&
+              (prev.GetStream() != strm)) {
+            strms[prev.GetStream()].fence();
+          }
+        }
+        task.SetStream(strm);
+        cstrm = strm;
+        TaskStatus status = RunTask(task,d,s);  // calls Task function
+        cstrm = 0;
         if (status == TaskStatus::complete) {
           task.SetComplete();              // set bool flag in task
           MarkTaskComplete(task.GetID());  // add TaskID to tasks_completed_
+          if (!replay) {schedule_.push_back(n);}  // record completion order
         }
       }
     }
-    if (IsComplete()) return TaskListStatus::complete;
+    if (IsComplete()) {
+      schedule_valid_ = !schedule_.empty();
+      if (schedule_valid_) {ReorderSchedule();}
+      return TaskListStatus::complete;
+    }
     return TaskListStatus::running;
   }
 
   // ADD new Task with ID, given dependency, and a pointer to a static or non-member
   // function to the end of task list.  Returns ID of new task. Task function must have
-  // arguments (Driver*, int). Usage:
+  // arguments (Driver*, int).  Optional 'name' labels the task in profiling regions and
+  // dumps; unnamed tasks are labeled by their position in the list. Usage:
   //     taskid = tl.AddTask(DoSomething, dependency, name);
   template <class F>
-  TaskID AddTask(F func, TaskID &dep) {
+  TaskID AddTask(F func, TaskID &dep, const char *name="") {
     auto size = task_list_.size();
     TaskID id(size+1);
-    task_list_.push_back(
-      Task(id, dep, [=](Driver *d, int s) mutable -> TaskStatus {return func(d,s);}));
+    task_list_.push_back(Task(id, dep, &Dispatch<F>, StoreCallable(std::move(func)),
+       MakeTaskName(name, size)));
+    all_ids_.SetComplete(id);
+    InvalidateSchedule();
     return id;
   }
 
   // ADD new Task with ID, given dependency, and a pointer to a member function of
   // class T to the end of task list.  Returns ID of new task. Task function must have
-  // arguments (Driver*, int).  Usage:
-  //     taskid = tl.AddTask(&T::DoSomething, T, dependency);
+  // arguments (Driver*, int).  Optional argument 'async' flags the task for launch on
+  // a non-default stream when the list is run with a pool of execution space instances;
+  // only set it if every kernel the task launches uses Driver::ExecSpace().  Usage:
+  //     taskid = tl.AddTask(&T::DoSomething, T, dependency, name);
   template <class F, class T>
-  TaskID AddTask(F func, T *obj, TaskID &dep) {
+  TaskID AddTask(F func, T *obj, TaskID &dep, const char *name="", bool async=false) {
     auto size = task_list_.size();
     TaskID id(size+1);
+    BoundMember<F,T> bound{func, obj};
     task_list_.push_back( Task(id, dep,
-       [=](Driver *d, int s) mutable -> TaskStatus {return (obj->*func)(d,s);}) );
+       &Dispatch<BoundMember<F,T>>, StoreCallable(std::move(bound)),
+       MakeTaskName(name, size)) );
+    if (async) {task_list_.back().SetAsync();}
+    all_ids_.SetComplete(id);
+    InvalidateSchedule();
     return id;
   }
 
@@ -187,27 +337,36 @@ class TaskList {
   // list. Returns ID of new task. Task function must have arguments (Driver*, int).
   // Usage:
   //      taskid = tl.AddTask(DoSomething, dependency);
-  TaskID AddTask(std::function<TaskStatus(Driver*, int)> func, TaskID &dep) {
+  TaskID AddTask(std::function<TaskStatus(Driver*, int)> func, TaskID &dep,
+                 const char *name="") {
     auto size = task_list_.size();
     TaskID id(size+1);
-    task_list_.push_back(Task(id, dep, func));
+    task_list_.push_back(Task(id, dep,
+       &Dispatch<std::function<TaskStatus(Driver*, int)>>,
+       StoreCallable(std::move(func)), MakeTaskName(name, size)));
+    all_ids_.SetComplete(id);
+    InvalidateSchedule();
     return id;
   }
 
   // INSERT new Task with ID, given dependency, and a pointer to a member function of
   // class T in a position BEFORE the task with ID 'location'.  Returns ID of new task,
   // or taskID(0) if location not found. Usage:
-  //     taskid = tl.InsertTask(&T::DoSomething, T, dependency, location);
+  //     taskid = tl.InsertTask(&T::DoSomething, T, dependency, location, name);
   template <class F, class T>
-  TaskID InsertTask(F func, T *obj, TaskID &dep, TaskID &loc) {
-    std::list<Task>::iterator it;
+  TaskID InsertTask(F func, T *obj, TaskID &dep, TaskID &loc, const char *name="") {
+    std::vector<Task>::iterator it;
     for (it=task_list_.begin(); it!=task_list_.end(); ++it) {
       if (it->GetID() == loc) {
         auto size = task_list_.size();
         TaskID id(size+1);
         auto old_dep = it->GetDependency();
+        BoundMember<F,T> bound{func, obj};
         task_list_.insert(it, Task(id, dep,
-           [=](Driver *d, int s) mutable -> TaskStatus {return (obj->*func)(d,s); }));
+           &Dispatch<BoundMember<F,T>>, StoreCallable(std::move(bound)),
+           MakeTaskName(name, size)));
+        all_ids_.SetComplete(id);
+        InvalidateSchedule();
         // now change dependencies for all but this newly added Task
         for (auto it2=task_list_.begin(); it2!=task_list_.end(); ++it2) {
           if (it2->GetID() != id) {
@@ -221,8 +380,79 @@ class TaskList {
   }
 
  protected:
-  std::list<Task> task_list_;
+  // discard any recorded schedule; called whenever the list structure changes
+  void InvalidateSchedule() {
+    schedule_valid_ = false;
+    schedule_.clear();
+    replay_head_ = 0;
+  }
+  // Reorder the replay schedule by readiness level and measured cost: tasks are grouped
+  // by the length of their longest dependency chain (so everything runnable earlier is
+  // still visited earlier), and within a level the most expensive task is visited first
+  // -- longest-processing-time order, which lets big kernels head multi-stream overlap
+  // windows instead of serializing behind cheap ones at the tail.  Any visit order is
+  // correct since dependencies are re-checked before every launch; this only changes
+  // which ready task is launched first.  Called at the end of every completed cycle so
+  // the ordering tracks the accumulating cost measurements.
+  void ReorderSchedule() {
+    const int ntask = static_cast<int>(schedule_.size());
+    std::vector<int> level(task_list_.size(), 0);
+    // schedule_ is in completion order, hence topological: dependency levels can be
+    // computed in a single pass
+    for (int n=0; n<ntask; ++n) {
+      Task &task = task_list_[schedule_[n]];
+      auto dep = task.GetDependency();
+      int lvl = 0;
+      for (std::size_t p=0; p<task_list_.size(); ++p) {
+        if (dep.CheckDependencies(task_list_[p].GetID())) {
+          lvl = std::max(lvl, level[p] + 1);
+        }
+      }
+      level[schedule_[n]] = lvl;
+    }
+    std::stable_sort(schedule_.begin(), schedule_.end(),
+      [&](int a, int b) {
+        if (level[a] != level[b]) {return level[a] < level[b];}
+        return task_list_[a].GetCost() > task_list_[b].GetCost();
+      });
+  }
+  // name given at AddTask(), or a positional label for tasks added without one
+  static std::string MakeTaskName(const char *name, std::size_t indx) {
+    if (name[0] != '\0') {return std::string(name);}
+    return "task" + std::to_string(indx+1);
+  }
+  // member function pointer bound to an object instance; the stored callable for tasks
+  // added with the (func, obj, dep) form of AddTask()
+  template <class F, class T>
+  struct BoundMember {
+    F func;
+    T *obj;
+    TaskStatus operator()(Driver *d, int s) {return (obj->*func)(d,s);}
+  };
+  // uniform dispatch function for any callable type; its address is the raw function
+  // pointer stored in each Task
+  template <class C>
+  static TaskStatus Dispatch(void *ctx, Driver *d, int s) {
+    return (*static_cast<C*>(ctx))(d,s);
+  }
+  // copy callable into list-owned storage, returning the type-erased context pointer.
+  // shared_ptr<void> carries the correctly-typed deleter; tasks are only ever added, so
+  // pointers stay valid for the life of the list
+  template <class C>
+  void* StoreCallable(C &&callable) {
+    task_ctx_.push_back(std::shared_ptr<void>(new C(std::move(callable)),
+       [](void *p) {delete static_cast<C*>(p);}));
+    return task_ctx_.back().get();
+  }
+
+  std::vector<Task> task_list_;          // contiguous; built once, reused every cycle
+  std::vector<std::shared_ptr<void>> task_ctx_;  // owns type-erased task callables
   TaskID tasks_completed_;
+  TaskID all_ids_;   // union of IDs of every task in list, for O(1) IsComplete()
+  int rr_strm_ = 0;  // round-robin counter for assigning streams to new task chains
+  std::vector<int> schedule_;    // task indices in recorded first-cycle completion order
+  bool schedule_valid_ = false;  // a full cycle has been recorded and can be replayed
+  int replay_head_ = 0;          // replay cursor; all schedule_[n<head] tasks complete
 };
 
 #endif  // TASKLIST_TASK_LIST_HPP_
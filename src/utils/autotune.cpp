@@ -0,0 +1,180 @@
+//========================================================================================
+// AthenaXXX astrophysical plasma code
+// Copyright(C) 2020 James M. Stone <jmstone@ias.edu> and the Athena code team
+// Licensed under the 3-clause BSD License (the "LICENSE")
+//========================================================================================
+//! \file autotune.cpp
+//! \brief implementation of the par_for_outer launch-bound autotuner, including the
+//! exploration schedule and the on-disk tuning cache.  The cache is a plain text file
+//! with one line per tuned kernel prefixed by a key built from the execution space and
+//! MeshBlock size; lines for other keys (other devices or problem shapes) are preserved
+//! when the file is rewritten, so one cache file can serve a whole machine.
+
+#include <algorithm>
+#include <cstdint>
+#include <fstream>
+#include <iostream>
+#include <map>
+#include <sstream>
+#include <string>
+#include <vector>
+
+#include "athena.hpp"
+#include "globals.hpp"
+#include "utils/autotune.hpp"
+
+namespace autotune {
+
+bool enabled = false;
+std::map<std::string, TuneState> tune_state;
+
+// candidate launch bounds.  Entry 0 (all-AUTO) is both the fallback when tuning is
+// disabled and the baseline every explicit candidate must beat
+const TeamConfig configs[nconfig] = {
+  {-1, -1}, {32, -1}, {64, -1}, {128, -1}, {256, -1}, {512, -1}
+};
+
+// cache entries loaded from disk: sanitized kernel name -> pinned candidate index.
+// Consulted lazily on the first launch of each kernel
+static std::map<std::string, int> cache_best;
+static std::string cache_fname;
+static std::string cache_key;
+
+//----------------------------------------------------------------------------------------
+//! \fn static std::string SanitizedName
+//! \brief kernel name with spaces replaced so cache lines parse as whitespace-separated
+//! fields (same convention as the profiler's cross-rank serialization)
+
+static std::string SanitizedName(const std::string &name) {
+  std::string sname = name;
+  std::replace(sname.begin(), sname.end(), ' ', '_');
+  return sname;
+}
+
+//----------------------------------------------------------------------------------------
+//! \fn int Candidate
+//! \brief returns the candidate index to launch the named kernel with.  Sets 'measure'
+//! while the kernel is still exploring, in which case the caller times the launch and
+//! reports it through Accumulate().  The on-disk cache is consulted on first launch.
+
+int Candidate(const std::string &name, bool &measure) {
+  TuneState &s = tune_state[name];
+  if ((s.best < 0) && (s.cand == 0) && (s.launches == 0)) {
+    auto it = cache_best.find(SanitizedName(name));
+    if (it != cache_best.end()) {s.best = it->second;}
+  }
+  if (s.best >= 0) {
+    measure = false;
+    return s.best;
+  }
+  measure = true;
+  return s.cand;
+}
+
+//----------------------------------------------------------------------------------------
+//! \fn void Accumulate
+//! \brief folds one timed launch into the exploration state of the named kernel.  The
+//! first launch of each candidate is discarded as warm-up; after 'ntrial' timed launches
+//! exploration advances to the next candidate, and once all candidates have been
+//! measured the one with the smallest mean time is pinned.
+
+void Accumulate(const std::string &name, int cand, double dt) {
+  TuneState &s = tune_state[name];
+  s.launches++;
+  if (s.launches > 1) {
+    s.time[cand] += dt;
+    s.trials[cand]++;
+  }
+  if (s.trials[cand] < ntrial) {return;}
+  s.cand++;
+  s.launches = 0;
+  if (s.cand < nconfig) {return;}
+  int best = 0;
+  double tbest = s.time[0]/static_cast<double>(s.trials[0]);
+  for (int c=1; c<nconfig; ++c) {
+    double tmean = s.time[c]/static_cast<double>(s.trials[c]);
+    if (tmean < tbest) {
+      best = c;
+      tbest = tmean;
+    }
+  }
+  s.best = best;
+  return;
+}
+
+//----------------------------------------------------------------------------------------
+//! \fn void LoadCache
+//! \brief builds the cache key from the execution space and MeshBlock cell counts and
+//! loads any matching entries from the named file.  Missing file is not an error (first
+//! run on this device/problem shape); entries whose launch bounds are no longer in the
+//! candidate table are ignored so those kernels simply re-explore.
+
+void LoadCache(const std::string &fname, int nx1, int nx2, int nx3) {
+  cache_fname = fname;
+  std::stringstream key;
+  key << DevExeSpace().name() << "-c" << DevExeSpace().concurrency()
+      << "-" << nx1 << "x" << nx2 << "x" << nx3;
+  cache_key = key.str();
+
+  std::ifstream cfile(cache_fname);
+  if (!cfile.is_open()) {return;}
+  std::string line;
+  while (std::getline(cfile, line)) {
+    if (line.empty() || line[0] == '#') {continue;}
+    std::stringstream ss(line);
+    std::string key_read, name;
+    int ts, vl;
+    if (!(ss >> key_read >> name >> ts >> vl)) {continue;}
+    if (key_read != cache_key) {continue;}
+    for (int c=0; c<nconfig; ++c) {
+      if ((configs[c].team_size == ts) && (configs[c].vector_len == vl)) {
+        cache_best[name] = c;
+        break;
+      }
+    }
+  }
+  return;
+}
+
+//----------------------------------------------------------------------------------------
+//! \fn void DumpCache
+//! \brief rewrites the cache file with the launch bounds pinned during this run,
+//! preserving lines recorded under other keys.  Kernels still exploring at the end of
+//! the run are not written.  Called from the Driver on rank 0 at the end of execution.
+
+void DumpCache() {
+  if (cache_fname.empty()) {return;}
+
+  // keep existing lines for other devices/problem shapes
+  std::vector<std::string> kept;
+  {
+    std::ifstream cfile(cache_fname);
+    std::string line;
+    while (cfile.is_open() && std::getline(cfile, line)) {
+      if (line.empty() || line[0] == '#') {continue;}
+      std::stringstream ss(line);
+      std::string key_read;
+      ss >> key_read;
+      if (key_read != cache_key) {kept.push_back(line);}
+    }
+  }
+
+  std::ofstream cfile(cache_fname, std::ios::trunc);
+  if (!cfile.is_open()) {
+    std::cout << "### WARNING in " << __FILE__ << " at line " << __LINE__ << std::endl
+              << "Could not open autotune cache file '" << cache_fname
+              << "' for writing" << std::endl;
+    return;
+  }
+  cfile << "# AthenaK autotune cache: key kernel team_size vector_len" << std::endl;
+  for (auto &line : kept) {cfile << line << std::endl;}
+  for (auto &it : tune_state) {
+    if (it.second.best < 0) {continue;}
+    const TeamConfig &c = configs[it.second.best];
+    cfile << cache_key << " " << SanitizedName(it.first) << " "
+          << c.team_size << " " << c.vector_len << std::endl;
+  }
+  return;
+}
+
+} // namespace autotune
@@ -0,0 +1,130 @@
+#ifndef UTILS_AUTOTUNE_HPP_
+#define UTILS_AUTOTUNE_HPP_
+//========================================================================================
+// AthenaXXX astrophysical plasma code
+// Copyright(C) 2020 James M. Stone <jmstone@ias.edu> and the Athena code team
+// Licensed under the 3-clause BSD License (the "LICENSE")
+//========================================================================================
+//! \file autotune.hpp
+//! \brief runtime autotuning of team sizes and vector lengths for the par_for_outer
+//! wrappers in athena.hpp.  By default those wrappers launch with Kokkos::AUTO, but the
+//! best team size is kernel- and device-dependent and hand-tuning it routinely buys
+//! 1.5-2x on team-based kernels.  When enabled ('<time> autotune = true'), the first
+//! launches of each named kernel cycle through a short list of candidate launch bounds,
+//! timing each; once every candidate has been measured the fastest is pinned and used
+//! (unfenced) for the rest of the run.  Tuned bounds are persisted to a cache file keyed
+//! by execution space and MeshBlock size, so subsequent runs on the same device and
+//! problem shape skip exploration entirely.
+//!
+//! NOTE: this header is included by athena.hpp, so it must not include any other AthenaK
+//! headers itself.
+
+#include <cstdint>
+#include <map>
+#include <string>
+
+#include <Kokkos_Core.hpp>
+
+namespace autotune {
+
+//----------------------------------------------------------------------------------------
+//! \struct TeamConfig
+//! \brief one candidate set of launch bounds for a team-based kernel.  Non-positive
+//! entries mean "let Kokkos choose" (Kokkos::AUTO); entry 0 of the candidate table is
+//! all-AUTO so that disabled or untuned kernels launch exactly as before.
+
+struct TeamConfig {
+  int team_size;   // threads per team, <=0 selects Kokkos::AUTO
+  int vector_len;  // vector lanes per thread, <=0 selects the Kokkos default
+};
+
+// candidate launch bounds explored per kernel.  Team sizes are clamped per-kernel to
+// what the functor and scratch request allow, so oversize candidates degenerate to the
+// maximum rather than failing to launch
+constexpr int nconfig = 6;
+extern const TeamConfig configs[nconfig];
+
+// number of timed launches per candidate (after one discarded warm-up launch)
+constexpr int ntrial = 5;
+
+//----------------------------------------------------------------------------------------
+//! \struct TuneState
+//! \brief exploration state for one named kernel on this rank
+
+struct TuneState {
+  int best=-1;                       // pinned candidate index, <0 while still exploring
+  int cand=0;                        // candidate currently being measured
+  std::int64_t launches=0;           // launches of current candidate (incl. warm-up)
+  double time[nconfig]={};           // accumulated time per candidate
+  std::int64_t trials[nconfig]={};   // timed launches per candidate
+};
+
+extern bool enabled;                           // set by '<time> autotune' input flag
+extern std::map<std::string, TuneState> tune_state;  // per-kernel registry
+
+int Candidate(const std::string &name, bool &measure);
+void Accumulate(const std::string &name, int cand, double dt);
+void LoadCache(const std::string &fname, int nx1, int nx2, int nx3);
+void DumpCache();
+
+//----------------------------------------------------------------------------------------
+//! \class TeamTuner
+//! \brief scoped guard used by the par_for_outer wrappers.  On construction it selects
+//! the candidate launch bounds for this launch of the named kernel; policy() then builds
+//! the corresponding TeamPolicy.  While the kernel is still exploring, construction and
+//! destruction fence the execution space (like profiler::KernelTimer) so each candidate
+//! is timed in isolation; once a candidate is pinned the guard adds only a branch.
+
+template <class TExecSpace>
+class TeamTuner {
+ public:
+  TeamTuner(const std::string &name, TExecSpace exec) :
+      name_(name), exec_(exec), cand_(0), measure_(false) {
+    if (enabled) {
+      cand_ = Candidate(name_, measure_);
+      if (measure_) {
+        exec_.fence();
+        timer_.reset();
+      }
+    }
+  }
+  ~TeamTuner() {
+    if (measure_) {
+      exec_.fence();
+      Accumulate(name_, cand_, timer_.seconds());
+    }
+  }
+
+  // builds the team policy for this launch using the selected candidate, clamping the
+  // requested team size to the maximum the functor and scratch request allow
+  template <typename Functor>
+  Kokkos::TeamPolicy<> policy(const int nleague, size_t scr_size, const int scr_level,
+                              const Functor &f) const {
+    Kokkos::TeamPolicy<> pauto(exec_, nleague, Kokkos::AUTO);
+    pauto = pauto.set_scratch_size(scr_level, Kokkos::PerTeam(scr_size));
+    const TeamConfig &c = configs[cand_];
+    if (c.team_size <= 0) {return pauto;}
+    int ts = c.team_size;
+    const int tmax = pauto.team_size_max(f, Kokkos::ParallelForTag());
+    if (ts > tmax) {ts = tmax;}
+    if (c.vector_len > 0) {
+      int vl = c.vector_len;
+      const int vmax = Kokkos::TeamPolicy<>::vector_length_max();
+      if (vl > vmax) {vl = vmax;}
+      Kokkos::TeamPolicy<> p(exec_, nleague, ts, vl);
+      return p.set_scratch_size(scr_level, Kokkos::PerTeam(scr_size));
+    }
+    Kokkos::TeamPolicy<> p(exec_, nleague, ts);
+    return p.set_scratch_size(scr_level, Kokkos::PerTeam(scr_size));
+  }
+
+ private:
+  const std::string &name_;
+  TExecSpace exec_;
+  int cand_;
+  bool measure_;
+  Kokkos::Timer timer_;
+};
+
+} // namespace autotune
+#endif // UTILS_AUTOTUNE_HPP_
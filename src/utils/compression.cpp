@@ -0,0 +1,125 @@
+//========================================================================================
+// AthenaXXX astrophysical plasma code
+// Copyright(C) 2020 James M. Stone <jmstone@ias.edu> and the Athena code team
+// Licensed under the 3-clause BSD License (the "LICENSE")
+//========================================================================================
+//! \file compression.cpp
+//! \brief implements byte-shuffle and LZ4 block compression for the 'zbin' output.
+//! The encoder is a greedy single-pass implementation of the LZ4 block format
+//! (token/literals/offset/match-length sequences with 4-byte minimum matches), which is
+//! simple enough to maintain here without carrying the LZ4 library as a dependency.
+
+#include <cstring>
+
+#include "compression.hpp"
+
+namespace {
+
+// read 32-bit word at (possibly unaligned) position
+inline std::uint32_t Read32(const std::uint8_t *p) {
+  std::uint32_t v;
+  std::memcpy(&v, p, sizeof(v));
+  return v;
+}
+
+// Knuth multiplicative hash of 4-byte sequence into 16 bits
+inline std::uint32_t Hash32(std::uint32_t x) {
+  return (x * 2654435761u) >> 16;
+}
+
+// append a length in the LZ4 continuation format (chunks of 255)
+inline void PushLength(std::size_t len, std::vector<std::uint8_t> &dst) {
+  while (len >= 255) {
+    dst.push_back(255);
+    len -= 255;
+  }
+  dst.push_back(static_cast<std::uint8_t>(len));
+}
+
+} // namespace
+
+namespace compression {
+
+//----------------------------------------------------------------------------------------
+//! \fn void TruncateMantissa()
+//! \brief zero lowest (23 - nbits) mantissa bits of each float (no-op for nbits >= 23)
+
+void TruncateMantissa(float *data, std::size_t nelem, int nbits) {
+  if (nbits >= 23) {return;}
+  std::uint32_t mask = ~((1u << (23 - nbits)) - 1);
+  for (std::size_t i=0; i<nelem; ++i) {
+    std::uint32_t v;
+    std::memcpy(&v, &data[i], sizeof(v));
+    v &= mask;
+    std::memcpy(&data[i], &v, sizeof(v));
+  }
+}
+
+//----------------------------------------------------------------------------------------
+//! \fn void ByteShuffle()
+//! \brief regroup bytes of nelem elements of size esize into esize planes of nelem
+
+void ByteShuffle(const std::uint8_t *src, std::uint8_t *dst,
+                 std::size_t nelem, std::size_t esize) {
+  for (std::size_t k=0; k<esize; ++k) {
+    for (std::size_t e=0; e<nelem; ++e) {
+      dst[k*nelem + e] = src[e*esize + k];
+    }
+  }
+}
+
+//----------------------------------------------------------------------------------------
+//! \fn std::size_t CompressLZ4()
+//! \brief greedy LZ4 block-format encoder.  Matches are found with a 64K-entry hash
+//! table over 4-byte sequences; per the format spec the last five bytes are always
+//! emitted as literals and no match starts within twelve bytes of the end
+
+std::size_t CompressLZ4(const std::uint8_t *src, std::size_t nsrc,
+                        std::vector<std::uint8_t> &dst) {
+  const std::size_t minmatch = 4;   // minimum match length in LZ4 block format
+  const std::size_t lastlits = 5;   // last bytes that must be emitted as literals
+  const std::size_t mflimit = 12;   // no match may start within this distance of end
+  std::size_t start = dst.size();
+
+  std::vector<std::int64_t> htab((1 << 16), -1);
+  std::size_t ip = 0, anchor = 0;
+  while ((nsrc >= mflimit) && (ip <= (nsrc - mflimit))) {
+    std::uint32_t h = Hash32(Read32(&src[ip]));
+    std::int64_t cand = htab[h];
+    htab[h] = static_cast<std::int64_t>(ip);
+    if ((cand >= 0) && ((ip - cand) <= 65535) &&
+        (Read32(&src[cand]) == Read32(&src[ip]))) {
+      // extend match forward, stopping so the trailing bytes remain literals
+      std::size_t mlen = minmatch;
+      while (((ip + mlen) < (nsrc - lastlits)) && (src[cand + mlen] == src[ip + mlen])) {
+        mlen++;
+      }
+      // token byte holds literal count (high nibble) and match length - 4 (low nibble)
+      std::size_t litlen = ip - anchor;
+      std::uint8_t token = static_cast<std::uint8_t>(
+          (((litlen < 15)? litlen : 15) << 4) |
+          (((mlen - minmatch) < 15)? (mlen - minmatch) : 15));
+      dst.push_back(token);
+      if (litlen >= 15) {PushLength(litlen - 15, dst);}
+      dst.insert(dst.end(), &src[anchor], &src[ip]);
+      // 2-byte little-endian match offset, then any extra match length bytes
+      std::size_t moff = ip - cand;
+      dst.push_back(static_cast<std::uint8_t>(moff & 0xff));
+      dst.push_back(static_cast<std::uint8_t>((moff >> 8) & 0xff));
+      if ((mlen - minmatch) >= 15) {PushLength(mlen - minmatch - 15, dst);}
+      ip += mlen;
+      anchor = ip;
+    } else {
+      ip++;
+    }
+  }
+
+  // final sequence contains only literals
+  std::size_t litlen = nsrc - anchor;
+  dst.push_back(static_cast<std::uint8_t>(((litlen < 15)? litlen : 15) << 4));
+  if (litlen >= 15) {PushLength(litlen - 15, dst);}
+  dst.insert(dst.end(), &src[anchor], &src[nsrc]);
+  return (dst.size() - start);
+}
+
+} // namespace compression
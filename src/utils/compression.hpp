@@ -0,0 +1,37 @@
+#ifndef UTILS_COMPRESSION_HPP_
+#define UTILS_COMPRESSION_HPP_
+//========================================================================================
+// AthenaXXX astrophysical plasma code
+// Copyright(C) 2020 James M. Stone <jmstone@ias.edu> and the Athena code team
+// Licensed under the 3-clause BSD License (the "LICENSE")
+//========================================================================================
+//! \file compression.hpp
+//! \brief host-side compression helpers used by the compressed binary ('zbin') output.
+//! Chunks are byte-shuffled and then compressed into the LZ4 block format, so files can
+//! be decompressed both by the reader in vis/python/bin_convert.py and by standard LZ4
+//! tools.  Functions here run on the host (possibly on the background writer thread),
+//! so this header deliberately includes no Kokkos or AthenaK headers.
+
+#include <cstddef>
+#include <cstdint>
+#include <vector>
+
+namespace compression {
+
+// zeroes the lowest (23 - nbits) mantissa bits of each float, improving compression at
+// the cost of fixed relative precision.  nbits=23 (all mantissa bits kept) is lossless
+void TruncateMantissa(float *data, std::size_t nelem, int nbits);
+
+// byte-shuffle: regroups the bytes of an array of nelem elements of size esize so that
+// all first bytes come first, then all second bytes, etc.  The high-order bytes of
+// neighbouring floats are strongly correlated, which makes runs the compressor can use
+void ByteShuffle(const std::uint8_t *src, std::uint8_t *dst,
+                 std::size_t nelem, std::size_t esize);
+
+// compresses nsrc bytes into the LZ4 block format, appending to dst.  Returns the
+// number of compressed bytes appended
+std::size_t CompressLZ4(const std::uint8_t *src, std::size_t nsrc,
+                        std::vector<std::uint8_t> &dst);
+
+} // namespace compression
+#endif // UTILS_COMPRESSION_HPP_
@@ -10,6 +10,12 @@
 
 // Reminder: this code has been generated with py/write_FD.py,
 // please do modifications there.
+//
+// NOTE: the stencil sums below deliberately accumulate in double even when the code is
+// built single-precision ('Real' = float).  The evolved z4c fields can then be stored
+// and streamed as float, halving memory bandwidth in CalcRHS, while the
+// cancellation-prone derivative accumulation retains full precision.  In double builds
+// the promotion is a no-op.
 // 1st derivative scalar
 template <int NGHOST, typename TYPE>
 KOKKOS_INLINE_FUNCTION
@@ -20,7 +26,7 @@ Real Dx(int const dir,
   int const shiftk = dir==2;
   int const shiftj = dir==1;
   int const shifti = dir==0;
-  Real out;
+  double out;
   if constexpr ( NGHOST == 2 ) {
     out = + (  -1./2.   * quant(m,k+(-1)*shiftk,
                                   j+(-1)*shiftj,
@@ -76,7 +82,7 @@ Real Dx(int const dir,
   int const shiftk = dir==2;
   int const shiftj = dir==1;
   int const shifti = dir==0;
-  Real out;
+  double out;
   if constexpr ( NGHOST == 2 ) {
     out = + (  -1./2.   * quant(m,a,k+(-1)*shiftk,
                                     j+(-1)*shiftj,
@@ -132,7 +138,7 @@ Real Dx(int const dir,
   int const shiftk = dir==2;
   int const shiftj = dir==1;
   int const shifti = dir==0;
-  Real out;
+  double out;
   if constexpr ( NGHOST == 2 ) {
     out = + (  -1./2.   * quant(m,a,b,k+(-1)*shiftk,
                                       j+(-1)*shiftj,
@@ -188,7 +194,7 @@ Real Dxx(int const dir,
   int const shiftk = dir==2;
   int const shiftj = dir==1;
   int const shifti = dir==0;
-  Real out;
+  double out;
   if constexpr ( NGHOST == 2 ) {
     out = + (   +1.     * quant(m,k+(-1)*shiftk,
                                   j+(-1)*shiftj,
@@ -253,7 +259,7 @@ Real Dxx(int const dir,
   int const shiftk = dir==2;
   int const shiftj = dir==1;
   int const shifti = dir==0;
-  Real out;
+  double out;
   if constexpr ( NGHOST == 2 ) {
     out = + (   +1.     * quant(m,a,k+(-1)*shiftk,
                                     j+(-1)*shiftj,
@@ -318,7 +324,7 @@ Real Dxx(int const dir,
   int const shiftk = dir==2;
   int const shiftj = dir==1;
   int const shifti = dir==0;
-  Real out;
+  double out;
   if constexpr ( NGHOST == 2 ) {
     out = + (   +1.     * quant(m,a,b,k+(-1)*shiftk,
                                       j+(-1)*shiftj,
@@ -386,7 +392,7 @@ Real Dxy(int const dirx, int const diry,
   int const shiftyk = diry==2;
   int const shiftyj = diry==1;
   int const shiftyi = diry==0;
-  Real out;
+  double out;
   if constexpr ( NGHOST == 2 ) {
     out = + (
             + (
@@ -661,7 +667,7 @@ Real Dxy(int const dirx, int const diry,
   int const shiftyk = diry==2;
   int const shiftyj = diry==1;
   int const shiftyi = diry==0;
-  Real out;
+  double out;
   if constexpr ( NGHOST == 2 ) {
     out = + (
             + (
@@ -936,7 +942,7 @@ Real Dxy(int const dirx, int const diry,
   int const shiftyk = diry==2;
   int const shiftyj = diry==1;
   int const shiftyi = diry==0;
-  Real out;
+  double out;
   if constexpr ( NGHOST == 2 ) {
     out = + (
             + (
@@ -1209,7 +1215,7 @@ Real Lx(int const dir,
   int const shiftk = dir==2;
   int const shiftj = dir==1;
   int const shifti = dir==0;
-  Real dl, dr;
+  double dl, dr;
   if constexpr ( NGHOST == 2 ) {
     dl = +0.5    * quant(m,k+(-2)*shiftk,
                                        j+(-2)*shiftj,
@@ -1320,7 +1326,7 @@ Real Lx(int const dir,
   int const shiftk = dir==2;
   int const shiftj = dir==1;
   int const shifti = dir==0;
-  Real dl, dr;
+  double dl, dr;
   if constexpr ( NGHOST == 2 ) {
     dl = +0.5    * quant(m,b,k+(-2)*shiftk,
                                          j+(-2)*shiftj,
@@ -1431,7 +1437,7 @@ Real Lx(int const dir,
   int const shiftk = dir==2;
   int const shiftj = dir==1;
   int const shifti = dir==0;
-  Real dl, dr;
+  double dl, dr;
   if constexpr ( NGHOST == 2 ) {
     dl = +0.5    * quant(m,b,c,k+(-2)*shiftk,
                                            j+(-2)*shiftj,
@@ -1541,7 +1547,7 @@ Real Diss(int const dir,
   int const shiftk = dir==2;
   int const shiftj = dir==1;
   int const shifti = dir==0;
-  Real out;
+  double out;
   if constexpr ( NGHOST == 2 ) {
     out = + (   +1.     * quant(m,a,k+(-2)*shiftk,
                                     j+(-2)*shiftj,
@@ -1612,4 +1618,111 @@ Real Diss(int const dir,
   return out*idx[dir];
 }
 
+//----------------------------------------------------------------------------------------
+// Variants of the operators above with the direction as a compile-time template
+// parameter.  When the direction is known statically at the call site, forwarding a
+// constant DIR lets the compiler fold the shiftk/shiftj/shifti selection and the idx[]
+// indexing to constants, so the stencil compiles to a fully unrolled chain of FMAs with
+// fixed strides.  The runtime-dir operators remain for loop-indexed directions.
+
+// 1st derivative scalar
+template <int NGHOST, int DIR, typename TYPE>
+KOKKOS_INLINE_FUNCTION
+Real Dx(const Real idx[], TYPE &quant,
+        int const m,
+        int const k, int const j, int const i) {
+  static_assert((DIR >= 0) && (DIR < 3), "DIR must be 0, 1, or 2");
+  return Dx<NGHOST>(DIR, idx, quant, m, k, j, i);
+}
+
+// 1st derivative vector
+template <int NGHOST, int DIR, typename TYPE>
+KOKKOS_INLINE_FUNCTION
+Real Dx(const Real idx[], TYPE &quant,
+        int const m, int const a,
+        int const k, int const j, int const i) {
+  static_assert((DIR >= 0) && (DIR < 3), "DIR must be 0, 1, or 2");
+  return Dx<NGHOST>(DIR, idx, quant, m, a, k, j, i);
+}
+
+// 1st derivative 2D tensor
+template <int NGHOST, int DIR, typename TYPE>
+KOKKOS_INLINE_FUNCTION
+Real Dx(const Real idx[], TYPE &quant,
+        int const m, int const a, int const b,
+        int const k, int const j, int const i) {
+  static_assert((DIR >= 0) && (DIR < 3), "DIR must be 0, 1, or 2");
+  return Dx<NGHOST>(DIR, idx, quant, m, a, b, k, j, i);
+}
+
+// 2nd derivative scalar
+template <int NGHOST, int DIR, typename TYPE>
+KOKKOS_INLINE_FUNCTION
+Real Dxx(const Real idx[], TYPE &quant,
+         int const m,
+         int const k, int const j, int const i) {
+  static_assert((DIR >= 0) && (DIR < 3), "DIR must be 0, 1, or 2");
+  return Dxx<NGHOST>(DIR, idx, quant, m, k, j, i);
+}
+
+// 2nd derivative vector
+template <int NGHOST, int DIR, typename TYPE>
+KOKKOS_INLINE_FUNCTION
+Real Dxx(const Real idx[], TYPE &quant,
+         int const m, int const a,
+         int const k, int const j, int const i) {
+  static_assert((DIR >= 0) && (DIR < 3), "DIR must be 0, 1, or 2");
+  return Dxx<NGHOST>(DIR, idx, quant, m, a, k, j, i);
+}
+
+// 2nd derivative 2D tensor
+template <int NGHOST, int DIR, typename TYPE>
+KOKKOS_INLINE_FUNCTION
+Real Dxx(const Real idx[], TYPE &quant,
+         int const m, int const a, int const b,
+         int const k, int const j, int const i) {
+  static_assert((DIR >= 0) && (DIR < 3), "DIR must be 0, 1, or 2");
+  return Dxx<NGHOST>(DIR, idx, quant, m, a, b, k, j, i);
+}
+
+// 1st advective derivative scalar
+template <int NGHOST, int DIR, typename TYPE1, typename TYPE2>
+KOKKOS_INLINE_FUNCTION
+Real Lx(const Real idx[], const TYPE1 &vx, const TYPE2 &quant,
+        int const m, int const a,
+        int const k, int const j, int const i) {
+  static_assert((DIR >= 0) && (DIR < 3), "DIR must be 0, 1, or 2");
+  return Lx<NGHOST>(DIR, idx, vx, quant, m, a, k, j, i);
+}
+
+// 1st advective derivative vector
+template <int NGHOST, int DIR, typename TYPE1, typename TYPE2>
+KOKKOS_INLINE_FUNCTION
+Real Lx(const Real idx[], const TYPE1 &vx, const TYPE2 &quant,
+        int const m, int const a, int const b,
+        int const k, int const j, int const i) {
+  static_assert((DIR >= 0) && (DIR < 3), "DIR must be 0, 1, or 2");
+  return Lx<NGHOST>(DIR, idx, vx, quant, m, a, b, k, j, i);
+}
+
+// 1st advective derivative 2D tensor
+template <int NGHOST, int DIR, typename TYPE1, typename TYPE2>
+KOKKOS_INLINE_FUNCTION
+Real Lx(const Real idx[], const TYPE1 &vx, const TYPE2 &quant,
+        int const m, int const a, int const b, int const c,
+        int const k, int const j, int const i) {
+  static_assert((DIR >= 0) && (DIR < 3), "DIR must be 0, 1, or 2");
+  return Lx<NGHOST>(DIR, idx, vx, quant, m, a, b, c, k, j, i);
+}
+
+// Kreiss-Oliger dissipation
+template <int NGHOST, int DIR, typename TYPE>
+KOKKOS_INLINE_FUNCTION
+Real Diss(const Real idx[], TYPE &quant,
+          int const m, int const a,
+          int const k, int const j, int const i) {
+  static_assert((DIR >= 0) && (DIR < 3), "DIR must be 0, 1, or 2");
+  return Diss<NGHOST>(DIR, idx, quant, m, a, k, j, i);
+}
+
 #endif // UTILS_FINITE_DIFF_HPP_
@@ -0,0 +1,61 @@
+//========================================================================================
+// AthenaXXX astrophysical plasma code
+// Copyright(C) 2020 James M. Stone <jmstone@ias.edu> and the Athena code team
+// Licensed under the 3-clause BSD License (the "LICENSE")
+//========================================================================================
+//! \file hugepage.cpp
+//! \brief implementation of 2MB-aligned host allocations.  Alignment and padding to the
+//! huge-page size makes the range eligible for transparent huge pages, which the
+//! madvise() call requests explicitly so it does not depend on the system-wide THP
+//! policy being set to "always".
+
+#if defined(__linux__)
+#include <sys/mman.h>
+#endif
+
+#include <cstddef>
+#include <cstdlib>
+#include <iostream>
+
+#include "hugepage.hpp"
+
+namespace hugepage {
+
+//----------------------------------------------------------------------------------------
+//! \fn char *Alloc
+//! \brief allocates nbytes of host memory on a 2MB boundary and requests huge pages
+
+char *Alloc(std::size_t nbytes) {
+#if defined(__linux__)
+  const std::size_t align = 2*1024*1024;  // huge page size on x86-64 and aarch64
+  std::size_t size = ((nbytes + align - 1)/align)*align;
+  void *ptr = std::aligned_alloc(align, size);
+  if (ptr == nullptr) {
+    std::cout << "### FATAL ERROR in " << __FILE__ << " at line " << __LINE__
+       << std::endl << "host allocation of " << size << " bytes failed" << std::endl;
+    std::exit(EXIT_FAILURE);
+  }
+#if defined(MADV_HUGEPAGE)
+  // advisory only: the kernel promotes the range when transparent huge pages are
+  // available, and silently ignores the request otherwise
+  (void) madvise(ptr, size, MADV_HUGEPAGE);
+#endif
+  return static_cast<char *>(ptr);
+#else
+  return new char[nbytes];
+#endif
+}
+
+//----------------------------------------------------------------------------------------
+//! \fn void Free
+//! \brief releases memory obtained from Alloc()
+
+void Free(char *ptr) {
+#if defined(__linux__)
+  std::free(ptr);
+#else
+  delete [] ptr;
+#endif
+}
+
+} // namespace hugepage
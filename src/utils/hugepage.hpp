@@ -0,0 +1,23 @@
+#ifndef UTILS_HUGEPAGE_HPP_
+#define UTILS_HUGEPAGE_HPP_
+//========================================================================================
+// AthenaXXX astrophysical plasma code
+// Copyright(C) 2020 James M. Stone <jmstone@ias.edu> and the Athena code team
+// Licensed under the 3-clause BSD License (the "LICENSE")
+//========================================================================================
+//! \file hugepage.hpp
+//! \brief 2MB-aligned, huge-page-backed host allocations for large I/O staging buffers
+
+#include <cstddef>
+
+namespace hugepage {
+// Allocates nbytes of host memory aligned to (and padded to a multiple of) the 2MB
+// huge-page boundary, and advises the kernel to back the range with transparent huge
+// pages.  Used for the large I/O staging buffers in src/outputs/, where the page-fault
+// and TLB overhead of 4KB pages is measurable when packing multi-GB dumps.  Memory must
+// be released with Free().  On non-Linux systems this reduces to plain new[]/delete[].
+char *Alloc(std::size_t nbytes);
+void Free(char *ptr);
+}  // namespace hugepage
+
+#endif  // UTILS_HUGEPAGE_HPP_
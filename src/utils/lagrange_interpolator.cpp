@@ -24,7 +24,8 @@ LagrangeInterpolator::LagrangeInterpolator(
   Real rcoords[3]):
               pmy_pack(pmy_pack),
               rcoord("rccord", 1), interp_indcs("interp_indcs", 1),
-              interp_wghts("interp_wghts", 1, 1), point_exist(false) {
+              interp_wghts("interp_wghts", 1, 1), wghts_d("wghts_d", 1, 1),
+              point_exist(false) {
   auto &indcs = pmy_pack->pmesh->mb_indcs;
   // int &is = indcs.is; int &js = indcs.js; int &ks = indcs.ks;
   int &ng = indcs.ng;
@@ -78,6 +79,50 @@ Real LagrangeInterpolator::Interpolate(DvceArray5D<Real> &val, int nvars) {
   return ivals;
 }
 
+// asynchronously interpolate variables [vstart,vstart+nv) of val into the device buffer
+// ivals_d on the given execution space instance.  The stencil sum runs as a device
+// reduction into ivals_d, so nothing blocks the host; the caller fences exec when it
+// needs the result
+void LagrangeInterpolator::InterpolateToDevice(DvceArray5D<Real> &val, int vstart,
+                                               int nv, DvceArray1D<Real> &ivals_d,
+                                               DevExeSpace exec) {
+  if (interp_indcs(0) == -1) { // point not on this rank
+    return;
+  }
+  auto &indcs = pmy_pack->pmesh->mb_indcs;
+  int &ng = indcs.ng;
+  int &is = indcs.is;
+  int &js = indcs.js;
+  int &ks = indcs.ks;
+
+  // stage the interpolation weights on the device; this object outlives the launch, so
+  // the host source stays valid until the asynchronous copy has drained
+  if (wghts_d.extent_int(0) != 2*ng) {
+    Kokkos::realloc(wghts_d, 2*ng, 3);
+  }
+  Kokkos::deep_copy(exec, wghts_d, interp_wghts);
+
+  const int ii0 = interp_indcs(0);
+  const int ii1 = interp_indcs(1);
+  const int ii2 = interp_indcs(2);
+  const int ii3 = interp_indcs(3);
+  const int ng2 = 2*ng;
+  auto &weights = wghts_d;
+  for (int n = 0; n < nv; ++n) {
+    const int v = vstart + n;
+    Kokkos::parallel_reduce("lag_interp_async",
+      Kokkos::RangePolicy<>(exec, 0, ng2*ng2*ng2),
+      KOKKOS_LAMBDA(const int idx, Real &sum) {
+        int i = idx/(ng2*ng2);
+        int j = (idx - i*ng2*ng2)/ng2;
+        int k = idx - i*ng2*ng2 - j*ng2;
+        Real iwght = weights(i,0) * weights(j,1) * weights(k,2);
+        sum += iwght * val(ii0, v, ii3 - (ng - k - ks) + 1, ii2 - (ng - j - js) + 1,
+                           ii1 - (ng - i - is) + 1);
+      }, Kokkos::subview(ivals_d, n));
+  }
+}
+
 Real LagrangeInterpolator::ResetPointAndInterpolate(
   DvceArray5D<Real> &val,
   int nvars,
@@ -134,6 +179,151 @@ void LagrangeInterpolator::SetInterpolationIndices() {
   }
 }
 
+//----------------------------------------------------------------------------------------
+//! \fn void lagrange_interp::BuildStencil()
+//! \brief builds stencil MeshBlock/zone indices and interpolation weights for npts
+//! target points in a single device kernel (see declaration in header for details)
+
+void lagrange_interp::BuildStencil(MeshBlockPack *pmy_pack,
+                                   const DualArray2D<Real> &rcoords, int npts,
+                                   DualArray2D<int> &iindcs, DualArray3D<Real> &iwghts) {
+  auto &indcs = pmy_pack->pmesh->mb_indcs;
+  int &ng = indcs.ng;
+  int nx1 = indcs.nx1, nx2 = indcs.nx2, nx3 = indcs.nx3;
+  int nmb = pmy_pack->nmb_thispack;
+  auto &size = pmy_pack->pmb->mb_size;
+  int ng2 = 2*ng;
+
+  auto &rc = rcoords;
+  auto &ii = iindcs;
+  auto &iw = iwghts;
+  par_for("lag_stencil", DevExeSpace(), 0, (npts-1),
+  KOKKOS_LAMBDA(int n) {
+    Real x0 = rc.d_view(n,0);
+    Real y0 = rc.d_view(n,1);
+    Real z0 = rc.d_view(n,2);
+
+    // find MeshBlock containing this point and nearest zone indices therein; indices
+    // default to -1 if the point is outside this MeshBlockPack
+    int m0 = -1, i1 = -1, i2 = -1, i3 = -1;
+    for (int m=0; m<nmb; ++m) {
+      Real x1min = size.d_view(m).x1min;
+      Real x1max = size.d_view(m).x1max;
+      Real x2min = size.d_view(m).x2min;
+      Real x2max = size.d_view(m).x2max;
+      Real x3min = size.d_view(m).x3min;
+      Real x3max = size.d_view(m).x3max;
+      if ((x0 >= x1min && x0 <= x1max) &&
+          (y0 >= x2min && y0 <= x2max) &&
+          (z0 >= x3min && z0 <= x3max)) {
+        m0 = m;
+        i1 = static_cast<int>(floor((x0 - (x1min + size.d_view(m).dx1/2.0))/
+                                    size.d_view(m).dx1));
+        i2 = static_cast<int>(floor((y0 - (x2min + size.d_view(m).dx2/2.0))/
+                                    size.d_view(m).dx2));
+        i3 = static_cast<int>(floor((z0 - (x3min + size.d_view(m).dx3/2.0))/
+                                    size.d_view(m).dx3));
+      }
+    }
+    ii.d_view(n,0) = m0;
+    ii.d_view(n,1) = i1;
+    ii.d_view(n,2) = i2;
+    ii.d_view(n,3) = i3;
+
+    if (m0 == -1) {  // point not on this rank
+      for (int i=0; i<ng2; ++i) {
+        iw.d_view(n,i,0) = 0.0;
+        iw.d_view(n,i,1) = 0.0;
+        iw.d_view(n,i,2) = 0.0;
+      }
+    } else {
+      // extract MeshBlock bounds
+      Real x1min = size.d_view(m0).x1min;
+      Real x1max = size.d_view(m0).x1max;
+      Real x2min = size.d_view(m0).x2min;
+      Real x2max = size.d_view(m0).x2max;
+      Real x3min = size.d_view(m0).x3min;
+      Real x3max = size.d_view(m0).x3max;
+      // set interpolation weights
+      for (int i=0; i<ng2; ++i) {
+        iw.d_view(n,i,0) = 1.0;
+        iw.d_view(n,i,1) = 1.0;
+        iw.d_view(n,i,2) = 1.0;
+        for (int j=0; j<ng2; ++j) {
+          if (j != i) {
+            Real x1vpi1 = CellCenterX(i1-ng+i+1, nx1, x1min, x1max);
+            Real x1vpj1 = CellCenterX(i1-ng+j+1, nx1, x1min, x1max);
+            iw.d_view(n,i,0) *= (x0-x1vpj1)/(x1vpi1-x1vpj1);
+            Real x2vpi1 = CellCenterX(i2-ng+i+1, nx2, x2min, x2max);
+            Real x2vpj1 = CellCenterX(i2-ng+j+1, nx2, x2min, x2max);
+            iw.d_view(n,i,1) *= (y0-x2vpj1)/(x2vpi1-x2vpj1);
+            Real x3vpi1 = CellCenterX(i3-ng+i+1, nx3, x3min, x3max);
+            Real x3vpj1 = CellCenterX(i3-ng+j+1, nx3, x3min, x3max);
+            iw.d_view(n,i,2) *= (z0-x3vpj1)/(x3vpi1-x3vpj1);
+          }
+        }
+      }
+    }
+  });
+
+  // sync dual arrays so host-side consumers also see the new stencils
+  iindcs.template modify<DevExeSpace>();
+  iindcs.template sync<HostMemSpace>();
+  iwghts.template modify<DevExeSpace>();
+  iwghts.template sync<HostMemSpace>();
+  return;
+}
+
+//----------------------------------------------------------------------------------------
+//! \fn void lagrange_interp::InterpolateBatch()
+//! \brief evaluates variables [0,nvars) of val at all npts points with one team per
+//! (point, variable) pair and thread parallelism over the stencil
+
+void lagrange_interp::InterpolateBatch(MeshBlockPack *pmy_pack, DvceArray5D<Real> &val,
+                                       int nvars, int npts,
+                                       const DualArray2D<int> &iindcs,
+                                       const DualArray3D<Real> &iwghts,
+                                       DualArray2D<Real> &ivals) {
+  auto &indcs = pmy_pack->pmesh->mb_indcs;
+  int &is = indcs.is; int &js = indcs.js; int &ks = indcs.ks;
+  int &ng = indcs.ng;
+  int ng2 = 2*ng;
+
+  auto &ii = iindcs;
+  auto &iw = iwghts;
+  auto &iv = ivals;
+  Kokkos::TeamPolicy<> policy(DevExeSpace(), npts*nvars, Kokkos::AUTO);
+  Kokkos::parallel_for("lag_batch", policy, KOKKOS_LAMBDA(TeamMember_t tmember) {
+    const int n = (tmember.league_rank())/nvars;
+    const int v = (tmember.league_rank() - n*nvars);
+
+    const int ii0 = ii.d_view(n,0);
+    const int ii1 = ii.d_view(n,1);
+    const int ii2 = ii.d_view(n,2);
+    const int ii3 = ii.d_view(n,3);
+
+    Real int_value = 0.0;
+    if (ii0 != -1) {
+      Kokkos::parallel_reduce(Kokkos::TeamThreadRange(tmember, ng2*ng2*ng2),
+      [&](const int idx, Real &sum) {
+        int i = idx/(ng2*ng2);
+        int j = (idx - i*ng2*ng2)/ng2;
+        int k = idx - i*ng2*ng2 - j*ng2;
+        Real iwght = iw.d_view(n,i,0)*iw.d_view(n,j,1)*iw.d_view(n,k,2);
+        sum += iwght*val(ii0,v,ii3-(ng-k-ks)+1,ii2-(ng-j-js)+1,ii1-(ng-i-is)+1);
+      }, int_value);
+    }
+    Kokkos::single(Kokkos::PerTeam(tmember), [&]() {
+      iv.d_view(n,v) = int_value;
+    });
+  });
+
+  // sync dual array
+  ivals.template modify<DevExeSpace>();
+  ivals.template sync<HostMemSpace>();
+  return;
+}
+
 void LagrangeInterpolator::CalculateWeight() {
   auto &indcs = pmy_pack->pmesh->mb_indcs;
   auto &size  = pmy_pack->pmb->mb_size;
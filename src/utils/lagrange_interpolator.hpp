@@ -24,6 +24,12 @@ class LagrangeInterpolator {
   void SetInterpolationIndices();
   void CalculateWeight();
   Real Interpolate(DvceArray5D<Real> &val, int nvars);
+  // asynchronously interpolate variables [vstart,vstart+nv) of val into the device
+  // buffer ivals_d (entry n holds variable vstart+n) on the given execution space
+  // instance.  Nothing is fenced: the caller owns completion, and this object must stay
+  // alive until the launch has drained
+  void InterpolateToDevice(DvceArray5D<Real> &val, int vstart, int nv,
+                           DvceArray1D<Real> &ivals_d, DevExeSpace exec);
   Real InterpolateTensor(
     AthenaTensor<Real, TensorSymm::NONE, 3, 1> &val, int nvars);
   Real ResetPointAndInterpolate(
@@ -39,6 +45,33 @@ class LagrangeInterpolator {
   HostArray1D<int>
     interp_indcs; // indices of MeshBlock and zones therein for interp
   HostArray2D<Real> interp_wghts; // weights for interpolation
+  DvceArray2D<Real> wghts_d;      // device copy of weights for InterpolateToDevice
 };
 
+//----------------------------------------------------------------------------------------
+// Batched device interface.  The LagrangeInterpolator class above interpolates one
+// point per call with host-side stencil setup, which is far too slow for the ~1e5
+// point target sets of extraction spheres; these functions build stencils for all
+// points in one kernel and evaluate them with team parallelism over points x stencil.
+// Used by SphericalGrid::InterpolateToSphere; both views are left synced on host and
+// device on return
+
+namespace lagrange_interp {
+
+// builds Lagrange stencil MeshBlock/zone indices iindcs(n,0:3) and per-direction
+// weights iwghts(n,0:2*ng-1,0:2) for npts target points rcoords(n,0:2) in one device
+// kernel.  Indices are set to -1 for points not on this rank.  A point on a shared
+// MeshBlock face is assigned to the matching MeshBlock of largest index, consistent
+// with the host-side setup this replaces
+void BuildStencil(MeshBlockPack *pmy_pack, const DualArray2D<Real> &rcoords, int npts,
+                  DualArray2D<int> &iindcs, DualArray3D<Real> &iwghts);
+
+// evaluates variables [0,nvars) of val at all npts points using the stencils built by
+// BuildStencil(), storing results in ivals(n,v) (zero for points not on this rank)
+void InterpolateBatch(MeshBlockPack *pmy_pack, DvceArray5D<Real> &val, int nvars,
+                      int npts, const DualArray2D<int> &iindcs,
+                      const DualArray3D<Real> &iwghts, DualArray2D<Real> &ivals);
+
+} // namespace lagrange_interp
+
 #endif // UTILS_LAGRANGE_INTERPOLATOR_HPP_
@@ -0,0 +1,332 @@
+//========================================================================================
+// AthenaXXX astrophysical plasma code
+// Copyright(C) 2020 James M. Stone <jmstone@ias.edu> and the Athena code team
+// Licensed under the 3-clause BSD License (the "LICENSE")
+//========================================================================================
+//! \file memlog.cpp
+//! \brief implementation of the View allocation registry (attribution of allocations to
+//! modules through Kokkos profiling callbacks, cross-rank dumps) and of the pre-run
+//! per-rank footprint estimator.
+
+#include <algorithm>
+#include <cstdint>
+#include <fstream>
+#include <iomanip>
+#include <iostream>
+#include <map>
+#include <mutex>
+#include <sstream>
+#include <string>
+#include <utility>
+#include <vector>
+
+#include "athena.hpp"
+#include "globals.hpp"
+#include "parameter_input.hpp"
+#include "utils/memlog.hpp"
+
+#if MPI_PARALLEL_ENABLED
+#include <mpi.h>
+#endif
+
+namespace memlog {
+
+bool enabled = false;
+std::map<std::string, ModuleStats> module_stats;
+
+namespace {
+
+// guarded by mtx: callbacks can fire from the background writer thread of 'async'
+// outputs as well as from the main thread
+std::mutex mtx;
+std::string current_module = "mesh";
+// live allocations: pointer -> (owning module, on device), needed because a View is
+// often freed under a different ModuleGuard than the one it was allocated under
+// (e.g. hydro arrays reallocated during AMR regridding)
+std::map<const void *, std::pair<std::string, bool>> live_allocs;
+std::int64_t dev_total = 0;      // current device bytes summed over modules
+std::int64_t dev_total_hwm = 0;  // high-water mark of dev_total
+
+//----------------------------------------------------------------------------------------
+//! \fn bool IsDeviceSpace
+//! \brief returns true if the named Kokkos memory space resides in device memory.
+//! Pinned host buffers ("CudaHostPinned" etc.) count as host memory.
+
+bool IsDeviceSpace(const char *name) {
+#if defined(KOKKOS_ENABLE_CUDA) || defined(KOKKOS_ENABLE_HIP) || \
+    defined(KOKKOS_ENABLE_SYCL)
+  std::string sname(name);
+  return ((sname != "Host") && (sname.find("HostPinned") == std::string::npos));
+#else
+  return false;
+#endif
+}
+
+//----------------------------------------------------------------------------------------
+//! \fn void AllocateCB
+//! \brief Kokkos profiling callback invoked on every View allocation; folds the bytes
+//! into the registry entry of the module currently in scope
+
+void AllocateCB(const Kokkos_Profiling_SpaceHandle space, const char *label,
+                const void *const ptr, const uint64_t size) {
+  std::lock_guard<std::mutex> lock(mtx);
+  bool dev = IsDeviceSpace(space.name);
+  live_allocs[ptr] = std::make_pair(current_module, dev);
+  ModuleStats &s = module_stats[current_module];
+  s.nalloc++;
+  if (dev) {
+    s.dev_bytes += static_cast<std::int64_t>(size);
+    if (s.dev_bytes > s.dev_hwm) {s.dev_hwm = s.dev_bytes;}
+    dev_total += static_cast<std::int64_t>(size);
+    if (dev_total > dev_total_hwm) {dev_total_hwm = dev_total;}
+  } else {
+    s.host_bytes += static_cast<std::int64_t>(size);
+  }
+  return;
+}
+
+//----------------------------------------------------------------------------------------
+//! \fn void DeallocateCB
+//! \brief Kokkos profiling callback invoked on every View deallocation; returns the
+//! bytes to the module that allocated them
+
+void DeallocateCB(const Kokkos_Profiling_SpaceHandle space, const char *label,
+                  const void *const ptr, const uint64_t size) {
+  std::lock_guard<std::mutex> lock(mtx);
+  auto it = live_allocs.find(ptr);
+  if (it == live_allocs.end()) {return;}  // allocated before Enroll()
+  ModuleStats &s = module_stats[it->second.first];
+  s.nalloc--;
+  if (it->second.second) {
+    s.dev_bytes -= static_cast<std::int64_t>(size);
+    dev_total -= static_cast<std::int64_t>(size);
+  } else {
+    s.host_bytes -= static_cast<std::int64_t>(size);
+  }
+  live_allocs.erase(it);
+  return;
+}
+
+} // namespace
+
+//----------------------------------------------------------------------------------------
+//! \fn void Enroll
+//! \brief installs the allocation callbacks.  Must be called right after
+//! Kokkos::initialize, before the Mesh is built, so that every View is seen.  Note this
+//! claims the allocate/deallocate hooks, so an external tool loaded through
+//! KOKKOS_TOOLS_LIBS will not receive allocation events (all other events still work).
+
+void Enroll() {
+  Kokkos::Tools::Experimental::set_allocate_data_callback(AllocateCB);
+  Kokkos::Tools::Experimental::set_deallocate_data_callback(DeallocateCB);
+  return;
+}
+
+//----------------------------------------------------------------------------------------
+//! \fn void SetModule
+//! \brief sets the module that subsequent allocations are attributed to
+
+void SetModule(const std::string &name) {
+  std::lock_guard<std::mutex> lock(mtx);
+  current_module = name;
+  return;
+}
+
+//----------------------------------------------------------------------------------------
+//! \fn std::string GetModule
+//! \brief returns the module that allocations are currently attributed to
+
+std::string GetModule() {
+  std::lock_guard<std::mutex> lock(mtx);
+  return current_module;
+}
+
+//----------------------------------------------------------------------------------------
+//! \fn void Dump
+//! \brief gathers the per-module registries from all ranks and writes them to
+//! 'memory.csv'.  The file is overwritten on each call with the current state, so the
+//! last dump before an OOM crash shows which module was growing.  Must be called by all
+//! ranks.  For each module the min/mean/max over ranks of the current device bytes and
+//! the max over ranks of the device high-water mark are reported; the 'total' row sums
+//! the modules on each rank before reducing, so total_hwm_max is the per-GPU capacity a
+//! rerun of this job needs.
+
+void Dump(int ncycle) {
+  if (!(enabled)) {return;}
+
+  // serialize local registry (plus per-rank totals) into a character stream
+  std::stringstream msg;
+  {
+    std::lock_guard<std::mutex> lock(mtx);
+    for (auto &it : module_stats) {
+      std::string name = it.first;
+      std::replace(name.begin(), name.end(), ' ', '_');
+      msg << name << " " << it.second.nalloc << " " << it.second.host_bytes << " "
+          << it.second.dev_bytes << " " << it.second.dev_hwm << "\n";
+    }
+    msg << "total 0 0 " << dev_total << " " << dev_total_hwm << "\n";
+  }
+  std::string smsg = msg.str();
+
+#if MPI_PARALLEL_ENABLED
+  // gather serialized registries from all ranks onto rank 0
+  int len = static_cast<int>(smsg.size());
+  std::vector<int> lens(global_variable::nranks, 0);
+  MPI_Gather(&len, 1, MPI_INT, lens.data(), 1, MPI_INT, 0, MPI_COMM_WORLD);
+  std::vector<int> disps(global_variable::nranks, 0);
+  int tot = 0;
+  for (int r=0; r<(global_variable::nranks); ++r) {
+    disps[r] = tot;
+    tot += lens[r];
+  }
+  std::vector<char> gathered(std::max(tot,1));
+  MPI_Gatherv(smsg.data(), len, MPI_CHAR, gathered.data(), lens.data(), disps.data(),
+              MPI_CHAR, 0, MPI_COMM_WORLD);
+  if (global_variable::my_rank != 0) {return;}
+  smsg.assign(gathered.data(), tot);
+#endif
+  if (global_variable::my_rank != 0) {return;}
+
+  // merge per-rank entries by module name
+  struct Merged {
+    int nranks=0;
+    std::int64_t nalloc=0, host_sum=0;
+    std::int64_t dev_min=0, dev_sum=0, dev_max=0, hwm_max=0;
+  };
+  std::map<std::string, Merged> merged;
+  std::stringstream all(smsg);
+  std::string name;
+  std::int64_t nalloc, host, dev, hwm;
+  while (all >> name >> nalloc >> host >> dev >> hwm) {
+    Merged &m = merged[name];
+    m.nranks++;
+    m.nalloc += nalloc;
+    m.host_sum += host;
+    m.dev_sum += dev;
+    if ((m.nranks == 1) || (dev < m.dev_min)) {m.dev_min = dev;}
+    if (dev > m.dev_max) {m.dev_max = dev;}
+    if (hwm > m.hwm_max) {m.hwm_max = hwm;}
+  }
+
+  std::ofstream mfile("memory.csv", std::ios::trunc);
+  if (!(mfile.is_open())) {
+    std::cout << "### FATAL ERROR in " << __FILE__ << " at line " << __LINE__
+       << std::endl << "memory file could not be opened" << std::endl;
+    std::exit(EXIT_FAILURE);
+  }
+  mfile << "# cycle=" << ncycle << std::endl;
+  mfile << "# nranks=" << global_variable::nranks << std::endl;
+  mfile << "module,nranks,nalloc,host_mean,dev_min,dev_mean,dev_max,hwm_max"
+        << std::endl;
+  for (auto &it : merged) {
+    Merged &m = it.second;
+    mfile << it.first << "," << m.nranks << "," << m.nalloc << ","
+          << m.host_sum/m.nranks << "," << m.dev_min << "," << m.dev_sum/m.nranks << ","
+          << m.dev_max << "," << m.hwm_max << std::endl;
+  }
+  return;
+}
+
+//----------------------------------------------------------------------------------------
+//! \fn void EstimateFootprint
+//! \brief predicts the per-rank device memory footprint from the input file alone,
+//! before anything is allocated, so jobs can be sized to GPUs without trial runs.
+//! Counts the dominant cell-sized arrays of each requested physics module (registers,
+//! primitives, fluxes, face fields, intensities, ...) on the root grid; boundary
+//! buffers, scratch, and smaller arrays are folded into a flat 20% overhead.  With AMR
+//! the estimate is a lower bound since refinement adds MeshBlocks.
+
+void EstimateFootprint(ParameterInput *pin) {
+  if (!(pin->DoesBlockExist("mesh"))) {return;}
+
+  // root grid and MeshBlock dimensions (same defaults as the Mesh constructor)
+  int nx1 = pin->GetInteger("mesh", "nx1");
+  int nx2 = pin->GetInteger("mesh", "nx2");
+  int nx3 = pin->GetInteger("mesh", "nx3");
+  int ng  = pin->GetOrAddInteger("mesh", "nghost", 2);
+  int mbnx1 = nx1, mbnx2 = nx2, mbnx3 = nx3;
+  if (pin->DoesBlockExist("meshblock")) {
+    mbnx1 = pin->GetOrAddInteger("meshblock", "nx1", nx1);
+    mbnx2 = pin->GetOrAddInteger("meshblock", "nx2", nx2);
+    mbnx3 = pin->GetOrAddInteger("meshblock", "nx3", nx3);
+  }
+  bool multilevel = false;
+  if (pin->DoesBlockExist("mesh_refinement")) {
+    std::string ref = pin->GetOrAddString("mesh_refinement", "refinement", "none");
+    multilevel = (ref != "none");
+  }
+  bool multi_d = (nx2 > 1);
+  bool three_d = (nx3 > 1);
+  int ndim = 1 + (multi_d? 1 : 0) + (three_d? 1 : 0);
+
+  // MeshBlocks on root grid, divided over ranks (rounded up)
+  std::int64_t nmb = (static_cast<std::int64_t>(nx1/mbnx1))*(nx2/mbnx2)*(nx3/mbnx3);
+  std::int64_t nmb_rank = (nmb + global_variable::nranks - 1)/global_variable::nranks;
+
+  // cells per MeshBlock including ghosts, on the fine and (with SMR/AMR) coarse grids
+  std::int64_t ncells = static_cast<std::int64_t>(mbnx1 + 2*ng)
+                       *(multi_d? (mbnx2 + 2*ng) : 1)*(three_d? (mbnx3 + 2*ng) : 1);
+  std::int64_t ccells = (multilevel)?
+                        static_cast<std::int64_t>(mbnx1/2 + 2*ng)
+                       *(multi_d? (mbnx2/2 + 2*ng) : 1)
+                       *(three_d? (mbnx3/2 + 2*ng) : 1) : 0;
+
+  // Real words per MeshBlock for each requested module, counting the dominant arrays
+  std::map<std::string, std::int64_t> words;
+  if (pin->DoesBlockExist("hydro")) {
+    // u0/u1/w0 + fluxes (+ coarse_u0)
+    std::int64_t nv = 5 + pin->GetOrAddInteger("hydro", "nscalars", 0);
+    words["hydro"] = nv*((3 + ndim)*ncells + ccells);
+  }
+  if (pin->DoesBlockExist("mhd")) {
+    // u0/u1/w0/bcc + fluxes, b0/b1 face fields + EMFs (+ coarse_u0/coarse_b0)
+    std::int64_t nv = 5 + pin->GetOrAddInteger("mhd", "nscalars", 0);
+    words["mhd"] = nv*((4 + ndim)*ncells + ccells) + 9*ncells + 3*ccells;
+  }
+  if (pin->DoesBlockExist("radiation")) {
+    // i0/i1 + fluxes per angle (+ coarse_i0), tetrad components at centers and faces;
+    // nangles from the geodesic grid level (see geodesic_grid.cpp)
+    std::int64_t nlev = pin->GetInteger("radiation", "nlevel");
+    std::int64_t nang = (nlev > 0)? (10*nlev*nlev + 2) : 8;
+    words["radiation"] = nang*((2 + ndim)*ncells + ccells) + 44*ncells;
+    if (pin->GetOrAddBoolean("radiation", "implicit_transport", false)) {
+      words["radiation"] += 5*nang*ncells;  // Krylov work vectors
+    }
+  }
+  if (pin->DoesBlockExist("z4c")) {
+    // u0/u1/u_rhs (+ coarse_u0) with 22 evolved fields, constraints (7), plus ADM
+    // variables (17) and stress-energy storage
+    words["z4c"] = 22*(3*ncells + ccells) + 7*ncells + 27*ncells;
+  } else if (pin->DoesBlockExist("adm")) {
+    words["adm"] = 17*ncells;
+  }
+
+  // print per-module and total estimates; boundary buffers, integrator scratch, and
+  // arrays not counted above are folded into a flat 20% overhead
+  const double gb = 1024.0*1024.0*1024.0;
+  const double rsize = static_cast<double>(sizeof(Real));
+  double total = 0.0;
+  std::cout << std::endl << "Estimated device memory footprint (root grid):"
+            << std::endl;
+  std::cout << "  MeshBlocks: " << nmb << " blocks of " << mbnx1 << "x" << mbnx2 << "x"
+            << mbnx3 << " cells, " << nmb_rank << " per rank ("
+            << global_variable::nranks << " ranks)" << std::endl;
+  std::cout << std::setprecision(3);
+  for (auto &it : words) {
+    double bytes = static_cast<double>(it.second*nmb_rank)*rsize;
+    std::cout << "  " << std::left << std::setw(12) << it.first << std::right
+              << bytes/gb << " GB per rank" << std::endl;
+    total += bytes;
+  }
+  std::cout << "  " << std::left << std::setw(12) << "overhead" << std::right
+            << 0.2*total/gb << " GB per rank (buffers/scratch, est. 20%)" << std::endl;
+  std::cout << "  " << std::left << std::setw(12) << "total" << std::right
+            << 1.2*total/gb << " GB per rank" << std::endl;
+  if (multilevel) {
+    std::cout << "  NOTE: refinement enabled; actual footprint grows with the number "
+              << "of refined MeshBlocks" << std::endl;
+  }
+  return;
+}
+
+} // namespace memlog
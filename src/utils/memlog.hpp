@@ -0,0 +1,66 @@
+#ifndef UTILS_MEMLOG_HPP_
+#define UTILS_MEMLOG_HPP_
+//========================================================================================
+// AthenaXXX astrophysical plasma code
+// Copyright(C) 2020 James M. Stone <jmstone@ias.edu> and the Athena code team
+// Licensed under the 3-clause BSD License (the "LICENSE")
+//========================================================================================
+//! \file memlog.hpp
+//! \brief built-in accounting of Kokkos View allocations.  Enroll() (called once from
+//! main() right after Kokkos::initialize) installs Kokkos profiling callbacks that see
+//! every View allocation and deallocation, so bytes are tracked without touching any
+//! allocation site.  Each allocation is attributed to the module named by the innermost
+//! ModuleGuard in scope (guards are placed around the Coordinates/physics constructors
+//! in MeshBlockPack and around AMR regridding); everything else lands in the default
+//! "mesh" bucket.  Device high-water marks are updated on every allocation, which is
+//! strictly sharper than per-cycle sampling.  Accounting is always on (the per-
+//! allocation cost is negligible since Views are allocated rarely); the '<time> memlog'
+//! input flag only controls whether Dump() writes the registry to 'memory.csv'.
+//! EstimateFootprint() is the matching pre-run capacity estimator: invoked on the
+//! '-c' command line (when an input file is also given) it predicts the per-rank
+//! device footprint from the input file alone, before anything is allocated.
+
+#include <cstdint>
+#include <map>
+#include <string>
+
+class ParameterInput;
+
+namespace memlog {
+
+//----------------------------------------------------------------------------------------
+//! \struct ModuleStats
+//! \brief live allocation totals for one module on this rank
+
+struct ModuleStats {
+  std::int64_t nalloc=0;      // number of live allocations
+  std::int64_t host_bytes=0;  // current bytes in host memory spaces
+  std::int64_t dev_bytes=0;   // current bytes in device memory spaces
+  std::int64_t dev_hwm=0;     // high-water mark of device bytes
+};
+
+extern bool enabled;        // set by '<time> memlog' input flag (controls Dump only)
+extern std::map<std::string, ModuleStats> module_stats;  // per-module registry
+
+void Enroll();
+void SetModule(const std::string &name);
+std::string GetModule();
+void Dump(int ncycle);
+void EstimateFootprint(ParameterInput *pin);
+
+//----------------------------------------------------------------------------------------
+//! \class ModuleGuard
+//! \brief scoped guard that attributes View allocations made while it is in scope
+//! (including nested constructors, e.g. the boundary buffers built inside each physics
+//! module) to the named module.  Restores the previous attribution on destruction.
+
+class ModuleGuard {
+ public:
+  explicit ModuleGuard(const std::string &name) : saved_(GetModule()) {SetModule(name);}
+  ~ModuleGuard() {SetModule(saved_);}
+ private:
+  std::string saved_;
+};
+
+} // namespace memlog
+#endif // UTILS_MEMLOG_HPP_
@@ -0,0 +1,79 @@
+//========================================================================================
+// AthenaXXX astrophysical plasma code
+// Copyright(C) 2020 James M. Stone <jmstone@ias.edu> and the Athena code team
+// Licensed under the 3-clause BSD License (the "LICENSE")
+//========================================================================================
+//! \file numa_audit.cpp
+//! \brief reports which NUMA node holds each page of an allocation.  Used at startup
+//! (with '<mesh> numa_audit = true') to verify that the parallel first-touch
+//! initialization in realloc_first_touch() actually distributed pack-level arrays
+//! across sockets on multi-socket CPU builds.
+
+#if defined(__linux__)
+#include <sys/syscall.h>
+#include <unistd.h>
+#endif
+
+#include <cstddef>
+#include <iostream>
+#include <map>
+#include <string>
+#include <vector>
+
+#include "numa_audit.hpp"
+
+namespace numa {
+
+//----------------------------------------------------------------------------------------
+//! \fn void AuditPages()
+//! \brief print per-NUMA-node histogram of the pages backing [ptr, ptr+nbytes)
+
+void AuditPages(const std::string &label, const void *ptr, std::size_t nbytes) {
+#if defined(__linux__)
+  const std::size_t psize = static_cast<std::size_t>(sysconf(_SC_PAGESIZE));
+  std::size_t start = reinterpret_cast<std::size_t>(ptr) & ~(psize - 1);
+  std::size_t end = reinterpret_cast<std::size_t>(ptr) + nbytes;
+  std::size_t npages = (end - start + psize - 1)/psize;
+  if (npages == 0) {return;}
+
+  std::vector<void*> pages(npages);
+  std::vector<int> status(npages);
+  for (std::size_t p=0; p<npages; ++p) {
+    pages[p] = reinterpret_cast<void*>(start + p*psize);
+  }
+
+  // move_pages with a null target-node list queries the node of each page without
+  // moving it.  Invoked through syscall() directly so no libnuma dependency is added
+  long ret = syscall(SYS_move_pages, 0, npages, pages.data(), nullptr,
+                     status.data(), 0);
+  if (ret != 0) {
+    std::cout << "  numa_audit: " << label << ": move_pages query failed" << std::endl;
+    return;
+  }
+
+  // negative status denotes pages that are unmapped (never touched) or not in host
+  // memory (e.g. device allocations on GPU builds)
+  std::map<int, std::size_t> hist;
+  std::size_t nunmapped = 0;
+  for (std::size_t p=0; p<npages; ++p) {
+    if (status[p] >= 0) {
+      hist[status[p]] += 1;
+    } else {
+      nunmapped += 1;
+    }
+  }
+
+  std::cout << "  numa_audit: " << label << ": " << npages << " pages:";
+  for (auto &it : hist) {
+    std::cout << " node" << it.first << "=" << it.second;
+  }
+  if (nunmapped > 0) {std::cout << " unmapped=" << nunmapped;}
+  std::cout << std::endl;
+#else
+  std::cout << "  numa_audit: " << label << ": not supported on this platform"
+            << std::endl;
+#endif
+  return;
+}
+
+}  // namespace numa
@@ -0,0 +1,22 @@
+#ifndef UTILS_NUMA_AUDIT_HPP_
+#define UTILS_NUMA_AUDIT_HPP_
+//========================================================================================
+// AthenaXXX astrophysical plasma code
+// Copyright(C) 2020 James M. Stone <jmstone@ias.edu> and the Athena code team
+// Licensed under the 3-clause BSD License (the "LICENSE")
+//========================================================================================
+//! \file numa_audit.hpp
+//! \brief function to report NUMA page placement of pack-level array allocations
+
+#include <cstddef>
+#include <string>
+
+namespace numa {
+// Prints a per-NUMA-node histogram of the pages backing [ptr, ptr+nbytes), used with
+// '<mesh> numa_audit = true' to verify first-touch placement on multi-socket CPU
+// builds.  Only meaningful on Linux when the pointer refers to host memory; device
+// allocations are reported as unmapped.
+void AuditPages(const std::string &label, const void *ptr, std::size_t nbytes);
+}  // namespace numa
+
+#endif  // UTILS_NUMA_AUDIT_HPP_
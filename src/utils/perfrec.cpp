@@ -0,0 +1,170 @@
+//========================================================================================
+// AthenaXXX astrophysical plasma code
+// Copyright(C) 2020 James M. Stone <jmstone@ias.edu> and the Athena code team
+// Licensed under the 3-clause BSD License (the "LICENSE")
+//========================================================================================
+//! \file perfrec.cpp
+//! \brief implementation of the per-run performance record (see perfrec.hpp).  The
+//! record is a single JSON object written to 'perf_record.json' with a versioned schema
+//! ("athenak-perf-1"), so downstream dashboards can ingest records from many runs
+//! without parsing human-oriented logs.  Fields that need cross-rank information (I/O
+//! and AMR stall totals, MPI wait fraction) are reduced here, so Dump() must be called
+//! by all ranks; the file is written by rank 0 only.
+
+#include <algorithm>
+#include <cstdint>
+#include <fstream>
+#include <iostream>
+#include <string>
+#include <utility>
+#include <vector>
+
+#include "athena.hpp"
+#include "globals.hpp"
+#include "utils/perfrec.hpp"
+#include "utils/profiler.hpp"
+
+#if MPI_PARALLEL_ENABLED
+#include <mpi.h>
+#endif
+
+namespace perfrec {
+
+bool enabled = false;
+std::vector<ThroughputSample> samples;
+
+//----------------------------------------------------------------------------------------
+//! \fn void Sample()
+//! \brief appends one point to the zone-cycles/second time series, computed over the
+//! interval since the previous sample.  Called by the Driver on rank 0 at the
+//! diagnostic cadence; the very first call only establishes the baseline.
+
+void Sample(int ncycle, double wtime, std::uint64_t zone_cycles,
+            std::uint64_t part_updates) {
+  if (!(enabled)) {return;}
+  static bool have_prev = false;
+  static double prev_wtime = 0.0;
+  static std::uint64_t prev_zc = 0, prev_pu = 0;
+  if (have_prev && (wtime > prev_wtime)) {
+    ThroughputSample s;
+    s.cycle = ncycle;
+    s.wtime = wtime;
+    s.zcps = static_cast<double>(zone_cycles - prev_zc)/(wtime - prev_wtime);
+    s.pups = static_cast<double>(part_updates - prev_pu)/(wtime - prev_wtime);
+    samples.push_back(s);
+  }
+  have_prev = true;
+  prev_wtime = wtime;
+  prev_zc = zone_cycles;
+  prev_pu = part_updates;
+  return;
+}
+
+//----------------------------------------------------------------------------------------
+//! \fn void Dump()
+//! \brief reduces per-rank stall totals and writes the whole-run performance record.
+//! Must be called by all ranks (from Driver::Finalize)
+
+void Dump(const RunSummary &run) {
+  if (!(enabled)) {return;}
+  int nranks = global_variable::nranks;
+
+  // mean/max over ranks of time in the output path and in AMR regridding
+  double io_mean = run.io_time, io_max = run.io_time;
+  double amr_mean = run.amr_time, amr_max = run.amr_time;
+  // MPI wait fraction = mean over ranks of (time idle in wait regions)/(wall time),
+  // available only when the profiler was also enabled
+  double wait_time = 0.0;
+  if (profiler::enabled) {
+    for (auto &it : profiler::region_stats) {wait_time += it.second.time;}
+  }
+#if MPI_PARALLEL_ENABLED
+  MPI_Allreduce(MPI_IN_PLACE, &io_mean, 1, MPI_DOUBLE, MPI_SUM, MPI_COMM_WORLD);
+  MPI_Allreduce(MPI_IN_PLACE, &io_max,  1, MPI_DOUBLE, MPI_MAX, MPI_COMM_WORLD);
+  MPI_Allreduce(MPI_IN_PLACE, &amr_mean, 1, MPI_DOUBLE, MPI_SUM, MPI_COMM_WORLD);
+  MPI_Allreduce(MPI_IN_PLACE, &amr_max,  1, MPI_DOUBLE, MPI_MAX, MPI_COMM_WORLD);
+  MPI_Allreduce(MPI_IN_PLACE, &wait_time, 1, MPI_DOUBLE, MPI_SUM, MPI_COMM_WORLD);
+#endif
+  io_mean /= static_cast<double>(nranks);
+  amr_mean /= static_cast<double>(nranks);
+  double wait_frac = wait_time/(static_cast<double>(nranks)*run.wall_time);
+
+  if (global_variable::my_rank != 0) {return;}
+
+  std::ofstream pfile("perf_record.json", std::ios::trunc);
+  if (!(pfile.is_open())) {
+    std::cout << "### FATAL ERROR in " << __FILE__ << " at line " << __LINE__
+       << std::endl << "performance record file could not be opened" << std::endl;
+    std::exit(EXIT_FAILURE);
+  }
+  pfile << std::scientific;
+  pfile << "{" << std::endl;
+  pfile << "  \"schema\": \"athenak-perf-1\"," << std::endl;
+  pfile << "  \"nranks\": " << nranks << "," << std::endl;
+  pfile << "  \"ncycle\": " << run.ncycle << "," << std::endl;
+  pfile << "  \"time\": " << run.time << "," << std::endl;
+  pfile << "  \"wall_time\": " << run.wall_time << "," << std::endl;
+  pfile << "  \"zone_cycles\": " << run.zone_cycles << "," << std::endl;
+  pfile << "  \"zone_cycles_per_second\": "
+        << static_cast<double>(run.zone_cycles)/run.wall_time << "," << std::endl;
+  pfile << "  \"particle_updates_per_second\": "
+        << static_cast<double>(run.part_updates)/run.wall_time << "," << std::endl;
+  pfile << "  \"nmb_total\": " << run.nmb_total << "," << std::endl;
+  pfile << "  \"mpi_wait_fraction\": " << wait_frac << "," << std::endl;
+
+  // AMR event costs and load-balancing summary (zeros for uniform-grid runs)
+  pfile << "  \"amr\": {" << std::endl;
+  pfile << "    \"adaptive\": " << ((run.adaptive)? "true" : "false") << ","
+        << std::endl;
+  pfile << "    \"nmb_created\": " << run.nmb_created << "," << std::endl;
+  pfile << "    \"nmb_deleted\": " << run.nmb_deleted << "," << std::endl;
+  pfile << "    \"nmb_sent_lb\": " << run.nmb_sent_lb << "," << std::endl;
+  pfile << "    \"lb_efficiency\": " << run.lb_efficiency << "," << std::endl;
+  pfile << "    \"time_mean\": " << amr_mean << "," << std::endl;
+  pfile << "    \"time_max\": " << amr_max << std::endl;
+  pfile << "  }," << std::endl;
+
+  // total time the time step loop stalled in the per-cycle output path
+  pfile << "  \"io\": {" << std::endl;
+  pfile << "    \"time_mean\": " << io_mean << "," << std::endl;
+  pfile << "    \"time_max\": " << io_max << std::endl;
+  pfile << "  }," << std::endl;
+
+  // zone-cycles/second time series sampled at the diagnostic cadence
+  pfile << "  \"throughput\": [";
+  for (std::size_t n=0; n<samples.size(); ++n) {
+    if (n > 0) {pfile << ",";}
+    pfile << std::endl << "    {\"cycle\": " << samples[n].cycle
+          << ", \"wall_time\": " << samples[n].wtime
+          << ", \"zcps\": " << samples[n].zcps
+          << ", \"pups\": " << samples[n].pups << "}";
+  }
+  if (!(samples.empty())) {pfile << std::endl << "  ";}
+  pfile << "]," << std::endl;
+
+  // per-kernel aggregates (rank 0): top kernels by total time, as a compact summary.
+  // The full cross-rank breakdown remains in profile.csv when the profiler is enabled
+  std::vector<std::pair<double, std::string>> topk;
+  if (profiler::enabled) {
+    for (auto &it : profiler::kernel_stats) {
+      topk.push_back(std::make_pair(it.second.time, it.first));
+    }
+    std::sort(topk.rbegin(), topk.rend());
+    if (topk.size() > 10) {topk.resize(10);}
+  }
+  pfile << "  \"kernels\": [";
+  for (std::size_t n=0; n<topk.size(); ++n) {
+    const profiler::KernelStats &ks = profiler::kernel_stats[topk[n].second];
+    if (n > 0) {pfile << ",";}
+    pfile << std::endl << "    {\"name\": \"" << topk[n].second << "\""
+          << ", \"calls\": " << ks.count
+          << ", \"time\": " << ks.time
+          << ", \"frac\": " << ks.time/run.wall_time << "}";
+  }
+  if (!(topk.empty())) {pfile << std::endl << "  ";}
+  pfile << "]" << std::endl;
+  pfile << "}" << std::endl;
+  return;
+}
+
+} // namespace perfrec
@@ -0,0 +1,60 @@
+#ifndef UTILS_PERFREC_HPP_
+#define UTILS_PERFREC_HPP_
+//========================================================================================
+// AthenaXXX astrophysical plasma code
+// Copyright(C) 2020 James M. Stone <jmstone@ias.edu> and the Athena code team
+// Licensed under the 3-clause BSD License (the "LICENSE")
+//========================================================================================
+//! \file perfrec.hpp
+//! \brief per-run performance record, written in a stable machine-readable schema so
+//! throughput can be tracked across the many runs of a campaign (restarts, queue moves,
+//! software upgrades) by external tooling, without re-profiling each run.  Enabled with
+//! the '<time> perf_record' input flag; throughput samples are taken by the Driver at
+//! the diagnostic cadence (ndiag) and the record is written in Finalize.
+
+#include <cstdint>
+#include <vector>
+
+namespace perfrec {
+
+//----------------------------------------------------------------------------------------
+//! \struct ThroughputSample
+//! \brief one point of the zone-cycles/second time series, covering the interval since
+//! the previous sample
+
+struct ThroughputSample {
+  int cycle;     // cycle at which the sample was taken
+  double wtime;  // wall time since start of execution (seconds)
+  double zcps;   // zone-cycles/second over the interval since the previous sample
+  double pups;   // particle-updates/second over the same interval
+};
+
+//----------------------------------------------------------------------------------------
+//! \struct RunSummary
+//! \brief whole-run totals gathered by the Driver for the final record
+
+struct RunSummary {
+  int ncycle;                   // total number of cycles executed
+  double time;                  // final simulation time
+  double wall_time;             // wall time of execution (seconds)
+  std::uint64_t zone_cycles;    // total zone-updates over the run
+  std::uint64_t part_updates;   // total particle-updates over the run
+  int nmb_total;                // number of MeshBlocks at end of run
+  bool adaptive;                // AMR fields below only meaningful when true
+  int nmb_created;              // MeshBlocks created by AMR (all ranks)
+  int nmb_deleted;              // MeshBlocks deleted by AMR (all ranks)
+  int nmb_sent_lb;              // MeshBlocks communicated for load balancing
+  double lb_efficiency;         // mean load balancing efficiency over the run
+  double amr_time;              // total time in AMR regridding on this rank (seconds)
+  double io_time;               // total time in the per-cycle output path on this rank
+};
+
+extern bool enabled;            // set by '<time> perf_record' input flag
+extern std::vector<ThroughputSample> samples;
+
+void Sample(int ncycle, double wtime, std::uint64_t zone_cycles,
+            std::uint64_t part_updates);
+void Dump(const RunSummary &run);
+
+} // namespace perfrec
+#endif // UTILS_PERFREC_HPP_
@@ -0,0 +1,224 @@
+//========================================================================================
+// AthenaXXX astrophysical plasma code
+// Copyright(C) 2020 James M. Stone <jmstone@ias.edu> and the Athena code team
+// Licensed under the 3-clause BSD License (the "LICENSE")
+//========================================================================================
+//! \file profiler.cpp
+//! \brief implementation of built-in kernel/region timing registry, including gathering
+//! of statistics across ranks and machine-readable dumps.
+
+#include <algorithm>
+#include <cstdint>
+#include <fstream>
+#include <iostream>
+#include <map>
+#include <sstream>
+#include <string>
+#include <utility>
+#include <vector>
+
+#include "athena.hpp"
+#include "globals.hpp"
+#include "utils/profiler.hpp"
+
+#if MPI_PARALLEL_ENABLED
+#include <mpi.h>
+#endif
+
+namespace profiler {
+
+bool enabled = false;
+bool verbose = false;
+bool annotate_regions = false;
+std::map<std::string, KernelStats> kernel_stats;
+std::map<std::string, KernelStats> region_stats;
+std::map<std::string, KernelStats> wait_stats;
+std::map<std::string, KernelStats> task_stats;
+
+//----------------------------------------------------------------------------------------
+//! \struct MergedStats
+//! \brief cross-rank statistics for one named kernel or region, built from the per-rank
+//! total times so min/mean/max expose load imbalance between ranks
+
+struct MergedStats {
+  int nranks=0;          // number of ranks that timed this name
+  std::int64_t count=0;  // number of launches summed over ranks
+  double tsum=0.0;       // sum over ranks of per-rank total time
+  double tmin=0.0;       // minimum over ranks of per-rank total time
+  double tmax=0.0;       // maximum over ranks of per-rank total time
+};
+
+//----------------------------------------------------------------------------------------
+//! \fn void Accumulate
+//! \brief folds the elapsed time of one launch into the named entry of input registry
+
+void Accumulate(std::map<std::string, KernelStats> &stats, const std::string &name,
+                double dt) {
+  KernelStats &s = stats[name];
+  s.count++;
+  s.time += dt;
+  if ((s.count == 1) || (dt < s.tmin)) {s.tmin = dt;}
+  if (dt > s.tmax) {s.tmax = dt;}
+  return;
+}
+
+//----------------------------------------------------------------------------------------
+//! \fn void MergeAcrossRanks
+//! \brief gathers a timing registry from every rank onto rank 0 and merges entries by
+//! name.  Registries are serialized as text and gathered with MPI_Gatherv since with AMR
+//! different ranks may have timed different sets of kernels.  On return 'merged' is only
+//! filled on rank 0.
+
+static void MergeAcrossRanks(const std::map<std::string, KernelStats> &stats,
+                             std::map<std::string, MergedStats> &merged) {
+  // serialize local registry into a character stream (spaces in names, although not
+  // expected, would break parsing below, so they are replaced)
+  std::stringstream msg;
+  for (auto &it : stats) {
+    std::string name = it.first;
+    std::replace(name.begin(), name.end(), ' ', '_');
+    msg << name << " " << it.second.count << " " << it.second.time << "\n";
+  }
+  std::string smsg = msg.str();
+
+#if MPI_PARALLEL_ENABLED
+  // gather serialized registries from all ranks onto rank 0
+  int len = static_cast<int>(smsg.size());
+  std::vector<int> lens(global_variable::nranks, 0);
+  MPI_Gather(&len, 1, MPI_INT, lens.data(), 1, MPI_INT, 0, MPI_COMM_WORLD);
+  std::vector<int> disps(global_variable::nranks, 0);
+  int tot = 0;
+  for (int r=0; r<(global_variable::nranks); ++r) {
+    disps[r] = tot;
+    tot += lens[r];
+  }
+  std::vector<char> gathered(std::max(tot,1));
+  MPI_Gatherv(smsg.data(), len, MPI_CHAR, gathered.data(), lens.data(), disps.data(),
+              MPI_CHAR, 0, MPI_COMM_WORLD);
+  if (global_variable::my_rank != 0) {return;}
+  smsg.assign(gathered.data(), tot);
+#endif
+
+  // merge per-rank entries by name
+  std::stringstream all(smsg);
+  std::string name;
+  std::int64_t count;
+  double time;
+  while (all >> name >> count >> time) {
+    MergedStats &m = merged[name];
+    m.nranks++;
+    m.count += count;
+    m.tsum += time;
+    if ((m.nranks == 1) || (time < m.tmin)) {m.tmin = time;}
+    if (time > m.tmax) {m.tmax = time;}
+  }
+  return;
+}
+
+//----------------------------------------------------------------------------------------
+//! \fn void Dump
+//! \brief gathers kernel and region statistics from all ranks and writes them to
+//! 'profile.csv' in machine-readable form.  The file is overwritten with cumulative
+//! totals on each call, so the final call (from Driver::Finalize) covers the whole run.
+//! Must be called by all ranks.  Input 'elapsed' is the wall time of execution so far
+//! and 'zonecycles' the total number of zone-updates, used for the summary metadata.
+
+void Dump(int ncycle, double elapsed, double zonecycles) {
+  if (!(enabled)) {return;}
+  std::map<std::string, MergedStats> kmerged, rmerged, wmerged, tmerged;
+  MergeAcrossRanks(kernel_stats, kmerged);
+  MergeAcrossRanks(region_stats, rmerged);
+  MergeAcrossRanks(wait_stats, wmerged);
+  MergeAcrossRanks(task_stats, tmerged);
+  if (global_variable::my_rank != 0) {return;}
+
+  // MPI wait fraction = mean over ranks of (time idle in wait regions)/(wall time)
+  double wait_time = 0.0;
+  for (auto &it : rmerged) {wait_time += it.second.tsum;}
+  double wait_frac = wait_time/(static_cast<double>(global_variable::nranks)*elapsed);
+
+  std::ofstream pfile("profile.csv", std::ios::trunc);
+  if (!(pfile.is_open())) {
+    std::cout << "### FATAL ERROR in " << __FILE__ << " at line " << __LINE__
+       << std::endl << "profile file could not be opened" << std::endl;
+    std::exit(EXIT_FAILURE);
+  }
+  pfile << std::scientific;
+  pfile << "# cycle=" << ncycle << std::endl;
+  pfile << "# nranks=" << global_variable::nranks << std::endl;
+  pfile << "# wall_time=" << elapsed << std::endl;
+  pfile << "# zone_cycles_per_second=" << zonecycles/elapsed << std::endl;
+  pfile << "# mpi_wait_fraction=" << wait_frac << std::endl;
+  // per-name rows: min/mean/max over ranks of the per-rank total time, and the mean
+  // fraction of wall time spent in this kernel/region
+  pfile << "type,name,nranks,calls,time_min,time_mean,time_max,frac_mean" << std::endl;
+  for (auto &it : kmerged) {
+    MergedStats &m = it.second;
+    double tmean = m.tsum/static_cast<double>(m.nranks);
+    pfile << "kernel," << it.first << "," << m.nranks << "," << m.count << ","
+          << m.tmin << "," << tmean << "," << m.tmax << "," << tmean/elapsed
+          << std::endl;
+  }
+  for (auto &it : rmerged) {
+    MergedStats &m = it.second;
+    double tmean = m.tsum/static_cast<double>(m.nranks);
+    pfile << "region," << it.first << "," << m.nranks << "," << m.count << ","
+          << m.tmin << "," << tmean << "," << m.tmax << "," << tmean/elapsed
+          << std::endl;
+  }
+  // task rows: per (task name, stage), host time of every call into the task function
+  // (including polls); only filled with '<time> annotate_regions = true'
+  for (auto &it : tmerged) {
+    MergedStats &m = it.second;
+    double tmean = m.tsum/static_cast<double>(m.nranks);
+    pfile << "task," << it.first << "," << m.nranks << "," << m.count << ","
+          << m.tmin << "," << tmean << "," << m.tmax << "," << tmean/elapsed
+          << std::endl;
+  }
+  // wait-state rows: per (receive task, stage), time spent in polls returning without
+  // messages having arrived ('calls' counts incomplete polls)
+  for (auto &it : wmerged) {
+    MergedStats &m = it.second;
+    double tmean = m.tsum/static_cast<double>(m.nranks);
+    pfile << "wait," << it.first << "," << m.nranks << "," << m.count << ","
+          << m.tmin << "," << tmean << "," << m.tmax << "," << tmean/elapsed
+          << std::endl;
+  }
+
+  // with '<time> verbose_kernels = true', also print the top kernels by mean time per
+  // rank to stdout with their launch configurations, so regressions in the expensive
+  // kernels (e.g. register spilling after a compiler upgrade slowing z4c_calcrhs) show
+  // up directly in the run log without external tooling
+  if (verbose) {
+    std::vector<std::pair<double, std::string>> top;
+    for (auto &it : kmerged) {
+      top.emplace_back(it.second.tsum/static_cast<double>(it.second.nranks), it.first);
+    }
+    std::sort(top.begin(), top.end(),
+              [](const std::pair<double, std::string> &a,
+                 const std::pair<double, std::string> &b) {return a.first > b.first;});
+    int ntop = std::min(static_cast<int>(top.size()), 10);
+    std::ios_base::fmtflags cflags = std::cout.flags();
+    std::cout << std::scientific;
+    std::cout << "#----- top " << ntop << " kernels by mean time per rank at cycle="
+              << ncycle << " -----" << std::endl;
+    std::cout << "# name calls time frac items/launch scratch_bytes" << std::endl;
+    for (int n=0; n<ntop; ++n) {
+      MergedStats &m = kmerged[top[n].second];
+      // launch configuration read from this rank's registry; the geometry only differs
+      // between ranks through the local MeshBlock count
+      std::int64_t items = 0, scratch = 0;
+      auto jt = kernel_stats.find(top[n].second);
+      if (jt != kernel_stats.end()) {
+        items = jt->second.items;
+        scratch = jt->second.scratch;
+      }
+      std::cout << top[n].second << " " << m.count << " " << top[n].first << " "
+                << top[n].first/elapsed << " " << items << " " << scratch << std::endl;
+    }
+    std::cout.flags(cflags);
+  }
+  return;
+}
+
+} // namespace profiler
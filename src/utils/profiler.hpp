@@ -0,0 +1,141 @@
+#ifndef UTILS_PROFILER_HPP_
+#define UTILS_PROFILER_HPP_
+//========================================================================================
+// AthenaXXX astrophysical plasma code
+// Copyright(C) 2020 James M. Stone <jmstone@ias.edu> and the Athena code team
+// Licensed under the 3-clause BSD License (the "LICENSE")
+//========================================================================================
+//! \file profiler.hpp
+//! \brief built-in instrumentation for Kokkos kernels and MPI wait regions.  Every
+//! par_for/par_for_outer wrapper in athena.hpp reports into a registry keyed by the name
+//! string already passed to Kokkos, and host-side wait loops report into a separate
+//! region registry, so detailed timing is available without attaching an external
+//! profiler.  Enabled at runtime with '<time> profiler = true'; when disabled the scoped
+//! guards below reduce to a branch on a bool, so instrumented code runs at full speed.
+//! Statistics are gathered across ranks and written in machine-readable form by Dump().
+//!
+//! NOTE: this header is included by athena.hpp, so it must not include any other AthenaK
+//! headers itself.
+
+#include <cstdint>
+#include <map>
+#include <string>
+
+#include <Kokkos_Core.hpp>
+
+namespace profiler {
+
+//----------------------------------------------------------------------------------------
+//! \struct KernelStats
+//! \brief accumulated timing statistics for one named kernel or region on this rank
+
+struct KernelStats {
+  std::int64_t count=0;  // number of launches (or region entries) timed
+  double time=0.0;       // total time (seconds)
+  double tmin=0.0;       // minimum time of a single launch
+  double tmax=0.0;       // maximum time of a single launch
+  std::int64_t items=0;  // index-space size (range length or league size) of the most
+                         // recent launch (0 = not recorded, e.g. host regions)
+  std::int64_t scratch=0;  // per-team scratch bytes requested (par_for_outer only)
+};
+
+extern bool enabled;                             // set by '<time> profiler' input flag
+extern bool verbose;   // '<time> verbose_kernels': print top kernels with their launch
+                       // configurations to stdout on every Dump()
+extern bool annotate_regions;  // '<time> annotate_regions': push a Kokkos profiling
+                               // region per task name per stage around every task call,
+                               // structuring the kernel stream for external profilers
+extern std::map<std::string, KernelStats> kernel_stats;  // per-kernel registry
+extern std::map<std::string, KernelStats> region_stats;  // MPI wait region registry
+extern std::map<std::string, KernelStats> wait_stats;    // task wait-state registry
+extern std::map<std::string, KernelStats> task_stats;    // per-task-region registry
+
+void Accumulate(std::map<std::string, KernelStats> &stats, const std::string &name,
+                double dt);
+void Dump(int ncycle, double elapsed, double zonecycles);
+
+//----------------------------------------------------------------------------------------
+//! \class KernelTimer
+//! \brief scoped guard that times the kernel launched while it is in scope.  Fences the
+//! target execution space instance on construction and destruction, so the measured
+//! interval covers only the guarded launch even for asynchronous kernels.  The par_for
+//! wrappers also pass the launch configuration (index-space size, and scratch bytes for
+//! team loops), which is recorded alongside the timing for the verbose kernel report.
+
+template <class TExecSpace>
+class KernelTimer {
+ public:
+  KernelTimer(const std::string &name, TExecSpace exec,
+              std::int64_t items = 0, std::int64_t scratch = 0) :
+      name_(name), exec_(exec), items_(items), scratch_(scratch) {
+    if (enabled) {
+      exec_.fence();
+      timer_.reset();
+    }
+  }
+  ~KernelTimer() {
+    if (enabled) {
+      exec_.fence();
+      Accumulate(kernel_stats, name_, timer_.seconds());
+      KernelStats &s = kernel_stats[name_];
+      s.items = items_;
+      s.scratch = scratch_;
+    }
+  }
+ private:
+  const std::string &name_;
+  TExecSpace exec_;
+  std::int64_t items_, scratch_;
+  Kokkos::Timer timer_;
+};
+
+//----------------------------------------------------------------------------------------
+//! \class RegionTimer
+//! \brief scoped guard that times a host-side region, e.g. loops over MPI_Wait calls.
+//! Reported wait times measure how long ranks idle in communication, from which the
+//! MPI wait fraction of the run is computed in Dump().
+
+class RegionTimer {
+ public:
+  explicit RegionTimer(const std::string &name) : name_(name) {
+    if (enabled) {timer_.reset();}
+  }
+  ~RegionTimer() {
+    if (enabled) {Accumulate(region_stats, name_, timer_.seconds());}
+  }
+ private:
+  const std::string name_;
+  Kokkos::Timer timer_;
+};
+
+//----------------------------------------------------------------------------------------
+//! \class WaitTimer
+//! \brief scoped guard for boundary-receive tasks that accumulates, keyed by task name
+//! and stage, the time spent in polls that end without the messages having arrived.
+//! Tasks mark successful polls with Completed(); unmarked polls are folded into the
+//! wait-state registry on destruction.  The resulting rows in the dump show which
+//! receive task (RecvU, RecvB, RecvFlux, ...) dominates wait time, which is otherwise
+//! invisible since incomplete tasks just return and the scheduler moves on.
+
+class WaitTimer {
+ public:
+  WaitTimer(const char *task, int stage) : complete_(false) {
+    if (enabled) {
+      name_ = task;
+      name_ += "_stg";
+      name_ += std::to_string(stage);
+      timer_.reset();
+    }
+  }
+  void Completed() {complete_ = true;}
+  ~WaitTimer() {
+    if (enabled && !(complete_)) {Accumulate(wait_stats, name_, timer_.seconds());}
+  }
+ private:
+  std::string name_;
+  bool complete_;
+  Kokkos::Timer timer_;
+};
+
+} // namespace profiler
+#endif // UTILS_PROFILER_HPP_
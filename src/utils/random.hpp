@@ -144,26 +144,27 @@ static Real Ran2(int64_t *idum) {
 
 //----------------------------------------------------------------------------------------
 //! \fn RanGaussian
+//! \brief Gaussian deviates by the Box-Mueller method.  The spare deviate is cached in
+//! the RNG_State (iset/gset) rather than in function-local statics, so that a state
+//! saved to a restart file reproduces the deviate sequence exactly when restored.
 
 KOKKOS_INLINE_FUNCTION
 static Real RanGaussianSt(RNG_State *state) {
-  static int iset = 0;
-  static double gset;
   double fac, rsq, v1, v2;
-  if (state->idum < 0) iset = 0;
-  if (iset == 0) {
+  if (state->idum < 0) state->iset = 0;
+  if (state->iset == 0) {
     do {
       v1 = 2.0 * RanSt(state) - 1.0;
       v2 = 2.0 * RanSt(state) - 1.0;
       rsq = v1 * v1 + v2 * v2;
     } while (rsq >=1.0 || rsq == 0.0);
     fac = sqrt(-2.0*log(rsq)/rsq);
-    gset = v1*fac;
-    iset = 1;
+    state->gset = v1*fac;
+    state->iset = 1;
     return v2*fac;
   } else {
-    iset = 0;
-    return gset;
+    state->iset = 0;
+    return state->gset;
   }
 }
 
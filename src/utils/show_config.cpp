@@ -36,5 +36,12 @@ void ShowConfig() {
   // std::cout<<"  Compiler:                   " << COMPILED_WITH << std::endl;
   // std::cout<<"  Compilation command:        " << COMPILER_COMMAND
   //          << COMPILED_WITH_OPTIONS << std::endl;
+
+  // runtime configuration reported by Kokkos: backends, device architecture, and the
+  // compile-time options the kernels were built with.  Per-kernel register counts and
+  // spill stores are a compile-time property; configure with
+  // -D Athena_ENABLE_RESOURCE_USAGE=ON to have the device compiler print them per kernel
+  std::cout << std::endl << "Kokkos configuration:" << std::endl;
+  Kokkos::print_configuration(std::cout);
   return;
 }
@@ -5,12 +5,20 @@
 //========================================================================================
 //! \file tr_table.cpp
 //! \brief Implementation of Table class
+#include <algorithm>
+#include <cstdint>
+#include <cstring>
 #include <string>
 #include <fstream>
 #include <sstream>
 #include <map>
 #include <vector>
 
+#include "config.hpp"
+#if MPI_PARALLEL_ENABLED
+#include <mpi.h>
+#endif
+
 #include "tr_table.hpp"
 #include "tr_utils.hpp"
 
@@ -28,36 +36,62 @@ Table::~Table() {
 ReadResult Table::ReadTable(const std::string fname) {
   ReadResult result;
 
-  std::ifstream file;
-  try {
-    file.open(fname.c_str(), std::ifstream::in);
-  } catch (std::ifstream::failure& e) {
-    result.error = ReadResult::BAD_FILENAME;
-    std::stringstream ss;
-    ss << "Could not read '" << fname << "'\n"
-       << "open() returned the following error:\n"
-       << e.what();
-    result.message = ss.str();
-    return result;
+  // Read the entire file once into memory.  With MPI only rank 0 touches the
+  // filesystem and the image is broadcast to all other ranks, so loading does not
+  // scale with the number of ranks opening and reading the same (possibly very
+  // large) table at startup.
+  std::vector<char> fimage;
+  std::int64_t fsize = 0;
+  int rank = 0;
+#if MPI_PARALLEL_ENABLED
+  MPI_Comm_rank(MPI_COMM_WORLD, &rank);
+#endif
+  if (rank == 0) {
+    std::ifstream file(fname.c_str(), std::ifstream::in | std::ifstream::binary);
+    if (file.is_open()) {
+      file.seekg(0, std::ifstream::end);
+      fsize = file.tellg();
+      file.seekg(0, std::ifstream::beg);
+      fimage.resize(fsize);
+      file.read(fimage.data(), fsize);
+      if (!file) {
+        fsize = -1;
+      }
+    } else {
+      fsize = -1;
+    }
   }
-
-  // Something bizarre happened while reading the file.
-  if (!file.is_open()) {
+#if MPI_PARALLEL_ENABLED
+  MPI_Bcast(&fsize, 1, MPI_INT64_T, 0, MPI_COMM_WORLD);
+  if (fsize > 0) {
+    fimage.resize(fsize);
+    // broadcast in chunks since the MPI count argument is a (32-bit) int
+    const std::int64_t kChunk = 1073741824;
+    for (std::int64_t pos = 0; pos < fsize; pos += kChunk) {
+      int n = static_cast<int>(std::min(kChunk, fsize - pos));
+      MPI_Bcast(fimage.data() + pos, n, MPI_CHAR, 0, MPI_COMM_WORLD);
+    }
+  }
+#endif
+  if (fsize < 0) {
     result.error = ReadResult::BAD_FILENAME;
     std::stringstream ss;
-    ss << "No exception occurred, but ReadTable() failed to open '" << fname << "'\n";
+    ss << "Could not read '" << fname << "'\n";
     result.message = ss.str();
     return result;
   }
 
-  // HEADER PARSING
+  // HEADER PARSING (from the in-memory image; the header is a small text preamble)
+
+  const std::int64_t kMaxHeader = 65536;
+  std::istringstream hdr(std::string(fimage.data(),
+                         (fsize < kMaxHeader)? fsize : kMaxHeader));
 
   // Read in the metadata
   std::vector<std::string> block_lines;
 
-  result = ExtractBlock(file, "metadata", block_lines);
+  result = ExtractBlock(hdr, "metadata", block_lines);
   if (result.error != ReadResult::SUCCESS) {
-    file.close();
     return result;
   }
   result = ParseBlock("metadata", block_lines,
@@ -65,15 +99,13 @@ ReadResult Table::ReadTable(const std::string fname) {
     metadata[k] = v;
   });
   if (result.error != ReadResult::SUCCESS) {
-    file.close();
     return result;
   }
   block_lines.clear();
 
   // Read in the scalars
-  result = ExtractBlock(file, "scalars", block_lines);
+  result = ExtractBlock(hdr, "scalars", block_lines);
   if (result.error != ReadResult::SUCCESS) {
-    file.close();
     return result;
   }
   result = ParseBlock("scalars", block_lines,
@@ -81,15 +113,13 @@ ReadResult Table::ReadTable(const std::string fname) {
     scalars[k] = std::stod(v);
   });
   if (result.error != ReadResult::SUCCESS) {
-    file.close();
     return result;
   }
   block_lines.clear();
 
   // Read in the points
-  result = ExtractBlock(file, "points", block_lines);
+  result = ExtractBlock(hdr, "points", block_lines);
   if (result.error != ReadResult::SUCCESS) {
-    file.close();
     return result;
   }
   result = ParseBlock("points", block_lines,
@@ -97,16 +127,14 @@ ReadResult Table::ReadTable(const std::string fname) {
     point_info.push_back({k, std::stoi(v)});
   });
   if (result.error != ReadResult::SUCCESS) {
-    file.close();
     return result;
   }
   block_lines.clear();
   ndim = point_info.size();
 
   // Read in the fields
-  result = ExtractBlock(file, "fields", block_lines);
+  result = ExtractBlock(hdr, "fields", block_lines);
   if (result.error != ReadResult::SUCCESS) {
-    file.close();
     return result;
   }
   for (auto line : block_lines) {
@@ -114,8 +142,7 @@ ReadResult Table::ReadTable(const std::string fname) {
     field_names.push_back(line);
   }
 
-  size_t header_size = file.tellg();
-  file.close();
+  size_t header_size = hdr.tellg();
 
   // Allocate memory for the fields.
   npoints = 1;
@@ -140,33 +167,17 @@ ReadResult Table::ReadTable(const std::string fname) {
 
   initialized = true;
 
-  // Now we need to load the table memory itself. We reopen the file as a binary.
-  try {
-    file.open(fname.c_str(), std::ifstream::in | std::ifstream::binary);
-  } catch (std::ifstream::failure& e) {
-    result.error = ReadResult::BAD_FILENAME;
-    std::stringstream ss;
-    ss << "Could not read '" << fname << "' as a binary file\n"
-       << "open() returned the following error:\n"
-       << e.what();
-    result.message = ss.str();
-    return result;
-  }
-  if (!file.is_open()) {
-    result.error = ReadResult::BAD_FILENAME;
+  // Now we need to load the table memory itself, which follows the header in the
+  // already-read file image.
+  // FIXME(JMF): This doesn't handle single precision data correctly!
+  if (static_cast<std::int64_t>(header_size + mem_size*sizeof(double)) > fsize) {
+    result.error = ReadResult::BAD_HEADER;
     std::stringstream ss;
-    ss << "No exception occurred, but ReadTable() failed to open '" << fname << "'\n"
-       << "as a binary file\n";
+    ss << "'" << fname << "' is smaller than the size implied by its header.\n";
     result.message = ss.str();
     return result;
   }
-
-  // Because we've already read the header, we skip ahead to the binary section.
-  file.seekg(header_size);
-  // Dump all the memory into the data.
-  // FIXME(JMF): This doesn't handle single precision data correctly!
-  char *memblock = reinterpret_cast<char*>(data);
-  file.read(memblock, mem_size*sizeof(double));
+  std::memcpy(data, fimage.data() + header_size, mem_size*sizeof(double));
 
   // Now we need to check for endianness.
   if ((!metadata["endianness"].compare("little") && !IsLittleEndian()) ||
@@ -177,14 +188,12 @@ ReadResult Table::ReadTable(const std::string fname) {
     result.message = "Swapped endianness of data.\n";
   }
 
-  file.close();
-
   result.error = ReadResult::SUCCESS;
 
   return result;
 }
 
-ReadResult Table::ExtractBlock(std::ifstream& file, const std::string name,
+ReadResult Table::ExtractBlock(std::istream& file, const std::string name,
                                std::vector<std::string>& lines) {
   ReadResult result;
   // Read the first block
@@ -99,7 +99,7 @@ class Table {
     return result;
   }
 
-  ReadResult ExtractBlock(std::ifstream& file, const std::string name,
+  ReadResult ExtractBlock(std::istream& file, const std::string name,
                           std::vector<std::string>& lines);
 
   bool SplitToken(const std::string& in, std::string& key, std::string& value);
@@ -64,6 +64,7 @@ Z4c::Z4c(MeshBlockPack *ppack, ParameterInput *pin) :
   u_rhs("u_rhs z4c",1,1,1,1,1),
   u_weyl("u_weyl",1,1,1,1,1),
   coarse_u_weyl("coarse_u_weyl",1,1,1,1,1),
+  u_ah("u_ah",1,1,1,1,1),
   psi_out("psi_out",1,1,1),
   pz4c_amr(new Z4c_AMR(this,pin)) {
   // (1) read time-evolution option [already error checked in driver constructor]
@@ -180,14 +181,44 @@ Z4c::Z4c(MeshBlockPack *ppack, ParameterInput *pin) :
   mkdir("waveforms",0775);
   waveform_dt = pin->GetOrAddReal("z4c", "waveform_dt", 1);
   last_output_time = 0;
+  // optionally finish wave extraction (Ylm reduction and file append) on a worker
+  // thread so evolution does not stall on it (requires MPI_THREAD_MULTIPLE with MPI)
+  wave_extr_async = pin->GetOrAddBoolean("z4c", "async_wave_extr", false);
+
+  // on-line apparent-horizon finder (fast flow over a SphericalGrid sampling of the
+  // expansion); feeds the excision masks when <coord>/excision_scheme = horizon
+  ah_find = pin->GetOrAddBoolean("z4c", "ah_find", false);
+  if (ah_find) {
+    ah_dt = pin->GetOrAddReal("z4c", "ah_dt", 1.0);
+    ah_radius = pin->GetOrAddReal("z4c", "ah_initial_radius", 2.0);
+    ah_flow_alpha = pin->GetOrAddReal("z4c", "ah_flow_alpha", 1.0);
+    ah_tol = pin->GetOrAddReal("z4c", "ah_tol", 1.0e-4);
+    ah_max_iter = pin->GetOrAddInteger("z4c", "ah_max_iter", 20);
+    int ah_nlev = pin->GetOrAddInteger("z4c", "ah_nlev", 10);
+    ah_last_time = -ah_dt;
+    int ncells1 = indcs.nx1 + 2*(indcs.ng);
+    int ncells2 = (indcs.nx2 > 1)? (indcs.nx2 + 2*(indcs.ng)) : 1;
+    int ncells3 = (indcs.nx3 > 1)? (indcs.nx3 + 2*(indcs.ng)) : 1;
+    Kokkos::realloc(u_ah, nmb, 1, ncells3, ncells2, ncells1);
+    ah_grid = std::make_unique<SphericalGrid>(ppack, ah_nlev, ah_radius);
+  }
+#if MPI_PARALLEL_ENABLED
+  MPI_Comm_dup(MPI_COMM_WORLD, &wave_comm_);
+#endif
 }
 
 //----------------------------------------------------------------------------------------
 //! \fn void Z4c::AlgConstr(AthenaArray<Real> & u)
 //! \brief algebraic constraints projection
 //
-// This function operates on all grid points of the MeshBlock
-void Z4c::AlgConstr(MeshBlockPack *pmbp) {
+// By default this function operates on all grid points of the MeshBlock.  The region
+// argument restricts it to the interior cells only (alg_interior) or to the ghost zones
+// only (alg_ghosts); the pair covers the full grid and lets the interior projection run
+// while the ghost-zone exchange is still in flight (see EnforceAlgConstrInterior()).
+// With update_adm the Z4c -> ADM conversion (see Z4cToADM()) is fused into the same
+// sweep: the projected metric and A are still in registers, so the standalone
+// full-grid conversion kernel is skipped.
+void Z4c::AlgConstr(MeshBlockPack *pmbp, bool update_adm, AlgConstrRegion region) {
   // capture variables for the kernel
   auto &indcs = pmbp->pmesh->mb_indcs;
   int &is = indcs.is; int &ie = indcs.ie;
@@ -198,13 +229,21 @@ void Z4c::AlgConstr(MeshBlockPack *pmbp) {
   int jsg = js-indcs.ng; int jeg = je+indcs.ng;
   int ksg = ks-indcs.ng; int keg = ke+indcs.ng;
 
+  // loop box, plus an inner box excluded from it (empty except for the ghost frame)
+  int il = isg, iu = ieg, jl = jsg, ju = jeg, kl = ksg, ku = keg;
+  if (region == alg_interior) {il = is; iu = ie; jl = js; ju = je; kl = ks; ku = ke;}
+  int ixs = 0, ixe = -1, jxs = 0, jxe = -1, kxs = 0, kxe = -1;
+  if (region == alg_ghosts) {ixs = is; ixe = ie; jxs = js; jxe = je; kxs = ks; kxe = ke;}
+
   int nmb = pmbp->nmb_thispack;
 
   auto &z4c = pmbp->pz4c->z4c;
+  auto &adm = pmbp->padm->adm;
   auto &opt = pmbp->pz4c->opt;
   par_for("Alg constr loop",DevExeSpace(),
-  0,nmb-1,ksg,keg,jsg,jeg,isg,ieg,
+  0,nmb-1,kl,ku,jl,ju,il,iu,
   KOKKOS_LAMBDA(const int m, const int k, const int j, const int i) {
+    if (k>=kxs && k<=kxe && j>=jxs && j<=jxe && i>=ixs && i<=ixe) {return;}
     Real detg = adm::SpatialDet(z4c.g_dd(m,0,0,k,j,i), z4c.g_dd(m,0,1,k,j,i),
                               z4c.g_dd(m,0,2,k,j,i),z4c.g_dd(m,1,1,k,j,i),
                               z4c.g_dd(m,1,2,k,j,i), z4c.g_dd(m,2,2,k,j,i));
@@ -232,11 +271,25 @@ void Z4c::AlgConstr(MeshBlockPack *pmbp) {
     for(int b = a; b < 3; ++b) {
       z4c.vA_dd(m,a,b,k,j,i) -= (1.0/3.0) * A * z4c.g_dd(m,a,b,k,j,i);
     }
+
+    // fused Z4c -> ADM conversion on the freshly projected variables
+    if (update_adm) {
+      Real psi4 = pow(z4c.chi(m,k,j,i), 4./opt.chi_psi_power);
+      Real Ktr = (1./3.) * (z4c.vKhat(m,k,j,i) + 2.*z4c.vTheta(m,k,j,i));
+      adm.psi4(m,k,j,i) = psi4;
+      for(int a = 0; a < 3; ++a)
+      for(int b = a; b < 3; ++b) {
+        Real g_ab = psi4 * z4c.g_dd(m,a,b,k,j,i);
+        adm.g_dd(m,a,b,k,j,i) = g_ab;
+        adm.vK_dd(m,a,b,k,j,i) = psi4 * z4c.vA_dd(m,a,b,k,j,i) + Ktr * g_ab;
+      }
+    }
   });
 }
 //----------------------------------------------------------------------------------------
 // destructor
 Z4c::~Z4c() {
+  if (wave_worker_.joinable()) {wave_worker_.join();}
   delete pbval_u;
   delete pbval_weyl;
   delete pz4c_amr;
@@ -11,7 +11,13 @@
 #include <map>
 #include <memory>    // make_unique, unique_ptr
 #include <string>
+#include <thread>
 #include <vector>
+
+#if MPI_PARALLEL_ENABLED
+#include <mpi.h>
+#endif
+
 #include "athena.hpp"
 #include "utils/finite_diff.hpp"
 #include "parameter_input.hpp"
@@ -36,6 +42,8 @@ struct Z4cTaskIDs {
   TaskID crhs;
   TaskID sombc;
   TaskID expl;
+  TaskID expli;
+  TaskID algci;
   TaskID sendu;
   TaskID recvu;
   TaskID newdt;
@@ -48,6 +56,7 @@ struct Z4cTaskIDs {
   TaskID crecv;
   TaskID restu;
   TaskID ptrck;
+  TaskID ahf;
   TaskID weyl_scalar;
   TaskID wave_extr;
   TaskID weyl_rest;
@@ -61,6 +70,20 @@ struct Z4cTaskIDs {
 namespace z4c {
 class Z4c_AMR;
 
+//----------------------------------------------------------------------------------------
+//! \struct WaveExtrSnapshot
+//! \brief host copy of everything needed to finish wave extraction at one output time,
+//! so the Ylm reduction and file append can run while evolution continues
+
+struct WaveExtrSnapshot {
+  Real time;
+  std::vector<Real> radius;                     // extraction radius of each shell
+  std::vector<int> nangles;                     // number of angles on each shell
+  std::vector<std::vector<Real>> theta, phi;    // angular positions on each shell
+  std::vector<std::vector<Real>> weight;        // solid angle weights on each shell
+  std::vector<std::vector<Real>> datar, datai;  // interpolated psi4 on each shell
+};
+
 // Shift needed for derivatives
 //----------------------------------------------------------------------------------------
 //! \class Z4c
@@ -221,6 +244,19 @@ class Z4c {
   Real waveform_dt;
   Real last_output_time;
   int nrad; // number of radii to perform wave extraction
+  bool wave_extr_async; // finish wave extraction on a worker thread
+
+  // apparent-horizon finder: fast flow on the mean radius of a SphericalGrid sampling
+  // of the expansion, feeding the excision masks (see Coordinates::UpdateExcisionRadius)
+  DvceArray5D<Real> u_ah;  // cell-centered expansion of coordinate spheres
+  std::unique_ptr<SphericalGrid> ah_grid;  // trial surface for the flow iteration
+  bool ah_find;       // enable the on-line apparent-horizon finder
+  Real ah_dt;         // time between horizon searches
+  Real ah_last_time;  // time of the last horizon search
+  Real ah_radius;     // current horizon radius estimate, initial guess for next search
+  Real ah_flow_alpha; // fast-flow step coefficient
+  Real ah_tol;        // convergence tolerance on the mean expansion
+  int ah_max_iter;    // maximum flow iterations per search
 
   // functions
   void AssembleZ4cTasks(std::map<std::string, std::shared_ptr<TaskList>> tl);
@@ -238,9 +274,11 @@ class Z4c {
   TaskStatus RecvWeyl(Driver *d, int stage);
   TaskStatus Prolongate(Driver *pdrive, int stage);
   TaskStatus ProlongateWeyl(Driver *pdrive, int stage);
-  TaskStatus ExpRKUpdate(Driver *d, int stage);
+  TaskStatus ExpRKUpdateShell(Driver *d, int stage);
+  TaskStatus ExpRKUpdateInterior(Driver *d, int stage);
   TaskStatus NewTimeStep(Driver *d, int stage);
   TaskStatus ApplyPhysicalBCs(Driver *d, int stage);
+  TaskStatus EnforceAlgConstrInterior(Driver *d, int stage);
   TaskStatus EnforceAlgConstr(Driver *d, int stage);
 
   TaskStatus Z4cToADM_(Driver *d, int stage);
@@ -250,6 +288,7 @@ class Z4c {
   TaskStatus RestrictU(Driver *d, int stage);
   TaskStatus RestrictWeyl(Driver *d, int stage);
   TaskStatus PunctureTracker(Driver *d, int stage);
+  TaskStatus HorizonFinder(Driver *d, int stage);
   TaskStatus CalcWeylScalar(Driver *d, int stage);
   TaskStatus CalcWaveForm(Driver *d, int stage);
 
@@ -264,13 +303,25 @@ class Z4c {
   template <int NGHOST>
   void Z4cWeyl(MeshBlockPack *pmbp);
   void WaveExtr(MeshBlockPack *pmbp);
-  void AlgConstr(MeshBlockPack *pmbp);
+  template <int NGHOST>
+  void HorizonExpansion(MeshBlockPack *pmbp);
+  void FindHorizon(MeshBlockPack *pmbp);
+  // region selector for AlgConstr(); the interior/ghost split lets the projection of
+  // interior cells overlap the ghost-zone exchange (see EnforceAlgConstrInterior)
+  enum AlgConstrRegion {alg_full=0, alg_interior, alg_ghosts};
+  void AlgConstr(MeshBlockPack *pmbp, bool update_adm = false,
+                 AlgConstrRegion region = alg_full);
 
   // amr criteria
   Z4c_AMR *pz4c_amr{nullptr};
 
  private:
   MeshBlockPack* pmy_pack;  // ptr to MeshBlockPack containing this Z4c
+  std::thread wave_worker_; // in-flight asynchronous wave extraction, if any
+#if MPI_PARALLEL_ENABLED
+  MPI_Comm wave_comm_;      // dedicated communicator for the psi4 mode reduction
+#endif
+  void ReduceAndWriteWaveforms(WaveExtrSnapshot snap);
 };
 
 
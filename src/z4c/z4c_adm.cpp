@@ -69,33 +69,41 @@ void Z4c::ADMToZ4c(MeshBlockPack *pmbp, ParameterInput *pin) {
   par_for("initialize z4c fields",DevExeSpace(),
   0,nmb-1,ksg,keg,jsg,jeg,isg,ieg,
   KOKKOS_LAMBDA(const int m, const int k, const int j, const int i) {
+    // load all ADM components of this cell once; the conformal decomposition below
+    // then runs entirely on registers, and each output component is stored once
+    AthenaScratchTensor<Real, TensorSymm::SYM2, 3, 2> g_dd;
+    AthenaScratchTensor<Real, TensorSymm::SYM2, 3, 2> gt_dd;
     AthenaScratchTensor<Real, TensorSymm::SYM2, 3, 2> Kt_dd;
-    Real detg = adm::SpatialDet(adm.g_dd(m,0,0,k,j,i), adm.g_dd(m,0,1,k,j,i),
-                                adm.g_dd(m,0,2,k,j,i), adm.g_dd(m,1,1,k,j,i),
-                                adm.g_dd(m,1,2,k,j,i), adm.g_dd(m,2,2,k,j,i));
+    for(int a = 0; a < 3; ++a)
+    for(int b = a; b < 3; ++b) {
+      g_dd(a,b)  = adm.g_dd(m,a,b,k,j,i);
+      Kt_dd(a,b) = adm.vK_dd(m,a,b,k,j,i);
+    }
+
+    Real detg = adm::SpatialDet(g_dd(0,0), g_dd(0,1), g_dd(0,2),
+                                g_dd(1,1), g_dd(1,2), g_dd(2,2));
     Real oopsi4 = pow(detg, -1./3.);
-    z4c.chi(m,k,j,i) = pow(detg, 1./12.*opt.chi_psi_power);
 
     for(int a = 0; a < 3; ++a)
     for(int b = a; b < 3; ++b) {
-      z4c.g_dd(m,a,b,k,j,i) = oopsi4 * adm.g_dd(m,a,b,k,j,i);
-      Kt_dd(a,b)            = oopsi4 * adm.vK_dd(m,a,b,k,j,i);
+      gt_dd(a,b)  = oopsi4 * g_dd(a,b);
+      Kt_dd(a,b) *= oopsi4;
     }
 
-    detg = adm::SpatialDet(z4c.g_dd(m,0,0,k,j,i), z4c.g_dd(m,0,1,k,j,i),
-                           z4c.g_dd(m,0,2,k,j,i), z4c.g_dd(m,1,1,k,j,i),
-                           z4c.g_dd(m,1,2,k,j,i), z4c.g_dd(m,2,2,k,j,i));
-    z4c.vKhat(m,k,j,i) = adm::Trace(1.0/detg,
-                              z4c.g_dd(m,0,0,k,j,i), z4c.g_dd(m,0,1,k,j,i),
-                              z4c.g_dd(m,0,2,k,j,i), z4c.g_dd(m,1,1,k,j,i),
-                              z4c.g_dd(m,1,2,k,j,i), z4c.g_dd(m,2,2,k,j,i),
-                              Kt_dd(0,0), Kt_dd(0,1), Kt_dd(0,2),
-                              Kt_dd(1,1), Kt_dd(1,2), Kt_dd(2,2));
+    Real detgt = adm::SpatialDet(gt_dd(0,0), gt_dd(0,1), gt_dd(0,2),
+                                 gt_dd(1,1), gt_dd(1,2), gt_dd(2,2));
+    Real Khat = adm::Trace(1.0/detgt,
+                           gt_dd(0,0), gt_dd(0,1), gt_dd(0,2),
+                           gt_dd(1,1), gt_dd(1,2), gt_dd(2,2),
+                           Kt_dd(0,0), Kt_dd(0,1), Kt_dd(0,2),
+                           Kt_dd(1,1), Kt_dd(1,2), Kt_dd(2,2));
 
+    z4c.chi(m,k,j,i) = pow(detg, 1./12.*opt.chi_psi_power);
+    z4c.vKhat(m,k,j,i) = Khat;
     for(int a = 0; a < 3; ++a)
     for(int b = a; b < 3; ++b) {
-      z4c.vA_dd(m,a,b,k,j,i) = Kt_dd(a,b) - (1./3.) *
-                                z4c.vKhat(m,k,j,i) * z4c.g_dd(m,a,b,k,j,i);
+      z4c.g_dd(m,a,b,k,j,i)  = gt_dd(a,b);
+      z4c.vA_dd(m,a,b,k,j,i) = Kt_dd(a,b) - (1./3.) * Khat * gt_dd(a,b);
     }
   });
   Kokkos::fence();
@@ -107,12 +115,17 @@ void Z4c::ADMToZ4c(MeshBlockPack *pmbp, ParameterInput *pin) {
   par_for("invert z4c metric",DevExeSpace(),
   0,nmb-1,ksg,keg,jsg,jeg,isg,ieg,
   KOKKOS_LAMBDA(const int m, const int k, const int j, const int i){
-    Real detg = adm::SpatialDet(z4c.g_dd(m,0,0,k,j,i), z4c.g_dd(m,0,1,k,j,i),
-                                z4c.g_dd(m,0,2,k,j,i), z4c.g_dd(m,1,1,k,j,i),
-                                z4c.g_dd(m,1,2,k,j,i), z4c.g_dd(m,2,2,k,j,i));
+    // load the conformal metric once; determinant and inverse reuse the registers
+    AthenaScratchTensor<Real, TensorSymm::SYM2, 3, 2> gt_dd;
+    for(int a = 0; a < 3; ++a)
+    for(int b = a; b < 3; ++b) {
+      gt_dd(a,b) = z4c.g_dd(m,a,b,k,j,i);
+    }
+    Real detg = adm::SpatialDet(gt_dd(0,0), gt_dd(0,1), gt_dd(0,2),
+                                gt_dd(1,1), gt_dd(1,2), gt_dd(2,2));
     adm::SpatialInv(1.0/detg,
-              z4c.g_dd(m,0,0,k,j,i), z4c.g_dd(m,0,1,k,j,i), z4c.g_dd(m,0,2,k,j,i),
-              z4c.g_dd(m,1,1,k,j,i), z4c.g_dd(m,1,2,k,j,i), z4c.g_dd(m,2,2,k,j,i),
+              gt_dd(0,0), gt_dd(0,1), gt_dd(0,2),
+              gt_dd(1,1), gt_dd(1,2), gt_dd(2,2),
               &g3u(m,0,0,k,j,i), &g3u(m,0,1,k,j,i), &g3u(m,0,2,k,j,i),
               &g3u(m,1,1,k,j,i), &g3u(m,1,2,k,j,i), &g3u(m,2,2,k,j,i));
   });
@@ -217,19 +230,17 @@ void Z4c::Z4cToADM(MeshBlockPack *pmbp) {
   par_for("initialize z4c fields",DevExeSpace(),
   0,nmb-1,ksg,keg,jsg,jeg,isg,ieg,
   KOKKOS_LAMBDA(const int m, const int k, const int j, const int i) {
-    adm.psi4(m,k,j,i) = pow(z4c.chi(m,k,j,i), 4./opt.chi_psi_power);
-
-    // g_ab
-    for(int a = 0; a < 3; ++a)
-    for(int b = a; b < 3; ++b) {
-      adm.g_dd(m,a,b,k,j,i) = adm.psi4(m,k,j,i) * z4c.g_dd(m,a,b,k,j,i);
-    }
+    // load scalars once and fuse g_ab and K_ab into a single sweep so that each Z4c
+    // component is read and each ADM component written exactly once
+    Real psi4 = pow(z4c.chi(m,k,j,i), 4./opt.chi_psi_power);
+    Real Ktr = (1./3.) * (z4c.vKhat(m,k,j,i) + 2.*z4c.vTheta(m,k,j,i));
+    adm.psi4(m,k,j,i) = psi4;
 
-    // K_ab
     for(int a = 0; a < 3; ++a)
     for(int b = a; b < 3; ++b) {
-      adm.vK_dd(m,a,b,k,j,i) = adm.psi4(m,k,j,i) * z4c.vA_dd(m,a,b,k,j,i) +
-        (1./3.) * (z4c.vKhat(m,k,j,i) + 2.*z4c.vTheta(m,k,j,i)) * adm.g_dd(m,a,b,k,j,i);
+      Real g_ab = psi4 * z4c.g_dd(m,a,b,k,j,i);
+      adm.g_dd(m,a,b,k,j,i) = g_ab;
+      adm.vK_dd(m,a,b,k,j,i) = psi4 * z4c.vA_dd(m,a,b,k,j,i) + Ktr * g_ab;
     }
   });
   return;
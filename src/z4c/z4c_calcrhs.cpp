@@ -22,6 +22,40 @@
 
 namespace z4c {
 
+//----------------------------------------------------------------------------------------
+// Thin wrappers presenting an x-pencil of evolved variables staged in scratch memory
+// with the same call signature as the global solution arrays.  This lets the finite
+// difference operators in finite_diff.hpp be applied along x to the staged pencil
+// unchanged; the m, k, and j arguments are ignored.
+
+struct ScrPencilScalar {
+  ScrArray2D<Real> pen;
+  int n;
+  KOKKOS_INLINE_FUNCTION
+  Real operator()(int, int, int, int const i) const {
+    return pen(n,i);
+  }
+};
+
+struct ScrPencilVector {
+  ScrArray2D<Real> pen;
+  int n;
+  KOKKOS_INLINE_FUNCTION
+  Real operator()(int, int const a, int, int, int const i) const {
+    return pen(n+a,i);
+  }
+};
+
+struct ScrPencilSym2 {
+  ScrArray2D<Real> pen;
+  int n;
+  KOKKOS_INLINE_FUNCTION
+  Real operator()(int, int a, int b, int, int, int const i) const {
+    if (a > b) {int t = a; a = b; b = t;}
+    return pen(n + a*(5-a)/2 + b, i);
+  }
+};
+
 template <int NGHOST>
 //! \fn void Z4c::CalcRHS(Driver *pdriver, int stage)
 //! \brief compute rhs of the z4c equations
@@ -31,6 +65,7 @@ TaskStatus Z4c::CalcRHS(Driver *pdriver, int stage) {
   int &is = indcs.is; int &ie = indcs.ie;
   int &js = indcs.js; int &je = indcs.je;
   int &ks = indcs.ks; int &ke = indcs.ke;
+  int ncells1 = indcs.nx1 + 2*(indcs.ng);
 
   int nmb = pmy_pack->nmb_thispack;
 
@@ -38,12 +73,41 @@ TaskStatus Z4c::CalcRHS(Driver *pdriver, int stage) {
   auto &tmunu = pmy_pack->ptmunu->tmunu;
   auto &rhs = pmy_pack->pz4c->rhs;
   auto &opt = pmy_pack->pz4c->opt;
+  auto &u0_ = pmy_pack->pz4c->u0;
 
   // ===================================================================================
   // Main RHS calculation
   //
-  par_for("z4c rhs loop",DevExeSpace(),0,nmb-1,ks,ke,js,je,is,ie,
-  KOKKOS_LAMBDA(const int m, const int k, const int j, const int i) {
+  // Each team stages an x-pencil of every evolved variable in scratch memory once per
+  // (m,k,j); all x-direction stencils and point values below then re-read the staged
+  // pencil instead of global memory, cutting global reads per cell by the stencil
+  // reuse factor.  y/z-direction and mixed second derivatives need off-pencil data
+  // and still read the global arrays.
+  size_t scr_size = ScrArray2D<Real>::shmem_size(nz4c, ncells1);
+  int scr_level = 0;
+  par_for_outer("z4c rhs loop",DevExeSpace(),scr_size,scr_level,0,nmb-1,ks,ke,js,je,
+  KOKKOS_LAMBDA(TeamMember_t member, const int m, const int k, const int j) {
+    ScrArray2D<Real> upen(member.team_scratch(scr_level), nz4c, ncells1);
+    for (int n=0; n<nz4c; ++n) {
+      par_for_inner(member, 0, ncells1-1, [&](const int i) {
+        upen(n,i) = u0_(m,n,k,j,i);
+      });
+    }
+    member.team_barrier();
+
+    // pencil views of the staged variables used in place of the global arrays below
+    ScrPencilScalar palpha{upen, I_Z4C_ALPHA};
+    ScrPencilScalar pchi{upen, I_Z4C_CHI};
+    ScrPencilScalar pKhat{upen, I_Z4C_KHAT};
+    ScrPencilScalar pTheta{upen, I_Z4C_THETA};
+    ScrPencilVector pbeta_u{upen, I_Z4C_BETAX};
+    ScrPencilVector pGam_u{upen, I_Z4C_GAMX};
+    ScrPencilSym2 pg_dd{upen, I_Z4C_GXX};
+    ScrPencilSym2 pA_dd{upen, I_Z4C_AXX};
+
+    Real idx[] = {1/size.d_view(m).dx1, 1/size.d_view(m).dx2, 1/size.d_view(m).dx3};
+
+    par_for_inner(member, is, ie, [&](const int i) {
     // Define scratch arrays to be used in the following calculations
 
     // Gamma computed from the metric
@@ -113,8 +177,6 @@ TaskStatus Z4c::CalcRHS(Driver *pdriver, int stage) {
     // Lie derivative of A
     AthenaScratchTensor<Real, TensorSymm::SYM2, 3, 2> LA_dd;
 
-    Real idx[] = {1/size.d_view(m).dx1, 1/size.d_view(m).dx2, 1/size.d_view(m).dx3};
-
     // -----------------------------------------------------------------------------------
     // Initialize everything to zero
     //
@@ -177,37 +239,47 @@ TaskStatus Z4c::CalcRHS(Driver *pdriver, int stage) {
     }
 
     // -----------------------------------------------------------------------------------
-    // 1st derivatives
+    // 1st derivatives (x-direction legs evaluated from the staged pencil)
     //
     // Scalars
     for(int a = 0; a < 3; ++a) {
-      dalpha_d(a) = Dx<NGHOST>(a, idx, z4c.alpha, m,k,j,i);
-      dchi_d  (a) = Dx<NGHOST>(a, idx, z4c.chi,   m,k,j,i);
-      dKhat_d (a) = Dx<NGHOST>(a, idx, z4c.vKhat,  m,k,j,i);
-      dTheta_d(a) = Dx<NGHOST>(a, idx, z4c.vTheta, m,k,j,i);
+      dalpha_d(a) = (a==0)? Dx<NGHOST,0>(idx, palpha, m,k,j,i)
+                          : Dx<NGHOST>(a, idx, z4c.alpha, m,k,j,i);
+      dchi_d  (a) = (a==0)? Dx<NGHOST,0>(idx, pchi,   m,k,j,i)
+                          : Dx<NGHOST>(a, idx, z4c.chi,   m,k,j,i);
+      dKhat_d (a) = (a==0)? Dx<NGHOST,0>(idx, pKhat,  m,k,j,i)
+                          : Dx<NGHOST>(a, idx, z4c.vKhat,  m,k,j,i);
+      dTheta_d(a) = (a==0)? Dx<NGHOST,0>(idx, pTheta, m,k,j,i)
+                          : Dx<NGHOST>(a, idx, z4c.vTheta, m,k,j,i);
     }
 
     // Vectors
     for(int a = 0; a < 3; ++a)
     for(int b = 0; b < 3; ++b) {
-      dbeta_du(b,a) = Dx<NGHOST>(b, idx, z4c.beta_u, m,a,k,j,i);
-      dGam_du(b,a) = Dx<NGHOST>(b, idx, z4c.vGam_u,  m,a,k,j,i);
+      dbeta_du(b,a) = (b==0)? Dx<NGHOST,0>(idx, pbeta_u, m,a,k,j,i)
+                            : Dx<NGHOST>(b, idx, z4c.beta_u, m,a,k,j,i);
+      dGam_du(b,a) = (b==0)? Dx<NGHOST,0>(idx, pGam_u, m,a,k,j,i)
+                           : Dx<NGHOST>(b, idx, z4c.vGam_u,  m,a,k,j,i);
     }
 
     // Tensors
     for(int a = 0; a < 3; ++a)
     for(int b = a; b < 3; ++b)
     for(int c = 0; c < 3; ++c) {
-      dg_ddd(c,a,b) = Dx<NGHOST>(c, idx, z4c.g_dd, m,a,b,k,j,i);
+      dg_ddd(c,a,b) = (c==0)? Dx<NGHOST,0>(idx, pg_dd, m,a,b,k,j,i)
+                            : Dx<NGHOST>(c, idx, z4c.g_dd, m,a,b,k,j,i);
     }
 
     // -----------------------------------------------------------------------------------
-    // 2nd derivatives
+    // 2nd derivatives.  Mixed (Dxy) derivatives need points off the pencil in two
+    // directions at once and always read the global arrays.
     //
     // Scalars
     for(int a = 0; a < 3; ++a) {
-      ddalpha_dd(a,a) = Dxx<NGHOST>(a, idx, z4c.alpha, m,k,j,i);
-      ddchi_dd(a,a) = Dxx<NGHOST>(a, idx, z4c.chi,   m,k,j,i);
+      ddalpha_dd(a,a) = (a==0)? Dxx<NGHOST,0>(idx, palpha, m,k,j,i)
+                              : Dxx<NGHOST>(a, idx, z4c.alpha, m,k,j,i);
+      ddchi_dd(a,a) = (a==0)? Dxx<NGHOST,0>(idx, pchi,   m,k,j,i)
+                            : Dxx<NGHOST>(a, idx, z4c.chi,   m,k,j,i);
 
       for(int b = a + 1; b < 3; ++b) {
         ddalpha_dd(a,b) = Dxy<NGHOST>(a, b, idx, z4c.alpha, m,k,j,i);
@@ -218,7 +290,8 @@ TaskStatus Z4c::CalcRHS(Driver *pdriver, int stage) {
     // Vectors
     for(int c = 0; c < 3; ++c)
     for(int a = 0; a < 3; ++a) {
-      ddbeta_ddu(a,a,c) = Dxx<NGHOST>(a, idx, z4c.beta_u, m,c,k,j,i);
+      ddbeta_ddu(a,a,c) = (a==0)? Dxx<NGHOST,0>(idx, pbeta_u, m,c,k,j,i)
+                                : Dxx<NGHOST>(a, idx, z4c.beta_u, m,c,k,j,i);
       for(int b = a + 1; b < 3; ++b) {
         ddbeta_ddu(a,b,c) = Dxy<NGHOST>(a, b, idx, z4c.beta_u, m,c,k,j,i);
       }
@@ -228,7 +301,8 @@ TaskStatus Z4c::CalcRHS(Driver *pdriver, int stage) {
     for(int c = 0; c < 3; ++c)
     for(int d = c; d < 3; ++d)
     for(int a = 0; a < 3; ++a) {
-      ddg_dddd(a,a,c,d) = Dxx<NGHOST>(a, idx, z4c.g_dd, m,c,d,k,j,i);
+      ddg_dddd(a,a,c,d) = (a==0)? Dxx<NGHOST,0>(idx, pg_dd, m,c,d,k,j,i)
+                                : Dxx<NGHOST>(a, idx, z4c.g_dd, m,c,d,k,j,i);
       for(int b = a + 1; b < 3; ++b) {
         ddg_dddd(a,b,c,d) = Dxy<NGHOST>(a, b, idx, z4c.g_dd, m,c,d,k,j,i);
       }
@@ -241,18 +315,24 @@ TaskStatus Z4c::CalcRHS(Driver *pdriver, int stage) {
     //
     // Scalars
     for(int a = 0; a < 3; ++a) {
-      Lalpha += Lx<NGHOST>(a, idx, z4c.beta_u, z4c.alpha, m,a,k,j,i);
-      Lchi   += Lx<NGHOST>(a, idx, z4c.beta_u, z4c.chi,   m,a,k,j,i);
-      LKhat  += Lx<NGHOST>(a, idx, z4c.beta_u, z4c.vKhat,  m,a,k,j,i);
-      LTheta += Lx<NGHOST>(a, idx, z4c.beta_u, z4c.vTheta, m,a,k,j,i);
+      Lalpha += (a==0)? Lx<NGHOST,0>(idx, pbeta_u, palpha, m,0,k,j,i)
+                      : Lx<NGHOST>(a, idx, z4c.beta_u, z4c.alpha, m,a,k,j,i);
+      Lchi   += (a==0)? Lx<NGHOST,0>(idx, pbeta_u, pchi,   m,0,k,j,i)
+                      : Lx<NGHOST>(a, idx, z4c.beta_u, z4c.chi,   m,a,k,j,i);
+      LKhat  += (a==0)? Lx<NGHOST,0>(idx, pbeta_u, pKhat,  m,0,k,j,i)
+                      : Lx<NGHOST>(a, idx, z4c.beta_u, z4c.vKhat,  m,a,k,j,i);
+      LTheta += (a==0)? Lx<NGHOST,0>(idx, pbeta_u, pTheta, m,0,k,j,i)
+                      : Lx<NGHOST>(a, idx, z4c.beta_u, z4c.vTheta, m,a,k,j,i);
     }
 
     //
     // Vectors
     for(int a = 0; a < 3; ++a)
     for(int b = 0; b < 3; ++b) {
-      Lbeta_u(b) += Lx<NGHOST>(a, idx, z4c.beta_u, z4c.beta_u, m,a,b,k,j,i);
-      LGam_u(b)  += Lx<NGHOST>(a, idx, z4c.beta_u, z4c.vGam_u,  m,a,b,k,j,i);
+      Lbeta_u(b) += (a==0)? Lx<NGHOST,0>(idx, pbeta_u, pbeta_u, m,0,b,k,j,i)
+                          : Lx<NGHOST>(a, idx, z4c.beta_u, z4c.beta_u, m,a,b,k,j,i);
+      LGam_u(b)  += (a==0)? Lx<NGHOST,0>(idx, pbeta_u, pGam_u, m,0,b,k,j,i)
+                          : Lx<NGHOST>(a, idx, z4c.beta_u, z4c.vGam_u,  m,a,b,k,j,i);
     }
 
     //
@@ -260,24 +340,26 @@ TaskStatus Z4c::CalcRHS(Driver *pdriver, int stage) {
     for(int a = 0; a < 3; ++a)
     for(int b = a; b < 3; ++b)
     for(int c = 0; c < 3; ++c) {
-      Lg_dd(a,b) += Lx<NGHOST>(c, idx, z4c.beta_u, z4c.g_dd, m,c,a,b,k,j,i);
-      LA_dd(a,b) += Lx<NGHOST>(c, idx, z4c.beta_u, z4c.vA_dd, m,c,a,b,k,j,i);
+      Lg_dd(a,b) += (c==0)? Lx<NGHOST,0>(idx, pbeta_u, pg_dd, m,0,a,b,k,j,i)
+                          : Lx<NGHOST>(c, idx, z4c.beta_u, z4c.g_dd, m,c,a,b,k,j,i);
+      LA_dd(a,b) += (c==0)? Lx<NGHOST,0>(idx, pbeta_u, pA_dd, m,0,a,b,k,j,i)
+                          : Lx<NGHOST>(c, idx, z4c.beta_u, z4c.vA_dd, m,c,a,b,k,j,i);
     }
 
     // -----------------------------------------------------------------------------------
     // Get K from Khat
     //
-    K = z4c.vKhat(m,k,j,i) + 2.*z4c.vTheta(m,k,j,i);
+    K = pKhat(m,k,j,i) + 2.*pTheta(m,k,j,i);
 
     // -----------------------------------------------------------------------------------
     // Inverse metric
 
-    detg = adm::SpatialDet(z4c.g_dd(m,0,0,k,j,i), z4c.g_dd(m,0,1,k,j,i),
-                              z4c.g_dd(m,0,2,k,j,i), z4c.g_dd(m,1,1,k,j,i),
-                              z4c.g_dd(m,1,2,k,j,i), z4c.g_dd(m,2,2,k,j,i));
+    detg = adm::SpatialDet(pg_dd(m,0,0,k,j,i), pg_dd(m,0,1,k,j,i),
+                              pg_dd(m,0,2,k,j,i), pg_dd(m,1,1,k,j,i),
+                              pg_dd(m,1,2,k,j,i), pg_dd(m,2,2,k,j,i));
     adm::SpatialInv(1.0/detg,
-               z4c.g_dd(m,0,0,k,j,i), z4c.g_dd(m,0,1,k,j,i), z4c.g_dd(m,0,2,k,j,i),
-               z4c.g_dd(m,1,1,k,j,i), z4c.g_dd(m,1,2,k,j,i), z4c.g_dd(m,2,2,k,j,i),
+               pg_dd(m,0,0,k,j,i), pg_dd(m,0,1,k,j,i), pg_dd(m,0,2,k,j,i),
+               pg_dd(m,1,1,k,j,i), pg_dd(m,1,2,k,j,i), pg_dd(m,2,2,k,j,i),
                &g_uu(0,0), &g_uu(0,1), &g_uu(0,2),
                &g_uu(1,1), &g_uu(1,2), &g_uu(2,2));
 
@@ -308,8 +390,8 @@ TaskStatus Z4c::CalcRHS(Driver *pdriver, int stage) {
     for(int a = 0; a < 3; ++a)
     for(int b = a; b < 3; ++b) {
       for(int c = 0; c < 3; ++c) {
-        R_dd(a,b) += 0.5*(z4c.g_dd(m,c,a,k,j,i)*dGam_du(b,c) +
-                          z4c.g_dd(m,c,b,k,j,i)*dGam_du(a,c) +
+        R_dd(a,b) += 0.5*(pg_dd(m,c,a,k,j,i)*dGam_du(b,c) +
+                          pg_dd(m,c,b,k,j,i)*dGam_du(a,c) +
                           Gamma_u(c)*(Gamma_ddd(a,b,c) + Gamma_ddd(b,a,c)));
       }
       for(int c = 0; c < 3; ++c)
@@ -329,8 +411,8 @@ TaskStatus Z4c::CalcRHS(Driver *pdriver, int stage) {
     // -----------------------------------------------------------------------------------
     // Derivatives of conformal factor phi
     //
-    chi_guarded = (z4c.chi(m,k,j,i)>opt.chi_div_floor)
-                    ? z4c.chi(m,k,j,i) : opt.chi_div_floor;
+    chi_guarded = (pchi(m,k,j,i)>opt.chi_div_floor)
+                    ? pchi(m,k,j,i) : opt.chi_div_floor;
     oopsi4 = pow(chi_guarded, -4./opt.chi_psi_power);
     for(int a = 0; a < 3; ++a) {
       dphi_d(a) = dchi_d(a)/(chi_guarded * opt.chi_psi_power);
@@ -352,7 +434,7 @@ TaskStatus Z4c::CalcRHS(Driver *pdriver, int stage) {
       Rphi_dd(a,b) = 4.*dphi_d(a)*dphi_d(b) - 2.*Ddphi_dd(a,b);
       for(int c = 0; c < 3; ++c)
       for(int d = 0; d < 3; ++d) {
-        Rphi_dd(a,b) -= 2.*z4c.g_dd(m,a,b,k,j,i) * g_uu(c,d)*(Ddphi_dd(c,d) +
+        Rphi_dd(a,b) -= 2.*pg_dd(m,a,b,k,j,i) * g_uu(c,d)*(Ddphi_dd(c,d) +
             2.*dphi_d(c)*dphi_d(d));
       }
     }
@@ -386,7 +468,7 @@ TaskStatus Z4c::CalcRHS(Driver *pdriver, int stage) {
       for(int c = 0; c < 3; ++c) {
         Ddalpha_dd(a,b) -= Gamma_udd(c,a,b)*dalpha_d(c);
         for(int d = 0; d < 3; ++d) {
-            Ddalpha_dd(a,b) += 2.*z4c.g_dd(m,a,b,k,j,i) * g_uu(c,d)
+            Ddalpha_dd(a,b) += 2.*pg_dd(m,a,b,k,j,i) * g_uu(c,d)
             * dphi_d(c) * dalpha_d(d);
         }
       }
@@ -404,7 +486,7 @@ TaskStatus Z4c::CalcRHS(Driver *pdriver, int stage) {
     for(int b = a; b < 3; ++b)
     for(int c = 0; c < 3; ++c)
     for(int d = 0; d < 3; ++d) {
-      AA_dd(a,b) += g_uu(c,d) * z4c.vA_dd(m,a,c,k,j,i) * z4c.vA_dd(m,d,b,k,j,i);
+      AA_dd(a,b) += g_uu(c,d) * pA_dd(m,a,c,k,j,i) * pA_dd(m,d,b,k,j,i);
     }
     for(int a = 0; a < 3; ++a)
     for(int b = 0; b < 3; ++b) {
@@ -414,7 +496,7 @@ TaskStatus Z4c::CalcRHS(Driver *pdriver, int stage) {
     for(int b = a; b < 3; ++b)
     for(int c = 0; c < 3; ++c)
     for(int d = 0; d < 3; ++d) {
-      A_uu(a,b) += g_uu(a,c) * g_uu(b,d) * z4c.vA_dd(m,c,d,k,j,i);
+      A_uu(a,b) += g_uu(a,c) * g_uu(b,d) * pA_dd(m,c,d,k,j,i);
     }
     // TODO(JMF): dchi_d/chi_guarded is opt.chi_psi_power * dphi_d.
     for(int a = 0; a < 3; ++a) {
@@ -470,18 +552,18 @@ TaskStatus Z4c::CalcRHS(Driver *pdriver, int stage) {
     // Finalize Lg_dd and LA_dd
     for(int a = 0; a < 3; ++a)
     for(int b = a; b < 3; ++b) {
-      Lg_dd(a,b) -= (2./3.) * z4c.g_dd(m,a,b,k,j,i) * dbeta;
+      Lg_dd(a,b) -= (2./3.) * pg_dd(m,a,b,k,j,i) * dbeta;
       for(int c = 0; c < 3; ++c) {
-        Lg_dd(a,b) += dbeta_du(a,c) * z4c.g_dd(m,b,c,k,j,i);
-        Lg_dd(a,b) += dbeta_du(b,c) * z4c.g_dd(m,a,c,k,j,i);
+        Lg_dd(a,b) += dbeta_du(a,c) * pg_dd(m,b,c,k,j,i);
+        Lg_dd(a,b) += dbeta_du(b,c) * pg_dd(m,a,c,k,j,i);
       }
     }
     for(int a = 0; a < 3; ++a)
     for(int b = a; b < 3; ++b) {
-      LA_dd(a,b) -= (2./3.) * z4c.vA_dd(m,a,b,k,j,i) * dbeta;
+      LA_dd(a,b) -= (2./3.) * pA_dd(m,a,b,k,j,i) * dbeta;
       for(int c = 0; c < 3; ++c) {
-        LA_dd(a,b) += dbeta_du(b,c) * z4c.vA_dd(m,a,c,k,j,i);
-        LA_dd(a,b) += dbeta_du(a,c) * z4c.vA_dd(m,b,c,k,j,i);
+        LA_dd(a,b) += dbeta_du(b,c) * pA_dd(m,a,c,k,j,i);
+        LA_dd(a,b) += dbeta_du(a,c) * pA_dd(m,b,c,k,j,i);
       }
     }
 
@@ -489,29 +571,29 @@ TaskStatus Z4c::CalcRHS(Driver *pdriver, int stage) {
     // Assemble RHS
     //
     // Khat, chi, and Theta
-    rhs.vKhat(m,k,j,i) = - Ddalpha + z4c.alpha(m,k,j,i)
+    rhs.vKhat(m,k,j,i) = - Ddalpha + palpha(m,k,j,i)
       * (AA + (1./3.)*SQR(K)) +
       LKhat + opt.damp_kappa1*(1 - opt.damp_kappa2)
-      * z4c.alpha(m,k,j,i) * z4c.vTheta(m,k,j,i);
+      * palpha(m,k,j,i) * pTheta(m,k,j,i);
     // Matter term
-    rhs.vKhat(m,k,j,i) += 4.*M_PI * z4c.alpha(m,k,j,i) * (S + tmunu.E(m,k,j,i));
+    rhs.vKhat(m,k,j,i) += 4.*M_PI * palpha(m,k,j,i) * (S + tmunu.E(m,k,j,i));
     rhs.chi(m,k,j,i) = Lchi - (1./6.) * opt.chi_psi_power *
-      chi_guarded * z4c.alpha(m,k,j,i) * K;
-    rhs.vTheta(m,k,j,i) = LTheta + z4c.alpha(m,k,j,i) * (
-        0.5*Ht - (2. + opt.damp_kappa2) * opt.damp_kappa1 * z4c.vTheta(m,k,j,i));
+      chi_guarded * palpha(m,k,j,i) * K;
+    rhs.vTheta(m,k,j,i) = LTheta + palpha(m,k,j,i) * (
+        0.5*Ht - (2. + opt.damp_kappa2) * opt.damp_kappa1 * pTheta(m,k,j,i));
     // Matter term
-    rhs.vTheta(m,k,j,i) -= 8.*M_PI * z4c.alpha(m,k,j,i) * tmunu.E(m,k,j,i);
+    rhs.vTheta(m,k,j,i) -= 8.*M_PI * palpha(m,k,j,i) * tmunu.E(m,k,j,i);
     // If BSSN is enabled, theta is disabled.
     rhs.vTheta(m,k,j,i) *= opt.use_z4c;
     // Gamma's
     for(int a = 0; a < 3; ++a) {
-      rhs.vGam_u(m,a,k,j,i) = 2.*z4c.alpha(m,k,j,i)*DA_u(a) + LGam_u(a);
-      rhs.vGam_u(m,a,k,j,i) -= 2.*z4c.alpha(m,k,j,i) * opt.damp_kappa1 *
-          (z4c.vGam_u(m,a,k,j,i) - Gamma_u(a));
+      rhs.vGam_u(m,a,k,j,i) = 2.*palpha(m,k,j,i)*DA_u(a) + LGam_u(a);
+      rhs.vGam_u(m,a,k,j,i) -= 2.*palpha(m,k,j,i) * opt.damp_kappa1 *
+          (pGam_u(m,a,k,j,i) - Gamma_u(a));
       for(int b = 0; b < 3; ++b) {
         rhs.vGam_u(m,a,k,j,i) -= 2. * A_uu(a,b) * dalpha_d(b);
         // Matter term
-        rhs.vGam_u(m,a,k,j,i) -= 16.*M_PI * z4c.alpha(m,k,j,i)
+        rhs.vGam_u(m,a,k,j,i) -= 16.*M_PI * palpha(m,k,j,i)
                               * g_uu(a,b) * tmunu.S_d(m,b,k,j,i);
       }
     }
@@ -519,30 +601,30 @@ TaskStatus Z4c::CalcRHS(Driver *pdriver, int stage) {
     // g and A
     for(int a = 0; a < 3; ++a)
     for(int b = a; b < 3; ++b) {
-      rhs.g_dd(m,a,b,k,j,i) = - 2. * z4c.alpha(m,k,j,i) * z4c.vA_dd(m,a,b,k,j,i)
+      rhs.g_dd(m,a,b,k,j,i) = - 2. * palpha(m,k,j,i) * pA_dd(m,a,b,k,j,i)
                       + Lg_dd(a,b);
       rhs.vA_dd(m,a,b,k,j,i) = oopsi4 *
-          (-Ddalpha_dd(a,b) + z4c.alpha(m,k,j,i) * (R_dd(a,b) + Rphi_dd(a,b)));
-      rhs.vA_dd(m,a,b,k,j,i) -= (1./3.) * z4c.g_dd(m,a,b,k,j,i)
-                             * (-Ddalpha + z4c.alpha(m,k,j,i)*R);
-      rhs.vA_dd(m,a,b,k,j,i) += z4c.alpha(m,k,j,i) * (K*z4c.vA_dd(m,a,b,k,j,i)
+          (-Ddalpha_dd(a,b) + palpha(m,k,j,i) * (R_dd(a,b) + Rphi_dd(a,b)));
+      rhs.vA_dd(m,a,b,k,j,i) -= (1./3.) * pg_dd(m,a,b,k,j,i)
+                             * (-Ddalpha + palpha(m,k,j,i)*R);
+      rhs.vA_dd(m,a,b,k,j,i) += palpha(m,k,j,i) * (K*pA_dd(m,a,b,k,j,i)
                              - 2.*AA_dd(a,b));
       rhs.vA_dd(m,a,b,k,j,i) += LA_dd(a,b);
       // Matter term
-      rhs.vA_dd(m,a,b,k,j,i) -= 8.*M_PI * z4c.alpha(m,k,j,i) *
-        (oopsi4*tmunu.S_dd(m,a,b,k,j,i) - (1./3.)*S*z4c.g_dd(m,a,b,k,j,i));
+      rhs.vA_dd(m,a,b,k,j,i) -= 8.*M_PI * palpha(m,k,j,i) *
+        (oopsi4*tmunu.S_dd(m,a,b,k,j,i) - (1./3.)*S*pg_dd(m,a,b,k,j,i));
     }
     // lapse function
     Real const f = opt.lapse_oplog * opt.lapse_harmonicf
-                 + opt.lapse_harmonic * z4c.alpha(m,k,j,i);
+                 + opt.lapse_harmonic * palpha(m,k,j,i);
     rhs.alpha(m,k,j,i) = opt.lapse_advect * Lalpha
-                       - f * z4c.alpha(m,k,j,i) * z4c.vKhat(m,k,j,i);
+                       - f * palpha(m,k,j,i) * pKhat(m,k,j,i);
 
     // shift vector
     for(int a = 0; a < 3; ++a) {
-      rhs.beta_u(m,a,k,j,i) = opt.shift_ggamma * z4c.vGam_u(m,a,k,j,i)
+      rhs.beta_u(m,a,k,j,i) = opt.shift_ggamma * pGam_u(m,a,k,j,i)
                             + opt.shift_advect * Lbeta_u(a);
-      rhs.beta_u(m,a,k,j,i) -= opt.shift_eta * z4c.beta_u(m,a,k,j,i);
+      rhs.beta_u(m,a,k,j,i) -= opt.shift_eta * pbeta_u(m,a,k,j,i);
       // FORCE beta = 0
       //rhs.beta_u(m,a,k,j,i) = 0;
     }
@@ -550,12 +632,13 @@ TaskStatus Z4c::CalcRHS(Driver *pdriver, int stage) {
     // harmonic gauge terms
     for(int a = 0; a < 3; ++a) {
       rhs.beta_u(m,a,k,j,i) += opt.shift_alpha2ggamma *
-                          SQR(z4c.alpha(m,k,j,i)) * z4c.vGam_u(m,a,k,j,i);
+                          SQR(palpha(m,k,j,i)) * pGam_u(m,a,k,j,i);
       for(int b = 0; b < 3; ++b) {
-        rhs.beta_u(m,a,k,j,i) += opt.shift_hh * z4c.alpha(m,k,j,i) *
-          chi_guarded * (0.5 * z4c.alpha(m,k,j,i) * dchi_d(b) - dalpha_d(b)) * g_uu(a,b);
+        rhs.beta_u(m,a,k,j,i) += opt.shift_hh * palpha(m,k,j,i) *
+          chi_guarded * (0.5 * palpha(m,k,j,i) * dchi_d(b) - dalpha_d(b)) * g_uu(a,b);
       }
     }
+    });
   });
 
   // ===================================================================================
@@ -568,9 +651,9 @@ TaskStatus Z4c::CalcRHS(Driver *pdriver, int stage) {
   DevExeSpace(),0,nmb-1,0,nz4c-1,ks,ke,js,je,is,ie,
   KOKKOS_LAMBDA(const int m, const int n, const int k, const int j, const int i) {
     Real idx[] = {1/size.d_view(m).dx1, 1/size.d_view(m).dx2, 1/size.d_view(m).dx3};
-    for(int a = 0; a < 3; ++a) {
-      u_rhs(m,n,k,j,i) += Diss<NGHOST>(a, idx, u0, m, n, k, j, i)*diss;
-    }
+    u_rhs(m,n,k,j,i) += (Diss<NGHOST,0>(idx, u0, m, n, k, j, i)
+                       + Diss<NGHOST,1>(idx, u0, m, n, k, j, i)
+                       + Diss<NGHOST,2>(idx, u0, m, n, k, j, i))*diss;
   });
 
   return TaskStatus::complete;
@@ -43,6 +43,16 @@ void Z4c::Z4cWeyl(MeshBlockPack *pmbp) {
   auto &u_weyl = pmbp->pz4c->u_weyl;
   Kokkos::deep_copy(u_weyl, 0.);
 
+  // psi4 is only ever sampled on the registered extraction spheres, so the expensive
+  // stencil computation below is restricted to cells within interpolation reach of one
+  // of those spheres; everywhere else psi4 is left at the zero set above
+  auto &grids = pmbp->pz4c->spherical_grids;
+  int nradii = static_cast<int>(grids.size());
+  DualArray1D<Real> rad_extr("rad_extr", nradii);
+  for (int g=0; g<nradii; ++g) {rad_extr.h_view(g) = grids[g]->radius;}
+  rad_extr.template modify<HostMemSpace>();
+  rad_extr.template sync<DevExeSpace>();
+
   par_for("z4c_weyl_scalar",DevExeSpace(),0,nmb-1,ks,ke,js,je,is,ie,
   KOKKOS_LAMBDA(const int m, const int k, const int j, const int i) {
     // Simplify constants (2 & sqrt 2 factors) featured in re/im[psi4]
@@ -62,6 +72,17 @@ void Z4c::Z4cWeyl(MeshBlockPack *pmbp) {
     int nx3 = indcs.nx3;
     Real x3v = CellCenterX(k-ks, nx3, x3min, x3max);
 
+    // skip cells beyond interpolation reach of every extraction sphere.  The margin
+    // covers the Lagrange stencil width on this MeshBlock with one cell to spare
+    Real rad = std::sqrt(SQR(x1v) + SQR(x2v) + SQR(x3v));
+    Real margin = (NGHOST+2)*std::sqrt(SQR(size.d_view(m).dx1) + SQR(size.d_view(m).dx2)
+                                       + SQR(size.d_view(m).dx3));
+    bool needed = false;
+    for (int g=0; g<nradii; ++g) {
+      if (fabs(rad - rad_extr.d_view(g)) <= margin) {needed = true;}
+    }
+    if (!(needed)) {return;}
+
     // Scalars
     Real detg = 0.0;         // det(g)
     Real R = 0.0;
@@ -0,0 +1,230 @@
+//========================================================================================
+// AthenaXXX astrophysical plasma code
+// Copyright(C) 2020 James M. Stone <jmstone@ias.edu> and the Athena code team
+// Licensed under the 3-clause BSD License (the "LICENSE")
+//========================================================================================
+//! \file z4c_horizon.cpp
+//! \brief on-line apparent-horizon finder.  The expansion of outgoing null normals to
+//! coordinate spheres is evaluated from the ADM variables in one device kernel, then a
+//! fast-flow iteration on a SphericalGrid marches the mean surface radius down the
+//! angle-averaged expansion until it vanishes.  The flow is restricted to the monopole
+//! (l=0) mode of the surface, matching the spherical excision masks the radius feeds
+//! (see Coordinates::UpdateExcisionRadius).
+
+// C++ standard headers
+#include <cmath>
+#include <fstream>
+#include <iomanip>
+#include <iostream>
+#include <string>
+
+#ifdef MPI_PARALLEL
+#include <mpi.h>
+#endif
+
+#include "athena.hpp"
+#include "globals.hpp"
+#include "mesh/mesh.hpp"
+#include "z4c/z4c.hpp"
+#include "coordinates/adm.hpp"
+#include "coordinates/coordinates.hpp"
+#include "coordinates/cell_locations.hpp"
+#include "geodesic-grid/spherical_grid.hpp"
+
+namespace z4c {
+
+//----------------------------------------------------------------------------------------
+//! \fn void Z4c::HorizonExpansion(MeshBlockPack *pmbp)
+//! \brief compute the expansion Theta = D_a s^a + K_ab s^a s^b - K of the outgoing unit
+//! normal s^a to coordinate spheres about the origin, as a cell-centered field.  Only
+//! interior points are set (derivatives of the ADM metric are needed); ghost zones are
+//! zeroed, as for the constraints.
+
+template <int NGHOST>
+void Z4c::HorizonExpansion(MeshBlockPack *pmbp) {
+  // capture variables for the kernel
+  auto &indcs = pmbp->pmesh->mb_indcs;
+  auto &size = pmbp->pmb->mb_size;
+  int &is = indcs.is; int &ie = indcs.ie;
+  int &js = indcs.js; int &je = indcs.je;
+  int &ks = indcs.ks; int &ke = indcs.ke;
+  int nmb = pmbp->nmb_thispack;
+
+  auto &adm = pmbp->padm->adm;
+  auto &u_ah_ = pmbp->pz4c->u_ah;
+  Kokkos::deep_copy(u_ah_, 0.);
+  par_for("ah_expansion",DevExeSpace(),
+  0,nmb-1,ks,ke,js,je,is,ie,
+  KOKKOS_LAMBDA(const int m, const int k, const int j, const int i) {
+    AthenaScratchTensor<Real, TensorSymm::SYM2, 3, 2> g_uu;
+    AthenaScratchTensor<Real, TensorSymm::SYM2, 3, 3> dg_ddd;
+    AthenaScratchTensor<Real, TensorSymm::SYM2, 3, 3> dg_uud;
+
+    Real idx[] = {1/size.d_view(m).dx1, 1/size.d_view(m).dx2, 1/size.d_view(m).dx3};
+
+    Real &x1min = size.d_view(m).x1min;
+    Real &x1max = size.d_view(m).x1max;
+    Real &x2min = size.d_view(m).x2min;
+    Real &x2max = size.d_view(m).x2max;
+    Real &x3min = size.d_view(m).x3min;
+    Real &x3max = size.d_view(m).x3max;
+    Real xv[3];
+    xv[0] = CellCenterX(i-is, indcs.nx1, x1min, x1max);
+    xv[1] = CellCenterX(j-js, indcs.nx2, x2min, x2max);
+    xv[2] = CellCenterX(k-ks, indcs.nx3, x3min, x3max);
+    Real rad = sqrt(SQR(xv[0]) + SQR(xv[1]) + SQR(xv[2]));
+    // the level set is singular at the origin; leave the cell at zero expansion
+    if (rad < 0.5*size.d_view(m).dx1) {
+      return;
+    }
+
+    // flat gradient of the level set r - R = 0 and its derivative
+    Real u_d[3];
+    for(int a = 0; a < 3; ++a) {
+      u_d[a] = xv[a]/rad;
+    }
+    Real du_dd[3][3];
+    for(int c = 0; c < 3; ++c)
+    for(int a = 0; a < 3; ++a) {
+      du_dd[c][a] = ((c==a)? 1.0 : 0.0)/rad - xv[c]*xv[a]/(rad*rad*rad);
+    }
+
+    // first derivatives of the ADM metric
+    for(int c = 0; c < 3; ++c)
+    for(int a = 0; a < 3; ++a)
+    for(int b = a; b < 3; ++b) {
+      dg_ddd(c,a,b) = Dx<NGHOST>(c, idx, adm.g_dd, m,a,b,k,j,i);
+    }
+
+    // inverse metric and its derivative
+    Real detg = adm::SpatialDet(adm.g_dd(m,0,0,k,j,i), adm.g_dd(m,0,1,k,j,i),
+                                adm.g_dd(m,0,2,k,j,i), adm.g_dd(m,1,1,k,j,i),
+                                adm.g_dd(m,1,2,k,j,i), adm.g_dd(m,2,2,k,j,i));
+    adm::SpatialInv(1.0/detg,
+              adm.g_dd(m,0,0,k,j,i), adm.g_dd(m,0,1,k,j,i), adm.g_dd(m,0,2,k,j,i),
+              adm.g_dd(m,1,1,k,j,i), adm.g_dd(m,1,2,k,j,i), adm.g_dd(m,2,2,k,j,i),
+              &g_uu(0,0), &g_uu(0,1), &g_uu(0,2),
+              &g_uu(1,1), &g_uu(1,2), &g_uu(2,2));
+    for(int c = 0; c < 3; ++c)
+    for(int a = 0; a < 3; ++a)
+    for(int b = a; b < 3; ++b) {
+      dg_uud(c,a,b) = 0.0;
+      for(int e = 0; e < 3; ++e)
+      for(int f = 0; f < 3; ++f) {
+        dg_uud(c,a,b) -= g_uu(a,e)*g_uu(b,f)*dg_ddd(c,e,f);
+      }
+    }
+
+    // unit outward normal s^a = g^ab u_b / lam with lam^2 = g^ab u_a u_b
+    Real lam2 = 0.0;
+    for(int a = 0; a < 3; ++a)
+    for(int b = 0; b < 3; ++b) {
+      lam2 += g_uu(a,b)*u_d[a]*u_d[b];
+    }
+    Real lam = sqrt(lam2);
+    Real s_u[3] = {0.0, 0.0, 0.0};
+    for(int a = 0; a < 3; ++a)
+    for(int b = 0; b < 3; ++b) {
+      s_u[a] += g_uu(a,b)*u_d[b]/lam;
+    }
+    Real dlam_d[3];
+    for(int c = 0; c < 3; ++c) {
+      dlam_d[c] = 0.0;
+      for(int a = 0; a < 3; ++a)
+      for(int b = 0; b < 3; ++b) {
+        dlam_d[c] += dg_uud(c,a,b)*u_d[a]*u_d[b] + 2.0*g_uu(a,b)*u_d[a]*du_dd[c][b];
+      }
+      dlam_d[c] *= 0.5/lam;
+    }
+
+    // covariant divergence D_a s^a = del_a s^a + s^a del_a ln sqrt(g)
+    Real divs = 0.0;
+    for(int a = 0; a < 3; ++a)
+    for(int b = 0; b < 3; ++b) {
+      divs += dg_uud(a,a,b)*u_d[b]/lam + g_uu(a,b)*du_dd[a][b]/lam
+            - g_uu(a,b)*u_d[b]*dlam_d[a]/lam2;
+    }
+    for(int c = 0; c < 3; ++c) {
+      Real dlnsqrtg = 0.0;
+      for(int a = 0; a < 3; ++a)
+      for(int b = 0; b < 3; ++b) {
+        dlnsqrtg += g_uu(a,b)*dg_ddd(c,a,b);
+      }
+      divs += 0.5*s_u[c]*dlnsqrtg;
+    }
+
+    // extrinsic curvature terms
+    Real trK = 0.0, Kss = 0.0;
+    for(int a = 0; a < 3; ++a)
+    for(int b = 0; b < 3; ++b) {
+      trK += g_uu(a,b)*adm.vK_dd(m,a,b,k,j,i);
+      Kss += adm.vK_dd(m,a,b,k,j,i)*s_u[a]*s_u[b];
+    }
+
+    u_ah_(m,0,k,j,i) = divs + Kss - trK;
+  });
+}
+
+//----------------------------------------------------------------------------------------
+//! \fn void Z4c::FindHorizon(MeshBlockPack *pmbp)
+//! \brief fast-flow iteration on the mean surface radius: interpolate the expansion onto
+//! the trial sphere, and step the radius down the angle-averaged expansion until it
+//! vanishes.  The converged radius is fed to the excision masks and appended to the
+//! horizon history file.
+
+void Z4c::FindHorizon(MeshBlockPack *pmbp) {
+  auto &grid = ah_grid;
+  Real rah = ah_radius;
+  Real thavg = 0.0;
+  bool converged = false;
+  for (int iter=0; iter<ah_max_iter; ++iter) {
+    grid->SetRadius(rah);
+    grid->InterpolateToSphere(1, u_ah);
+
+    // angle-average the expansion; off-rank angles interpolate to zero, so a global
+    // sum over the (4pi total) solid angle weights completes the average
+    Real wtheta = 0.0;
+    for (int n=0; n<grid->nangles; ++n) {
+      wtheta += grid->solid_angles.h_view(n)*grid->interp_vals.h_view(n,0);
+    }
+#if MPI_PARALLEL_ENABLED
+    MPI_Allreduce(MPI_IN_PLACE, &wtheta, 1, MPI_ATHENA_REAL, MPI_SUM, MPI_COMM_WORLD);
+#endif
+    thavg = wtheta/(4.0*M_PI);
+    if (fabs(thavg) < ah_tol) {
+      converged = true;
+      break;
+    }
+
+    // flow step; clamp each search to a factor of two about the previous radius so a
+    // bad expansion sample cannot run the excision region away from the horizon
+    rah -= ah_flow_alpha*rah*thavg;
+    rah = fmin(fmax(rah, 0.5*ah_radius), 2.0*ah_radius);
+  }
+  ah_radius = rah;
+
+  // tighten the excision masks about the found surface (no-op unless the horizon
+  // excision scheme is selected in the input file)
+  pmbp->pcoord->UpdateExcisionRadius(ah_radius);
+
+  // append the horizon history
+  if (0 == global_variable::my_rank) {
+    std::string filename = "apparent_horizon.txt";
+    std::ifstream fileCheck(filename);
+    bool fileExists = fileCheck.good();
+    fileCheck.close();
+    std::ofstream outFile(filename, std::ios::out | std::ios::app);
+    if (!fileExists) {
+      outFile << "# 1:time 2:radius 3:mean_expansion 4:converged" << '\n';
+    }
+    outFile << std::setprecision(15) << pmbp->pmesh->time << '\t' << ah_radius << '\t'
+            << thavg << '\t' << converged << '\n';
+    outFile.close();
+  }
+}
+
+template void Z4c::HorizonExpansion<2>(MeshBlockPack *pmbp);
+template void Z4c::HorizonExpansion<3>(MeshBlockPack *pmbp);
+template void Z4c::HorizonExpansion<4>(MeshBlockPack *pmbp);
+
+} // namespace z4c
@@ -28,25 +28,17 @@ TaskStatus Z4c::NewTimeStep(Driver *pdriver, int stage) {
     return TaskStatus::complete; // only execute last stage
   }
 
-  auto &indcs = pmy_pack->pmesh->mb_indcs;
-  int nx1 = indcs.nx1;
-  int nx2 = indcs.nx2;
-  int nx3 = indcs.nx3;
-
   Real dt1 = std::numeric_limits<float>::max();
   Real dt2 = std::numeric_limits<float>::max();
   Real dt3 = std::numeric_limits<float>::max();
 
   // capture class variables for kernel
   auto &mbsize = pmy_pack->pmb->mb_size;
-  const int nmkji = (pmy_pack->nmb_thispack)*nx3*nx2*nx1;
-  const int nkji = nx3*nx2*nx1;
-
-  Kokkos::parallel_reduce("Z4c dt",Kokkos::RangePolicy<>(DevExeSpace(), 0, nmkji),
-  KOKKOS_LAMBDA(const int &idx, Real &min_dt1, Real &min_dt2, Real &min_dt3) {
-    // compute m,k,j,i indices of thread and call function
-    int m = (idx)/nkji;
+  const int nmb = pmy_pack->nmb_thispack;
 
+  // timestep depends only on the MeshBlock sizes, so reduce over blocks, not cells
+  Kokkos::parallel_reduce("Z4c dt",Kokkos::RangePolicy<>(DevExeSpace(), 0, nmb),
+  KOKKOS_LAMBDA(const int &m, Real &min_dt1, Real &min_dt2, Real &min_dt3) {
     min_dt1 = fmin((mbsize.d_view(m).dx1), min_dt1);
     min_dt2 = fmin((mbsize.d_view(m).dx2), min_dt2);
     min_dt3 = fmin((mbsize.d_view(m).dx3), min_dt3);
@@ -30,8 +30,9 @@ namespace z4c {
 
 //----------------------------------------------------------------------------------------
 PunctureTracker::PunctureTracker(Mesh *pmesh, ParameterInput *pin, int n):
-              owns_puncture{false}, pos{NAN, NAN, NAN}, betap{NAN, NAN, NAN},
-              pmesh{pmesh} {
+              owns_puncture{false}, interp_pending{false}, pos{NAN, NAN, NAN},
+              betap{NAN, NAN, NAN}, track_dt{0.0}, track_time{0.0}, pmesh{pmesh},
+              pinterp{nullptr}, ibuf_d("pt_ibuf", NDIM), ibuf_h("pt_ibuf_h", NDIM) {
   ofname = pin->GetString("job", "basename") + ".";
   ofname += pin->GetOrAddString("z4c", "filename", "puncture_");
   ofname += std::to_string(n) + ".txt";
@@ -87,32 +88,61 @@ PunctureTracker::PunctureTracker(Mesh *pmesh, ParameterInput *pin, int n):
 
 //----------------------------------------------------------------------------------------
 PunctureTracker::~PunctureTracker() {
+  FinishTracker();
+  delete pinterp;
   if (0 == global_variable::my_rank) {
     fclose(pofile);
   }
 }
 
 //----------------------------------------------------------------------------------------
-void PunctureTracker::InterpolateShift(MeshBlockPack *pmbp) {
+//! \fn void PunctureTracker::StartInterpolation(MeshBlockPack *pmbp, DevExeSpace exec)
+//! \brief launch asynchronous interpolation of the shift at the puncture position
+//!
+//! Snapshots the shift from u0 into a device buffer and starts its transfer to pinned
+//! host memory on the given execution space instance, then returns without fencing.
+//! FinishTracker() (called at the start of the next cycle's tracker task) completes the
+//! update, so the position consumed for AMR centering is one cycle stale.
+void PunctureTracker::StartInterpolation(MeshBlockPack *pmbp, DevExeSpace exec) {
   auto &pz4c = pmbp->pz4c;
-  auto &u0   = pz4c->u0;
-  auto *S    = new LagrangeInterpolator(pmbp, pos);
-
-  if (S->point_exist) {
-    betap[0]      = S->Interpolate(u0, pz4c->I_Z4C_BETAX);
-    betap[1]      = S->Interpolate(u0, pz4c->I_Z4C_BETAY);
-    betap[2]      = S->Interpolate(u0, pz4c->I_Z4C_BETAZ);
-    owns_puncture = true;
+  // the interpolator must outlive the launch; it holds the staged weights
+  delete pinterp;
+  pinterp       = new LagrangeInterpolator(pmbp, pos);
+  owns_puncture = pinterp->point_exist;
+  track_dt      = pmesh->dt;
+  track_time    = pmesh->time;
+  track_exec    = exec;
+  if (owns_puncture) {
+    pinterp->InterpolateToDevice(pz4c->u0, pz4c->I_Z4C_BETAX, NDIM, ibuf_d, exec);
+    Kokkos::deep_copy(exec, ibuf_h, ibuf_d);
   }
+  interp_pending = true;
+}
 
-  delete S;
+//----------------------------------------------------------------------------------------
+//! \fn void PunctureTracker::FinishTracker()
+//! \brief consume a pending interpolation: evolve, broadcast, and write the position
+void PunctureTracker::FinishTracker() {
+  if (!interp_pending) {
+    return;
+  }
+  // by now the launch has long since drained; this fence is effectively free
+  track_exec.fence();
+  if (owns_puncture) {
+    for (int a = 0; a < NDIM; ++a) {
+      betap[a] = ibuf_h(a);
+    }
+  }
+  EvolveTracker();
+  WriteTracker();
+  interp_pending = false;
 }
 
 //----------------------------------------------------------------------------------------
 void PunctureTracker::EvolveTracker() {
   if (owns_puncture) {
     for (int a = 0; a < NDIM; ++a) {
-      pos[a] -= pmesh->dt * betap[a];
+      pos[a] -= track_dt * betap[a];
     }
     // Impose the motion on the z = 0 plane with bitant.
     if (bitant)
@@ -160,7 +190,7 @@ void PunctureTracker::EvolveTracker() {
 void PunctureTracker::WriteTracker() const {
   if (0 == global_variable::my_rank) {
     fprintf(
-      pofile, "%.15e %.15e %.15e %.15e %.15e %.15e %.15e\n", pmesh->time,
+      pofile, "%.15e %.15e %.15e %.15e %.15e %.15e %.15e\n", track_time,
       pos[0], pos[1], pos[2], betap[0], betap[1], betap[2]);
     fflush(pofile);
   }
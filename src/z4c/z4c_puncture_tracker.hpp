@@ -17,6 +17,7 @@
 // Forward declaration
 class Mesh;
 class ParameterInput;
+class LagrangeInterpolator;
 
 namespace z4c {
 
@@ -26,24 +27,34 @@ class PunctureTracker {
  public:
   //! Initialize a tracker
   PunctureTracker(Mesh *pmesh, ParameterInput *pin, int n);
-  //! Destructor (will close output file)
+  //! Destructor (finishes any pending interpolation, closes output file)
   ~PunctureTracker();
-  //! Interpolate the shift vector to the puncture position
-  void InterpolateShift(MeshBlockPack *pmbp);
-  //! Update and broadcast the puncture position
-  void EvolveTracker();
-  //! Write data to file
-  void WriteTracker() const;
+  //! Launch asynchronous interpolation of the shift to the puncture position
+  void StartInterpolation(MeshBlockPack *pmbp, DevExeSpace exec);
+  //! Consume the interpolated shift: evolve, broadcast, and write the position
+  void FinishTracker();
   //! Get position
   inline Real GetPos(int a) {
     return pos[a];
   }
  private:
+  //! Update and broadcast the puncture position
+  void EvolveTracker();
+  //! Write data to file
+  void WriteTracker() const;
+
   bool owns_puncture;
   bool bitant;
+  bool interp_pending;        // a StartInterpolation launch awaits FinishTracker
   Real pos[NDIM];
   Real betap[NDIM];
+  Real track_dt;              // timestep of the cycle the shift was sampled on
+  Real track_time;            // time of the cycle the shift was sampled on
   Mesh const *pmesh;
+  DevExeSpace track_exec;     // execution space instance carrying the launch
+  LagrangeInterpolator *pinterp;
+  DvceArray1D<Real> ibuf_d;   // device landing buffer for the interpolated shift
+  HpinArray1D<Real> ibuf_h;   // pinned host mirror, filled asynchronously
   std::string ofname;
   FILE *pofile;
 };
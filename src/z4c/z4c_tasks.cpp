@@ -33,44 +33,74 @@ void Z4c::AssembleZ4cTasks(std::map<std::string, std::shared_ptr<TaskList>> tl)
   printf("AssembleZ4cTasks\n");
   auto &indcs = pmy_pack->pmesh->mb_indcs;
   // "before_stagen" task list
-  id.irecv = tl["before_stagen"]->AddTask(&Z4c::InitRecv, this, none);
-  id.irecvweyl = tl["before_stagen"]->AddTask(&Z4c::InitRecvWeyl, this, none);
+  id.irecv = tl["before_stagen"]->AddTask(&Z4c::InitRecv, this, none, "Z4c::InitRecv");
+  id.irecvweyl = tl["before_stagen"]->AddTask(&Z4c::InitRecvWeyl, this, none,
+                                              "Z4c::InitRecvWeyl");
 
   // "stagen" task list
   // id.ptrack = tl["stagen"]->AddTask(&Z4c::PunctureTracker, this, none);
-  id.copyu = tl["stagen"]->AddTask(&Z4c::CopyU, this, none); // id.ptrack);
+  id.copyu = tl["stagen"]->AddTask(&Z4c::CopyU, this, none, "Z4c::CopyU"); // id.ptrack);
 
   switch (indcs.ng) {
-      case 2: id.crhs  = tl["stagen"]->AddTask(&Z4c::CalcRHS<2>, this, id.copyu);
+      case 2: id.crhs  = tl["stagen"]->AddTask(&Z4c::CalcRHS<2>, this, id.copyu,
+                                               "Z4c::CalcRHS");
               break;
-      case 3: id.crhs  = tl["stagen"]->AddTask(&Z4c::CalcRHS<3>, this, id.copyu);
+      case 3: id.crhs  = tl["stagen"]->AddTask(&Z4c::CalcRHS<3>, this, id.copyu,
+                                               "Z4c::CalcRHS");
               break;
-      case 4: id.crhs  = tl["stagen"]->AddTask(&Z4c::CalcRHS<4>, this, id.copyu);
+      case 4: id.crhs  = tl["stagen"]->AddTask(&Z4c::CalcRHS<4>, this, id.copyu,
+                                               "Z4c::CalcRHS");
               break;
   }
-  id.sombc = tl["stagen"]->AddTask(&Z4c::Z4cBoundaryRHS, this, id.crhs);
-  id.expl  = tl["stagen"]->AddTask(&Z4c::ExpRKUpdate, this, id.sombc);
-  id.restu = tl["stagen"]->AddTask(&Z4c::RestrictU, this, id.expl);
-  id.sendu = tl["stagen"]->AddTask(&Z4c::SendU, this, id.restu);
-  id.recvu = tl["stagen"]->AddTask(&Z4c::RecvU, this, id.sendu);
-  id.bcs   = tl["stagen"]->AddTask(&Z4c::ApplyPhysicalBCs, this, id.recvu);
-  id.prol  = tl["stagen"]->AddTask(&Z4c::Prolongate, this, id.bcs);
-  id.algc  = tl["stagen"]->AddTask(&Z4c::EnforceAlgConstr, this, id.prol);
-  id.newdt = tl["stagen"]->AddTask(&Z4c::NewTimeStep, this, id.algc);
+  id.sombc = tl["stagen"]->AddTask(&Z4c::Z4cBoundaryRHS, this, id.crhs,
+                                   "Z4c::Z4cBoundaryRHS");
+  // the RK update is split into the boundary shell read by the sends and the interior
+  // core; the core update and the interior constraint projection are placed after the
+  // sends so they execute while the ghost-zone exchange is in flight
+  id.expl  = tl["stagen"]->AddTask(&Z4c::ExpRKUpdateShell, this, id.sombc,
+                                   "Z4c::ExpRKUpdateShell");
+  id.restu = tl["stagen"]->AddTask(&Z4c::RestrictU, this, id.expl, "Z4c::RestrictU");
+  id.sendu = tl["stagen"]->AddTask(&Z4c::SendU, this, id.restu, "Z4c::SendU");
+  id.expli = tl["stagen"]->AddTask(&Z4c::ExpRKUpdateInterior, this, id.sombc,
+                                   "Z4c::ExpRKUpdateInterior");
+  id.algci = tl["stagen"]->AddTask(&Z4c::EnforceAlgConstrInterior, this, id.expli,
+                                   "Z4c::EnforceAlgConstrInterior");
+  id.recvu = tl["stagen"]->AddTask(&Z4c::RecvU, this, id.sendu, "Z4c::RecvU");
+  id.bcs   = tl["stagen"]->AddTask(&Z4c::ApplyPhysicalBCs, this, id.recvu,
+                                   "Z4c::ApplyPhysicalBCs");
+  id.prol  = tl["stagen"]->AddTask(&Z4c::Prolongate, this, id.bcs, "Z4c::Prolongate");
+  TaskID algc_dep = id.prol | id.algci;
+  id.algc  = tl["stagen"]->AddTask(&Z4c::EnforceAlgConstr, this, algc_dep,
+                                   "Z4c::EnforceAlgConstr");
+  id.newdt = tl["stagen"]->AddTask(&Z4c::NewTimeStep, this, id.algc, "Z4c::NewTimeStep");
   // "after_stagen" task list
-  id.csend = tl["after_stagen"]->AddTask(&Z4c::ClearSend, this, none);
-  id.crecv = tl["after_stagen"]->AddTask(&Z4c::ClearRecv, this, id.csend);
-  id.z4tad = tl["after_stagen"]->AddTask(&Z4c::Z4cToADM_, this, id.crecv);
-  id.admc  = tl["after_stagen"]->AddTask(&Z4c::ADMConstraints_, this, id.z4tad);
-  id.weyl_scalar  = tl["after_stagen"]->AddTask(&Z4c::CalcWeylScalar, this, id.z4tad);
-  id.weyl_rest = tl["after_stagen"]->AddTask(&Z4c::RestrictWeyl, this, id.weyl_scalar);
-  id.weyl_send = tl["after_stagen"]->AddTask(&Z4c::SendWeyl, this, id.weyl_rest);
-  id.weyl_recv = tl["after_stagen"]->AddTask(&Z4c::RecvWeyl, this, id.weyl_send);
-  id.weyl_prol  = tl["after_stagen"]->AddTask(&Z4c::ProlongateWeyl, this, id.weyl_recv);
-  id.csendweyl = tl["after_stagen"]->AddTask(&Z4c::ClearSendWeyl, this, id.weyl_prol);
-  id.crecvweyl = tl["after_stagen"]->AddTask(&Z4c::ClearRecvWeyl, this, id.csendweyl);
-  id.wave_extr = tl["after_stagen"]->AddTask(&Z4c::CalcWaveForm, this, id.crecvweyl);
-  id.ptrck = tl["after_stagen"]->AddTask(&Z4c::PunctureTracker, this, id.z4tad);
+  id.csend = tl["after_stagen"]->AddTask(&Z4c::ClearSend, this, none, "Z4c::ClearSend");
+  id.crecv = tl["after_stagen"]->AddTask(&Z4c::ClearRecv, this, id.csend,
+                                         "Z4c::ClearRecv");
+  id.z4tad = tl["after_stagen"]->AddTask(&Z4c::Z4cToADM_, this, id.crecv,
+                                         "Z4c::Z4cToADM_");
+  id.admc  = tl["after_stagen"]->AddTask(&Z4c::ADMConstraints_, this, id.z4tad,
+                                         "Z4c::ADMConstraints_");
+  id.weyl_scalar  = tl["after_stagen"]->AddTask(&Z4c::CalcWeylScalar, this, id.z4tad,
+                                                "Z4c::CalcWeylScalar");
+  id.weyl_rest = tl["after_stagen"]->AddTask(&Z4c::RestrictWeyl, this, id.weyl_scalar,
+                                             "Z4c::RestrictWeyl");
+  id.weyl_send = tl["after_stagen"]->AddTask(&Z4c::SendWeyl, this, id.weyl_rest,
+                                             "Z4c::SendWeyl");
+  id.weyl_recv = tl["after_stagen"]->AddTask(&Z4c::RecvWeyl, this, id.weyl_send,
+                                             "Z4c::RecvWeyl");
+  id.weyl_prol  = tl["after_stagen"]->AddTask(&Z4c::ProlongateWeyl, this, id.weyl_recv,
+                                              "Z4c::ProlongateWeyl");
+  id.csendweyl = tl["after_stagen"]->AddTask(&Z4c::ClearSendWeyl, this, id.weyl_prol,
+                                             "Z4c::ClearSendWeyl");
+  id.crecvweyl = tl["after_stagen"]->AddTask(&Z4c::ClearRecvWeyl, this, id.csendweyl,
+                                             "Z4c::ClearRecvWeyl");
+  id.wave_extr = tl["after_stagen"]->AddTask(&Z4c::CalcWaveForm, this, id.crecvweyl,
+                                             "Z4c::CalcWaveForm");
+  id.ptrck = tl["after_stagen"]->AddTask(&Z4c::PunctureTracker, this, id.z4tad,
+                                         "Z4c::PunctureTracker");
+  id.ahf = tl["after_stagen"]->AddTask(&Z4c::HorizonFinder, this, id.z4tad,
+                                       "Z4c::HorizonFinder");
   return;
 }
 
@@ -89,31 +119,40 @@ void Z4c::QueueZ4cTasks() {
 
   // Run task list
   pnr->QueueTask(&Z4c::CopyU, this, Z4c_CopyU, "Z4c_CopyU", Task_Run);
+  // no dependency on a Tmunu task: the stress-energy tensor is assembled by the fused
+  // epilogue of the previous stage's MHD_C2P, so it is current before this stage starts
   switch (indcs.ng) {
     case 2:
       pnr->QueueTask(&Z4c::CalcRHS<2>, this, Z4c_CalcRHS, "Z4c_CalcRHS",
-                     Task_Run, {Z4c_CopyU}, {MHD_SetTmunu});
+                     Task_Run, {Z4c_CopyU});
       break;
     case 3:
       pnr->QueueTask(&Z4c::CalcRHS<3>, this, Z4c_CalcRHS, "Z4c_CalcRHS",
-                     Task_Run, {Z4c_CopyU}, {MHD_SetTmunu});
+                     Task_Run, {Z4c_CopyU});
       break;
     case 4:
       pnr->QueueTask(&Z4c::CalcRHS<4>, this, Z4c_CalcRHS, "Z4c_CalcRHS",
-                     Task_Run, {Z4c_CopyU}, {MHD_SetTmunu});
+                     Task_Run, {Z4c_CopyU});
       break;
   }
   pnr->QueueTask(&Z4c::Z4cBoundaryRHS, this, Z4c_SomBC, "Z4c_SomBC", Task_Run,
                  {Z4c_CalcRHS});
-  pnr->QueueTask(&Z4c::ExpRKUpdate, this, Z4c_ExplRK, "Z4c_ExplRK", Task_Run,
+  // the RK update is split into the boundary shell read by the sends and the interior
+  // core; the core update and the interior constraint projection are queued after the
+  // sends so they execute while the ghost-zone exchange is in flight
+  pnr->QueueTask(&Z4c::ExpRKUpdateShell, this, Z4c_ExplRK, "Z4c_ExplRK", Task_Run,
                  {Z4c_SomBC},{MHD_EField});
   pnr->QueueTask(&Z4c::RestrictU, this, Z4c_RestU, "Z4c_RestU", Task_Run, {Z4c_ExplRK});
   pnr->QueueTask(&Z4c::SendU, this, Z4c_SendU, "Z4c_SendU", Task_Run, {Z4c_RestU});
+  pnr->QueueTask(&Z4c::ExpRKUpdateInterior, this, Z4c_ExplRKInt, "Z4c_ExplRKInt",
+                 Task_Run, {Z4c_SomBC},{MHD_EField});
+  pnr->QueueTask(&Z4c::EnforceAlgConstrInterior, this, Z4c_AlgCInt, "Z4c_AlgCInt",
+                 Task_Run, {Z4c_ExplRKInt});
   pnr->QueueTask(&Z4c::RecvU, this, Z4c_RecvU, "Z4c_RecvU", Task_Run, {Z4c_SendU});
   pnr->QueueTask(&Z4c::ApplyPhysicalBCs, this, Z4c_BCS, "Z4c_BCS", Task_Run, {Z4c_RecvU});
   pnr->QueueTask(&Z4c::Prolongate, this, Z4c_Prolong, "Z4c_Prolong", Task_Run, {Z4c_BCS});
   pnr->QueueTask(&Z4c::EnforceAlgConstr, this, Z4c_AlgC, "Z4c_AlgC", Task_Run,
-                 {Z4c_Prolong});
+                 {Z4c_Prolong, Z4c_AlgCInt});
   pnr->QueueTask(&Z4c::Z4cToADM_, this, Z4c_Z4c2ADM, "Z4c_Z4c2ADM", Task_Run, {Z4c_AlgC});
   if (pmy_pack->pdyngr != nullptr) {
     pnr->QueueTask(&Z4c::UpdateExcisionMasks, this, Z4c_Excise, "Z4c_Excise", Task_Run,
@@ -143,6 +182,7 @@ void Z4c::QueueZ4cTasks() {
   pnr->QueueTask(&Z4c::CalcWaveForm, this, Z4c_Wave, "Z4c_Wave", Task_End,
                  {Z4c_ClearRW});
   pnr->QueueTask(&Z4c::PunctureTracker, this, Z4c_PT, "Z4c_PT", Task_End, {Z4c_ADMC});
+  pnr->QueueTask(&Z4c::HorizonFinder, this, Z4c_AHF, "Z4c_AHF", Task_End, {Z4c_ADMC});
 }
 
 //----------------------------------------------------------------------------------------
@@ -227,17 +267,35 @@ TaskStatus Z4c::SendU(Driver *pdrive, int stage) {
 //! \brief receives cell-centered conserved variables
 
 TaskStatus Z4c::RecvU(Driver *pdrive, int stage) {
+  profiler::WaitTimer wtimer("z4c_recv_u", stage);
   TaskStatus tstat = pbval_u->RecvAndUnpackCC(u0, coarse_u0);
+  if (tstat == TaskStatus::complete) {wtimer.Completed();}
   return tstat;
 }
 
+//----------------------------------------------------------------------------------------
+//! \fn  void Z4c::EnforceAlgConstrInterior
+//! \brief projects the interior cells, which are final once the RK update completes,
+//! while the ghost-zone exchange is still in flight.  EnforceAlgConstr() finishes the
+//! ghost frame after prolongation under the same condition
+
+TaskStatus Z4c::EnforceAlgConstrInterior(Driver *pdrive, int stage) {
+  if (pmy_pack->pdyngr != nullptr || stage == pdrive->nexp_stages) {
+    AlgConstr(pmy_pack, true, alg_interior);
+  }
+  return TaskStatus::complete;
+}
+
 //----------------------------------------------------------------------------------------
 //! \fn  void Z4c::EnforceAlgConstr
 //! \brief
 
 TaskStatus Z4c::EnforceAlgConstr(Driver *pdrive, int stage) {
   if (pmy_pack->pdyngr != nullptr || stage == pdrive->nexp_stages) {
-    AlgConstr(pmy_pack);
+    // the Z4c -> ADM conversion is fused into the projection sweep; it runs under the
+    // same condition as this task and the ghost zones are final once prolongation has
+    // completed (the interior was projected by EnforceAlgConstrInterior)
+    AlgConstr(pmy_pack, true, alg_ghosts);
   }
   return TaskStatus::complete;
 }
@@ -247,7 +305,10 @@ TaskStatus Z4c::EnforceAlgConstr(Driver *pdrive, int stage) {
 //! \brief
 
 TaskStatus Z4c::Z4cToADM_(Driver *pdrive, int stage) {
-  if (pmy_pack->pdyngr != nullptr || stage == pdrive->nexp_stages) {
+  // within the task lists the conversion is fused into EnforceAlgConstr, which runs
+  // earlier in the stage under the same condition; only convert here when called
+  // directly outside of them (stage 0 during initialization)
+  if (stage == 0) {
     Z4cToADM(pmy_pack);
   }
   return TaskStatus::complete;
@@ -289,8 +350,11 @@ TaskStatus Z4c::ADMConstraints_(Driver *pdrive, int stage) {
 
 TaskStatus Z4c::RestrictU(Driver *pdrive, int stage) {
   // Only execute Mesh function with SMR/SMR
+  // Restriction is limited to interface-adjacent cells; coarse data is only consumed by
+  // sends to coarser/same-level neighbors and prolongation stencils.  AMR events
+  // restrict the full volume themselves before de-refining.
   if (pmy_pack->pmesh->multilevel) {
-    pmy_pack->pmesh->pmr->RestrictCC(u0, coarse_u0, true);
+    pbval_u->RestrictInterfaceCC(u0, coarse_u0, true);
   }
   return TaskStatus::complete;
 }
@@ -329,15 +393,43 @@ TaskStatus Z4c::ApplyPhysicalBCs(Driver *pdrive, int stage) {
 TaskStatus Z4c::PunctureTracker(Driver *pdrive, int stage) {
   if (stage == pdrive->nexp_stages) {
     for (auto ptracker : pmy_pack->pz4c_ptracker) {
-      ptracker->InterpolateShift(pmy_pack);
-      ptracker->EvolveTracker();
-      ptracker->WriteTracker();
+      // consume last cycle's asynchronous interpolation, then launch this cycle's
+      // without blocking; the position used for AMR centering is one cycle stale
+      ptracker->FinishTracker();
+      ptracker->StartInterpolation(pmy_pack, pdrive->ExecSpace());
     }
   }
   return TaskStatus::complete;
 }
 
 
+//----------------------------------------------------------------------------------------
+//! \fn  void Z4c::HorizonFinder
+//! \brief low-cadence apparent-horizon search; the found radius tightens the excision
+//! masks when the horizon excision scheme is selected
+
+TaskStatus Z4c::HorizonFinder(Driver *pdrive, int stage) {
+  if (!ah_find || stage != pdrive->nexp_stages) {
+    return TaskStatus::complete;
+  }
+  Real time = pmy_pack->pmesh->time;
+  if (time < ah_last_time + ah_dt) {
+    return TaskStatus::complete;
+  }
+  ah_last_time = time;
+  auto &indcs = pmy_pack->pmesh->mb_indcs;
+  switch (indcs.ng) {
+    case 2: HorizonExpansion<2>(pmy_pack);
+            break;
+    case 3: HorizonExpansion<3>(pmy_pack);
+            break;
+    case 4: HorizonExpansion<4>(pmy_pack);
+            break;
+  }
+  FindHorizon(pmy_pack);
+  return TaskStatus::complete;
+}
+
 //----------------------------------------------------------------------------------------
 //! \fn  void Z4c::CalcWeylScalar_
 //! \brief
@@ -421,7 +513,7 @@ TaskStatus Z4c::RestrictWeyl(Driver *pdrive, int stage) {
     float time_32 = static_cast<float>(pmy_pack->pmesh->time);
     if ((last_output_time==time_32) && (stage == pdrive->nexp_stages)) {
       if (pmy_pack->pmesh->multilevel) {
-        pmy_pack->pmesh->pmr->RestrictCC(u_weyl, coarse_u_weyl, true);
+        pbval_weyl->RestrictInterfaceCC(u_weyl, coarse_u_weyl, true);
       }
     }
     return TaskStatus::complete;
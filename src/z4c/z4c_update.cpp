@@ -7,6 +7,12 @@
 //! \brief Performs update of z4c variables (u0) for each stage of explicit
 //  SSP RK integrators (e.g. RK1, RK2, RK3, RK4). Update uses weighted average
 //  and partial time step appropriate to stage.
+//
+//  The update is decomposed into a boundary shell and an interior core so that the wide
+//  (2*ng deep) shell read by the boundary sends can be updated and shipped first; the
+//  core update then executes while those messages are in flight.  The shell must be two
+//  ghost widths deep because same-level sends pack u0 within ng of each face, while
+//  sends to coarser neighbors pack restricted data sourced from fine cells within 2*ng.
 
 #include "athena.hpp"
 #include "mesh/mesh.hpp"
@@ -16,14 +22,21 @@
 
 namespace z4c {
 //----------------------------------------------------------------------------------------
-//! \fn  void Z4c::Update
-//! \brief Explicit RK update
-TaskStatus Z4c::ExpRKUpdate(Driver *pdriver, int stage) {
+//! \fn  void Z4c::ExpRKUpdateShell
+//! \brief Explicit RK update of the boundary shell (interior cells within 2*ng of a
+//! block face); once it completes, the boundary sends can be posted
+TaskStatus Z4c::ExpRKUpdateShell(Driver *pdriver, int stage) {
   auto &indcs = pmy_pack->pmesh->mb_indcs;
   int is = indcs.is, ie = indcs.ie;
   int js = indcs.js, je = indcs.je;
   int ks = indcs.ks, ke = indcs.ke;
 
+  // core box excluded from the shell; empty (never tested true) in any dimension that
+  // is too small to have one, in which case the shell covers the whole block there
+  int W = 2*indcs.ng;
+  int ics = is + W, ice = ie - W;
+  int jcs = (indcs.nx2 > 1) ? js + W : js, jce = (indcs.nx2 > 1) ? je - W : je;
+  int kcs = (indcs.nx3 > 1) ? ks + W : ks, kce = (indcs.nx3 > 1) ? ke - W : ke;
 
   Real &gam0 = pdriver->gam0[stage-1];
   Real &gam1 = pdriver->gam1[stage-1];
@@ -34,10 +47,55 @@ TaskStatus Z4c::ExpRKUpdate(Driver *pdriver, int stage) {
   int nmb1 = pmy_pack->nmb_thispack - 1;
   int nvar = nz4c;
 
-  par_for("z4c RK update",DevExeSpace(),
+  // accumulate the weighted average in double even in single-precision builds, where
+  // u0/u1/u_rhs are stored and streamed as float; constraint preservation is sensitive
+  // to roundoff in this sum.  In double builds the promotion is a no-op
+  par_for("z4c RK update shell",DevExeSpace(),
       0,nmb1,0,nvar-1,ks,ke,js,je,is,ie,
   KOKKOS_LAMBDA(const int m, const int n, const int k, const int j, const int i) {
-    u0(m,n,k,j,i) = gam0*u0(m,n,k,j,i) + gam1*u1(m,n,k,j,i) + beta_dt*u_rhs(m,n,k,j,i);
+    if (k>=kcs && k<=kce && j>=jcs && j<=jce && i>=ics && i<=ice) {return;}
+    double u = static_cast<double>(gam0)*u0(m,n,k,j,i)
+             + static_cast<double>(gam1)*u1(m,n,k,j,i)
+             + static_cast<double>(beta_dt)*u_rhs(m,n,k,j,i);
+    u0(m,n,k,j,i) = static_cast<Real>(u);
+  });
+  return TaskStatus::complete;
+}
+
+//----------------------------------------------------------------------------------------
+//! \fn  void Z4c::ExpRKUpdateInterior
+//! \brief Explicit RK update of the interior core, scheduled after the boundary sends
+//! so that it overlaps the ghost-zone exchange
+TaskStatus Z4c::ExpRKUpdateInterior(Driver *pdriver, int stage) {
+  auto &indcs = pmy_pack->pmesh->mb_indcs;
+  int is = indcs.is, ie = indcs.ie;
+  int js = indcs.js, je = indcs.je;
+  int ks = indcs.ks, ke = indcs.ke;
+
+  // core box complementing the shell updated by ExpRKUpdateShell()
+  int W = 2*indcs.ng;
+  int ics = is + W, ice = ie - W;
+  int jcs = (indcs.nx2 > 1) ? js + W : js, jce = (indcs.nx2 > 1) ? je - W : je;
+  int kcs = (indcs.nx3 > 1) ? ks + W : ks, kce = (indcs.nx3 > 1) ? ke - W : ke;
+  if (ics > ice || jcs > jce || kcs > kce) {return TaskStatus::complete;}
+
+  Real &gam0 = pdriver->gam0[stage-1];
+  Real &gam1 = pdriver->gam1[stage-1];
+  Real beta_dt = (pdriver->beta[stage-1])*(pmy_pack->pmesh->dt);
+  auto &u0 = pmy_pack->pz4c->u0;
+  auto &u1 = pmy_pack->pz4c->u1;
+  auto &u_rhs = pmy_pack->pz4c->u_rhs;
+  int nmb1 = pmy_pack->nmb_thispack - 1;
+  int nvar = nz4c;
+
+  // double accumulation for the same reason as in the shell update above
+  par_for("z4c RK update int",DevExeSpace(),
+      0,nmb1,0,nvar-1,kcs,kce,jcs,jce,ics,ice,
+  KOKKOS_LAMBDA(const int m, const int n, const int k, const int j, const int i) {
+    double u = static_cast<double>(gam0)*u0(m,n,k,j,i)
+             + static_cast<double>(gam1)*u1(m,n,k,j,i)
+             + static_cast<double>(beta_dt)*u_rhs(m,n,k,j,i);
+    u0(m,n,k,j,i) = static_cast<Real>(u);
   });
   return TaskStatus::complete;
 }
@@ -17,6 +17,9 @@
 #include <fstream>
 #include <algorithm>
 #include <string>
+#include <thread>
+#include <utility>
+#include <vector>
 
 #ifdef MPI_PARALLEL
 #include <mpi.h>
@@ -69,30 +72,78 @@ void Z4c::WaveExtr(MeshBlockPack *pmbp) {
   // Spherical Grid for user-defined history
   auto &grids = pmbp->pz4c->spherical_grids;
   auto &u_weyl = pmbp->pz4c->u_weyl;
-  auto &psi_out = pmbp->pz4c->psi_out;
   // TODO(@hzhu): add an mpi call here to fill in the ghost before interpolation to sphere
 
   // number of radii
   int nradii = grids.size();
 
+  // Interpolate Weyl scalars to the surfaces and snapshot everything needed to finish
+  // extraction, so the Ylm reduction and file append can run off the critical path
+  // while the interpolation buffers are reused by the next output
+  WaveExtrSnapshot snap;
+  snap.time = pmbp->pmesh->time;
+  for (int g=0; g<nradii; ++g) {
+    grids[g]->InterpolateToSphere(2, u_weyl);
+    int nang = grids[g]->nangles;
+    snap.radius.push_back(grids[g]->radius);
+    snap.nangles.push_back(nang);
+    std::vector<Real> th(nang), ph(nang), wt(nang), dr(nang), di(nang);
+    for (int ip = 0; ip < nang; ++ip) {
+      th[ip] = grids[g]->polar_pos.h_view(ip,0);
+      ph[ip] = grids[g]->polar_pos.h_view(ip,1);
+      wt[ip] = grids[g]->solid_angles.h_view(ip);
+      dr[ip] = grids[g]->interp_vals.h_view(ip,0);
+      di[ip] = grids[g]->interp_vals.h_view(ip,1);
+    }
+    snap.theta.push_back(std::move(th));
+    snap.phi.push_back(std::move(ph));
+    snap.weight.push_back(std::move(wt));
+    snap.datar.push_back(std::move(dr));
+    snap.datai.push_back(std::move(di));
+  }
+
+  // wait for any extraction still in flight before starting the next one, preserving
+  // the output cadence with at most one extraction overlapping evolution
+  if (wave_worker_.joinable()) {wave_worker_.join();}
+
+  bool threaded = wave_extr_async;
+#if MPI_PARALLEL_ENABLED
+  // the worker thread calls MPI_Reduce, so it needs full thread support
+  int mpi_thread_level;
+  MPI_Query_thread(&mpi_thread_level);
+  threaded = threaded && (mpi_thread_level == MPI_THREAD_MULTIPLE);
+#endif
+  if (threaded) {
+    wave_worker_ = std::thread(&Z4c::ReduceAndWriteWaveforms, this, std::move(snap));
+  } else {
+    ReduceAndWriteWaveforms(std::move(snap));
+  }
+}
+
+//----------------------------------------------------------------------------------------
+// \!fn void Z4c::ReduceAndWriteWaveforms(WaveExtrSnapshot snap)
+// \brief reduce the interpolated psi4 into spherical harmonic modes and append the
+// waveform files; may run on a worker thread while evolution continues
+
+void Z4c::ReduceAndWriteWaveforms(WaveExtrSnapshot snap) {
+  int nradii = snap.nangles.size();
+
   // maximum l; TODO(@hzhu): read in from input file
   int lmax = 8;
   bool bitant = false;
 
   Real ylmR,ylmI;
   for (int g=0; g<nradii; ++g) {
-    // Interpolate Weyl scalars to the surface
-    grids[g]->InterpolateToSphere(2, u_weyl);
     for (int l = 2; l < lmax+1; ++l) {
       for (int m = -l; m < l+1 ; ++m) {
         Real psilmR = 0.0;
         Real psilmI = 0.0;
-          for (int ip = 0; ip < grids[g]->nangles; ++ip) {
-            Real theta = grids[g]->polar_pos.h_view(ip,0);
-            Real phi = grids[g]->polar_pos.h_view(ip,1);
-            Real datareal = grids[g]->interp_vals.h_view(ip,0);
-            Real dataim = grids[g]->interp_vals.h_view(ip,1);
-            Real weight = grids[g]->solid_angles.h_view(ip);
+          for (int ip = 0; ip < snap.nangles[g]; ++ip) {
+            Real theta = snap.theta[g][ip];
+            Real phi = snap.phi[g][ip];
+            Real datareal = snap.datar[g][ip];
+            Real dataim = snap.datai[g][ip];
+            Real weight = snap.weight[g][ip];
             swsh(&ylmR,&ylmI,l,m,theta,phi);
             // The spherical harmonics transform as
             // Y^s_{l m}( Pi-th, ph ) = (-1)^{l+s} Y^s_{l -m}(th, ph)
@@ -118,9 +169,9 @@ void Z4c::WaveExtr(MeshBlockPack *pmbp) {
       for(int l=2; l<lmax+1; ++l) {
         for(int m=-l; m<l+1; ++m) {
         MPI_Reduce(MPI_IN_PLACE, &psi_out(g,LmIndex(l,m),0), 1,
-          MPI_ATHENA_REAL, MPI_SUM, 0, MPI_COMM_WORLD);
+          MPI_ATHENA_REAL, MPI_SUM, 0, wave_comm_);
         MPI_Reduce(MPI_IN_PLACE, &psi_out(g,LmIndex(l,m),1), 1,
-          MPI_ATHENA_REAL, MPI_SUM, 0, MPI_COMM_WORLD);
+          MPI_ATHENA_REAL, MPI_SUM, 0, wave_comm_);
         }
       }
     }
@@ -129,9 +180,9 @@ void Z4c::WaveExtr(MeshBlockPack *pmbp) {
       for(int l=2; l<lmax+1; ++l) {
         for(int m=-l; m<l+1; ++m) {
         MPI_Reduce(&psi_out(g,LmIndex(l,m),0), &psi_out(g,LmIndex(l,m),0), 1,
-          MPI_ATHENA_REAL, MPI_SUM, 0, MPI_COMM_WORLD);
+          MPI_ATHENA_REAL, MPI_SUM, 0, wave_comm_);
         MPI_Reduce(&psi_out(g,LmIndex(l,m),1), &psi_out(g,LmIndex(l,m),1), 1,
-          MPI_ATHENA_REAL, MPI_SUM, 0, MPI_COMM_WORLD);
+          MPI_ATHENA_REAL, MPI_SUM, 0, wave_comm_);
         }
       }
     }
@@ -143,7 +194,7 @@ void Z4c::WaveExtr(MeshBlockPack *pmbp) {
       std::string filename = "waveforms/rpsi4_real_";
       std::string filename2 = "waveforms/rpsi4_imag_";
       std::stringstream strObj;
-      strObj << std::setfill('0') << std::setw(4) << grids[g]->radius;
+      strObj << std::setfill('0') << std::setw(4) << snap.radius[g];
       filename += strObj.str();
       filename += ".txt";
       filename2 += strObj.str();
@@ -214,8 +265,8 @@ void Z4c::WaveExtr(MeshBlockPack *pmbp) {
       outFile2.open(filename2, std::ios::out | std::ios::app);
 
       // first append time
-      outFile << pmbp->pmesh->time << "\t";
-      outFile2 << pmbp->pmesh->time << "\t";
+      outFile << snap.time << "\t";
+      outFile2 << snap.time << "\t";
 
       // append waveform
       for (int l = 2; l < lmax+1; ++l) {
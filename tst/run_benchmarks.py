@@ -0,0 +1,256 @@
+#!/usr/bin/env python
+
+# Scaling benchmark script.
+
+# Usage: From this directory, call this script with python:
+#        python run_benchmarks.py
+#
+#        or from a build directory: make benchmark
+
+# Notes:
+#   - Requires Python 3+.
+#   - Runs a fixed matrix of problems at several MeshBlock sizes with the
+#     built-in kernel timing registry enabled ('<time> profiler = true'), and
+#     reports zone-cycles/second overall and per kernel group (kernels are
+#     grouped by the leading token of the name passed to par_for, so e.g.
+#     'z4c_adm' and 'z4c_rhs' both report under 'z4c').
+#   - Measurements are gated against stored baselines in
+#     benchmarks/baselines.json: a run fails if any recorded rate drops by
+#     more than the tolerance (default 25%).  Run with --update after a
+#     deliberate performance change (or on a new machine/compiler/Kokkos) to
+#     record new baselines.
+#   - Like run_tests.py, this script configures and builds each problem
+#     configuration itself; architecture-specific cmake arguments (e.g.
+#     -DKokkos_ENABLE_CUDA=On) are forwarded with --cmake.
+
+# Modules
+import argparse
+import json
+import logging
+import os
+
+# Prevent generation of .pyc files
+# This should be set before importing any user modules
+import sys
+sys.dont_write_bytecode = True
+
+# AthenaK modules
+import scripts.utils.athena as athena  # noqa
+
+# AthenaK logger
+logger = logging.getLogger('athena')
+
+# Benchmark matrix.  Each entry gives the problem name, the input file
+# (relative to inputs/), extra cmake arguments for builds that need a
+# user-specified problem generator, the MeshBlock sizes to sweep, and fixed
+# run-time overrides (cycle limit chosen so each run takes seconds, not
+# minutes).  Entries sharing cmake arguments share one build.
+benchmarks = [
+    {'name': 'advection',
+     'input': 'tests/advect_hyd.athinput',
+     'cmake': [],
+     'mb_sizes': [16, 32, 64],
+     'overrides': ['mesh/nx1=64', 'mesh/nx2=64', 'mesh/nx3=64',
+                   'time/nlim=40']},
+    {'name': 'blast',
+     'input': 'hydro/blast_hydro.athinput',
+     'cmake': ['-DPROBLEM=blast'],
+     'mb_sizes': [16, 32, 64],
+     'overrides': ['mesh/nx1=64', 'mesh/nx2=64', 'mesh/nx3=64',
+                   'mesh/x2min=-0.5', 'mesh/x2max=0.5',
+                   'mesh/x3min=-0.5', 'mesh/x3max=0.5',
+                   'time/nlim=40']},
+    {'name': 'gr_torus',
+     'input': 'grmhd/gr_fm_torus_sane_8_4.athinput',
+     'cmake': ['-DPROBLEM=gr_torus'],
+     'mb_sizes': [8, 16, 32],
+     'overrides': ['time/nlim=10']},
+    {'name': 'z4c_wave',
+     'input': 'tests/linear_wave_z4c.athinput',
+     'cmake': [],
+     'mb_sizes': [16, 32, 64],
+     'overrides': ['time/nlim=40']},
+]
+
+baseline_file = 'benchmarks/baselines.json'
+profile_file = 'build/src/profile.csv'
+
+
+# Parse profile.csv written by the timing registry, returning the overall
+# zone-cycles/second and a dict of zone-cycles/second per kernel group
+def parse_profile(filename):
+    wall_time = None
+    zcps = None
+    group_time = {}
+    with open(filename) as f:
+        for line in f:
+            line = line.strip()
+            if line.startswith('# wall_time='):
+                wall_time = float(line.split('=')[1])
+            elif line.startswith('# zone_cycles_per_second='):
+                zcps = float(line.split('=')[1])
+            elif line.startswith('kernel,'):
+                fields = line.split(',')
+                group = fields[1].split('_')[0]
+                time_mean = float(fields[5])
+                group_time[group] = group_time.get(group, 0.0) + time_mean
+    if wall_time is None or zcps is None:
+        raise RuntimeError('malformed profile file ' + filename)
+    zonecycles = zcps*wall_time
+    groups = {}
+    for group, time in group_time.items():
+        if time > 0.0:
+            groups[group] = zonecycles/time
+    return zcps, groups
+
+
+# Compare one measured rate against its baseline; returns True if it is
+# within tolerance (or no baseline is recorded yet)
+def check_rate(key, label, measured, baseline, tolerance):
+    if baseline is None:
+        logger.warning('    {0}: {1} = {2:.3g} (no baseline recorded; '
+                       'run with --update)'.format(key, label, measured))
+        return True
+    if measured < (1.0 - tolerance)*baseline:
+        logger.error('    {0}: {1} regressed: {2:.3g} vs baseline {3:.3g} '
+                     '(-{4:.1f}%)'.format(key, label, measured, baseline,
+                                          100.0*(1.0 - measured/baseline)))
+        return False
+    logger.info('    {0}: {1} = {2:.3g} (baseline {3:.3g})'
+                .format(key, label, measured, baseline))
+    return True
+
+
+# Main function
+def main(**kwargs):
+    # Make list of benchmarks to run
+    selected = kwargs.pop('benchmarks')
+    matrix = [b for b in benchmarks
+              if len(selected) == 0 or b['name'] in selected]
+    if len(matrix) == 0:
+        raise RuntimeError('no benchmarks match ' + str(selected))
+
+    tolerance = kwargs.pop('tolerance')
+    update = kwargs.pop('update')
+    cmake_args = kwargs.pop('cmake')
+
+    # Load stored baselines
+    baselines = {}
+    if os.path.exists(baseline_file):
+        with open(baseline_file) as f:
+            baselines = json.load(f)
+
+    current_dir = os.getcwd()
+    results = {}
+    num_failed = 0
+    try:
+        # Group benchmarks by build configuration so each is built once
+        configs = []
+        for bench in matrix:
+            if bench['cmake'] not in configs:
+                configs.append(bench['cmake'])
+        for config in configs:
+            os.system('rm -rf {0}/build'.format(current_dir))
+            athena.make(cmake_args + config)
+            for bench in [b for b in matrix if b['cmake'] == config]:
+                for mb in bench['mb_sizes']:
+                    key = '{0}/mb{1}'.format(bench['name'], mb)
+                    logger.info('Running benchmark ' + key)
+                    arguments = (bench['overrides'] +
+                                 ['meshblock/nx1=' + repr(mb),
+                                  'meshblock/nx2=' + repr(mb),
+                                  'meshblock/nx3=' + repr(mb),
+                                  'time/profiler=true'])
+                    athena.run(bench['input'], arguments)
+                    zcps, groups = parse_profile(profile_file)
+                    results[key] = {'zcps': zcps, 'groups': groups}
+    finally:
+        os.system('rm -rf {0}/build'.format(current_dir))
+
+    # Gate measured rates against the stored baselines
+    logger.info('\nResults (tolerance {0:.0f}%):'.format(100.0*tolerance))
+    for key, result in results.items():
+        base = baselines.get(key, {})
+        if not check_rate(key, 'zone-cycles/s', result['zcps'],
+                          base.get('zcps'), tolerance):
+            num_failed += 1
+        base_groups = base.get('groups', {})
+        for group, rate in sorted(result['groups'].items()):
+            if not check_rate(key, group + ' zone-cycles/s', rate,
+                              base_groups.get(group), tolerance):
+                num_failed += 1
+
+    # Record new baselines if requested
+    if update:
+        baselines.update(results)
+        with open(baseline_file, 'w') as f:
+            json.dump(baselines, f, indent=2, sort_keys=True)
+            f.write('\n')
+        logger.info('\nBaselines written to ' + baseline_file)
+
+    if num_failed > 0:
+        raise RuntimeError('{0} benchmark rate(s) regressed beyond '
+                           'tolerance'.format(num_failed))
+    logger.info('\nAll benchmark rates within tolerance\n')
+    return 0
+
+
+# Initialize log
+def log_init(args):
+    kwargs = vars(args)
+    logging.basicConfig(level=0)  # setting to 0 gives output cntrl to handler
+    logger.propagate = False  # don't use default handler
+    c_handler = logging.StreamHandler()  # console/terminal handler
+    c_handler.setLevel(logging.INFO)
+    c_handler.setFormatter(logging.Formatter('%(message)s'))  # only show msg
+    logger.addHandler(c_handler)
+    # setup log_file
+    log_fn = kwargs.pop('log_file')
+    if log_fn:
+        f_handler = logging.FileHandler(log_fn)
+        f_handler.setLevel(0)  # log everything
+        f_format = logging.Formatter('%(asctime)s|%(levelname)s'
+                                     ':%(name)s: %(message)s')
+        f_handler.setFormatter(f_format)
+        logger.addHandler(f_handler)
+    logger.debug('Starting AthenaK benchmarks')
+
+
+# Execute main function
+if __name__ == '__main__':
+    help_msg = ('names of benchmarks to run (default: all)')
+    parser = argparse.ArgumentParser()
+    parser.add_argument('benchmarks',
+                        type=str,
+                        default=None,
+                        nargs='*',
+                        help=help_msg)
+
+    parser.add_argument("--cmake",
+                        default=[],
+                        action='append',
+                        help='architecture specific args to pass to cmake')
+
+    parser.add_argument('--tolerance',
+                        type=float,
+                        default=0.25,
+                        help='allowed fractional slowdown vs baseline')
+
+    parser.add_argument('--update',
+                        action='store_true',
+                        help='record measured rates as new baselines')
+
+    parser.add_argument('--log_file',
+                        type=str,
+                        default=None,
+                        help='set filename of logfile')
+
+    args = parser.parse_args()
+    log_init(args)
+
+    try:
+        logger.debug('args: ' + str(vars(args)))
+        main(**vars(args))
+    except Exception:
+        logger.critical('', exc_info=True)
+        raise
@@ -0,0 +1,298 @@
+#!/usr/bin/env python
+
+# Weak/strong scaling study harness.
+
+# Usage: From this directory, call this script with python:
+#        python run_scaling.py hydro/blast_hydro.athinput --ranks 1 2 4 8
+#
+#        or from a build directory: make scaling
+
+# Notes:
+#   - Requires Python 3+ and an MPI launcher (mpiexec) on the path.
+#   - Takes a base input file (relative to inputs/) and generates the scaling
+#     series itself: strong scaling reruns the base problem unchanged on every
+#     rank count, while weak scaling doubles the mesh (cells and RegionSize
+#     together, so resolution is fixed) along successive dimensions as the
+#     rank count doubles, keeping the work per rank constant.  Rank counts
+#     must therefore be power-of-two multiples of the smallest one.
+#   - Each run executes with the built-in kernel timing registry enabled
+#     ('<time> profiler = true'); the harvested per-kernel times are folded
+#     into task categories (compute, pack/unpack of boundary buffers, MPI
+#     wait, AMR) by kernel-name prefix.
+#   - The report gives parallel efficiency per category relative to the
+#     smallest rank count -- ideal weak scaling keeps per-rank category time
+#     constant (efficiency 1), ideal strong scaling shrinks it as 1/ranks --
+#     plus the MPI wait fraction, for which 'efficiency' is meaningless.
+#     Raw measurements are also dumped as JSON next to the report.
+#   - Like run_tests.py, this script configures and builds the code itself
+#     (with -DAthena_ENABLE_MPI=On); architecture-specific cmake arguments
+#     are forwarded with --cmake.
+
+# Modules
+import argparse
+import json
+import logging
+import os
+
+# Prevent generation of .pyc files
+# This should be set before importing any user modules
+import sys
+sys.dont_write_bytecode = True
+
+# AthenaK modules
+import scripts.utils.athena as athena  # noqa
+
+# AthenaK logger
+logger = logging.getLogger('athena')
+
+profile_file = 'build/src/profile.csv'
+
+# Kernel-name prefixes assigning device kernels to task categories; anything
+# unlisted counts as compute.  Pack/unpack covers the boundary-buffer and
+# particle-migration kernels; AMR covers prolongation, restriction, and
+# refinement-condition kernels
+packunpack_prefixes = ('sendbuff', 'recvbuff', 'coalsend', 'coalrecv',
+                       'flxnbrhd', 'ppack', 'punpack', 'pmig')
+amr_prefixes = ('prol', 'profc', 'restr', 'refine', 'consrefine', 'derefine')
+
+
+# Parse an athinput file into a {(block, key): value-string} dict (comments
+# and continuation-free, which covers every file in inputs/)
+def parse_athinput(filename):
+    params = {}
+    block = None
+    with open(filename) as f:
+        for line in f:
+            line = line.split('#')[0].strip()
+            if len(line) == 0:
+                continue
+            if line.startswith('<'):
+                block = line[1:line.index('>')]
+            elif '=' in line and block is not None:
+                key, _, value = line.partition('=')
+                params[(block, key.strip())] = value.strip()
+    return params
+
+
+# Build the override list that doubles the mesh 'ndouble' times, cycling
+# through the dimensions with more than one cell so resolution (and thus work
+# per rank at fixed ranks-per-cell) is unchanged
+def weak_overrides(params, ndouble):
+    nx = [int(params[('mesh', 'nx' + repr(d))]) for d in (1, 2, 3)]
+    xmin = [float(params[('mesh', 'x' + repr(d) + 'min')]) for d in (1, 2, 3)]
+    xmax = [float(params[('mesh', 'x' + repr(d) + 'max')]) for d in (1, 2, 3)]
+    mult = [1, 1, 1]
+    d = 0
+    for _ in range(ndouble):
+        while nx[d] == 1:
+            d = (d + 1) % 3
+        mult[d] *= 2
+        d = (d + 1) % 3
+    overrides = []
+    for d in (0, 1, 2):
+        if mult[d] > 1:
+            overrides.append('mesh/nx{0}={1}'.format(d + 1, nx[d]*mult[d]))
+            overrides.append('mesh/x{0}max={1!r}'.format(
+                d + 1, xmin[d] + (xmax[d] - xmin[d])*mult[d]))
+    return overrides
+
+
+# Parse profile.csv written by the timing registry into wall time, overall
+# zone-cycles/second, MPI wait fraction, and mean time per rank per category
+def parse_profile(filename):
+    wall_time = None
+    zcps = None
+    wait_frac = None
+    times = {'compute': 0.0, 'packunpack': 0.0, 'mpi_wait': 0.0, 'amr': 0.0}
+    with open(filename) as f:
+        for line in f:
+            line = line.strip()
+            if line.startswith('# wall_time='):
+                wall_time = float(line.split('=')[1])
+            elif line.startswith('# zone_cycles_per_second='):
+                zcps = float(line.split('=')[1])
+            elif line.startswith('# mpi_wait_fraction='):
+                wait_frac = float(line.split('=')[1])
+            elif line.startswith('kernel,'):
+                fields = line.split(',')
+                name = fields[1].lower()
+                time_mean = float(fields[5])
+                if name.startswith(packunpack_prefixes):
+                    times['packunpack'] += time_mean
+                elif name.startswith(amr_prefixes):
+                    times['amr'] += time_mean
+                else:
+                    times['compute'] += time_mean
+            elif line.startswith('region,') or line.startswith('wait,'):
+                times['mpi_wait'] += float(line.split(',')[5])
+    if wall_time is None or zcps is None:
+        raise RuntimeError('malformed profile file ' + filename)
+    return {'wall_time': wall_time, 'zcps': zcps,
+            'wait_frac': wait_frac, 'times': times}
+
+
+# Parallel efficiency of one measurement against the series base.  Weak
+# scaling is ideal when the per-rank time is unchanged; strong scaling is
+# ideal when it shrinks proportionally to the added ranks
+def efficiency(mode, time_base, ranks_base, time, ranks):
+    if time <= 0.0:
+        return None
+    if mode == 'strong':
+        return (time_base*ranks_base)/(time*ranks)
+    return time_base/time
+
+
+# Format the report lines for one scaling series
+def report_series(mode, ranks_list, results):
+    lines = []
+    lines.append('{0} scaling (efficiency relative to {1} rank(s)):'
+                 .format(mode, ranks_list[0]))
+    lines.append('  {0:>6} {1:>10} {2:>10} {3:>8} {4:>8} {5:>8} {6:>9}'
+                 .format('ranks', 'wall_time', 'zcps', 'compute',
+                         'pack', 'amr', 'wait_frac'))
+    base = results[ranks_list[0]]
+    for nproc in ranks_list:
+        res = results[nproc]
+        effs = {}
+        for cat in ('compute', 'packunpack', 'amr'):
+            effs[cat] = efficiency(mode, base['times'][cat], ranks_list[0],
+                                   res['times'][cat], nproc)
+        lines.append('  {0:>6d} {1:>10.3g} {2:>10.3g} {3:>8} {4:>8} {5:>8} '
+                     '{6:>9}'.format(
+                         nproc, res['wall_time'], res['zcps'],
+                         *['{0:.3f}'.format(effs[c]) if effs[c] is not None
+                           else '-' for c in ('compute', 'packunpack', 'amr')],
+                         '{0:.3f}'.format(res['wait_frac'])
+                         if res['wait_frac'] is not None else '-'))
+    return lines
+
+
+# Main function
+def main(**kwargs):
+    input_file = kwargs.pop('input')
+    ranks_list = kwargs.pop('ranks')
+    mode = kwargs.pop('mode')
+    nlim = kwargs.pop('nlim')
+    report_file = kwargs.pop('report')
+    cmake_args = kwargs.pop('cmake')
+
+    ranks_list = sorted(set(ranks_list))
+    for nproc in ranks_list:
+        ratio = nproc//ranks_list[0]
+        if nproc != ranks_list[0]*ratio or (ratio & (ratio - 1)) != 0:
+            raise RuntimeError('rank counts must be power-of-two multiples '
+                               'of the smallest one, got ' + str(ranks_list))
+    modes = ['weak', 'strong'] if mode == 'both' else [mode]
+
+    params = parse_athinput('../inputs/' + input_file)
+    fixed = ['time/nlim=' + repr(nlim), 'time/profiler=true']
+
+    current_dir = os.getcwd()
+    results = {m: {} for m in modes}
+    try:
+        os.system('rm -rf {0}/build'.format(current_dir))
+        athena.make(cmake_args + ['-DAthena_ENABLE_MPI=On'])
+        for m in modes:
+            for nproc in ranks_list:
+                logger.info('Running {0} scaling on {1} rank(s)'
+                            .format(m, nproc))
+                overrides = list(fixed)
+                if m == 'weak':
+                    ndouble = (nproc//ranks_list[0]).bit_length() - 1
+                    overrides += weak_overrides(params, ndouble)
+                if nproc == 1:
+                    athena.run(input_file, overrides)
+                else:
+                    athena.mpirun(nproc, input_file, overrides)
+                results[m][nproc] = parse_profile(profile_file)
+    finally:
+        os.system('rm -rf {0}/build'.format(current_dir))
+
+    # Emit the report and the raw measurements
+    lines = ['Scaling report for ' + input_file,
+             'ranks: ' + ' '.join(repr(n) for n in ranks_list), '']
+    for m in modes:
+        lines += report_series(m, ranks_list, results[m])
+        lines.append('')
+    report = '\n'.join(lines)
+    logger.info('\n' + report)
+    with open(report_file, 'w') as f:
+        f.write(report)
+    json_file = os.path.splitext(report_file)[0] + '.json'
+    with open(json_file, 'w') as f:
+        json.dump(results, f, indent=2, sort_keys=True)
+        f.write('\n')
+    logger.info('Report written to {0} (raw data in {1})'
+                .format(report_file, json_file))
+    return 0
+
+
+# Initialize log
+def log_init(args):
+    kwargs = vars(args)
+    logging.basicConfig(level=0)  # setting to 0 gives output cntrl to handler
+    logger.propagate = False  # don't use default handler
+    c_handler = logging.StreamHandler()  # console/terminal handler
+    c_handler.setLevel(logging.INFO)
+    c_handler.setFormatter(logging.Formatter('%(message)s'))  # only show msg
+    logger.addHandler(c_handler)
+    # setup log_file
+    log_fn = kwargs.pop('log_file')
+    if log_fn:
+        f_handler = logging.FileHandler(log_fn)
+        f_handler.setLevel(0)  # log everything
+        f_format = logging.Formatter('%(asctime)s|%(levelname)s'
+                                     ':%(name)s: %(message)s')
+        f_handler.setFormatter(f_format)
+        logger.addHandler(f_handler)
+    logger.debug('Starting AthenaK scaling study')
+
+
+# Execute main function
+if __name__ == '__main__':
+    parser = argparse.ArgumentParser()
+    parser.add_argument('input',
+                        type=str,
+                        help='base input file, relative to inputs/')
+
+    parser.add_argument('--ranks',
+                        type=int,
+                        nargs='+',
+                        default=[1, 2, 4, 8],
+                        help='MPI rank counts of the series')
+
+    parser.add_argument('--mode',
+                        type=str,
+                        default='both',
+                        choices=['weak', 'strong', 'both'],
+                        help='which scaling series to run')
+
+    parser.add_argument('--nlim',
+                        type=int,
+                        default=20,
+                        help='cycle limit of each run')
+
+    parser.add_argument('--report',
+                        type=str,
+                        default='scaling_report.txt',
+                        help='filename of the generated report')
+
+    parser.add_argument("--cmake",
+                        default=[],
+                        action='append',
+                        help='architecture specific args to pass to cmake')
+
+    parser.add_argument('--log_file',
+                        type=str,
+                        default=None,
+                        help='set filename of logfile')
+
+    args = parser.parse_args()
+    log_init(args)
+
+    try:
+        logger.debug('args: ' + str(vars(args)))
+        main(**vars(args))
+    except Exception:
+        logger.critical('', exc_info=True)
+        raise
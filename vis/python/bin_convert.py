@@ -256,6 +256,226 @@ def read_binary(filename):
     return filedata
 
 
+def _lz4_decompress(src, out_size):
+    """
+    Decompresses an LZ4 block (raw block format, no frame header) to out_size bytes.
+    Pure-python fallback for the chunk-compressed 'zbin' format, so no lz4 module is
+    required to read files.
+    """
+    dst = bytearray()
+    i = 0
+    n = len(src)
+    while i < n:
+        token = src[i]
+        i += 1
+        litlen = token >> 4
+        if litlen == 15:
+            while True:
+                b = src[i]
+                i += 1
+                litlen += b
+                if b != 255:
+                    break
+        dst += src[i:i + litlen]
+        i += litlen
+        if i >= n:
+            break  # last sequence contains only literals
+        moff = src[i] | (src[i + 1] << 8)
+        i += 2
+        mlen = (token & 15) + 4
+        if (token & 15) == 15:
+            while True:
+                b = src[i]
+                i += 1
+                mlen += b
+                if b != 255:
+                    break
+        start = len(dst) - moff
+        for k in range(mlen):  # byte-by-byte to handle overlapping matches
+            dst.append(dst[start + k])
+    if len(dst) != out_size:
+        raise ValueError(f"corrupt LZ4 chunk: got {len(dst)} bytes, expected {out_size}")
+    return bytes(dst)
+
+
+def _byte_unshuffle(shuf, nelem, esize):
+    """
+    Inverts the byte-shuffle applied before compression in zbin files: regroups esize
+    planes of nelem bytes back into nelem elements of esize bytes.
+    """
+    out = bytearray(nelem * esize)
+    for k in range(esize):
+        out[k::esize] = shuf[k * nelem:(k + 1) * nelem]
+    return bytes(out)
+
+
+def read_compressed_binary(filename):
+    """
+    Reads a chunk-compressed zbin file from filename to dictionary.
+
+    Layout follows the bin format, except that each MeshBlock record stores one
+    compressed chunk per variable, prefixed by its compressed size (uint32).  Chunks
+    are byte-shuffled then LZ4 compressed (block format), optionally after mantissa
+    truncation (recorded as "mantissa bits" in the preheader).
+
+    args:
+      filename - string
+          filename of zbin file to read
+
+    returns:
+      filedata - dict
+          dictionary of fluid file data (same keys as read_binary)
+    """
+
+    filedata = {}
+
+    # load file and get size
+    fp = open(filename, "rb")
+    fp.seek(0, 2)
+    filesize = fp.tell()
+    fp.seek(0, 0)
+
+    # load header information and validate file format
+    code_header = fp.readline().split()
+    if len(code_header) < 1:
+        raise TypeError("unknown file format")
+    if code_header[0] != b"Athena":
+        raise TypeError(
+            f"bad file format \"{code_header[0].decode('utf-8')}\" "
+            + '(should be "Athena")'
+        )
+    version = code_header[-1].split(b"=")[-1]
+    if version != b"1.1":
+        raise TypeError(f"unsupported file format version {version.decode('utf-8')}")
+
+    pheader_count = int(fp.readline().split(b"=")[-1])
+    pheader = {}
+    for _ in range(pheader_count - 1):
+        key, val = [x.strip() for x in fp.readline().decode("utf-8").split("=")]
+        pheader[key] = val
+    time = float(pheader["time"])
+    cycle = int(pheader["cycle"])
+    locsizebytes = int(pheader["size of location"])
+    varsizebytes = int(pheader["size of variable"])
+
+    nvars = int(fp.readline().split(b"=")[-1])
+    var_list = [v.decode("utf-8") for v in fp.readline().split()[1:]]
+    header_size = int(fp.readline().split(b"=")[-1])
+    header = [
+        line.decode("utf-8").split("#")[0].strip()
+        for line in fp.read(header_size).split(b"\n")
+    ]
+    header = [line for line in header if len(line) > 0]
+
+    if locsizebytes not in [4, 8]:
+        raise ValueError(f"unsupported location size (in bytes) {locsizebytes}")
+    if varsizebytes not in [4, 8]:
+        raise ValueError(f"unsupported variable size (in bytes) {varsizebytes}")
+
+    locfmt = "d" if locsizebytes == 8 else "f"
+    varfmt = np.float64 if varsizebytes == 8 else np.float32
+
+    # load grid information from header and validate
+    def get_from_header(header, blockname, keyname):
+        blockname = blockname.strip()
+        keyname = keyname.strip()
+        if not blockname.startswith("<"):
+            blockname = "<" + blockname
+        if blockname[-1] != ">":
+            blockname += ">"
+        block = "<none>"
+        for line in [entry for entry in header]:
+            if line.startswith("<"):
+                block = line
+                continue
+            key, value = line.split("=")
+            if block == blockname and key.strip() == keyname:
+                return value
+        raise KeyError(f"no parameter called {blockname}/{keyname}")
+
+    Nx1 = int(get_from_header(header, "<mesh>", "nx1"))
+    Nx2 = int(get_from_header(header, "<mesh>", "nx2"))
+    Nx3 = int(get_from_header(header, "<mesh>", "nx3"))
+    nx1 = int(get_from_header(header, "<meshblock>", "nx1"))
+    nx2 = int(get_from_header(header, "<meshblock>", "nx2"))
+    nx3 = int(get_from_header(header, "<meshblock>", "nx3"))
+
+    nghost = int(get_from_header(header, "<mesh>", "nghost"))
+
+    x1min = float(get_from_header(header, "<mesh>", "x1min"))
+    x1max = float(get_from_header(header, "<mesh>", "x1max"))
+    x2min = float(get_from_header(header, "<mesh>", "x2min"))
+    x2max = float(get_from_header(header, "<mesh>", "x2max"))
+    x3min = float(get_from_header(header, "<mesh>", "x3min"))
+    x3max = float(get_from_header(header, "<mesh>", "x3max"))
+
+    # load data from each meshblock
+    mb_count = 0
+
+    mb_index = []
+    mb_logical = []
+    mb_geometry = []
+
+    mb_data = {}
+    for var in var_list:
+        mb_data[var] = []
+
+    while fp.tell() < filesize:
+        mb_index.append(np.array(struct.unpack("@6i", fp.read(24))) - nghost)
+        nx1_out = (mb_index[mb_count][1] - mb_index[mb_count][0]) + 1
+        nx2_out = (mb_index[mb_count][3] - mb_index[mb_count][2]) + 1
+        nx3_out = (mb_index[mb_count][5] - mb_index[mb_count][4]) + 1
+        cells = nx1_out * nx2_out * nx3_out
+
+        mb_logical.append(np.array(struct.unpack("@4i", fp.read(16))))
+        mb_geometry.append(
+            np.array(struct.unpack("=6" + locfmt, fp.read(6 * locsizebytes)))
+        )
+
+        # one compressed chunk per variable, prefixed by its compressed size
+        for var in var_list:
+            csize = struct.unpack("@I", fp.read(4))[0]
+            shuf = _lz4_decompress(fp.read(csize), cells * varsizebytes)
+            raw = _byte_unshuffle(shuf, cells, varsizebytes)
+            data = np.frombuffer(raw, dtype=varfmt)
+            mb_data[var].append(data.reshape(nx3_out, nx2_out, nx1_out))
+        mb_count += 1
+
+    fp.close()
+
+    filedata["header"] = header
+    filedata["time"] = time
+    filedata["cycle"] = cycle
+    filedata["var_names"] = var_list
+
+    filedata["Nx1"] = Nx1
+    filedata["Nx2"] = Nx2
+    filedata["Nx3"] = Nx3
+    filedata["nvars"] = nvars
+
+    filedata["x1min"] = x1min
+    filedata["x1max"] = x1max
+    filedata["x2min"] = x2min
+    filedata["x2max"] = x2max
+    filedata["x3min"] = x3min
+    filedata["x3max"] = x3max
+
+    filedata["n_mbs"] = mb_count
+    filedata["nx1_mb"] = nx1
+    filedata["nx2_mb"] = nx2
+    filedata["nx3_mb"] = nx3
+    filedata["nx1_out_mb"] = (mb_index[0][1] - mb_index[0][0]) + 1
+    filedata["nx2_out_mb"] = (mb_index[0][3] - mb_index[0][2]) + 1
+    filedata["nx3_out_mb"] = (mb_index[0][5] - mb_index[0][4]) + 1
+
+    filedata["mb_index"] = np.array(mb_index)
+    filedata["mb_logical"] = np.array(mb_logical)
+    filedata["mb_geometry"] = np.array(mb_geometry)
+    filedata["mb_data"] = mb_data
+
+    return filedata
+
+
 def read_coarsened_binary(filename):
     """
     Reads a bin file from filename to dictionary.
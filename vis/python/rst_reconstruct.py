@@ -0,0 +1,76 @@
+"""
+Reconstructs a full AthenaK restart file from an incremental delta restart dump.
+
+Delta dumps (.drst files) are written between full checkpoints when 'full_every'
+is set in the restart <output> block.  Each one stores LZ4-compressed,
+byte-shuffled XOR-deltas of every MeshBlock against the last full dump, so it
+cannot be restarted from directly; this script combines it with that full dump
+to recover a standard .rst file:
+
+  python rst_reconstruct.py <delta.drst> <base.rst> <out.rst>
+
+where <base.rst> is the full dump named by the base file number stored in the
+delta preamble (printed by this script).  The output is byte-identical to the
+full restart file that would have been written at that checkpoint.
+"""
+
+import struct
+import sys
+
+from bin_convert import _byte_unshuffle, _lz4_decompress
+
+
+def reconstruct(delta_fname, base_fname, out_fname):
+    """
+    Combines the delta dump delta_fname with the full dump base_fname it was
+    encoded against, and writes a standard restart file to out_fname.
+    """
+    with open(delta_fname, "rb") as fp:
+        pre = fp.read(56)
+        magic = pre[0:16].split(b"\0")[0]
+        if magic != b"athenak-drst-v1":
+            raise TypeError(f"{delta_fname} is not an AthenaK delta restart file")
+        base_fn, nmb_total, real_size = struct.unpack("@iii", pre[16:28])
+        data_size, header_size, base_off = struct.unpack("@QQQ", pre[32:56])
+        print(f"delta dump encoded against full dump number {base_fn:05d}")
+        print(f"{nmb_total} MeshBlocks of {data_size} bytes each")
+
+        # the standard restart header (input parameters, mesh data, logical
+        # locations, etc.) of this checkpoint is stored verbatim after the preamble
+        header = fp.read(header_size)
+
+        # decode per-MeshBlock records, XORing against the base payload where the
+        # block existed at the last full dump (base_idx >= 0)
+        blocks = {}
+        nelem = data_size // real_size
+        with open(base_fname, "rb") as bfp:
+            for _ in range(nmb_total):
+                gid, base_idx, csize = struct.unpack("@iiI", fp.read(12))
+                raw = _lz4_decompress(fp.read(csize), data_size)
+                raw = _byte_unshuffle(raw, nelem, real_size)
+                if base_idx >= 0:
+                    bfp.seek(base_off + base_idx * data_size)
+                    ref = bfp.read(data_size)
+                    if len(ref) != data_size:
+                        raise RuntimeError(f"{base_fname} is too short to be the "
+                                           "base of this delta dump")
+                    raw = (int.from_bytes(raw, "little")
+                           ^ int.from_bytes(ref, "little")).to_bytes(data_size,
+                                                                     "little")
+                blocks[gid] = raw
+
+    if len(blocks) != nmb_total:
+        raise RuntimeError("duplicate MeshBlock ids found in delta dump")
+
+    with open(out_fname, "wb") as ofp:
+        ofp.write(header)
+        for gid in range(nmb_total):
+            ofp.write(blocks[gid])
+    print(f"wrote {out_fname}")
+
+
+if __name__ == "__main__":
+    if len(sys.argv) != 4:
+        print("usage: python rst_reconstruct.py <delta.drst> <base.rst> <out.rst>")
+        sys.exit(1)
+    reconstruct(sys.argv[1], sys.argv[2], sys.argv[3])
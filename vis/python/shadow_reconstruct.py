@@ -0,0 +1,90 @@
+"""
+Reconstructs a full AthenaK restart file from flushed shadow checkpoint images.
+
+Shadow checkpoints (file_type = shadow_rst in an <output> block) are refreshed
+in host memory every 'dcycle' cycles: each rank keeps a compressed image of its
+own restart payload and of a buddy rank's payload.  When the job is signalled
+(e.g. after a node failure kills a peer), surviving ranks flush what they hold
+to rst/*.bshd files.  Because every rank's payload is held by two ranks, the
+surviving files cover all MeshBlocks after the loss of any single rank; this
+script merges them into a standard restart file:
+
+  python shadow_reconstruct.py <out.rst> <image.bshd> [<image.bshd> ...]
+
+Pass every .bshd file that was flushed (rst/*.bshd).  Images from different
+cycles may be mixed (e.g. if ranks were signalled mid-refresh); only the most
+recent cycle with complete MeshBlock coverage is used.  The output is
+byte-identical to the full restart file that would have been written at that
+checkpoint.
+"""
+
+import struct
+import sys
+
+from bin_convert import _byte_unshuffle, _lz4_decompress
+
+
+def read_image(fname):
+    """
+    Reads one flushed shadow image, returning a dict with its origin rank,
+    cycle, header bytes, and per-MeshBlock payloads keyed by gid.
+    """
+    with open(fname, "rb") as fp:
+        pre = fp.read(64)
+        magic = pre[0:16].split(b"\0")[0]
+        if magic != b"athenak-bshd-v1":
+            raise TypeError(f"{fname} is not an AthenaK shadow checkpoint image")
+        (rank, nranks, nmb, gids, ncycle,
+         real_size, nmb_total) = struct.unpack("@iiiiiii", pre[16:44])
+        data_size, header_size = struct.unpack("@QQ", pre[48:64])
+        header = fp.read(header_size)
+
+        blocks = {}
+        nelem = data_size // real_size
+        for _ in range(nmb):
+            gid, csize = struct.unpack("@iI", fp.read(8))
+            raw = _lz4_decompress(fp.read(csize), data_size)
+            blocks[gid] = _byte_unshuffle(raw, nelem, real_size)
+    return {"rank": rank, "nranks": nranks, "gids": gids, "ncycle": ncycle,
+            "nmb_total": nmb_total, "header": header, "blocks": blocks}
+
+
+def reconstruct(out_fname, image_fnames):
+    """
+    Merges the shadow images in image_fnames and writes a standard restart
+    file to out_fname, using the most recent cycle with complete coverage.
+    """
+    images = [read_image(f) for f in image_fnames]
+
+    # try cycles newest-first; an image holds the payload of its origin rank,
+    # so coverage is complete when the union of gids at one cycle has no holes
+    for ncycle in sorted({im["ncycle"] for im in images}, reverse=True):
+        blocks = {}
+        header = None
+        nmb_total = 0
+        for im in images:
+            if im["ncycle"] == ncycle:
+                header = im["header"]
+                nmb_total = im["nmb_total"]
+                blocks.update(im["blocks"])
+        if len(blocks) == nmb_total:
+            print(f"reconstructing checkpoint of cycle {ncycle} "
+                  f"from {nmb_total} MeshBlocks")
+            with open(out_fname, "wb") as ofp:
+                ofp.write(header)
+                for gid in range(nmb_total):
+                    ofp.write(blocks[gid])
+            print(f"wrote {out_fname}")
+            return
+        print(f"cycle {ncycle}: only {len(blocks)}/{nmb_total} MeshBlocks "
+              "recovered, trying an older cycle")
+    raise RuntimeError("no cycle with complete MeshBlock coverage; more than "
+                       "one rank's images may be missing")
+
+
+if __name__ == "__main__":
+    if len(sys.argv) < 3:
+        print("usage: python shadow_reconstruct.py <out.rst> "
+              "<image.bshd> [<image.bshd> ...]")
+        sys.exit(1)
+    reconstruct(sys.argv[1], sys.argv[2:])
@@ -0,0 +1,84 @@
+"""
+Merges per-rank AthenaK tracked-particle logs into a single time series.
+
+Tracked-particle ('trk') outputs append tag-sorted segments to one binary log
+per rank ("<basename>.<rank>.trk"), each covering 'flush_every' output
+cadences, with a companion text index ("<basename>.<rank>.trk.idx") listing one
+segment per line.  A particle appears in the log of whichever rank owned it at
+each cadence, so recovering trajectories requires merging across ranks:
+
+  python trk_merge.py <basename> <out.npz>
+
+where <basename> includes the "trk/" directory prefix.  The output is an .npz
+archive with arrays 'time' and 'cycle' of shape (ncadence,) and 'data' of shape
+(ncadence, ntrack, 6) holding (x,y,z,vx,vy,vz) indexed by particle tag, with
+NaN for tags absent at a cadence.
+"""
+
+import glob
+import re
+import struct
+import sys
+
+import numpy as np
+
+
+def read_rank_log(fname):
+    """
+    Reads every segment of one per-rank log, returning a dict mapping
+    (time, cycle) to an array of records [tag, x, y, z, vx, vy, vz].
+    """
+    cadences = {}
+    rec_size = struct.calcsize("@i6f")
+    with open(fname, "rb") as fp:
+        while True:
+            head = fp.read(8)
+            if len(head) < 8:
+                break
+            ncad, nrec = struct.unpack("@ii", head)
+            meta = [struct.unpack("@dii", fp.read(16)) for _ in range(ncad)]
+            raw = fp.read(nrec * rec_size)
+            recs = np.frombuffer(raw, dtype=np.dtype([("tag", "i4"),
+                                                      ("pos", "f4", 6)]))
+            start = 0
+            for time, cycle, count in meta:
+                cadences[(time, cycle)] = recs[start:start+count]
+                start += count
+    return cadences
+
+
+def merge(basename, out_fname):
+    """
+    Merges all per-rank logs matching "<basename>.<rank>.trk" and writes the
+    combined time series to the .npz archive out_fname.
+    """
+    fnames = sorted(glob.glob(f"{basename}.[0-9]*.trk"))
+    fnames = [f for f in fnames if re.match(r".*\.\d{6}\.trk$", f)]
+    if not fnames:
+        raise FileNotFoundError(f"no per-rank logs matching {basename}.*.trk")
+
+    merged = {}
+    ntrack = 0
+    for fname in fnames:
+        for key, recs in read_rank_log(fname).items():
+            merged.setdefault(key, []).append(recs)
+            if len(recs) > 0:
+                ntrack = max(ntrack, int(recs["tag"].max()) + 1)
+
+    keys = sorted(merged.keys(), key=lambda k: k[1])  # by cycle
+    time = np.array([k[0] for k in keys])
+    cycle = np.array([k[1] for k in keys], dtype=np.int32)
+    data = np.full((len(keys), ntrack, 6), np.nan, dtype=np.float32)
+    for n, key in enumerate(keys):
+        for recs in merged[key]:
+            data[n, recs["tag"], :] = recs["pos"]
+    np.savez(out_fname, time=time, cycle=cycle, data=data)
+    print(f"merged {len(fnames)} rank logs: {len(keys)} cadences, "
+          f"{ntrack} tracked particles")
+
+
+if __name__ == "__main__":
+    if len(sys.argv) != 3:
+        print(__doc__)
+        sys.exit(1)
+    merge(sys.argv[1], sys.argv[2])